@@ -0,0 +1,1367 @@
+
+_allocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <worker>:
+#define NPAGE 64
+#define PGSIZE 4096
+
+void
+worker(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int i, j, pid;
+  char *p;
+
+  for(i = 0; i < NROUND; i++){
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+   d:	e9 9e 00 00 00       	jmp    b0 <worker+0xb0>
+    p = sbrk(NPAGE * PGSIZE);
+  12:	83 ec 0c             	sub    $0xc,%esp
+  15:	68 00 00 04 00       	push   $0x40000
+  1a:	e8 24 04 00 00       	call   443 <sbrk>
+  1f:	83 c4 10             	add    $0x10,%esp
+  22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(p == (char*)-1){
+  25:	83 7d ec ff          	cmpl   $0xffffffff,-0x14(%ebp)
+  29:	75 17                	jne    42 <worker+0x42>
+      printf(1, "allocbench: sbrk failed\n");
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	68 c8 09 00 00       	push   $0x9c8
+  33:	6a 01                	push   $0x1
+  35:	e8 2d 05 00 00       	call   567 <printf>
+  3a:	83 c4 10             	add    $0x10,%esp
+      exit();
+  3d:	e8 79 03 00 00       	call   3bb <exit>
+    }
+    for(j = 0; j < NPAGE; j++)
+  42:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  49:	eb 16                	jmp    61 <worker+0x61>
+      p[j * PGSIZE] = j;
+  4b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  4e:	c1 e0 0c             	shl    $0xc,%eax
+  51:	89 c2                	mov    %eax,%edx
+  53:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  56:	01 d0                	add    %edx,%eax
+  58:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  5b:	88 10                	mov    %dl,(%eax)
+    for(j = 0; j < NPAGE; j++)
+  5d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  61:	83 7d f0 3f          	cmpl   $0x3f,-0x10(%ebp)
+  65:	7e e4                	jle    4b <worker+0x4b>
+    sbrk(-NPAGE * PGSIZE);
+  67:	83 ec 0c             	sub    $0xc,%esp
+  6a:	68 00 00 fc ff       	push   $0xfffc0000
+  6f:	e8 cf 03 00 00       	call   443 <sbrk>
+  74:	83 c4 10             	add    $0x10,%esp
+
+    if((pid = fork()) < 0){
+  77:	e8 37 03 00 00       	call   3b3 <fork>
+  7c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  7f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  83:	79 17                	jns    9c <worker+0x9c>
+      printf(1, "allocbench: fork failed\n");
+  85:	83 ec 08             	sub    $0x8,%esp
+  88:	68 e1 09 00 00       	push   $0x9e1
+  8d:	6a 01                	push   $0x1
+  8f:	e8 d3 04 00 00       	call   567 <printf>
+  94:	83 c4 10             	add    $0x10,%esp
+      exit();
+  97:	e8 1f 03 00 00       	call   3bb <exit>
+    }
+    if(pid == 0)
+  9c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  a0:	75 05                	jne    a7 <worker+0xa7>
+      exit();
+  a2:	e8 14 03 00 00       	call   3bb <exit>
+    wait();
+  a7:	e8 17 03 00 00       	call   3c3 <wait>
+  for(i = 0; i < NROUND; i++){
+  ac:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  b0:	81 7d f4 c7 00 00 00 	cmpl   $0xc7,-0xc(%ebp)
+  b7:	0f 8e 55 ff ff ff    	jle    12 <worker+0x12>
+  }
+  exit();
+  bd:	e8 f9 02 00 00       	call   3bb <exit>
+
+000000c2 <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  c2:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  c6:	83 e4 f0             	and    $0xfffffff0,%esp
+  c9:	ff 71 fc             	push   -0x4(%ecx)
+  cc:	55                   	push   %ebp
+  cd:	89 e5                	mov    %esp,%ebp
+  cf:	51                   	push   %ecx
+  d0:	83 ec 14             	sub    $0x14,%esp
+  int i, t0, t1, npage;
+
+  printf(1, "allocbench starting\n");
+  d3:	83 ec 08             	sub    $0x8,%esp
+  d6:	68 fa 09 00 00       	push   $0x9fa
+  db:	6a 01                	push   $0x1
+  dd:	e8 85 04 00 00       	call   567 <printf>
+  e2:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+  e5:	e8 69 03 00 00       	call   453 <uptime>
+  ea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < NWORKER; i++){
+  ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  f4:	eb 12                	jmp    108 <main+0x46>
+    if(fork() == 0)
+  f6:	e8 b8 02 00 00       	call   3b3 <fork>
+  fb:	85 c0                	test   %eax,%eax
+  fd:	75 05                	jne    104 <main+0x42>
+      worker();
+  ff:	e8 fc fe ff ff       	call   0 <worker>
+  for(i = 0; i < NWORKER; i++){
+ 104:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 108:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 10c:	7e e8                	jle    f6 <main+0x34>
+  }
+  for(i = 0; i < NWORKER; i++)
+ 10e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 115:	eb 09                	jmp    120 <main+0x5e>
+    wait();
+ 117:	e8 a7 02 00 00       	call   3c3 <wait>
+  for(i = 0; i < NWORKER; i++)
+ 11c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 120:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 124:	7e f1                	jle    117 <main+0x55>
+  t1 = uptime();
+ 126:	e8 28 03 00 00       	call   453 <uptime>
+ 12b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // Heap pages only; fork's page tables and copies come on top.
+  npage = NWORKER * NROUND * NPAGE;
+ 12e:	c7 45 e8 00 90 01 00 	movl   $0x19000,-0x18(%ebp)
+  printf(1, "%d workers: ", NWORKER);
+ 135:	83 ec 04             	sub    $0x4,%esp
+ 138:	6a 08                	push   $0x8
+ 13a:	68 0f 0a 00 00       	push   $0xa0f
+ 13f:	6a 01                	push   $0x1
+ 141:	e8 21 04 00 00       	call   567 <printf>
+ 146:	83 c4 10             	add    $0x10,%esp
+  benchrate(npage, "heap pages", t0, t1);
+ 149:	ff 75 ec             	push   -0x14(%ebp)
+ 14c:	ff 75 f0             	push   -0x10(%ebp)
+ 14f:	68 1c 0a 00 00       	push   $0xa1c
+ 154:	ff 75 e8             	push   -0x18(%ebp)
+ 157:	e8 dc 07 00 00       	call   938 <benchrate>
+ 15c:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 15f:	e8 57 02 00 00       	call   3bb <exit>
+
+00000164 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 164:	55                   	push   %ebp
+ 165:	89 e5                	mov    %esp,%ebp
+ 167:	57                   	push   %edi
+ 168:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 169:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 16c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 16f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 172:	89 cb                	mov    %ecx,%ebx
+ 174:	89 df                	mov    %ebx,%edi
+ 176:	89 d1                	mov    %edx,%ecx
+ 178:	fc                   	cld
+ 179:	f3 aa                	rep stos %al,%es:(%edi)
+ 17b:	89 ca                	mov    %ecx,%edx
+ 17d:	89 fb                	mov    %edi,%ebx
+ 17f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 182:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 185:	90                   	nop
+ 186:	5b                   	pop    %ebx
+ 187:	5f                   	pop    %edi
+ 188:	5d                   	pop    %ebp
+ 189:	c3                   	ret
+
+0000018a <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 196:	90                   	nop
+ 197:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 19a:	8d 42 01             	lea    0x1(%edx),%eax
+ 19d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1a6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1a9:	0f b6 12             	movzbl (%edx),%edx
+ 1ac:	88 10                	mov    %dl,(%eax)
+ 1ae:	0f b6 00             	movzbl (%eax),%eax
+ 1b1:	84 c0                	test   %al,%al
+ 1b3:	75 e2                	jne    197 <strcpy+0xd>
+    ;
+  return os;
+ 1b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1b8:	c9                   	leave
+ 1b9:	c3                   	ret
+
+000001ba <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1ba:	55                   	push   %ebp
+ 1bb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1bd:	eb 08                	jmp    1c7 <strcmp+0xd>
+    p++, q++;
+ 1bf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1c3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ca:	0f b6 00             	movzbl (%eax),%eax
+ 1cd:	84 c0                	test   %al,%al
+ 1cf:	74 10                	je     1e1 <strcmp+0x27>
+ 1d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d4:	0f b6 10             	movzbl (%eax),%edx
+ 1d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1da:	0f b6 00             	movzbl (%eax),%eax
+ 1dd:	38 c2                	cmp    %al,%dl
+ 1df:	74 de                	je     1bf <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e4:	0f b6 00             	movzbl (%eax),%eax
+ 1e7:	0f b6 d0             	movzbl %al,%edx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	0f b6 00             	movzbl (%eax),%eax
+ 1f0:	0f b6 c0             	movzbl %al,%eax
+ 1f3:	29 c2                	sub    %eax,%edx
+ 1f5:	89 d0                	mov    %edx,%eax
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+
+000001f9 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1f9:	55                   	push   %ebp
+ 1fa:	89 e5                	mov    %esp,%ebp
+ 1fc:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 206:	eb 04                	jmp    20c <strlen+0x13>
+ 208:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 20c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 20f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 212:	01 d0                	add    %edx,%eax
+ 214:	0f b6 00             	movzbl (%eax),%eax
+ 217:	84 c0                	test   %al,%al
+ 219:	75 ed                	jne    208 <strlen+0xf>
+    ;
+  return n;
+ 21b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 21e:	c9                   	leave
+ 21f:	c3                   	ret
+
+00000220 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 223:	8b 45 10             	mov    0x10(%ebp),%eax
+ 226:	50                   	push   %eax
+ 227:	ff 75 0c             	push   0xc(%ebp)
+ 22a:	ff 75 08             	push   0x8(%ebp)
+ 22d:	e8 32 ff ff ff       	call   164 <stosb>
+ 232:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 235:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 238:	c9                   	leave
+ 239:	c3                   	ret
+
+0000023a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 23a:	55                   	push   %ebp
+ 23b:	89 e5                	mov    %esp,%ebp
+ 23d:	83 ec 04             	sub    $0x4,%esp
+ 240:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 243:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 246:	eb 14                	jmp    25c <strchr+0x22>
+    if(*s == c)
+ 248:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24b:	0f b6 00             	movzbl (%eax),%eax
+ 24e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 251:	75 05                	jne    258 <strchr+0x1e>
+      return (char*)s;
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	eb 13                	jmp    26b <strchr+0x31>
+  for(; *s; s++)
+ 258:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 25c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	84 c0                	test   %al,%al
+ 264:	75 e2                	jne    248 <strchr+0xe>
+  return 0;
+ 266:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+
+0000026d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 26d:	55                   	push   %ebp
+ 26e:	89 e5                	mov    %esp,%ebp
+ 270:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 273:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 27a:	eb 42                	jmp    2be <gets+0x51>
+    cc = read(0, &c, 1);
+ 27c:	83 ec 04             	sub    $0x4,%esp
+ 27f:	6a 01                	push   $0x1
+ 281:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 284:	50                   	push   %eax
+ 285:	6a 00                	push   $0x0
+ 287:	e8 47 01 00 00       	call   3d3 <read>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 292:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 296:	7e 33                	jle    2cb <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 298:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 29b:	8d 50 01             	lea    0x1(%eax),%edx
+ 29e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2a1:	89 c2                	mov    %eax,%edx
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	01 c2                	add    %eax,%edx
+ 2a8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ac:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2ae:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2b2:	3c 0a                	cmp    $0xa,%al
+ 2b4:	74 16                	je     2cc <gets+0x5f>
+ 2b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ba:	3c 0d                	cmp    $0xd,%al
+ 2bc:	74 0e                	je     2cc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2c1:	83 c0 01             	add    $0x1,%eax
+ 2c4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2c7:	7f b3                	jg     27c <gets+0xf>
+ 2c9:	eb 01                	jmp    2cc <gets+0x5f>
+      break;
+ 2cb:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2cc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	01 d0                	add    %edx,%eax
+ 2d4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2d7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+
+000002dc <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2dc:	55                   	push   %ebp
+ 2dd:	89 e5                	mov    %esp,%ebp
+ 2df:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2e2:	83 ec 08             	sub    $0x8,%esp
+ 2e5:	6a 00                	push   $0x0
+ 2e7:	ff 75 08             	push   0x8(%ebp)
+ 2ea:	e8 0c 01 00 00       	call   3fb <open>
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2f9:	79 07                	jns    302 <stat+0x26>
+    return -1;
+ 2fb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 300:	eb 25                	jmp    327 <stat+0x4b>
+  r = fstat(fd, st);
+ 302:	83 ec 08             	sub    $0x8,%esp
+ 305:	ff 75 0c             	push   0xc(%ebp)
+ 308:	ff 75 f4             	push   -0xc(%ebp)
+ 30b:	e8 03 01 00 00       	call   413 <fstat>
+ 310:	83 c4 10             	add    $0x10,%esp
+ 313:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 316:	83 ec 0c             	sub    $0xc,%esp
+ 319:	ff 75 f4             	push   -0xc(%ebp)
+ 31c:	e8 c2 00 00 00       	call   3e3 <close>
+ 321:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 324:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+
+00000329 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 329:	55                   	push   %ebp
+ 32a:	89 e5                	mov    %esp,%ebp
+ 32c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 32f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 336:	eb 25                	jmp    35d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 338:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 33b:	89 d0                	mov    %edx,%eax
+ 33d:	c1 e0 02             	shl    $0x2,%eax
+ 340:	01 d0                	add    %edx,%eax
+ 342:	01 c0                	add    %eax,%eax
+ 344:	89 c1                	mov    %eax,%ecx
+ 346:	8b 45 08             	mov    0x8(%ebp),%eax
+ 349:	8d 50 01             	lea    0x1(%eax),%edx
+ 34c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 34f:	0f b6 00             	movzbl (%eax),%eax
+ 352:	0f be c0             	movsbl %al,%eax
+ 355:	01 c8                	add    %ecx,%eax
+ 357:	83 e8 30             	sub    $0x30,%eax
+ 35a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 360:	0f b6 00             	movzbl (%eax),%eax
+ 363:	3c 2f                	cmp    $0x2f,%al
+ 365:	7e 0a                	jle    371 <atoi+0x48>
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	0f b6 00             	movzbl (%eax),%eax
+ 36d:	3c 39                	cmp    $0x39,%al
+ 36f:	7e c7                	jle    338 <atoi+0xf>
+  return n;
+ 371:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 374:	c9                   	leave
+ 375:	c3                   	ret
+
+00000376 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 376:	55                   	push   %ebp
+ 377:	89 e5                	mov    %esp,%ebp
+ 379:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 37c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 382:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 385:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 388:	eb 17                	jmp    3a1 <memmove+0x2b>
+    *dst++ = *src++;
+ 38a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 38d:	8d 42 01             	lea    0x1(%edx),%eax
+ 390:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 393:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 396:	8d 48 01             	lea    0x1(%eax),%ecx
+ 399:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 39c:	0f b6 12             	movzbl (%edx),%edx
+ 39f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3a1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3a7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3aa:	85 c0                	test   %eax,%eax
+ 3ac:	7f dc                	jg     38a <memmove+0x14>
+  return vdst;
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b1:	c9                   	leave
+ 3b2:	c3                   	ret
+
+000003b3 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3b3:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <exit>:
+SYSCALL(exit)
+ 3bb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <wait>:
+SYSCALL(wait)
+ 3c3:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <pipe>:
+SYSCALL(pipe)
+ 3cb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <read>:
+SYSCALL(read)
+ 3d3:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <write>:
+SYSCALL(write)
+ 3db:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <close>:
+SYSCALL(close)
+ 3e3:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <kill>:
+SYSCALL(kill)
+ 3eb:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <exec>:
+SYSCALL(exec)
+ 3f3:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <open>:
+SYSCALL(open)
+ 3fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <mknod>:
+SYSCALL(mknod)
+ 403:	b8 11 00 00 00       	mov    $0x11,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <unlink>:
+SYSCALL(unlink)
+ 40b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <fstat>:
+SYSCALL(fstat)
+ 413:	b8 08 00 00 00       	mov    $0x8,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <link>:
+SYSCALL(link)
+ 41b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <mkdir>:
+SYSCALL(mkdir)
+ 423:	b8 14 00 00 00       	mov    $0x14,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <chdir>:
+SYSCALL(chdir)
+ 42b:	b8 09 00 00 00       	mov    $0x9,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <dup>:
+SYSCALL(dup)
+ 433:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <getpid>:
+SYSCALL(getpid)
+ 43b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <sbrk>:
+SYSCALL(sbrk)
+ 443:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sleep>:
+SYSCALL(sleep)
+ 44b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <uptime>:
+SYSCALL(uptime)
+ 453:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 45b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getschedstat>:
+SYSCALL(getschedstat)
+ 463:	b8 17 00 00 00       	mov    $0x17,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 46b:	b8 18 00 00 00       	mov    $0x18,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <setshare>:
+SYSCALL(setshare)
+ 473:	b8 19 00 00 00       	mov    $0x19,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <getbcachestat>:
+SYSCALL(getbcachestat)
+ 47b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 483:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <getlogstat>:
+SYSCALL(getlogstat)
+ 48b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 493:	55                   	push   %ebp
+ 494:	89 e5                	mov    %esp,%ebp
+ 496:	83 ec 18             	sub    $0x18,%esp
+ 499:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49c:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 49f:	83 ec 04             	sub    $0x4,%esp
+ 4a2:	6a 01                	push   $0x1
+ 4a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4a7:	50                   	push   %eax
+ 4a8:	ff 75 08             	push   0x8(%ebp)
+ 4ab:	e8 2b ff ff ff       	call   3db <write>
+ 4b0:	83 c4 10             	add    $0x10,%esp
+}
+ 4b3:	90                   	nop
+ 4b4:	c9                   	leave
+ 4b5:	c3                   	ret
+
+000004b6 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b6:	55                   	push   %ebp
+ 4b7:	89 e5                	mov    %esp,%ebp
+ 4b9:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4bc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4c3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4c7:	74 17                	je     4e0 <printint+0x2a>
+ 4c9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4cd:	79 11                	jns    4e0 <printint+0x2a>
+    neg = 1;
+ 4cf:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d9:	f7 d8                	neg    %eax
+ 4db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4de:	eb 06                	jmp    4e6 <printint+0x30>
+  } else {
+    x = xx;
+ 4e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4e6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4ed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f8:	f7 f1                	div    %ecx
+ 4fa:	89 d1                	mov    %edx,%ecx
+ 4fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4ff:	8d 50 01             	lea    0x1(%eax),%edx
+ 502:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 505:	0f b6 91 34 0d 00 00 	movzbl 0xd34(%ecx),%edx
+ 50c:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 510:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 513:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 516:	ba 00 00 00 00       	mov    $0x0,%edx
+ 51b:	f7 f1                	div    %ecx
+ 51d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 520:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 524:	75 c7                	jne    4ed <printint+0x37>
+  if(neg)
+ 526:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 52a:	74 2d                	je     559 <printint+0xa3>
+    buf[i++] = '-';
+ 52c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52f:	8d 50 01             	lea    0x1(%eax),%edx
+ 532:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 535:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 53a:	eb 1d                	jmp    559 <printint+0xa3>
+    putc(fd, buf[i]);
+ 53c:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 53f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 542:	01 d0                	add    %edx,%eax
+ 544:	0f b6 00             	movzbl (%eax),%eax
+ 547:	0f be c0             	movsbl %al,%eax
+ 54a:	83 ec 08             	sub    $0x8,%esp
+ 54d:	50                   	push   %eax
+ 54e:	ff 75 08             	push   0x8(%ebp)
+ 551:	e8 3d ff ff ff       	call   493 <putc>
+ 556:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 559:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 55d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 561:	79 d9                	jns    53c <printint+0x86>
+}
+ 563:	90                   	nop
+ 564:	90                   	nop
+ 565:	c9                   	leave
+ 566:	c3                   	ret
+
+00000567 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 567:	55                   	push   %ebp
+ 568:	89 e5                	mov    %esp,%ebp
+ 56a:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 56d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 574:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 577:	83 c0 04             	add    $0x4,%eax
+ 57a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 57d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 584:	e9 59 01 00 00       	jmp    6e2 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 589:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 58c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 58f:	01 d0                	add    %edx,%eax
+ 591:	0f b6 00             	movzbl (%eax),%eax
+ 594:	0f be c0             	movsbl %al,%eax
+ 597:	25 ff 00 00 00       	and    $0xff,%eax
+ 59c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 59f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5a3:	75 2c                	jne    5d1 <printf+0x6a>
+      if(c == '%'){
+ 5a5:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5a9:	75 0c                	jne    5b7 <printf+0x50>
+        state = '%';
+ 5ab:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5b2:	e9 27 01 00 00       	jmp    6de <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5ba:	0f be c0             	movsbl %al,%eax
+ 5bd:	83 ec 08             	sub    $0x8,%esp
+ 5c0:	50                   	push   %eax
+ 5c1:	ff 75 08             	push   0x8(%ebp)
+ 5c4:	e8 ca fe ff ff       	call   493 <putc>
+ 5c9:	83 c4 10             	add    $0x10,%esp
+ 5cc:	e9 0d 01 00 00       	jmp    6de <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5d1:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5d5:	0f 85 03 01 00 00    	jne    6de <printf+0x177>
+      if(c == 'd'){
+ 5db:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5df:	75 1e                	jne    5ff <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5e4:	8b 00                	mov    (%eax),%eax
+ 5e6:	6a 01                	push   $0x1
+ 5e8:	6a 0a                	push   $0xa
+ 5ea:	50                   	push   %eax
+ 5eb:	ff 75 08             	push   0x8(%ebp)
+ 5ee:	e8 c3 fe ff ff       	call   4b6 <printint>
+ 5f3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5f6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5fa:	e9 d8 00 00 00       	jmp    6d7 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5ff:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 603:	74 06                	je     60b <printf+0xa4>
+ 605:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 609:	75 1e                	jne    629 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 60b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 60e:	8b 00                	mov    (%eax),%eax
+ 610:	6a 00                	push   $0x0
+ 612:	6a 10                	push   $0x10
+ 614:	50                   	push   %eax
+ 615:	ff 75 08             	push   0x8(%ebp)
+ 618:	e8 99 fe ff ff       	call   4b6 <printint>
+ 61d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 620:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 624:	e9 ae 00 00 00       	jmp    6d7 <printf+0x170>
+      } else if(c == 's'){
+ 629:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 62d:	75 43                	jne    672 <printf+0x10b>
+        s = (char*)*ap;
+ 62f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 632:	8b 00                	mov    (%eax),%eax
+ 634:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 637:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 63b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 63f:	75 25                	jne    666 <printf+0xff>
+          s = "(null)";
+ 641:	c7 45 f4 27 0a 00 00 	movl   $0xa27,-0xc(%ebp)
+        while(*s != 0){
+ 648:	eb 1c                	jmp    666 <printf+0xff>
+          putc(fd, *s);
+ 64a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64d:	0f b6 00             	movzbl (%eax),%eax
+ 650:	0f be c0             	movsbl %al,%eax
+ 653:	83 ec 08             	sub    $0x8,%esp
+ 656:	50                   	push   %eax
+ 657:	ff 75 08             	push   0x8(%ebp)
+ 65a:	e8 34 fe ff ff       	call   493 <putc>
+ 65f:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 662:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 666:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 669:	0f b6 00             	movzbl (%eax),%eax
+ 66c:	84 c0                	test   %al,%al
+ 66e:	75 da                	jne    64a <printf+0xe3>
+ 670:	eb 65                	jmp    6d7 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 672:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 676:	75 1d                	jne    695 <printf+0x12e>
+        putc(fd, *ap);
+ 678:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 67b:	8b 00                	mov    (%eax),%eax
+ 67d:	0f be c0             	movsbl %al,%eax
+ 680:	83 ec 08             	sub    $0x8,%esp
+ 683:	50                   	push   %eax
+ 684:	ff 75 08             	push   0x8(%ebp)
+ 687:	e8 07 fe ff ff       	call   493 <putc>
+ 68c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 68f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 693:	eb 42                	jmp    6d7 <printf+0x170>
+      } else if(c == '%'){
+ 695:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 699:	75 17                	jne    6b2 <printf+0x14b>
+        putc(fd, c);
+ 69b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 69e:	0f be c0             	movsbl %al,%eax
+ 6a1:	83 ec 08             	sub    $0x8,%esp
+ 6a4:	50                   	push   %eax
+ 6a5:	ff 75 08             	push   0x8(%ebp)
+ 6a8:	e8 e6 fd ff ff       	call   493 <putc>
+ 6ad:	83 c4 10             	add    $0x10,%esp
+ 6b0:	eb 25                	jmp    6d7 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6b2:	83 ec 08             	sub    $0x8,%esp
+ 6b5:	6a 25                	push   $0x25
+ 6b7:	ff 75 08             	push   0x8(%ebp)
+ 6ba:	e8 d4 fd ff ff       	call   493 <putc>
+ 6bf:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c5:	0f be c0             	movsbl %al,%eax
+ 6c8:	83 ec 08             	sub    $0x8,%esp
+ 6cb:	50                   	push   %eax
+ 6cc:	ff 75 08             	push   0x8(%ebp)
+ 6cf:	e8 bf fd ff ff       	call   493 <putc>
+ 6d4:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6d7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6de:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6e8:	01 d0                	add    %edx,%eax
+ 6ea:	0f b6 00             	movzbl (%eax),%eax
+ 6ed:	84 c0                	test   %al,%al
+ 6ef:	0f 85 94 fe ff ff    	jne    589 <printf+0x22>
+    }
+  }
+}
+ 6f5:	90                   	nop
+ 6f6:	90                   	nop
+ 6f7:	c9                   	leave
+ 6f8:	c3                   	ret
+
+000006f9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6f9:	55                   	push   %ebp
+ 6fa:	89 e5                	mov    %esp,%ebp
+ 6fc:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 702:	83 e8 08             	sub    $0x8,%eax
+ 705:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 708:	a1 50 0d 00 00       	mov    0xd50,%eax
+ 70d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 710:	eb 24                	jmp    736 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 712:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 715:	8b 00                	mov    (%eax),%eax
+ 717:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 71a:	72 12                	jb     72e <free+0x35>
+ 71c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 722:	72 24                	jb     748 <free+0x4f>
+ 724:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 727:	8b 00                	mov    (%eax),%eax
+ 729:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 72c:	72 1a                	jb     748 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 72e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 731:	8b 00                	mov    (%eax),%eax
+ 733:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 736:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 739:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 73c:	73 d4                	jae    712 <free+0x19>
+ 73e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 741:	8b 00                	mov    (%eax),%eax
+ 743:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 746:	73 ca                	jae    712 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 748:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74b:	8b 40 04             	mov    0x4(%eax),%eax
+ 74e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 755:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 758:	01 c2                	add    %eax,%edx
+ 75a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75d:	8b 00                	mov    (%eax),%eax
+ 75f:	39 c2                	cmp    %eax,%edx
+ 761:	75 24                	jne    787 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 763:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 766:	8b 50 04             	mov    0x4(%eax),%edx
+ 769:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76c:	8b 00                	mov    (%eax),%eax
+ 76e:	8b 40 04             	mov    0x4(%eax),%eax
+ 771:	01 c2                	add    %eax,%edx
+ 773:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 776:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 779:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77c:	8b 00                	mov    (%eax),%eax
+ 77e:	8b 10                	mov    (%eax),%edx
+ 780:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 783:	89 10                	mov    %edx,(%eax)
+ 785:	eb 0a                	jmp    791 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 787:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78a:	8b 10                	mov    (%eax),%edx
+ 78c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 78f:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 791:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 794:	8b 40 04             	mov    0x4(%eax),%eax
+ 797:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 79e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a1:	01 d0                	add    %edx,%eax
+ 7a3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7a6:	75 20                	jne    7c8 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ab:	8b 50 04             	mov    0x4(%eax),%edx
+ 7ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7b1:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b4:	01 c2                	add    %eax,%edx
+ 7b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b9:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7bf:	8b 10                	mov    (%eax),%edx
+ 7c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c4:	89 10                	mov    %edx,(%eax)
+ 7c6:	eb 08                	jmp    7d0 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cb:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7ce:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d3:	a3 50 0d 00 00       	mov    %eax,0xd50
+}
+ 7d8:	90                   	nop
+ 7d9:	c9                   	leave
+ 7da:	c3                   	ret
+
+000007db <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7db:	55                   	push   %ebp
+ 7dc:	89 e5                	mov    %esp,%ebp
+ 7de:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7e1:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7e8:	77 07                	ja     7f1 <morecore+0x16>
+    nu = 4096;
+ 7ea:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7f4:	c1 e0 03             	shl    $0x3,%eax
+ 7f7:	83 ec 0c             	sub    $0xc,%esp
+ 7fa:	50                   	push   %eax
+ 7fb:	e8 43 fc ff ff       	call   443 <sbrk>
+ 800:	83 c4 10             	add    $0x10,%esp
+ 803:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 806:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 80a:	75 07                	jne    813 <morecore+0x38>
+    return 0;
+ 80c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 811:	eb 26                	jmp    839 <morecore+0x5e>
+  hp = (Header*)p;
+ 813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 816:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 819:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 81c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 81f:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 822:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 825:	83 c0 08             	add    $0x8,%eax
+ 828:	83 ec 0c             	sub    $0xc,%esp
+ 82b:	50                   	push   %eax
+ 82c:	e8 c8 fe ff ff       	call   6f9 <free>
+ 831:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 834:	a1 50 0d 00 00       	mov    0xd50,%eax
+}
+ 839:	c9                   	leave
+ 83a:	c3                   	ret
+
+0000083b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 83b:	55                   	push   %ebp
+ 83c:	89 e5                	mov    %esp,%ebp
+ 83e:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 841:	8b 45 08             	mov    0x8(%ebp),%eax
+ 844:	83 c0 07             	add    $0x7,%eax
+ 847:	c1 e8 03             	shr    $0x3,%eax
+ 84a:	83 c0 01             	add    $0x1,%eax
+ 84d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 850:	a1 50 0d 00 00       	mov    0xd50,%eax
+ 855:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 858:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 85c:	75 23                	jne    881 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 85e:	c7 45 f0 48 0d 00 00 	movl   $0xd48,-0x10(%ebp)
+ 865:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 868:	a3 50 0d 00 00       	mov    %eax,0xd50
+ 86d:	a1 50 0d 00 00       	mov    0xd50,%eax
+ 872:	a3 48 0d 00 00       	mov    %eax,0xd48
+    base.s.size = 0;
+ 877:	c7 05 4c 0d 00 00 00 	movl   $0x0,0xd4c
+ 87e:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 881:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 884:	8b 00                	mov    (%eax),%eax
+ 886:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 889:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88c:	8b 40 04             	mov    0x4(%eax),%eax
+ 88f:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 892:	72 4d                	jb     8e1 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 894:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 897:	8b 40 04             	mov    0x4(%eax),%eax
+ 89a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 89d:	75 0c                	jne    8ab <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 89f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a2:	8b 10                	mov    (%eax),%edx
+ 8a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a7:	89 10                	mov    %edx,(%eax)
+ 8a9:	eb 26                	jmp    8d1 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ae:	8b 40 04             	mov    0x4(%eax),%eax
+ 8b1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8b4:	89 c2                	mov    %eax,%edx
+ 8b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b9:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bf:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c2:	c1 e0 03             	shl    $0x3,%eax
+ 8c5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cb:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8ce:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8d1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d4:	a3 50 0d 00 00       	mov    %eax,0xd50
+      return (void*)(p + 1);
+ 8d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8dc:	83 c0 08             	add    $0x8,%eax
+ 8df:	eb 3b                	jmp    91c <malloc+0xe1>
+    }
+    if(p == freep)
+ 8e1:	a1 50 0d 00 00       	mov    0xd50,%eax
+ 8e6:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8e9:	75 1e                	jne    909 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8eb:	83 ec 0c             	sub    $0xc,%esp
+ 8ee:	ff 75 ec             	push   -0x14(%ebp)
+ 8f1:	e8 e5 fe ff ff       	call   7db <morecore>
+ 8f6:	83 c4 10             	add    $0x10,%esp
+ 8f9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8fc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 900:	75 07                	jne    909 <malloc+0xce>
+        return 0;
+ 902:	b8 00 00 00 00       	mov    $0x0,%eax
+ 907:	eb 13                	jmp    91c <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 90c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 90f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 912:	8b 00                	mov    (%eax),%eax
+ 914:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 917:	e9 6d ff ff ff       	jmp    889 <malloc+0x4e>
+  }
+}
+ 91c:	c9                   	leave
+ 91d:	c3                   	ret
+
+0000091e <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 91e:	55                   	push   %ebp
+ 91f:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 921:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 924:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 927:	7e 08                	jle    931 <ticks+0x13>
+ 929:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 92c:	2b 45 08             	sub    0x8(%ebp),%eax
+ 92f:	eb 05                	jmp    936 <ticks+0x18>
+ 931:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 936:	5d                   	pop    %ebp
+ 937:	c3                   	ret
+
+00000938 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 938:	55                   	push   %ebp
+ 939:	89 e5                	mov    %esp,%ebp
+ 93b:	53                   	push   %ebx
+ 93c:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 93f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 942:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 945:	ff 75 14             	push   0x14(%ebp)
+ 948:	ff 75 10             	push   0x10(%ebp)
+ 94b:	e8 ce ff ff ff       	call   91e <ticks>
+ 950:	83 c4 08             	add    $0x8,%esp
+ 953:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 955:	89 d8                	mov    %ebx,%eax
+ 957:	99                   	cltd
+ 958:	f7 f9                	idiv   %ecx
+ 95a:	89 c2                	mov    %eax,%edx
+ 95c:	8b 45 14             	mov    0x14(%ebp),%eax
+ 95f:	2b 45 10             	sub    0x10(%ebp),%eax
+ 962:	83 ec 04             	sub    $0x4,%esp
+ 965:	ff 75 0c             	push   0xc(%ebp)
+ 968:	52                   	push   %edx
+ 969:	50                   	push   %eax
+ 96a:	ff 75 0c             	push   0xc(%ebp)
+ 96d:	ff 75 08             	push   0x8(%ebp)
+ 970:	68 30 0a 00 00       	push   $0xa30
+ 975:	6a 01                	push   $0x1
+ 977:	e8 eb fb ff ff       	call   567 <printf>
+ 97c:	83 c4 20             	add    $0x20,%esp
+}
+ 97f:	90                   	nop
+ 980:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 983:	c9                   	leave
+ 984:	c3                   	ret
+
+00000985 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 985:	55                   	push   %ebp
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 98b:	ff 75 14             	push   0x14(%ebp)
+ 98e:	ff 75 10             	push   0x10(%ebp)
+ 991:	e8 88 ff ff ff       	call   91e <ticks>
+ 996:	83 c4 08             	add    $0x8,%esp
+ 999:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 99f:	99                   	cltd
+ 9a0:	f7 7d 08             	idivl  0x8(%ebp)
+ 9a3:	89 c2                	mov    %eax,%edx
+ 9a5:	8b 45 14             	mov    0x14(%ebp),%eax
+ 9a8:	2b 45 10             	sub    0x10(%ebp),%eax
+ 9ab:	83 ec 08             	sub    $0x8,%esp
+ 9ae:	52                   	push   %edx
+ 9af:	50                   	push   %eax
+ 9b0:	ff 75 0c             	push   0xc(%ebp)
+ 9b3:	ff 75 08             	push   0x8(%ebp)
+ 9b6:	68 50 0a 00 00       	push   $0xa50
+ 9bb:	6a 01                	push   $0x1
+ 9bd:	e8 a5 fb ff ff       	call   567 <printf>
+ 9c2:	83 c4 20             	add    $0x20,%esp
+}
+ 9c5:	90                   	nop
+ 9c6:	c9                   	leave
+ 9c7:	c3                   	ret
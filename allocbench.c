@@ -0,0 +1,66 @@
+// Page allocator stress benchmark.
+//
+// Runs NWORKER processes in parallel, each repeatedly growing
+// its heap with sbrk, touching every new page, shrinking it
+// again and forking a child that exits at once.  Reports the
+// pages allocated and freed per second across all workers.
+// With CPUS=8 every worker has a CPU of its own, so the rate
+// shows how much the workers contend in kalloc and kfree.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NWORKER 8
+#define NROUND 200
+#define NPAGE 64
+#define PGSIZE 4096
+
+void
+worker(void)
+{
+  int i, j, pid;
+  char *p;
+
+  for(i = 0; i < NROUND; i++){
+    p = sbrk(NPAGE * PGSIZE);
+    if(p == (char*)-1){
+      printf(1, "allocbench: sbrk failed\n");
+      exit();
+    }
+    for(j = 0; j < NPAGE; j++)
+      p[j * PGSIZE] = j;
+    sbrk(-NPAGE * PGSIZE);
+
+    if((pid = fork()) < 0){
+      printf(1, "allocbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, t0, t1, npage;
+
+  printf(1, "allocbench starting\n");
+  t0 = uptime();
+  for(i = 0; i < NWORKER; i++){
+    if(fork() == 0)
+      worker();
+  }
+  for(i = 0; i < NWORKER; i++)
+    wait();
+  t1 = uptime();
+
+  // Heap pages only; fork's page tables and copies come on top.
+  npage = NWORKER * NROUND * NPAGE;
+  printf(1, "%d workers: ", NWORKER);
+  benchrate(npage, "heap pages", t0, t1);
+  exit();
+}
@@ -0,0 +1,10 @@
+// Buffer cache statistics, returned by getbcachestat().
+struct bcachestat {
+  uint nhit;      // Lookups that found the block cached
+  uint nmiss;     // Lookups that had to read the block
+  uint nevict;    // Cached blocks recycled for another block
+  uint nshrink;   // Buffers freed because memory ran out
+  uint nahead;    // Blocks read ahead
+  uint nbuf;      // Buffers in the cache now
+  uint maxbuf;    // Buffers the cache may grow to
+};
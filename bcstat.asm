@@ -0,0 +1,1396 @@
+
+_bcstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "diskstat.h"
+#include "logstat.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 5c             	sub    $0x5c,%esp
+  struct bcachestat st;
+  struct diskstat ds;
+  struct logstat ls;
+
+  if(getbcachestat(&st) < 0){
+  13:	83 ec 0c             	sub    $0xc,%esp
+  16:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  19:	50                   	push   %eax
+  1a:	e8 88 04 00 00       	call   4a7 <getbcachestat>
+  1f:	83 c4 10             	add    $0x10,%esp
+  22:	85 c0                	test   %eax,%eax
+  24:	79 17                	jns    3d <main+0x3d>
+    printf(2, "bcstat: getbcachestat failed\n");
+  26:	83 ec 08             	sub    $0x8,%esp
+  29:	68 f4 09 00 00       	push   $0x9f4
+  2e:	6a 02                	push   $0x2
+  30:	e8 5e 05 00 00       	call   593 <printf>
+  35:	83 c4 10             	add    $0x10,%esp
+    exit();
+  38:	e8 aa 03 00 00       	call   3e7 <exit>
+  }
+  printf(1, "hits %d misses %d read-ahead %d evictions %d shrunk %d\n",
+  3d:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  40:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  43:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  46:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  49:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	56                   	push   %esi
+  50:	53                   	push   %ebx
+  51:	51                   	push   %ecx
+  52:	52                   	push   %edx
+  53:	50                   	push   %eax
+  54:	68 14 0a 00 00       	push   $0xa14
+  59:	6a 01                	push   $0x1
+  5b:	e8 33 05 00 00       	call   593 <printf>
+  60:	83 c4 20             	add    $0x20,%esp
+         st.nhit, st.nmiss, st.nahead, st.nevict, st.nshrink);
+  printf(1, "buffers %d of at most %d\n", st.nbuf, st.maxbuf);
+  63:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  66:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  69:	52                   	push   %edx
+  6a:	50                   	push   %eax
+  6b:	68 4c 0a 00 00       	push   $0xa4c
+  70:	6a 01                	push   $0x1
+  72:	e8 1c 05 00 00       	call   593 <printf>
+  77:	83 c4 10             	add    $0x10,%esp
+  if(getdiskstat(&ds) < 0){
+  7a:	83 ec 0c             	sub    $0xc,%esp
+  7d:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+  80:	50                   	push   %eax
+  81:	e8 29 04 00 00       	call   4af <getdiskstat>
+  86:	83 c4 10             	add    $0x10,%esp
+  89:	85 c0                	test   %eax,%eax
+  8b:	79 17                	jns    a4 <main+0xa4>
+    printf(2, "bcstat: getdiskstat failed\n");
+  8d:	83 ec 08             	sub    $0x8,%esp
+  90:	68 66 0a 00 00       	push   $0xa66
+  95:	6a 02                	push   $0x2
+  97:	e8 f7 04 00 00       	call   593 <printf>
+  9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  9f:	e8 43 03 00 00       	call   3e7 <exit>
+  }
+  printf(1, "disk commands %d blocks %d (%s)\n", ds.ncmd, ds.nblock,
+         ds.dma ? "DMA" : "PIO");
+  a4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  printf(1, "disk commands %d blocks %d (%s)\n", ds.ncmd, ds.nblock,
+  a7:	85 c0                	test   %eax,%eax
+  a9:	74 07                	je     b2 <main+0xb2>
+  ab:	b9 82 0a 00 00       	mov    $0xa82,%ecx
+  b0:	eb 05                	jmp    b7 <main+0xb7>
+  b2:	b9 86 0a 00 00       	mov    $0xa86,%ecx
+  b7:	8b 55 b8             	mov    -0x48(%ebp),%edx
+  ba:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  bd:	83 ec 0c             	sub    $0xc,%esp
+  c0:	51                   	push   %ecx
+  c1:	52                   	push   %edx
+  c2:	50                   	push   %eax
+  c3:	68 8c 0a 00 00       	push   $0xa8c
+  c8:	6a 01                	push   $0x1
+  ca:	e8 c4 04 00 00       	call   593 <printf>
+  cf:	83 c4 20             	add    $0x20,%esp
+  printf(1, "disk interrupt handler %d kcycles, %d per block\n",
+         ds.intrkcycles, ds.nblock ? ds.intrkcycles / ds.nblock : 0);
+  d2:	8b 45 b8             	mov    -0x48(%ebp),%eax
+  printf(1, "disk interrupt handler %d kcycles, %d per block\n",
+  d5:	85 c0                	test   %eax,%eax
+  d7:	74 11                	je     ea <main+0xea>
+         ds.intrkcycles, ds.nblock ? ds.intrkcycles / ds.nblock : 0);
+  d9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  dc:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  printf(1, "disk interrupt handler %d kcycles, %d per block\n",
+  df:	ba 00 00 00 00       	mov    $0x0,%edx
+  e4:	f7 f3                	div    %ebx
+  e6:	89 c2                	mov    %eax,%edx
+  e8:	eb 05                	jmp    ef <main+0xef>
+  ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  ef:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  f2:	52                   	push   %edx
+  f3:	50                   	push   %eax
+  f4:	68 b0 0a 00 00       	push   $0xab0
+  f9:	6a 01                	push   $0x1
+  fb:	e8 93 04 00 00       	call   593 <printf>
+ 100:	83 c4 10             	add    $0x10,%esp
+  if(getlogstat(&ls) < 0){
+ 103:	83 ec 0c             	sub    $0xc,%esp
+ 106:	8d 45 9c             	lea    -0x64(%ebp),%eax
+ 109:	50                   	push   %eax
+ 10a:	e8 a8 03 00 00       	call   4b7 <getlogstat>
+ 10f:	83 c4 10             	add    $0x10,%esp
+ 112:	85 c0                	test   %eax,%eax
+ 114:	79 17                	jns    12d <main+0x12d>
+    printf(2, "bcstat: getlogstat failed\n");
+ 116:	83 ec 08             	sub    $0x8,%esp
+ 119:	68 e1 0a 00 00       	push   $0xae1
+ 11e:	6a 02                	push   $0x2
+ 120:	e8 6e 04 00 00       	call   593 <printf>
+ 125:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 128:	e8 ba 02 00 00       	call   3e7 <exit>
+  }
+  printf(1, "log commits %d (%d early) ops %d blocks %d, %d ops per commit\n",
+         ls.ncommit, ls.nfull, ls.nop, ls.nblock,
+         ls.ncommit ? ls.nop / ls.ncommit : 0);
+ 12d:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  printf(1, "log commits %d (%d early) ops %d blocks %d, %d ops per commit\n",
+ 130:	85 c0                	test   %eax,%eax
+ 132:	74 11                	je     145 <main+0x145>
+         ls.ncommit ? ls.nop / ls.ncommit : 0);
+ 134:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 137:	8b 75 9c             	mov    -0x64(%ebp),%esi
+  printf(1, "log commits %d (%d early) ops %d blocks %d, %d ops per commit\n",
+ 13a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 13f:	f7 f6                	div    %esi
+ 141:	89 c6                	mov    %eax,%esi
+ 143:	eb 05                	jmp    14a <main+0x14a>
+ 145:	be 00 00 00 00       	mov    $0x0,%esi
+ 14a:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+ 14d:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+ 150:	8b 55 a8             	mov    -0x58(%ebp),%edx
+ 153:	8b 45 9c             	mov    -0x64(%ebp),%eax
+ 156:	83 ec 04             	sub    $0x4,%esp
+ 159:	56                   	push   %esi
+ 15a:	53                   	push   %ebx
+ 15b:	51                   	push   %ecx
+ 15c:	52                   	push   %edx
+ 15d:	50                   	push   %eax
+ 15e:	68 fc 0a 00 00       	push   $0xafc
+ 163:	6a 01                	push   $0x1
+ 165:	e8 29 04 00 00       	call   593 <printf>
+ 16a:	83 c4 20             	add    $0x20,%esp
+  printf(1, "log checkpoints %d installed %d of %d logged blocks\n",
+ 16d:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+ 170:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 173:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	51                   	push   %ecx
+ 17a:	52                   	push   %edx
+ 17b:	50                   	push   %eax
+ 17c:	68 3c 0b 00 00       	push   $0xb3c
+ 181:	6a 01                	push   $0x1
+ 183:	e8 0b 04 00 00       	call   593 <printf>
+ 188:	83 c4 20             	add    $0x20,%esp
+         ls.nckpt, ls.ninstall, ls.nblock);
+  exit();
+ 18b:	e8 57 02 00 00       	call   3e7 <exit>
+
+00000190 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 195:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 198:	8b 55 10             	mov    0x10(%ebp),%edx
+ 19b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19e:	89 cb                	mov    %ecx,%ebx
+ 1a0:	89 df                	mov    %ebx,%edi
+ 1a2:	89 d1                	mov    %edx,%ecx
+ 1a4:	fc                   	cld
+ 1a5:	f3 aa                	rep stos %al,%es:(%edi)
+ 1a7:	89 ca                	mov    %ecx,%edx
+ 1a9:	89 fb                	mov    %edi,%ebx
+ 1ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 1b1:	90                   	nop
+ 1b2:	5b                   	pop    %ebx
+ 1b3:	5f                   	pop    %edi
+ 1b4:	5d                   	pop    %ebp
+ 1b5:	c3                   	ret
+
+000001b6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1b6:	55                   	push   %ebp
+ 1b7:	89 e5                	mov    %esp,%ebp
+ 1b9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 1bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1c2:	90                   	nop
+ 1c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1c6:	8d 42 01             	lea    0x1(%edx),%eax
+ 1c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cf:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1d5:	0f b6 12             	movzbl (%edx),%edx
+ 1d8:	88 10                	mov    %dl,(%eax)
+ 1da:	0f b6 00             	movzbl (%eax),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 e2                	jne    1c3 <strcpy+0xd>
+    ;
+  return os;
+ 1e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+
+000001e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e6:	55                   	push   %ebp
+ 1e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1e9:	eb 08                	jmp    1f3 <strcmp+0xd>
+    p++, q++;
+ 1eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 00             	movzbl (%eax),%eax
+ 1f9:	84 c0                	test   %al,%al
+ 1fb:	74 10                	je     20d <strcmp+0x27>
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	0f b6 10             	movzbl (%eax),%edx
+ 203:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 206:	0f b6 00             	movzbl (%eax),%eax
+ 209:	38 c2                	cmp    %al,%dl
+ 20b:	74 de                	je     1eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 20d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 210:	0f b6 00             	movzbl (%eax),%eax
+ 213:	0f b6 d0             	movzbl %al,%edx
+ 216:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 219:	0f b6 00             	movzbl (%eax),%eax
+ 21c:	0f b6 c0             	movzbl %al,%eax
+ 21f:	29 c2                	sub    %eax,%edx
+ 221:	89 d0                	mov    %edx,%eax
+}
+ 223:	5d                   	pop    %ebp
+ 224:	c3                   	ret
+
+00000225 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 225:	55                   	push   %ebp
+ 226:	89 e5                	mov    %esp,%ebp
+ 228:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 22b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 232:	eb 04                	jmp    238 <strlen+0x13>
+ 234:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 238:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23e:	01 d0                	add    %edx,%eax
+ 240:	0f b6 00             	movzbl (%eax),%eax
+ 243:	84 c0                	test   %al,%al
+ 245:	75 ed                	jne    234 <strlen+0xf>
+    ;
+  return n;
+ 247:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 24a:	c9                   	leave
+ 24b:	c3                   	ret
+
+0000024c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 24c:	55                   	push   %ebp
+ 24d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 24f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 252:	50                   	push   %eax
+ 253:	ff 75 0c             	push   0xc(%ebp)
+ 256:	ff 75 08             	push   0x8(%ebp)
+ 259:	e8 32 ff ff ff       	call   190 <stosb>
+ 25e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 261:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 264:	c9                   	leave
+ 265:	c3                   	ret
+
+00000266 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 266:	55                   	push   %ebp
+ 267:	89 e5                	mov    %esp,%ebp
+ 269:	83 ec 04             	sub    $0x4,%esp
+ 26c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 272:	eb 14                	jmp    288 <strchr+0x22>
+    if(*s == c)
+ 274:	8b 45 08             	mov    0x8(%ebp),%eax
+ 277:	0f b6 00             	movzbl (%eax),%eax
+ 27a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 27d:	75 05                	jne    284 <strchr+0x1e>
+      return (char*)s;
+ 27f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 282:	eb 13                	jmp    297 <strchr+0x31>
+  for(; *s; s++)
+ 284:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 288:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	75 e2                	jne    274 <strchr+0xe>
+  return 0;
+ 292:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+
+00000299 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 299:	55                   	push   %ebp
+ 29a:	89 e5                	mov    %esp,%ebp
+ 29c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 29f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2a6:	eb 42                	jmp    2ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 2a8:	83 ec 04             	sub    $0x4,%esp
+ 2ab:	6a 01                	push   $0x1
+ 2ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2b0:	50                   	push   %eax
+ 2b1:	6a 00                	push   $0x0
+ 2b3:	e8 47 01 00 00       	call   3ff <read>
+ 2b8:	83 c4 10             	add    $0x10,%esp
+ 2bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2c2:	7e 33                	jle    2f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2cd:	89 c2                	mov    %eax,%edx
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	01 c2                	add    %eax,%edx
+ 2d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2de:	3c 0a                	cmp    $0xa,%al
+ 2e0:	74 16                	je     2f8 <gets+0x5f>
+ 2e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e6:	3c 0d                	cmp    $0xd,%al
+ 2e8:	74 0e                	je     2f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ed:	83 c0 01             	add    $0x1,%eax
+ 2f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2f3:	7f b3                	jg     2a8 <gets+0xf>
+ 2f5:	eb 01                	jmp    2f8 <gets+0x5f>
+      break;
+ 2f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fe:	01 d0                	add    %edx,%eax
+ 300:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 306:	c9                   	leave
+ 307:	c3                   	ret
+
+00000308 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 308:	55                   	push   %ebp
+ 309:	89 e5                	mov    %esp,%ebp
+ 30b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 30e:	83 ec 08             	sub    $0x8,%esp
+ 311:	6a 00                	push   $0x0
+ 313:	ff 75 08             	push   0x8(%ebp)
+ 316:	e8 0c 01 00 00       	call   427 <open>
+ 31b:	83 c4 10             	add    $0x10,%esp
+ 31e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 321:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 325:	79 07                	jns    32e <stat+0x26>
+    return -1;
+ 327:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 32c:	eb 25                	jmp    353 <stat+0x4b>
+  r = fstat(fd, st);
+ 32e:	83 ec 08             	sub    $0x8,%esp
+ 331:	ff 75 0c             	push   0xc(%ebp)
+ 334:	ff 75 f4             	push   -0xc(%ebp)
+ 337:	e8 03 01 00 00       	call   43f <fstat>
+ 33c:	83 c4 10             	add    $0x10,%esp
+ 33f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 342:	83 ec 0c             	sub    $0xc,%esp
+ 345:	ff 75 f4             	push   -0xc(%ebp)
+ 348:	e8 c2 00 00 00       	call   40f <close>
+ 34d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 350:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 353:	c9                   	leave
+ 354:	c3                   	ret
+
+00000355 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 355:	55                   	push   %ebp
+ 356:	89 e5                	mov    %esp,%ebp
+ 358:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 35b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 362:	eb 25                	jmp    389 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 364:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 367:	89 d0                	mov    %edx,%eax
+ 369:	c1 e0 02             	shl    $0x2,%eax
+ 36c:	01 d0                	add    %edx,%eax
+ 36e:	01 c0                	add    %eax,%eax
+ 370:	89 c1                	mov    %eax,%ecx
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+ 375:	8d 50 01             	lea    0x1(%eax),%edx
+ 378:	89 55 08             	mov    %edx,0x8(%ebp)
+ 37b:	0f b6 00             	movzbl (%eax),%eax
+ 37e:	0f be c0             	movsbl %al,%eax
+ 381:	01 c8                	add    %ecx,%eax
+ 383:	83 e8 30             	sub    $0x30,%eax
+ 386:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 389:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38c:	0f b6 00             	movzbl (%eax),%eax
+ 38f:	3c 2f                	cmp    $0x2f,%al
+ 391:	7e 0a                	jle    39d <atoi+0x48>
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	0f b6 00             	movzbl (%eax),%eax
+ 399:	3c 39                	cmp    $0x39,%al
+ 39b:	7e c7                	jle    364 <atoi+0xf>
+  return n;
+ 39d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3a0:	c9                   	leave
+ 3a1:	c3                   	ret
+
+000003a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3a2:	55                   	push   %ebp
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3b4:	eb 17                	jmp    3cd <memmove+0x2b>
+    *dst++ = *src++;
+ 3b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 3bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3c8:	0f b6 12             	movzbl (%edx),%edx
+ 3cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3d6:	85 c0                	test   %eax,%eax
+ 3d8:	7f dc                	jg     3b6 <memmove+0x14>
+  return vdst;
+ 3da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3dd:	c9                   	leave
+ 3de:	c3                   	ret
+
+000003df <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3df:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <exit>:
+SYSCALL(exit)
+ 3e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <wait>:
+SYSCALL(wait)
+ 3ef:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <pipe>:
+SYSCALL(pipe)
+ 3f7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <read>:
+SYSCALL(read)
+ 3ff:	b8 05 00 00 00       	mov    $0x5,%eax
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <write>:
+SYSCALL(write)
+ 407:	b8 10 00 00 00       	mov    $0x10,%eax
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <close>:
+SYSCALL(close)
+ 40f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <kill>:
+SYSCALL(kill)
+ 417:	b8 06 00 00 00       	mov    $0x6,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <exec>:
+SYSCALL(exec)
+ 41f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <open>:
+SYSCALL(open)
+ 427:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <mknod>:
+SYSCALL(mknod)
+ 42f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 434:	cd 40                	int    $0x40
+ 436:	c3                   	ret
+
+00000437 <unlink>:
+SYSCALL(unlink)
+ 437:	b8 12 00 00 00       	mov    $0x12,%eax
+ 43c:	cd 40                	int    $0x40
+ 43e:	c3                   	ret
+
+0000043f <fstat>:
+SYSCALL(fstat)
+ 43f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 444:	cd 40                	int    $0x40
+ 446:	c3                   	ret
+
+00000447 <link>:
+SYSCALL(link)
+ 447:	b8 13 00 00 00       	mov    $0x13,%eax
+ 44c:	cd 40                	int    $0x40
+ 44e:	c3                   	ret
+
+0000044f <mkdir>:
+SYSCALL(mkdir)
+ 44f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <chdir>:
+SYSCALL(chdir)
+ 457:	b8 09 00 00 00       	mov    $0x9,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <dup>:
+SYSCALL(dup)
+ 45f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <getpid>:
+SYSCALL(getpid)
+ 467:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <sbrk>:
+SYSCALL(sbrk)
+ 46f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <sleep>:
+SYSCALL(sleep)
+ 477:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <uptime>:
+SYSCALL(uptime)
+ 47f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 487:	b8 16 00 00 00       	mov    $0x16,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <getschedstat>:
+SYSCALL(getschedstat)
+ 48f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 497:	b8 18 00 00 00       	mov    $0x18,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <setshare>:
+SYSCALL(setshare)
+ 49f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 4a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <getdiskstat>:
+SYSCALL(getdiskstat)
+ 4af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <getlogstat>:
+SYSCALL(getlogstat)
+ 4b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4bf:	55                   	push   %ebp
+ 4c0:	89 e5                	mov    %esp,%ebp
+ 4c2:	83 ec 18             	sub    $0x18,%esp
+ 4c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4cb:	83 ec 04             	sub    $0x4,%esp
+ 4ce:	6a 01                	push   $0x1
+ 4d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4d3:	50                   	push   %eax
+ 4d4:	ff 75 08             	push   0x8(%ebp)
+ 4d7:	e8 2b ff ff ff       	call   407 <write>
+ 4dc:	83 c4 10             	add    $0x10,%esp
+}
+ 4df:	90                   	nop
+ 4e0:	c9                   	leave
+ 4e1:	c3                   	ret
+
+000004e2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e2:	55                   	push   %ebp
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4ef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4f3:	74 17                	je     50c <printint+0x2a>
+ 4f5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4f9:	79 11                	jns    50c <printint+0x2a>
+    neg = 1;
+ 4fb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 502:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 505:	f7 d8                	neg    %eax
+ 507:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 50a:	eb 06                	jmp    512 <printint+0x30>
+  } else {
+    x = xx;
+ 50c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 512:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 519:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 51c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 51f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 524:	f7 f1                	div    %ecx
+ 526:	89 d1                	mov    %edx,%ecx
+ 528:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52b:	8d 50 01             	lea    0x1(%eax),%edx
+ 52e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 531:	0f b6 91 68 0e 00 00 	movzbl 0xe68(%ecx),%edx
+ 538:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 53c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 53f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 542:	ba 00 00 00 00       	mov    $0x0,%edx
+ 547:	f7 f1                	div    %ecx
+ 549:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 54c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 550:	75 c7                	jne    519 <printint+0x37>
+  if(neg)
+ 552:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 556:	74 2d                	je     585 <printint+0xa3>
+    buf[i++] = '-';
+ 558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 55b:	8d 50 01             	lea    0x1(%eax),%edx
+ 55e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 561:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 566:	eb 1d                	jmp    585 <printint+0xa3>
+    putc(fd, buf[i]);
+ 568:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 56b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 56e:	01 d0                	add    %edx,%eax
+ 570:	0f b6 00             	movzbl (%eax),%eax
+ 573:	0f be c0             	movsbl %al,%eax
+ 576:	83 ec 08             	sub    $0x8,%esp
+ 579:	50                   	push   %eax
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 3d ff ff ff       	call   4bf <putc>
+ 582:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 585:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 589:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 58d:	79 d9                	jns    568 <printint+0x86>
+}
+ 58f:	90                   	nop
+ 590:	90                   	nop
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 599:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5a0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5a3:	83 c0 04             	add    $0x4,%eax
+ 5a6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5b0:	e9 59 01 00 00       	jmp    70e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5bb:	01 d0                	add    %edx,%eax
+ 5bd:	0f b6 00             	movzbl (%eax),%eax
+ 5c0:	0f be c0             	movsbl %al,%eax
+ 5c3:	25 ff 00 00 00       	and    $0xff,%eax
+ 5c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5cf:	75 2c                	jne    5fd <printf+0x6a>
+      if(c == '%'){
+ 5d1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5d5:	75 0c                	jne    5e3 <printf+0x50>
+        state = '%';
+ 5d7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5de:	e9 27 01 00 00       	jmp    70a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5e6:	0f be c0             	movsbl %al,%eax
+ 5e9:	83 ec 08             	sub    $0x8,%esp
+ 5ec:	50                   	push   %eax
+ 5ed:	ff 75 08             	push   0x8(%ebp)
+ 5f0:	e8 ca fe ff ff       	call   4bf <putc>
+ 5f5:	83 c4 10             	add    $0x10,%esp
+ 5f8:	e9 0d 01 00 00       	jmp    70a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5fd:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 601:	0f 85 03 01 00 00    	jne    70a <printf+0x177>
+      if(c == 'd'){
+ 607:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 60b:	75 1e                	jne    62b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 60d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 610:	8b 00                	mov    (%eax),%eax
+ 612:	6a 01                	push   $0x1
+ 614:	6a 0a                	push   $0xa
+ 616:	50                   	push   %eax
+ 617:	ff 75 08             	push   0x8(%ebp)
+ 61a:	e8 c3 fe ff ff       	call   4e2 <printint>
+ 61f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 622:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 626:	e9 d8 00 00 00       	jmp    703 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 62b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 62f:	74 06                	je     637 <printf+0xa4>
+ 631:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 635:	75 1e                	jne    655 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 637:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 63a:	8b 00                	mov    (%eax),%eax
+ 63c:	6a 00                	push   $0x0
+ 63e:	6a 10                	push   $0x10
+ 640:	50                   	push   %eax
+ 641:	ff 75 08             	push   0x8(%ebp)
+ 644:	e8 99 fe ff ff       	call   4e2 <printint>
+ 649:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 64c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 650:	e9 ae 00 00 00       	jmp    703 <printf+0x170>
+      } else if(c == 's'){
+ 655:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 659:	75 43                	jne    69e <printf+0x10b>
+        s = (char*)*ap;
+ 65b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65e:	8b 00                	mov    (%eax),%eax
+ 660:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 663:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 667:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 66b:	75 25                	jne    692 <printf+0xff>
+          s = "(null)";
+ 66d:	c7 45 f4 71 0b 00 00 	movl   $0xb71,-0xc(%ebp)
+        while(*s != 0){
+ 674:	eb 1c                	jmp    692 <printf+0xff>
+          putc(fd, *s);
+ 676:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 679:	0f b6 00             	movzbl (%eax),%eax
+ 67c:	0f be c0             	movsbl %al,%eax
+ 67f:	83 ec 08             	sub    $0x8,%esp
+ 682:	50                   	push   %eax
+ 683:	ff 75 08             	push   0x8(%ebp)
+ 686:	e8 34 fe ff ff       	call   4bf <putc>
+ 68b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 68e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 692:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 695:	0f b6 00             	movzbl (%eax),%eax
+ 698:	84 c0                	test   %al,%al
+ 69a:	75 da                	jne    676 <printf+0xe3>
+ 69c:	eb 65                	jmp    703 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 69e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6a2:	75 1d                	jne    6c1 <printf+0x12e>
+        putc(fd, *ap);
+ 6a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a7:	8b 00                	mov    (%eax),%eax
+ 6a9:	0f be c0             	movsbl %al,%eax
+ 6ac:	83 ec 08             	sub    $0x8,%esp
+ 6af:	50                   	push   %eax
+ 6b0:	ff 75 08             	push   0x8(%ebp)
+ 6b3:	e8 07 fe ff ff       	call   4bf <putc>
+ 6b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6bf:	eb 42                	jmp    703 <printf+0x170>
+      } else if(c == '%'){
+ 6c1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6c5:	75 17                	jne    6de <printf+0x14b>
+        putc(fd, c);
+ 6c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6ca:	0f be c0             	movsbl %al,%eax
+ 6cd:	83 ec 08             	sub    $0x8,%esp
+ 6d0:	50                   	push   %eax
+ 6d1:	ff 75 08             	push   0x8(%ebp)
+ 6d4:	e8 e6 fd ff ff       	call   4bf <putc>
+ 6d9:	83 c4 10             	add    $0x10,%esp
+ 6dc:	eb 25                	jmp    703 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6de:	83 ec 08             	sub    $0x8,%esp
+ 6e1:	6a 25                	push   $0x25
+ 6e3:	ff 75 08             	push   0x8(%ebp)
+ 6e6:	e8 d4 fd ff ff       	call   4bf <putc>
+ 6eb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6f1:	0f be c0             	movsbl %al,%eax
+ 6f4:	83 ec 08             	sub    $0x8,%esp
+ 6f7:	50                   	push   %eax
+ 6f8:	ff 75 08             	push   0x8(%ebp)
+ 6fb:	e8 bf fd ff ff       	call   4bf <putc>
+ 700:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 703:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 70a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 70e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 711:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 714:	01 d0                	add    %edx,%eax
+ 716:	0f b6 00             	movzbl (%eax),%eax
+ 719:	84 c0                	test   %al,%al
+ 71b:	0f 85 94 fe ff ff    	jne    5b5 <printf+0x22>
+    }
+  }
+}
+ 721:	90                   	nop
+ 722:	90                   	nop
+ 723:	c9                   	leave
+ 724:	c3                   	ret
+
+00000725 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 725:	55                   	push   %ebp
+ 726:	89 e5                	mov    %esp,%ebp
+ 728:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 72b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72e:	83 e8 08             	sub    $0x8,%eax
+ 731:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 734:	a1 84 0e 00 00       	mov    0xe84,%eax
+ 739:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 73c:	eb 24                	jmp    762 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 73e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 741:	8b 00                	mov    (%eax),%eax
+ 743:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 746:	72 12                	jb     75a <free+0x35>
+ 748:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 74e:	72 24                	jb     774 <free+0x4f>
+ 750:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 753:	8b 00                	mov    (%eax),%eax
+ 755:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 758:	72 1a                	jb     774 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 75a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75d:	8b 00                	mov    (%eax),%eax
+ 75f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 762:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 765:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 768:	73 d4                	jae    73e <free+0x19>
+ 76a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76d:	8b 00                	mov    (%eax),%eax
+ 76f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 772:	73 ca                	jae    73e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 774:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 777:	8b 40 04             	mov    0x4(%eax),%eax
+ 77a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 781:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 784:	01 c2                	add    %eax,%edx
+ 786:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 789:	8b 00                	mov    (%eax),%eax
+ 78b:	39 c2                	cmp    %eax,%edx
+ 78d:	75 24                	jne    7b3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 78f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 792:	8b 50 04             	mov    0x4(%eax),%edx
+ 795:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 798:	8b 00                	mov    (%eax),%eax
+ 79a:	8b 40 04             	mov    0x4(%eax),%eax
+ 79d:	01 c2                	add    %eax,%edx
+ 79f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a8:	8b 00                	mov    (%eax),%eax
+ 7aa:	8b 10                	mov    (%eax),%edx
+ 7ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7af:	89 10                	mov    %edx,(%eax)
+ 7b1:	eb 0a                	jmp    7bd <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b6:	8b 10                	mov    (%eax),%edx
+ 7b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7bb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cd:	01 d0                	add    %edx,%eax
+ 7cf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7d2:	75 20                	jne    7f4 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d7:	8b 50 04             	mov    0x4(%eax),%edx
+ 7da:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7dd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e0:	01 c2                	add    %eax,%edx
+ 7e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7eb:	8b 10                	mov    (%eax),%edx
+ 7ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f0:	89 10                	mov    %edx,(%eax)
+ 7f2:	eb 08                	jmp    7fc <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7fa:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ff:	a3 84 0e 00 00       	mov    %eax,0xe84
+}
+ 804:	90                   	nop
+ 805:	c9                   	leave
+ 806:	c3                   	ret
+
+00000807 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 807:	55                   	push   %ebp
+ 808:	89 e5                	mov    %esp,%ebp
+ 80a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 80d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 814:	77 07                	ja     81d <morecore+0x16>
+    nu = 4096;
+ 816:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 81d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 820:	c1 e0 03             	shl    $0x3,%eax
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	50                   	push   %eax
+ 827:	e8 43 fc ff ff       	call   46f <sbrk>
+ 82c:	83 c4 10             	add    $0x10,%esp
+ 82f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 832:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 836:	75 07                	jne    83f <morecore+0x38>
+    return 0;
+ 838:	b8 00 00 00 00       	mov    $0x0,%eax
+ 83d:	eb 26                	jmp    865 <morecore+0x5e>
+  hp = (Header*)p;
+ 83f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 842:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 845:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 848:	8b 55 08             	mov    0x8(%ebp),%edx
+ 84b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 84e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 851:	83 c0 08             	add    $0x8,%eax
+ 854:	83 ec 0c             	sub    $0xc,%esp
+ 857:	50                   	push   %eax
+ 858:	e8 c8 fe ff ff       	call   725 <free>
+ 85d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 860:	a1 84 0e 00 00       	mov    0xe84,%eax
+}
+ 865:	c9                   	leave
+ 866:	c3                   	ret
+
+00000867 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 867:	55                   	push   %ebp
+ 868:	89 e5                	mov    %esp,%ebp
+ 86a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 86d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 870:	83 c0 07             	add    $0x7,%eax
+ 873:	c1 e8 03             	shr    $0x3,%eax
+ 876:	83 c0 01             	add    $0x1,%eax
+ 879:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 87c:	a1 84 0e 00 00       	mov    0xe84,%eax
+ 881:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 884:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 888:	75 23                	jne    8ad <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 88a:	c7 45 f0 7c 0e 00 00 	movl   $0xe7c,-0x10(%ebp)
+ 891:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 894:	a3 84 0e 00 00       	mov    %eax,0xe84
+ 899:	a1 84 0e 00 00       	mov    0xe84,%eax
+ 89e:	a3 7c 0e 00 00       	mov    %eax,0xe7c
+    base.s.size = 0;
+ 8a3:	c7 05 80 0e 00 00 00 	movl   $0x0,0xe80
+ 8aa:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b0:	8b 00                	mov    (%eax),%eax
+ 8b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b8:	8b 40 04             	mov    0x4(%eax),%eax
+ 8bb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8be:	72 4d                	jb     90d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8c9:	75 0c                	jne    8d7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ce:	8b 10                	mov    (%eax),%edx
+ 8d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d3:	89 10                	mov    %edx,(%eax)
+ 8d5:	eb 26                	jmp    8fd <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8da:	8b 40 04             	mov    0x4(%eax),%eax
+ 8dd:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8e0:	89 c2                	mov    %eax,%edx
+ 8e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8eb:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ee:	c1 e0 03             	shl    $0x3,%eax
+ 8f1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8fa:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 900:	a3 84 0e 00 00       	mov    %eax,0xe84
+      return (void*)(p + 1);
+ 905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 908:	83 c0 08             	add    $0x8,%eax
+ 90b:	eb 3b                	jmp    948 <malloc+0xe1>
+    }
+    if(p == freep)
+ 90d:	a1 84 0e 00 00       	mov    0xe84,%eax
+ 912:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 915:	75 1e                	jne    935 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 917:	83 ec 0c             	sub    $0xc,%esp
+ 91a:	ff 75 ec             	push   -0x14(%ebp)
+ 91d:	e8 e5 fe ff ff       	call   807 <morecore>
+ 922:	83 c4 10             	add    $0x10,%esp
+ 925:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 928:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92c:	75 07                	jne    935 <malloc+0xce>
+        return 0;
+ 92e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 933:	eb 13                	jmp    948 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 935:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 938:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 93b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93e:	8b 00                	mov    (%eax),%eax
+ 940:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 943:	e9 6d ff ff ff       	jmp    8b5 <malloc+0x4e>
+  }
+}
+ 948:	c9                   	leave
+ 949:	c3                   	ret
+
+0000094a <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 94a:	55                   	push   %ebp
+ 94b:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 94d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 950:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 953:	7e 08                	jle    95d <ticks+0x13>
+ 955:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 958:	2b 45 08             	sub    0x8(%ebp),%eax
+ 95b:	eb 05                	jmp    962 <ticks+0x18>
+ 95d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 962:	5d                   	pop    %ebp
+ 963:	c3                   	ret
+
+00000964 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 964:	55                   	push   %ebp
+ 965:	89 e5                	mov    %esp,%ebp
+ 967:	53                   	push   %ebx
+ 968:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 96b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96e:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 971:	ff 75 14             	push   0x14(%ebp)
+ 974:	ff 75 10             	push   0x10(%ebp)
+ 977:	e8 ce ff ff ff       	call   94a <ticks>
+ 97c:	83 c4 08             	add    $0x8,%esp
+ 97f:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 981:	89 d8                	mov    %ebx,%eax
+ 983:	99                   	cltd
+ 984:	f7 f9                	idiv   %ecx
+ 986:	89 c2                	mov    %eax,%edx
+ 988:	8b 45 14             	mov    0x14(%ebp),%eax
+ 98b:	2b 45 10             	sub    0x10(%ebp),%eax
+ 98e:	83 ec 04             	sub    $0x4,%esp
+ 991:	ff 75 0c             	push   0xc(%ebp)
+ 994:	52                   	push   %edx
+ 995:	50                   	push   %eax
+ 996:	ff 75 0c             	push   0xc(%ebp)
+ 999:	ff 75 08             	push   0x8(%ebp)
+ 99c:	68 78 0b 00 00       	push   $0xb78
+ 9a1:	6a 01                	push   $0x1
+ 9a3:	e8 eb fb ff ff       	call   593 <printf>
+ 9a8:	83 c4 20             	add    $0x20,%esp
+}
+ 9ab:	90                   	nop
+ 9ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9af:	c9                   	leave
+ 9b0:	c3                   	ret
+
+000009b1 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 9b1:	55                   	push   %ebp
+ 9b2:	89 e5                	mov    %esp,%ebp
+ 9b4:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 9b7:	ff 75 14             	push   0x14(%ebp)
+ 9ba:	ff 75 10             	push   0x10(%ebp)
+ 9bd:	e8 88 ff ff ff       	call   94a <ticks>
+ 9c2:	83 c4 08             	add    $0x8,%esp
+ 9c5:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 9cb:	99                   	cltd
+ 9cc:	f7 7d 08             	idivl  0x8(%ebp)
+ 9cf:	89 c2                	mov    %eax,%edx
+ 9d1:	8b 45 14             	mov    0x14(%ebp),%eax
+ 9d4:	2b 45 10             	sub    0x10(%ebp),%eax
+ 9d7:	83 ec 08             	sub    $0x8,%esp
+ 9da:	52                   	push   %edx
+ 9db:	50                   	push   %eax
+ 9dc:	ff 75 0c             	push   0xc(%ebp)
+ 9df:	ff 75 08             	push   0x8(%ebp)
+ 9e2:	68 98 0b 00 00       	push   $0xb98
+ 9e7:	6a 01                	push   $0x1
+ 9e9:	e8 a5 fb ff ff       	call   593 <printf>
+ 9ee:	83 c4 20             	add    $0x20,%esp
+}
+ 9f1:	90                   	nop
+ 9f2:	c9                   	leave
+ 9f3:	c3                   	ret
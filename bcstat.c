@@ -0,0 +1,42 @@
+// Print buffer cache, disk and log statistics.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "bcachestat.h"
+#include "diskstat.h"
+#include "logstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct bcachestat st;
+  struct diskstat ds;
+  struct logstat ls;
+
+  if(getbcachestat(&st) < 0){
+    printf(2, "bcstat: getbcachestat failed\n");
+    exit();
+  }
+  printf(1, "hits %d misses %d read-ahead %d evictions %d shrunk %d\n",
+         st.nhit, st.nmiss, st.nahead, st.nevict, st.nshrink);
+  printf(1, "buffers %d of at most %d\n", st.nbuf, st.maxbuf);
+  if(getdiskstat(&ds) < 0){
+    printf(2, "bcstat: getdiskstat failed\n");
+    exit();
+  }
+  printf(1, "disk commands %d blocks %d (%s)\n", ds.ncmd, ds.nblock,
+         ds.dma ? "DMA" : "PIO");
+  printf(1, "disk interrupt handler %d kcycles, %d per block\n",
+         ds.intrkcycles, ds.nblock ? ds.intrkcycles / ds.nblock : 0);
+  if(getlogstat(&ls) < 0){
+    printf(2, "bcstat: getlogstat failed\n");
+    exit();
+  }
+  printf(1, "log commits %d (%d early) ops %d blocks %d, %d ops per commit\n",
+         ls.ncommit, ls.nfull, ls.nop, ls.nblock,
+         ls.ncommit ? ls.nop / ls.ncommit : 0);
+  printf(1, "log checkpoints %d installed %d of %d logged blocks\n",
+         ls.nckpt, ls.ninstall, ls.nblock);
+  exit();
+}
@@ -0,0 +1,31 @@
+// Result lines for the benchmark programs.  Times are taken
+// with uptime(), whose ticks are 10ms.  A run that finishes
+// within one tick is counted as taking one.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+  return t1 > t0 ? t1 - t0 : 1;
+}
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+}
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+}
@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -19,80 +19,387 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ERROR: the last disk request for the buffer failed.
+// In addition, log.c pins the buffers of blocks it has logged
+// but not yet installed, which keeps them in the cache.
+//
+// Each buffer lives on the hash chain for its (dev, blockno).
+// There is a chain for every buffer the cache may grow to, so
+// chains stay short.  The chains share NBUCKET bucket locks; a
+// bucket's lock protects its chains and the B_BUSY flag of the
+// buffers on them, so lookups of blocks in different buckets
+// run in parallel.  Misses take bcache.lock as well, which
+// serializes eviction, growing and shrinking.
+//
+// Buffers holding a block are also on an LRU list, least
+// recently released first, protected by bcache.lrulock, so
+// eviction takes the first idle buffer from the front rather
+// than search the cache.
+//
+// The cache starts with NBUF static buffers.  A miss takes an
+// unused buffer if there is one, and otherwise allocates another
+// page of buffers with kalloc() rather than evicting, until the
+// cache holds BCACHEPCT percent of physical memory.
+// When kalloc() runs out of pages it calls bshrink() to hand
+// back the pages whose buffers are all idle and clean.
+//
+// Lock order: bcache.lock, then bcache.lrulock, then a bucket
+// lock.  brelse() takes bcache.lrulock and then its bucket lock
+// one after the other, never both at once.  kalloc() calls
+// bshrink() only when its caller holds no spinlock, so bshrink()
+// takes bcache.lock first like any other path.  bgrow() calls
+// kalloc() holding bcache.lock, so kalloc() does not shrink the
+// cache from there.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "spinlock.h"
+#include "memlayout.h"
+#include "mmu.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcachestat.h"
+
+#define NBUCKET 251
+#define NDISKRETRY 3  // times a failed disk request is retried
+
+// Buffers allocated at run time, BPERPAGE to a page.
+#define BPERPAGE ((PGSIZE - sizeof(void*)) / sizeof(struct buf))
+
+// Most buffers the cache could grow to with no kernel at all.
+#define MAXBUF (NBUF + PHYSTOP/PGSIZE*BCACHEPCT/100*BPERPAGE)
+
+// The hash chain for a block, and the bucket whose lock guards it.
+#define BHASH(dev, blockno) (((dev) * 31 + (blockno)) % bcache.nchain)
+#define BBUCKET(h) (&bcache.bucket[(h) % NBUCKET])
+
+struct bpage {
+  struct bpage *next;
+  struct buf buf[BPERPAGE];
+};
+
+struct bucket {
+  struct spinlock lock;
+  uint nhit;
+};
 
 struct {
   struct spinlock lock;
   struct buf buf[NBUF];
-
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  struct bucket bucket[NBUCKET];
+  struct buf *chain[MAXBUF];
+  uint nchain;           // Chains in use, one per buffer at most
+  struct spinlock lrulock;
+  struct buf lru;        // LRU list head: lru.lnext is least recent
+  struct buf *empty;     // Never used buffers, through hnext
+  struct bpage *pages;   // Run-time buffer pages
+  uint npage;
+  uint maxpage;
+  uint nmiss;
+  uint nevict;
+  uint nshrink;
+  uint nahead;
 } bcache;
 
+extern char end[]; // first address after kernel loaded from ELF file
+
+// Add b, whose dev and blockno are set, to its chain.
+// Caller must hold the bucket lock.
+static void
+blink(struct buf *b)
+{
+  uint h;
+
+  h = BHASH(b->dev, b->blockno);
+  b->hnext = bcache.chain[h];
+  bcache.chain[h] = b;
+}
+
+// Take b off the LRU list.  Caller must hold bcache.lrulock.
+static void
+lruremove(struct buf *b)
+{
+  b->lnext->lprev = b->lprev;
+  b->lprev->lnext = b->lnext;
+}
+
+// Put b at the most recently used end of the LRU list.
+// Caller must hold bcache.lrulock.
+static void
+lruappend(struct buf *b)
+{
+  b->lprev = bcache.lru.lprev;
+  b->lnext = &bcache.lru;
+  bcache.lru.lprev->lnext = b;
+  bcache.lru.lprev = b;
+}
+
+// Remove b from the chain at *pp.
+static void
+bunlink(struct buf **pp, struct buf *b)
+{
+  for(; *pp != b; pp = &(*pp)->hnext)
+    if(*pp == 0)
+      panic("bunlink");
+  *pp = b->hnext;
+}
+
+// Put b, which has never held a block, on the empty list.
+static void
+bempty(struct buf *b)
+{
+  b->dev = -1;
+  b->flags = 0;
+  b->hnext = bcache.empty;
+  bcache.empty = b;
+}
+
 void
 binit(void)
 {
+  struct bucket *bk;
   struct buf *b;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for(bk = bcache.bucket; bk < &bcache.bucket[NBUCKET]; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    b->dev = -1;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  bcache.lru.lprev = &bcache.lru;
+  bcache.lru.lnext = &bcache.lru;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+    bempty(b);
+  bcache.maxpage = (PHYSTOP - v2p(end)) / PGSIZE * BCACHEPCT / 100;
+  bcache.nchain = NBUF + bcache.maxpage * BPERPAGE;
+}
+
+// Add a page of empty buffers to the cache.
+// Caller must hold bcache.lock.  Returns -1 if the cache is
+// as large as it may grow or memory is short.
+static int
+bgrow(void)
+{
+  struct bpage *pg;
+  int i;
+
+  if(bcache.npage >= bcache.maxpage)
+    return -1;
+  if((pg = (struct bpage*)kalloc()) == 0)
+    return -1;
+  memset(pg, 0, PGSIZE);
+  for(i = 0; i < BPERPAGE; i++)
+    bempty(&pg->buf[i]);
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.npage++;
+  return 0;
+}
+
+// Return the lock of the ith buffer's bucket if no earlier
+// buffer on the page shares it, so that each is taken once.
+// Empty buffers are in no bucket.
+static struct spinlock*
+bpagelock(struct bpage *pg, int i)
+{
+  struct buf *b;
+  uint h;
+  int j;
+
+  b = &pg->buf[i];
+  if(b->dev == -1)
+    return 0;
+  h = BHASH(b->dev, b->blockno) % NBUCKET;
+  for(j = 0; j < i; j++)
+    if(pg->buf[j].dev != -1 &&
+       BHASH(pg->buf[j].dev, pg->buf[j].blockno) % NBUCKET == h)
+      return 0;
+  return &bcache.bucket[h].lock;
+}
+
+// Free the run-time buffer pages none of whose buffers is busy,
+// dirty or pinned, forgetting the blocks they cache.  Called by kalloc()
+// when it runs out of memory, with no spinlock held.  Returns the
+// number of pages freed.
+int
+bshrink(void)
+{
+  struct bpage *pg, **pp, *freed;
+  struct spinlock *lk;
+  struct buf *b;
+  int i, ok, n;
+
+  acquire(&bcache.lock);
+  acquire(&bcache.lrulock);
+  freed = 0;
+  n = 0;
+  for(pp = &bcache.pages; (pg = *pp) != 0; ){
+    for(i = 0; i < BPERPAGE; i++)
+      if((lk = bpagelock(pg, i)) != 0)
+        acquire(lk);
+    ok = 1;
+    for(i = 0; i < BPERPAGE; i++)
+      if((pg->buf[i].flags & (B_BUSY|B_DIRTY)) || pg->buf[i].pin)
+        ok = 0;
+    if(ok){
+      for(i = 0; i < BPERPAGE; i++){
+        b = &pg->buf[i];
+        if(b->dev == -1)
+          bunlink(&bcache.empty, b);
+        else {
+          bunlink(&bcache.chain[BHASH(b->dev, b->blockno)], b);
+          lruremove(b);
+        }
+      }
+    }
+    for(i = BPERPAGE-1; i >= 0; i--)
+      if((lk = bpagelock(pg, i)) != 0)
+        release(lk);
+    if(ok){
+      *pp = pg->next;
+      pg->next = freed;
+      freed = pg;
+      n++;
+    } else
+      pp = &pg->next;
   }
+  bcache.npage -= n;
+  bcache.nshrink += n * BPERPAGE;
+  release(&bcache.lrulock);
+  release(&bcache.lock);
+
+  while((pg = freed) != 0){
+    freed = pg->next;
+    kfree((char*)pg);
+  }
+  return n;
+}
+
+// Find the least recently used buffer that is neither busy,
+// dirty nor pinned, remove it from its chain and return it
+// B_BUSY.  A pinned buffer holds changes log.c has not yet
+// installed on disk.  It moves to the back of the LRU list.
+// Returns 0 if there is none.
+// Caller must hold bcache.lock.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  struct bucket *bk;
+  uint h;
+
+  acquire(&bcache.lrulock);
+  for(b = bcache.lru.lnext; b != &bcache.lru; b = b->lnext){
+    h = BHASH(b->dev, b->blockno);
+    bk = BBUCKET(h);
+    acquire(&bk->lock);
+    if((b->flags & (B_BUSY|B_DIRTY)) == 0 && b->pin == 0){
+      bunlink(&bcache.chain[h], b);
+      b->flags = B_BUSY;
+      release(&bk->lock);
+      lruremove(b);
+      lruappend(b);
+      release(&bcache.lrulock);
+      bcache.nevict++;
+      return b;
+    }
+    release(&bk->lock);
+  }
+  release(&bcache.lrulock);
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return B_BUSY buffer.
+// With ahead set, return 0 instead if the block is already
+// cached or no buffer is free.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
   struct buf *b;
+  struct bucket *bk;
+  uint h;
 
-  acquire(&bcache.lock);
+  h = BHASH(dev, blockno);
+  bk = BBUCKET(h);
+  acquire(&bk->lock);
 
  loop:
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bcache.chain[h]; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
       if(!(b->flags & B_BUSY)){
         b->flags |= B_BUSY;
-        release(&bcache.lock);
+        bk->nhit++;
+        release(&bk->lock);
         return b;
       }
-      sleep(b, &bcache.lock);
+      sleep(b, &bk->lock);
       goto loop;
     }
   }
+  release(&bk->lock);
 
-  // Not cached; recycle some non-busy and clean buffer.
-  // "clean" because B_DIRTY and !B_BUSY means log.c
-  // hasn't yet committed the changes to the buffer.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = B_BUSY;
+  // Not cached.  Look again holding bcache.lock, in case another
+  // process installed the block since, then grow the cache or
+  // recycle a buffer.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  for(b = bcache.chain[h]; b; b = b->hnext){
+    if(b->dev == dev && b->blockno == blockno){
       release(&bcache.lock);
-      return b;
+      goto loop;
     }
   }
-  panic("bget: no buffers");
+  release(&bk->lock);
+
+  if(bcache.empty == 0)
+    bgrow();
+  if((b = bcache.empty) != 0){
+    bcache.empty = b->hnext;
+    b->flags = B_BUSY;
+    acquire(&bcache.lrulock);
+    lruappend(b);
+    release(&bcache.lrulock);
+  } else if((b = bvictim()) == 0){
+    if(!ahead)
+      panic("bget: no buffers");
+    release(&bcache.lock);
+    return 0;
+  }
+  if(ahead)
+    bcache.nahead++;
+  else
+    bcache.nmiss++;
+  b->dev = dev;
+  b->blockno = blockno;
+  acquire(&bk->lock);
+  blink(b);
+  release(&bk->lock);
+  release(&bcache.lock);
+  return b;
+}
+
+// Wait for the disk request idesubmit() started for b to
+// finish, and retry it up to NDISKRETRY times if it fails.
+// The file system cannot go on without the block, so one
+// that cannot be read or written is fatal.
+static void
+bfinish(struct buf *b)
+{
+  int n;
+
+  for(n = 0; ideawait(b) < 0; n++){
+    if(n == NDISKRETRY)
+      panic("disk error");
+    idesubmit(b);
+  }
 }
 
 // Return a B_BUSY buf with the contents of the indicated block.
@@ -101,13 +408,77 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if(!(b->flags & B_VALID)) {
-    iderw(b);
+    idesubmit(b);
+    bfinish(b);
+  }
+  return b;
+}
+
+// Asynchronous interface.  These start the disk request and
+// return at once, so a caller can have many in flight.  done,
+// if not 0, is called when the request finishes: from the disk
+// interrupt handler, holding the driver's lock, so it must not
+// sleep.  biowait() waits for a request to finish.  The buffer
+// stays B_BUSY until someone, possibly done, calls brelse().
+
+// Return a B_BUSY buf for the indicated block, starting to read
+// it if it is not cached.  If it is, done is called at once.
+struct buf*
+bread_async(uint dev, uint blockno, void (*done)(struct buf*))
+{
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  if(b->flags & B_VALID){
+    if(done)
+      done(b);
+    return b;
   }
+  b->done = done;
+  idesubmit(b);
   return b;
 }
 
+// Start writing b's contents to disk.  Must be B_BUSY.
+void
+bwrite_async(struct buf *b, void (*done)(struct buf*))
+{
+  if((b->flags & B_BUSY) == 0)
+    panic("bwrite_async");
+  b->flags |= B_DIRTY;
+  b->done = done;
+  idesubmit(b);
+}
+
+// Wait for an asynchronous read or write of b to finish.
+void
+biowait(struct buf *b)
+{
+  if((b->flags & B_BUSY) == 0)
+    panic("biowait");
+  bfinish(b);
+}
+
+// Start reading the indicated block into the cache if it is
+// not there yet, without waiting for it.  The buffer is
+// released when the read completes.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  b->done = brelse;
+  idesubmit(b);
+}
+
 // Write b's contents to disk.  Must be B_BUSY.
 void
 bwrite(struct buf *b)
@@ -115,31 +486,76 @@ bwrite(struct buf *b)
   if((b->flags & B_BUSY) == 0)
     panic("bwrite");
   b->flags |= B_DIRTY;
-  iderw(b);
+  idesubmit(b);
+  bfinish(b);
 }
 
 // Release a B_BUSY buffer.
-// Move to the head of the MRU list.
+// Move it to the most recently used end of the LRU list.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if((b->flags & B_BUSY) == 0)
     panic("brelse");
 
-  acquire(&bcache.lock);
-
-  b->next->prev = b->prev;
-  b->prev->next = b->next;
-  b->next = bcache.head.next;
-  b->prev = &bcache.head;
-  bcache.head.next->prev = b;
-  bcache.head.next = b;
+  acquire(&bcache.lrulock);
+  lruremove(b);
+  lruappend(b);
+  release(&bcache.lrulock);
 
+  bk = BBUCKET(BHASH(b->dev, b->blockno));
+  acquire(&bk->lock);
   b->flags &= ~B_BUSY;
   wakeup(b);
+  release(&bk->lock);
+}
 
+// Keep b in the cache until a matching bunpin(), even once
+// it is released.
+void
+bpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = BBUCKET(BHASH(b->dev, b->blockno));
+  acquire(&bk->lock);
+  b->pin++;
+  release(&bk->lock);
+}
+
+// Undo a bpin().
+void
+bunpin(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = BBUCKET(BHASH(b->dev, b->blockno));
+  acquire(&bk->lock);
+  if(b->pin <= 0)
+    panic("bunpin");
+  b->pin--;
+  release(&bk->lock);
+}
+
+// Fill in buffer cache statistics for getbcachestat().
+void
+bstat(struct bcachestat *st)
+{
+  struct bucket *bk;
+
+  acquire(&bcache.lock);
+  st->nhit = 0;
+  for(bk = bcache.bucket; bk < &bcache.bucket[NBUCKET]; bk++)
+    st->nhit += bk->nhit;
+  st->nmiss = bcache.nmiss;
+  st->nevict = bcache.nevict;
+  st->nshrink = bcache.nshrink;
+  st->nahead = bcache.nahead;
+  st->nbuf = NBUF + bcache.npage * BPERPAGE;
+  st->maxbuf = NBUF + bcache.maxpage * BPERPAGE;
   release(&bcache.lock);
 }
 //PAGEBREAK!
 // Blank page.
-
@@ -2,12 +2,17 @@ struct buf {
   int flags;
   uint dev;
   uint blockno;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  struct buf *hnext; // hash chain
+  struct buf *lprev; // LRU list
+  struct buf *lnext;
+  int pin;           // bpin() count; pinned buffers are not evicted
   struct buf *qnext; // disk queue
+  uint qtime;        // ticks when queued
+  void (*done)(struct buf*); // called when asynchronous I/O completes
   uchar data[BSIZE];
 };
 #define B_BUSY  0x1  // buffer is locked by some process
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ERROR 0x8  // the last disk request for the buffer failed
 
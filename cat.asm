@@ -0,0 +1,1339 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+   6:	eb 15                	jmp    1d <cat+0x1d>
+    write(1, buf, n);
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 e0 0c 00 00       	push   $0xce0
+  13:	6a 01                	push   $0x1
+  15:	e8 6c 03 00 00       	call   386 <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	68 00 02 00 00       	push   $0x200
+  25:	68 e0 0c 00 00       	push   $0xce0
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	e8 4c 03 00 00       	call   37e <read>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3c:	7f ca                	jg     8 <cat+0x8>
+  if(n < 0){
+  3e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  42:	79 17                	jns    5b <cat+0x5b>
+    printf(1, "cat: read error\n");
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	68 74 09 00 00       	push   $0x974
+  4c:	6a 01                	push   $0x1
+  4e:	e8 bf 04 00 00       	call   512 <printf>
+  53:	83 c4 10             	add    $0x10,%esp
+    exit();
+  56:	e8 0b 03 00 00       	call   366 <exit>
+  }
+}
+  5b:	90                   	nop
+  5c:	c9                   	leave
+  5d:	c3                   	ret
+
+0000005e <main>:
+
+int
+main(int argc, char *argv[])
+{
+  5e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  62:	83 e4 f0             	and    $0xfffffff0,%esp
+  65:	ff 71 fc             	push   -0x4(%ecx)
+  68:	55                   	push   %ebp
+  69:	89 e5                	mov    %esp,%ebp
+  6b:	53                   	push   %ebx
+  6c:	51                   	push   %ecx
+  6d:	83 ec 10             	sub    $0x10,%esp
+  70:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  72:	83 3b 01             	cmpl   $0x1,(%ebx)
+  75:	7f 12                	jg     89 <main+0x2b>
+    cat(0);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	6a 00                	push   $0x0
+  7c:	e8 7f ff ff ff       	call   0 <cat>
+  81:	83 c4 10             	add    $0x10,%esp
+    exit();
+  84:	e8 dd 02 00 00       	call   366 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  89:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  90:	eb 71                	jmp    103 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  95:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  9f:	01 d0                	add    %edx,%eax
+  a1:	8b 00                	mov    (%eax),%eax
+  a3:	83 ec 08             	sub    $0x8,%esp
+  a6:	6a 00                	push   $0x0
+  a8:	50                   	push   %eax
+  a9:	e8 f8 02 00 00       	call   3a6 <open>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b8:	79 29                	jns    e3 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  bd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  c7:	01 d0                	add    %edx,%eax
+  c9:	8b 00                	mov    (%eax),%eax
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	50                   	push   %eax
+  cf:	68 85 09 00 00       	push   $0x985
+  d4:	6a 01                	push   $0x1
+  d6:	e8 37 04 00 00       	call   512 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+      exit();
+  de:	e8 83 02 00 00       	call   366 <exit>
+    }
+    cat(fd);
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	ff 75 f0             	push   -0x10(%ebp)
+  e9:	e8 12 ff ff ff       	call   0 <cat>
+  ee:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	ff 75 f0             	push   -0x10(%ebp)
+  f7:	e8 92 02 00 00       	call   38e <close>
+  fc:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+  ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 106:	3b 03                	cmp    (%ebx),%eax
+ 108:	7c 88                	jl     92 <main+0x34>
+  }
+  exit();
+ 10a:	e8 57 02 00 00       	call   366 <exit>
+
+0000010f <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	57                   	push   %edi
+ 113:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 114:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 117:	8b 55 10             	mov    0x10(%ebp),%edx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	89 cb                	mov    %ecx,%ebx
+ 11f:	89 df                	mov    %ebx,%edi
+ 121:	89 d1                	mov    %edx,%ecx
+ 123:	fc                   	cld
+ 124:	f3 aa                	rep stos %al,%es:(%edi)
+ 126:	89 ca                	mov    %ecx,%edx
+ 128:	89 fb                	mov    %edi,%ebx
+ 12a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 12d:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 130:	90                   	nop
+ 131:	5b                   	pop    %ebx
+ 132:	5f                   	pop    %edi
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 141:	90                   	nop
+ 142:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 145:	8d 42 01             	lea    0x1(%edx),%eax
+ 148:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 14b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 151:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 154:	0f b6 12             	movzbl (%edx),%edx
+ 157:	88 10                	mov    %dl,(%eax)
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	84 c0                	test   %al,%al
+ 15e:	75 e2                	jne    142 <strcpy+0xd>
+    ;
+  return os;
+ 160:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+
+00000165 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 165:	55                   	push   %ebp
+ 166:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 168:	eb 08                	jmp    172 <strcmp+0xd>
+    p++, q++;
+ 16a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	74 10                	je     18c <strcmp+0x27>
+ 17c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17f:	0f b6 10             	movzbl (%eax),%edx
+ 182:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 185:	0f b6 00             	movzbl (%eax),%eax
+ 188:	38 c2                	cmp    %al,%dl
+ 18a:	74 de                	je     16a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 18c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18f:	0f b6 00             	movzbl (%eax),%eax
+ 192:	0f b6 d0             	movzbl %al,%edx
+ 195:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 198:	0f b6 00             	movzbl (%eax),%eax
+ 19b:	0f b6 c0             	movzbl %al,%eax
+ 19e:	29 c2                	sub    %eax,%edx
+ 1a0:	89 d0                	mov    %edx,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+
+000001a4 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1b1:	eb 04                	jmp    1b7 <strlen+0x13>
+ 1b3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bd:	01 d0                	add    %edx,%eax
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	75 ed                	jne    1b3 <strlen+0xf>
+    ;
+  return n;
+ 1c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c9:	c9                   	leave
+ 1ca:	c3                   	ret
+
+000001cb <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ce:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d1:	50                   	push   %eax
+ 1d2:	ff 75 0c             	push   0xc(%ebp)
+ 1d5:	ff 75 08             	push   0x8(%ebp)
+ 1d8:	e8 32 ff ff ff       	call   10f <stosb>
+ 1dd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+
+000001e5 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e5:	55                   	push   %ebp
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	83 ec 04             	sub    $0x4,%esp
+ 1eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ee:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1f1:	eb 14                	jmp    207 <strchr+0x22>
+    if(*s == c)
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 00             	movzbl (%eax),%eax
+ 1f9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1fc:	75 05                	jne    203 <strchr+0x1e>
+      return (char*)s;
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	eb 13                	jmp    216 <strchr+0x31>
+  for(; *s; s++)
+ 203:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20a:	0f b6 00             	movzbl (%eax),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 e2                	jne    1f3 <strchr+0xe>
+  return 0;
+ 211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 216:	c9                   	leave
+ 217:	c3                   	ret
+
+00000218 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 21e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 225:	eb 42                	jmp    269 <gets+0x51>
+    cc = read(0, &c, 1);
+ 227:	83 ec 04             	sub    $0x4,%esp
+ 22a:	6a 01                	push   $0x1
+ 22c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 22f:	50                   	push   %eax
+ 230:	6a 00                	push   $0x0
+ 232:	e8 47 01 00 00       	call   37e <read>
+ 237:	83 c4 10             	add    $0x10,%esp
+ 23a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 23d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 241:	7e 33                	jle    276 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 246:	8d 50 01             	lea    0x1(%eax),%edx
+ 249:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 24c:	89 c2                	mov    %eax,%edx
+ 24e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 251:	01 c2                	add    %eax,%edx
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 259:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25d:	3c 0a                	cmp    $0xa,%al
+ 25f:	74 16                	je     277 <gets+0x5f>
+ 261:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 265:	3c 0d                	cmp    $0xd,%al
+ 267:	74 0e                	je     277 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 269:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 272:	7f b3                	jg     227 <gets+0xf>
+ 274:	eb 01                	jmp    277 <gets+0x5f>
+      break;
+ 276:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 277:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27d:	01 d0                	add    %edx,%eax
+ 27f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 28d:	83 ec 08             	sub    $0x8,%esp
+ 290:	6a 00                	push   $0x0
+ 292:	ff 75 08             	push   0x8(%ebp)
+ 295:	e8 0c 01 00 00       	call   3a6 <open>
+ 29a:	83 c4 10             	add    $0x10,%esp
+ 29d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a4:	79 07                	jns    2ad <stat+0x26>
+    return -1;
+ 2a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ab:	eb 25                	jmp    2d2 <stat+0x4b>
+  r = fstat(fd, st);
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	ff 75 0c             	push   0xc(%ebp)
+ 2b3:	ff 75 f4             	push   -0xc(%ebp)
+ 2b6:	e8 03 01 00 00       	call   3be <fstat>
+ 2bb:	83 c4 10             	add    $0x10,%esp
+ 2be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2c1:	83 ec 0c             	sub    $0xc,%esp
+ 2c4:	ff 75 f4             	push   -0xc(%ebp)
+ 2c7:	e8 c2 00 00 00       	call   38e <close>
+ 2cc:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2d2:	c9                   	leave
+ 2d3:	c3                   	ret
+
+000002d4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d4:	55                   	push   %ebp
+ 2d5:	89 e5                	mov    %esp,%ebp
+ 2d7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2e1:	eb 25                	jmp    308 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2e3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	c1 e0 02             	shl    $0x2,%eax
+ 2eb:	01 d0                	add    %edx,%eax
+ 2ed:	01 c0                	add    %eax,%eax
+ 2ef:	89 c1                	mov    %eax,%ecx
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2fa:	0f b6 00             	movzbl (%eax),%eax
+ 2fd:	0f be c0             	movsbl %al,%eax
+ 300:	01 c8                	add    %ecx,%eax
+ 302:	83 e8 30             	sub    $0x30,%eax
+ 305:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 308:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30b:	0f b6 00             	movzbl (%eax),%eax
+ 30e:	3c 2f                	cmp    $0x2f,%al
+ 310:	7e 0a                	jle    31c <atoi+0x48>
+ 312:	8b 45 08             	mov    0x8(%ebp),%eax
+ 315:	0f b6 00             	movzbl (%eax),%eax
+ 318:	3c 39                	cmp    $0x39,%al
+ 31a:	7e c7                	jle    2e3 <atoi+0xf>
+  return n;
+ 31c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 31f:	c9                   	leave
+ 320:	c3                   	ret
+
+00000321 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 32d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 330:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 333:	eb 17                	jmp    34c <memmove+0x2b>
+    *dst++ = *src++;
+ 335:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 338:	8d 42 01             	lea    0x1(%edx),%eax
+ 33b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 33e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 341:	8d 48 01             	lea    0x1(%eax),%ecx
+ 344:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 347:	0f b6 12             	movzbl (%edx),%edx
+ 34a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 352:	89 55 10             	mov    %edx,0x10(%ebp)
+ 355:	85 c0                	test   %eax,%eax
+ 357:	7f dc                	jg     335 <memmove+0x14>
+  return vdst;
+ 359:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 35c:	c9                   	leave
+ 35d:	c3                   	ret
+
+0000035e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 35e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <exit>:
+SYSCALL(exit)
+ 366:	b8 02 00 00 00       	mov    $0x2,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <wait>:
+SYSCALL(wait)
+ 36e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <pipe>:
+SYSCALL(pipe)
+ 376:	b8 04 00 00 00       	mov    $0x4,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <read>:
+SYSCALL(read)
+ 37e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <write>:
+SYSCALL(write)
+ 386:	b8 10 00 00 00       	mov    $0x10,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <close>:
+SYSCALL(close)
+ 38e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <kill>:
+SYSCALL(kill)
+ 396:	b8 06 00 00 00       	mov    $0x6,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <exec>:
+SYSCALL(exec)
+ 39e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <open>:
+SYSCALL(open)
+ 3a6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <mknod>:
+SYSCALL(mknod)
+ 3ae:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <unlink>:
+SYSCALL(unlink)
+ 3b6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <fstat>:
+SYSCALL(fstat)
+ 3be:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <link>:
+SYSCALL(link)
+ 3c6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <mkdir>:
+SYSCALL(mkdir)
+ 3ce:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <chdir>:
+SYSCALL(chdir)
+ 3d6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <dup>:
+SYSCALL(dup)
+ 3de:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <getpid>:
+SYSCALL(getpid)
+ 3e6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <sbrk>:
+SYSCALL(sbrk)
+ 3ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <sleep>:
+SYSCALL(sleep)
+ 3f6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <uptime>:
+SYSCALL(uptime)
+ 3fe:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 406:	b8 16 00 00 00       	mov    $0x16,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <getschedstat>:
+SYSCALL(getschedstat)
+ 40e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 416:	b8 18 00 00 00       	mov    $0x18,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <setshare>:
+SYSCALL(setshare)
+ 41e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 426:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <getdiskstat>:
+SYSCALL(getdiskstat)
+ 42e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <getlogstat>:
+SYSCALL(getlogstat)
+ 436:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	83 ec 18             	sub    $0x18,%esp
+ 444:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 447:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 44a:	83 ec 04             	sub    $0x4,%esp
+ 44d:	6a 01                	push   $0x1
+ 44f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 452:	50                   	push   %eax
+ 453:	ff 75 08             	push   0x8(%ebp)
+ 456:	e8 2b ff ff ff       	call   386 <write>
+ 45b:	83 c4 10             	add    $0x10,%esp
+}
+ 45e:	90                   	nop
+ 45f:	c9                   	leave
+ 460:	c3                   	ret
+
+00000461 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 461:	55                   	push   %ebp
+ 462:	89 e5                	mov    %esp,%ebp
+ 464:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 467:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 46e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 472:	74 17                	je     48b <printint+0x2a>
+ 474:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 478:	79 11                	jns    48b <printint+0x2a>
+    neg = 1;
+ 47a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 481:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 484:	f7 d8                	neg    %eax
+ 486:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 489:	eb 06                	jmp    491 <printint+0x30>
+  } else {
+    x = xx;
+ 48b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 491:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 498:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 49b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 49e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4a3:	f7 f1                	div    %ecx
+ 4a5:	89 d1                	mov    %edx,%ecx
+ 4a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4aa:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4b0:	0f b6 91 b0 0c 00 00 	movzbl 0xcb0(%ecx),%edx
+ 4b7:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4be:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4c1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c6:	f7 f1                	div    %ecx
+ 4c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4cf:	75 c7                	jne    498 <printint+0x37>
+  if(neg)
+ 4d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4d5:	74 2d                	je     504 <printint+0xa3>
+    buf[i++] = '-';
+ 4d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4da:	8d 50 01             	lea    0x1(%eax),%edx
+ 4dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4e0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4e5:	eb 1d                	jmp    504 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4e7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4ed:	01 d0                	add    %edx,%eax
+ 4ef:	0f b6 00             	movzbl (%eax),%eax
+ 4f2:	0f be c0             	movsbl %al,%eax
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	50                   	push   %eax
+ 4f9:	ff 75 08             	push   0x8(%ebp)
+ 4fc:	e8 3d ff ff ff       	call   43e <putc>
+ 501:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 504:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 508:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 50c:	79 d9                	jns    4e7 <printint+0x86>
+}
+ 50e:	90                   	nop
+ 50f:	90                   	nop
+ 510:	c9                   	leave
+ 511:	c3                   	ret
+
+00000512 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 512:	55                   	push   %ebp
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 518:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 51f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 522:	83 c0 04             	add    $0x4,%eax
+ 525:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 528:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 52f:	e9 59 01 00 00       	jmp    68d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 534:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 537:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 53a:	01 d0                	add    %edx,%eax
+ 53c:	0f b6 00             	movzbl (%eax),%eax
+ 53f:	0f be c0             	movsbl %al,%eax
+ 542:	25 ff 00 00 00       	and    $0xff,%eax
+ 547:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 54a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 54e:	75 2c                	jne    57c <printf+0x6a>
+      if(c == '%'){
+ 550:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 554:	75 0c                	jne    562 <printf+0x50>
+        state = '%';
+ 556:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 55d:	e9 27 01 00 00       	jmp    689 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 562:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 565:	0f be c0             	movsbl %al,%eax
+ 568:	83 ec 08             	sub    $0x8,%esp
+ 56b:	50                   	push   %eax
+ 56c:	ff 75 08             	push   0x8(%ebp)
+ 56f:	e8 ca fe ff ff       	call   43e <putc>
+ 574:	83 c4 10             	add    $0x10,%esp
+ 577:	e9 0d 01 00 00       	jmp    689 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 57c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 580:	0f 85 03 01 00 00    	jne    689 <printf+0x177>
+      if(c == 'd'){
+ 586:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 58a:	75 1e                	jne    5aa <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 58c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 58f:	8b 00                	mov    (%eax),%eax
+ 591:	6a 01                	push   $0x1
+ 593:	6a 0a                	push   $0xa
+ 595:	50                   	push   %eax
+ 596:	ff 75 08             	push   0x8(%ebp)
+ 599:	e8 c3 fe ff ff       	call   461 <printint>
+ 59e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5a1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5a5:	e9 d8 00 00 00       	jmp    682 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5aa:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5ae:	74 06                	je     5b6 <printf+0xa4>
+ 5b0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5b4:	75 1e                	jne    5d4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5b9:	8b 00                	mov    (%eax),%eax
+ 5bb:	6a 00                	push   $0x0
+ 5bd:	6a 10                	push   $0x10
+ 5bf:	50                   	push   %eax
+ 5c0:	ff 75 08             	push   0x8(%ebp)
+ 5c3:	e8 99 fe ff ff       	call   461 <printint>
+ 5c8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5cb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5cf:	e9 ae 00 00 00       	jmp    682 <printf+0x170>
+      } else if(c == 's'){
+ 5d4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5d8:	75 43                	jne    61d <printf+0x10b>
+        s = (char*)*ap;
+ 5da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5dd:	8b 00                	mov    (%eax),%eax
+ 5df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5e2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ea:	75 25                	jne    611 <printf+0xff>
+          s = "(null)";
+ 5ec:	c7 45 f4 9a 09 00 00 	movl   $0x99a,-0xc(%ebp)
+        while(*s != 0){
+ 5f3:	eb 1c                	jmp    611 <printf+0xff>
+          putc(fd, *s);
+ 5f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f8:	0f b6 00             	movzbl (%eax),%eax
+ 5fb:	0f be c0             	movsbl %al,%eax
+ 5fe:	83 ec 08             	sub    $0x8,%esp
+ 601:	50                   	push   %eax
+ 602:	ff 75 08             	push   0x8(%ebp)
+ 605:	e8 34 fe ff ff       	call   43e <putc>
+ 60a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 60d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 611:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 614:	0f b6 00             	movzbl (%eax),%eax
+ 617:	84 c0                	test   %al,%al
+ 619:	75 da                	jne    5f5 <printf+0xe3>
+ 61b:	eb 65                	jmp    682 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 61d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 621:	75 1d                	jne    640 <printf+0x12e>
+        putc(fd, *ap);
+ 623:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 626:	8b 00                	mov    (%eax),%eax
+ 628:	0f be c0             	movsbl %al,%eax
+ 62b:	83 ec 08             	sub    $0x8,%esp
+ 62e:	50                   	push   %eax
+ 62f:	ff 75 08             	push   0x8(%ebp)
+ 632:	e8 07 fe ff ff       	call   43e <putc>
+ 637:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 63a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 63e:	eb 42                	jmp    682 <printf+0x170>
+      } else if(c == '%'){
+ 640:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 644:	75 17                	jne    65d <printf+0x14b>
+        putc(fd, c);
+ 646:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 649:	0f be c0             	movsbl %al,%eax
+ 64c:	83 ec 08             	sub    $0x8,%esp
+ 64f:	50                   	push   %eax
+ 650:	ff 75 08             	push   0x8(%ebp)
+ 653:	e8 e6 fd ff ff       	call   43e <putc>
+ 658:	83 c4 10             	add    $0x10,%esp
+ 65b:	eb 25                	jmp    682 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 65d:	83 ec 08             	sub    $0x8,%esp
+ 660:	6a 25                	push   $0x25
+ 662:	ff 75 08             	push   0x8(%ebp)
+ 665:	e8 d4 fd ff ff       	call   43e <putc>
+ 66a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 66d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 670:	0f be c0             	movsbl %al,%eax
+ 673:	83 ec 08             	sub    $0x8,%esp
+ 676:	50                   	push   %eax
+ 677:	ff 75 08             	push   0x8(%ebp)
+ 67a:	e8 bf fd ff ff       	call   43e <putc>
+ 67f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 682:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 689:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 68d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 690:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 693:	01 d0                	add    %edx,%eax
+ 695:	0f b6 00             	movzbl (%eax),%eax
+ 698:	84 c0                	test   %al,%al
+ 69a:	0f 85 94 fe ff ff    	jne    534 <printf+0x22>
+    }
+  }
+}
+ 6a0:	90                   	nop
+ 6a1:	90                   	nop
+ 6a2:	c9                   	leave
+ 6a3:	c3                   	ret
+
+000006a4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6a4:	55                   	push   %ebp
+ 6a5:	89 e5                	mov    %esp,%ebp
+ 6a7:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ad:	83 e8 08             	sub    $0x8,%eax
+ 6b0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b3:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 6b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6bb:	eb 24                	jmp    6e1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c0:	8b 00                	mov    (%eax),%eax
+ 6c2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6c5:	72 12                	jb     6d9 <free+0x35>
+ 6c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6ca:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6cd:	72 24                	jb     6f3 <free+0x4f>
+ 6cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d2:	8b 00                	mov    (%eax),%eax
+ 6d4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6d7:	72 1a                	jb     6f3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6dc:	8b 00                	mov    (%eax),%eax
+ 6de:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6e7:	73 d4                	jae    6bd <free+0x19>
+ 6e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ec:	8b 00                	mov    (%eax),%eax
+ 6ee:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6f1:	73 ca                	jae    6bd <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f6:	8b 40 04             	mov    0x4(%eax),%eax
+ 6f9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 700:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 703:	01 c2                	add    %eax,%edx
+ 705:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 708:	8b 00                	mov    (%eax),%eax
+ 70a:	39 c2                	cmp    %eax,%edx
+ 70c:	75 24                	jne    732 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 70e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 711:	8b 50 04             	mov    0x4(%eax),%edx
+ 714:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 717:	8b 00                	mov    (%eax),%eax
+ 719:	8b 40 04             	mov    0x4(%eax),%eax
+ 71c:	01 c2                	add    %eax,%edx
+ 71e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 721:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 724:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 727:	8b 00                	mov    (%eax),%eax
+ 729:	8b 10                	mov    (%eax),%edx
+ 72b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72e:	89 10                	mov    %edx,(%eax)
+ 730:	eb 0a                	jmp    73c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 732:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 735:	8b 10                	mov    (%eax),%edx
+ 737:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 73c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73f:	8b 40 04             	mov    0x4(%eax),%eax
+ 742:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 749:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74c:	01 d0                	add    %edx,%eax
+ 74e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 751:	75 20                	jne    773 <free+0xcf>
+    p->s.size += bp->s.size;
+ 753:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 756:	8b 50 04             	mov    0x4(%eax),%edx
+ 759:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75c:	8b 40 04             	mov    0x4(%eax),%eax
+ 75f:	01 c2                	add    %eax,%edx
+ 761:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 764:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 767:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 76a:	8b 10                	mov    (%eax),%edx
+ 76c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76f:	89 10                	mov    %edx,(%eax)
+ 771:	eb 08                	jmp    77b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 773:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 776:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 779:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 77b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77e:	a3 e8 0e 00 00       	mov    %eax,0xee8
+}
+ 783:	90                   	nop
+ 784:	c9                   	leave
+ 785:	c3                   	ret
+
+00000786 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 786:	55                   	push   %ebp
+ 787:	89 e5                	mov    %esp,%ebp
+ 789:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 78c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 793:	77 07                	ja     79c <morecore+0x16>
+    nu = 4096;
+ 795:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 79c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79f:	c1 e0 03             	shl    $0x3,%eax
+ 7a2:	83 ec 0c             	sub    $0xc,%esp
+ 7a5:	50                   	push   %eax
+ 7a6:	e8 43 fc ff ff       	call   3ee <sbrk>
+ 7ab:	83 c4 10             	add    $0x10,%esp
+ 7ae:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7b1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7b5:	75 07                	jne    7be <morecore+0x38>
+    return 0;
+ 7b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7bc:	eb 26                	jmp    7e4 <morecore+0x5e>
+  hp = (Header*)p;
+ 7be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7ca:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7d0:	83 c0 08             	add    $0x8,%eax
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	50                   	push   %eax
+ 7d7:	e8 c8 fe ff ff       	call   6a4 <free>
+ 7dc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7df:	a1 e8 0e 00 00       	mov    0xee8,%eax
+}
+ 7e4:	c9                   	leave
+ 7e5:	c3                   	ret
+
+000007e6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7e6:	55                   	push   %ebp
+ 7e7:	89 e5                	mov    %esp,%ebp
+ 7e9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ef:	83 c0 07             	add    $0x7,%eax
+ 7f2:	c1 e8 03             	shr    $0x3,%eax
+ 7f5:	83 c0 01             	add    $0x1,%eax
+ 7f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7fb:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 800:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 803:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 807:	75 23                	jne    82c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 809:	c7 45 f0 e0 0e 00 00 	movl   $0xee0,-0x10(%ebp)
+ 810:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 813:	a3 e8 0e 00 00       	mov    %eax,0xee8
+ 818:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 81d:	a3 e0 0e 00 00       	mov    %eax,0xee0
+    base.s.size = 0;
+ 822:	c7 05 e4 0e 00 00 00 	movl   $0x0,0xee4
+ 829:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 82c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 82f:	8b 00                	mov    (%eax),%eax
+ 831:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 834:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 837:	8b 40 04             	mov    0x4(%eax),%eax
+ 83a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 83d:	72 4d                	jb     88c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 83f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 842:	8b 40 04             	mov    0x4(%eax),%eax
+ 845:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 848:	75 0c                	jne    856 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 84a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84d:	8b 10                	mov    (%eax),%edx
+ 84f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 852:	89 10                	mov    %edx,(%eax)
+ 854:	eb 26                	jmp    87c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 856:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 859:	8b 40 04             	mov    0x4(%eax),%eax
+ 85c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 85f:	89 c2                	mov    %eax,%edx
+ 861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 864:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 867:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86a:	8b 40 04             	mov    0x4(%eax),%eax
+ 86d:	c1 e0 03             	shl    $0x3,%eax
+ 870:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 876:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 879:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 87c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 87f:	a3 e8 0e 00 00       	mov    %eax,0xee8
+      return (void*)(p + 1);
+ 884:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 887:	83 c0 08             	add    $0x8,%eax
+ 88a:	eb 3b                	jmp    8c7 <malloc+0xe1>
+    }
+    if(p == freep)
+ 88c:	a1 e8 0e 00 00       	mov    0xee8,%eax
+ 891:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 894:	75 1e                	jne    8b4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 896:	83 ec 0c             	sub    $0xc,%esp
+ 899:	ff 75 ec             	push   -0x14(%ebp)
+ 89c:	e8 e5 fe ff ff       	call   786 <morecore>
+ 8a1:	83 c4 10             	add    $0x10,%esp
+ 8a4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ab:	75 07                	jne    8b4 <malloc+0xce>
+        return 0;
+ 8ad:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8b2:	eb 13                	jmp    8c7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8bd:	8b 00                	mov    (%eax),%eax
+ 8bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8c2:	e9 6d ff ff ff       	jmp    834 <malloc+0x4e>
+  }
+}
+ 8c7:	c9                   	leave
+ 8c8:	c3                   	ret
+
+000008c9 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 8c9:	55                   	push   %ebp
+ 8ca:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 8cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8cf:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 8d2:	7e 08                	jle    8dc <ticks+0x13>
+ 8d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8d7:	2b 45 08             	sub    0x8(%ebp),%eax
+ 8da:	eb 05                	jmp    8e1 <ticks+0x18>
+ 8dc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 8e1:	5d                   	pop    %ebp
+ 8e2:	c3                   	ret
+
+000008e3 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 8e3:	55                   	push   %ebp
+ 8e4:	89 e5                	mov    %esp,%ebp
+ 8e6:	53                   	push   %ebx
+ 8e7:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 8ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ed:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 8f0:	ff 75 14             	push   0x14(%ebp)
+ 8f3:	ff 75 10             	push   0x10(%ebp)
+ 8f6:	e8 ce ff ff ff       	call   8c9 <ticks>
+ 8fb:	83 c4 08             	add    $0x8,%esp
+ 8fe:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 900:	89 d8                	mov    %ebx,%eax
+ 902:	99                   	cltd
+ 903:	f7 f9                	idiv   %ecx
+ 905:	89 c2                	mov    %eax,%edx
+ 907:	8b 45 14             	mov    0x14(%ebp),%eax
+ 90a:	2b 45 10             	sub    0x10(%ebp),%eax
+ 90d:	83 ec 04             	sub    $0x4,%esp
+ 910:	ff 75 0c             	push   0xc(%ebp)
+ 913:	52                   	push   %edx
+ 914:	50                   	push   %eax
+ 915:	ff 75 0c             	push   0xc(%ebp)
+ 918:	ff 75 08             	push   0x8(%ebp)
+ 91b:	68 a4 09 00 00       	push   $0x9a4
+ 920:	6a 01                	push   $0x1
+ 922:	e8 eb fb ff ff       	call   512 <printf>
+ 927:	83 c4 20             	add    $0x20,%esp
+}
+ 92a:	90                   	nop
+ 92b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 92e:	c9                   	leave
+ 92f:	c3                   	ret
+
+00000930 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 936:	ff 75 14             	push   0x14(%ebp)
+ 939:	ff 75 10             	push   0x10(%ebp)
+ 93c:	e8 88 ff ff ff       	call   8c9 <ticks>
+ 941:	83 c4 08             	add    $0x8,%esp
+ 944:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 94a:	99                   	cltd
+ 94b:	f7 7d 08             	idivl  0x8(%ebp)
+ 94e:	89 c2                	mov    %eax,%edx
+ 950:	8b 45 14             	mov    0x14(%ebp),%eax
+ 953:	2b 45 10             	sub    0x10(%ebp),%eax
+ 956:	83 ec 08             	sub    $0x8,%esp
+ 959:	52                   	push   %edx
+ 95a:	50                   	push   %eax
+ 95b:	ff 75 0c             	push   0xc(%ebp)
+ 95e:	ff 75 08             	push   0x8(%ebp)
+ 961:	68 c4 09 00 00       	push   $0x9c4
+ 966:	6a 01                	push   $0x1
+ 968:	e8 a5 fb ff ff       	call   512 <printf>
+ 96d:	83 c4 20             	add    $0x20,%esp
+}
+ 970:	90                   	nop
+ 971:	c9                   	leave
+ 972:	c3                   	ret
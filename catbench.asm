@@ -0,0 +1,1467 @@
+
+_catbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <name>:
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  strcpy(s, "catbench.0");
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 c4 0a 00 00       	push   $0xac4
+   e:	ff 75 08             	push   0x8(%ebp)
+  11:	e8 6f 02 00 00       	call   285 <strcpy>
+  16:	83 c4 10             	add    $0x10,%esp
+  s[9] = '0' + i;
+  19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1c:	8d 50 30             	lea    0x30(%eax),%edx
+  1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  22:	83 c0 09             	add    $0x9,%eax
+  25:	88 10                	mov    %dl,(%eax)
+}
+  27:	90                   	nop
+  28:	c9                   	leave
+  29:	c3                   	ret
+
+0000002a <worker>:
+
+void
+worker(int i)
+{
+  2a:	55                   	push   %ebp
+  2b:	89 e5                	mov    %esp,%ebp
+  2d:	83 ec 28             	sub    $0x28,%esp
+  char path[16];
+  int fd, n, r;
+
+  name(path, i);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 75 08             	push   0x8(%ebp)
+  36:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  39:	50                   	push   %eax
+  3a:	e8 c1 ff ff ff       	call   0 <name>
+  3f:	83 c4 10             	add    $0x10,%esp
+  for(r = 0; r < NROUND; r++){
+  42:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  49:	eb 69                	jmp    b4 <worker+0x8a>
+    if((fd = open(path, O_RDONLY)) < 0){
+  4b:	83 ec 08             	sub    $0x8,%esp
+  4e:	6a 00                	push   $0x0
+  50:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  53:	50                   	push   %eax
+  54:	e8 9d 04 00 00       	call   4f6 <open>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  5f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  63:	79 1b                	jns    80 <worker+0x56>
+      printf(1, "catbench: cannot open %s\n", path);
+  65:	83 ec 04             	sub    $0x4,%esp
+  68:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  6b:	50                   	push   %eax
+  6c:	68 cf 0a 00 00       	push   $0xacf
+  71:	6a 01                	push   $0x1
+  73:	e8 ea 05 00 00       	call   662 <printf>
+  78:	83 c4 10             	add    $0x10,%esp
+      exit();
+  7b:	e8 36 04 00 00       	call   4b6 <exit>
+    }
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+  80:	90                   	nop
+  81:	83 ec 04             	sub    $0x4,%esp
+  84:	68 00 02 00 00       	push   $0x200
+  89:	68 80 0e 00 00       	push   $0xe80
+  8e:	ff 75 f0             	push   -0x10(%ebp)
+  91:	e8 38 04 00 00       	call   4ce <read>
+  96:	83 c4 10             	add    $0x10,%esp
+  99:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  a0:	7f df                	jg     81 <worker+0x57>
+      ;
+    close(fd);
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	ff 75 f0             	push   -0x10(%ebp)
+  a8:	e8 31 04 00 00       	call   4de <close>
+  ad:	83 c4 10             	add    $0x10,%esp
+  for(r = 0; r < NROUND; r++){
+  b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  b4:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+  bb:	7e 8e                	jle    4b <worker+0x21>
+  }
+  exit();
+  bd:	e8 f4 03 00 00       	call   4b6 <exit>
+
+000000c2 <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  c2:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  c6:	83 e4 f0             	and    $0xfffffff0,%esp
+  c9:	ff 71 fc             	push   -0x4(%ecx)
+  cc:	55                   	push   %ebp
+  cd:	89 e5                	mov    %esp,%ebp
+  cf:	51                   	push   %ecx
+  d0:	83 ec 34             	sub    $0x34,%esp
+  char path[16];
+  int i, fd, t0, t1, nfile;
+
+  printf(1, "catbench starting\n");
+  d3:	83 ec 08             	sub    $0x8,%esp
+  d6:	68 e9 0a 00 00       	push   $0xae9
+  db:	6a 01                	push   $0x1
+  dd:	e8 80 05 00 00       	call   662 <printf>
+  e2:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 'x', sizeof(buf));
+  e5:	83 ec 04             	sub    $0x4,%esp
+  e8:	68 00 02 00 00       	push   $0x200
+  ed:	6a 78                	push   $0x78
+  ef:	68 80 0e 00 00       	push   $0xe80
+  f4:	e8 22 02 00 00       	call   31b <memset>
+  f9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWORKER; i++){
+  fc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 103:	e9 91 00 00 00       	jmp    199 <main+0xd7>
+    name(path, i);
+ 108:	83 ec 08             	sub    $0x8,%esp
+ 10b:	ff 75 f4             	push   -0xc(%ebp)
+ 10e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 111:	50                   	push   %eax
+ 112:	e8 e9 fe ff ff       	call   0 <name>
+ 117:	83 c4 10             	add    $0x10,%esp
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+ 11a:	83 ec 08             	sub    $0x8,%esp
+ 11d:	68 02 02 00 00       	push   $0x202
+ 122:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 125:	50                   	push   %eax
+ 126:	e8 cb 03 00 00       	call   4f6 <open>
+ 12b:	83 c4 10             	add    $0x10,%esp
+ 12e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 131:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 135:	79 1b                	jns    152 <main+0x90>
+      printf(1, "catbench: cannot create %s\n", path);
+ 137:	83 ec 04             	sub    $0x4,%esp
+ 13a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 13d:	50                   	push   %eax
+ 13e:	68 fc 0a 00 00       	push   $0xafc
+ 143:	6a 01                	push   $0x1
+ 145:	e8 18 05 00 00       	call   662 <printf>
+ 14a:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 14d:	e8 64 03 00 00       	call   4b6 <exit>
+    }
+    for(nfile = 0; nfile < FILESIZE; nfile += sizeof(buf))
+ 152:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 159:	eb 23                	jmp    17e <main+0xbc>
+      write(fd, buf, sizeof(buf));
+ 15b:	83 ec 04             	sub    $0x4,%esp
+ 15e:	68 00 02 00 00       	push   $0x200
+ 163:	68 80 0e 00 00       	push   $0xe80
+ 168:	ff 75 e4             	push   -0x1c(%ebp)
+ 16b:	e8 66 03 00 00       	call   4d6 <write>
+ 170:	83 c4 10             	add    $0x10,%esp
+    for(nfile = 0; nfile < FILESIZE; nfile += sizeof(buf))
+ 173:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 176:	05 00 02 00 00       	add    $0x200,%eax
+ 17b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 17e:	81 7d f0 ff 03 00 00 	cmpl   $0x3ff,-0x10(%ebp)
+ 185:	7e d4                	jle    15b <main+0x99>
+    close(fd);
+ 187:	83 ec 0c             	sub    $0xc,%esp
+ 18a:	ff 75 e4             	push   -0x1c(%ebp)
+ 18d:	e8 4c 03 00 00       	call   4de <close>
+ 192:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWORKER; i++){
+ 195:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 199:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 19d:	0f 8e 65 ff ff ff    	jle    108 <main+0x46>
+  }
+
+  t0 = uptime();
+ 1a3:	e8 a6 03 00 00       	call   54e <uptime>
+ 1a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < NWORKER; i++){
+ 1ab:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1b2:	eb 1b                	jmp    1cf <main+0x10d>
+    if(fork() == 0)
+ 1b4:	e8 f5 02 00 00       	call   4ae <fork>
+ 1b9:	85 c0                	test   %eax,%eax
+ 1bb:	75 0e                	jne    1cb <main+0x109>
+      worker(i);
+ 1bd:	83 ec 0c             	sub    $0xc,%esp
+ 1c0:	ff 75 f4             	push   -0xc(%ebp)
+ 1c3:	e8 62 fe ff ff       	call   2a <worker>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWORKER; i++){
+ 1cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1cf:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 1d3:	7e df                	jle    1b4 <main+0xf2>
+  }
+  for(i = 0; i < NWORKER; i++)
+ 1d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1dc:	eb 09                	jmp    1e7 <main+0x125>
+    wait();
+ 1de:	e8 db 02 00 00       	call   4be <wait>
+  for(i = 0; i < NWORKER; i++)
+ 1e3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1e7:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 1eb:	7e f1                	jle    1de <main+0x11c>
+  t1 = uptime();
+ 1ed:	e8 5c 03 00 00       	call   54e <uptime>
+ 1f2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+
+  for(i = 0; i < NWORKER; i++){
+ 1f5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1fc:	eb 25                	jmp    223 <main+0x161>
+    name(path, i);
+ 1fe:	83 ec 08             	sub    $0x8,%esp
+ 201:	ff 75 f4             	push   -0xc(%ebp)
+ 204:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 207:	50                   	push   %eax
+ 208:	e8 f3 fd ff ff       	call   0 <name>
+ 20d:	83 c4 10             	add    $0x10,%esp
+    unlink(path);
+ 210:	83 ec 0c             	sub    $0xc,%esp
+ 213:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 216:	50                   	push   %eax
+ 217:	e8 ea 02 00 00       	call   506 <unlink>
+ 21c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWORKER; i++){
+ 21f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 223:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 227:	7e d5                	jle    1fe <main+0x13c>
+  }
+
+  nfile = NWORKER * NROUND;
+ 229:	c7 45 f0 a0 0f 00 00 	movl   $0xfa0,-0x10(%ebp)
+  printf(1, "%d workers: ", NWORKER);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	6a 08                	push   $0x8
+ 235:	68 18 0b 00 00       	push   $0xb18
+ 23a:	6a 01                	push   $0x1
+ 23c:	e8 21 04 00 00       	call   662 <printf>
+ 241:	83 c4 10             	add    $0x10,%esp
+  benchrate(nfile, "files", t0, t1);
+ 244:	ff 75 e8             	push   -0x18(%ebp)
+ 247:	ff 75 ec             	push   -0x14(%ebp)
+ 24a:	68 25 0b 00 00       	push   $0xb25
+ 24f:	ff 75 f0             	push   -0x10(%ebp)
+ 252:	e8 dc 07 00 00       	call   a33 <benchrate>
+ 257:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 25a:	e8 57 02 00 00       	call   4b6 <exit>
+
+0000025f <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 25f:	55                   	push   %ebp
+ 260:	89 e5                	mov    %esp,%ebp
+ 262:	57                   	push   %edi
+ 263:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 264:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 267:	8b 55 10             	mov    0x10(%ebp),%edx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 cb                	mov    %ecx,%ebx
+ 26f:	89 df                	mov    %ebx,%edi
+ 271:	89 d1                	mov    %edx,%ecx
+ 273:	fc                   	cld
+ 274:	f3 aa                	rep stos %al,%es:(%edi)
+ 276:	89 ca                	mov    %ecx,%edx
+ 278:	89 fb                	mov    %edi,%ebx
+ 27a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 27d:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 280:	90                   	nop
+ 281:	5b                   	pop    %ebx
+ 282:	5f                   	pop    %edi
+ 283:	5d                   	pop    %ebp
+ 284:	c3                   	ret
+
+00000285 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 285:	55                   	push   %ebp
+ 286:	89 e5                	mov    %esp,%ebp
+ 288:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 28b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 291:	90                   	nop
+ 292:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 295:	8d 42 01             	lea    0x1(%edx),%eax
+ 298:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 29b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a1:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2a4:	0f b6 12             	movzbl (%edx),%edx
+ 2a7:	88 10                	mov    %dl,(%eax)
+ 2a9:	0f b6 00             	movzbl (%eax),%eax
+ 2ac:	84 c0                	test   %al,%al
+ 2ae:	75 e2                	jne    292 <strcpy+0xd>
+    ;
+  return os;
+ 2b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2b3:	c9                   	leave
+ 2b4:	c3                   	ret
+
+000002b5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2b8:	eb 08                	jmp    2c2 <strcmp+0xd>
+    p++, q++;
+ 2ba:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2be:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	0f b6 00             	movzbl (%eax),%eax
+ 2c8:	84 c0                	test   %al,%al
+ 2ca:	74 10                	je     2dc <strcmp+0x27>
+ 2cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cf:	0f b6 10             	movzbl (%eax),%edx
+ 2d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d5:	0f b6 00             	movzbl (%eax),%eax
+ 2d8:	38 c2                	cmp    %al,%dl
+ 2da:	74 de                	je     2ba <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2df:	0f b6 00             	movzbl (%eax),%eax
+ 2e2:	0f b6 d0             	movzbl %al,%edx
+ 2e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e8:	0f b6 00             	movzbl (%eax),%eax
+ 2eb:	0f b6 c0             	movzbl %al,%eax
+ 2ee:	29 c2                	sub    %eax,%edx
+ 2f0:	89 d0                	mov    %edx,%eax
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	c3                   	ret
+
+000002f4 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2f4:	55                   	push   %ebp
+ 2f5:	89 e5                	mov    %esp,%ebp
+ 2f7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2fa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 301:	eb 04                	jmp    307 <strlen+0x13>
+ 303:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 307:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 30a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30d:	01 d0                	add    %edx,%eax
+ 30f:	0f b6 00             	movzbl (%eax),%eax
+ 312:	84 c0                	test   %al,%al
+ 314:	75 ed                	jne    303 <strlen+0xf>
+    ;
+  return n;
+ 316:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 319:	c9                   	leave
+ 31a:	c3                   	ret
+
+0000031b <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 31b:	55                   	push   %ebp
+ 31c:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 31e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 321:	50                   	push   %eax
+ 322:	ff 75 0c             	push   0xc(%ebp)
+ 325:	ff 75 08             	push   0x8(%ebp)
+ 328:	e8 32 ff ff ff       	call   25f <stosb>
+ 32d:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 04             	sub    $0x4,%esp
+ 33b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33e:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 341:	eb 14                	jmp    357 <strchr+0x22>
+    if(*s == c)
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	0f b6 00             	movzbl (%eax),%eax
+ 349:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 34c:	75 05                	jne    353 <strchr+0x1e>
+      return (char*)s;
+ 34e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 351:	eb 13                	jmp    366 <strchr+0x31>
+  for(; *s; s++)
+ 353:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35a:	0f b6 00             	movzbl (%eax),%eax
+ 35d:	84 c0                	test   %al,%al
+ 35f:	75 e2                	jne    343 <strchr+0xe>
+  return 0;
+ 361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 366:	c9                   	leave
+ 367:	c3                   	ret
+
+00000368 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 368:	55                   	push   %ebp
+ 369:	89 e5                	mov    %esp,%ebp
+ 36b:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 36e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 375:	eb 42                	jmp    3b9 <gets+0x51>
+    cc = read(0, &c, 1);
+ 377:	83 ec 04             	sub    $0x4,%esp
+ 37a:	6a 01                	push   $0x1
+ 37c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 37f:	50                   	push   %eax
+ 380:	6a 00                	push   $0x0
+ 382:	e8 47 01 00 00       	call   4ce <read>
+ 387:	83 c4 10             	add    $0x10,%esp
+ 38a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 38d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 391:	7e 33                	jle    3c6 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 393:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 396:	8d 50 01             	lea    0x1(%eax),%edx
+ 399:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 39c:	89 c2                	mov    %eax,%edx
+ 39e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a1:	01 c2                	add    %eax,%edx
+ 3a3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3a7:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3ad:	3c 0a                	cmp    $0xa,%al
+ 3af:	74 16                	je     3c7 <gets+0x5f>
+ 3b1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3b5:	3c 0d                	cmp    $0xd,%al
+ 3b7:	74 0e                	je     3c7 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3bc:	83 c0 01             	add    $0x1,%eax
+ 3bf:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3c2:	7f b3                	jg     377 <gets+0xf>
+ 3c4:	eb 01                	jmp    3c7 <gets+0x5f>
+      break;
+ 3c6:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cd:	01 d0                	add    %edx,%eax
+ 3cf:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3d2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3d5:	c9                   	leave
+ 3d6:	c3                   	ret
+
+000003d7 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3d7:	55                   	push   %ebp
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3dd:	83 ec 08             	sub    $0x8,%esp
+ 3e0:	6a 00                	push   $0x0
+ 3e2:	ff 75 08             	push   0x8(%ebp)
+ 3e5:	e8 0c 01 00 00       	call   4f6 <open>
+ 3ea:	83 c4 10             	add    $0x10,%esp
+ 3ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3f4:	79 07                	jns    3fd <stat+0x26>
+    return -1;
+ 3f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3fb:	eb 25                	jmp    422 <stat+0x4b>
+  r = fstat(fd, st);
+ 3fd:	83 ec 08             	sub    $0x8,%esp
+ 400:	ff 75 0c             	push   0xc(%ebp)
+ 403:	ff 75 f4             	push   -0xc(%ebp)
+ 406:	e8 03 01 00 00       	call   50e <fstat>
+ 40b:	83 c4 10             	add    $0x10,%esp
+ 40e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 411:	83 ec 0c             	sub    $0xc,%esp
+ 414:	ff 75 f4             	push   -0xc(%ebp)
+ 417:	e8 c2 00 00 00       	call   4de <close>
+ 41c:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 41f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 422:	c9                   	leave
+ 423:	c3                   	ret
+
+00000424 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 424:	55                   	push   %ebp
+ 425:	89 e5                	mov    %esp,%ebp
+ 427:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 42a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 431:	eb 25                	jmp    458 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 433:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	c1 e0 02             	shl    $0x2,%eax
+ 43b:	01 d0                	add    %edx,%eax
+ 43d:	01 c0                	add    %eax,%eax
+ 43f:	89 c1                	mov    %eax,%ecx
+ 441:	8b 45 08             	mov    0x8(%ebp),%eax
+ 444:	8d 50 01             	lea    0x1(%eax),%edx
+ 447:	89 55 08             	mov    %edx,0x8(%ebp)
+ 44a:	0f b6 00             	movzbl (%eax),%eax
+ 44d:	0f be c0             	movsbl %al,%eax
+ 450:	01 c8                	add    %ecx,%eax
+ 452:	83 e8 30             	sub    $0x30,%eax
+ 455:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 458:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45b:	0f b6 00             	movzbl (%eax),%eax
+ 45e:	3c 2f                	cmp    $0x2f,%al
+ 460:	7e 0a                	jle    46c <atoi+0x48>
+ 462:	8b 45 08             	mov    0x8(%ebp),%eax
+ 465:	0f b6 00             	movzbl (%eax),%eax
+ 468:	3c 39                	cmp    $0x39,%al
+ 46a:	7e c7                	jle    433 <atoi+0xf>
+  return n;
+ 46c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 46f:	c9                   	leave
+ 470:	c3                   	ret
+
+00000471 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 471:	55                   	push   %ebp
+ 472:	89 e5                	mov    %esp,%ebp
+ 474:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 477:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 47d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 480:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 483:	eb 17                	jmp    49c <memmove+0x2b>
+    *dst++ = *src++;
+ 485:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 488:	8d 42 01             	lea    0x1(%edx),%eax
+ 48b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 48e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 491:	8d 48 01             	lea    0x1(%eax),%ecx
+ 494:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 497:	0f b6 12             	movzbl (%edx),%edx
+ 49a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 49c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 49f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4a2:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	7f dc                	jg     485 <memmove+0x14>
+  return vdst;
+ 4a9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ac:	c9                   	leave
+ 4ad:	c3                   	ret
+
+000004ae <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4ae:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <exit>:
+SYSCALL(exit)
+ 4b6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <wait>:
+SYSCALL(wait)
+ 4be:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c3:	cd 40                	int    $0x40
+ 4c5:	c3                   	ret
+
+000004c6 <pipe>:
+SYSCALL(pipe)
+ 4c6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4cb:	cd 40                	int    $0x40
+ 4cd:	c3                   	ret
+
+000004ce <read>:
+SYSCALL(read)
+ 4ce:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d3:	cd 40                	int    $0x40
+ 4d5:	c3                   	ret
+
+000004d6 <write>:
+SYSCALL(write)
+ 4d6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4db:	cd 40                	int    $0x40
+ 4dd:	c3                   	ret
+
+000004de <close>:
+SYSCALL(close)
+ 4de:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4e3:	cd 40                	int    $0x40
+ 4e5:	c3                   	ret
+
+000004e6 <kill>:
+SYSCALL(kill)
+ 4e6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <exec>:
+SYSCALL(exec)
+ 4ee:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4f3:	cd 40                	int    $0x40
+ 4f5:	c3                   	ret
+
+000004f6 <open>:
+SYSCALL(open)
+ 4f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4fb:	cd 40                	int    $0x40
+ 4fd:	c3                   	ret
+
+000004fe <mknod>:
+SYSCALL(mknod)
+ 4fe:	b8 11 00 00 00       	mov    $0x11,%eax
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <unlink>:
+SYSCALL(unlink)
+ 506:	b8 12 00 00 00       	mov    $0x12,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <fstat>:
+SYSCALL(fstat)
+ 50e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <link>:
+SYSCALL(link)
+ 516:	b8 13 00 00 00       	mov    $0x13,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <mkdir>:
+SYSCALL(mkdir)
+ 51e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <chdir>:
+SYSCALL(chdir)
+ 526:	b8 09 00 00 00       	mov    $0x9,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <dup>:
+SYSCALL(dup)
+ 52e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <getpid>:
+SYSCALL(getpid)
+ 536:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <sbrk>:
+SYSCALL(sbrk)
+ 53e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <sleep>:
+SYSCALL(sleep)
+ 546:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <uptime>:
+SYSCALL(uptime)
+ 54e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 556:	b8 16 00 00 00       	mov    $0x16,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <getschedstat>:
+SYSCALL(getschedstat)
+ 55e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 566:	b8 18 00 00 00       	mov    $0x18,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <setshare>:
+SYSCALL(setshare)
+ 56e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 576:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <getdiskstat>:
+SYSCALL(getdiskstat)
+ 57e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <getlogstat>:
+SYSCALL(getlogstat)
+ 586:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 58e:	55                   	push   %ebp
+ 58f:	89 e5                	mov    %esp,%ebp
+ 591:	83 ec 18             	sub    $0x18,%esp
+ 594:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 597:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 59a:	83 ec 04             	sub    $0x4,%esp
+ 59d:	6a 01                	push   $0x1
+ 59f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5a2:	50                   	push   %eax
+ 5a3:	ff 75 08             	push   0x8(%ebp)
+ 5a6:	e8 2b ff ff ff       	call   4d6 <write>
+ 5ab:	83 c4 10             	add    $0x10,%esp
+}
+ 5ae:	90                   	nop
+ 5af:	c9                   	leave
+ 5b0:	c3                   	ret
+
+000005b1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b1:	55                   	push   %ebp
+ 5b2:	89 e5                	mov    %esp,%ebp
+ 5b4:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5b7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5be:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5c2:	74 17                	je     5db <printint+0x2a>
+ 5c4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5c8:	79 11                	jns    5db <printint+0x2a>
+    neg = 1;
+ 5ca:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5d4:	f7 d8                	neg    %eax
+ 5d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5d9:	eb 06                	jmp    5e1 <printint+0x30>
+  } else {
+    x = xx;
+ 5db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5de:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5e8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5eb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5ee:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5f3:	f7 f1                	div    %ecx
+ 5f5:	89 d1                	mov    %edx,%ecx
+ 5f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5fa:	8d 50 01             	lea    0x1(%eax),%edx
+ 5fd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 600:	0f b6 91 58 0e 00 00 	movzbl 0xe58(%ecx),%edx
+ 607:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 60b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 60e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 611:	ba 00 00 00 00       	mov    $0x0,%edx
+ 616:	f7 f1                	div    %ecx
+ 618:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 61b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 61f:	75 c7                	jne    5e8 <printint+0x37>
+  if(neg)
+ 621:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 625:	74 2d                	je     654 <printint+0xa3>
+    buf[i++] = '-';
+ 627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62a:	8d 50 01             	lea    0x1(%eax),%edx
+ 62d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 630:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 635:	eb 1d                	jmp    654 <printint+0xa3>
+    putc(fd, buf[i]);
+ 637:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 63a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63d:	01 d0                	add    %edx,%eax
+ 63f:	0f b6 00             	movzbl (%eax),%eax
+ 642:	0f be c0             	movsbl %al,%eax
+ 645:	83 ec 08             	sub    $0x8,%esp
+ 648:	50                   	push   %eax
+ 649:	ff 75 08             	push   0x8(%ebp)
+ 64c:	e8 3d ff ff ff       	call   58e <putc>
+ 651:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 654:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 658:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 65c:	79 d9                	jns    637 <printint+0x86>
+}
+ 65e:	90                   	nop
+ 65f:	90                   	nop
+ 660:	c9                   	leave
+ 661:	c3                   	ret
+
+00000662 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 662:	55                   	push   %ebp
+ 663:	89 e5                	mov    %esp,%ebp
+ 665:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 668:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 66f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 672:	83 c0 04             	add    $0x4,%eax
+ 675:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 678:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 67f:	e9 59 01 00 00       	jmp    7dd <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 684:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 687:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 68a:	01 d0                	add    %edx,%eax
+ 68c:	0f b6 00             	movzbl (%eax),%eax
+ 68f:	0f be c0             	movsbl %al,%eax
+ 692:	25 ff 00 00 00       	and    $0xff,%eax
+ 697:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 69a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 69e:	75 2c                	jne    6cc <printf+0x6a>
+      if(c == '%'){
+ 6a0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6a4:	75 0c                	jne    6b2 <printf+0x50>
+        state = '%';
+ 6a6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6ad:	e9 27 01 00 00       	jmp    7d9 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6b5:	0f be c0             	movsbl %al,%eax
+ 6b8:	83 ec 08             	sub    $0x8,%esp
+ 6bb:	50                   	push   %eax
+ 6bc:	ff 75 08             	push   0x8(%ebp)
+ 6bf:	e8 ca fe ff ff       	call   58e <putc>
+ 6c4:	83 c4 10             	add    $0x10,%esp
+ 6c7:	e9 0d 01 00 00       	jmp    7d9 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6cc:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6d0:	0f 85 03 01 00 00    	jne    7d9 <printf+0x177>
+      if(c == 'd'){
+ 6d6:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6da:	75 1e                	jne    6fa <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6dc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6df:	8b 00                	mov    (%eax),%eax
+ 6e1:	6a 01                	push   $0x1
+ 6e3:	6a 0a                	push   $0xa
+ 6e5:	50                   	push   %eax
+ 6e6:	ff 75 08             	push   0x8(%ebp)
+ 6e9:	e8 c3 fe ff ff       	call   5b1 <printint>
+ 6ee:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6f1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6f5:	e9 d8 00 00 00       	jmp    7d2 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6fa:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6fe:	74 06                	je     706 <printf+0xa4>
+ 700:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 704:	75 1e                	jne    724 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 706:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 709:	8b 00                	mov    (%eax),%eax
+ 70b:	6a 00                	push   $0x0
+ 70d:	6a 10                	push   $0x10
+ 70f:	50                   	push   %eax
+ 710:	ff 75 08             	push   0x8(%ebp)
+ 713:	e8 99 fe ff ff       	call   5b1 <printint>
+ 718:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 71b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 71f:	e9 ae 00 00 00       	jmp    7d2 <printf+0x170>
+      } else if(c == 's'){
+ 724:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 728:	75 43                	jne    76d <printf+0x10b>
+        s = (char*)*ap;
+ 72a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 72d:	8b 00                	mov    (%eax),%eax
+ 72f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 732:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 736:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 73a:	75 25                	jne    761 <printf+0xff>
+          s = "(null)";
+ 73c:	c7 45 f4 2b 0b 00 00 	movl   $0xb2b,-0xc(%ebp)
+        while(*s != 0){
+ 743:	eb 1c                	jmp    761 <printf+0xff>
+          putc(fd, *s);
+ 745:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 748:	0f b6 00             	movzbl (%eax),%eax
+ 74b:	0f be c0             	movsbl %al,%eax
+ 74e:	83 ec 08             	sub    $0x8,%esp
+ 751:	50                   	push   %eax
+ 752:	ff 75 08             	push   0x8(%ebp)
+ 755:	e8 34 fe ff ff       	call   58e <putc>
+ 75a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 75d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 764:	0f b6 00             	movzbl (%eax),%eax
+ 767:	84 c0                	test   %al,%al
+ 769:	75 da                	jne    745 <printf+0xe3>
+ 76b:	eb 65                	jmp    7d2 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 76d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 771:	75 1d                	jne    790 <printf+0x12e>
+        putc(fd, *ap);
+ 773:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 776:	8b 00                	mov    (%eax),%eax
+ 778:	0f be c0             	movsbl %al,%eax
+ 77b:	83 ec 08             	sub    $0x8,%esp
+ 77e:	50                   	push   %eax
+ 77f:	ff 75 08             	push   0x8(%ebp)
+ 782:	e8 07 fe ff ff       	call   58e <putc>
+ 787:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 78a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 78e:	eb 42                	jmp    7d2 <printf+0x170>
+      } else if(c == '%'){
+ 790:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 794:	75 17                	jne    7ad <printf+0x14b>
+        putc(fd, c);
+ 796:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 799:	0f be c0             	movsbl %al,%eax
+ 79c:	83 ec 08             	sub    $0x8,%esp
+ 79f:	50                   	push   %eax
+ 7a0:	ff 75 08             	push   0x8(%ebp)
+ 7a3:	e8 e6 fd ff ff       	call   58e <putc>
+ 7a8:	83 c4 10             	add    $0x10,%esp
+ 7ab:	eb 25                	jmp    7d2 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7ad:	83 ec 08             	sub    $0x8,%esp
+ 7b0:	6a 25                	push   $0x25
+ 7b2:	ff 75 08             	push   0x8(%ebp)
+ 7b5:	e8 d4 fd ff ff       	call   58e <putc>
+ 7ba:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7c0:	0f be c0             	movsbl %al,%eax
+ 7c3:	83 ec 08             	sub    $0x8,%esp
+ 7c6:	50                   	push   %eax
+ 7c7:	ff 75 08             	push   0x8(%ebp)
+ 7ca:	e8 bf fd ff ff       	call   58e <putc>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7d2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7d9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e3:	01 d0                	add    %edx,%eax
+ 7e5:	0f b6 00             	movzbl (%eax),%eax
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 85 94 fe ff ff    	jne    684 <printf+0x22>
+    }
+  }
+}
+ 7f0:	90                   	nop
+ 7f1:	90                   	nop
+ 7f2:	c9                   	leave
+ 7f3:	c3                   	ret
+
+000007f4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7f4:	55                   	push   %ebp
+ 7f5:	89 e5                	mov    %esp,%ebp
+ 7f7:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fd:	83 e8 08             	sub    $0x8,%eax
+ 800:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 803:	a1 88 10 00 00       	mov    0x1088,%eax
+ 808:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 80b:	eb 24                	jmp    831 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 80d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 810:	8b 00                	mov    (%eax),%eax
+ 812:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 815:	72 12                	jb     829 <free+0x35>
+ 817:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 81d:	72 24                	jb     843 <free+0x4f>
+ 81f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 822:	8b 00                	mov    (%eax),%eax
+ 824:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 827:	72 1a                	jb     843 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 829:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82c:	8b 00                	mov    (%eax),%eax
+ 82e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 831:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 834:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 837:	73 d4                	jae    80d <free+0x19>
+ 839:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83c:	8b 00                	mov    (%eax),%eax
+ 83e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 841:	73 ca                	jae    80d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 843:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 846:	8b 40 04             	mov    0x4(%eax),%eax
+ 849:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 850:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 853:	01 c2                	add    %eax,%edx
+ 855:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	39 c2                	cmp    %eax,%edx
+ 85c:	75 24                	jne    882 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 85e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 861:	8b 50 04             	mov    0x4(%eax),%edx
+ 864:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 867:	8b 00                	mov    (%eax),%eax
+ 869:	8b 40 04             	mov    0x4(%eax),%eax
+ 86c:	01 c2                	add    %eax,%edx
+ 86e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 871:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 874:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 877:	8b 00                	mov    (%eax),%eax
+ 879:	8b 10                	mov    (%eax),%edx
+ 87b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87e:	89 10                	mov    %edx,(%eax)
+ 880:	eb 0a                	jmp    88c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 882:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 885:	8b 10                	mov    (%eax),%edx
+ 887:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 88c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88f:	8b 40 04             	mov    0x4(%eax),%eax
+ 892:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 899:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89c:	01 d0                	add    %edx,%eax
+ 89e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8a1:	75 20                	jne    8c3 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a6:	8b 50 04             	mov    0x4(%eax),%edx
+ 8a9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ac:	8b 40 04             	mov    0x4(%eax),%eax
+ 8af:	01 c2                	add    %eax,%edx
+ 8b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ba:	8b 10                	mov    (%eax),%edx
+ 8bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8bf:	89 10                	mov    %edx,(%eax)
+ 8c1:	eb 08                	jmp    8cb <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 8c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8c9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ce:	a3 88 10 00 00       	mov    %eax,0x1088
+}
+ 8d3:	90                   	nop
+ 8d4:	c9                   	leave
+ 8d5:	c3                   	ret
+
+000008d6 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8d6:	55                   	push   %ebp
+ 8d7:	89 e5                	mov    %esp,%ebp
+ 8d9:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8dc:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8e3:	77 07                	ja     8ec <morecore+0x16>
+    nu = 4096;
+ 8e5:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ef:	c1 e0 03             	shl    $0x3,%eax
+ 8f2:	83 ec 0c             	sub    $0xc,%esp
+ 8f5:	50                   	push   %eax
+ 8f6:	e8 43 fc ff ff       	call   53e <sbrk>
+ 8fb:	83 c4 10             	add    $0x10,%esp
+ 8fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 901:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 905:	75 07                	jne    90e <morecore+0x38>
+    return 0;
+ 907:	b8 00 00 00 00       	mov    $0x0,%eax
+ 90c:	eb 26                	jmp    934 <morecore+0x5e>
+  hp = (Header*)p;
+ 90e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 911:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 914:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 917:	8b 55 08             	mov    0x8(%ebp),%edx
+ 91a:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 91d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 920:	83 c0 08             	add    $0x8,%eax
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	50                   	push   %eax
+ 927:	e8 c8 fe ff ff       	call   7f4 <free>
+ 92c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 92f:	a1 88 10 00 00       	mov    0x1088,%eax
+}
+ 934:	c9                   	leave
+ 935:	c3                   	ret
+
+00000936 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 936:	55                   	push   %ebp
+ 937:	89 e5                	mov    %esp,%ebp
+ 939:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 93c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 93f:	83 c0 07             	add    $0x7,%eax
+ 942:	c1 e8 03             	shr    $0x3,%eax
+ 945:	83 c0 01             	add    $0x1,%eax
+ 948:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 94b:	a1 88 10 00 00       	mov    0x1088,%eax
+ 950:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 953:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 957:	75 23                	jne    97c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 959:	c7 45 f0 80 10 00 00 	movl   $0x1080,-0x10(%ebp)
+ 960:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 963:	a3 88 10 00 00       	mov    %eax,0x1088
+ 968:	a1 88 10 00 00       	mov    0x1088,%eax
+ 96d:	a3 80 10 00 00       	mov    %eax,0x1080
+    base.s.size = 0;
+ 972:	c7 05 84 10 00 00 00 	movl   $0x0,0x1084
+ 979:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 97c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97f:	8b 00                	mov    (%eax),%eax
+ 981:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 984:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 987:	8b 40 04             	mov    0x4(%eax),%eax
+ 98a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 98d:	72 4d                	jb     9dc <malloc+0xa6>
+      if(p->s.size == nunits)
+ 98f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 992:	8b 40 04             	mov    0x4(%eax),%eax
+ 995:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 998:	75 0c                	jne    9a6 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 99a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99d:	8b 10                	mov    (%eax),%edx
+ 99f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a2:	89 10                	mov    %edx,(%eax)
+ 9a4:	eb 26                	jmp    9cc <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ac:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9af:	89 c2                	mov    %eax,%edx
+ 9b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ba:	8b 40 04             	mov    0x4(%eax),%eax
+ 9bd:	c1 e0 03             	shl    $0x3,%eax
+ 9c0:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 9c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9c9:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9cf:	a3 88 10 00 00       	mov    %eax,0x1088
+      return (void*)(p + 1);
+ 9d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d7:	83 c0 08             	add    $0x8,%eax
+ 9da:	eb 3b                	jmp    a17 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9dc:	a1 88 10 00 00       	mov    0x1088,%eax
+ 9e1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9e4:	75 1e                	jne    a04 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9e6:	83 ec 0c             	sub    $0xc,%esp
+ 9e9:	ff 75 ec             	push   -0x14(%ebp)
+ 9ec:	e8 e5 fe ff ff       	call   8d6 <morecore>
+ 9f1:	83 c4 10             	add    $0x10,%esp
+ 9f4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9f7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9fb:	75 07                	jne    a04 <malloc+0xce>
+        return 0;
+ 9fd:	b8 00 00 00 00       	mov    $0x0,%eax
+ a02:	eb 13                	jmp    a17 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a07:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0d:	8b 00                	mov    (%eax),%eax
+ a0f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a12:	e9 6d ff ff ff       	jmp    984 <malloc+0x4e>
+  }
+}
+ a17:	c9                   	leave
+ a18:	c3                   	ret
+
+00000a19 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ a19:	55                   	push   %ebp
+ a1a:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ a1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a1f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a22:	7e 08                	jle    a2c <ticks+0x13>
+ a24:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a27:	2b 45 08             	sub    0x8(%ebp),%eax
+ a2a:	eb 05                	jmp    a31 <ticks+0x18>
+ a2c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ a31:	5d                   	pop    %ebp
+ a32:	c3                   	ret
+
+00000a33 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ a33:	55                   	push   %ebp
+ a34:	89 e5                	mov    %esp,%ebp
+ a36:	53                   	push   %ebx
+ a37:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3d:	6b d8 64             	imul   $0x64,%eax,%ebx
+ a40:	ff 75 14             	push   0x14(%ebp)
+ a43:	ff 75 10             	push   0x10(%ebp)
+ a46:	e8 ce ff ff ff       	call   a19 <ticks>
+ a4b:	83 c4 08             	add    $0x8,%esp
+ a4e:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ a50:	89 d8                	mov    %ebx,%eax
+ a52:	99                   	cltd
+ a53:	f7 f9                	idiv   %ecx
+ a55:	89 c2                	mov    %eax,%edx
+ a57:	8b 45 14             	mov    0x14(%ebp),%eax
+ a5a:	2b 45 10             	sub    0x10(%ebp),%eax
+ a5d:	83 ec 04             	sub    $0x4,%esp
+ a60:	ff 75 0c             	push   0xc(%ebp)
+ a63:	52                   	push   %edx
+ a64:	50                   	push   %eax
+ a65:	ff 75 0c             	push   0xc(%ebp)
+ a68:	ff 75 08             	push   0x8(%ebp)
+ a6b:	68 34 0b 00 00       	push   $0xb34
+ a70:	6a 01                	push   $0x1
+ a72:	e8 eb fb ff ff       	call   662 <printf>
+ a77:	83 c4 20             	add    $0x20,%esp
+}
+ a7a:	90                   	nop
+ a7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a7e:	c9                   	leave
+ a7f:	c3                   	ret
+
+00000a80 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ a86:	ff 75 14             	push   0x14(%ebp)
+ a89:	ff 75 10             	push   0x10(%ebp)
+ a8c:	e8 88 ff ff ff       	call   a19 <ticks>
+ a91:	83 c4 08             	add    $0x8,%esp
+ a94:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ a9a:	99                   	cltd
+ a9b:	f7 7d 08             	idivl  0x8(%ebp)
+ a9e:	89 c2                	mov    %eax,%edx
+ aa0:	8b 45 14             	mov    0x14(%ebp),%eax
+ aa3:	2b 45 10             	sub    0x10(%ebp),%eax
+ aa6:	83 ec 08             	sub    $0x8,%esp
+ aa9:	52                   	push   %edx
+ aaa:	50                   	push   %eax
+ aab:	ff 75 0c             	push   0xc(%ebp)
+ aae:	ff 75 08             	push   0x8(%ebp)
+ ab1:	68 54 0b 00 00       	push   $0xb54
+ ab6:	6a 01                	push   $0x1
+ ab8:	e8 a5 fb ff ff       	call   662 <printf>
+ abd:	83 c4 20             	add    $0x20,%esp
+}
+ ac0:	90                   	nop
+ ac1:	c9                   	leave
+ ac2:	c3                   	ret
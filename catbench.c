@@ -0,0 +1,84 @@
+// Parallel cat benchmark for the buffer cache.
+//
+// Each of NWORKER processes repeatedly opens its own small
+// file, reads it to the end the way cat does and closes it.
+// The files fit in the buffer cache, so after the first round
+// every read is a cache hit.  Reports files read per second;
+// comparing boots with CPUS=1 and CPUS=8 shows how well
+// concurrent lookups of different blocks scale.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NWORKER 8
+#define NROUND 500
+#define FILESIZE 1024
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+  strcpy(s, "catbench.0");
+  s[9] = '0' + i;
+}
+
+void
+worker(int i)
+{
+  char path[16];
+  int fd, n, r;
+
+  name(path, i);
+  for(r = 0; r < NROUND; r++){
+    if((fd = open(path, O_RDONLY)) < 0){
+      printf(1, "catbench: cannot open %s\n", path);
+      exit();
+    }
+    while((n = read(fd, buf, sizeof(buf))) > 0)
+      ;
+    close(fd);
+  }
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[16];
+  int i, fd, t0, t1, nfile;
+
+  printf(1, "catbench starting\n");
+  memset(buf, 'x', sizeof(buf));
+  for(i = 0; i < NWORKER; i++){
+    name(path, i);
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+      printf(1, "catbench: cannot create %s\n", path);
+      exit();
+    }
+    for(nfile = 0; nfile < FILESIZE; nfile += sizeof(buf))
+      write(fd, buf, sizeof(buf));
+    close(fd);
+  }
+
+  t0 = uptime();
+  for(i = 0; i < NWORKER; i++){
+    if(fork() == 0)
+      worker(i);
+  }
+  for(i = 0; i < NWORKER; i++)
+    wait();
+  t1 = uptime();
+
+  for(i = 0; i < NWORKER; i++){
+    name(path, i);
+    unlink(path);
+  }
+
+  nfile = NWORKER * NROUND;
+  printf(1, "%d workers: ", NWORKER);
+  benchrate(nfile, "files", t0, t1);
+  exit();
+}
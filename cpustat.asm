@@ -0,0 +1,1270 @@
+
+_cpustat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "schedstat.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 2c             	sub    $0x2c,%esp
+  int i;
+  struct schedstat st;
+
+  printf(1, "cpu switches steals failed idle runnable\n");
+  13:	83 ec 08             	sub    $0x8,%esp
+  16:	68 d8 08 00 00       	push   $0x8d8
+  1b:	6a 01                	push   $0x1
+  1d:	e8 54 04 00 00       	call   476 <printf>
+  22:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+  25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  2c:	eb 2a                	jmp    58 <main+0x58>
+    printf(1, "%d %d %d %d %d %d\n", i, st.nswitch, st.nsteal,
+  2e:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  31:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  34:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  3a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  3d:	56                   	push   %esi
+  3e:	53                   	push   %ebx
+  3f:	51                   	push   %ecx
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	ff 75 e4             	push   -0x1c(%ebp)
+  45:	68 02 09 00 00       	push   $0x902
+  4a:	6a 01                	push   $0x1
+  4c:	e8 25 04 00 00       	call   476 <printf>
+  51:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+  54:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  5e:	50                   	push   %eax
+  5f:	ff 75 e4             	push   -0x1c(%ebp)
+  62:	e8 0b 03 00 00       	call   372 <getschedstat>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	85 c0                	test   %eax,%eax
+  6c:	74 c0                	je     2e <main+0x2e>
+           st.nstealfail, st.idleticks, st.nrunnable);
+  exit();
+  6e:	e8 57 02 00 00       	call   2ca <exit>
+
+00000073 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  73:	55                   	push   %ebp
+  74:	89 e5                	mov    %esp,%ebp
+  76:	57                   	push   %edi
+  77:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7b:	8b 55 10             	mov    0x10(%ebp),%edx
+  7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  81:	89 cb                	mov    %ecx,%ebx
+  83:	89 df                	mov    %ebx,%edi
+  85:	89 d1                	mov    %edx,%ecx
+  87:	fc                   	cld
+  88:	f3 aa                	rep stos %al,%es:(%edi)
+  8a:	89 ca                	mov    %ecx,%edx
+  8c:	89 fb                	mov    %edi,%ebx
+  8e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  91:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  94:	90                   	nop
+  95:	5b                   	pop    %ebx
+  96:	5f                   	pop    %edi
+  97:	5d                   	pop    %ebp
+  98:	c3                   	ret
+
+00000099 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  99:	55                   	push   %ebp
+  9a:	89 e5                	mov    %esp,%ebp
+  9c:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  a2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a5:	90                   	nop
+  a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a9:	8d 42 01             	lea    0x1(%edx),%eax
+  ac:	89 45 0c             	mov    %eax,0xc(%ebp)
+  af:	8b 45 08             	mov    0x8(%ebp),%eax
+  b2:	8d 48 01             	lea    0x1(%eax),%ecx
+  b5:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b8:	0f b6 12             	movzbl (%edx),%edx
+  bb:	88 10                	mov    %dl,(%eax)
+  bd:	0f b6 00             	movzbl (%eax),%eax
+  c0:	84 c0                	test   %al,%al
+  c2:	75 e2                	jne    a6 <strcpy+0xd>
+    ;
+  return os;
+  c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c7:	c9                   	leave
+  c8:	c3                   	ret
+
+000000c9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c9:	55                   	push   %ebp
+  ca:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cc:	eb 08                	jmp    d6 <strcmp+0xd>
+    p++, q++;
+  ce:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d2:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  d9:	0f b6 00             	movzbl (%eax),%eax
+  dc:	84 c0                	test   %al,%al
+  de:	74 10                	je     f0 <strcmp+0x27>
+  e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  e3:	0f b6 10             	movzbl (%eax),%edx
+  e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e9:	0f b6 00             	movzbl (%eax),%eax
+  ec:	38 c2                	cmp    %al,%dl
+  ee:	74 de                	je     ce <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  f3:	0f b6 00             	movzbl (%eax),%eax
+  f6:	0f b6 d0             	movzbl %al,%edx
+  f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fc:	0f b6 00             	movzbl (%eax),%eax
+  ff:	0f b6 c0             	movzbl %al,%eax
+ 102:	29 c2                	sub    %eax,%edx
+ 104:	89 d0                	mov    %edx,%eax
+}
+ 106:	5d                   	pop    %ebp
+ 107:	c3                   	ret
+
+00000108 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 10e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 115:	eb 04                	jmp    11b <strlen+0x13>
+ 117:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 121:	01 d0                	add    %edx,%eax
+ 123:	0f b6 00             	movzbl (%eax),%eax
+ 126:	84 c0                	test   %al,%al
+ 128:	75 ed                	jne    117 <strlen+0xf>
+    ;
+  return n;
+ 12a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12d:	c9                   	leave
+ 12e:	c3                   	ret
+
+0000012f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 12f:	55                   	push   %ebp
+ 130:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 132:	8b 45 10             	mov    0x10(%ebp),%eax
+ 135:	50                   	push   %eax
+ 136:	ff 75 0c             	push   0xc(%ebp)
+ 139:	ff 75 08             	push   0x8(%ebp)
+ 13c:	e8 32 ff ff ff       	call   73 <stosb>
+ 141:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 144:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+
+00000149 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 149:	55                   	push   %ebp
+ 14a:	89 e5                	mov    %esp,%ebp
+ 14c:	83 ec 04             	sub    $0x4,%esp
+ 14f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 152:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 155:	eb 14                	jmp    16b <strchr+0x22>
+    if(*s == c)
+ 157:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15a:	0f b6 00             	movzbl (%eax),%eax
+ 15d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 160:	75 05                	jne    167 <strchr+0x1e>
+      return (char*)s;
+ 162:	8b 45 08             	mov    0x8(%ebp),%eax
+ 165:	eb 13                	jmp    17a <strchr+0x31>
+  for(; *s; s++)
+ 167:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	0f b6 00             	movzbl (%eax),%eax
+ 171:	84 c0                	test   %al,%al
+ 173:	75 e2                	jne    157 <strchr+0xe>
+  return 0;
+ 175:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17a:	c9                   	leave
+ 17b:	c3                   	ret
+
+0000017c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17c:	55                   	push   %ebp
+ 17d:	89 e5                	mov    %esp,%ebp
+ 17f:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 182:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 189:	eb 42                	jmp    1cd <gets+0x51>
+    cc = read(0, &c, 1);
+ 18b:	83 ec 04             	sub    $0x4,%esp
+ 18e:	6a 01                	push   $0x1
+ 190:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 193:	50                   	push   %eax
+ 194:	6a 00                	push   $0x0
+ 196:	e8 47 01 00 00       	call   2e2 <read>
+ 19b:	83 c4 10             	add    $0x10,%esp
+ 19e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a5:	7e 33                	jle    1da <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1aa:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1b0:	89 c2                	mov    %eax,%edx
+ 1b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b5:	01 c2                	add    %eax,%edx
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bd:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c1:	3c 0a                	cmp    $0xa,%al
+ 1c3:	74 16                	je     1db <gets+0x5f>
+ 1c5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c9:	3c 0d                	cmp    $0xd,%al
+ 1cb:	74 0e                	je     1db <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d6:	7f b3                	jg     18b <gets+0xf>
+ 1d8:	eb 01                	jmp    1db <gets+0x5f>
+      break;
+ 1da:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1db:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e1:	01 d0                	add    %edx,%eax
+ 1e3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e9:	c9                   	leave
+ 1ea:	c3                   	ret
+
+000001eb <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f1:	83 ec 08             	sub    $0x8,%esp
+ 1f4:	6a 00                	push   $0x0
+ 1f6:	ff 75 08             	push   0x8(%ebp)
+ 1f9:	e8 0c 01 00 00       	call   30a <open>
+ 1fe:	83 c4 10             	add    $0x10,%esp
+ 201:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 204:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 208:	79 07                	jns    211 <stat+0x26>
+    return -1;
+ 20a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20f:	eb 25                	jmp    236 <stat+0x4b>
+  r = fstat(fd, st);
+ 211:	83 ec 08             	sub    $0x8,%esp
+ 214:	ff 75 0c             	push   0xc(%ebp)
+ 217:	ff 75 f4             	push   -0xc(%ebp)
+ 21a:	e8 03 01 00 00       	call   322 <fstat>
+ 21f:	83 c4 10             	add    $0x10,%esp
+ 222:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 225:	83 ec 0c             	sub    $0xc,%esp
+ 228:	ff 75 f4             	push   -0xc(%ebp)
+ 22b:	e8 c2 00 00 00       	call   2f2 <close>
+ 230:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 233:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 236:	c9                   	leave
+ 237:	c3                   	ret
+
+00000238 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 238:	55                   	push   %ebp
+ 239:	89 e5                	mov    %esp,%ebp
+ 23b:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 245:	eb 25                	jmp    26c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 247:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24a:	89 d0                	mov    %edx,%eax
+ 24c:	c1 e0 02             	shl    $0x2,%eax
+ 24f:	01 d0                	add    %edx,%eax
+ 251:	01 c0                	add    %eax,%eax
+ 253:	89 c1                	mov    %eax,%ecx
+ 255:	8b 45 08             	mov    0x8(%ebp),%eax
+ 258:	8d 50 01             	lea    0x1(%eax),%edx
+ 25b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25e:	0f b6 00             	movzbl (%eax),%eax
+ 261:	0f be c0             	movsbl %al,%eax
+ 264:	01 c8                	add    %ecx,%eax
+ 266:	83 e8 30             	sub    $0x30,%eax
+ 269:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	0f b6 00             	movzbl (%eax),%eax
+ 272:	3c 2f                	cmp    $0x2f,%al
+ 274:	7e 0a                	jle    280 <atoi+0x48>
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+ 279:	0f b6 00             	movzbl (%eax),%eax
+ 27c:	3c 39                	cmp    $0x39,%al
+ 27e:	7e c7                	jle    247 <atoi+0xf>
+  return n;
+ 280:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 283:	c9                   	leave
+ 284:	c3                   	ret
+
+00000285 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 285:	55                   	push   %ebp
+ 286:	89 e5                	mov    %esp,%ebp
+ 288:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 291:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 294:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 297:	eb 17                	jmp    2b0 <memmove+0x2b>
+    *dst++ = *src++;
+ 299:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29c:	8d 42 01             	lea    0x1(%edx),%eax
+ 29f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a8:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ab:	0f b6 12             	movzbl (%edx),%edx
+ 2ae:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b3:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b6:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b9:	85 c0                	test   %eax,%eax
+ 2bb:	7f dc                	jg     299 <memmove+0x14>
+  return vdst;
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2c2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <exit>:
+SYSCALL(exit)
+ 2ca:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <wait>:
+SYSCALL(wait)
+ 2d2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <pipe>:
+SYSCALL(pipe)
+ 2da:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <read>:
+SYSCALL(read)
+ 2e2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <write>:
+SYSCALL(write)
+ 2ea:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <close>:
+SYSCALL(close)
+ 2f2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <kill>:
+SYSCALL(kill)
+ 2fa:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <exec>:
+SYSCALL(exec)
+ 302:	b8 07 00 00 00       	mov    $0x7,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <open>:
+SYSCALL(open)
+ 30a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <mknod>:
+SYSCALL(mknod)
+ 312:	b8 11 00 00 00       	mov    $0x11,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <unlink>:
+SYSCALL(unlink)
+ 31a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <fstat>:
+SYSCALL(fstat)
+ 322:	b8 08 00 00 00       	mov    $0x8,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <link>:
+SYSCALL(link)
+ 32a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <mkdir>:
+SYSCALL(mkdir)
+ 332:	b8 14 00 00 00       	mov    $0x14,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <chdir>:
+SYSCALL(chdir)
+ 33a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <dup>:
+SYSCALL(dup)
+ 342:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <getpid>:
+SYSCALL(getpid)
+ 34a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <sbrk>:
+SYSCALL(sbrk)
+ 352:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <sleep>:
+SYSCALL(sleep)
+ 35a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <uptime>:
+SYSCALL(uptime)
+ 362:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 36a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <getschedstat>:
+SYSCALL(getschedstat)
+ 372:	b8 17 00 00 00       	mov    $0x17,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 37a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <setshare>:
+SYSCALL(setshare)
+ 382:	b8 19 00 00 00       	mov    $0x19,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <getbcachestat>:
+SYSCALL(getbcachestat)
+ 38a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 392:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <getlogstat>:
+SYSCALL(getlogstat)
+ 39a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3a2:	55                   	push   %ebp
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	83 ec 18             	sub    $0x18,%esp
+ 3a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ab:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3ae:	83 ec 04             	sub    $0x4,%esp
+ 3b1:	6a 01                	push   $0x1
+ 3b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3b6:	50                   	push   %eax
+ 3b7:	ff 75 08             	push   0x8(%ebp)
+ 3ba:	e8 2b ff ff ff       	call   2ea <write>
+ 3bf:	83 c4 10             	add    $0x10,%esp
+}
+ 3c2:	90                   	nop
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+
+000003c5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c5:	55                   	push   %ebp
+ 3c6:	89 e5                	mov    %esp,%ebp
+ 3c8:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3cb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3d2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3d6:	74 17                	je     3ef <printint+0x2a>
+ 3d8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3dc:	79 11                	jns    3ef <printint+0x2a>
+    neg = 1;
+ 3de:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e8:	f7 d8                	neg    %eax
+ 3ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3ed:	eb 06                	jmp    3f5 <printint+0x30>
+  } else {
+    x = xx;
+ 3ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3f5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3fc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ff:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 402:	ba 00 00 00 00       	mov    $0x0,%edx
+ 407:	f7 f1                	div    %ecx
+ 409:	89 d1                	mov    %edx,%ecx
+ 40b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40e:	8d 50 01             	lea    0x1(%eax),%edx
+ 411:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 414:	0f b6 91 0c 0c 00 00 	movzbl 0xc0c(%ecx),%edx
+ 41b:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 41f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 422:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 425:	ba 00 00 00 00       	mov    $0x0,%edx
+ 42a:	f7 f1                	div    %ecx
+ 42c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 42f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 433:	75 c7                	jne    3fc <printint+0x37>
+  if(neg)
+ 435:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 439:	74 2d                	je     468 <printint+0xa3>
+    buf[i++] = '-';
+ 43b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43e:	8d 50 01             	lea    0x1(%eax),%edx
+ 441:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 444:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 449:	eb 1d                	jmp    468 <printint+0xa3>
+    putc(fd, buf[i]);
+ 44b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 44e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 451:	01 d0                	add    %edx,%eax
+ 453:	0f b6 00             	movzbl (%eax),%eax
+ 456:	0f be c0             	movsbl %al,%eax
+ 459:	83 ec 08             	sub    $0x8,%esp
+ 45c:	50                   	push   %eax
+ 45d:	ff 75 08             	push   0x8(%ebp)
+ 460:	e8 3d ff ff ff       	call   3a2 <putc>
+ 465:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 468:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 46c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 470:	79 d9                	jns    44b <printint+0x86>
+}
+ 472:	90                   	nop
+ 473:	90                   	nop
+ 474:	c9                   	leave
+ 475:	c3                   	ret
+
+00000476 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 476:	55                   	push   %ebp
+ 477:	89 e5                	mov    %esp,%ebp
+ 479:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 47c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 483:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 486:	83 c0 04             	add    $0x4,%eax
+ 489:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 48c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 493:	e9 59 01 00 00       	jmp    5f1 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 498:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 49b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 49e:	01 d0                	add    %edx,%eax
+ 4a0:	0f b6 00             	movzbl (%eax),%eax
+ 4a3:	0f be c0             	movsbl %al,%eax
+ 4a6:	25 ff 00 00 00       	and    $0xff,%eax
+ 4ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4b2:	75 2c                	jne    4e0 <printf+0x6a>
+      if(c == '%'){
+ 4b4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4b8:	75 0c                	jne    4c6 <printf+0x50>
+        state = '%';
+ 4ba:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4c1:	e9 27 01 00 00       	jmp    5ed <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4c9:	0f be c0             	movsbl %al,%eax
+ 4cc:	83 ec 08             	sub    $0x8,%esp
+ 4cf:	50                   	push   %eax
+ 4d0:	ff 75 08             	push   0x8(%ebp)
+ 4d3:	e8 ca fe ff ff       	call   3a2 <putc>
+ 4d8:	83 c4 10             	add    $0x10,%esp
+ 4db:	e9 0d 01 00 00       	jmp    5ed <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4e0:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4e4:	0f 85 03 01 00 00    	jne    5ed <printf+0x177>
+      if(c == 'd'){
+ 4ea:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4ee:	75 1e                	jne    50e <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4f3:	8b 00                	mov    (%eax),%eax
+ 4f5:	6a 01                	push   $0x1
+ 4f7:	6a 0a                	push   $0xa
+ 4f9:	50                   	push   %eax
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 c3 fe ff ff       	call   3c5 <printint>
+ 502:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 505:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 509:	e9 d8 00 00 00       	jmp    5e6 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 50e:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 512:	74 06                	je     51a <printf+0xa4>
+ 514:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 518:	75 1e                	jne    538 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 51a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 51d:	8b 00                	mov    (%eax),%eax
+ 51f:	6a 00                	push   $0x0
+ 521:	6a 10                	push   $0x10
+ 523:	50                   	push   %eax
+ 524:	ff 75 08             	push   0x8(%ebp)
+ 527:	e8 99 fe ff ff       	call   3c5 <printint>
+ 52c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 52f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 533:	e9 ae 00 00 00       	jmp    5e6 <printf+0x170>
+      } else if(c == 's'){
+ 538:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 53c:	75 43                	jne    581 <printf+0x10b>
+        s = (char*)*ap;
+ 53e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 541:	8b 00                	mov    (%eax),%eax
+ 543:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 546:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 54a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 54e:	75 25                	jne    575 <printf+0xff>
+          s = "(null)";
+ 550:	c7 45 f4 15 09 00 00 	movl   $0x915,-0xc(%ebp)
+        while(*s != 0){
+ 557:	eb 1c                	jmp    575 <printf+0xff>
+          putc(fd, *s);
+ 559:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 55c:	0f b6 00             	movzbl (%eax),%eax
+ 55f:	0f be c0             	movsbl %al,%eax
+ 562:	83 ec 08             	sub    $0x8,%esp
+ 565:	50                   	push   %eax
+ 566:	ff 75 08             	push   0x8(%ebp)
+ 569:	e8 34 fe ff ff       	call   3a2 <putc>
+ 56e:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 571:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 578:	0f b6 00             	movzbl (%eax),%eax
+ 57b:	84 c0                	test   %al,%al
+ 57d:	75 da                	jne    559 <printf+0xe3>
+ 57f:	eb 65                	jmp    5e6 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 581:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 585:	75 1d                	jne    5a4 <printf+0x12e>
+        putc(fd, *ap);
+ 587:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 58a:	8b 00                	mov    (%eax),%eax
+ 58c:	0f be c0             	movsbl %al,%eax
+ 58f:	83 ec 08             	sub    $0x8,%esp
+ 592:	50                   	push   %eax
+ 593:	ff 75 08             	push   0x8(%ebp)
+ 596:	e8 07 fe ff ff       	call   3a2 <putc>
+ 59b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 59e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5a2:	eb 42                	jmp    5e6 <printf+0x170>
+      } else if(c == '%'){
+ 5a4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5a8:	75 17                	jne    5c1 <printf+0x14b>
+        putc(fd, c);
+ 5aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5ad:	0f be c0             	movsbl %al,%eax
+ 5b0:	83 ec 08             	sub    $0x8,%esp
+ 5b3:	50                   	push   %eax
+ 5b4:	ff 75 08             	push   0x8(%ebp)
+ 5b7:	e8 e6 fd ff ff       	call   3a2 <putc>
+ 5bc:	83 c4 10             	add    $0x10,%esp
+ 5bf:	eb 25                	jmp    5e6 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5c1:	83 ec 08             	sub    $0x8,%esp
+ 5c4:	6a 25                	push   $0x25
+ 5c6:	ff 75 08             	push   0x8(%ebp)
+ 5c9:	e8 d4 fd ff ff       	call   3a2 <putc>
+ 5ce:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5d4:	0f be c0             	movsbl %al,%eax
+ 5d7:	83 ec 08             	sub    $0x8,%esp
+ 5da:	50                   	push   %eax
+ 5db:	ff 75 08             	push   0x8(%ebp)
+ 5de:	e8 bf fd ff ff       	call   3a2 <putc>
+ 5e3:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5e6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5ed:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5f7:	01 d0                	add    %edx,%eax
+ 5f9:	0f b6 00             	movzbl (%eax),%eax
+ 5fc:	84 c0                	test   %al,%al
+ 5fe:	0f 85 94 fe ff ff    	jne    498 <printf+0x22>
+    }
+  }
+}
+ 604:	90                   	nop
+ 605:	90                   	nop
+ 606:	c9                   	leave
+ 607:	c3                   	ret
+
+00000608 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 608:	55                   	push   %ebp
+ 609:	89 e5                	mov    %esp,%ebp
+ 60b:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 60e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 611:	83 e8 08             	sub    $0x8,%eax
+ 614:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 617:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 61c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 61f:	eb 24                	jmp    645 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 621:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 624:	8b 00                	mov    (%eax),%eax
+ 626:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 629:	72 12                	jb     63d <free+0x35>
+ 62b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 62e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 631:	72 24                	jb     657 <free+0x4f>
+ 633:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 636:	8b 00                	mov    (%eax),%eax
+ 638:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 63b:	72 1a                	jb     657 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 63d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 640:	8b 00                	mov    (%eax),%eax
+ 642:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 645:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 648:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 64b:	73 d4                	jae    621 <free+0x19>
+ 64d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 650:	8b 00                	mov    (%eax),%eax
+ 652:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 655:	73 ca                	jae    621 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 657:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 65a:	8b 40 04             	mov    0x4(%eax),%eax
+ 65d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 664:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 667:	01 c2                	add    %eax,%edx
+ 669:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66c:	8b 00                	mov    (%eax),%eax
+ 66e:	39 c2                	cmp    %eax,%edx
+ 670:	75 24                	jne    696 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 672:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 675:	8b 50 04             	mov    0x4(%eax),%edx
+ 678:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67b:	8b 00                	mov    (%eax),%eax
+ 67d:	8b 40 04             	mov    0x4(%eax),%eax
+ 680:	01 c2                	add    %eax,%edx
+ 682:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 685:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 688:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68b:	8b 00                	mov    (%eax),%eax
+ 68d:	8b 10                	mov    (%eax),%edx
+ 68f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 692:	89 10                	mov    %edx,(%eax)
+ 694:	eb 0a                	jmp    6a0 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 696:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 699:	8b 10                	mov    (%eax),%edx
+ 69b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 69e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a6:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b0:	01 d0                	add    %edx,%eax
+ 6b2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6b5:	75 20                	jne    6d7 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ba:	8b 50 04             	mov    0x4(%eax),%edx
+ 6bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c3:	01 c2                	add    %eax,%edx
+ 6c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c8:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6cb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6ce:	8b 10                	mov    (%eax),%edx
+ 6d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d3:	89 10                	mov    %edx,(%eax)
+ 6d5:	eb 08                	jmp    6df <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6da:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6dd:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e2:	a3 28 0c 00 00       	mov    %eax,0xc28
+}
+ 6e7:	90                   	nop
+ 6e8:	c9                   	leave
+ 6e9:	c3                   	ret
+
+000006ea <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6ea:	55                   	push   %ebp
+ 6eb:	89 e5                	mov    %esp,%ebp
+ 6ed:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6f0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6f7:	77 07                	ja     700 <morecore+0x16>
+    nu = 4096;
+ 6f9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 700:	8b 45 08             	mov    0x8(%ebp),%eax
+ 703:	c1 e0 03             	shl    $0x3,%eax
+ 706:	83 ec 0c             	sub    $0xc,%esp
+ 709:	50                   	push   %eax
+ 70a:	e8 43 fc ff ff       	call   352 <sbrk>
+ 70f:	83 c4 10             	add    $0x10,%esp
+ 712:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 715:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 719:	75 07                	jne    722 <morecore+0x38>
+    return 0;
+ 71b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 720:	eb 26                	jmp    748 <morecore+0x5e>
+  hp = (Header*)p;
+ 722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 725:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 728:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 72b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 72e:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 731:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 734:	83 c0 08             	add    $0x8,%eax
+ 737:	83 ec 0c             	sub    $0xc,%esp
+ 73a:	50                   	push   %eax
+ 73b:	e8 c8 fe ff ff       	call   608 <free>
+ 740:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 743:	a1 28 0c 00 00       	mov    0xc28,%eax
+}
+ 748:	c9                   	leave
+ 749:	c3                   	ret
+
+0000074a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 74a:	55                   	push   %ebp
+ 74b:	89 e5                	mov    %esp,%ebp
+ 74d:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 750:	8b 45 08             	mov    0x8(%ebp),%eax
+ 753:	83 c0 07             	add    $0x7,%eax
+ 756:	c1 e8 03             	shr    $0x3,%eax
+ 759:	83 c0 01             	add    $0x1,%eax
+ 75c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 75f:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 764:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 767:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 76b:	75 23                	jne    790 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 76d:	c7 45 f0 20 0c 00 00 	movl   $0xc20,-0x10(%ebp)
+ 774:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 777:	a3 28 0c 00 00       	mov    %eax,0xc28
+ 77c:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 781:	a3 20 0c 00 00       	mov    %eax,0xc20
+    base.s.size = 0;
+ 786:	c7 05 24 0c 00 00 00 	movl   $0x0,0xc24
+ 78d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 790:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 793:	8b 00                	mov    (%eax),%eax
+ 795:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79b:	8b 40 04             	mov    0x4(%eax),%eax
+ 79e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7a1:	72 4d                	jb     7f0 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a6:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a9:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7ac:	75 0c                	jne    7ba <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b1:	8b 10                	mov    (%eax),%edx
+ 7b3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b6:	89 10                	mov    %edx,(%eax)
+ 7b8:	eb 26                	jmp    7e0 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c0:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7c3:	89 c2                	mov    %eax,%edx
+ 7c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c8:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ce:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d1:	c1 e0 03             	shl    $0x3,%eax
+ 7d4:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7da:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7dd:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e3:	a3 28 0c 00 00       	mov    %eax,0xc28
+      return (void*)(p + 1);
+ 7e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7eb:	83 c0 08             	add    $0x8,%eax
+ 7ee:	eb 3b                	jmp    82b <malloc+0xe1>
+    }
+    if(p == freep)
+ 7f0:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 7f5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7f8:	75 1e                	jne    818 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7fa:	83 ec 0c             	sub    $0xc,%esp
+ 7fd:	ff 75 ec             	push   -0x14(%ebp)
+ 800:	e8 e5 fe ff ff       	call   6ea <morecore>
+ 805:	83 c4 10             	add    $0x10,%esp
+ 808:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 80b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 80f:	75 07                	jne    818 <malloc+0xce>
+        return 0;
+ 811:	b8 00 00 00 00       	mov    $0x0,%eax
+ 816:	eb 13                	jmp    82b <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 81e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 821:	8b 00                	mov    (%eax),%eax
+ 823:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 826:	e9 6d ff ff ff       	jmp    798 <malloc+0x4e>
+  }
+}
+ 82b:	c9                   	leave
+ 82c:	c3                   	ret
+
+0000082d <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 82d:	55                   	push   %ebp
+ 82e:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 830:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 833:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 836:	7e 08                	jle    840 <ticks+0x13>
+ 838:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 83b:	2b 45 08             	sub    0x8(%ebp),%eax
+ 83e:	eb 05                	jmp    845 <ticks+0x18>
+ 840:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 845:	5d                   	pop    %ebp
+ 846:	c3                   	ret
+
+00000847 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 847:	55                   	push   %ebp
+ 848:	89 e5                	mov    %esp,%ebp
+ 84a:	53                   	push   %ebx
+ 84b:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 84e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 851:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 854:	ff 75 14             	push   0x14(%ebp)
+ 857:	ff 75 10             	push   0x10(%ebp)
+ 85a:	e8 ce ff ff ff       	call   82d <ticks>
+ 85f:	83 c4 08             	add    $0x8,%esp
+ 862:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 864:	89 d8                	mov    %ebx,%eax
+ 866:	99                   	cltd
+ 867:	f7 f9                	idiv   %ecx
+ 869:	89 c2                	mov    %eax,%edx
+ 86b:	8b 45 14             	mov    0x14(%ebp),%eax
+ 86e:	2b 45 10             	sub    0x10(%ebp),%eax
+ 871:	83 ec 04             	sub    $0x4,%esp
+ 874:	ff 75 0c             	push   0xc(%ebp)
+ 877:	52                   	push   %edx
+ 878:	50                   	push   %eax
+ 879:	ff 75 0c             	push   0xc(%ebp)
+ 87c:	ff 75 08             	push   0x8(%ebp)
+ 87f:	68 1c 09 00 00       	push   $0x91c
+ 884:	6a 01                	push   $0x1
+ 886:	e8 eb fb ff ff       	call   476 <printf>
+ 88b:	83 c4 20             	add    $0x20,%esp
+}
+ 88e:	90                   	nop
+ 88f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 892:	c9                   	leave
+ 893:	c3                   	ret
+
+00000894 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 894:	55                   	push   %ebp
+ 895:	89 e5                	mov    %esp,%ebp
+ 897:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 89a:	ff 75 14             	push   0x14(%ebp)
+ 89d:	ff 75 10             	push   0x10(%ebp)
+ 8a0:	e8 88 ff ff ff       	call   82d <ticks>
+ 8a5:	83 c4 08             	add    $0x8,%esp
+ 8a8:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 8ae:	99                   	cltd
+ 8af:	f7 7d 08             	idivl  0x8(%ebp)
+ 8b2:	89 c2                	mov    %eax,%edx
+ 8b4:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8b7:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8ba:	83 ec 08             	sub    $0x8,%esp
+ 8bd:	52                   	push   %edx
+ 8be:	50                   	push   %eax
+ 8bf:	ff 75 0c             	push   0xc(%ebp)
+ 8c2:	ff 75 08             	push   0x8(%ebp)
+ 8c5:	68 3c 09 00 00       	push   $0x93c
+ 8ca:	6a 01                	push   $0x1
+ 8cc:	e8 a5 fb ff ff       	call   476 <printf>
+ 8d1:	83 c4 20             	add    $0x20,%esp
+}
+ 8d4:	90                   	nop
+ 8d5:	c9                   	leave
+ 8d6:	c3                   	ret
@@ -0,0 +1,19 @@
+// Print per-CPU scheduler statistics.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "schedstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  int i;
+  struct schedstat st;
+
+  printf(1, "cpu switches steals failed idle runnable\n");
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+    printf(1, "%d %d %d %d %d %d\n", i, st.nswitch, st.nsteal,
+           st.nstealfail, st.idleticks, st.nrunnable);
+  exit();
+}
@@ -1,19 +1,32 @@
+struct bcachestat;
 struct buf;
+struct diskstat;
+struct logstat;
 struct context;
 struct file;
 struct inode;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct schedstat;
 struct spinlock;
 struct stat;
+struct vmseg;
 struct superblock;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bread_async(uint, uint, void (*)(struct buf*));
+void            breadahead(uint, uint);
+void            biowait(struct buf*);
+void            bpin(struct buf*);
 void            brelse(struct buf*);
+int             bshrink(void);
+void            bstat(struct bcachestat*);
+void            bunpin(struct buf*);
 void            bwrite(struct buf*);
+void            bwrite_async(struct buf*, void (*)(struct buf*));
 
 // console.c
 void            consoleinit(void);
@@ -35,6 +48,7 @@ int             filewrite(struct file*, char*, int n);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            bfreeinit(int dev);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
@@ -42,6 +56,7 @@ struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
+void            itext(struct inode*, int);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
@@ -55,18 +70,24 @@ int             writei(struct inode*, char*, uint, uint);
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
-void            iderw(struct buf*);
+int             iderw(struct buf*);
+void            idesubmit(struct buf*);
+int             ideawait(struct buf*);
+void            idestat(struct diskstat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+void            ioapicenablelevel(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+void            kdup(char*);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             krefcount(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -84,7 +105,10 @@ void            microdelay(int);
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
+void            begin_opn(int);
+int             log_maxop(void);
 void            end_op();
+void            logstat(struct logstat*);
 
 // mp.c
 extern int      ismp;
@@ -92,6 +116,13 @@ int             mpbcpu(void);
 void            mpinit(void);
 void            mpstartthem(void);
 
+// pci.c
+void            pcienable(uint);
+uint            pcifind(int);
+uint            pcifindid(uint);
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -107,13 +138,19 @@ int             pipewrite(struct pipe*, char*, int);
 struct proc*    copyproc(struct proc*);
 void            exit(void);
 int             fork(void);
+int             getschedstat(int, struct schedstat*);
 int             growproc(int);
 int             kill(int);
+struct proc*    kthread(char*, void (*)(void));
 void            pinit(void);
+void            priboost(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setschedpolicy(int);
+int             setshare(int, int);
 void            sleep(void*, struct spinlock*);
+int             timeslice(void);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -142,7 +179,7 @@ char*           strncpy(char*, const char*, int);
 
 // syscall.c
 int             argint(int, int*);
-int             argptr(int, char**, int);
+int             argptr(int, char**, int, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -154,6 +191,9 @@ void            timerinit(void);
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
+extern int      diskirq;
+void            timeradd(struct proc*);
+void            timerdel(struct proc*);
 void            tvinit(void);
 extern struct spinlock tickslock;
 
@@ -172,12 +212,17 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             pagefault(uint, uint);
+int             uvmprefault(uint, uint, int);
+uint            uvmrss(pde_t*, uint);
+void            segdup(struct vmseg*, struct vmseg*);
+void            segput(struct vmseg*);
+void            segtrunc(struct vmseg*, uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,9 @@
+// Disk statistics, returned by getdiskstat().
+struct diskstat {
+  uint ncmd;      // Commands issued to the disk
+  uint nblock;    // Blocks those commands moved
+  uint nreq;      // Requests completed
+  uint qticks;    // Ticks those requests spent from queueing to completion
+  uint intrkcycles; // CPU cycles spent in the interrupt handler, / 1024
+  uint dma;       // 1 if the driver uses bus-master DMA
+};
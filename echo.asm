@@ -0,0 +1,1260 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 cc 08 00 00       	mov    $0x8cc,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 ce 08 00 00       	mov    $0x8ce,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 d0 08 00 00       	push   $0x8d0
+  4b:	6a 01                	push   $0x1
+  4d:	e8 16 04 00 00       	call   468 <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 57 02 00 00       	call   2bc <exit>
+
+00000065 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+    ;
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+
+uint
+strlen(char *s)
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+    ;
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 47 01 00 00       	call   2d4 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 0c 01 00 00       	call   2fc <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 03 01 00 00       	call   314 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 c2 00 00 00       	call   2e4 <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <exit>:
+SYSCALL(exit)
+ 2bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <wait>:
+SYSCALL(wait)
+ 2c4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <pipe>:
+SYSCALL(pipe)
+ 2cc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <read>:
+SYSCALL(read)
+ 2d4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <write>:
+SYSCALL(write)
+ 2dc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <close>:
+SYSCALL(close)
+ 2e4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <kill>:
+SYSCALL(kill)
+ 2ec:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <exec>:
+SYSCALL(exec)
+ 2f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <open>:
+SYSCALL(open)
+ 2fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <mknod>:
+SYSCALL(mknod)
+ 304:	b8 11 00 00 00       	mov    $0x11,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <unlink>:
+SYSCALL(unlink)
+ 30c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <fstat>:
+SYSCALL(fstat)
+ 314:	b8 08 00 00 00       	mov    $0x8,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <link>:
+SYSCALL(link)
+ 31c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <mkdir>:
+SYSCALL(mkdir)
+ 324:	b8 14 00 00 00       	mov    $0x14,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <chdir>:
+SYSCALL(chdir)
+ 32c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <dup>:
+SYSCALL(dup)
+ 334:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <getpid>:
+SYSCALL(getpid)
+ 33c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sbrk>:
+SYSCALL(sbrk)
+ 344:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <sleep>:
+SYSCALL(sleep)
+ 34c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <uptime>:
+SYSCALL(uptime)
+ 354:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 35c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <getschedstat>:
+SYSCALL(getschedstat)
+ 364:	b8 17 00 00 00       	mov    $0x17,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 36c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <setshare>:
+SYSCALL(setshare)
+ 374:	b8 19 00 00 00       	mov    $0x19,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <getbcachestat>:
+SYSCALL(getbcachestat)
+ 37c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 384:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <getlogstat>:
+SYSCALL(getlogstat)
+ 38c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 394:	55                   	push   %ebp
+ 395:	89 e5                	mov    %esp,%ebp
+ 397:	83 ec 18             	sub    $0x18,%esp
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 01                	push   $0x1
+ 3a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3a8:	50                   	push   %eax
+ 3a9:	ff 75 08             	push   0x8(%ebp)
+ 3ac:	e8 2b ff ff ff       	call   2dc <write>
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	90                   	nop
+ 3b5:	c9                   	leave
+ 3b6:	c3                   	ret
+
+000003b7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3b7:	55                   	push   %ebp
+ 3b8:	89 e5                	mov    %esp,%ebp
+ 3ba:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3bd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3c4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3c8:	74 17                	je     3e1 <printint+0x2a>
+ 3ca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3ce:	79 11                	jns    3e1 <printint+0x2a>
+    neg = 1;
+ 3d0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3da:	f7 d8                	neg    %eax
+ 3dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3df:	eb 06                	jmp    3e7 <printint+0x30>
+  } else {
+    x = xx;
+ 3e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3e7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3f1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3f4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3f9:	f7 f1                	div    %ecx
+ 3fb:	89 d1                	mov    %edx,%ecx
+ 3fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 400:	8d 50 01             	lea    0x1(%eax),%edx
+ 403:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 406:	0f b6 91 c8 0b 00 00 	movzbl 0xbc8(%ecx),%edx
+ 40d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 411:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 414:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 417:	ba 00 00 00 00       	mov    $0x0,%edx
+ 41c:	f7 f1                	div    %ecx
+ 41e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 421:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 425:	75 c7                	jne    3ee <printint+0x37>
+  if(neg)
+ 427:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 42b:	74 2d                	je     45a <printint+0xa3>
+    buf[i++] = '-';
+ 42d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 430:	8d 50 01             	lea    0x1(%eax),%edx
+ 433:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 436:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 43b:	eb 1d                	jmp    45a <printint+0xa3>
+    putc(fd, buf[i]);
+ 43d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 440:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 443:	01 d0                	add    %edx,%eax
+ 445:	0f b6 00             	movzbl (%eax),%eax
+ 448:	0f be c0             	movsbl %al,%eax
+ 44b:	83 ec 08             	sub    $0x8,%esp
+ 44e:	50                   	push   %eax
+ 44f:	ff 75 08             	push   0x8(%ebp)
+ 452:	e8 3d ff ff ff       	call   394 <putc>
+ 457:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 45a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 45e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 462:	79 d9                	jns    43d <printint+0x86>
+}
+ 464:	90                   	nop
+ 465:	90                   	nop
+ 466:	c9                   	leave
+ 467:	c3                   	ret
+
+00000468 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 468:	55                   	push   %ebp
+ 469:	89 e5                	mov    %esp,%ebp
+ 46b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 46e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 475:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 478:	83 c0 04             	add    $0x4,%eax
+ 47b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 47e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 485:	e9 59 01 00 00       	jmp    5e3 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 48a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 48d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 490:	01 d0                	add    %edx,%eax
+ 492:	0f b6 00             	movzbl (%eax),%eax
+ 495:	0f be c0             	movsbl %al,%eax
+ 498:	25 ff 00 00 00       	and    $0xff,%eax
+ 49d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4a4:	75 2c                	jne    4d2 <printf+0x6a>
+      if(c == '%'){
+ 4a6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4aa:	75 0c                	jne    4b8 <printf+0x50>
+        state = '%';
+ 4ac:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4b3:	e9 27 01 00 00       	jmp    5df <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4bb:	0f be c0             	movsbl %al,%eax
+ 4be:	83 ec 08             	sub    $0x8,%esp
+ 4c1:	50                   	push   %eax
+ 4c2:	ff 75 08             	push   0x8(%ebp)
+ 4c5:	e8 ca fe ff ff       	call   394 <putc>
+ 4ca:	83 c4 10             	add    $0x10,%esp
+ 4cd:	e9 0d 01 00 00       	jmp    5df <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4d2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4d6:	0f 85 03 01 00 00    	jne    5df <printf+0x177>
+      if(c == 'd'){
+ 4dc:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4e0:	75 1e                	jne    500 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4e5:	8b 00                	mov    (%eax),%eax
+ 4e7:	6a 01                	push   $0x1
+ 4e9:	6a 0a                	push   $0xa
+ 4eb:	50                   	push   %eax
+ 4ec:	ff 75 08             	push   0x8(%ebp)
+ 4ef:	e8 c3 fe ff ff       	call   3b7 <printint>
+ 4f4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4f7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4fb:	e9 d8 00 00 00       	jmp    5d8 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 500:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 504:	74 06                	je     50c <printf+0xa4>
+ 506:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 50a:	75 1e                	jne    52a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 50c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 50f:	8b 00                	mov    (%eax),%eax
+ 511:	6a 00                	push   $0x0
+ 513:	6a 10                	push   $0x10
+ 515:	50                   	push   %eax
+ 516:	ff 75 08             	push   0x8(%ebp)
+ 519:	e8 99 fe ff ff       	call   3b7 <printint>
+ 51e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 521:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 525:	e9 ae 00 00 00       	jmp    5d8 <printf+0x170>
+      } else if(c == 's'){
+ 52a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 52e:	75 43                	jne    573 <printf+0x10b>
+        s = (char*)*ap;
+ 530:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 533:	8b 00                	mov    (%eax),%eax
+ 535:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 538:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 53c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 540:	75 25                	jne    567 <printf+0xff>
+          s = "(null)";
+ 542:	c7 45 f4 d5 08 00 00 	movl   $0x8d5,-0xc(%ebp)
+        while(*s != 0){
+ 549:	eb 1c                	jmp    567 <printf+0xff>
+          putc(fd, *s);
+ 54b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54e:	0f b6 00             	movzbl (%eax),%eax
+ 551:	0f be c0             	movsbl %al,%eax
+ 554:	83 ec 08             	sub    $0x8,%esp
+ 557:	50                   	push   %eax
+ 558:	ff 75 08             	push   0x8(%ebp)
+ 55b:	e8 34 fe ff ff       	call   394 <putc>
+ 560:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 563:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 567:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 56a:	0f b6 00             	movzbl (%eax),%eax
+ 56d:	84 c0                	test   %al,%al
+ 56f:	75 da                	jne    54b <printf+0xe3>
+ 571:	eb 65                	jmp    5d8 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 573:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 577:	75 1d                	jne    596 <printf+0x12e>
+        putc(fd, *ap);
+ 579:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 57c:	8b 00                	mov    (%eax),%eax
+ 57e:	0f be c0             	movsbl %al,%eax
+ 581:	83 ec 08             	sub    $0x8,%esp
+ 584:	50                   	push   %eax
+ 585:	ff 75 08             	push   0x8(%ebp)
+ 588:	e8 07 fe ff ff       	call   394 <putc>
+ 58d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 590:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 594:	eb 42                	jmp    5d8 <printf+0x170>
+      } else if(c == '%'){
+ 596:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 59a:	75 17                	jne    5b3 <printf+0x14b>
+        putc(fd, c);
+ 59c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 59f:	0f be c0             	movsbl %al,%eax
+ 5a2:	83 ec 08             	sub    $0x8,%esp
+ 5a5:	50                   	push   %eax
+ 5a6:	ff 75 08             	push   0x8(%ebp)
+ 5a9:	e8 e6 fd ff ff       	call   394 <putc>
+ 5ae:	83 c4 10             	add    $0x10,%esp
+ 5b1:	eb 25                	jmp    5d8 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5b3:	83 ec 08             	sub    $0x8,%esp
+ 5b6:	6a 25                	push   $0x25
+ 5b8:	ff 75 08             	push   0x8(%ebp)
+ 5bb:	e8 d4 fd ff ff       	call   394 <putc>
+ 5c0:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5c6:	0f be c0             	movsbl %al,%eax
+ 5c9:	83 ec 08             	sub    $0x8,%esp
+ 5cc:	50                   	push   %eax
+ 5cd:	ff 75 08             	push   0x8(%ebp)
+ 5d0:	e8 bf fd ff ff       	call   394 <putc>
+ 5d5:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5d8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5df:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5e9:	01 d0                	add    %edx,%eax
+ 5eb:	0f b6 00             	movzbl (%eax),%eax
+ 5ee:	84 c0                	test   %al,%al
+ 5f0:	0f 85 94 fe ff ff    	jne    48a <printf+0x22>
+    }
+  }
+}
+ 5f6:	90                   	nop
+ 5f7:	90                   	nop
+ 5f8:	c9                   	leave
+ 5f9:	c3                   	ret
+
+000005fa <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5fa:	55                   	push   %ebp
+ 5fb:	89 e5                	mov    %esp,%ebp
+ 5fd:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 600:	8b 45 08             	mov    0x8(%ebp),%eax
+ 603:	83 e8 08             	sub    $0x8,%eax
+ 606:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 609:	a1 e4 0b 00 00       	mov    0xbe4,%eax
+ 60e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 611:	eb 24                	jmp    637 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 613:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 616:	8b 00                	mov    (%eax),%eax
+ 618:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 61b:	72 12                	jb     62f <free+0x35>
+ 61d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 620:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 623:	72 24                	jb     649 <free+0x4f>
+ 625:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 628:	8b 00                	mov    (%eax),%eax
+ 62a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 62d:	72 1a                	jb     649 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 632:	8b 00                	mov    (%eax),%eax
+ 634:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 637:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 63a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 63d:	73 d4                	jae    613 <free+0x19>
+ 63f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 642:	8b 00                	mov    (%eax),%eax
+ 644:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 647:	73 ca                	jae    613 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 649:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 64c:	8b 40 04             	mov    0x4(%eax),%eax
+ 64f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 656:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 659:	01 c2                	add    %eax,%edx
+ 65b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 65e:	8b 00                	mov    (%eax),%eax
+ 660:	39 c2                	cmp    %eax,%edx
+ 662:	75 24                	jne    688 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 664:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 667:	8b 50 04             	mov    0x4(%eax),%edx
+ 66a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66d:	8b 00                	mov    (%eax),%eax
+ 66f:	8b 40 04             	mov    0x4(%eax),%eax
+ 672:	01 c2                	add    %eax,%edx
+ 674:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 677:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 67a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67d:	8b 00                	mov    (%eax),%eax
+ 67f:	8b 10                	mov    (%eax),%edx
+ 681:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 684:	89 10                	mov    %edx,(%eax)
+ 686:	eb 0a                	jmp    692 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 688:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68b:	8b 10                	mov    (%eax),%edx
+ 68d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 690:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 692:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 695:	8b 40 04             	mov    0x4(%eax),%eax
+ 698:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 69f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a2:	01 d0                	add    %edx,%eax
+ 6a4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6a7:	75 20                	jne    6c9 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ac:	8b 50 04             	mov    0x4(%eax),%edx
+ 6af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6b2:	8b 40 04             	mov    0x4(%eax),%eax
+ 6b5:	01 c2                	add    %eax,%edx
+ 6b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ba:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6bd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6c0:	8b 10                	mov    (%eax),%edx
+ 6c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c5:	89 10                	mov    %edx,(%eax)
+ 6c7:	eb 08                	jmp    6d1 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6cf:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d4:	a3 e4 0b 00 00       	mov    %eax,0xbe4
+}
+ 6d9:	90                   	nop
+ 6da:	c9                   	leave
+ 6db:	c3                   	ret
+
+000006dc <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6dc:	55                   	push   %ebp
+ 6dd:	89 e5                	mov    %esp,%ebp
+ 6df:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6e2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6e9:	77 07                	ja     6f2 <morecore+0x16>
+    nu = 4096;
+ 6eb:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f5:	c1 e0 03             	shl    $0x3,%eax
+ 6f8:	83 ec 0c             	sub    $0xc,%esp
+ 6fb:	50                   	push   %eax
+ 6fc:	e8 43 fc ff ff       	call   344 <sbrk>
+ 701:	83 c4 10             	add    $0x10,%esp
+ 704:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 707:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 70b:	75 07                	jne    714 <morecore+0x38>
+    return 0;
+ 70d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 712:	eb 26                	jmp    73a <morecore+0x5e>
+  hp = (Header*)p;
+ 714:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 717:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 71a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 71d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 720:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 723:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 726:	83 c0 08             	add    $0x8,%eax
+ 729:	83 ec 0c             	sub    $0xc,%esp
+ 72c:	50                   	push   %eax
+ 72d:	e8 c8 fe ff ff       	call   5fa <free>
+ 732:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 735:	a1 e4 0b 00 00       	mov    0xbe4,%eax
+}
+ 73a:	c9                   	leave
+ 73b:	c3                   	ret
+
+0000073c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 73c:	55                   	push   %ebp
+ 73d:	89 e5                	mov    %esp,%ebp
+ 73f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 742:	8b 45 08             	mov    0x8(%ebp),%eax
+ 745:	83 c0 07             	add    $0x7,%eax
+ 748:	c1 e8 03             	shr    $0x3,%eax
+ 74b:	83 c0 01             	add    $0x1,%eax
+ 74e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 751:	a1 e4 0b 00 00       	mov    0xbe4,%eax
+ 756:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 759:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 75d:	75 23                	jne    782 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 75f:	c7 45 f0 dc 0b 00 00 	movl   $0xbdc,-0x10(%ebp)
+ 766:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 769:	a3 e4 0b 00 00       	mov    %eax,0xbe4
+ 76e:	a1 e4 0b 00 00       	mov    0xbe4,%eax
+ 773:	a3 dc 0b 00 00       	mov    %eax,0xbdc
+    base.s.size = 0;
+ 778:	c7 05 e0 0b 00 00 00 	movl   $0x0,0xbe0
+ 77f:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 782:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 785:	8b 00                	mov    (%eax),%eax
+ 787:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 78a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78d:	8b 40 04             	mov    0x4(%eax),%eax
+ 790:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 793:	72 4d                	jb     7e2 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 798:	8b 40 04             	mov    0x4(%eax),%eax
+ 79b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 79e:	75 0c                	jne    7ac <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a3:	8b 10                	mov    (%eax),%edx
+ 7a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a8:	89 10                	mov    %edx,(%eax)
+ 7aa:	eb 26                	jmp    7d2 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7af:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7b5:	89 c2                	mov    %eax,%edx
+ 7b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ba:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c3:	c1 e0 03             	shl    $0x3,%eax
+ 7c6:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7cf:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7d5:	a3 e4 0b 00 00       	mov    %eax,0xbe4
+      return (void*)(p + 1);
+ 7da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7dd:	83 c0 08             	add    $0x8,%eax
+ 7e0:	eb 3b                	jmp    81d <malloc+0xe1>
+    }
+    if(p == freep)
+ 7e2:	a1 e4 0b 00 00       	mov    0xbe4,%eax
+ 7e7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7ea:	75 1e                	jne    80a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7ec:	83 ec 0c             	sub    $0xc,%esp
+ 7ef:	ff 75 ec             	push   -0x14(%ebp)
+ 7f2:	e8 e5 fe ff ff       	call   6dc <morecore>
+ 7f7:	83 c4 10             	add    $0x10,%esp
+ 7fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 7fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 801:	75 07                	jne    80a <malloc+0xce>
+        return 0;
+ 803:	b8 00 00 00 00       	mov    $0x0,%eax
+ 808:	eb 13                	jmp    81d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 80a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 813:	8b 00                	mov    (%eax),%eax
+ 815:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 818:	e9 6d ff ff ff       	jmp    78a <malloc+0x4e>
+  }
+}
+ 81d:	c9                   	leave
+ 81e:	c3                   	ret
+
+0000081f <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 81f:	55                   	push   %ebp
+ 820:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 822:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 825:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 828:	7e 08                	jle    832 <ticks+0x13>
+ 82a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 82d:	2b 45 08             	sub    0x8(%ebp),%eax
+ 830:	eb 05                	jmp    837 <ticks+0x18>
+ 832:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 837:	5d                   	pop    %ebp
+ 838:	c3                   	ret
+
+00000839 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 839:	55                   	push   %ebp
+ 83a:	89 e5                	mov    %esp,%ebp
+ 83c:	53                   	push   %ebx
+ 83d:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 840:	8b 45 08             	mov    0x8(%ebp),%eax
+ 843:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 846:	ff 75 14             	push   0x14(%ebp)
+ 849:	ff 75 10             	push   0x10(%ebp)
+ 84c:	e8 ce ff ff ff       	call   81f <ticks>
+ 851:	83 c4 08             	add    $0x8,%esp
+ 854:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 856:	89 d8                	mov    %ebx,%eax
+ 858:	99                   	cltd
+ 859:	f7 f9                	idiv   %ecx
+ 85b:	89 c2                	mov    %eax,%edx
+ 85d:	8b 45 14             	mov    0x14(%ebp),%eax
+ 860:	2b 45 10             	sub    0x10(%ebp),%eax
+ 863:	83 ec 04             	sub    $0x4,%esp
+ 866:	ff 75 0c             	push   0xc(%ebp)
+ 869:	52                   	push   %edx
+ 86a:	50                   	push   %eax
+ 86b:	ff 75 0c             	push   0xc(%ebp)
+ 86e:	ff 75 08             	push   0x8(%ebp)
+ 871:	68 dc 08 00 00       	push   $0x8dc
+ 876:	6a 01                	push   $0x1
+ 878:	e8 eb fb ff ff       	call   468 <printf>
+ 87d:	83 c4 20             	add    $0x20,%esp
+}
+ 880:	90                   	nop
+ 881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 884:	c9                   	leave
+ 885:	c3                   	ret
+
+00000886 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 886:	55                   	push   %ebp
+ 887:	89 e5                	mov    %esp,%ebp
+ 889:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 88c:	ff 75 14             	push   0x14(%ebp)
+ 88f:	ff 75 10             	push   0x10(%ebp)
+ 892:	e8 88 ff ff ff       	call   81f <ticks>
+ 897:	83 c4 08             	add    $0x8,%esp
+ 89a:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 8a0:	99                   	cltd
+ 8a1:	f7 7d 08             	idivl  0x8(%ebp)
+ 8a4:	89 c2                	mov    %eax,%edx
+ 8a6:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8a9:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8ac:	83 ec 08             	sub    $0x8,%esp
+ 8af:	52                   	push   %edx
+ 8b0:	50                   	push   %eax
+ 8b1:	ff 75 0c             	push   0xc(%ebp)
+ 8b4:	ff 75 08             	push   0x8(%ebp)
+ 8b7:	68 fc 08 00 00       	push   $0x8fc
+ 8bc:	6a 01                	push   $0x1
+ 8be:	e8 a5 fb ff ff       	call   468 <printf>
+ 8c3:	83 c4 20             	add    $0x20,%esp
+}
+ 8c6:	90                   	nop
+ 8c7:	c9                   	leave
+ 8c8:	c3                   	ret
@@ -125,28 +125,29 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // i-node, up to three extent blocks, allocation
+    // blocks, and 2 blocks of slop for non-aligned writes.
+    // each piece reserves log space for just that.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+    int max = ((log_maxop()-1-2-1-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
       if(n1 > max)
         n1 = max;
 
-      begin_op();
+      begin_opn((n1 + BSIZE-1) / BSIZE * 2 + 1+2+1+2);
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+      if(f->ip->ntext > 0)
+        r = -1;  // a running program pages in from it
+      else if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
         f->off += r;
       iunlock(f->ip);
       end_op();
 
-      if(r < 0)
-        break;
       if(r != n1)
-        panic("short filewrite");
+        break;  // error or disk full
       i += r;
     }
     return i == n ? n : -1;
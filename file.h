@@ -15,13 +15,20 @@ struct inode {
   uint inum;          // Inode number
   int ref;            // Reference count
   int flags;          // I_BUSY, I_VALID
+  int ntext;          // Running programs' segments paged in from it
+  uint nextbn;        // Block after the last one readi() read
+  uint ranext;        // First block not yet read ahead
+  uint xi;            // Extent bmap() last found a block in
+  uint xbn;           // First file block of extent xi
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint nextent;
+  struct extent ext[NEXTENT];
+  uint xaddrs[2];
 };
 #define I_BUSY 0x1
 #define I_VALID 0x2
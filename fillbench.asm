@@ -0,0 +1,1436 @@
+
+_fillbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <name>:
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  strcpy(s, "fill.00");
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 8c 0a 00 00       	push   $0xa8c
+   e:	ff 75 08             	push   0x8(%ebp)
+  11:	e8 38 02 00 00       	call   24e <strcpy>
+  16:	83 c4 10             	add    $0x10,%esp
+  s[5] = '0' + i / 10;
+  19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  1c:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  21:	89 c8                	mov    %ecx,%eax
+  23:	f7 ea                	imul   %edx
+  25:	c1 fa 02             	sar    $0x2,%edx
+  28:	89 c8                	mov    %ecx,%eax
+  2a:	c1 f8 1f             	sar    $0x1f,%eax
+  2d:	29 c2                	sub    %eax,%edx
+  2f:	89 d0                	mov    %edx,%eax
+  31:	8d 50 30             	lea    0x30(%eax),%edx
+  34:	8b 45 08             	mov    0x8(%ebp),%eax
+  37:	83 c0 05             	add    $0x5,%eax
+  3a:	88 10                	mov    %dl,(%eax)
+  s[6] = '0' + i % 10;
+  3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  3f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  44:	89 c8                	mov    %ecx,%eax
+  46:	f7 ea                	imul   %edx
+  48:	c1 fa 02             	sar    $0x2,%edx
+  4b:	89 c8                	mov    %ecx,%eax
+  4d:	c1 f8 1f             	sar    $0x1f,%eax
+  50:	29 c2                	sub    %eax,%edx
+  52:	89 d0                	mov    %edx,%eax
+  54:	c1 e0 02             	shl    $0x2,%eax
+  57:	01 d0                	add    %edx,%eax
+  59:	01 c0                	add    %eax,%eax
+  5b:	29 c1                	sub    %eax,%ecx
+  5d:	89 ca                	mov    %ecx,%edx
+  5f:	89 d0                	mov    %edx,%eax
+  61:	8d 50 30             	lea    0x30(%eax),%edx
+  64:	8b 45 08             	mov    0x8(%ebp),%eax
+  67:	83 c0 06             	add    $0x6,%eax
+  6a:	88 10                	mov    %dl,(%eax)
+}
+  6c:	90                   	nop
+  6d:	c9                   	leave
+  6e:	c3                   	ret
+
+0000006f <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6f:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  73:	83 e4 f0             	and    $0xfffffff0,%esp
+  76:	ff 71 fc             	push   -0x4(%ecx)
+  79:	55                   	push   %ebp
+  7a:	89 e5                	mov    %esp,%ebp
+  7c:	51                   	push   %ecx
+  7d:	83 ec 34             	sub    $0x34,%esp
+  char path[16];
+  int i, fd, n, nfile, tot, t0, t1, t2;
+
+  printf(1, "fillbench starting\n");
+  80:	83 ec 08             	sub    $0x8,%esp
+  83:	68 94 0a 00 00       	push   $0xa94
+  88:	6a 01                	push   $0x1
+  8a:	e8 9c 05 00 00       	call   62b <printf>
+  8f:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 'x', sizeof(buf));
+  92:	83 ec 04             	sub    $0x4,%esp
+  95:	68 00 02 00 00       	push   $0x200
+  9a:	6a 78                	push   $0x78
+  9c:	68 00 0e 00 00       	push   $0xe00
+  a1:	e8 3e 02 00 00       	call   2e4 <memset>
+  a6:	83 c4 10             	add    $0x10,%esp
+  tot = 0;
+  a9:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  t0 = uptime();
+  b0:	e8 62 04 00 00       	call   517 <uptime>
+  b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(nfile = 0; nfile < NFILE; nfile++){
+  b8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  bf:	e9 c8 00 00 00       	jmp    18c <main+0x11d>
+    name(path, nfile);
+  c4:	83 ec 08             	sub    $0x8,%esp
+  c7:	ff 75 ec             	push   -0x14(%ebp)
+  ca:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  cd:	50                   	push   %eax
+  ce:	e8 2d ff ff ff       	call   0 <name>
+  d3:	83 c4 10             	add    $0x10,%esp
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+  d6:	83 ec 08             	sub    $0x8,%esp
+  d9:	68 02 02 00 00       	push   $0x202
+  de:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  e1:	50                   	push   %eax
+  e2:	e8 d8 03 00 00       	call   4bf <open>
+  e7:	83 c4 10             	add    $0x10,%esp
+  ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  ed:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  f1:	0f 88 a1 00 00 00    	js     198 <main+0x129>
+      break;
+    t1 = uptime();
+  f7:	e8 1b 04 00 00       	call   517 <uptime>
+  fc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(n = 0; n < NBLOCK && write(fd, buf, sizeof(buf)) == sizeof(buf); n++)
+  ff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 106:	eb 04                	jmp    10c <main+0x9d>
+ 108:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 10c:	81 7d f0 e7 03 00 00 	cmpl   $0x3e7,-0x10(%ebp)
+ 113:	7f 1f                	jg     134 <main+0xc5>
+ 115:	83 ec 04             	sub    $0x4,%esp
+ 118:	68 00 02 00 00       	push   $0x200
+ 11d:	68 00 0e 00 00       	push   $0xe00
+ 122:	ff 75 e0             	push   -0x20(%ebp)
+ 125:	e8 75 03 00 00       	call   49f <write>
+ 12a:	83 c4 10             	add    $0x10,%esp
+ 12d:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 132:	74 d4                	je     108 <main+0x99>
+      ;
+    t2 = uptime();
+ 134:	e8 de 03 00 00       	call   517 <uptime>
+ 139:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    close(fd);
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	ff 75 e0             	push   -0x20(%ebp)
+ 142:	e8 60 03 00 00       	call   4a7 <close>
+ 147:	83 c4 10             	add    $0x10,%esp
+    tot += n;
+ 14a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 14d:	01 45 e8             	add    %eax,-0x18(%ebp)
+    printf(1, "%s: ", path);
+ 150:	83 ec 04             	sub    $0x4,%esp
+ 153:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 156:	50                   	push   %eax
+ 157:	68 a8 0a 00 00       	push   $0xaa8
+ 15c:	6a 01                	push   $0x1
+ 15e:	e8 c8 04 00 00       	call   62b <printf>
+ 163:	83 c4 10             	add    $0x10,%esp
+    benchrate(n, "blocks", t1, t2);
+ 166:	ff 75 d8             	push   -0x28(%ebp)
+ 169:	ff 75 dc             	push   -0x24(%ebp)
+ 16c:	68 ad 0a 00 00       	push   $0xaad
+ 171:	ff 75 f0             	push   -0x10(%ebp)
+ 174:	e8 83 08 00 00       	call   9fc <benchrate>
+ 179:	83 c4 10             	add    $0x10,%esp
+    if(n == 0){
+ 17c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 180:	75 06                	jne    188 <main+0x119>
+      nfile++;
+ 182:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+      break;
+ 186:	eb 11                	jmp    199 <main+0x12a>
+  for(nfile = 0; nfile < NFILE; nfile++){
+ 188:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 18c:	83 7d ec 63          	cmpl   $0x63,-0x14(%ebp)
+ 190:	0f 8e 2e ff ff ff    	jle    c4 <main+0x55>
+ 196:	eb 01                	jmp    199 <main+0x12a>
+      break;
+ 198:	90                   	nop
+    }
+  }
+  t1 = uptime();
+ 199:	e8 79 03 00 00       	call   517 <uptime>
+ 19e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(i = 0; i < nfile; i++){
+ 1a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a8:	eb 25                	jmp    1cf <main+0x160>
+    name(path, i);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	ff 75 f4             	push   -0xc(%ebp)
+ 1b0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 1b3:	50                   	push   %eax
+ 1b4:	e8 47 fe ff ff       	call   0 <name>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+    unlink(path);
+ 1bc:	83 ec 0c             	sub    $0xc,%esp
+ 1bf:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 1c2:	50                   	push   %eax
+ 1c3:	e8 07 03 00 00       	call   4cf <unlink>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nfile; i++){
+ 1cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 1d5:	7c d3                	jl     1aa <main+0x13b>
+  }
+  t2 = uptime();
+ 1d7:	e8 3b 03 00 00       	call   517 <uptime>
+ 1dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "%d files: ", nfile);
+ 1df:	83 ec 04             	sub    $0x4,%esp
+ 1e2:	ff 75 ec             	push   -0x14(%ebp)
+ 1e5:	68 b4 0a 00 00       	push   $0xab4
+ 1ea:	6a 01                	push   $0x1
+ 1ec:	e8 3a 04 00 00       	call   62b <printf>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+  benchrate(tot, "blocks", t0, t1);
+ 1f4:	ff 75 dc             	push   -0x24(%ebp)
+ 1f7:	ff 75 e4             	push   -0x1c(%ebp)
+ 1fa:	68 ad 0a 00 00       	push   $0xaad
+ 1ff:	ff 75 e8             	push   -0x18(%ebp)
+ 202:	e8 f5 07 00 00       	call   9fc <benchrate>
+ 207:	83 c4 10             	add    $0x10,%esp
+  printf(1, "deleted in %d ticks\n", t2 - t1);
+ 20a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 20d:	2b 45 dc             	sub    -0x24(%ebp),%eax
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	50                   	push   %eax
+ 214:	68 bf 0a 00 00       	push   $0xabf
+ 219:	6a 01                	push   $0x1
+ 21b:	e8 0b 04 00 00       	call   62b <printf>
+ 220:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 223:	e8 57 02 00 00       	call   47f <exit>
+
+00000228 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	57                   	push   %edi
+ 22c:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 22d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 230:	8b 55 10             	mov    0x10(%ebp),%edx
+ 233:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 236:	89 cb                	mov    %ecx,%ebx
+ 238:	89 df                	mov    %ebx,%edi
+ 23a:	89 d1                	mov    %edx,%ecx
+ 23c:	fc                   	cld
+ 23d:	f3 aa                	rep stos %al,%es:(%edi)
+ 23f:	89 ca                	mov    %ecx,%edx
+ 241:	89 fb                	mov    %edi,%ebx
+ 243:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 246:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 249:	90                   	nop
+ 24a:	5b                   	pop    %ebx
+ 24b:	5f                   	pop    %edi
+ 24c:	5d                   	pop    %ebp
+ 24d:	c3                   	ret
+
+0000024e <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 24e:	55                   	push   %ebp
+ 24f:	89 e5                	mov    %esp,%ebp
+ 251:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 25a:	90                   	nop
+ 25b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 25e:	8d 42 01             	lea    0x1(%edx),%eax
+ 261:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 264:	8b 45 08             	mov    0x8(%ebp),%eax
+ 267:	8d 48 01             	lea    0x1(%eax),%ecx
+ 26a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 26d:	0f b6 12             	movzbl (%edx),%edx
+ 270:	88 10                	mov    %dl,(%eax)
+ 272:	0f b6 00             	movzbl (%eax),%eax
+ 275:	84 c0                	test   %al,%al
+ 277:	75 e2                	jne    25b <strcpy+0xd>
+    ;
+  return os;
+ 279:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 27c:	c9                   	leave
+ 27d:	c3                   	ret
+
+0000027e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 27e:	55                   	push   %ebp
+ 27f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 281:	eb 08                	jmp    28b <strcmp+0xd>
+    p++, q++;
+ 283:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 287:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 28b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28e:	0f b6 00             	movzbl (%eax),%eax
+ 291:	84 c0                	test   %al,%al
+ 293:	74 10                	je     2a5 <strcmp+0x27>
+ 295:	8b 45 08             	mov    0x8(%ebp),%eax
+ 298:	0f b6 10             	movzbl (%eax),%edx
+ 29b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29e:	0f b6 00             	movzbl (%eax),%eax
+ 2a1:	38 c2                	cmp    %al,%dl
+ 2a3:	74 de                	je     283 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a8:	0f b6 00             	movzbl (%eax),%eax
+ 2ab:	0f b6 d0             	movzbl %al,%edx
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	0f b6 00             	movzbl (%eax),%eax
+ 2b4:	0f b6 c0             	movzbl %al,%eax
+ 2b7:	29 c2                	sub    %eax,%edx
+ 2b9:	89 d0                	mov    %edx,%eax
+}
+ 2bb:	5d                   	pop    %ebp
+ 2bc:	c3                   	ret
+
+000002bd <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2bd:	55                   	push   %ebp
+ 2be:	89 e5                	mov    %esp,%ebp
+ 2c0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2ca:	eb 04                	jmp    2d0 <strlen+0x13>
+ 2cc:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2d0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	01 d0                	add    %edx,%eax
+ 2d8:	0f b6 00             	movzbl (%eax),%eax
+ 2db:	84 c0                	test   %al,%al
+ 2dd:	75 ed                	jne    2cc <strlen+0xf>
+    ;
+  return n;
+ 2df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2e2:	c9                   	leave
+ 2e3:	c3                   	ret
+
+000002e4 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e4:	55                   	push   %ebp
+ 2e5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2e7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ea:	50                   	push   %eax
+ 2eb:	ff 75 0c             	push   0xc(%ebp)
+ 2ee:	ff 75 08             	push   0x8(%ebp)
+ 2f1:	e8 32 ff ff ff       	call   228 <stosb>
+ 2f6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2f9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2fc:	c9                   	leave
+ 2fd:	c3                   	ret
+
+000002fe <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2fe:	55                   	push   %ebp
+ 2ff:	89 e5                	mov    %esp,%ebp
+ 301:	83 ec 04             	sub    $0x4,%esp
+ 304:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 307:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 30a:	eb 14                	jmp    320 <strchr+0x22>
+    if(*s == c)
+ 30c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30f:	0f b6 00             	movzbl (%eax),%eax
+ 312:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 315:	75 05                	jne    31c <strchr+0x1e>
+      return (char*)s;
+ 317:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31a:	eb 13                	jmp    32f <strchr+0x31>
+  for(; *s; s++)
+ 31c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 320:	8b 45 08             	mov    0x8(%ebp),%eax
+ 323:	0f b6 00             	movzbl (%eax),%eax
+ 326:	84 c0                	test   %al,%al
+ 328:	75 e2                	jne    30c <strchr+0xe>
+  return 0;
+ 32a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 32f:	c9                   	leave
+ 330:	c3                   	ret
+
+00000331 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 331:	55                   	push   %ebp
+ 332:	89 e5                	mov    %esp,%ebp
+ 334:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 337:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 33e:	eb 42                	jmp    382 <gets+0x51>
+    cc = read(0, &c, 1);
+ 340:	83 ec 04             	sub    $0x4,%esp
+ 343:	6a 01                	push   $0x1
+ 345:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 348:	50                   	push   %eax
+ 349:	6a 00                	push   $0x0
+ 34b:	e8 47 01 00 00       	call   497 <read>
+ 350:	83 c4 10             	add    $0x10,%esp
+ 353:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 356:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 35a:	7e 33                	jle    38f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 35c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 35f:	8d 50 01             	lea    0x1(%eax),%edx
+ 362:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 365:	89 c2                	mov    %eax,%edx
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36a:	01 c2                	add    %eax,%edx
+ 36c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 370:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 372:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 376:	3c 0a                	cmp    $0xa,%al
+ 378:	74 16                	je     390 <gets+0x5f>
+ 37a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 37e:	3c 0d                	cmp    $0xd,%al
+ 380:	74 0e                	je     390 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 382:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 385:	83 c0 01             	add    $0x1,%eax
+ 388:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 38b:	7f b3                	jg     340 <gets+0xf>
+ 38d:	eb 01                	jmp    390 <gets+0x5f>
+      break;
+ 38f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 390:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	01 d0                	add    %edx,%eax
+ 398:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 39b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39e:	c9                   	leave
+ 39f:	c3                   	ret
+
+000003a0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a6:	83 ec 08             	sub    $0x8,%esp
+ 3a9:	6a 00                	push   $0x0
+ 3ab:	ff 75 08             	push   0x8(%ebp)
+ 3ae:	e8 0c 01 00 00       	call   4bf <open>
+ 3b3:	83 c4 10             	add    $0x10,%esp
+ 3b6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3b9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3bd:	79 07                	jns    3c6 <stat+0x26>
+    return -1;
+ 3bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3c4:	eb 25                	jmp    3eb <stat+0x4b>
+  r = fstat(fd, st);
+ 3c6:	83 ec 08             	sub    $0x8,%esp
+ 3c9:	ff 75 0c             	push   0xc(%ebp)
+ 3cc:	ff 75 f4             	push   -0xc(%ebp)
+ 3cf:	e8 03 01 00 00       	call   4d7 <fstat>
+ 3d4:	83 c4 10             	add    $0x10,%esp
+ 3d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3da:	83 ec 0c             	sub    $0xc,%esp
+ 3dd:	ff 75 f4             	push   -0xc(%ebp)
+ 3e0:	e8 c2 00 00 00       	call   4a7 <close>
+ 3e5:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+
+000003ed <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3ed:	55                   	push   %ebp
+ 3ee:	89 e5                	mov    %esp,%ebp
+ 3f0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3fa:	eb 25                	jmp    421 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3fc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3ff:	89 d0                	mov    %edx,%eax
+ 401:	c1 e0 02             	shl    $0x2,%eax
+ 404:	01 d0                	add    %edx,%eax
+ 406:	01 c0                	add    %eax,%eax
+ 408:	89 c1                	mov    %eax,%ecx
+ 40a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40d:	8d 50 01             	lea    0x1(%eax),%edx
+ 410:	89 55 08             	mov    %edx,0x8(%ebp)
+ 413:	0f b6 00             	movzbl (%eax),%eax
+ 416:	0f be c0             	movsbl %al,%eax
+ 419:	01 c8                	add    %ecx,%eax
+ 41b:	83 e8 30             	sub    $0x30,%eax
+ 41e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 421:	8b 45 08             	mov    0x8(%ebp),%eax
+ 424:	0f b6 00             	movzbl (%eax),%eax
+ 427:	3c 2f                	cmp    $0x2f,%al
+ 429:	7e 0a                	jle    435 <atoi+0x48>
+ 42b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42e:	0f b6 00             	movzbl (%eax),%eax
+ 431:	3c 39                	cmp    $0x39,%al
+ 433:	7e c7                	jle    3fc <atoi+0xf>
+  return n;
+ 435:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 438:	c9                   	leave
+ 439:	c3                   	ret
+
+0000043a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 43a:	55                   	push   %ebp
+ 43b:	89 e5                	mov    %esp,%ebp
+ 43d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 446:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 449:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 44c:	eb 17                	jmp    465 <memmove+0x2b>
+    *dst++ = *src++;
+ 44e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 451:	8d 42 01             	lea    0x1(%edx),%eax
+ 454:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 457:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 45a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 45d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 460:	0f b6 12             	movzbl (%edx),%edx
+ 463:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 46b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7f dc                	jg     44e <memmove+0x14>
+  return vdst;
+ 472:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 475:	c9                   	leave
+ 476:	c3                   	ret
+
+00000477 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 477:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <exit>:
+SYSCALL(exit)
+ 47f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <wait>:
+SYSCALL(wait)
+ 487:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <pipe>:
+SYSCALL(pipe)
+ 48f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <read>:
+SYSCALL(read)
+ 497:	b8 05 00 00 00       	mov    $0x5,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <write>:
+SYSCALL(write)
+ 49f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <close>:
+SYSCALL(close)
+ 4a7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <kill>:
+SYSCALL(kill)
+ 4af:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <exec>:
+SYSCALL(exec)
+ 4b7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <open>:
+SYSCALL(open)
+ 4bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <mknod>:
+SYSCALL(mknod)
+ 4c7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <unlink>:
+SYSCALL(unlink)
+ 4cf:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <fstat>:
+SYSCALL(fstat)
+ 4d7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <link>:
+SYSCALL(link)
+ 4df:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <mkdir>:
+SYSCALL(mkdir)
+ 4e7:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <chdir>:
+SYSCALL(chdir)
+ 4ef:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <dup>:
+SYSCALL(dup)
+ 4f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <getpid>:
+SYSCALL(getpid)
+ 4ff:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <sbrk>:
+SYSCALL(sbrk)
+ 507:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <sleep>:
+SYSCALL(sleep)
+ 50f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <uptime>:
+SYSCALL(uptime)
+ 517:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 51f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <getschedstat>:
+SYSCALL(getschedstat)
+ 527:	b8 17 00 00 00       	mov    $0x17,%eax
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 52f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 534:	cd 40                	int    $0x40
+ 536:	c3                   	ret
+
+00000537 <setshare>:
+SYSCALL(setshare)
+ 537:	b8 19 00 00 00       	mov    $0x19,%eax
+ 53c:	cd 40                	int    $0x40
+ 53e:	c3                   	ret
+
+0000053f <getbcachestat>:
+SYSCALL(getbcachestat)
+ 53f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 544:	cd 40                	int    $0x40
+ 546:	c3                   	ret
+
+00000547 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 547:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 54c:	cd 40                	int    $0x40
+ 54e:	c3                   	ret
+
+0000054f <getlogstat>:
+SYSCALL(getlogstat)
+ 54f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 554:	cd 40                	int    $0x40
+ 556:	c3                   	ret
+
+00000557 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 557:	55                   	push   %ebp
+ 558:	89 e5                	mov    %esp,%ebp
+ 55a:	83 ec 18             	sub    $0x18,%esp
+ 55d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 560:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 563:	83 ec 04             	sub    $0x4,%esp
+ 566:	6a 01                	push   $0x1
+ 568:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 56b:	50                   	push   %eax
+ 56c:	ff 75 08             	push   0x8(%ebp)
+ 56f:	e8 2b ff ff ff       	call   49f <write>
+ 574:	83 c4 10             	add    $0x10,%esp
+}
+ 577:	90                   	nop
+ 578:	c9                   	leave
+ 579:	c3                   	ret
+
+0000057a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+ 57d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 580:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 587:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 58b:	74 17                	je     5a4 <printint+0x2a>
+ 58d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 591:	79 11                	jns    5a4 <printint+0x2a>
+    neg = 1;
+ 593:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	f7 d8                	neg    %eax
+ 59f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5a2:	eb 06                	jmp    5aa <printint+0x30>
+  } else {
+    x = xx;
+ 5a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5b1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5bc:	f7 f1                	div    %ecx
+ 5be:	89 d1                	mov    %edx,%ecx
+ 5c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c3:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c9:	0f b6 91 e4 0d 00 00 	movzbl 0xde4(%ecx),%edx
+ 5d0:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5d4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5da:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5df:	f7 f1                	div    %ecx
+ 5e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5e8:	75 c7                	jne    5b1 <printint+0x37>
+  if(neg)
+ 5ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5ee:	74 2d                	je     61d <printint+0xa3>
+    buf[i++] = '-';
+ 5f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f3:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f9:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5fe:	eb 1d                	jmp    61d <printint+0xa3>
+    putc(fd, buf[i]);
+ 600:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 606:	01 d0                	add    %edx,%eax
+ 608:	0f b6 00             	movzbl (%eax),%eax
+ 60b:	0f be c0             	movsbl %al,%eax
+ 60e:	83 ec 08             	sub    $0x8,%esp
+ 611:	50                   	push   %eax
+ 612:	ff 75 08             	push   0x8(%ebp)
+ 615:	e8 3d ff ff ff       	call   557 <putc>
+ 61a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 61d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 621:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 625:	79 d9                	jns    600 <printint+0x86>
+}
+ 627:	90                   	nop
+ 628:	90                   	nop
+ 629:	c9                   	leave
+ 62a:	c3                   	ret
+
+0000062b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 62b:	55                   	push   %ebp
+ 62c:	89 e5                	mov    %esp,%ebp
+ 62e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 631:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 638:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 63b:	83 c0 04             	add    $0x4,%eax
+ 63e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 641:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 648:	e9 59 01 00 00       	jmp    7a6 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 64d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 650:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 653:	01 d0                	add    %edx,%eax
+ 655:	0f b6 00             	movzbl (%eax),%eax
+ 658:	0f be c0             	movsbl %al,%eax
+ 65b:	25 ff 00 00 00       	and    $0xff,%eax
+ 660:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 663:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 667:	75 2c                	jne    695 <printf+0x6a>
+      if(c == '%'){
+ 669:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 66d:	75 0c                	jne    67b <printf+0x50>
+        state = '%';
+ 66f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 676:	e9 27 01 00 00       	jmp    7a2 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 67b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 67e:	0f be c0             	movsbl %al,%eax
+ 681:	83 ec 08             	sub    $0x8,%esp
+ 684:	50                   	push   %eax
+ 685:	ff 75 08             	push   0x8(%ebp)
+ 688:	e8 ca fe ff ff       	call   557 <putc>
+ 68d:	83 c4 10             	add    $0x10,%esp
+ 690:	e9 0d 01 00 00       	jmp    7a2 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 695:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 699:	0f 85 03 01 00 00    	jne    7a2 <printf+0x177>
+      if(c == 'd'){
+ 69f:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6a3:	75 1e                	jne    6c3 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a8:	8b 00                	mov    (%eax),%eax
+ 6aa:	6a 01                	push   $0x1
+ 6ac:	6a 0a                	push   $0xa
+ 6ae:	50                   	push   %eax
+ 6af:	ff 75 08             	push   0x8(%ebp)
+ 6b2:	e8 c3 fe ff ff       	call   57a <printint>
+ 6b7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6ba:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6be:	e9 d8 00 00 00       	jmp    79b <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6c3:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c7:	74 06                	je     6cf <printf+0xa4>
+ 6c9:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6cd:	75 1e                	jne    6ed <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6cf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6d2:	8b 00                	mov    (%eax),%eax
+ 6d4:	6a 00                	push   $0x0
+ 6d6:	6a 10                	push   $0x10
+ 6d8:	50                   	push   %eax
+ 6d9:	ff 75 08             	push   0x8(%ebp)
+ 6dc:	e8 99 fe ff ff       	call   57a <printint>
+ 6e1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6e4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6e8:	e9 ae 00 00 00       	jmp    79b <printf+0x170>
+      } else if(c == 's'){
+ 6ed:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6f1:	75 43                	jne    736 <printf+0x10b>
+        s = (char*)*ap;
+ 6f3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f6:	8b 00                	mov    (%eax),%eax
+ 6f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6fb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6ff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 703:	75 25                	jne    72a <printf+0xff>
+          s = "(null)";
+ 705:	c7 45 f4 d4 0a 00 00 	movl   $0xad4,-0xc(%ebp)
+        while(*s != 0){
+ 70c:	eb 1c                	jmp    72a <printf+0xff>
+          putc(fd, *s);
+ 70e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 711:	0f b6 00             	movzbl (%eax),%eax
+ 714:	0f be c0             	movsbl %al,%eax
+ 717:	83 ec 08             	sub    $0x8,%esp
+ 71a:	50                   	push   %eax
+ 71b:	ff 75 08             	push   0x8(%ebp)
+ 71e:	e8 34 fe ff ff       	call   557 <putc>
+ 723:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 726:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 72a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72d:	0f b6 00             	movzbl (%eax),%eax
+ 730:	84 c0                	test   %al,%al
+ 732:	75 da                	jne    70e <printf+0xe3>
+ 734:	eb 65                	jmp    79b <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 736:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 73a:	75 1d                	jne    759 <printf+0x12e>
+        putc(fd, *ap);
+ 73c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73f:	8b 00                	mov    (%eax),%eax
+ 741:	0f be c0             	movsbl %al,%eax
+ 744:	83 ec 08             	sub    $0x8,%esp
+ 747:	50                   	push   %eax
+ 748:	ff 75 08             	push   0x8(%ebp)
+ 74b:	e8 07 fe ff ff       	call   557 <putc>
+ 750:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 753:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 757:	eb 42                	jmp    79b <printf+0x170>
+      } else if(c == '%'){
+ 759:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 75d:	75 17                	jne    776 <printf+0x14b>
+        putc(fd, c);
+ 75f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 762:	0f be c0             	movsbl %al,%eax
+ 765:	83 ec 08             	sub    $0x8,%esp
+ 768:	50                   	push   %eax
+ 769:	ff 75 08             	push   0x8(%ebp)
+ 76c:	e8 e6 fd ff ff       	call   557 <putc>
+ 771:	83 c4 10             	add    $0x10,%esp
+ 774:	eb 25                	jmp    79b <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 776:	83 ec 08             	sub    $0x8,%esp
+ 779:	6a 25                	push   $0x25
+ 77b:	ff 75 08             	push   0x8(%ebp)
+ 77e:	e8 d4 fd ff ff       	call   557 <putc>
+ 783:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 786:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 789:	0f be c0             	movsbl %al,%eax
+ 78c:	83 ec 08             	sub    $0x8,%esp
+ 78f:	50                   	push   %eax
+ 790:	ff 75 08             	push   0x8(%ebp)
+ 793:	e8 bf fd ff ff       	call   557 <putc>
+ 798:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 79b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7a2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ac:	01 d0                	add    %edx,%eax
+ 7ae:	0f b6 00             	movzbl (%eax),%eax
+ 7b1:	84 c0                	test   %al,%al
+ 7b3:	0f 85 94 fe ff ff    	jne    64d <printf+0x22>
+    }
+  }
+}
+ 7b9:	90                   	nop
+ 7ba:	90                   	nop
+ 7bb:	c9                   	leave
+ 7bc:	c3                   	ret
+
+000007bd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7bd:	55                   	push   %ebp
+ 7be:	89 e5                	mov    %esp,%ebp
+ 7c0:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c6:	83 e8 08             	sub    $0x8,%eax
+ 7c9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7cc:	a1 08 10 00 00       	mov    0x1008,%eax
+ 7d1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7d4:	eb 24                	jmp    7fa <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d9:	8b 00                	mov    (%eax),%eax
+ 7db:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7de:	72 12                	jb     7f2 <free+0x35>
+ 7e0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7e6:	72 24                	jb     80c <free+0x4f>
+ 7e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7eb:	8b 00                	mov    (%eax),%eax
+ 7ed:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7f0:	72 1a                	jb     80c <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f5:	8b 00                	mov    (%eax),%eax
+ 7f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7fa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7fd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 800:	73 d4                	jae    7d6 <free+0x19>
+ 802:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 805:	8b 00                	mov    (%eax),%eax
+ 807:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 80a:	73 ca                	jae    7d6 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 80c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80f:	8b 40 04             	mov    0x4(%eax),%eax
+ 812:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 819:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 81c:	01 c2                	add    %eax,%edx
+ 81e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 821:	8b 00                	mov    (%eax),%eax
+ 823:	39 c2                	cmp    %eax,%edx
+ 825:	75 24                	jne    84b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 827:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82a:	8b 50 04             	mov    0x4(%eax),%edx
+ 82d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 830:	8b 00                	mov    (%eax),%eax
+ 832:	8b 40 04             	mov    0x4(%eax),%eax
+ 835:	01 c2                	add    %eax,%edx
+ 837:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 83d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 840:	8b 00                	mov    (%eax),%eax
+ 842:	8b 10                	mov    (%eax),%edx
+ 844:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 847:	89 10                	mov    %edx,(%eax)
+ 849:	eb 0a                	jmp    855 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 84b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84e:	8b 10                	mov    (%eax),%edx
+ 850:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 853:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 855:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 858:	8b 40 04             	mov    0x4(%eax),%eax
+ 85b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 862:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 865:	01 d0                	add    %edx,%eax
+ 867:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 86a:	75 20                	jne    88c <free+0xcf>
+    p->s.size += bp->s.size;
+ 86c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86f:	8b 50 04             	mov    0x4(%eax),%edx
+ 872:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 875:	8b 40 04             	mov    0x4(%eax),%eax
+ 878:	01 c2                	add    %eax,%edx
+ 87a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 880:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 883:	8b 10                	mov    (%eax),%edx
+ 885:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 888:	89 10                	mov    %edx,(%eax)
+ 88a:	eb 08                	jmp    894 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 88c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 892:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 894:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 897:	a3 08 10 00 00       	mov    %eax,0x1008
+}
+ 89c:	90                   	nop
+ 89d:	c9                   	leave
+ 89e:	c3                   	ret
+
+0000089f <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 89f:	55                   	push   %ebp
+ 8a0:	89 e5                	mov    %esp,%ebp
+ 8a2:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8a5:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8ac:	77 07                	ja     8b5 <morecore+0x16>
+    nu = 4096;
+ 8ae:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b8:	c1 e0 03             	shl    $0x3,%eax
+ 8bb:	83 ec 0c             	sub    $0xc,%esp
+ 8be:	50                   	push   %eax
+ 8bf:	e8 43 fc ff ff       	call   507 <sbrk>
+ 8c4:	83 c4 10             	add    $0x10,%esp
+ 8c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8ca:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8ce:	75 07                	jne    8d7 <morecore+0x38>
+    return 0;
+ 8d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8d5:	eb 26                	jmp    8fd <morecore+0x5e>
+  hp = (Header*)p;
+ 8d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8da:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e0:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8e3:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e9:	83 c0 08             	add    $0x8,%eax
+ 8ec:	83 ec 0c             	sub    $0xc,%esp
+ 8ef:	50                   	push   %eax
+ 8f0:	e8 c8 fe ff ff       	call   7bd <free>
+ 8f5:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8f8:	a1 08 10 00 00       	mov    0x1008,%eax
+}
+ 8fd:	c9                   	leave
+ 8fe:	c3                   	ret
+
+000008ff <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8ff:	55                   	push   %ebp
+ 900:	89 e5                	mov    %esp,%ebp
+ 902:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 905:	8b 45 08             	mov    0x8(%ebp),%eax
+ 908:	83 c0 07             	add    $0x7,%eax
+ 90b:	c1 e8 03             	shr    $0x3,%eax
+ 90e:	83 c0 01             	add    $0x1,%eax
+ 911:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 914:	a1 08 10 00 00       	mov    0x1008,%eax
+ 919:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 91c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 920:	75 23                	jne    945 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 922:	c7 45 f0 00 10 00 00 	movl   $0x1000,-0x10(%ebp)
+ 929:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92c:	a3 08 10 00 00       	mov    %eax,0x1008
+ 931:	a1 08 10 00 00       	mov    0x1008,%eax
+ 936:	a3 00 10 00 00       	mov    %eax,0x1000
+    base.s.size = 0;
+ 93b:	c7 05 04 10 00 00 00 	movl   $0x0,0x1004
+ 942:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 945:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 948:	8b 00                	mov    (%eax),%eax
+ 94a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 94d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 950:	8b 40 04             	mov    0x4(%eax),%eax
+ 953:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 956:	72 4d                	jb     9a5 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 958:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95b:	8b 40 04             	mov    0x4(%eax),%eax
+ 95e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 961:	75 0c                	jne    96f <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 963:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 966:	8b 10                	mov    (%eax),%edx
+ 968:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96b:	89 10                	mov    %edx,(%eax)
+ 96d:	eb 26                	jmp    995 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 96f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 972:	8b 40 04             	mov    0x4(%eax),%eax
+ 975:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 978:	89 c2                	mov    %eax,%edx
+ 97a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 980:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 983:	8b 40 04             	mov    0x4(%eax),%eax
+ 986:	c1 e0 03             	shl    $0x3,%eax
+ 989:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 98c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 992:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 995:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 998:	a3 08 10 00 00       	mov    %eax,0x1008
+      return (void*)(p + 1);
+ 99d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a0:	83 c0 08             	add    $0x8,%eax
+ 9a3:	eb 3b                	jmp    9e0 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9a5:	a1 08 10 00 00       	mov    0x1008,%eax
+ 9aa:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9ad:	75 1e                	jne    9cd <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9af:	83 ec 0c             	sub    $0xc,%esp
+ 9b2:	ff 75 ec             	push   -0x14(%ebp)
+ 9b5:	e8 e5 fe ff ff       	call   89f <morecore>
+ 9ba:	83 c4 10             	add    $0x10,%esp
+ 9bd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9c0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c4:	75 07                	jne    9cd <malloc+0xce>
+        return 0;
+ 9c6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9cb:	eb 13                	jmp    9e0 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d6:	8b 00                	mov    (%eax),%eax
+ 9d8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9db:	e9 6d ff ff ff       	jmp    94d <malloc+0x4e>
+  }
+}
+ 9e0:	c9                   	leave
+ 9e1:	c3                   	ret
+
+000009e2 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 9e2:	55                   	push   %ebp
+ 9e3:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 9e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9e8:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 9eb:	7e 08                	jle    9f5 <ticks+0x13>
+ 9ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9f0:	2b 45 08             	sub    0x8(%ebp),%eax
+ 9f3:	eb 05                	jmp    9fa <ticks+0x18>
+ 9f5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 9fa:	5d                   	pop    %ebp
+ 9fb:	c3                   	ret
+
+000009fc <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 9fc:	55                   	push   %ebp
+ 9fd:	89 e5                	mov    %esp,%ebp
+ 9ff:	53                   	push   %ebx
+ a00:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ a03:	8b 45 08             	mov    0x8(%ebp),%eax
+ a06:	6b d8 64             	imul   $0x64,%eax,%ebx
+ a09:	ff 75 14             	push   0x14(%ebp)
+ a0c:	ff 75 10             	push   0x10(%ebp)
+ a0f:	e8 ce ff ff ff       	call   9e2 <ticks>
+ a14:	83 c4 08             	add    $0x8,%esp
+ a17:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ a19:	89 d8                	mov    %ebx,%eax
+ a1b:	99                   	cltd
+ a1c:	f7 f9                	idiv   %ecx
+ a1e:	89 c2                	mov    %eax,%edx
+ a20:	8b 45 14             	mov    0x14(%ebp),%eax
+ a23:	2b 45 10             	sub    0x10(%ebp),%eax
+ a26:	83 ec 04             	sub    $0x4,%esp
+ a29:	ff 75 0c             	push   0xc(%ebp)
+ a2c:	52                   	push   %edx
+ a2d:	50                   	push   %eax
+ a2e:	ff 75 0c             	push   0xc(%ebp)
+ a31:	ff 75 08             	push   0x8(%ebp)
+ a34:	68 dc 0a 00 00       	push   $0xadc
+ a39:	6a 01                	push   $0x1
+ a3b:	e8 eb fb ff ff       	call   62b <printf>
+ a40:	83 c4 20             	add    $0x20,%esp
+}
+ a43:	90                   	nop
+ a44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a47:	c9                   	leave
+ a48:	c3                   	ret
+
+00000a49 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ a49:	55                   	push   %ebp
+ a4a:	89 e5                	mov    %esp,%ebp
+ a4c:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ a4f:	ff 75 14             	push   0x14(%ebp)
+ a52:	ff 75 10             	push   0x10(%ebp)
+ a55:	e8 88 ff ff ff       	call   9e2 <ticks>
+ a5a:	83 c4 08             	add    $0x8,%esp
+ a5d:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ a63:	99                   	cltd
+ a64:	f7 7d 08             	idivl  0x8(%ebp)
+ a67:	89 c2                	mov    %eax,%edx
+ a69:	8b 45 14             	mov    0x14(%ebp),%eax
+ a6c:	2b 45 10             	sub    0x10(%ebp),%eax
+ a6f:	83 ec 08             	sub    $0x8,%esp
+ a72:	52                   	push   %edx
+ a73:	50                   	push   %eax
+ a74:	ff 75 0c             	push   0xc(%ebp)
+ a77:	ff 75 08             	push   0x8(%ebp)
+ a7a:	68 fc 0a 00 00       	push   $0xafc
+ a7f:	6a 01                	push   $0x1
+ a81:	e8 a5 fb ff ff       	call   62b <printf>
+ a86:	83 c4 20             	add    $0x20,%esp
+}
+ a89:	90                   	nop
+ a8a:	c9                   	leave
+ a8b:	c3                   	ret
@@ -0,0 +1,66 @@
+// Block allocator benchmark.
+//
+// Like usertests' fsfull: creates files and appends 512-byte
+// blocks to each, until it holds NBLOCK blocks, until the disk
+// is full, then deletes them.  Every block written
+// is a balloc(), so the time per block shows how allocation
+// cost grows as the disk fills.  Reports each file's write
+// rate and the totals.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define NFILE 100
+#define NBLOCK 1000
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+  strcpy(s, "fill.00");
+  s[5] = '0' + i / 10;
+  s[6] = '0' + i % 10;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[16];
+  int i, fd, n, nfile, tot, t0, t1, t2;
+
+  printf(1, "fillbench starting\n");
+  memset(buf, 'x', sizeof(buf));
+  tot = 0;
+  t0 = uptime();
+  for(nfile = 0; nfile < NFILE; nfile++){
+    name(path, nfile);
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+      break;
+    t1 = uptime();
+    for(n = 0; n < NBLOCK && write(fd, buf, sizeof(buf)) == sizeof(buf); n++)
+      ;
+    t2 = uptime();
+    close(fd);
+    tot += n;
+    printf(1, "%s: ", path);
+    benchrate(n, "blocks", t1, t2);
+    if(n == 0){
+      nfile++;
+      break;
+    }
+  }
+  t1 = uptime();
+  for(i = 0; i < nfile; i++){
+    name(path, i);
+    unlink(path);
+  }
+  t2 = uptime();
+
+  printf(1, "%d files: ", nfile);
+  benchrate(tot, "blocks", t0, t1);
+  printf(1, "deleted in %d ticks\n", t2 - t1);
+  exit();
+}
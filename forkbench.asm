@@ -0,0 +1,1391 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <run>:
+
+char *childargv[] = { "forkbench", "child", 0 };
+
+void
+run(int npage)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, pid, t0, t1;
+  char *p;
+
+  p = sbrk(npage * PGSIZE);
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	c1 e0 0c             	shl    $0xc,%eax
+   c:	83 ec 0c             	sub    $0xc,%esp
+   f:	50                   	push   %eax
+  10:	e8 65 04 00 00       	call   47a <sbrk>
+  15:	83 c4 10             	add    $0x10,%esp
+  18:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(p == (char*)-1){
+  1b:	83 7d f0 ff          	cmpl   $0xffffffff,-0x10(%ebp)
+  1f:	75 17                	jne    38 <run+0x38>
+    printf(1, "forkbench: sbrk failed\n");
+  21:	83 ec 08             	sub    $0x8,%esp
+  24:	68 10 0a 00 00       	push   $0xa10
+  29:	6a 01                	push   $0x1
+  2b:	e8 6e 05 00 00       	call   59e <printf>
+  30:	83 c4 10             	add    $0x10,%esp
+    exit();
+  33:	e8 ba 03 00 00       	call   3f2 <exit>
+  }
+  for(i = 0; i < npage; i++)
+  38:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  3f:	eb 16                	jmp    57 <run+0x57>
+    p[i * PGSIZE] = i;
+  41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  44:	c1 e0 0c             	shl    $0xc,%eax
+  47:	89 c2                	mov    %eax,%edx
+  49:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  4c:	01 d0                	add    %edx,%eax
+  4e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  51:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < npage; i++)
+  53:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5a:	3b 45 08             	cmp    0x8(%ebp),%eax
+  5d:	7c e2                	jl     41 <run+0x41>
+
+  t0 = uptime();
+  5f:	e8 26 04 00 00       	call   48a <uptime>
+  64:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < NFORK; i++){
+  67:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  6e:	eb 60                	jmp    d0 <run+0xd0>
+    pid = fork();
+  70:	e8 75 03 00 00       	call   3ea <fork>
+  75:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(pid < 0){
+  78:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  7c:	79 17                	jns    95 <run+0x95>
+      printf(1, "forkbench: fork failed\n");
+  7e:	83 ec 08             	sub    $0x8,%esp
+  81:	68 28 0a 00 00       	push   $0xa28
+  86:	6a 01                	push   $0x1
+  88:	e8 11 05 00 00       	call   59e <printf>
+  8d:	83 c4 10             	add    $0x10,%esp
+      exit();
+  90:	e8 5d 03 00 00       	call   3f2 <exit>
+    }
+    if(pid == 0){
+  95:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  99:	75 2c                	jne    c7 <run+0xc7>
+      exec("forkbench", childargv);
+  9b:	83 ec 08             	sub    $0x8,%esp
+  9e:	68 a4 0d 00 00       	push   $0xda4
+  a3:	68 00 0a 00 00       	push   $0xa00
+  a8:	e8 7d 03 00 00       	call   42a <exec>
+  ad:	83 c4 10             	add    $0x10,%esp
+      printf(1, "forkbench: exec failed\n");
+  b0:	83 ec 08             	sub    $0x8,%esp
+  b3:	68 40 0a 00 00       	push   $0xa40
+  b8:	6a 01                	push   $0x1
+  ba:	e8 df 04 00 00       	call   59e <printf>
+  bf:	83 c4 10             	add    $0x10,%esp
+      exit();
+  c2:	e8 2b 03 00 00       	call   3f2 <exit>
+    }
+    wait();
+  c7:	e8 2e 03 00 00       	call   3fa <wait>
+  for(i = 0; i < NFORK; i++){
+  cc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d0:	83 7d f4 31          	cmpl   $0x31,-0xc(%ebp)
+  d4:	7e 9a                	jle    70 <run+0x70>
+  }
+  t1 = uptime();
+  d6:	e8 af 03 00 00       	call   48a <uptime>
+  db:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  sbrk(-npage * PGSIZE);
+  de:	8b 55 08             	mov    0x8(%ebp),%edx
+  e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  e6:	29 d0                	sub    %edx,%eax
+  e8:	c1 e0 0c             	shl    $0xc,%eax
+  eb:	83 ec 0c             	sub    $0xc,%esp
+  ee:	50                   	push   %eax
+  ef:	e8 86 03 00 00       	call   47a <sbrk>
+  f4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "heap %d KB: ", npage * 4);
+  f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  fa:	c1 e0 02             	shl    $0x2,%eax
+  fd:	83 ec 04             	sub    $0x4,%esp
+ 100:	50                   	push   %eax
+ 101:	68 58 0a 00 00       	push   $0xa58
+ 106:	6a 01                	push   $0x1
+ 108:	e8 91 04 00 00       	call   59e <printf>
+ 10d:	83 c4 10             	add    $0x10,%esp
+  benchtime(NFORK, "fork+execs", t0, t1);
+ 110:	ff 75 e8             	push   -0x18(%ebp)
+ 113:	ff 75 ec             	push   -0x14(%ebp)
+ 116:	68 65 0a 00 00       	push   $0xa65
+ 11b:	6a 32                	push   $0x32
+ 11d:	e8 9a 08 00 00       	call   9bc <benchtime>
+ 122:	83 c4 10             	add    $0x10,%esp
+}
+ 125:	90                   	nop
+ 126:	c9                   	leave
+ 127:	c3                   	ret
+
+00000128 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 128:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 12c:	83 e4 f0             	and    $0xfffffff0,%esp
+ 12f:	ff 71 fc             	push   -0x4(%ecx)
+ 132:	55                   	push   %ebp
+ 133:	89 e5                	mov    %esp,%ebp
+ 135:	51                   	push   %ecx
+ 136:	83 ec 04             	sub    $0x4,%esp
+ 139:	89 c8                	mov    %ecx,%eax
+  if(argc > 1)
+ 13b:	83 38 01             	cmpl   $0x1,(%eax)
+ 13e:	7e 05                	jle    145 <main+0x1d>
+    exit();
+ 140:	e8 ad 02 00 00       	call   3f2 <exit>
+
+  printf(1, "forkbench starting\n");
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	68 70 0a 00 00       	push   $0xa70
+ 14d:	6a 01                	push   $0x1
+ 14f:	e8 4a 04 00 00       	call   59e <printf>
+ 154:	83 c4 10             	add    $0x10,%esp
+  run(0);
+ 157:	83 ec 0c             	sub    $0xc,%esp
+ 15a:	6a 00                	push   $0x0
+ 15c:	e8 9f fe ff ff       	call   0 <run>
+ 161:	83 c4 10             	add    $0x10,%esp
+  run(256);
+ 164:	83 ec 0c             	sub    $0xc,%esp
+ 167:	68 00 01 00 00       	push   $0x100
+ 16c:	e8 8f fe ff ff       	call   0 <run>
+ 171:	83 c4 10             	add    $0x10,%esp
+  run(1024);
+ 174:	83 ec 0c             	sub    $0xc,%esp
+ 177:	68 00 04 00 00       	push   $0x400
+ 17c:	e8 7f fe ff ff       	call   0 <run>
+ 181:	83 c4 10             	add    $0x10,%esp
+  printf(1, "forkbench done\n");
+ 184:	83 ec 08             	sub    $0x8,%esp
+ 187:	68 84 0a 00 00       	push   $0xa84
+ 18c:	6a 01                	push   $0x1
+ 18e:	e8 0b 04 00 00       	call   59e <printf>
+ 193:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 196:	e8 57 02 00 00       	call   3f2 <exit>
+
+0000019b <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 19b:	55                   	push   %ebp
+ 19c:	89 e5                	mov    %esp,%ebp
+ 19e:	57                   	push   %edi
+ 19f:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 1a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a9:	89 cb                	mov    %ecx,%ebx
+ 1ab:	89 df                	mov    %ebx,%edi
+ 1ad:	89 d1                	mov    %edx,%ecx
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+ 1b2:	89 ca                	mov    %ecx,%edx
+ 1b4:	89 fb                	mov    %edi,%ebx
+ 1b6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1b9:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 1bc:	90                   	nop
+ 1bd:	5b                   	pop    %ebx
+ 1be:	5f                   	pop    %edi
+ 1bf:	5d                   	pop    %ebp
+ 1c0:	c3                   	ret
+
+000001c1 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1c1:	55                   	push   %ebp
+ 1c2:	89 e5                	mov    %esp,%ebp
+ 1c4:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ca:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1cd:	90                   	nop
+ 1ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1d1:	8d 42 01             	lea    0x1(%edx),%eax
+ 1d4:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1da:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1dd:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1e0:	0f b6 12             	movzbl (%edx),%edx
+ 1e3:	88 10                	mov    %dl,(%eax)
+ 1e5:	0f b6 00             	movzbl (%eax),%eax
+ 1e8:	84 c0                	test   %al,%al
+ 1ea:	75 e2                	jne    1ce <strcpy+0xd>
+    ;
+  return os;
+ 1ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1f4:	eb 08                	jmp    1fe <strcmp+0xd>
+    p++, q++;
+ 1f6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1fa:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	0f b6 00             	movzbl (%eax),%eax
+ 204:	84 c0                	test   %al,%al
+ 206:	74 10                	je     218 <strcmp+0x27>
+ 208:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20b:	0f b6 10             	movzbl (%eax),%edx
+ 20e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 211:	0f b6 00             	movzbl (%eax),%eax
+ 214:	38 c2                	cmp    %al,%dl
+ 216:	74 de                	je     1f6 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 218:	8b 45 08             	mov    0x8(%ebp),%eax
+ 21b:	0f b6 00             	movzbl (%eax),%eax
+ 21e:	0f b6 d0             	movzbl %al,%edx
+ 221:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 224:	0f b6 00             	movzbl (%eax),%eax
+ 227:	0f b6 c0             	movzbl %al,%eax
+ 22a:	29 c2                	sub    %eax,%edx
+ 22c:	89 d0                	mov    %edx,%eax
+}
+ 22e:	5d                   	pop    %ebp
+ 22f:	c3                   	ret
+
+00000230 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 23d:	eb 04                	jmp    243 <strlen+0x13>
+ 23f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 243:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 246:	8b 45 08             	mov    0x8(%ebp),%eax
+ 249:	01 d0                	add    %edx,%eax
+ 24b:	0f b6 00             	movzbl (%eax),%eax
+ 24e:	84 c0                	test   %al,%al
+ 250:	75 ed                	jne    23f <strlen+0xf>
+    ;
+  return n;
+ 252:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 255:	c9                   	leave
+ 256:	c3                   	ret
+
+00000257 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 257:	55                   	push   %ebp
+ 258:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 25a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 25d:	50                   	push   %eax
+ 25e:	ff 75 0c             	push   0xc(%ebp)
+ 261:	ff 75 08             	push   0x8(%ebp)
+ 264:	e8 32 ff ff ff       	call   19b <stosb>
+ 269:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 26f:	c9                   	leave
+ 270:	c3                   	ret
+
+00000271 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 271:	55                   	push   %ebp
+ 272:	89 e5                	mov    %esp,%ebp
+ 274:	83 ec 04             	sub    $0x4,%esp
+ 277:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 27d:	eb 14                	jmp    293 <strchr+0x22>
+    if(*s == c)
+ 27f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 282:	0f b6 00             	movzbl (%eax),%eax
+ 285:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 288:	75 05                	jne    28f <strchr+0x1e>
+      return (char*)s;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	eb 13                	jmp    2a2 <strchr+0x31>
+  for(; *s; s++)
+ 28f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	84 c0                	test   %al,%al
+ 29b:	75 e2                	jne    27f <strchr+0xe>
+  return 0;
+ 29d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2a2:	c9                   	leave
+ 2a3:	c3                   	ret
+
+000002a4 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a4:	55                   	push   %ebp
+ 2a5:	89 e5                	mov    %esp,%ebp
+ 2a7:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2b1:	eb 42                	jmp    2f5 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2b3:	83 ec 04             	sub    $0x4,%esp
+ 2b6:	6a 01                	push   $0x1
+ 2b8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2bb:	50                   	push   %eax
+ 2bc:	6a 00                	push   $0x0
+ 2be:	e8 47 01 00 00       	call   40a <read>
+ 2c3:	83 c4 10             	add    $0x10,%esp
+ 2c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2c9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2cd:	7e 33                	jle    302 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2d2:	8d 50 01             	lea    0x1(%eax),%edx
+ 2d5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2d8:	89 c2                	mov    %eax,%edx
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2dd:	01 c2                	add    %eax,%edx
+ 2df:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e3:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2e5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e9:	3c 0a                	cmp    $0xa,%al
+ 2eb:	74 16                	je     303 <gets+0x5f>
+ 2ed:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2f1:	3c 0d                	cmp    $0xd,%al
+ 2f3:	74 0e                	je     303 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f8:	83 c0 01             	add    $0x1,%eax
+ 2fb:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2fe:	7f b3                	jg     2b3 <gets+0xf>
+ 300:	eb 01                	jmp    303 <gets+0x5f>
+      break;
+ 302:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 306:	8b 45 08             	mov    0x8(%ebp),%eax
+ 309:	01 d0                	add    %edx,%eax
+ 30b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 30e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	6a 00                	push   $0x0
+ 31e:	ff 75 08             	push   0x8(%ebp)
+ 321:	e8 0c 01 00 00       	call   432 <open>
+ 326:	83 c4 10             	add    $0x10,%esp
+ 329:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 32c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 330:	79 07                	jns    339 <stat+0x26>
+    return -1;
+ 332:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 337:	eb 25                	jmp    35e <stat+0x4b>
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	ff 75 f4             	push   -0xc(%ebp)
+ 342:	e8 03 01 00 00       	call   44a <fstat>
+ 347:	83 c4 10             	add    $0x10,%esp
+ 34a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 34d:	83 ec 0c             	sub    $0xc,%esp
+ 350:	ff 75 f4             	push   -0xc(%ebp)
+ 353:	e8 c2 00 00 00       	call   41a <close>
+ 358:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 35b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 35e:	c9                   	leave
+ 35f:	c3                   	ret
+
+00000360 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 366:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 36d:	eb 25                	jmp    394 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 36f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 372:	89 d0                	mov    %edx,%eax
+ 374:	c1 e0 02             	shl    $0x2,%eax
+ 377:	01 d0                	add    %edx,%eax
+ 379:	01 c0                	add    %eax,%eax
+ 37b:	89 c1                	mov    %eax,%ecx
+ 37d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 380:	8d 50 01             	lea    0x1(%eax),%edx
+ 383:	89 55 08             	mov    %edx,0x8(%ebp)
+ 386:	0f b6 00             	movzbl (%eax),%eax
+ 389:	0f be c0             	movsbl %al,%eax
+ 38c:	01 c8                	add    %ecx,%eax
+ 38e:	83 e8 30             	sub    $0x30,%eax
+ 391:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 394:	8b 45 08             	mov    0x8(%ebp),%eax
+ 397:	0f b6 00             	movzbl (%eax),%eax
+ 39a:	3c 2f                	cmp    $0x2f,%al
+ 39c:	7e 0a                	jle    3a8 <atoi+0x48>
+ 39e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a1:	0f b6 00             	movzbl (%eax),%eax
+ 3a4:	3c 39                	cmp    $0x39,%al
+ 3a6:	7e c7                	jle    36f <atoi+0xf>
+  return n;
+ 3a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ab:	c9                   	leave
+ 3ac:	c3                   	ret
+
+000003ad <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3ad:	55                   	push   %ebp
+ 3ae:	89 e5                	mov    %esp,%ebp
+ 3b0:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3bf:	eb 17                	jmp    3d8 <memmove+0x2b>
+    *dst++ = *src++;
+ 3c1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3c4:	8d 42 01             	lea    0x1(%edx),%eax
+ 3c7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3cd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3d0:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3d3:	0f b6 12             	movzbl (%edx),%edx
+ 3d6:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3d8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3db:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3de:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3e1:	85 c0                	test   %eax,%eax
+ 3e3:	7f dc                	jg     3c1 <memmove+0x14>
+  return vdst;
+ 3e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+
+000003ea <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3ea:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <exit>:
+SYSCALL(exit)
+ 3f2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <wait>:
+SYSCALL(wait)
+ 3fa:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <pipe>:
+SYSCALL(pipe)
+ 402:	b8 04 00 00 00       	mov    $0x4,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <read>:
+SYSCALL(read)
+ 40a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <write>:
+SYSCALL(write)
+ 412:	b8 10 00 00 00       	mov    $0x10,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <close>:
+SYSCALL(close)
+ 41a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <kill>:
+SYSCALL(kill)
+ 422:	b8 06 00 00 00       	mov    $0x6,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <exec>:
+SYSCALL(exec)
+ 42a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <open>:
+SYSCALL(open)
+ 432:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <mknod>:
+SYSCALL(mknod)
+ 43a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <unlink>:
+SYSCALL(unlink)
+ 442:	b8 12 00 00 00       	mov    $0x12,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <fstat>:
+SYSCALL(fstat)
+ 44a:	b8 08 00 00 00       	mov    $0x8,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <link>:
+SYSCALL(link)
+ 452:	b8 13 00 00 00       	mov    $0x13,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <mkdir>:
+SYSCALL(mkdir)
+ 45a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <chdir>:
+SYSCALL(chdir)
+ 462:	b8 09 00 00 00       	mov    $0x9,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <dup>:
+SYSCALL(dup)
+ 46a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <getpid>:
+SYSCALL(getpid)
+ 472:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <sbrk>:
+SYSCALL(sbrk)
+ 47a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <sleep>:
+SYSCALL(sleep)
+ 482:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <uptime>:
+SYSCALL(uptime)
+ 48a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 492:	b8 16 00 00 00       	mov    $0x16,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <getschedstat>:
+SYSCALL(getschedstat)
+ 49a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 4a2:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <setshare>:
+SYSCALL(setshare)
+ 4aa:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4af:	cd 40                	int    $0x40
+ 4b1:	c3                   	ret
+
+000004b2 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 4b2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4b7:	cd 40                	int    $0x40
+ 4b9:	c3                   	ret
+
+000004ba <getdiskstat>:
+SYSCALL(getdiskstat)
+ 4ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4bf:	cd 40                	int    $0x40
+ 4c1:	c3                   	ret
+
+000004c2 <getlogstat>:
+SYSCALL(getlogstat)
+ 4c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4c7:	cd 40                	int    $0x40
+ 4c9:	c3                   	ret
+
+000004ca <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4ca:	55                   	push   %ebp
+ 4cb:	89 e5                	mov    %esp,%ebp
+ 4cd:	83 ec 18             	sub    $0x18,%esp
+ 4d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d3:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4d6:	83 ec 04             	sub    $0x4,%esp
+ 4d9:	6a 01                	push   $0x1
+ 4db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4de:	50                   	push   %eax
+ 4df:	ff 75 08             	push   0x8(%ebp)
+ 4e2:	e8 2b ff ff ff       	call   412 <write>
+ 4e7:	83 c4 10             	add    $0x10,%esp
+}
+ 4ea:	90                   	nop
+ 4eb:	c9                   	leave
+ 4ec:	c3                   	ret
+
+000004ed <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4ed:	55                   	push   %ebp
+ 4ee:	89 e5                	mov    %esp,%ebp
+ 4f0:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4f3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4fa:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4fe:	74 17                	je     517 <printint+0x2a>
+ 500:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 504:	79 11                	jns    517 <printint+0x2a>
+    neg = 1;
+ 506:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 50d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 510:	f7 d8                	neg    %eax
+ 512:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 515:	eb 06                	jmp    51d <printint+0x30>
+  } else {
+    x = xx;
+ 517:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 51d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 524:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 527:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 52a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 52f:	f7 f1                	div    %ecx
+ 531:	89 d1                	mov    %edx,%ecx
+ 533:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 536:	8d 50 01             	lea    0x1(%eax),%edx
+ 539:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 53c:	0f b6 91 b0 0d 00 00 	movzbl 0xdb0(%ecx),%edx
+ 543:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 547:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 54a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 54d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 552:	f7 f1                	div    %ecx
+ 554:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 557:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 55b:	75 c7                	jne    524 <printint+0x37>
+  if(neg)
+ 55d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 561:	74 2d                	je     590 <printint+0xa3>
+    buf[i++] = '-';
+ 563:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 566:	8d 50 01             	lea    0x1(%eax),%edx
+ 569:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 56c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 571:	eb 1d                	jmp    590 <printint+0xa3>
+    putc(fd, buf[i]);
+ 573:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 576:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 579:	01 d0                	add    %edx,%eax
+ 57b:	0f b6 00             	movzbl (%eax),%eax
+ 57e:	0f be c0             	movsbl %al,%eax
+ 581:	83 ec 08             	sub    $0x8,%esp
+ 584:	50                   	push   %eax
+ 585:	ff 75 08             	push   0x8(%ebp)
+ 588:	e8 3d ff ff ff       	call   4ca <putc>
+ 58d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 590:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 594:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 598:	79 d9                	jns    573 <printint+0x86>
+}
+ 59a:	90                   	nop
+ 59b:	90                   	nop
+ 59c:	c9                   	leave
+ 59d:	c3                   	ret
+
+0000059e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 59e:	55                   	push   %ebp
+ 59f:	89 e5                	mov    %esp,%ebp
+ 5a1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5a4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5ab:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5ae:	83 c0 04             	add    $0x4,%eax
+ 5b1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5b4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5bb:	e9 59 01 00 00       	jmp    719 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5c3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5c6:	01 d0                	add    %edx,%eax
+ 5c8:	0f b6 00             	movzbl (%eax),%eax
+ 5cb:	0f be c0             	movsbl %al,%eax
+ 5ce:	25 ff 00 00 00       	and    $0xff,%eax
+ 5d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5da:	75 2c                	jne    608 <printf+0x6a>
+      if(c == '%'){
+ 5dc:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5e0:	75 0c                	jne    5ee <printf+0x50>
+        state = '%';
+ 5e2:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5e9:	e9 27 01 00 00       	jmp    715 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f1:	0f be c0             	movsbl %al,%eax
+ 5f4:	83 ec 08             	sub    $0x8,%esp
+ 5f7:	50                   	push   %eax
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 ca fe ff ff       	call   4ca <putc>
+ 600:	83 c4 10             	add    $0x10,%esp
+ 603:	e9 0d 01 00 00       	jmp    715 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 608:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 60c:	0f 85 03 01 00 00    	jne    715 <printf+0x177>
+      if(c == 'd'){
+ 612:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 616:	75 1e                	jne    636 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 618:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 61b:	8b 00                	mov    (%eax),%eax
+ 61d:	6a 01                	push   $0x1
+ 61f:	6a 0a                	push   $0xa
+ 621:	50                   	push   %eax
+ 622:	ff 75 08             	push   0x8(%ebp)
+ 625:	e8 c3 fe ff ff       	call   4ed <printint>
+ 62a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 631:	e9 d8 00 00 00       	jmp    70e <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 636:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 63a:	74 06                	je     642 <printf+0xa4>
+ 63c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 640:	75 1e                	jne    660 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 642:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 645:	8b 00                	mov    (%eax),%eax
+ 647:	6a 00                	push   $0x0
+ 649:	6a 10                	push   $0x10
+ 64b:	50                   	push   %eax
+ 64c:	ff 75 08             	push   0x8(%ebp)
+ 64f:	e8 99 fe ff ff       	call   4ed <printint>
+ 654:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 657:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 65b:	e9 ae 00 00 00       	jmp    70e <printf+0x170>
+      } else if(c == 's'){
+ 660:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 664:	75 43                	jne    6a9 <printf+0x10b>
+        s = (char*)*ap;
+ 666:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 669:	8b 00                	mov    (%eax),%eax
+ 66b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 66e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 672:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 676:	75 25                	jne    69d <printf+0xff>
+          s = "(null)";
+ 678:	c7 45 f4 94 0a 00 00 	movl   $0xa94,-0xc(%ebp)
+        while(*s != 0){
+ 67f:	eb 1c                	jmp    69d <printf+0xff>
+          putc(fd, *s);
+ 681:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 684:	0f b6 00             	movzbl (%eax),%eax
+ 687:	0f be c0             	movsbl %al,%eax
+ 68a:	83 ec 08             	sub    $0x8,%esp
+ 68d:	50                   	push   %eax
+ 68e:	ff 75 08             	push   0x8(%ebp)
+ 691:	e8 34 fe ff ff       	call   4ca <putc>
+ 696:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 699:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 69d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a0:	0f b6 00             	movzbl (%eax),%eax
+ 6a3:	84 c0                	test   %al,%al
+ 6a5:	75 da                	jne    681 <printf+0xe3>
+ 6a7:	eb 65                	jmp    70e <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6a9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6ad:	75 1d                	jne    6cc <printf+0x12e>
+        putc(fd, *ap);
+ 6af:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b2:	8b 00                	mov    (%eax),%eax
+ 6b4:	0f be c0             	movsbl %al,%eax
+ 6b7:	83 ec 08             	sub    $0x8,%esp
+ 6ba:	50                   	push   %eax
+ 6bb:	ff 75 08             	push   0x8(%ebp)
+ 6be:	e8 07 fe ff ff       	call   4ca <putc>
+ 6c3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6c6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6ca:	eb 42                	jmp    70e <printf+0x170>
+      } else if(c == '%'){
+ 6cc:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6d0:	75 17                	jne    6e9 <printf+0x14b>
+        putc(fd, c);
+ 6d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6d5:	0f be c0             	movsbl %al,%eax
+ 6d8:	83 ec 08             	sub    $0x8,%esp
+ 6db:	50                   	push   %eax
+ 6dc:	ff 75 08             	push   0x8(%ebp)
+ 6df:	e8 e6 fd ff ff       	call   4ca <putc>
+ 6e4:	83 c4 10             	add    $0x10,%esp
+ 6e7:	eb 25                	jmp    70e <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6e9:	83 ec 08             	sub    $0x8,%esp
+ 6ec:	6a 25                	push   $0x25
+ 6ee:	ff 75 08             	push   0x8(%ebp)
+ 6f1:	e8 d4 fd ff ff       	call   4ca <putc>
+ 6f6:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6fc:	0f be c0             	movsbl %al,%eax
+ 6ff:	83 ec 08             	sub    $0x8,%esp
+ 702:	50                   	push   %eax
+ 703:	ff 75 08             	push   0x8(%ebp)
+ 706:	e8 bf fd ff ff       	call   4ca <putc>
+ 70b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 70e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 715:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 719:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 71c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 71f:	01 d0                	add    %edx,%eax
+ 721:	0f b6 00             	movzbl (%eax),%eax
+ 724:	84 c0                	test   %al,%al
+ 726:	0f 85 94 fe ff ff    	jne    5c0 <printf+0x22>
+    }
+  }
+}
+ 72c:	90                   	nop
+ 72d:	90                   	nop
+ 72e:	c9                   	leave
+ 72f:	c3                   	ret
+
+00000730 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 736:	8b 45 08             	mov    0x8(%ebp),%eax
+ 739:	83 e8 08             	sub    $0x8,%eax
+ 73c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 73f:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ 744:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 747:	eb 24                	jmp    76d <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 749:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74c:	8b 00                	mov    (%eax),%eax
+ 74e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 751:	72 12                	jb     765 <free+0x35>
+ 753:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 756:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 759:	72 24                	jb     77f <free+0x4f>
+ 75b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75e:	8b 00                	mov    (%eax),%eax
+ 760:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 763:	72 1a                	jb     77f <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 765:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 768:	8b 00                	mov    (%eax),%eax
+ 76a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 76d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 770:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 773:	73 d4                	jae    749 <free+0x19>
+ 775:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 778:	8b 00                	mov    (%eax),%eax
+ 77a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 77d:	73 ca                	jae    749 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 77f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 782:	8b 40 04             	mov    0x4(%eax),%eax
+ 785:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 78c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 78f:	01 c2                	add    %eax,%edx
+ 791:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 794:	8b 00                	mov    (%eax),%eax
+ 796:	39 c2                	cmp    %eax,%edx
+ 798:	75 24                	jne    7be <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 79a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79d:	8b 50 04             	mov    0x4(%eax),%edx
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	8b 00                	mov    (%eax),%eax
+ 7a5:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a8:	01 c2                	add    %eax,%edx
+ 7aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ad:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b3:	8b 00                	mov    (%eax),%eax
+ 7b5:	8b 10                	mov    (%eax),%edx
+ 7b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ba:	89 10                	mov    %edx,(%eax)
+ 7bc:	eb 0a                	jmp    7c8 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c1:	8b 10                	mov    (%eax),%edx
+ 7c3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c6:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cb:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ce:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d8:	01 d0                	add    %edx,%eax
+ 7da:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7dd:	75 20                	jne    7ff <free+0xcf>
+    p->s.size += bp->s.size;
+ 7df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e2:	8b 50 04             	mov    0x4(%eax),%edx
+ 7e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e8:	8b 40 04             	mov    0x4(%eax),%eax
+ 7eb:	01 c2                	add    %eax,%edx
+ 7ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f6:	8b 10                	mov    (%eax),%edx
+ 7f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fb:	89 10                	mov    %edx,(%eax)
+ 7fd:	eb 08                	jmp    807 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 802:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 805:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 807:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80a:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+}
+ 80f:	90                   	nop
+ 810:	c9                   	leave
+ 811:	c3                   	ret
+
+00000812 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 812:	55                   	push   %ebp
+ 813:	89 e5                	mov    %esp,%ebp
+ 815:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 818:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 81f:	77 07                	ja     828 <morecore+0x16>
+    nu = 4096;
+ 821:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 828:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82b:	c1 e0 03             	shl    $0x3,%eax
+ 82e:	83 ec 0c             	sub    $0xc,%esp
+ 831:	50                   	push   %eax
+ 832:	e8 43 fc ff ff       	call   47a <sbrk>
+ 837:	83 c4 10             	add    $0x10,%esp
+ 83a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 83d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 841:	75 07                	jne    84a <morecore+0x38>
+    return 0;
+ 843:	b8 00 00 00 00       	mov    $0x0,%eax
+ 848:	eb 26                	jmp    870 <morecore+0x5e>
+  hp = (Header*)p;
+ 84a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 850:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 853:	8b 55 08             	mov    0x8(%ebp),%edx
+ 856:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 859:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 85c:	83 c0 08             	add    $0x8,%eax
+ 85f:	83 ec 0c             	sub    $0xc,%esp
+ 862:	50                   	push   %eax
+ 863:	e8 c8 fe ff ff       	call   730 <free>
+ 868:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 86b:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+}
+ 870:	c9                   	leave
+ 871:	c3                   	ret
+
+00000872 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 872:	55                   	push   %ebp
+ 873:	89 e5                	mov    %esp,%ebp
+ 875:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 878:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87b:	83 c0 07             	add    $0x7,%eax
+ 87e:	c1 e8 03             	shr    $0x3,%eax
+ 881:	83 c0 01             	add    $0x1,%eax
+ 884:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 887:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ 88c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 88f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 893:	75 23                	jne    8b8 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 895:	c7 45 f0 c4 0d 00 00 	movl   $0xdc4,-0x10(%ebp)
+ 89c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 89f:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+ 8a4:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ 8a9:	a3 c4 0d 00 00       	mov    %eax,0xdc4
+    base.s.size = 0;
+ 8ae:	c7 05 c8 0d 00 00 00 	movl   $0x0,0xdc8
+ 8b5:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8bb:	8b 00                	mov    (%eax),%eax
+ 8bd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c6:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8c9:	72 4d                	jb     918 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ce:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8d4:	75 0c                	jne    8e2 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d9:	8b 10                	mov    (%eax),%edx
+ 8db:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8de:	89 10                	mov    %edx,(%eax)
+ 8e0:	eb 26                	jmp    908 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8e8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8eb:	89 c2                	mov    %eax,%edx
+ 8ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8f9:	c1 e0 03             	shl    $0x3,%eax
+ 8fc:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 902:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 905:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 908:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90b:	a3 cc 0d 00 00       	mov    %eax,0xdcc
+      return (void*)(p + 1);
+ 910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 913:	83 c0 08             	add    $0x8,%eax
+ 916:	eb 3b                	jmp    953 <malloc+0xe1>
+    }
+    if(p == freep)
+ 918:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+ 91d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 920:	75 1e                	jne    940 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 922:	83 ec 0c             	sub    $0xc,%esp
+ 925:	ff 75 ec             	push   -0x14(%ebp)
+ 928:	e8 e5 fe ff ff       	call   812 <morecore>
+ 92d:	83 c4 10             	add    $0x10,%esp
+ 930:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 933:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 937:	75 07                	jne    940 <malloc+0xce>
+        return 0;
+ 939:	b8 00 00 00 00       	mov    $0x0,%eax
+ 93e:	eb 13                	jmp    953 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 943:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 946:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 949:	8b 00                	mov    (%eax),%eax
+ 94b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 94e:	e9 6d ff ff ff       	jmp    8c0 <malloc+0x4e>
+  }
+}
+ 953:	c9                   	leave
+ 954:	c3                   	ret
+
+00000955 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 955:	55                   	push   %ebp
+ 956:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 958:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 95b:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 95e:	7e 08                	jle    968 <ticks+0x13>
+ 960:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 963:	2b 45 08             	sub    0x8(%ebp),%eax
+ 966:	eb 05                	jmp    96d <ticks+0x18>
+ 968:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 96d:	5d                   	pop    %ebp
+ 96e:	c3                   	ret
+
+0000096f <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 96f:	55                   	push   %ebp
+ 970:	89 e5                	mov    %esp,%ebp
+ 972:	53                   	push   %ebx
+ 973:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 976:	8b 45 08             	mov    0x8(%ebp),%eax
+ 979:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 97c:	ff 75 14             	push   0x14(%ebp)
+ 97f:	ff 75 10             	push   0x10(%ebp)
+ 982:	e8 ce ff ff ff       	call   955 <ticks>
+ 987:	83 c4 08             	add    $0x8,%esp
+ 98a:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 98c:	89 d8                	mov    %ebx,%eax
+ 98e:	99                   	cltd
+ 98f:	f7 f9                	idiv   %ecx
+ 991:	89 c2                	mov    %eax,%edx
+ 993:	8b 45 14             	mov    0x14(%ebp),%eax
+ 996:	2b 45 10             	sub    0x10(%ebp),%eax
+ 999:	83 ec 04             	sub    $0x4,%esp
+ 99c:	ff 75 0c             	push   0xc(%ebp)
+ 99f:	52                   	push   %edx
+ 9a0:	50                   	push   %eax
+ 9a1:	ff 75 0c             	push   0xc(%ebp)
+ 9a4:	ff 75 08             	push   0x8(%ebp)
+ 9a7:	68 9c 0a 00 00       	push   $0xa9c
+ 9ac:	6a 01                	push   $0x1
+ 9ae:	e8 eb fb ff ff       	call   59e <printf>
+ 9b3:	83 c4 20             	add    $0x20,%esp
+}
+ 9b6:	90                   	nop
+ 9b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 9ba:	c9                   	leave
+ 9bb:	c3                   	ret
+
+000009bc <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 9bc:	55                   	push   %ebp
+ 9bd:	89 e5                	mov    %esp,%ebp
+ 9bf:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 9c2:	ff 75 14             	push   0x14(%ebp)
+ 9c5:	ff 75 10             	push   0x10(%ebp)
+ 9c8:	e8 88 ff ff ff       	call   955 <ticks>
+ 9cd:	83 c4 08             	add    $0x8,%esp
+ 9d0:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 9d6:	99                   	cltd
+ 9d7:	f7 7d 08             	idivl  0x8(%ebp)
+ 9da:	89 c2                	mov    %eax,%edx
+ 9dc:	8b 45 14             	mov    0x14(%ebp),%eax
+ 9df:	2b 45 10             	sub    0x10(%ebp),%eax
+ 9e2:	83 ec 08             	sub    $0x8,%esp
+ 9e5:	52                   	push   %edx
+ 9e6:	50                   	push   %eax
+ 9e7:	ff 75 0c             	push   0xc(%ebp)
+ 9ea:	ff 75 08             	push   0x8(%ebp)
+ 9ed:	68 bc 0a 00 00       	push   $0xabc
+ 9f2:	6a 01                	push   $0x1
+ 9f4:	e8 a5 fb ff ff       	call   59e <printf>
+ 9f9:	83 c4 20             	add    $0x20,%esp
+}
+ 9fc:	90                   	nop
+ 9fd:	c9                   	leave
+ 9fe:	c3                   	ret
@@ -0,0 +1,65 @@
+// Fork+exec latency benchmark.
+//
+// Like forktest, but the parent first grows a large heap and
+// touches every page of it.  Each child immediately execs
+// this program again with an argument telling it to exit, as
+// a shell does, so any copying fork does is wasted.  Reports
+// the average fork+exec+exit+wait time for several heap sizes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NFORK 50
+#define PGSIZE 4096
+
+char *childargv[] = { "forkbench", "child", 0 };
+
+void
+run(int npage)
+{
+  int i, pid, t0, t1;
+  char *p;
+
+  p = sbrk(npage * PGSIZE);
+  if(p == (char*)-1){
+    printf(1, "forkbench: sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < npage; i++)
+    p[i * PGSIZE] = i;
+
+  t0 = uptime();
+  for(i = 0; i < NFORK; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec("forkbench", childargv);
+      printf(1, "forkbench: exec failed\n");
+      exit();
+    }
+    wait();
+  }
+  t1 = uptime();
+  sbrk(-npage * PGSIZE);
+
+  printf(1, "heap %d KB: ", npage * 4);
+  benchtime(NFORK, "fork+execs", t0, t1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc > 1)
+    exit();
+
+  printf(1, "forkbench starting\n");
+  run(0);
+  run(256);
+  run(1024);
+  printf(1, "forkbench done\n");
+  exit();
+}
@@ -48,30 +48,133 @@ bzero(int dev, int bno)
 }
 
 // Blocks. 
+//
+// The free block bitmap is scanned a 32-bit word at a time.
+// In memory the allocator keeps, for each bitmap block, the
+// number of free blocks it describes less those balloc() has
+// claimed but not yet marked, so that bitmap blocks with none
+// are skipped without being read, and a cursor after the last
+// block allocated, where the search for a new file's first
+// block starts.  Blocks are handed out in runs, so that a
+// write of many blocks gets them contiguously, and a file's
+// next run goes right after its last one if it can.
+
+#define NBITMAP (FSSIZE/BPB + 1)
+#define BRUN 8  // free run a file moves to when its next block is taken
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+struct {
+  struct spinlock lock;
+  uint cursor;
+  uint nfree[NBITMAP];
+} bfreemap;
+
+// Count the free blocks described by each bitmap block.
+// Called after the log is recovered, since the transactions
+// it replays can change the bitmap.
+void
+bfreeinit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi;
 
-  bp = 0;
+  if(sb.size > NBITMAP*BPB)
+    panic("bfreeinit: file system too big");
+  initlock(&bfreemap.lock, "bfreemap");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
-    }
+    bfreemap.nfree[b/BPB] = 0;
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if((bp->data[bi/8] & (1 << (bi % 8))) == 0)
+        bfreemap.nfree[b/BPB]++;
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+}
+
+// Return the first bit from lo up to hi of bitmap block map,
+// which describes the blocks from b on, that starts a run of
+// len free blocks, or BPB if there is none.  Full words are
+// skipped whole.
+static uint
+bscan(uint *map, uint b, uint lo, uint hi, uint len)
+{
+  uint bi, run;
+
+  run = 0;
+  for(bi = lo; bi < hi && b + bi < sb.size; bi++){
+    if(bi % 32 == 0 && map[bi/32] == 0xffffffff){
+      run = 0;
+      bi += 31;
+    } else if(map[bi/32] & (1U << (bi % 32)))
+      run = 0;
+    else if(++run == len)
+      return bi + 1 - len;
+  }
+  return BPB;
+}
+
+// Allocate a run of at most *np zeroed disk blocks, and set *np
+// to its length.  The run starts right after block prev if that
+// is free, so that files are laid out contiguously.  If it is
+// not, it starts a run of BRUN free blocks (or *np, if fewer)
+// if there is one in the same bitmap block, rather than
+// interleave with the file that took it, or else at the next
+// free block.  A new file's first run, with prev 0, starts
+// from the cursor on.  Runs do not cross bitmap blocks.
+// Returns the first block, or 0 if the disk is full.
+static uint
+balloc(uint dev, uint prev, uint *np)
+{
+  uint b, bi, i, n, start, len, *map;
+  struct buf *bp;
+
+  // Claim a free block in the first bitmap block from the
+  // start on that has one.
+  n = (sb.size + BPB - 1) / BPB;
+  acquire(&bfreemap.lock);
+  start = prev ? (prev + 1) % sb.size : bfreemap.cursor;
+  for(i = 0; i < n; i++){
+    b = (start / BPB + i) % n * BPB;
+    if(bfreemap.nfree[b/BPB] > 0)
+      break;
+  }
+  if(i == n){
+    release(&bfreemap.lock);
+    return 0;
+  }
+  bfreemap.nfree[b/BPB]--;
+  start = i == 0 ? start % BPB : 0;
+  release(&bfreemap.lock);
+
+  bp = bread(dev, BBLOCK(b, sb));
+  map = (uint*)bp->data;
+  bi = BPB;
+  if(prev)
+    bi = bscan(map, b, start, start + 1, 1);
+  if(bi == BPB &&
+     (bi = bscan(map, b, start, BPB, *np < BRUN ? *np : BRUN)) == BPB &&
+     (bi = bscan(map, b, start, BPB, 1)) == BPB &&
+     (bi = bscan(map, b, 0, start, 1)) == BPB)
+    panic("balloc: free count");
+
+  // The first block was claimed above; claim the rest of the
+  // run from the free count, leaving those claimed by others.
+  for(len = 1; len < *np && bscan(map, b, bi + len, bi + len + 1, 1) != BPB; len++)
+    ;
+  acquire(&bfreemap.lock);
+  if(len - 1 > bfreemap.nfree[b/BPB])
+    len = bfreemap.nfree[b/BPB] + 1;
+  bfreemap.nfree[b/BPB] -= len - 1;
+  bfreemap.cursor = (b + bi + len) % sb.size;
+  release(&bfreemap.lock);
+
+  for(i = bi; i < bi + len; i++)
+    map[i/32] |= 1U << (i % 32);  // Mark block in use.
+  log_write(bp);
+  brelse(bp);
+  for(i = 0; i < len; i++)
+    bzero(dev, b + bi + i);
+  *np = len;
+  return b + bi;
 }
 
 // Free a disk block.
@@ -81,7 +184,6 @@ bfree(int dev, uint b)
   struct buf *bp;
   int bi, m;
 
-  readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb));
   bi = b % BPB;
   m = 1 << (bi % 8);
@@ -90,6 +192,9 @@ bfree(int dev, uint b)
   bp->data[bi/8] &= ~m;
   log_write(bp);
   brelse(bp);
+  acquire(&bfreemap.lock);
+  bfreemap.nfree[b/BPB]++;
+  release(&bfreemap.lock);
 }
 
 // Inodes.
@@ -209,7 +314,9 @@ iupdate(struct inode *ip)
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
-  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+  dip->nextent = ip->nextent;
+  memmove(dip->ext, ip->ext, sizeof(ip->ext));
+  memmove(dip->xaddrs, ip->xaddrs, sizeof(ip->xaddrs));
   log_write(bp);
   brelse(bp);
 }
@@ -244,7 +351,12 @@ iget(uint dev, uint inum)
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
+  ip->ntext = 0;
   ip->flags = 0;
+  ip->nextbn = 0;
+  ip->ranext = 0;
+  ip->xi = 0;
+  ip->xbn = 0;
   release(&icache.lock);
 
   return ip;
@@ -286,7 +398,9 @@ ilock(struct inode *ip)
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
     ip->size = dip->size;
-    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+    ip->nextent = dip->nextent;
+    memmove(ip->ext, dip->ext, sizeof(dip->ext));
+    memmove(ip->xaddrs, dip->xaddrs, sizeof(dip->xaddrs));
     brelse(bp);
     ip->flags |= I_VALID;
     if(ip->type == 0)
@@ -335,6 +449,20 @@ iput(struct inode *ip)
   release(&icache.lock);
 }
 
+// Count n more segments of running programs, or with n
+// negative fewer, that page in from ip.  Writes to ip are
+// refused while there are any, so that pages faulted in late
+// hold what exec() saw.
+void
+itext(struct inode *ip, int n)
+{
+  acquire(&icache.lock);
+  ip->ntext += n;
+  if(ip->ntext < 0)
+    panic("itext");
+  release(&icache.lock);
+}
+
 // Common idiom: unlock, then put.
 void
 iunlockput(struct inode *ip)
@@ -347,40 +475,125 @@ iunlockput(struct inode *ip)
 // Inode content
 //
 // The content (data) associated with each inode is stored
-// in blocks on the disk. The first NDIRECT block numbers
-// are listed in ip->addrs[].  The next NINDIRECT blocks are 
-// listed in block ip->addrs[NDIRECT].
-
-// Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// in runs of blocks on the disk, listed in order by the
+// inode's extents.  Extent i is ip->ext[i] for i < NEXTENT.
+// The next NXPB are in the extent block ip->xaddrs[0], and
+// the rest in the extent blocks listed in ip->xaddrs[1].
+
+// Return the extent block whose address is in *ap, allocating
+// one if there is none and alloc is set.  Returns 0 if there
+// is none or the disk is full.
 static uint
-bmap(struct inode *ip, uint bn)
+xblock(struct inode *ip, uint *ap, int alloc)
+{
+  uint n;
+
+  n = 1;
+  if(*ap == 0 && alloc)
+    *ap = balloc(ip->dev, 0, &n);
+  return *ap;
+}
+
+// Return a pointer to extent i of ip.  If it is in an extent
+// block, *bpp is set to the locked buffer holding it, which the
+// caller must release, and otherwise to 0.  With alloc set,
+// missing extent blocks are allocated.  Returns 0 if one is
+// missing or the disk is full.
+static struct extent*
+xent(struct inode *ip, uint i, struct buf **bpp, int alloc)
 {
   uint addr, *a;
   struct buf *bp;
 
-  if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
-    return addr;
-  }
-  bn -= NDIRECT;
+  *bpp = 0;
+  if(i < NEXTENT)
+    return &ip->ext[i];
+  i -= NEXTENT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  if(i < NXPB){
+    if((addr = xblock(ip, &ip->xaddrs[0], alloc)) == 0)
+      return 0;
+  } else {
+    i -= NXPB;
+    if((addr = xblock(ip, &ip->xaddrs[1], alloc)) == 0)
+      return 0;
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[i / NXPB]) == 0 &&
+       (addr = xblock(ip, &a[i / NXPB], alloc)) != 0)
       log_write(bp);
-    }
     brelse(bp);
-    return addr;
+    if(addr == 0)
+      return 0;
+    i %= NXPB;
   }
+  *bpp = bread(ip->dev, addr);
+  return (struct extent*)(*bpp)->data + i;
+}
 
-  panic("bmap: out of range");
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates a run of up to n
+// blocks for bn on, as one extent or as more of the last one
+// if the run follows it, or returns 0 if the disk is full.
+// The search starts at the extent found last time unless bn
+// comes before it, so sequential access reads one extent per
+// block.
+static uint
+bmap(struct inode *ip, uint bn, uint n)
+{
+  uint i, fbn, addr, last;
+  struct extent *e, x;
+  struct buf *bp;
+
+  if(ip->xi >= ip->nextent || bn < ip->xbn){
+    ip->xi = 0;
+    ip->xbn = 0;
+  }
+  last = 0;
+  x.len = 0;
+  for(i = ip->xi, fbn = ip->xbn; i < ip->nextent; i++){
+    if((e = xent(ip, i, &bp, 0)) == 0)
+      panic("bmap: no extent block");
+    x = *e;
+    if(bp)
+      brelse(bp);
+    if(bn < fbn + x.len){
+      ip->xi = i;
+      ip->xbn = fbn;
+      return x.start + bn - fbn;
+    }
+    fbn += x.len;
+    last = x.start + x.len - 1;
+  }
+  if(bn != fbn)
+    panic("bmap: hole");
+
+  if((addr = balloc(ip->dev, last, &n)) == 0)
+    return 0;
+  if(i > 0 && addr == last + 1){
+    // The run continues the last extent.
+    e = xent(ip, i - 1, &bp, 0);
+    e->len += n;
+    ip->xi = i - 1;
+    ip->xbn = fbn - x.len;
+  } else {
+    if(i == MAXEXTENT || (e = xent(ip, i, &bp, 1)) == 0){
+      while(n > 0)
+        bfree(ip->dev, addr + --n);
+      return 0;
+    }
+    e->start = addr;
+    e->len = n;
+    ip->nextent++;
+    ip->xi = i;
+    ip->xbn = fbn;
+  }
+  if(bp){
+    log_write(bp);
+    brelse(bp);
+  }
+  iupdate(ip);
+  return addr;
 }
 
 // Truncate inode (discard contents).
@@ -391,29 +604,39 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
+  uint i, b, *a;
+  struct extent *e;
   struct buf *bp;
-  uint *a;
 
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
-    }
+  for(i = 0; i < ip->nextent; i++){
+    if((e = xent(ip, i, &bp, 0)) == 0)
+      panic("itrunc: no extent block");
+    for(b = 0; b < e->len; b++)
+      bfree(ip->dev, e->start + b);
+    if(bp)
+      brelse(bp);
   }
-  
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+
+  if(ip->xaddrs[1]){
+    bp = bread(ip->dev, ip->xaddrs[1]);
     a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+    for(i = 0; i < NINDIRECT; i++){
+      if(a[i])
+        bfree(ip->dev, a[i]);
     }
     brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+  }
+  for(i = 0; i < 2; i++){
+    if(ip->xaddrs[i]){
+      bfree(ip->dev, ip->xaddrs[i]);
+      ip->xaddrs[i] = 0;
+    }
   }
 
+  ip->nextent = 0;
+  memset(ip->ext, 0, sizeof(ip->ext));
+  ip->xi = 0;
+  ip->xbn = 0;
   ip->size = 0;
   iupdate(ip);
 }
@@ -429,12 +652,32 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Start reading the NREADAHEAD blocks of ip from bn on into the
+// buffer cache, skipping those already requested.
+static void
+readahead(struct inode *ip, uint bn)
+{
+  uint end;
+
+  end = bn + NREADAHEAD;
+  if(end > (ip->size + BSIZE - 1) / BSIZE)
+    end = (ip->size + BSIZE - 1) / BSIZE;
+  if(ip->ranext < bn)
+    ip->ranext = bn;
+  for(; ip->ranext < end; ip->ranext++)
+    breadahead(ip->dev, bmap(ip, ip->ranext, 1));
+}
+
 //PAGEBREAK!
 // Read data from inode.
+// A read that starts at the beginning of the file or where the
+// previous one left off is sequential, and starts read-ahead of
+// the blocks that follow it.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn;
+  int seq;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -448,12 +691,20 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  bn = off/BSIZE;
+  seq = bn == 0 || bn == ip->nextbn || bn + 1 == ip->nextbn;
+  if(!seq)
+    ip->ranext = 0;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 1));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+  if(n > 0)
+    ip->nextbn = (off - 1)/BSIZE + 1;
+  if(seq)
+    readahead(ip, ip->nextbn);
   return n;
 }
 
@@ -462,7 +713,7 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr, end;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -476,19 +727,24 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  // Blocks are allocated for the whole write at once, so that
+  // they can be contiguous.
+  end = (off + n + BSIZE - 1) / BSIZE;
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if((addr = bmap(ip, off/BSIZE, end - off/BSIZE)) == 0)
+      break;  // disk full
+    bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot;
 }
 
 //PAGEBREAK!
@@ -553,7 +809,7 @@ dirlink(struct inode *dp, char *name, uint inum)
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
+    return -1;  // disk full
   
   return 0;
 }
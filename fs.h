@@ -20,9 +20,29 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+// The log is a checkpoint block followed by a ring of
+// transactions.  A transaction is a header of at most LOGHDR(n)
+// blocks, four words and the home block number of each of its
+// n blocks, followed by the blocks.  LOGCAP(nlog) is the most
+// blocks one transaction in a log of nlog blocks can hold.
+#define LOGHDR(n) (((n) + 4) * sizeof(uint) / BSIZE + 1)
+#define LOGCAP(nlog) ((nlog) - 1 - LOGHDR(nlog))
+
+// A file's content is a list of extents, runs of len blocks
+// from block start on the disk, each continuing the file where
+// the one before ends.  The first NEXTENT are in the inode, the
+// next NXPB in the extent block xaddrs[0], and the rest in the
+// extent blocks that the block xaddrs[1] lists.
+struct extent {
+  uint start;           // First disk block
+  uint len;             // Number of blocks
+};
+
+#define NEXTENT 5
+#define NXPB (BSIZE / sizeof(struct extent))
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define MAXEXTENT (NEXTENT + NXPB + NINDIRECT * NXPB)
+#define MAXFILE (1 << 21)  // in blocks, so sizes in bytes fit an int
 
 // On-disk inode structure
 struct dinode {
@@ -31,7 +51,9 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint nextent;         // Number of extents
+  struct extent ext[NEXTENT];  // First extents
+  uint xaddrs[2];       // Extent block and doubly-indirect block
 };
 
 // Inodes per block.
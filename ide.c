@@ -1,4 +1,5 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// Simple IDE driver code: bus-master DMA on a PCI controller
+// that has it, programmed I/O otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -11,6 +12,8 @@
 #include "spinlock.h"
 #include "fs.h"
 #include "buf.h"
+#include "diskstat.h"
+#include "pci.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -20,16 +23,57 @@
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
+#define IDE_CMD_RDMUL 0xc4
+#define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+// Bus-master IDE registers, primary channel, from idebm.
+#define BM_CMD        0     // Command
+#define BM_STATUS     2     // Status
+#define BM_PRDT       4     // Physical address of PRD table
+#define BM_START      0x01  // BM_CMD: start transfer
+#define BM_TOMEM      0x08  // BM_CMD: transfer disk to memory
+#define BM_ERR        0x02  // BM_STATUS: error, write 1 to clear
+#define BM_INTR       0x04  // BM_STATUS: interrupt, write 1 to clear
+
+#define IDEDMABLK     32    // max blocks per DMA command
+
+#define IDEMULT       16  // sectors per READ/WRITE MULTIPLE block
+#define IDEDEADLINE   50  // ticks a request waits before it goes next
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The active command may cover several consecutive blocks:
+// it moves the first idenbuf bufs on the queue.
+// The queue is kept in C-SCAN elevator order: ascending block
+// numbers from the head on, wrapping around once to the lowest.
+// A request that has waited IDEDEADLINE ticks goes next.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
 
 static int havedisk1;
+static int idemult[2];  // sectors per command each drive accepts
+static uint idencmd, idenblock, idenreq, ideqticks, ideintrkcycles;
+
+// Physical region descriptor: one contiguous piece of memory
+// for a DMA transfer, not crossing a 64 KB boundary.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last entry in table
+
+static ushort idebm;        // bus-master I/O base, 0 for PIO
+static struct prd *ideprd;  // PRD table, one page
 static void idestart(struct buf*);
+static int idesetmult(int);
+static void idedmainit(void);
 
 // Wait for IDE disk to become ready.
 static int
@@ -63,35 +107,169 @@ ideinit(void)
     }
   }
   
+  // Let each drive move up to IDEMULT sectors per interrupt.
+  idemult[0] = idesetmult(0);
+  if(havedisk1)
+    idemult[1] = idesetmult(1);
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  if(IDEDMA)
+    idedmainit();
+  cprintf("ide: %s\n", idebm ? "bus-master DMA" : "PIO");
+}
+
+// Look for a PCI IDE controller with bus-master DMA (bit 7 of
+// the programming interface) whose primary channel is at the
+// legacy ports, and enable it.
+static void
+idedmainit(void)
+{
+  uint tag, bar;
+
+  if((tag = pcifind(PCI_CLASS_IDE)) == 0)
+    return;
+  if((pciread(tag, PCI_CLASS) & 0x8100) != 0x8000)
+    return;
+  bar = pciread(tag, PCI_BAR(4));
+  if(!(bar & 1))
+    return;
+  if((ideprd = (struct prd*)kalloc()) == 0)
+    return;
+  pcienable(tag);
+  idebm = bar & 0xfffc;
+}
+
+// Describe the data of n bufs from b on down the queue in the
+// PRD table.
+static void
+ideprdfill(struct buf *b, int n)
+{
+  uint pa, len, m;
+  int i, k;
+
+  k = 0;
+  for(i = 0; i < n; i++, b = b->qnext){
+    pa = v2p(b->data);
+    for(len = BSIZE; len > 0; len -= m, pa += m, k++){
+      m = 0x10000 - (pa & 0xffff);
+      if(m > len)
+        m = len;
+      ideprd[k].addr = pa;
+      ideprd[k].len = m;
+      ideprd[k].flags = 0;
+    }
+  }
+  ideprd[k-1].flags = PRD_EOT;
+}
+
+// Put drive d into multiple mode, returning the number of
+// sectors one command may then transfer.
+static int
+idesetmult(int d)
+{
+  outb(0x1f6, 0xe0 | (d<<4));
+  idewait(0);
+  outb(0x1f2, IDEMULT);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  if(idewait(1) < 0)
+    return 1;
+  return IDEMULT;
+}
+
+// Return the number of bufs from b on down the queue that one
+// command can move: same drive, same direction, consecutive
+// blocks, and no more sectors than the drive takes at once.
+static int
+idebatch(struct buf *b)
+{
+  struct buf *p, *q;
+  int n, max;
+
+  if(idebm)
+    max = IDEDMABLK;
+  else
+    max = idemult[b->dev&1] / (BSIZE/SECTOR_SIZE);
+  n = 1;
+  for(p = b; n < max && (q = p->qnext) != 0; p = q, n++){
+    if(q->dev != b->dev || (q->flags & B_DIRTY) != (b->flags & B_DIRTY) ||
+       q->blockno != p->blockno + 1)
+      break;
+  }
+  return n;
+}
+
+// If some queued request has waited IDEDEADLINE ticks or more,
+// rotate the queue so the one that has waited longest is first.
+// The queue stays in cyclic order, so the elevator carries on
+// from that request's block.  Called between commands.
+static void
+ideexpire(void)
+{
+  struct buf *b, *old, *last;
+
+  old = 0;
+  last = 0;
+  for(b = idequeue; b; b = b->qnext){
+    if(ticks - b->qtime >= IDEDEADLINE &&
+       (old == 0 || ticks - b->qtime > ticks - old->qtime))
+      old = b;
+    last = b;
+  }
+  if(old == 0 || old == idequeue)
+    return;
+  last->qnext = idequeue;
+  for(b = idequeue; b->qnext != old; b = b->qnext)
+    ;
+  b->qnext = 0;
+  idequeue = old;
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, together with the bufs after it
+// on the queue for the blocks that follow b's.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *p;
+  int i, dir;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  idenbuf = idebatch(b);
+  if(b->blockno + idenbuf > FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
+  int nsector = idenbuf * sector_per_block;
 
   if (sector_per_block > 7) panic("idestart");
+  idencmd++;
+  idenblock += idenbuf;
   
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(0x1f7, IDE_CMD_WRITE);
-    outsl(0x1f0, b->data, BSIZE/4);
+  if(idebm){
+    // The controller moves the data; no CPU copying.
+    ideprdfill(b, idenbuf);
+    dir = (b->flags & B_DIRTY) ? 0 : BM_TOMEM;
+    outl(idebm+BM_PRDT, v2p(ideprd));
+    outb(idebm+BM_CMD, dir);
+    outb(idebm+BM_STATUS, inb(idebm+BM_STATUS) | BM_ERR | BM_INTR);
+    outb(0x1f7, dir ? IDE_CMD_RDDMA : IDE_CMD_WRDMA);
+    outb(idebm+BM_CMD, dir | BM_START);
+  } else if(b->flags & B_DIRTY){
+    outb(0x1f7, nsector > 1 ? IDE_CMD_WRMUL : IDE_CMD_WRITE);
+    for(i = 0, p = b; i < idenbuf; i++, p = p->qnext)
+      outsl(0x1f0, p->data, BSIZE/4);
   } else {
-    outb(0x1f7, IDE_CMD_READ);
+    outb(0x1f7, nsector > 1 ? IDE_CMD_RDMUL : IDE_CMD_READ);
   }
 }
 
@@ -99,41 +277,75 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *p;
+  void (*done)(struct buf*);
+  unsigned long long t0;
+  int i, st, err;
 
   // First queued buffer is the active request.
+  t0 = rdtsc();
   acquire(&idelock);
   if((b = idequeue) == 0){
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Stop DMA, or read data if needed.
+  if(idebm){
+    outb(idebm+BM_CMD, 0);
+    st = inb(idebm+BM_STATUS);
+    outb(idebm+BM_STATUS, st | BM_ERR | BM_INTR);
+    err = (st & BM_ERR) || idewait(1) < 0;
+  } else {
+    err = idewait(1) < 0;
+    if(!err && !(b->flags & B_DIRTY))
+      for(i = 0, p = b; i < idenbuf; i++, p = p->qnext)
+        insl(0x1f0, p->data, BSIZE/4);
+  }
   
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for the bufs.  After an error the
+  // data read is not trusted, and data written is still dirty.
+  for(i = 0; i < idenbuf; i++){
+    b = idequeue;
+    idequeue = b->qnext;
+    if(err)
+      b->flags |= B_ERROR;
+    else {
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+    }
+    idenreq++;
+    ideqticks += ticks - b->qtime;
+    wakeup(b);
+    if((done = b->done) != 0){
+      b->done = 0;
+      done(b);
+    }
+  }
   
   // Start disk on next buf in queue.
-  if(idequeue != 0)
+  if(idequeue != 0){
+    ideexpire();
     idestart(idequeue);
+  }
 
+  ideintrkcycles += (rdtsc() - t0) >> 10;
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk. 
+// Queue b to be synced with disk and return without waiting.
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If the request fails, set B_ERROR instead.
+// When the request finishes, ideintr() calls b->done if it is set.
 void
-iderw(struct buf *b)
+idesubmit(struct buf *b)
 {
   struct buf **pp;
+  uint pos;
+  int i;
 
   if(!(b->flags & B_BUSY))
     panic("iderw: buf not busy");
@@ -143,21 +355,63 @@ iderw(struct buf *b)
     panic("iderw: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
+  b->flags &= ~B_ERROR;
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
+  // Insert b into idequeue in elevator order, behind the bufs
+  // of the active command.
+  b->qtime = ticks;
+  pp = &idequeue;
+  if(idequeue){
+    pos = idequeue->blockno;
+    for(i = 0; i < idenbuf; i++)
+      pp = &(*pp)->qnext;
+    for(; *pp && (*pp)->blockno - pos <= b->blockno - pos; pp=&(*pp)->qnext)  //DOC:insert-queue
+      ;
+  }
+  b->qnext = *pp;
   *pp = b;
   
   // Start disk if necessary.
   if(idequeue == b)
     idestart(b);
-  
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+
+  release(&idelock);
+}
+
+// Wait for a request queued by idesubmit() to finish.
+// Returns -1 if it failed, 0 otherwise.
+int
+ideawait(struct buf *b)
+{
+  acquire(&idelock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID && !(b->flags & B_ERROR)){
     sleep(b, &idelock);
   }
+  release(&idelock);
+  return (b->flags & B_ERROR) ? -1 : 0;
+}
 
+// Sync buf with disk. 
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Returns -1 if the request failed, 0 otherwise.
+int
+iderw(struct buf *b)
+{
+  idesubmit(b);
+  return ideawait(b);
+}
+
+// Fill in disk statistics for getdiskstat().
+void
+idestat(struct diskstat *st)
+{
+  acquire(&idelock);
+  st->ncmd = idencmd;
+  st->nblock = idenblock;
+  st->nreq = idenreq;
+  st->qticks = ideqticks;
+  st->intrkcycles = ideintrkcycles;
+  st->dma = idebm != 0;
   release(&idelock);
 }
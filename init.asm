@@ -0,0 +1,1319 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 6b 09 00 00       	push   $0x96b
+  1b:	e8 78 03 00 00       	call   398 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 6b 09 00 00       	push   $0x96b
+  33:	e8 68 03 00 00       	call   3a0 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 6b 09 00 00       	push   $0x96b
+  45:	e8 4e 03 00 00       	call   398 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 79 03 00 00       	call   3d0 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 6c 03 00 00       	call   3d0 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 73 09 00 00       	push   $0x973
+  6f:	6a 01                	push   $0x1
+  71:	e8 8e 04 00 00       	call   504 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 d2 02 00 00       	call   350 <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 86 09 00 00       	push   $0x986
+  8f:	6a 01                	push   $0x1
+  91:	e8 6e 04 00 00       	call   504 <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 ba 02 00 00       	call   358 <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 a8 0c 00 00       	push   $0xca8
+  ac:	68 68 09 00 00       	push   $0x968
+  b1:	e8 da 02 00 00       	call   390 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 99 09 00 00       	push   $0x999
+  c1:	6a 01                	push   $0x1
+  c3:	e8 3c 04 00 00       	call   504 <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 88 02 00 00       	call   358 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 af 09 00 00       	push   $0x9af
+  d8:	6a 01                	push   $0x1
+  da:	e8 25 04 00 00       	call   504 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 79 02 00 00       	call   360 <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 133:	90                   	nop
+ 134:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 137:	8d 42 01             	lea    0x1(%edx),%eax
+ 13a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 13d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 140:	8d 48 01             	lea    0x1(%eax),%ecx
+ 143:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 146:	0f b6 12             	movzbl (%edx),%edx
+ 149:	88 10                	mov    %dl,(%eax)
+ 14b:	0f b6 00             	movzbl (%eax),%eax
+ 14e:	84 c0                	test   %al,%al
+ 150:	75 e2                	jne    134 <strcpy+0xd>
+    ;
+  return os;
+ 152:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+00000157 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 15a:	eb 08                	jmp    164 <strcmp+0xd>
+    p++, q++;
+ 15c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 160:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	0f b6 00             	movzbl (%eax),%eax
+ 16a:	84 c0                	test   %al,%al
+ 16c:	74 10                	je     17e <strcmp+0x27>
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	0f b6 10             	movzbl (%eax),%edx
+ 174:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 c2                	cmp    %al,%dl
+ 17c:	74 de                	je     15c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	0f b6 00             	movzbl (%eax),%eax
+ 184:	0f b6 d0             	movzbl %al,%edx
+ 187:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18a:	0f b6 00             	movzbl (%eax),%eax
+ 18d:	0f b6 c0             	movzbl %al,%eax
+ 190:	29 c2                	sub    %eax,%edx
+ 192:	89 d0                	mov    %edx,%eax
+}
+ 194:	5d                   	pop    %ebp
+ 195:	c3                   	ret
+
+00000196 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 19c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1a3:	eb 04                	jmp    1a9 <strlen+0x13>
+ 1a5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1a9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1af:	01 d0                	add    %edx,%eax
+ 1b1:	0f b6 00             	movzbl (%eax),%eax
+ 1b4:	84 c0                	test   %al,%al
+ 1b6:	75 ed                	jne    1a5 <strlen+0xf>
+    ;
+  return n;
+ 1b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+
+000001bd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1c0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c3:	50                   	push   %eax
+ 1c4:	ff 75 0c             	push   0xc(%ebp)
+ 1c7:	ff 75 08             	push   0x8(%ebp)
+ 1ca:	e8 32 ff ff ff       	call   101 <stosb>
+ 1cf:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e0:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1e3:	eb 14                	jmp    1f9 <strchr+0x22>
+    if(*s == c)
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e8:	0f b6 00             	movzbl (%eax),%eax
+ 1eb:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1ee:	75 05                	jne    1f5 <strchr+0x1e>
+      return (char*)s;
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	eb 13                	jmp    208 <strchr+0x31>
+  for(; *s; s++)
+ 1f5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	84 c0                	test   %al,%al
+ 201:	75 e2                	jne    1e5 <strchr+0xe>
+  return 0;
+ 203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 217:	eb 42                	jmp    25b <gets+0x51>
+    cc = read(0, &c, 1);
+ 219:	83 ec 04             	sub    $0x4,%esp
+ 21c:	6a 01                	push   $0x1
+ 21e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 221:	50                   	push   %eax
+ 222:	6a 00                	push   $0x0
+ 224:	e8 47 01 00 00       	call   370 <read>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 22f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 233:	7e 33                	jle    268 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 238:	8d 50 01             	lea    0x1(%eax),%edx
+ 23b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23e:	89 c2                	mov    %eax,%edx
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	01 c2                	add    %eax,%edx
+ 245:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 249:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 24b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 16                	je     269 <gets+0x5f>
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	3c 0d                	cmp    $0xd,%al
+ 259:	74 0e                	je     269 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	83 c0 01             	add    $0x1,%eax
+ 261:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 264:	7f b3                	jg     219 <gets+0xf>
+ 266:	eb 01                	jmp    269 <gets+0x5f>
+      break;
+ 268:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 269:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	01 d0                	add    %edx,%eax
+ 271:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 274:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+ 27c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	6a 00                	push   $0x0
+ 284:	ff 75 08             	push   0x8(%ebp)
+ 287:	e8 0c 01 00 00       	call   398 <open>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 07                	jns    29f <stat+0x26>
+    return -1;
+ 298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 29d:	eb 25                	jmp    2c4 <stat+0x4b>
+  r = fstat(fd, st);
+ 29f:	83 ec 08             	sub    $0x8,%esp
+ 2a2:	ff 75 0c             	push   0xc(%ebp)
+ 2a5:	ff 75 f4             	push   -0xc(%ebp)
+ 2a8:	e8 03 01 00 00       	call   3b0 <fstat>
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2b3:	83 ec 0c             	sub    $0xc,%esp
+ 2b6:	ff 75 f4             	push   -0xc(%ebp)
+ 2b9:	e8 c2 00 00 00       	call   380 <close>
+ 2be:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d3:	eb 25                	jmp    2fa <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2d8:	89 d0                	mov    %edx,%eax
+ 2da:	c1 e0 02             	shl    $0x2,%eax
+ 2dd:	01 d0                	add    %edx,%eax
+ 2df:	01 c0                	add    %eax,%eax
+ 2e1:	89 c1                	mov    %eax,%ecx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 2e9:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	0f be c0             	movsbl %al,%eax
+ 2f2:	01 c8                	add    %ecx,%eax
+ 2f4:	83 e8 30             	sub    $0x30,%eax
+ 2f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	0f b6 00             	movzbl (%eax),%eax
+ 300:	3c 2f                	cmp    $0x2f,%al
+ 302:	7e 0a                	jle    30e <atoi+0x48>
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	3c 39                	cmp    $0x39,%al
+ 30c:	7e c7                	jle    2d5 <atoi+0xf>
+  return n;
+ 30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 31f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 322:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 325:	eb 17                	jmp    33e <memmove+0x2b>
+    *dst++ = *src++;
+ 327:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 32a:	8d 42 01             	lea    0x1(%edx),%eax
+ 32d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 330:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 333:	8d 48 01             	lea    0x1(%eax),%ecx
+ 336:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 339:	0f b6 12             	movzbl (%edx),%edx
+ 33c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 33e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 341:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 344:	89 55 10             	mov    %edx,0x10(%ebp)
+ 347:	85 c0                	test   %eax,%eax
+ 349:	7f dc                	jg     327 <memmove+0x14>
+  return vdst;
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 350:	b8 01 00 00 00       	mov    $0x1,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <exit>:
+SYSCALL(exit)
+ 358:	b8 02 00 00 00       	mov    $0x2,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <wait>:
+SYSCALL(wait)
+ 360:	b8 03 00 00 00       	mov    $0x3,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <pipe>:
+SYSCALL(pipe)
+ 368:	b8 04 00 00 00       	mov    $0x4,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <read>:
+SYSCALL(read)
+ 370:	b8 05 00 00 00       	mov    $0x5,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <write>:
+SYSCALL(write)
+ 378:	b8 10 00 00 00       	mov    $0x10,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <close>:
+SYSCALL(close)
+ 380:	b8 15 00 00 00       	mov    $0x15,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <kill>:
+SYSCALL(kill)
+ 388:	b8 06 00 00 00       	mov    $0x6,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <exec>:
+SYSCALL(exec)
+ 390:	b8 07 00 00 00       	mov    $0x7,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <open>:
+SYSCALL(open)
+ 398:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <mknod>:
+SYSCALL(mknod)
+ 3a0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <unlink>:
+SYSCALL(unlink)
+ 3a8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <fstat>:
+SYSCALL(fstat)
+ 3b0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <link>:
+SYSCALL(link)
+ 3b8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <mkdir>:
+SYSCALL(mkdir)
+ 3c0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <chdir>:
+SYSCALL(chdir)
+ 3c8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <dup>:
+SYSCALL(dup)
+ 3d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getpid>:
+SYSCALL(getpid)
+ 3d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <sbrk>:
+SYSCALL(sbrk)
+ 3e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <sleep>:
+SYSCALL(sleep)
+ 3e8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <uptime>:
+SYSCALL(uptime)
+ 3f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 3f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getschedstat>:
+SYSCALL(getschedstat)
+ 400:	b8 17 00 00 00       	mov    $0x17,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 408:	b8 18 00 00 00       	mov    $0x18,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <setshare>:
+SYSCALL(setshare)
+ 410:	b8 19 00 00 00       	mov    $0x19,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 418:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 420:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <getlogstat>:
+SYSCALL(getlogstat)
+ 428:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 18             	sub    $0x18,%esp
+ 436:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 439:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 43c:	83 ec 04             	sub    $0x4,%esp
+ 43f:	6a 01                	push   $0x1
+ 441:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 444:	50                   	push   %eax
+ 445:	ff 75 08             	push   0x8(%ebp)
+ 448:	e8 2b ff ff ff       	call   378 <write>
+ 44d:	83 c4 10             	add    $0x10,%esp
+}
+ 450:	90                   	nop
+ 451:	c9                   	leave
+ 452:	c3                   	ret
+
+00000453 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 453:	55                   	push   %ebp
+ 454:	89 e5                	mov    %esp,%ebp
+ 456:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 459:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 460:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 464:	74 17                	je     47d <printint+0x2a>
+ 466:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 46a:	79 11                	jns    47d <printint+0x2a>
+    neg = 1;
+ 46c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 473:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 476:	f7 d8                	neg    %eax
+ 478:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 47b:	eb 06                	jmp    483 <printint+0x30>
+  } else {
+    x = xx;
+ 47d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 480:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 483:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 48a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 490:	ba 00 00 00 00       	mov    $0x0,%edx
+ 495:	f7 f1                	div    %ecx
+ 497:	89 d1                	mov    %edx,%ecx
+ 499:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49c:	8d 50 01             	lea    0x1(%eax),%edx
+ 49f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4a2:	0f b6 91 b0 0c 00 00 	movzbl 0xcb0(%ecx),%edx
+ 4a9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4b0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4b3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b8:	f7 f1                	div    %ecx
+ 4ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4c1:	75 c7                	jne    48a <printint+0x37>
+  if(neg)
+ 4c3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c7:	74 2d                	je     4f6 <printint+0xa3>
+    buf[i++] = '-';
+ 4c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cc:	8d 50 01             	lea    0x1(%eax),%edx
+ 4cf:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d2:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4d7:	eb 1d                	jmp    4f6 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4d9:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4df:	01 d0                	add    %edx,%eax
+ 4e1:	0f b6 00             	movzbl (%eax),%eax
+ 4e4:	0f be c0             	movsbl %al,%eax
+ 4e7:	83 ec 08             	sub    $0x8,%esp
+ 4ea:	50                   	push   %eax
+ 4eb:	ff 75 08             	push   0x8(%ebp)
+ 4ee:	e8 3d ff ff ff       	call   430 <putc>
+ 4f3:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4f6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4fe:	79 d9                	jns    4d9 <printint+0x86>
+}
+ 500:	90                   	nop
+ 501:	90                   	nop
+ 502:	c9                   	leave
+ 503:	c3                   	ret
+
+00000504 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 504:	55                   	push   %ebp
+ 505:	89 e5                	mov    %esp,%ebp
+ 507:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 50a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 511:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 514:	83 c0 04             	add    $0x4,%eax
+ 517:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 51a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 521:	e9 59 01 00 00       	jmp    67f <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 526:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 529:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 52c:	01 d0                	add    %edx,%eax
+ 52e:	0f b6 00             	movzbl (%eax),%eax
+ 531:	0f be c0             	movsbl %al,%eax
+ 534:	25 ff 00 00 00       	and    $0xff,%eax
+ 539:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 53c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 540:	75 2c                	jne    56e <printf+0x6a>
+      if(c == '%'){
+ 542:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 546:	75 0c                	jne    554 <printf+0x50>
+        state = '%';
+ 548:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 54f:	e9 27 01 00 00       	jmp    67b <printf+0x177>
+      } else {
+        putc(fd, c);
+ 554:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 557:	0f be c0             	movsbl %al,%eax
+ 55a:	83 ec 08             	sub    $0x8,%esp
+ 55d:	50                   	push   %eax
+ 55e:	ff 75 08             	push   0x8(%ebp)
+ 561:	e8 ca fe ff ff       	call   430 <putc>
+ 566:	83 c4 10             	add    $0x10,%esp
+ 569:	e9 0d 01 00 00       	jmp    67b <printf+0x177>
+      }
+    } else if(state == '%'){
+ 56e:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 572:	0f 85 03 01 00 00    	jne    67b <printf+0x177>
+      if(c == 'd'){
+ 578:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 57c:	75 1e                	jne    59c <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 57e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 581:	8b 00                	mov    (%eax),%eax
+ 583:	6a 01                	push   $0x1
+ 585:	6a 0a                	push   $0xa
+ 587:	50                   	push   %eax
+ 588:	ff 75 08             	push   0x8(%ebp)
+ 58b:	e8 c3 fe ff ff       	call   453 <printint>
+ 590:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 593:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 597:	e9 d8 00 00 00       	jmp    674 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 59c:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5a0:	74 06                	je     5a8 <printf+0xa4>
+ 5a2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5a6:	75 1e                	jne    5c6 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ab:	8b 00                	mov    (%eax),%eax
+ 5ad:	6a 00                	push   $0x0
+ 5af:	6a 10                	push   $0x10
+ 5b1:	50                   	push   %eax
+ 5b2:	ff 75 08             	push   0x8(%ebp)
+ 5b5:	e8 99 fe ff ff       	call   453 <printint>
+ 5ba:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5bd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c1:	e9 ae 00 00 00       	jmp    674 <printf+0x170>
+      } else if(c == 's'){
+ 5c6:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5ca:	75 43                	jne    60f <printf+0x10b>
+        s = (char*)*ap;
+ 5cc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5cf:	8b 00                	mov    (%eax),%eax
+ 5d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5d4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5dc:	75 25                	jne    603 <printf+0xff>
+          s = "(null)";
+ 5de:	c7 45 f4 b8 09 00 00 	movl   $0x9b8,-0xc(%ebp)
+        while(*s != 0){
+ 5e5:	eb 1c                	jmp    603 <printf+0xff>
+          putc(fd, *s);
+ 5e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ea:	0f b6 00             	movzbl (%eax),%eax
+ 5ed:	0f be c0             	movsbl %al,%eax
+ 5f0:	83 ec 08             	sub    $0x8,%esp
+ 5f3:	50                   	push   %eax
+ 5f4:	ff 75 08             	push   0x8(%ebp)
+ 5f7:	e8 34 fe ff ff       	call   430 <putc>
+ 5fc:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 606:	0f b6 00             	movzbl (%eax),%eax
+ 609:	84 c0                	test   %al,%al
+ 60b:	75 da                	jne    5e7 <printf+0xe3>
+ 60d:	eb 65                	jmp    674 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 60f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 613:	75 1d                	jne    632 <printf+0x12e>
+        putc(fd, *ap);
+ 615:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 618:	8b 00                	mov    (%eax),%eax
+ 61a:	0f be c0             	movsbl %al,%eax
+ 61d:	83 ec 08             	sub    $0x8,%esp
+ 620:	50                   	push   %eax
+ 621:	ff 75 08             	push   0x8(%ebp)
+ 624:	e8 07 fe ff ff       	call   430 <putc>
+ 629:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 630:	eb 42                	jmp    674 <printf+0x170>
+      } else if(c == '%'){
+ 632:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 636:	75 17                	jne    64f <printf+0x14b>
+        putc(fd, c);
+ 638:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 63b:	0f be c0             	movsbl %al,%eax
+ 63e:	83 ec 08             	sub    $0x8,%esp
+ 641:	50                   	push   %eax
+ 642:	ff 75 08             	push   0x8(%ebp)
+ 645:	e8 e6 fd ff ff       	call   430 <putc>
+ 64a:	83 c4 10             	add    $0x10,%esp
+ 64d:	eb 25                	jmp    674 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 64f:	83 ec 08             	sub    $0x8,%esp
+ 652:	6a 25                	push   $0x25
+ 654:	ff 75 08             	push   0x8(%ebp)
+ 657:	e8 d4 fd ff ff       	call   430 <putc>
+ 65c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 65f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 662:	0f be c0             	movsbl %al,%eax
+ 665:	83 ec 08             	sub    $0x8,%esp
+ 668:	50                   	push   %eax
+ 669:	ff 75 08             	push   0x8(%ebp)
+ 66c:	e8 bf fd ff ff       	call   430 <putc>
+ 671:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 674:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 67b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 67f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 682:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 685:	01 d0                	add    %edx,%eax
+ 687:	0f b6 00             	movzbl (%eax),%eax
+ 68a:	84 c0                	test   %al,%al
+ 68c:	0f 85 94 fe ff ff    	jne    526 <printf+0x22>
+    }
+  }
+}
+ 692:	90                   	nop
+ 693:	90                   	nop
+ 694:	c9                   	leave
+ 695:	c3                   	ret
+
+00000696 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 696:	55                   	push   %ebp
+ 697:	89 e5                	mov    %esp,%ebp
+ 699:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 69c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69f:	83 e8 08             	sub    $0x8,%eax
+ 6a2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a5:	a1 cc 0c 00 00       	mov    0xccc,%eax
+ 6aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ad:	eb 24                	jmp    6d3 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b2:	8b 00                	mov    (%eax),%eax
+ 6b4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6b7:	72 12                	jb     6cb <free+0x35>
+ 6b9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6bf:	72 24                	jb     6e5 <free+0x4f>
+ 6c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c4:	8b 00                	mov    (%eax),%eax
+ 6c6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6c9:	72 1a                	jb     6e5 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ce:	8b 00                	mov    (%eax),%eax
+ 6d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6d9:	73 d4                	jae    6af <free+0x19>
+ 6db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6de:	8b 00                	mov    (%eax),%eax
+ 6e0:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6e3:	73 ca                	jae    6af <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e8:	8b 40 04             	mov    0x4(%eax),%eax
+ 6eb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f5:	01 c2                	add    %eax,%edx
+ 6f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fa:	8b 00                	mov    (%eax),%eax
+ 6fc:	39 c2                	cmp    %eax,%edx
+ 6fe:	75 24                	jne    724 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 700:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 703:	8b 50 04             	mov    0x4(%eax),%edx
+ 706:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 709:	8b 00                	mov    (%eax),%eax
+ 70b:	8b 40 04             	mov    0x4(%eax),%eax
+ 70e:	01 c2                	add    %eax,%edx
+ 710:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 713:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 716:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 719:	8b 00                	mov    (%eax),%eax
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 720:	89 10                	mov    %edx,(%eax)
+ 722:	eb 0a                	jmp    72e <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 724:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 727:	8b 10                	mov    (%eax),%edx
+ 729:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72c:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 72e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 731:	8b 40 04             	mov    0x4(%eax),%eax
+ 734:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73e:	01 d0                	add    %edx,%eax
+ 740:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 743:	75 20                	jne    765 <free+0xcf>
+    p->s.size += bp->s.size;
+ 745:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 748:	8b 50 04             	mov    0x4(%eax),%edx
+ 74b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74e:	8b 40 04             	mov    0x4(%eax),%eax
+ 751:	01 c2                	add    %eax,%edx
+ 753:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 756:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 759:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75c:	8b 10                	mov    (%eax),%edx
+ 75e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 761:	89 10                	mov    %edx,(%eax)
+ 763:	eb 08                	jmp    76d <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 765:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 768:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 76b:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 76d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 770:	a3 cc 0c 00 00       	mov    %eax,0xccc
+}
+ 775:	90                   	nop
+ 776:	c9                   	leave
+ 777:	c3                   	ret
+
+00000778 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 778:	55                   	push   %ebp
+ 779:	89 e5                	mov    %esp,%ebp
+ 77b:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 77e:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 785:	77 07                	ja     78e <morecore+0x16>
+    nu = 4096;
+ 787:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 78e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 791:	c1 e0 03             	shl    $0x3,%eax
+ 794:	83 ec 0c             	sub    $0xc,%esp
+ 797:	50                   	push   %eax
+ 798:	e8 43 fc ff ff       	call   3e0 <sbrk>
+ 79d:	83 c4 10             	add    $0x10,%esp
+ 7a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7a3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7a7:	75 07                	jne    7b0 <morecore+0x38>
+    return 0;
+ 7a9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7ae:	eb 26                	jmp    7d6 <morecore+0x5e>
+  hp = (Header*)p;
+ 7b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bc:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c2:	83 c0 08             	add    $0x8,%eax
+ 7c5:	83 ec 0c             	sub    $0xc,%esp
+ 7c8:	50                   	push   %eax
+ 7c9:	e8 c8 fe ff ff       	call   696 <free>
+ 7ce:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7d1:	a1 cc 0c 00 00       	mov    0xccc,%eax
+}
+ 7d6:	c9                   	leave
+ 7d7:	c3                   	ret
+
+000007d8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7d8:	55                   	push   %ebp
+ 7d9:	89 e5                	mov    %esp,%ebp
+ 7db:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e1:	83 c0 07             	add    $0x7,%eax
+ 7e4:	c1 e8 03             	shr    $0x3,%eax
+ 7e7:	83 c0 01             	add    $0x1,%eax
+ 7ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7ed:	a1 cc 0c 00 00       	mov    0xccc,%eax
+ 7f2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7f5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7f9:	75 23                	jne    81e <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7fb:	c7 45 f0 c4 0c 00 00 	movl   $0xcc4,-0x10(%ebp)
+ 802:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 805:	a3 cc 0c 00 00       	mov    %eax,0xccc
+ 80a:	a1 cc 0c 00 00       	mov    0xccc,%eax
+ 80f:	a3 c4 0c 00 00       	mov    %eax,0xcc4
+    base.s.size = 0;
+ 814:	c7 05 c8 0c 00 00 00 	movl   $0x0,0xcc8
+ 81b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 821:	8b 00                	mov    (%eax),%eax
+ 823:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 829:	8b 40 04             	mov    0x4(%eax),%eax
+ 82c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 82f:	72 4d                	jb     87e <malloc+0xa6>
+      if(p->s.size == nunits)
+ 831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 834:	8b 40 04             	mov    0x4(%eax),%eax
+ 837:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 83a:	75 0c                	jne    848 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 83c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83f:	8b 10                	mov    (%eax),%edx
+ 841:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 844:	89 10                	mov    %edx,(%eax)
+ 846:	eb 26                	jmp    86e <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 848:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84b:	8b 40 04             	mov    0x4(%eax),%eax
+ 84e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 851:	89 c2                	mov    %eax,%edx
+ 853:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 856:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85c:	8b 40 04             	mov    0x4(%eax),%eax
+ 85f:	c1 e0 03             	shl    $0x3,%eax
+ 862:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 86b:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 86e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 871:	a3 cc 0c 00 00       	mov    %eax,0xccc
+      return (void*)(p + 1);
+ 876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 879:	83 c0 08             	add    $0x8,%eax
+ 87c:	eb 3b                	jmp    8b9 <malloc+0xe1>
+    }
+    if(p == freep)
+ 87e:	a1 cc 0c 00 00       	mov    0xccc,%eax
+ 883:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 886:	75 1e                	jne    8a6 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 888:	83 ec 0c             	sub    $0xc,%esp
+ 88b:	ff 75 ec             	push   -0x14(%ebp)
+ 88e:	e8 e5 fe ff ff       	call   778 <morecore>
+ 893:	83 c4 10             	add    $0x10,%esp
+ 896:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 899:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89d:	75 07                	jne    8a6 <malloc+0xce>
+        return 0;
+ 89f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8a4:	eb 13                	jmp    8b9 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8af:	8b 00                	mov    (%eax),%eax
+ 8b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b4:	e9 6d ff ff ff       	jmp    826 <malloc+0x4e>
+  }
+}
+ 8b9:	c9                   	leave
+ 8ba:	c3                   	ret
+
+000008bb <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 8bb:	55                   	push   %ebp
+ 8bc:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 8be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8c1:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 8c4:	7e 08                	jle    8ce <ticks+0x13>
+ 8c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8c9:	2b 45 08             	sub    0x8(%ebp),%eax
+ 8cc:	eb 05                	jmp    8d3 <ticks+0x18>
+ 8ce:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 8d3:	5d                   	pop    %ebp
+ 8d4:	c3                   	ret
+
+000008d5 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 8d5:	55                   	push   %ebp
+ 8d6:	89 e5                	mov    %esp,%ebp
+ 8d8:	53                   	push   %ebx
+ 8d9:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 8dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8df:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 8e2:	ff 75 14             	push   0x14(%ebp)
+ 8e5:	ff 75 10             	push   0x10(%ebp)
+ 8e8:	e8 ce ff ff ff       	call   8bb <ticks>
+ 8ed:	83 c4 08             	add    $0x8,%esp
+ 8f0:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 8f2:	89 d8                	mov    %ebx,%eax
+ 8f4:	99                   	cltd
+ 8f5:	f7 f9                	idiv   %ecx
+ 8f7:	89 c2                	mov    %eax,%edx
+ 8f9:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8fc:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8ff:	83 ec 04             	sub    $0x4,%esp
+ 902:	ff 75 0c             	push   0xc(%ebp)
+ 905:	52                   	push   %edx
+ 906:	50                   	push   %eax
+ 907:	ff 75 0c             	push   0xc(%ebp)
+ 90a:	ff 75 08             	push   0x8(%ebp)
+ 90d:	68 c0 09 00 00       	push   $0x9c0
+ 912:	6a 01                	push   $0x1
+ 914:	e8 eb fb ff ff       	call   504 <printf>
+ 919:	83 c4 20             	add    $0x20,%esp
+}
+ 91c:	90                   	nop
+ 91d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 920:	c9                   	leave
+ 921:	c3                   	ret
+
+00000922 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 922:	55                   	push   %ebp
+ 923:	89 e5                	mov    %esp,%ebp
+ 925:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 928:	ff 75 14             	push   0x14(%ebp)
+ 92b:	ff 75 10             	push   0x10(%ebp)
+ 92e:	e8 88 ff ff ff       	call   8bb <ticks>
+ 933:	83 c4 08             	add    $0x8,%esp
+ 936:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 93c:	99                   	cltd
+ 93d:	f7 7d 08             	idivl  0x8(%ebp)
+ 940:	89 c2                	mov    %eax,%edx
+ 942:	8b 45 14             	mov    0x14(%ebp),%eax
+ 945:	2b 45 10             	sub    0x10(%ebp),%eax
+ 948:	83 ec 08             	sub    $0x8,%esp
+ 94b:	52                   	push   %edx
+ 94c:	50                   	push   %eax
+ 94d:	ff 75 0c             	push   0xc(%ebp)
+ 950:	ff 75 08             	push   0x8(%ebp)
+ 953:	68 e0 09 00 00       	push   $0x9e0
+ 958:	6a 01                	push   $0x1
+ 95a:	e8 a5 fb ff ff       	call   504 <printf>
+ 95f:	83 c4 20             	add    $0x20,%esp
+}
+ 962:	90                   	nop
+ 963:	c9                   	leave
+ 964:	c3                   	ret
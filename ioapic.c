@@ -79,3 +79,18 @@ ioapicenable(int irq, int cpunum)
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
   ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
 }
+
+// Like ioapicenable, but level-triggered, for a PCI device's
+// interrupt, which the PIIX routes to an ISA IRQ active high.
+// The line stays raised until the driver acknowledges the
+// device, so an interrupt that arrives while the handler is
+// running is delivered again after it, not lost.
+void
+ioapicenablelevel(int irq, int cpunum)
+{
+  if(!ismp)
+    return;
+
+  ioapicwrite(REG_TABLE+2*irq, INT_LEVEL | (T_IRQ0 + irq));
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+}
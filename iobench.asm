@@ -0,0 +1,1472 @@
+
+_iobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <name>:
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  strcpy(s, "iobench.0");
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 a8 0a 00 00       	push   $0xaa8
+   e:	ff 75 08             	push   0x8(%ebp)
+  11:	e8 51 02 00 00       	call   267 <strcpy>
+  16:	83 c4 10             	add    $0x10,%esp
+  s[8] = '0' + i;
+  19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1c:	8d 50 30             	lea    0x30(%eax),%edx
+  1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  22:	83 c0 08             	add    $0x8,%eax
+  25:	88 10                	mov    %dl,(%eax)
+}
+  27:	90                   	nop
+  28:	c9                   	leave
+  29:	c3                   	ret
+
+0000002a <writer>:
+
+void
+writer(int i)
+{
+  2a:	55                   	push   %ebp
+  2b:	89 e5                	mov    %esp,%ebp
+  2d:	83 ec 28             	sub    $0x28,%esp
+  char path[16];
+  int fd, n;
+
+  name(path, i);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 75 08             	push   0x8(%ebp)
+  36:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  39:	50                   	push   %eax
+  3a:	e8 c1 ff ff ff       	call   0 <name>
+  3f:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+  42:	83 ec 08             	sub    $0x8,%esp
+  45:	68 02 02 00 00       	push   $0x202
+  4a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  4d:	50                   	push   %eax
+  4e:	e8 85 04 00 00       	call   4d8 <open>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  59:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5d:	79 1b                	jns    7a <writer+0x50>
+    printf(1, "iobench: cannot create %s\n", path);
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  65:	50                   	push   %eax
+  66:	68 b2 0a 00 00       	push   $0xab2
+  6b:	6a 01                	push   $0x1
+  6d:	e8 d2 05 00 00       	call   644 <printf>
+  72:	83 c4 10             	add    $0x10,%esp
+    exit();
+  75:	e8 1e 04 00 00       	call   498 <exit>
+  }
+  memset(buf, 'a' + i, sizeof(buf));
+  7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  7d:	83 c0 61             	add    $0x61,%eax
+  80:	83 ec 04             	sub    $0x4,%esp
+  83:	68 00 02 00 00       	push   $0x200
+  88:	50                   	push   %eax
+  89:	68 80 0e 00 00       	push   $0xe80
+  8e:	e8 6a 02 00 00       	call   2fd <memset>
+  93:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < NBLOCK; n++){
+  96:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  9d:	eb 37                	jmp    d6 <writer+0xac>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+  9f:	83 ec 04             	sub    $0x4,%esp
+  a2:	68 00 02 00 00       	push   $0x200
+  a7:	68 80 0e 00 00       	push   $0xe80
+  ac:	ff 75 f0             	push   -0x10(%ebp)
+  af:	e8 04 04 00 00       	call   4b8 <write>
+  b4:	83 c4 10             	add    $0x10,%esp
+  b7:	3d 00 02 00 00       	cmp    $0x200,%eax
+  bc:	74 14                	je     d2 <writer+0xa8>
+      printf(1, "iobench: write failed\n");
+  be:	83 ec 08             	sub    $0x8,%esp
+  c1:	68 cd 0a 00 00       	push   $0xacd
+  c6:	6a 01                	push   $0x1
+  c8:	e8 77 05 00 00       	call   644 <printf>
+  cd:	83 c4 10             	add    $0x10,%esp
+      break;
+  d0:	eb 0a                	jmp    dc <writer+0xb2>
+  for(n = 0; n < NBLOCK; n++){
+  d2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d6:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+  da:	7e c3                	jle    9f <writer+0x75>
+    }
+  }
+  close(fd);
+  dc:	83 ec 0c             	sub    $0xc,%esp
+  df:	ff 75 f0             	push   -0x10(%ebp)
+  e2:	e8 d9 03 00 00       	call   4c0 <close>
+  e7:	83 c4 10             	add    $0x10,%esp
+  exit();
+  ea:	e8 a9 03 00 00       	call   498 <exit>
+
+000000ef <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  ef:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f3:	83 e4 f0             	and    $0xfffffff0,%esp
+  f6:	ff 71 fc             	push   -0x4(%ecx)
+  f9:	55                   	push   %ebp
+  fa:	89 e5                	mov    %esp,%ebp
+  fc:	53                   	push   %ebx
+  fd:	51                   	push   %ecx
+  fe:	83 ec 50             	sub    $0x50,%esp
+  char path[16];
+  int i, t0, t1, nreq;
+  struct diskstat d0, d1;
+
+  printf(1, "iobench starting\n");
+ 101:	83 ec 08             	sub    $0x8,%esp
+ 104:	68 e4 0a 00 00       	push   $0xae4
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 34 05 00 00       	call   644 <printf>
+ 110:	83 c4 10             	add    $0x10,%esp
+  getdiskstat(&d0);
+ 113:	83 ec 0c             	sub    $0xc,%esp
+ 116:	8d 45 c0             	lea    -0x40(%ebp),%eax
+ 119:	50                   	push   %eax
+ 11a:	e8 41 04 00 00       	call   560 <getdiskstat>
+ 11f:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+ 122:	e8 09 04 00 00       	call   530 <uptime>
+ 127:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < NWRITER; i++){
+ 12a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 131:	eb 1b                	jmp    14e <main+0x5f>
+    if(fork() == 0)
+ 133:	e8 58 03 00 00       	call   490 <fork>
+ 138:	85 c0                	test   %eax,%eax
+ 13a:	75 0e                	jne    14a <main+0x5b>
+      writer(i);
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	ff 75 f4             	push   -0xc(%ebp)
+ 142:	e8 e3 fe ff ff       	call   2a <writer>
+ 147:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWRITER; i++){
+ 14a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 14e:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 152:	7e df                	jle    133 <main+0x44>
+  }
+  for(i = 0; i < NWRITER; i++)
+ 154:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 15b:	eb 09                	jmp    166 <main+0x77>
+    wait();
+ 15d:	e8 3e 03 00 00       	call   4a0 <wait>
+  for(i = 0; i < NWRITER; i++)
+ 162:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 166:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 16a:	7e f1                	jle    15d <main+0x6e>
+  t1 = uptime();
+ 16c:	e8 bf 03 00 00       	call   530 <uptime>
+ 171:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  getdiskstat(&d1);
+ 174:	83 ec 0c             	sub    $0xc,%esp
+ 177:	8d 45 a8             	lea    -0x58(%ebp),%eax
+ 17a:	50                   	push   %eax
+ 17b:	e8 e0 03 00 00       	call   560 <getdiskstat>
+ 180:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NWRITER; i++){
+ 183:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18a:	eb 25                	jmp    1b1 <main+0xc2>
+    name(path, i);
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	ff 75 f4             	push   -0xc(%ebp)
+ 192:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 195:	50                   	push   %eax
+ 196:	e8 65 fe ff ff       	call   0 <name>
+ 19b:	83 c4 10             	add    $0x10,%esp
+    unlink(path);
+ 19e:	83 ec 0c             	sub    $0xc,%esp
+ 1a1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 1a4:	50                   	push   %eax
+ 1a5:	e8 3e 03 00 00       	call   4e8 <unlink>
+ 1aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NWRITER; i++){
+ 1ad:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1b1:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 1b5:	7e d5                	jle    18c <main+0x9d>
+  }
+
+  printf(1, "%d writers: ", NWRITER);
+ 1b7:	83 ec 04             	sub    $0x4,%esp
+ 1ba:	6a 04                	push   $0x4
+ 1bc:	68 f6 0a 00 00       	push   $0xaf6
+ 1c1:	6a 01                	push   $0x1
+ 1c3:	e8 7c 04 00 00       	call   644 <printf>
+ 1c8:	83 c4 10             	add    $0x10,%esp
+  benchrate(NWRITER * NBLOCK / 2, "KB", t0, t1);
+ 1cb:	ff 75 e8             	push   -0x18(%ebp)
+ 1ce:	ff 75 ec             	push   -0x14(%ebp)
+ 1d1:	68 03 0b 00 00       	push   $0xb03
+ 1d6:	68 c8 00 00 00       	push   $0xc8
+ 1db:	e8 35 08 00 00       	call   a15 <benchrate>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+
+  // qticks counts 10ms ticks.
+  nreq = d1.nreq - d0.nreq;
+ 1e3:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 1e6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 1e9:	29 c2                	sub    %eax,%edx
+ 1eb:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  if(nreq == 0)
+ 1ee:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1f2:	75 07                	jne    1fb <main+0x10c>
+    nreq = 1;
+ 1f4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  printf(1, "%d requests in %d commands, %d us queued on average\n",
+         d1.nreq - d0.nreq, d1.ncmd - d0.ncmd,
+         (d1.qticks - d0.qticks) * 10000 / nreq);
+ 1fb:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 201:	29 c2                	sub    %eax,%edx
+ 203:	69 c2 10 27 00 00    	imul   $0x2710,%edx,%eax
+  printf(1, "%d requests in %d commands, %d us queued on average\n",
+ 209:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+ 20c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 211:	f7 f3                	div    %ebx
+ 213:	89 c3                	mov    %eax,%ebx
+         d1.nreq - d0.nreq, d1.ncmd - d0.ncmd,
+ 215:	8b 55 a8             	mov    -0x58(%ebp),%edx
+ 218:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  printf(1, "%d requests in %d commands, %d us queued on average\n",
+ 21b:	89 d1                	mov    %edx,%ecx
+ 21d:	29 c1                	sub    %eax,%ecx
+         d1.nreq - d0.nreq, d1.ncmd - d0.ncmd,
+ 21f:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 222:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  printf(1, "%d requests in %d commands, %d us queued on average\n",
+ 225:	29 c2                	sub    %eax,%edx
+ 227:	83 ec 0c             	sub    $0xc,%esp
+ 22a:	53                   	push   %ebx
+ 22b:	51                   	push   %ecx
+ 22c:	52                   	push   %edx
+ 22d:	68 08 0b 00 00       	push   $0xb08
+ 232:	6a 01                	push   $0x1
+ 234:	e8 0b 04 00 00       	call   644 <printf>
+ 239:	83 c4 20             	add    $0x20,%esp
+  exit();
+ 23c:	e8 57 02 00 00       	call   498 <exit>
+
+00000241 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 241:	55                   	push   %ebp
+ 242:	89 e5                	mov    %esp,%ebp
+ 244:	57                   	push   %edi
+ 245:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 246:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 249:	8b 55 10             	mov    0x10(%ebp),%edx
+ 24c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24f:	89 cb                	mov    %ecx,%ebx
+ 251:	89 df                	mov    %ebx,%edi
+ 253:	89 d1                	mov    %edx,%ecx
+ 255:	fc                   	cld
+ 256:	f3 aa                	rep stos %al,%es:(%edi)
+ 258:	89 ca                	mov    %ecx,%edx
+ 25a:	89 fb                	mov    %edi,%ebx
+ 25c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 25f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 262:	90                   	nop
+ 263:	5b                   	pop    %ebx
+ 264:	5f                   	pop    %edi
+ 265:	5d                   	pop    %ebp
+ 266:	c3                   	ret
+
+00000267 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 267:	55                   	push   %ebp
+ 268:	89 e5                	mov    %esp,%ebp
+ 26a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 273:	90                   	nop
+ 274:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 277:	8d 42 01             	lea    0x1(%edx),%eax
+ 27a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	8d 48 01             	lea    0x1(%eax),%ecx
+ 283:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 286:	0f b6 12             	movzbl (%edx),%edx
+ 289:	88 10                	mov    %dl,(%eax)
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	84 c0                	test   %al,%al
+ 290:	75 e2                	jne    274 <strcpy+0xd>
+    ;
+  return os;
+ 292:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 295:	c9                   	leave
+ 296:	c3                   	ret
+
+00000297 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 297:	55                   	push   %ebp
+ 298:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 29a:	eb 08                	jmp    2a4 <strcmp+0xd>
+    p++, q++;
+ 29c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2a0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a7:	0f b6 00             	movzbl (%eax),%eax
+ 2aa:	84 c0                	test   %al,%al
+ 2ac:	74 10                	je     2be <strcmp+0x27>
+ 2ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b1:	0f b6 10             	movzbl (%eax),%edx
+ 2b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b7:	0f b6 00             	movzbl (%eax),%eax
+ 2ba:	38 c2                	cmp    %al,%dl
+ 2bc:	74 de                	je     29c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c1:	0f b6 00             	movzbl (%eax),%eax
+ 2c4:	0f b6 d0             	movzbl %al,%edx
+ 2c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ca:	0f b6 00             	movzbl (%eax),%eax
+ 2cd:	0f b6 c0             	movzbl %al,%eax
+ 2d0:	29 c2                	sub    %eax,%edx
+ 2d2:	89 d0                	mov    %edx,%eax
+}
+ 2d4:	5d                   	pop    %ebp
+ 2d5:	c3                   	ret
+
+000002d6 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2d6:	55                   	push   %ebp
+ 2d7:	89 e5                	mov    %esp,%ebp
+ 2d9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2e3:	eb 04                	jmp    2e9 <strlen+0x13>
+ 2e5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2e9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ef:	01 d0                	add    %edx,%eax
+ 2f1:	0f b6 00             	movzbl (%eax),%eax
+ 2f4:	84 c0                	test   %al,%al
+ 2f6:	75 ed                	jne    2e5 <strlen+0xf>
+    ;
+  return n;
+ 2f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+
+000002fd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 300:	8b 45 10             	mov    0x10(%ebp),%eax
+ 303:	50                   	push   %eax
+ 304:	ff 75 0c             	push   0xc(%ebp)
+ 307:	ff 75 08             	push   0x8(%ebp)
+ 30a:	e8 32 ff ff ff       	call   241 <stosb>
+ 30f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 312:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 04             	sub    $0x4,%esp
+ 31d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 320:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 323:	eb 14                	jmp    339 <strchr+0x22>
+    if(*s == c)
+ 325:	8b 45 08             	mov    0x8(%ebp),%eax
+ 328:	0f b6 00             	movzbl (%eax),%eax
+ 32b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 32e:	75 05                	jne    335 <strchr+0x1e>
+      return (char*)s;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+ 333:	eb 13                	jmp    348 <strchr+0x31>
+  for(; *s; s++)
+ 335:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 339:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33c:	0f b6 00             	movzbl (%eax),%eax
+ 33f:	84 c0                	test   %al,%al
+ 341:	75 e2                	jne    325 <strchr+0xe>
+  return 0;
+ 343:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 348:	c9                   	leave
+ 349:	c3                   	ret
+
+0000034a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 34a:	55                   	push   %ebp
+ 34b:	89 e5                	mov    %esp,%ebp
+ 34d:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 350:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 357:	eb 42                	jmp    39b <gets+0x51>
+    cc = read(0, &c, 1);
+ 359:	83 ec 04             	sub    $0x4,%esp
+ 35c:	6a 01                	push   $0x1
+ 35e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 361:	50                   	push   %eax
+ 362:	6a 00                	push   $0x0
+ 364:	e8 47 01 00 00       	call   4b0 <read>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 36f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 373:	7e 33                	jle    3a8 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 375:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 378:	8d 50 01             	lea    0x1(%eax),%edx
+ 37b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 37e:	89 c2                	mov    %eax,%edx
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	01 c2                	add    %eax,%edx
+ 385:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 389:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 38b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 38f:	3c 0a                	cmp    $0xa,%al
+ 391:	74 16                	je     3a9 <gets+0x5f>
+ 393:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 397:	3c 0d                	cmp    $0xd,%al
+ 399:	74 0e                	je     3a9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 39b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 39e:	83 c0 01             	add    $0x1,%eax
+ 3a1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3a4:	7f b3                	jg     359 <gets+0xf>
+ 3a6:	eb 01                	jmp    3a9 <gets+0x5f>
+      break;
+ 3a8:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3a9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3af:	01 d0                	add    %edx,%eax
+ 3b1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3b4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+
+000003b9 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+ 3bc:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3bf:	83 ec 08             	sub    $0x8,%esp
+ 3c2:	6a 00                	push   $0x0
+ 3c4:	ff 75 08             	push   0x8(%ebp)
+ 3c7:	e8 0c 01 00 00       	call   4d8 <open>
+ 3cc:	83 c4 10             	add    $0x10,%esp
+ 3cf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3d6:	79 07                	jns    3df <stat+0x26>
+    return -1;
+ 3d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3dd:	eb 25                	jmp    404 <stat+0x4b>
+  r = fstat(fd, st);
+ 3df:	83 ec 08             	sub    $0x8,%esp
+ 3e2:	ff 75 0c             	push   0xc(%ebp)
+ 3e5:	ff 75 f4             	push   -0xc(%ebp)
+ 3e8:	e8 03 01 00 00       	call   4f0 <fstat>
+ 3ed:	83 c4 10             	add    $0x10,%esp
+ 3f0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3f3:	83 ec 0c             	sub    $0xc,%esp
+ 3f6:	ff 75 f4             	push   -0xc(%ebp)
+ 3f9:	e8 c2 00 00 00       	call   4c0 <close>
+ 3fe:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 401:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+
+00000406 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 406:	55                   	push   %ebp
+ 407:	89 e5                	mov    %esp,%ebp
+ 409:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 40c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 413:	eb 25                	jmp    43a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 415:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 418:	89 d0                	mov    %edx,%eax
+ 41a:	c1 e0 02             	shl    $0x2,%eax
+ 41d:	01 d0                	add    %edx,%eax
+ 41f:	01 c0                	add    %eax,%eax
+ 421:	89 c1                	mov    %eax,%ecx
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	8d 50 01             	lea    0x1(%eax),%edx
+ 429:	89 55 08             	mov    %edx,0x8(%ebp)
+ 42c:	0f b6 00             	movzbl (%eax),%eax
+ 42f:	0f be c0             	movsbl %al,%eax
+ 432:	01 c8                	add    %ecx,%eax
+ 434:	83 e8 30             	sub    $0x30,%eax
+ 437:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 43a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43d:	0f b6 00             	movzbl (%eax),%eax
+ 440:	3c 2f                	cmp    $0x2f,%al
+ 442:	7e 0a                	jle    44e <atoi+0x48>
+ 444:	8b 45 08             	mov    0x8(%ebp),%eax
+ 447:	0f b6 00             	movzbl (%eax),%eax
+ 44a:	3c 39                	cmp    $0x39,%al
+ 44c:	7e c7                	jle    415 <atoi+0xf>
+  return n;
+ 44e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 451:	c9                   	leave
+ 452:	c3                   	ret
+
+00000453 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 453:	55                   	push   %ebp
+ 454:	89 e5                	mov    %esp,%ebp
+ 456:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 459:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 45f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 462:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 465:	eb 17                	jmp    47e <memmove+0x2b>
+    *dst++ = *src++;
+ 467:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 46a:	8d 42 01             	lea    0x1(%edx),%eax
+ 46d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 470:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 473:	8d 48 01             	lea    0x1(%eax),%ecx
+ 476:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 479:	0f b6 12             	movzbl (%edx),%edx
+ 47c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 47e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 481:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 484:	89 55 10             	mov    %edx,0x10(%ebp)
+ 487:	85 c0                	test   %eax,%eax
+ 489:	7f dc                	jg     467 <memmove+0x14>
+  return vdst;
+ 48b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 48e:	c9                   	leave
+ 48f:	c3                   	ret
+
+00000490 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 490:	b8 01 00 00 00       	mov    $0x1,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <exit>:
+SYSCALL(exit)
+ 498:	b8 02 00 00 00       	mov    $0x2,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <wait>:
+SYSCALL(wait)
+ 4a0:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <pipe>:
+SYSCALL(pipe)
+ 4a8:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <read>:
+SYSCALL(read)
+ 4b0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <write>:
+SYSCALL(write)
+ 4b8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <close>:
+SYSCALL(close)
+ 4c0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <kill>:
+SYSCALL(kill)
+ 4c8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <exec>:
+SYSCALL(exec)
+ 4d0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <open>:
+SYSCALL(open)
+ 4d8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <mknod>:
+SYSCALL(mknod)
+ 4e0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <unlink>:
+SYSCALL(unlink)
+ 4e8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <fstat>:
+SYSCALL(fstat)
+ 4f0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <link>:
+SYSCALL(link)
+ 4f8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <mkdir>:
+SYSCALL(mkdir)
+ 500:	b8 14 00 00 00       	mov    $0x14,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <chdir>:
+SYSCALL(chdir)
+ 508:	b8 09 00 00 00       	mov    $0x9,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <dup>:
+SYSCALL(dup)
+ 510:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <getpid>:
+SYSCALL(getpid)
+ 518:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <sbrk>:
+SYSCALL(sbrk)
+ 520:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <sleep>:
+SYSCALL(sleep)
+ 528:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <uptime>:
+SYSCALL(uptime)
+ 530:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 538:	b8 16 00 00 00       	mov    $0x16,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <getschedstat>:
+SYSCALL(getschedstat)
+ 540:	b8 17 00 00 00       	mov    $0x17,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 548:	b8 18 00 00 00       	mov    $0x18,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <setshare>:
+SYSCALL(setshare)
+ 550:	b8 19 00 00 00       	mov    $0x19,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 558:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 560:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <getlogstat>:
+SYSCALL(getlogstat)
+ 568:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	83 ec 18             	sub    $0x18,%esp
+ 576:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 579:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 57c:	83 ec 04             	sub    $0x4,%esp
+ 57f:	6a 01                	push   $0x1
+ 581:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 584:	50                   	push   %eax
+ 585:	ff 75 08             	push   0x8(%ebp)
+ 588:	e8 2b ff ff ff       	call   4b8 <write>
+ 58d:	83 c4 10             	add    $0x10,%esp
+}
+ 590:	90                   	nop
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 599:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5a4:	74 17                	je     5bd <printint+0x2a>
+ 5a6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5aa:	79 11                	jns    5bd <printint+0x2a>
+    neg = 1;
+ 5ac:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b6:	f7 d8                	neg    %eax
+ 5b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5bb:	eb 06                	jmp    5c3 <printint+0x30>
+  } else {
+    x = xx;
+ 5bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5d5:	f7 f1                	div    %ecx
+ 5d7:	89 d1                	mov    %edx,%ecx
+ 5d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5dc:	8d 50 01             	lea    0x1(%eax),%edx
+ 5df:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5e2:	0f b6 91 6c 0e 00 00 	movzbl 0xe6c(%ecx),%edx
+ 5e9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5ed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5f8:	f7 f1                	div    %ecx
+ 5fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 601:	75 c7                	jne    5ca <printint+0x37>
+  if(neg)
+ 603:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 607:	74 2d                	je     636 <printint+0xa3>
+    buf[i++] = '-';
+ 609:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60c:	8d 50 01             	lea    0x1(%eax),%edx
+ 60f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 612:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 617:	eb 1d                	jmp    636 <printint+0xa3>
+    putc(fd, buf[i]);
+ 619:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 61c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 61f:	01 d0                	add    %edx,%eax
+ 621:	0f b6 00             	movzbl (%eax),%eax
+ 624:	0f be c0             	movsbl %al,%eax
+ 627:	83 ec 08             	sub    $0x8,%esp
+ 62a:	50                   	push   %eax
+ 62b:	ff 75 08             	push   0x8(%ebp)
+ 62e:	e8 3d ff ff ff       	call   570 <putc>
+ 633:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 636:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 63a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 63e:	79 d9                	jns    619 <printint+0x86>
+}
+ 640:	90                   	nop
+ 641:	90                   	nop
+ 642:	c9                   	leave
+ 643:	c3                   	ret
+
+00000644 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 644:	55                   	push   %ebp
+ 645:	89 e5                	mov    %esp,%ebp
+ 647:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 64a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 651:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 654:	83 c0 04             	add    $0x4,%eax
+ 657:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 65a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 661:	e9 59 01 00 00       	jmp    7bf <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 666:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 669:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 66c:	01 d0                	add    %edx,%eax
+ 66e:	0f b6 00             	movzbl (%eax),%eax
+ 671:	0f be c0             	movsbl %al,%eax
+ 674:	25 ff 00 00 00       	and    $0xff,%eax
+ 679:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 67c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 680:	75 2c                	jne    6ae <printf+0x6a>
+      if(c == '%'){
+ 682:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 686:	75 0c                	jne    694 <printf+0x50>
+        state = '%';
+ 688:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 68f:	e9 27 01 00 00       	jmp    7bb <printf+0x177>
+      } else {
+        putc(fd, c);
+ 694:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 697:	0f be c0             	movsbl %al,%eax
+ 69a:	83 ec 08             	sub    $0x8,%esp
+ 69d:	50                   	push   %eax
+ 69e:	ff 75 08             	push   0x8(%ebp)
+ 6a1:	e8 ca fe ff ff       	call   570 <putc>
+ 6a6:	83 c4 10             	add    $0x10,%esp
+ 6a9:	e9 0d 01 00 00       	jmp    7bb <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6ae:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6b2:	0f 85 03 01 00 00    	jne    7bb <printf+0x177>
+      if(c == 'd'){
+ 6b8:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6bc:	75 1e                	jne    6dc <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6be:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6c1:	8b 00                	mov    (%eax),%eax
+ 6c3:	6a 01                	push   $0x1
+ 6c5:	6a 0a                	push   $0xa
+ 6c7:	50                   	push   %eax
+ 6c8:	ff 75 08             	push   0x8(%ebp)
+ 6cb:	e8 c3 fe ff ff       	call   593 <printint>
+ 6d0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6d7:	e9 d8 00 00 00       	jmp    7b4 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6dc:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6e0:	74 06                	je     6e8 <printf+0xa4>
+ 6e2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6e6:	75 1e                	jne    706 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6e8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6eb:	8b 00                	mov    (%eax),%eax
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	6a 10                	push   $0x10
+ 6f1:	50                   	push   %eax
+ 6f2:	ff 75 08             	push   0x8(%ebp)
+ 6f5:	e8 99 fe ff ff       	call   593 <printint>
+ 6fa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 701:	e9 ae 00 00 00       	jmp    7b4 <printf+0x170>
+      } else if(c == 's'){
+ 706:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 70a:	75 43                	jne    74f <printf+0x10b>
+        s = (char*)*ap;
+ 70c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 70f:	8b 00                	mov    (%eax),%eax
+ 711:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 714:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 718:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 71c:	75 25                	jne    743 <printf+0xff>
+          s = "(null)";
+ 71e:	c7 45 f4 3d 0b 00 00 	movl   $0xb3d,-0xc(%ebp)
+        while(*s != 0){
+ 725:	eb 1c                	jmp    743 <printf+0xff>
+          putc(fd, *s);
+ 727:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72a:	0f b6 00             	movzbl (%eax),%eax
+ 72d:	0f be c0             	movsbl %al,%eax
+ 730:	83 ec 08             	sub    $0x8,%esp
+ 733:	50                   	push   %eax
+ 734:	ff 75 08             	push   0x8(%ebp)
+ 737:	e8 34 fe ff ff       	call   570 <putc>
+ 73c:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 73f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 746:	0f b6 00             	movzbl (%eax),%eax
+ 749:	84 c0                	test   %al,%al
+ 74b:	75 da                	jne    727 <printf+0xe3>
+ 74d:	eb 65                	jmp    7b4 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 74f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 753:	75 1d                	jne    772 <printf+0x12e>
+        putc(fd, *ap);
+ 755:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 758:	8b 00                	mov    (%eax),%eax
+ 75a:	0f be c0             	movsbl %al,%eax
+ 75d:	83 ec 08             	sub    $0x8,%esp
+ 760:	50                   	push   %eax
+ 761:	ff 75 08             	push   0x8(%ebp)
+ 764:	e8 07 fe ff ff       	call   570 <putc>
+ 769:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 76c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 770:	eb 42                	jmp    7b4 <printf+0x170>
+      } else if(c == '%'){
+ 772:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 776:	75 17                	jne    78f <printf+0x14b>
+        putc(fd, c);
+ 778:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 77b:	0f be c0             	movsbl %al,%eax
+ 77e:	83 ec 08             	sub    $0x8,%esp
+ 781:	50                   	push   %eax
+ 782:	ff 75 08             	push   0x8(%ebp)
+ 785:	e8 e6 fd ff ff       	call   570 <putc>
+ 78a:	83 c4 10             	add    $0x10,%esp
+ 78d:	eb 25                	jmp    7b4 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 78f:	83 ec 08             	sub    $0x8,%esp
+ 792:	6a 25                	push   $0x25
+ 794:	ff 75 08             	push   0x8(%ebp)
+ 797:	e8 d4 fd ff ff       	call   570 <putc>
+ 79c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 79f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a2:	0f be c0             	movsbl %al,%eax
+ 7a5:	83 ec 08             	sub    $0x8,%esp
+ 7a8:	50                   	push   %eax
+ 7a9:	ff 75 08             	push   0x8(%ebp)
+ 7ac:	e8 bf fd ff ff       	call   570 <putc>
+ 7b1:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7b4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7bb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c5:	01 d0                	add    %edx,%eax
+ 7c7:	0f b6 00             	movzbl (%eax),%eax
+ 7ca:	84 c0                	test   %al,%al
+ 7cc:	0f 85 94 fe ff ff    	jne    666 <printf+0x22>
+    }
+  }
+}
+ 7d2:	90                   	nop
+ 7d3:	90                   	nop
+ 7d4:	c9                   	leave
+ 7d5:	c3                   	ret
+
+000007d6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d6:	55                   	push   %ebp
+ 7d7:	89 e5                	mov    %esp,%ebp
+ 7d9:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7df:	83 e8 08             	sub    $0x8,%eax
+ 7e2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e5:	a1 88 10 00 00       	mov    0x1088,%eax
+ 7ea:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7ed:	eb 24                	jmp    813 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f2:	8b 00                	mov    (%eax),%eax
+ 7f4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7f7:	72 12                	jb     80b <free+0x35>
+ 7f9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7fc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7ff:	72 24                	jb     825 <free+0x4f>
+ 801:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 804:	8b 00                	mov    (%eax),%eax
+ 806:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 809:	72 1a                	jb     825 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80e:	8b 00                	mov    (%eax),%eax
+ 810:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 813:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 816:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 819:	73 d4                	jae    7ef <free+0x19>
+ 81b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81e:	8b 00                	mov    (%eax),%eax
+ 820:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 823:	73 ca                	jae    7ef <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 825:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 828:	8b 40 04             	mov    0x4(%eax),%eax
+ 82b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 832:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 835:	01 c2                	add    %eax,%edx
+ 837:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83a:	8b 00                	mov    (%eax),%eax
+ 83c:	39 c2                	cmp    %eax,%edx
+ 83e:	75 24                	jne    864 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 840:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 843:	8b 50 04             	mov    0x4(%eax),%edx
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 00                	mov    (%eax),%eax
+ 84b:	8b 40 04             	mov    0x4(%eax),%eax
+ 84e:	01 c2                	add    %eax,%edx
+ 850:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 853:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 859:	8b 00                	mov    (%eax),%eax
+ 85b:	8b 10                	mov    (%eax),%edx
+ 85d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 860:	89 10                	mov    %edx,(%eax)
+ 862:	eb 0a                	jmp    86e <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 864:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 867:	8b 10                	mov    (%eax),%edx
+ 869:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86c:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 86e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 871:	8b 40 04             	mov    0x4(%eax),%eax
+ 874:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 87b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 87e:	01 d0                	add    %edx,%eax
+ 880:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 883:	75 20                	jne    8a5 <free+0xcf>
+    p->s.size += bp->s.size;
+ 885:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 888:	8b 50 04             	mov    0x4(%eax),%edx
+ 88b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88e:	8b 40 04             	mov    0x4(%eax),%eax
+ 891:	01 c2                	add    %eax,%edx
+ 893:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 896:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 899:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 89c:	8b 10                	mov    (%eax),%edx
+ 89e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a1:	89 10                	mov    %edx,(%eax)
+ 8a3:	eb 08                	jmp    8ad <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 8a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a8:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8ab:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b0:	a3 88 10 00 00       	mov    %eax,0x1088
+}
+ 8b5:	90                   	nop
+ 8b6:	c9                   	leave
+ 8b7:	c3                   	ret
+
+000008b8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8b8:	55                   	push   %ebp
+ 8b9:	89 e5                	mov    %esp,%ebp
+ 8bb:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8be:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8c5:	77 07                	ja     8ce <morecore+0x16>
+    nu = 4096;
+ 8c7:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d1:	c1 e0 03             	shl    $0x3,%eax
+ 8d4:	83 ec 0c             	sub    $0xc,%esp
+ 8d7:	50                   	push   %eax
+ 8d8:	e8 43 fc ff ff       	call   520 <sbrk>
+ 8dd:	83 c4 10             	add    $0x10,%esp
+ 8e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8e3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8e7:	75 07                	jne    8f0 <morecore+0x38>
+    return 0;
+ 8e9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8ee:	eb 26                	jmp    916 <morecore+0x5e>
+  hp = (Header*)p;
+ 8f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8fc:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8ff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 902:	83 c0 08             	add    $0x8,%eax
+ 905:	83 ec 0c             	sub    $0xc,%esp
+ 908:	50                   	push   %eax
+ 909:	e8 c8 fe ff ff       	call   7d6 <free>
+ 90e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 911:	a1 88 10 00 00       	mov    0x1088,%eax
+}
+ 916:	c9                   	leave
+ 917:	c3                   	ret
+
+00000918 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 918:	55                   	push   %ebp
+ 919:	89 e5                	mov    %esp,%ebp
+ 91b:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 91e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 921:	83 c0 07             	add    $0x7,%eax
+ 924:	c1 e8 03             	shr    $0x3,%eax
+ 927:	83 c0 01             	add    $0x1,%eax
+ 92a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 92d:	a1 88 10 00 00       	mov    0x1088,%eax
+ 932:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 935:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 939:	75 23                	jne    95e <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 93b:	c7 45 f0 80 10 00 00 	movl   $0x1080,-0x10(%ebp)
+ 942:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 945:	a3 88 10 00 00       	mov    %eax,0x1088
+ 94a:	a1 88 10 00 00       	mov    0x1088,%eax
+ 94f:	a3 80 10 00 00       	mov    %eax,0x1080
+    base.s.size = 0;
+ 954:	c7 05 84 10 00 00 00 	movl   $0x0,0x1084
+ 95b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 95e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 961:	8b 00                	mov    (%eax),%eax
+ 963:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 969:	8b 40 04             	mov    0x4(%eax),%eax
+ 96c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 96f:	72 4d                	jb     9be <malloc+0xa6>
+      if(p->s.size == nunits)
+ 971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 974:	8b 40 04             	mov    0x4(%eax),%eax
+ 977:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 97a:	75 0c                	jne    988 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 97c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97f:	8b 10                	mov    (%eax),%edx
+ 981:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 984:	89 10                	mov    %edx,(%eax)
+ 986:	eb 26                	jmp    9ae <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 988:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98b:	8b 40 04             	mov    0x4(%eax),%eax
+ 98e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 991:	89 c2                	mov    %eax,%edx
+ 993:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 996:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 999:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99c:	8b 40 04             	mov    0x4(%eax),%eax
+ 99f:	c1 e0 03             	shl    $0x3,%eax
+ 9a2:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 9a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9ab:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9b1:	a3 88 10 00 00       	mov    %eax,0x1088
+      return (void*)(p + 1);
+ 9b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b9:	83 c0 08             	add    $0x8,%eax
+ 9bc:	eb 3b                	jmp    9f9 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9be:	a1 88 10 00 00       	mov    0x1088,%eax
+ 9c3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9c6:	75 1e                	jne    9e6 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9c8:	83 ec 0c             	sub    $0xc,%esp
+ 9cb:	ff 75 ec             	push   -0x14(%ebp)
+ 9ce:	e8 e5 fe ff ff       	call   8b8 <morecore>
+ 9d3:	83 c4 10             	add    $0x10,%esp
+ 9d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9dd:	75 07                	jne    9e6 <malloc+0xce>
+        return 0;
+ 9df:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9e4:	eb 13                	jmp    9f9 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ef:	8b 00                	mov    (%eax),%eax
+ 9f1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9f4:	e9 6d ff ff ff       	jmp    966 <malloc+0x4e>
+  }
+}
+ 9f9:	c9                   	leave
+ 9fa:	c3                   	ret
+
+000009fb <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 9fb:	55                   	push   %ebp
+ 9fc:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 9fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a01:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a04:	7e 08                	jle    a0e <ticks+0x13>
+ a06:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a09:	2b 45 08             	sub    0x8(%ebp),%eax
+ a0c:	eb 05                	jmp    a13 <ticks+0x18>
+ a0e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ a13:	5d                   	pop    %ebp
+ a14:	c3                   	ret
+
+00000a15 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ a15:	55                   	push   %ebp
+ a16:	89 e5                	mov    %esp,%ebp
+ a18:	53                   	push   %ebx
+ a19:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1f:	6b d8 64             	imul   $0x64,%eax,%ebx
+ a22:	ff 75 14             	push   0x14(%ebp)
+ a25:	ff 75 10             	push   0x10(%ebp)
+ a28:	e8 ce ff ff ff       	call   9fb <ticks>
+ a2d:	83 c4 08             	add    $0x8,%esp
+ a30:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ a32:	89 d8                	mov    %ebx,%eax
+ a34:	99                   	cltd
+ a35:	f7 f9                	idiv   %ecx
+ a37:	89 c2                	mov    %eax,%edx
+ a39:	8b 45 14             	mov    0x14(%ebp),%eax
+ a3c:	2b 45 10             	sub    0x10(%ebp),%eax
+ a3f:	83 ec 04             	sub    $0x4,%esp
+ a42:	ff 75 0c             	push   0xc(%ebp)
+ a45:	52                   	push   %edx
+ a46:	50                   	push   %eax
+ a47:	ff 75 0c             	push   0xc(%ebp)
+ a4a:	ff 75 08             	push   0x8(%ebp)
+ a4d:	68 44 0b 00 00       	push   $0xb44
+ a52:	6a 01                	push   $0x1
+ a54:	e8 eb fb ff ff       	call   644 <printf>
+ a59:	83 c4 20             	add    $0x20,%esp
+}
+ a5c:	90                   	nop
+ a5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a60:	c9                   	leave
+ a61:	c3                   	ret
+
+00000a62 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ a62:	55                   	push   %ebp
+ a63:	89 e5                	mov    %esp,%ebp
+ a65:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ a68:	ff 75 14             	push   0x14(%ebp)
+ a6b:	ff 75 10             	push   0x10(%ebp)
+ a6e:	e8 88 ff ff ff       	call   9fb <ticks>
+ a73:	83 c4 08             	add    $0x8,%esp
+ a76:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ a7c:	99                   	cltd
+ a7d:	f7 7d 08             	idivl  0x8(%ebp)
+ a80:	89 c2                	mov    %eax,%edx
+ a82:	8b 45 14             	mov    0x14(%ebp),%eax
+ a85:	2b 45 10             	sub    0x10(%ebp),%eax
+ a88:	83 ec 08             	sub    $0x8,%esp
+ a8b:	52                   	push   %edx
+ a8c:	50                   	push   %eax
+ a8d:	ff 75 0c             	push   0xc(%ebp)
+ a90:	ff 75 08             	push   0x8(%ebp)
+ a93:	68 64 0b 00 00       	push   $0xb64
+ a98:	6a 01                	push   $0x1
+ a9a:	e8 a5 fb ff ff       	call   644 <printf>
+ a9f:	83 c4 20             	add    $0x20,%esp
+}
+ aa2:	90                   	nop
+ aa3:	c9                   	leave
+ aa4:	c3                   	ret
@@ -0,0 +1,83 @@
+// Disk queue benchmark.
+//
+// NWRITER processes each write their own file at the same
+// time, so the disk queue holds requests for blocks all over
+// the disk.  Reports the write throughput, the disk commands
+// issued and the average time a request spent queued.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "diskstat.h"
+
+#define NWRITER 4
+#define NBLOCK 100   // blocks per file
+
+char buf[512];
+
+void
+name(char *s, int i)
+{
+  strcpy(s, "iobench.0");
+  s[8] = '0' + i;
+}
+
+void
+writer(int i)
+{
+  char path[16];
+  int fd, n;
+
+  name(path, i);
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    printf(1, "iobench: cannot create %s\n", path);
+    exit();
+  }
+  memset(buf, 'a' + i, sizeof(buf));
+  for(n = 0; n < NBLOCK; n++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "iobench: write failed\n");
+      break;
+    }
+  }
+  close(fd);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  char path[16];
+  int i, t0, t1, nreq;
+  struct diskstat d0, d1;
+
+  printf(1, "iobench starting\n");
+  getdiskstat(&d0);
+  t0 = uptime();
+  for(i = 0; i < NWRITER; i++){
+    if(fork() == 0)
+      writer(i);
+  }
+  for(i = 0; i < NWRITER; i++)
+    wait();
+  t1 = uptime();
+  getdiskstat(&d1);
+
+  for(i = 0; i < NWRITER; i++){
+    name(path, i);
+    unlink(path);
+  }
+
+  printf(1, "%d writers: ", NWRITER);
+  benchrate(NWRITER * NBLOCK / 2, "KB", t0, t1);
+
+  // qticks counts 10ms ticks.
+  nreq = d1.nreq - d0.nreq;
+  if(nreq == 0)
+    nreq = 1;
+  printf(1, "%d requests in %d commands, %d us queued on average\n",
+         d1.nreq - d0.nreq, d1.ncmd - d0.ncmd,
+         (d1.qticks - d0.qticks) * 10000 / nreq);
+  exit();
+}
@@ -7,6 +7,8 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
 
 void freerange(void *vstart, void *vend);
@@ -22,6 +24,31 @@ struct {
   struct run *freelist;
 } kmem;
 
+// Per-CPU free page caches.  Once kinit2() has run, kalloc()
+// and kfree() work on the current CPU's cache and touch the
+// global kmem list only to move KBATCH pages at a time.
+// A CPU whose cache and the global list are both empty takes
+// a page from another CPU's cache.  Each cache's lock is
+// normally only taken by its own CPU.
+#define KBATCH      32  // pages moved to or from kmem at a time
+#define KCACHEMAX   64  // pages a CPU caches before giving some back
+
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int n;
+};
+
+static struct kcache kcache[NCPU];
+
+// Reference counts of physical pages, which copy-on-write fork
+// shares between address spaces.  kalloc() hands out a page
+// with one reference, kdup() adds one and kfree() drops one,
+// freeing the page when the last reference goes away.
+static int pgref[PHYSTOP/PGSIZE];
+
+#define PGREF(v) pgref[v2p(v) / PGSIZE]
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -30,7 +57,11 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
+  struct kcache *kc;
+
   initlock(&kmem.lock, "kmem");
+  for(kc = kcache; kc < &kcache[NCPU]; kc++)
+    initlock(&kc->lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -47,50 +78,159 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    PGREF(p) = 1;
     kfree(p);
+  }
+}
+
+// Add a reference to the page of physical memory pointed at by v.
+void
+kdup(char *v)
+{
+  if((uint)v % PGSIZE || v < end || v2p(v) >= PHYSTOP || PGREF(v) < 1)
+    panic("kdup");
+  xadd(&PGREF(v), 1);
+}
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+  return PGREF(v);
 }
 
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Drop a reference to the page of physical memory pointed at
+// by v, which normally should have been returned by a call to
+// kalloc(), and free the page if that was the last reference.
+// (The exception is when initializing the allocator; see
+// kinit above.)
 void
 kfree(char *v)
 {
-  struct run *r;
+  struct kcache *kc;
+  struct run *r, *batch;
+  int i;
 
   if((uint)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
     panic("kfree");
+  if((i = xadd(&PGREF(v), -1)) > 1)
+    return;
+  if(i < 1)
+    panic("kfree: free page");
 
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    return;
+  }
+
+  pushcli();
+  kc = &kcache[cpu - cpus];
+  acquire(&kc->lock);
+  r->next = kc->freelist;
+  kc->freelist = r;
+  kc->n++;
+
+  // Give a batch back to the global list if this CPU
+  // has accumulated too many.
+  batch = 0;
+  if(kc->n > KCACHEMAX){
+    batch = kc->freelist;
+    for(i = 1; i < KBATCH; i++)
+      r = r->next;
+    kc->freelist = r->next;
+    kc->n -= KBATCH;
+  }
+  release(&kc->lock);
+  if(batch){
+    acquire(&kmem.lock);
+    r->next = kmem.freelist;
+    kmem.freelist = batch;
     release(&kmem.lock);
+  }
+  popcli();
+}
+
+// Take a page from another CPU's cache.
+// Called with no cache lock held.
+static struct run*
+kcachesteal(struct kcache *self)
+{
+  struct kcache *kc;
+  struct run *r;
+
+  for(kc = kcache; kc < &kcache[ncpu]; kc++){
+    if(kc == self || kc->n == 0)
+      continue;
+    acquire(&kc->lock);
+    if((r = kc->freelist) != 0){
+      kc->freelist = r->next;
+      kc->n--;
+    }
+    release(&kc->lock);
+    if(r)
+      return r;
+  }
+  return 0;
 }
 
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// If memory runs out and the caller holds no spinlock, the
+// buffer cache gives back what pages it can and the allocation
+// is retried.  A caller holding a spinlock might hold one of
+// the buffer cache's, so it gets 0 instead; see bio.c.
 char*
 kalloc(void)
 {
+  struct kcache *kc;
   struct run *r;
+  int reclaim;
 
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      PGREF(r) = 1;
+    }
+    return (char*)r;
+  }
+
+again:
+  pushcli();
+  reclaim = cpu->ncli == 1;
+  kc = &kcache[cpu - cpus];
+  acquire(&kc->lock);
+  if(kc->n == 0){
+    // Refill a batch from the global list.
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
+    while(kc->n < KBATCH && (r = kmem.freelist) != 0){
+      kmem.freelist = r->next;
+      r->next = kc->freelist;
+      kc->freelist = r;
+      kc->n++;
+    }
     release(&kmem.lock);
+  }
+  if((r = kc->freelist) != 0){
+    kc->freelist = r->next;
+    kc->n--;
+  }
+  release(&kc->lock);
+  if(r == 0)
+    r = kcachesteal(kc);
+  popcli();
+  if(r == 0 && reclaim && bshrink() > 0)
+    goto again;
+  if(r)
+    PGREF(r) = 1;
   return (char*)r;
 }
 
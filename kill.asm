@@ -0,0 +1,1267 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 d8 08 00 00       	push   $0x8d8
+  21:	6a 02                	push   $0x2
+  23:	e8 4d 04 00 00       	call   475 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 99 02 00 00       	call   2c9 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 9a 02 00 00       	call   2f9 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 57 02 00 00       	call   2c9 <exit>
+
+00000072 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+    ;
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+    ;
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 47 01 00 00       	call   2e1 <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 0c 01 00 00       	call   309 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 03 01 00 00       	call   321 <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 c2 00 00 00       	call   2f1 <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <exit>:
+SYSCALL(exit)
+ 2c9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <wait>:
+SYSCALL(wait)
+ 2d1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <pipe>:
+SYSCALL(pipe)
+ 2d9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <read>:
+SYSCALL(read)
+ 2e1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <write>:
+SYSCALL(write)
+ 2e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <close>:
+SYSCALL(close)
+ 2f1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <kill>:
+SYSCALL(kill)
+ 2f9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <exec>:
+SYSCALL(exec)
+ 301:	b8 07 00 00 00       	mov    $0x7,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <open>:
+SYSCALL(open)
+ 309:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <mknod>:
+SYSCALL(mknod)
+ 311:	b8 11 00 00 00       	mov    $0x11,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <unlink>:
+SYSCALL(unlink)
+ 319:	b8 12 00 00 00       	mov    $0x12,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <fstat>:
+SYSCALL(fstat)
+ 321:	b8 08 00 00 00       	mov    $0x8,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <link>:
+SYSCALL(link)
+ 329:	b8 13 00 00 00       	mov    $0x13,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <mkdir>:
+SYSCALL(mkdir)
+ 331:	b8 14 00 00 00       	mov    $0x14,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <chdir>:
+SYSCALL(chdir)
+ 339:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <dup>:
+SYSCALL(dup)
+ 341:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <getpid>:
+SYSCALL(getpid)
+ 349:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <sbrk>:
+SYSCALL(sbrk)
+ 351:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <sleep>:
+SYSCALL(sleep)
+ 359:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <uptime>:
+SYSCALL(uptime)
+ 361:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 369:	b8 16 00 00 00       	mov    $0x16,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <getschedstat>:
+SYSCALL(getschedstat)
+ 371:	b8 17 00 00 00       	mov    $0x17,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 379:	b8 18 00 00 00       	mov    $0x18,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <setshare>:
+SYSCALL(setshare)
+ 381:	b8 19 00 00 00       	mov    $0x19,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 389:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 391:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <getlogstat>:
+SYSCALL(getlogstat)
+ 399:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+ 3a4:	83 ec 18             	sub    $0x18,%esp
+ 3a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3aa:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3ad:	83 ec 04             	sub    $0x4,%esp
+ 3b0:	6a 01                	push   $0x1
+ 3b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3b5:	50                   	push   %eax
+ 3b6:	ff 75 08             	push   0x8(%ebp)
+ 3b9:	e8 2b ff ff ff       	call   2e9 <write>
+ 3be:	83 c4 10             	add    $0x10,%esp
+}
+ 3c1:	90                   	nop
+ 3c2:	c9                   	leave
+ 3c3:	c3                   	ret
+
+000003c4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c4:	55                   	push   %ebp
+ 3c5:	89 e5                	mov    %esp,%ebp
+ 3c7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3ca:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3d1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3d5:	74 17                	je     3ee <printint+0x2a>
+ 3d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3db:	79 11                	jns    3ee <printint+0x2a>
+    neg = 1;
+ 3dd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e7:	f7 d8                	neg    %eax
+ 3e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3ec:	eb 06                	jmp    3f4 <printint+0x30>
+  } else {
+    x = xx;
+ 3ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 401:	ba 00 00 00 00       	mov    $0x0,%edx
+ 406:	f7 f1                	div    %ecx
+ 408:	89 d1                	mov    %edx,%ecx
+ 40a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40d:	8d 50 01             	lea    0x1(%eax),%edx
+ 410:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 413:	0f b6 91 e0 0b 00 00 	movzbl 0xbe0(%ecx),%edx
+ 41a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 41e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 421:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 424:	ba 00 00 00 00       	mov    $0x0,%edx
+ 429:	f7 f1                	div    %ecx
+ 42b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 42e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 432:	75 c7                	jne    3fb <printint+0x37>
+  if(neg)
+ 434:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 438:	74 2d                	je     467 <printint+0xa3>
+    buf[i++] = '-';
+ 43a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43d:	8d 50 01             	lea    0x1(%eax),%edx
+ 440:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 443:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 448:	eb 1d                	jmp    467 <printint+0xa3>
+    putc(fd, buf[i]);
+ 44a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 44d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 450:	01 d0                	add    %edx,%eax
+ 452:	0f b6 00             	movzbl (%eax),%eax
+ 455:	0f be c0             	movsbl %al,%eax
+ 458:	83 ec 08             	sub    $0x8,%esp
+ 45b:	50                   	push   %eax
+ 45c:	ff 75 08             	push   0x8(%ebp)
+ 45f:	e8 3d ff ff ff       	call   3a1 <putc>
+ 464:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 467:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 46b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 46f:	79 d9                	jns    44a <printint+0x86>
+}
+ 471:	90                   	nop
+ 472:	90                   	nop
+ 473:	c9                   	leave
+ 474:	c3                   	ret
+
+00000475 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 475:	55                   	push   %ebp
+ 476:	89 e5                	mov    %esp,%ebp
+ 478:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 47b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 482:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 485:	83 c0 04             	add    $0x4,%eax
+ 488:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 48b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 492:	e9 59 01 00 00       	jmp    5f0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 497:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 49a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 49d:	01 d0                	add    %edx,%eax
+ 49f:	0f b6 00             	movzbl (%eax),%eax
+ 4a2:	0f be c0             	movsbl %al,%eax
+ 4a5:	25 ff 00 00 00       	and    $0xff,%eax
+ 4aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4b1:	75 2c                	jne    4df <printf+0x6a>
+      if(c == '%'){
+ 4b3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4b7:	75 0c                	jne    4c5 <printf+0x50>
+        state = '%';
+ 4b9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4c0:	e9 27 01 00 00       	jmp    5ec <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4c8:	0f be c0             	movsbl %al,%eax
+ 4cb:	83 ec 08             	sub    $0x8,%esp
+ 4ce:	50                   	push   %eax
+ 4cf:	ff 75 08             	push   0x8(%ebp)
+ 4d2:	e8 ca fe ff ff       	call   3a1 <putc>
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	e9 0d 01 00 00       	jmp    5ec <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4df:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4e3:	0f 85 03 01 00 00    	jne    5ec <printf+0x177>
+      if(c == 'd'){
+ 4e9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4ed:	75 1e                	jne    50d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4f2:	8b 00                	mov    (%eax),%eax
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	6a 0a                	push   $0xa
+ 4f8:	50                   	push   %eax
+ 4f9:	ff 75 08             	push   0x8(%ebp)
+ 4fc:	e8 c3 fe ff ff       	call   3c4 <printint>
+ 501:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 504:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 508:	e9 d8 00 00 00       	jmp    5e5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 50d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 511:	74 06                	je     519 <printf+0xa4>
+ 513:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 517:	75 1e                	jne    537 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 519:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 51c:	8b 00                	mov    (%eax),%eax
+ 51e:	6a 00                	push   $0x0
+ 520:	6a 10                	push   $0x10
+ 522:	50                   	push   %eax
+ 523:	ff 75 08             	push   0x8(%ebp)
+ 526:	e8 99 fe ff ff       	call   3c4 <printint>
+ 52b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 52e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 532:	e9 ae 00 00 00       	jmp    5e5 <printf+0x170>
+      } else if(c == 's'){
+ 537:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 53b:	75 43                	jne    580 <printf+0x10b>
+        s = (char*)*ap;
+ 53d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 540:	8b 00                	mov    (%eax),%eax
+ 542:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 545:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 549:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 54d:	75 25                	jne    574 <printf+0xff>
+          s = "(null)";
+ 54f:	c7 45 f4 ec 08 00 00 	movl   $0x8ec,-0xc(%ebp)
+        while(*s != 0){
+ 556:	eb 1c                	jmp    574 <printf+0xff>
+          putc(fd, *s);
+ 558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 55b:	0f b6 00             	movzbl (%eax),%eax
+ 55e:	0f be c0             	movsbl %al,%eax
+ 561:	83 ec 08             	sub    $0x8,%esp
+ 564:	50                   	push   %eax
+ 565:	ff 75 08             	push   0x8(%ebp)
+ 568:	e8 34 fe ff ff       	call   3a1 <putc>
+ 56d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 570:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 574:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 577:	0f b6 00             	movzbl (%eax),%eax
+ 57a:	84 c0                	test   %al,%al
+ 57c:	75 da                	jne    558 <printf+0xe3>
+ 57e:	eb 65                	jmp    5e5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 580:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 584:	75 1d                	jne    5a3 <printf+0x12e>
+        putc(fd, *ap);
+ 586:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 589:	8b 00                	mov    (%eax),%eax
+ 58b:	0f be c0             	movsbl %al,%eax
+ 58e:	83 ec 08             	sub    $0x8,%esp
+ 591:	50                   	push   %eax
+ 592:	ff 75 08             	push   0x8(%ebp)
+ 595:	e8 07 fe ff ff       	call   3a1 <putc>
+ 59a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 59d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5a1:	eb 42                	jmp    5e5 <printf+0x170>
+      } else if(c == '%'){
+ 5a3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5a7:	75 17                	jne    5c0 <printf+0x14b>
+        putc(fd, c);
+ 5a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5ac:	0f be c0             	movsbl %al,%eax
+ 5af:	83 ec 08             	sub    $0x8,%esp
+ 5b2:	50                   	push   %eax
+ 5b3:	ff 75 08             	push   0x8(%ebp)
+ 5b6:	e8 e6 fd ff ff       	call   3a1 <putc>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+ 5be:	eb 25                	jmp    5e5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5c0:	83 ec 08             	sub    $0x8,%esp
+ 5c3:	6a 25                	push   $0x25
+ 5c5:	ff 75 08             	push   0x8(%ebp)
+ 5c8:	e8 d4 fd ff ff       	call   3a1 <putc>
+ 5cd:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5d3:	0f be c0             	movsbl %al,%eax
+ 5d6:	83 ec 08             	sub    $0x8,%esp
+ 5d9:	50                   	push   %eax
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 bf fd ff ff       	call   3a1 <putc>
+ 5e2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5e5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5ec:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5f6:	01 d0                	add    %edx,%eax
+ 5f8:	0f b6 00             	movzbl (%eax),%eax
+ 5fb:	84 c0                	test   %al,%al
+ 5fd:	0f 85 94 fe ff ff    	jne    497 <printf+0x22>
+    }
+  }
+}
+ 603:	90                   	nop
+ 604:	90                   	nop
+ 605:	c9                   	leave
+ 606:	c3                   	ret
+
+00000607 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 607:	55                   	push   %ebp
+ 608:	89 e5                	mov    %esp,%ebp
+ 60a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 60d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 610:	83 e8 08             	sub    $0x8,%eax
+ 613:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 616:	a1 fc 0b 00 00       	mov    0xbfc,%eax
+ 61b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 61e:	eb 24                	jmp    644 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 620:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 623:	8b 00                	mov    (%eax),%eax
+ 625:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 628:	72 12                	jb     63c <free+0x35>
+ 62a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 62d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 630:	72 24                	jb     656 <free+0x4f>
+ 632:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 635:	8b 00                	mov    (%eax),%eax
+ 637:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 63a:	72 1a                	jb     656 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 63c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 63f:	8b 00                	mov    (%eax),%eax
+ 641:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 644:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 647:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 64a:	73 d4                	jae    620 <free+0x19>
+ 64c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 64f:	8b 00                	mov    (%eax),%eax
+ 651:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 654:	73 ca                	jae    620 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 656:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 659:	8b 40 04             	mov    0x4(%eax),%eax
+ 65c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 663:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 666:	01 c2                	add    %eax,%edx
+ 668:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66b:	8b 00                	mov    (%eax),%eax
+ 66d:	39 c2                	cmp    %eax,%edx
+ 66f:	75 24                	jne    695 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 671:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 674:	8b 50 04             	mov    0x4(%eax),%edx
+ 677:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67a:	8b 00                	mov    (%eax),%eax
+ 67c:	8b 40 04             	mov    0x4(%eax),%eax
+ 67f:	01 c2                	add    %eax,%edx
+ 681:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 684:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 687:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68a:	8b 00                	mov    (%eax),%eax
+ 68c:	8b 10                	mov    (%eax),%edx
+ 68e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 691:	89 10                	mov    %edx,(%eax)
+ 693:	eb 0a                	jmp    69f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 695:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 698:	8b 10                	mov    (%eax),%edx
+ 69a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 69d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 69f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a2:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6af:	01 d0                	add    %edx,%eax
+ 6b1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6b4:	75 20                	jne    6d6 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b9:	8b 50 04             	mov    0x4(%eax),%edx
+ 6bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bf:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c2:	01 c2                	add    %eax,%edx
+ 6c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6ca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6cd:	8b 10                	mov    (%eax),%edx
+ 6cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d2:	89 10                	mov    %edx,(%eax)
+ 6d4:	eb 08                	jmp    6de <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6dc:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e1:	a3 fc 0b 00 00       	mov    %eax,0xbfc
+}
+ 6e6:	90                   	nop
+ 6e7:	c9                   	leave
+ 6e8:	c3                   	ret
+
+000006e9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6ef:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6f6:	77 07                	ja     6ff <morecore+0x16>
+    nu = 4096;
+ 6f8:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 6ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 702:	c1 e0 03             	shl    $0x3,%eax
+ 705:	83 ec 0c             	sub    $0xc,%esp
+ 708:	50                   	push   %eax
+ 709:	e8 43 fc ff ff       	call   351 <sbrk>
+ 70e:	83 c4 10             	add    $0x10,%esp
+ 711:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 714:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 718:	75 07                	jne    721 <morecore+0x38>
+    return 0;
+ 71a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 71f:	eb 26                	jmp    747 <morecore+0x5e>
+  hp = (Header*)p;
+ 721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 724:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 727:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 72a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 72d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 730:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 733:	83 c0 08             	add    $0x8,%eax
+ 736:	83 ec 0c             	sub    $0xc,%esp
+ 739:	50                   	push   %eax
+ 73a:	e8 c8 fe ff ff       	call   607 <free>
+ 73f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 742:	a1 fc 0b 00 00       	mov    0xbfc,%eax
+}
+ 747:	c9                   	leave
+ 748:	c3                   	ret
+
+00000749 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 749:	55                   	push   %ebp
+ 74a:	89 e5                	mov    %esp,%ebp
+ 74c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 74f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 752:	83 c0 07             	add    $0x7,%eax
+ 755:	c1 e8 03             	shr    $0x3,%eax
+ 758:	83 c0 01             	add    $0x1,%eax
+ 75b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 75e:	a1 fc 0b 00 00       	mov    0xbfc,%eax
+ 763:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 766:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 76a:	75 23                	jne    78f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 76c:	c7 45 f0 f4 0b 00 00 	movl   $0xbf4,-0x10(%ebp)
+ 773:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 776:	a3 fc 0b 00 00       	mov    %eax,0xbfc
+ 77b:	a1 fc 0b 00 00       	mov    0xbfc,%eax
+ 780:	a3 f4 0b 00 00       	mov    %eax,0xbf4
+    base.s.size = 0;
+ 785:	c7 05 f8 0b 00 00 00 	movl   $0x0,0xbf8
+ 78c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 78f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 792:	8b 00                	mov    (%eax),%eax
+ 794:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79a:	8b 40 04             	mov    0x4(%eax),%eax
+ 79d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7a0:	72 4d                	jb     7ef <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a5:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7ab:	75 0c                	jne    7b9 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b0:	8b 10                	mov    (%eax),%edx
+ 7b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b5:	89 10                	mov    %edx,(%eax)
+ 7b7:	eb 26                	jmp    7df <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bc:	8b 40 04             	mov    0x4(%eax),%eax
+ 7bf:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7c2:	89 c2                	mov    %eax,%edx
+ 7c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d0:	c1 e0 03             	shl    $0x3,%eax
+ 7d3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7dc:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7e2:	a3 fc 0b 00 00       	mov    %eax,0xbfc
+      return (void*)(p + 1);
+ 7e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ea:	83 c0 08             	add    $0x8,%eax
+ 7ed:	eb 3b                	jmp    82a <malloc+0xe1>
+    }
+    if(p == freep)
+ 7ef:	a1 fc 0b 00 00       	mov    0xbfc,%eax
+ 7f4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7f7:	75 1e                	jne    817 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7f9:	83 ec 0c             	sub    $0xc,%esp
+ 7fc:	ff 75 ec             	push   -0x14(%ebp)
+ 7ff:	e8 e5 fe ff ff       	call   6e9 <morecore>
+ 804:	83 c4 10             	add    $0x10,%esp
+ 807:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 80a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 80e:	75 07                	jne    817 <malloc+0xce>
+        return 0;
+ 810:	b8 00 00 00 00       	mov    $0x0,%eax
+ 815:	eb 13                	jmp    82a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 81d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 820:	8b 00                	mov    (%eax),%eax
+ 822:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 825:	e9 6d ff ff ff       	jmp    797 <malloc+0x4e>
+  }
+}
+ 82a:	c9                   	leave
+ 82b:	c3                   	ret
+
+0000082c <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 82c:	55                   	push   %ebp
+ 82d:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 82f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 832:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 835:	7e 08                	jle    83f <ticks+0x13>
+ 837:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 83a:	2b 45 08             	sub    0x8(%ebp),%eax
+ 83d:	eb 05                	jmp    844 <ticks+0x18>
+ 83f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 844:	5d                   	pop    %ebp
+ 845:	c3                   	ret
+
+00000846 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 846:	55                   	push   %ebp
+ 847:	89 e5                	mov    %esp,%ebp
+ 849:	53                   	push   %ebx
+ 84a:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 84d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 850:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 853:	ff 75 14             	push   0x14(%ebp)
+ 856:	ff 75 10             	push   0x10(%ebp)
+ 859:	e8 ce ff ff ff       	call   82c <ticks>
+ 85e:	83 c4 08             	add    $0x8,%esp
+ 861:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 863:	89 d8                	mov    %ebx,%eax
+ 865:	99                   	cltd
+ 866:	f7 f9                	idiv   %ecx
+ 868:	89 c2                	mov    %eax,%edx
+ 86a:	8b 45 14             	mov    0x14(%ebp),%eax
+ 86d:	2b 45 10             	sub    0x10(%ebp),%eax
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	ff 75 0c             	push   0xc(%ebp)
+ 876:	52                   	push   %edx
+ 877:	50                   	push   %eax
+ 878:	ff 75 0c             	push   0xc(%ebp)
+ 87b:	ff 75 08             	push   0x8(%ebp)
+ 87e:	68 f4 08 00 00       	push   $0x8f4
+ 883:	6a 01                	push   $0x1
+ 885:	e8 eb fb ff ff       	call   475 <printf>
+ 88a:	83 c4 20             	add    $0x20,%esp
+}
+ 88d:	90                   	nop
+ 88e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 891:	c9                   	leave
+ 892:	c3                   	ret
+
+00000893 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 893:	55                   	push   %ebp
+ 894:	89 e5                	mov    %esp,%ebp
+ 896:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 899:	ff 75 14             	push   0x14(%ebp)
+ 89c:	ff 75 10             	push   0x10(%ebp)
+ 89f:	e8 88 ff ff ff       	call   82c <ticks>
+ 8a4:	83 c4 08             	add    $0x8,%esp
+ 8a7:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 8ad:	99                   	cltd
+ 8ae:	f7 7d 08             	idivl  0x8(%ebp)
+ 8b1:	89 c2                	mov    %eax,%edx
+ 8b3:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8b6:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8b9:	83 ec 08             	sub    $0x8,%esp
+ 8bc:	52                   	push   %edx
+ 8bd:	50                   	push   %eax
+ 8be:	ff 75 0c             	push   0xc(%ebp)
+ 8c1:	ff 75 08             	push   0x8(%ebp)
+ 8c4:	68 14 09 00 00       	push   $0x914
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	e8 a5 fb ff ff       	call   475 <printf>
+ 8d0:	83 c4 20             	add    $0x20,%esp
+}
+ 8d3:	90                   	nop
+ 8d4:	c9                   	leave
+ 8d5:	c3                   	ret
@@ -1,9 +1,12 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "fs.h"
 #include "buf.h"
+#include "logstat.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -17,190 +20,618 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the transaction has been handed to the flusher.
+//
+// Commits are done by a kernel process, the log flusher,
+// rather than by the last end_op().  The flusher commits a
+// transaction LOGDELAY ticks after its first block was logged,
+// or at once if begin_op() is waiting for log space, so that
+// a single commit carries the updates of many system calls.
+// It copies the transaction's blocks into buffers of its own
+// and lets new system calls start before writing them, so the
+// next transaction fills while the previous one goes to disk.
+// An FS system call's updates thus reach the disk a few ticks
+// after end_op() returns.
+//
+// A second kernel process, the checkpointer, later copies the
+// blocks of committed transactions to their home locations,
+// from the flusher's buffers, which it keeps until then.  It
+// does so when the ring is half full or when a transaction
+// has waited CKPTDELAY ticks, so that a block updated by many
+// transactions is installed once.  Until a block has been
+// installed its cache buffer stays pinned, so the cache never
+// rereads the stale home copy.
 //
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
-//   block A
-//   block B
-//   block C
-//   ...
-// Log appends are synchronous.
-
-// Contents of the header block, used for both the on-disk header block
+// Its first block is the checkpoint; the rest are used as a
+// ring of committed transactions.  The on-disk log format:
+//   checkpoint block: where in the ring recovery starts
+//   transaction:
+//     header blocks, containing a sequence number, a checksum
+//       and block #s for block A, B, C, ...
+//     block A
+//     block B
+//     ...
+//   next transaction ...
+// A transaction is committed once all of its blocks have
+// reached the disk, which the checksum over its header and
+// blocks lets recovery tell.  Recovery replays transactions
+// from the checkpoint on for as long as each has the next
+// sequence number and a good checksum, so a commit writes each
+// block once and erases nothing.  A transaction that does not
+// fit before the end of the ring goes at its start instead, so
+// recovery looks for the next one there if not right after.
+// The checkpointer rewrites the checkpoint after installing,
+// which frees the ring space before it for new transactions.
+// The flusher writes one transaction at a time.
+//
+// mkfs chooses the number of log blocks.  Each FS system call
+// reserves log space for the blocks it may write: MAXOPBLOCKS
+// unless it says otherwise with begin_opn().
+
+#define LOGMAGIC 0x6c6f6721  // "!gol"
+
+// Contents of the header blocks, used for both the on-disk header
 // and to keep track in memory of logged block# before commit.
+// On disk only the first n entries of block[] are stored.
 struct logheader {
-  int n;   
+  uint magic;
+  uint seq;    // transaction sequence number
+  uint cksum;  // of the header, with cksum 0, and the blocks
+  int n;
   int block[LOGSIZE];
 };
 
+// Contents of the checkpoint block.
+struct logckpt {
+  uint tail;   // ring offset of the first transaction to replay
+  uint seq;    // its sequence number
+};
+
+// A transaction in the ring that has not been installed.
+struct ltrans {
+  uint pos;    // ring offset of its header
+  uint len;    // header and data blocks
+  int nh;      // header blocks
+  uint seq;
+  int done;    // committed
+  uint time;   // ticks when committed
+};
+
+// Bytes and blocks of the on-disk header holding n entries.
+#define HDRBYTES(n) (sizeof(uint) * 4 + sizeof(int) * (n))
+#define HDRBLKS(n) ((HDRBYTES(n) + BSIZE-1) / BSIZE)
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
+  int ring;        // log blocks after the checkpoint.
+  int cap;         // blocks one transaction can hold.
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int reserved;    // log blocks they have reserved.
+  int committing;  // flusher waits for sys calls to end, please wait.
+  int full;        // begin_op() is waiting for log space.
   int dev;
+  uint started;    // ticks when the first block was logged.
+  int nop;         // FS sys calls in the transaction.
   struct logheader lh;
+  struct buf *pinned[LOGSIZE]; // cache buffers of lh.block[]
+  uint head;       // ring offset after the last transaction.
+  uint seq;        // sequence number of the next one.
+  uint tail;       // ring offset in the on-disk checkpoint.
+  struct ltrans q[LOGSIZE]; // transactions in the ring, oldest first
+  int qhead;       // index in q[] of the oldest.
+  int nq;
+  int nring;       // ring blocks they use.
+  int needspace;   // flusher is waiting for ring space.
+  struct proc *flusher;
+  struct proc *ckpter;
+  struct logstat stat;
 };
 struct log log;
 
+// Disk block of offset off in the ring.
+#define RINGBLK(off) (log.start + 1 + (off))
+
+// The transaction being committed, owned by the flusher.
+static struct logheader clh;
+static struct buf *cbuf[LOGSIZE];     // copies of its blocks
+static struct buf *cpinned[LOGSIZE];  // their cache buffers
+
+// Contents of each ring block, and for the data blocks of
+// transactions not yet installed their home block number and
+// pinned cache buffer.  A transaction's data moves into the
+// ring by trading cbuf[] entries for free rbuf[] ones.
+#define NRING (2*LOGSIZE)
+static struct buf *rbuf[NRING];
+static uint rhome[NRING];
+static struct buf *rpin[NRING];
+
 static void recover_from_log(void);
-static void commit();
+static void logflusher(void);
+static void logckpter(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
+  struct buf *pg;
+  int i, n;
+
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
   log.size = sb.nlog;
+  log.ring = log.size - 1;
+  log.cap = LOGCAP(sb.nlog);
   log.dev = dev;
+  if (log.cap > LOGSIZE || log.cap < 2*MAXOPBLOCKS || log.ring > NRING)
+    panic("initlog: bad log size");
+
+  // The flusher's buffers, n to a page.
+  n = PGSIZE / sizeof(struct buf);
+  pg = 0;
+  for (i = 0; i < log.cap + log.ring; i++) {
+    if (i % n == 0 && (pg = (struct buf*)kalloc()) == 0)
+      panic("initlog: out of memory");
+    if (i < log.cap)
+      cbuf[i] = &pg[i % n];
+    else
+      rbuf[i - log.cap] = &pg[i % n];
+  }
+
   recover_from_log();
+  log.flusher = kthread("logflush", logflusher);
+  log.ckpter = kthread("logckpt", logckpter);
 }
 
-// Copy committed blocks from log to their home location
-static void 
-install_trans(void)
+// FNV-1a hash of n bytes at p, continuing from h.
+#define CKSUMINIT 2166136261U
+static uint
+cksum(uint h, uchar *p, int n)
 {
-  int tail;
+  while (n-- > 0)
+    h = (h ^ *p++) * 16777619U;
+  return h;
+}
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf); 
-    brelse(dbuf);
-  }
+// Checksum of a transaction with header lh and blocks in b[].
+static uint
+trans_cksum(struct logheader *lh, struct buf **b)
+{
+  uint c, h;
+  int i;
+
+  c = lh->cksum;
+  lh->cksum = 0;
+  h = cksum(CKSUMINIT, (uchar*)lh, HDRBYTES(lh->n));
+  lh->cksum = c;
+  for (i = 0; i < lh->n; i++)
+    h = cksum(h, b[i]->data, BSIZE);
+  return h;
 }
 
-// Read the log header from disk into the in-memory log header
+// Write the checkpoint: recovery is to start at ring offset
+// tail with transaction seq.
 static void
-read_head(void)
+write_ckpt(uint tail, uint seq)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
-  }
+  struct logckpt *ck = (struct logckpt *) (buf->data);
+
+  memset(buf->data, 0, BSIZE);
+  ck->tail = tail;
+  ck->seq = seq;
+  bwrite(buf);
   brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
-static void
-write_head(void)
+// Read the header at ring offset pos into log.lh.
+// Return -1 if it is not that of transaction seq.
+static int
+read_head(uint pos, uint seq)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
+  struct buf *buf;
+  int i, off, len;
+
+  for (i = 0; ; i++) {
+    off = i * BSIZE;
+    if (i > 0 && off >= HDRBYTES(log.lh.n))
+      break;
+    if (pos + i >= log.ring)
+      return -1;
+    buf = bread(log.dev, RINGBLK(pos + i));
+    len = HDRBYTES(LOGSIZE) - off;
+    memmove((char*)&log.lh + off, buf->data, len < BSIZE ? len : BSIZE);
+    brelse(buf);
+    if (i == 0 && (log.lh.magic != LOGMAGIC || log.lh.seq != seq ||
+                   log.lh.n < 0 || log.lh.n > log.cap))
+      return -1;
+  }
+  if (pos + HDRBLKS(log.lh.n) + log.lh.n > log.ring)
+    return -1;
+  return 0;
+}
+
+// If the transaction at ring offset pos is transaction seq and
+// was committed, copy its blocks to their home locations.
+// All the writes are queued before waiting for any of them.
+// Return -1 if it is not.
+static int
+replay_trans(uint pos, uint seq)
+{
+  int i, nh;
+  static struct buf *lbuf[LOGSIZE], *dbuf[LOGSIZE];  // too big for the stack
+
+  if (read_head(pos, seq) < 0)
+    return -1;
+  nh = HDRBLKS(log.lh.n);
+  for (i = 0; i < log.lh.n; i++)
+    lbuf[i] = bread(log.dev, RINGBLK(pos + nh + i)); // read log block
+  if (trans_cksum(&log.lh, lbuf) != log.lh.cksum) {
+    for (i = 0; i < log.lh.n; i++)
+      brelse(lbuf[i]);
+    return -1;
+  }
   for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+    dbuf[i] = bread(log.dev, log.lh.block[i]); // read dst
+    memmove(dbuf[i]->data, lbuf[i]->data, BSIZE);  // copy block to dst
+    bwrite_async(dbuf[i], 0);  // start writing dst to disk
+    brelse(lbuf[i]);
   }
-  bwrite(buf);
-  brelse(buf);
+  for (i = 0; i < log.lh.n; i++) {
+    biowait(dbuf[i]);
+    brelse(dbuf[i]);
+  }
+  return 0;
 }
 
 static void
 recover_from_log(void)
 {
-  read_head();      
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  struct buf *buf;
+  struct logckpt *ck;
+  uint pos, seq;
+
+  buf = bread(log.dev, log.start);
+  ck = (struct logckpt *) (buf->data);
+  pos = ck->tail;
+  seq = ck->seq;
+  brelse(buf);
+
+  // Replaying a transaction that was already installed is
+  // harmless, as long as they are replayed in order.
+  for (;;) {
+    if (replay_trans(pos, seq) < 0) {
+      if (pos == 0 || replay_trans(0, seq) < 0)
+        break;
+      pos = 0;
+    }
+    pos += HDRBLKS(log.lh.n) + log.lh.n;
+    seq++;
+  }
+  memset(&log.lh, 0, sizeof(log.lh));
+  log.head = 0;
+  log.tail = 0;
+  log.seq = seq;
+  write_ckpt(0, seq);  // start the ring afresh
 }
 
-// called at the start of each FS system call.
+// Wake the flusher or the checkpointer from logsleep().
+// Caller holds log.lock.
+static void
+logwake(struct proc *p)
+{
+  acquire(&tickslock);
+  wakeup(&p->wakeat);
+  release(&tickslock);
+}
+
+// Sleep until tick t (forever if t is 0) or a logwake().
+// Called and returns holding log.lock.  tickslock is taken
+// before log.lock is let go, so no logwake() is lost.
+static void
+logsleep(uint t)
+{
+  acquire(&tickslock);
+  if(t && (int)(t - ticks) <= 0){
+    release(&tickslock);
+    return;
+  }
+  release(&log.lock);
+  if(t){
+    proc->wakeat = t;
+    timeradd(proc);
+  }
+  sleep(&proc->wakeat, &tickslock);
+  if(t)
+    timerdel(proc);
+  release(&tickslock);
+  acquire(&log.lock);
+}
+
+// The most log blocks one FS system call may reserve.
+int
+log_maxop(void)
+{
+  return log.cap / 2;
+}
+
+// called at the start of each FS system call that may
+// write up to n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > log_maxop())
+    panic("begin_opn");
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > log.cap){
       // this op might exhaust log space; wait for commit.
+      if(log.lh.n > 0 && !log.full){
+        log.full = 1;
+        logwake(log.flusher);
+      }
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      proc->logres = n;
       release(&log.lock);
       break;
     }
   }
 }
 
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// the flusher commits the transaction later.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
+  if(log.outstanding < 1)
+    panic("end_op");
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space.
-    wakeup(&log);
+  log.reserved -= proc->logres;
+  log.nop++;
+  // begin_op() may be waiting for log space,
+  // or the flusher for the last op to end.
+  wakeup(&log);
+  release(&log.lock);
+}
+
+// Hand the current transaction to the flusher, copying its
+// blocks out of the cache so that new FS system calls can
+// change them.  Caller holds log.lock and no FS system call
+// is outstanding, so nobody is modifying the blocks.
+static void
+detach_trans(void)
+{
+  int i;
+
+  clh.n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+    clh.block[i] = log.lh.block[i];
+    cpinned[i] = log.pinned[i];
+    memmove(cbuf[i]->data, cpinned[i]->data, BSIZE);
   }
+  log.stat.ncommit++;
+  log.stat.nop += log.nop;
+  log.stat.nblock += log.lh.n;
+  log.lh.n = 0;
+  log.nop = 0;
+}
+
+// Return the ring offset at which a transaction of len blocks
+// fits, or -1 if there is no room until the checkpointer has
+// installed some.  Caller holds log.lock.
+static int
+ringfit(uint len)
+{
+  if (log.nq == 0 || log.tail < log.head) {
+    if (log.head + len <= log.ring)
+      return log.head;
+    if (len <= log.tail || (log.nq == 0 && len <= log.ring))
+      return 0;
+  } else if (log.tail > log.head && log.head + len <= log.tail)
+    return log.head;
+  return -1;
+}
+
+// Write the detached transaction to the log, which commits it,
+// and leave it to the checkpointer to install.
+// All the writes are queued before waiting for any of them.
+static void
+commit(void)
+{
+  struct ltrans *t;
+  struct buf *b;
+  int i, n, nh, pos, off, len;
+
+  n = clh.n;
+  nh = HDRBLKS(n);
+  acquire(&log.lock);
+  while ((pos = ringfit(nh + n)) < 0) {
+    log.needspace = 1;
+    logwake(log.ckpter);
+    sleep(&log.tail, &log.lock);
+  }
+  t = &log.q[(log.qhead + log.nq) % LOGSIZE];
+  t->pos = pos;
+  t->len = nh + n;
+  t->nh = nh;
+  t->seq = log.seq;
+  t->done = 0;
+  log.nq++;
+  log.nring += nh + n;
+  log.head = pos + nh + n;
+  log.seq++;
   release(&log.lock);
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
+  clh.magic = LOGMAGIC;
+  clh.seq = t->seq;
+  clh.cksum = trans_cksum(&clh, cbuf);
+  for (i = 0; i < nh; i++) {
+    off = i * BSIZE;
+    len = HDRBYTES(n) - off;
+    b = rbuf[pos + i];
+    memmove(b->data, (char*)&clh + off, len < BSIZE ? len : BSIZE);
+    b->dev = log.dev;
+    b->blockno = RINGBLK(pos + i);
+    b->flags = B_BUSY|B_VALID;
+    bwrite_async(b, 0);  // start writing the header
+  }
+  for (i = 0; i < n; i++) {
+    b = cbuf[i];
+    cbuf[i] = rbuf[pos + nh + i];
+    rbuf[pos + nh + i] = b;
+    rhome[pos + nh + i] = clh.block[i];
+    rpin[pos + nh + i] = cpinned[i];
+    b->dev = log.dev;
+    b->blockno = RINGBLK(pos + nh + i);
+    b->flags = B_BUSY|B_VALID;
+    bwrite_async(b, 0);  // start writing the log
+  }
+  for (i = 0; i < nh + n; i++)
+    biowait(rbuf[pos + i]);  // committed
+  clh.n = 0;
+
+  acquire(&log.lock);
+  t->done = 1;
+  t->time = ticks;
+  if (log.nring * 2 >= log.ring)
+    logwake(log.ckpter);
+  release(&log.lock);
+}
+
+// The log flusher's kernel process.
+static void
+logflusher(void)
+{
+  acquire(&log.lock);
+  for(;;){
+    if(log.lh.n == 0){
+      logsleep(0);
+      continue;
+    }
+    if(!log.full && ticks - log.started < LOGDELAY){
+      logsleep(log.started + LOGDELAY);
+      continue;
+    }
+    if(log.full)
+      log.stat.nfull++;
+    log.committing = 1;
+    while(log.outstanding > 0)
+      sleep(&log, &log.lock);
+    detach_trans();
     log.committing = 0;
+    log.full = 0;
     wakeup(&log);
     release(&log.lock);
+
+    commit();
+    acquire(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
-static void 
-write_log(void)
+// Install the first k transactions in the ring, which are
+// committed, then move the checkpoint past them to ring offset
+// tail and transaction seq.  Of several copies of a block
+// only the newest is written.  Returns the number written.
+static int
+install_trans(int k, uint tail, uint seq)
 {
-  int tail;
+  struct ltrans *t, *u;
+  int i, j, x, y, n;
+  static int inst[NRING];  // too big for the stack
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from); 
-    brelse(to);
+  n = 0;
+  for (i = 0; i < k; i++) {
+    t = &log.q[(log.qhead + i) % LOGSIZE];
+    for (x = t->pos + t->nh; x < t->pos + t->len; x++) {
+      for (j = i + 1; j < k; j++) {
+        u = &log.q[(log.qhead + j) % LOGSIZE];
+        for (y = u->pos + u->nh; y < u->pos + u->len; y++)
+          if (rhome[y] == rhome[x])
+            goto newer;
+      }
+      rbuf[x]->blockno = rhome[x];
+      bwrite_async(rbuf[x], 0);  // start installing
+      inst[n++] = x;
+    newer:;
+    }
   }
+  for (i = 0; i < n; i++)
+    biowait(rbuf[inst[i]]);
+  write_ckpt(tail, seq);
+  return n;
 }
 
+// The checkpointer's kernel process.
 static void
-commit()
+logckpter(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0; 
-    write_head();    // Erase the transaction from the log
+  struct ltrans *t;
+  uint tail, seq;
+  int i, k, x, n;
+
+  acquire(&log.lock);
+  for(;;){
+    for (k = 0; k < log.nq && log.q[(log.qhead + k) % LOGSIZE].done; k++)
+      ;
+    if (k == 0) {
+      logsleep(0);
+      continue;
+    }
+    t = &log.q[log.qhead];
+    if (!log.needspace && log.nring * 2 < log.ring &&
+       ticks - t->time < CKPTDELAY) {
+      logsleep(t->time + CKPTDELAY);
+      continue;
+    }
+    // Recovery is to start at the first transaction left, or
+    // where the next one will go if none is.
+    if (k < log.nq) {
+      tail = log.q[(log.qhead + k) % LOGSIZE].pos;
+      seq = log.q[(log.qhead + k) % LOGSIZE].seq;
+    } else {
+      tail = log.head;
+      seq = log.seq;
+    }
+    release(&log.lock);
+
+    n = install_trans(k, tail, seq);
+
+    acquire(&log.lock);
+    for (i = 0; i < k; i++) {
+      t = &log.q[log.qhead];
+      for (x = t->pos + t->nh; x < t->pos + t->len; x++)
+        bunpin(rpin[x]);
+      log.nring -= t->len;
+      log.qhead = (log.qhead + 1) % LOGSIZE;
+      log.nq--;
+    }
+    log.tail = tail;
+    log.stat.nckpt++;
+    log.stat.ninstall += n;
+    log.needspace = 0;
+    wakeup(&log.tail);
   }
 }
 
 // Caller has modified b->data and is done with the buffer.
-// Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// Record the block number and pin b in the cache.
+// The flusher will do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -212,7 +643,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.cap)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -222,10 +653,23 @@ log_write(struct buf *b)
     if (log.lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
+  if (i == log.lh.n) {
+    log.lh.block[i] = b->blockno;
+    log.pinned[i] = b;
+    bpin(b);  // prevent eviction
+    if (log.lh.n++ == 0) {
+      log.started = ticks;
+      logwake(log.flusher);
+    }
+  }
   release(&log.lock);
 }
 
+// Fill in log statistics for getlogstat().
+void
+logstat(struct logstat *st)
+{
+  acquire(&log.lock);
+  *st = log.stat;
+  release(&log.lock);
+}
@@ -0,0 +1,9 @@
+// Log statistics, returned by getlogstat().
+struct logstat {
+  uint ncommit;   // Transactions committed
+  uint nop;       // FS system calls those transactions held
+  uint nblock;    // Blocks they wrote to the log
+  uint nfull;     // Commits started early because the log was full
+  uint nckpt;     // Checkpoints
+  uint ninstall;  // Blocks those checkpoints wrote home
+};
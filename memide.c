@@ -11,17 +11,19 @@
 #include "spinlock.h"
 #include "fs.h"
 #include "buf.h"
+#include "diskstat.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_fsmem_img_start[], _binary_fsmem_img_size[];
 
 static int disksize;
+static uint nblock;
 static uchar *memdisk;
 
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  memdisk = _binary_fsmem_img_start;
+  disksize = (uint)_binary_fsmem_img_size/BSIZE;
 }
 
 // Interrupt handler.
@@ -34,7 +36,8 @@ ideintr(void)
 // Sync buf with disk. 
 // If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
 // Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
+// The memory disk never fails, so it returns 0.
+int
 iderw(struct buf *b)
 {
   uchar *p;
@@ -49,6 +52,7 @@ iderw(struct buf *b)
     panic("iderw: block out of range");
 
   p = memdisk + b->blockno*BSIZE;
+  nblock++;
   
   if(b->flags & B_DIRTY){
     b->flags &= ~B_DIRTY;
@@ -56,4 +60,36 @@ iderw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  return 0;
+}
+
+// The memory disk finishes every request at once, so
+// completion is signalled before idesubmit() returns.
+void
+idesubmit(struct buf *b)
+{
+  void (*done)(struct buf*);
+
+  iderw(b);
+  if((done = b->done) != 0){
+    b->done = 0;
+    done(b);
+  }
+}
+
+int
+ideawait(struct buf *b)
+{
+  return 0;
+}
+
+void
+idestat(struct diskstat *st)
+{
+  st->ncmd = nblock;
+  st->nblock = nblock;
+  st->nreq = nblock;
+  st->qticks = 0;
+  st->intrkcycles = 0;
+  st->dma = 0;
 }
@@ -20,9 +20,10 @@
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
+int fssize = FSSIZE;  // mkfs -s changes it
+int nbitmap;  // Number of bitmap blocks
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;  
+int nlog = LOGSIZE;  // mkfs -l changes it
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -40,6 +41,7 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void rwextent(struct dinode *din, uint i, struct extent *e, int wr);
 
 // convert to intel byte order
 ushort
@@ -76,10 +78,30 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  while(argc > 2 && argv[1][0] == '-'){
+    if(strcmp(argv[1], "-l") == 0)
+      nlog = atoi(argv[2]);
+    else if(strcmp(argv[1], "-s") == 0)
+      fssize = atoi(argv[2]);
+    else
+      break;
+    argc -= 2;
+    argv += 2;
+  }
+  if(argc < 2 || argv[1][0] == '-'){
+    fprintf(stderr, "Usage: mkfs [-l nlog] [-s size] fs.img files...\n");
+    exit(1);
+  }
+  if((int)LOGCAP(nlog) < 2*MAXOPBLOCKS || (int)LOGCAP(nlog) > LOGSIZE){
+    fprintf(stderr, "mkfs: log must hold %d to %d blocks\n", 2*MAXOPBLOCKS, LOGSIZE);
     exit(1);
   }
+  // The kernel sizes its free block counts for FSSIZE.
+  if(fssize < 1000 || fssize > FSSIZE){
+    fprintf(stderr, "mkfs: size must be 1000 to %d blocks\n", FSSIZE);
+    exit(1);
+  }
+  nbitmap = fssize/(BSIZE*8) + 1;
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
@@ -92,9 +114,9 @@ main(int argc, char *argv[])
 
   // 1 fs block = 1 disk sector
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
-  nblocks = FSSIZE - nmeta;
+  nblocks = fssize - nmeta;
 
-  sb.size = xint(FSSIZE);
+  sb.size = xint(fssize);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
@@ -103,11 +125,11 @@ main(int argc, char *argv[])
   sb.bmapstart = xint(2+nlog+ninodeblocks);
 
   printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, fssize);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
+  for(i = 0; i < fssize; i++)
     wsect(i, zeroes);
 
   memset(buf, 0, sizeof(buf));
@@ -252,14 +274,42 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Read extent i of din into *e (in disk byte order), or with
+// wr set, write *e to it.  Images mkfs builds need at most the
+// extents in the inode and the first extent block.
+void
+rwextent(struct dinode *din, uint i, struct extent *e, int wr)
+{
+  struct extent xb[NXPB];
+
+  assert(i < NEXTENT + NXPB);
+  if(i < NEXTENT){
+    if(wr)
+      din->ext[i] = *e;
+    else
+      *e = din->ext[i];
+    return;
+  }
+  if(xint(din->xaddrs[0]) == 0){
+    assert(wr);
+    din->xaddrs[0] = xint(freeblock++);
+  }
+  rsect(xint(din->xaddrs[0]), (char*)xb);
+  if(wr){
+    xb[i - NEXTENT] = *e;
+    wsect(xint(din->xaddrs[0]), (char*)xb);
+  } else
+    *e = xb[i - NEXTENT];
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
   char *p = (char*)xp;
-  uint fbn, off, n1;
+  uint fbn, off, n1, i;
   struct dinode din;
+  struct extent e;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -268,21 +318,25 @@ iappend(uint inum, void *xp, int n)
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
+    i = xint(din.nextent);
+    if(off % BSIZE == 0){
+      // Add a block, to the last extent if it ends just before.
+      x = freeblock++;
+      if(i > 0)
+        rwextent(&din, i - 1, &e, 0);
+      if(i > 0 && xint(e.start) + xint(e.len) == x){
+        e.len = xint(xint(e.len) + 1);
+        rwextent(&din, i - 1, &e, 1);
+      } else {
+        e.start = xint(x);
+        e.len = xint(1);
+        rwextent(&din, i, &e, 1);
+        din.nextent = xint(i + 1);
       }
-      x = xint(din.addrs[fbn]);
     } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
+      // The last block has room.
+      rwextent(&din, i - 1, &e, 0);
+      x = xint(e.start) + xint(e.len) - 1;
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -7,8 +7,24 @@
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NSEG          4  // max demand-paged ELF segments per process
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE      (MAXOPBLOCKS*20) // max data blocks in on-disk log
+#define LOGDELAY      3  // ticks a transaction may wait to be committed
+#define CKPTDELAY   100  // ticks a committed transaction may wait to be installed
+#define NBUF         (MAXOPBLOCKS*3)  // initial size of disk block cache
+#define BCACHEPCT    10  // max % of physical memory for the block cache
+#ifndef NREADAHEAD
+#define NREADAHEAD    8  // blocks read ahead of a sequential reader
+#endif
+#define IDEDMA        1  // use IDE bus-master DMA if the controller has it
+#define FSSIZE       20000  // size of file system in blocks
+#define SCHED_RR        0  // round-robin scheduling policy
+#define SCHED_MLFQ      1  // multi-level feedback queue policy
+#define SCHED_STRIDE    2  // stride (proportional-share) policy
+#define SCHEDPOLICY  SCHED_RR  // scheduling policy at boot
+#define NMLFQ           3  // MLFQ priority levels; level l runs 1<<l ticks
+#define MLFQBOOST     100  // ticks between MLFQ priority boosts
+#define NTICKETS      100  // default stride scheduling share
+#define MAXTICKETS  10000  // largest share setshare() accepts
 
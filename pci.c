@@ -0,0 +1,75 @@
+// PCI configuration space access through I/O ports 0xCF8/0xCFC
+// (configuration mechanism #1), enough to find a device by class.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFADDR  0xcf8
+#define PCI_CONFDATA  0xcfc
+
+// A device is named by the configuration address of its
+// register 0: 0x80000000 | bus<<16 | dev<<11 | func<<8.
+
+uint
+pciread(uint tag, int reg)
+{
+  outl(PCI_CONFADDR, tag | (reg & 0xfc));
+  return inl(PCI_CONFDATA);
+}
+
+void
+pciwrite(uint tag, int reg, uint v)
+{
+  outl(PCI_CONFADDR, tag | (reg & 0xfc));
+  outl(PCI_CONFDATA, v);
+}
+
+// Let the function respond to I/O space accesses and master
+// the bus.  The status register is the upper half of the
+// command register's word, and writing 1s there clears its
+// bits, so only the command half is written back.
+void
+pcienable(uint tag)
+{
+  uint cmd;
+
+  cmd = pciread(tag, PCI_COMMAND) & 0xffff;
+  pciwrite(tag, PCI_COMMAND, cmd | PCI_CMD_IO | PCI_CMD_MASTER);
+}
+
+// Return the tag of the first function on bus 0 whose
+// configuration register reg, shifted right by shift, is v,
+// or 0 if none.
+static uint
+pcimatch(int reg, int shift, uint v)
+{
+  uint tag;
+  int dev, func;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      tag = 0x80000000 | (dev<<11) | (func<<8);
+      if((pciread(tag, PCI_ID) & 0xffff) == 0xffff)
+        continue;
+      if((pciread(tag, reg) >> shift) == v)
+        return tag;
+    }
+  }
+  return 0;
+}
+
+// Find a function by class and subclass: class>>8, class&0xff.
+uint
+pcifind(int class)
+{
+  return pcimatch(PCI_CLASS, 16, class);
+}
+
+// Find a function by device<<16 | vendor.
+uint
+pcifindid(uint id)
+{
+  return pcimatch(PCI_ID, 0, id);
+}
@@ -0,0 +1,12 @@
+// PCI configuration space registers.
+
+#define PCI_ID        0x00  // Vendor and device ID
+#define PCI_COMMAND   0x04  // Command and status
+#define PCI_CLASS     0x08  // Class, subclass, interface, revision
+#define PCI_BAR(n)    (0x10 + 4*(n))  // Base address registers
+#define PCI_INTR      0x3c  // Interrupt line and pin
+
+#define PCI_CMD_IO      0x1  // Respond to I/O space accesses
+#define PCI_CMD_MASTER  0x4  // May act as bus master
+
+#define PCI_CLASS_IDE   0x0101  // Mass storage, IDE controller
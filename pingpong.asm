@@ -0,0 +1,1490 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <run>:
+#define NROUND 4000
+
+// Measure NROUND round trips with nidle sleepers present.
+void
+run(int nidle)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 38             	sub    $0x38,%esp
+  int idle[2], p1[2], p2[2], i, n, pid, t0, t1;
+  char c;
+
+  if(pipe(idle) < 0 || pipe(p1) < 0 || pipe(p2) < 0){
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8d 45 dc             	lea    -0x24(%ebp),%eax
+   c:	50                   	push   %eax
+   d:	e8 c1 04 00 00       	call   4d3 <pipe>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	85 c0                	test   %eax,%eax
+  17:	78 26                	js     3f <run+0x3f>
+  19:	83 ec 0c             	sub    $0xc,%esp
+  1c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  1f:	50                   	push   %eax
+  20:	e8 ae 04 00 00       	call   4d3 <pipe>
+  25:	83 c4 10             	add    $0x10,%esp
+  28:	85 c0                	test   %eax,%eax
+  2a:	78 13                	js     3f <run+0x3f>
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  32:	50                   	push   %eax
+  33:	e8 9b 04 00 00       	call   4d3 <pipe>
+  38:	83 c4 10             	add    $0x10,%esp
+  3b:	85 c0                	test   %eax,%eax
+  3d:	79 17                	jns    56 <run+0x56>
+    printf(1, "pingpong: pipe failed\n");
+  3f:	83 ec 08             	sub    $0x8,%esp
+  42:	68 d0 0a 00 00       	push   $0xad0
+  47:	6a 01                	push   $0x1
+  49:	e8 21 06 00 00       	call   66f <printf>
+  4e:	83 c4 10             	add    $0x10,%esp
+    exit();
+  51:	e8 6d 04 00 00       	call   4c3 <exit>
+  }
+
+  // Idle processes block reading a pipe nobody writes
+  // until the measurement is done.
+  for(n = 0; n < nidle; n++){
+  56:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  5d:	eb 41                	jmp    a0 <run+0xa0>
+    if((pid = fork()) < 0)
+  5f:	e8 57 04 00 00       	call   4bb <fork>
+  64:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  67:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  6b:	78 3d                	js     aa <run+0xaa>
+      break;
+    if(pid == 0){
+  6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  71:	75 29                	jne    9c <run+0x9c>
+      close(idle[1]);
+  73:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  76:	83 ec 0c             	sub    $0xc,%esp
+  79:	50                   	push   %eax
+  7a:	e8 6c 04 00 00       	call   4eb <close>
+  7f:	83 c4 10             	add    $0x10,%esp
+      read(idle[0], &c, 1);
+  82:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  85:	83 ec 04             	sub    $0x4,%esp
+  88:	6a 01                	push   $0x1
+  8a:	8d 55 cb             	lea    -0x35(%ebp),%edx
+  8d:	52                   	push   %edx
+  8e:	50                   	push   %eax
+  8f:	e8 47 04 00 00       	call   4db <read>
+  94:	83 c4 10             	add    $0x10,%esp
+      exit();
+  97:	e8 27 04 00 00       	call   4c3 <exit>
+  for(n = 0; n < nidle; n++){
+  9c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  a3:	3b 45 08             	cmp    0x8(%ebp),%eax
+  a6:	7c b7                	jl     5f <run+0x5f>
+  a8:	eb 01                	jmp    ab <run+0xab>
+      break;
+  aa:	90                   	nop
+    }
+  }
+
+  if((pid = fork()) == 0){
+  ab:	e8 0b 04 00 00       	call   4bb <fork>
+  b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  b7:	75 4d                	jne    106 <run+0x106>
+    for(i = 0; i < NROUND; i++){
+  b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  c0:	eb 33                	jmp    f5 <run+0xf5>
+      if(read(p1[0], &c, 1) != 1)
+  c2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  c5:	83 ec 04             	sub    $0x4,%esp
+  c8:	6a 01                	push   $0x1
+  ca:	8d 55 cb             	lea    -0x35(%ebp),%edx
+  cd:	52                   	push   %edx
+  ce:	50                   	push   %eax
+  cf:	e8 07 04 00 00       	call   4db <read>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	83 f8 01             	cmp    $0x1,%eax
+  da:	75 24                	jne    100 <run+0x100>
+        break;
+      write(p2[1], &c, 1);
+  dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  df:	83 ec 04             	sub    $0x4,%esp
+  e2:	6a 01                	push   $0x1
+  e4:	8d 55 cb             	lea    -0x35(%ebp),%edx
+  e7:	52                   	push   %edx
+  e8:	50                   	push   %eax
+  e9:	e8 f5 03 00 00       	call   4e3 <write>
+  ee:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NROUND; i++){
+  f1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  f5:	81 7d f4 9f 0f 00 00 	cmpl   $0xf9f,-0xc(%ebp)
+  fc:	7e c4                	jle    c2 <run+0xc2>
+  fe:	eb 01                	jmp    101 <run+0x101>
+        break;
+ 100:	90                   	nop
+    }
+    exit();
+ 101:	e8 bd 03 00 00       	call   4c3 <exit>
+  }
+
+  c = 'x';
+ 106:	c6 45 cb 78          	movb   $0x78,-0x35(%ebp)
+  t0 = uptime();
+ 10a:	e8 4c 04 00 00       	call   55b <uptime>
+ 10f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; i < NROUND; i++){
+ 112:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 119:	eb 33                	jmp    14e <run+0x14e>
+    write(p1[1], &c, 1);
+ 11b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 11e:	83 ec 04             	sub    $0x4,%esp
+ 121:	6a 01                	push   $0x1
+ 123:	8d 55 cb             	lea    -0x35(%ebp),%edx
+ 126:	52                   	push   %edx
+ 127:	50                   	push   %eax
+ 128:	e8 b6 03 00 00       	call   4e3 <write>
+ 12d:	83 c4 10             	add    $0x10,%esp
+    if(read(p2[0], &c, 1) != 1)
+ 130:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 133:	83 ec 04             	sub    $0x4,%esp
+ 136:	6a 01                	push   $0x1
+ 138:	8d 55 cb             	lea    -0x35(%ebp),%edx
+ 13b:	52                   	push   %edx
+ 13c:	50                   	push   %eax
+ 13d:	e8 99 03 00 00       	call   4db <read>
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	83 f8 01             	cmp    $0x1,%eax
+ 148:	75 0f                	jne    159 <run+0x159>
+  for(i = 0; i < NROUND; i++){
+ 14a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 14e:	81 7d f4 9f 0f 00 00 	cmpl   $0xf9f,-0xc(%ebp)
+ 155:	7e c4                	jle    11b <run+0x11b>
+ 157:	eb 01                	jmp    15a <run+0x15a>
+      break;
+ 159:	90                   	nop
+  }
+  t1 = uptime();
+ 15a:	e8 fc 03 00 00       	call   55b <uptime>
+ 15f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  wait();
+ 162:	e8 64 03 00 00       	call   4cb <wait>
+
+  close(idle[1]);
+ 167:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 16a:	83 ec 0c             	sub    $0xc,%esp
+ 16d:	50                   	push   %eax
+ 16e:	e8 78 03 00 00       	call   4eb <close>
+ 173:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 176:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17d:	eb 09                	jmp    188 <run+0x188>
+    wait();
+ 17f:	e8 47 03 00 00       	call   4cb <wait>
+  for(i = 0; i < n; i++)
+ 184:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 188:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 18b:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 18e:	7c ef                	jl     17f <run+0x17f>
+  close(idle[0]);
+ 190:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 193:	83 ec 0c             	sub    $0xc,%esp
+ 196:	50                   	push   %eax
+ 197:	e8 4f 03 00 00       	call   4eb <close>
+ 19c:	83 c4 10             	add    $0x10,%esp
+  close(p1[0]);
+ 19f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1a2:	83 ec 0c             	sub    $0xc,%esp
+ 1a5:	50                   	push   %eax
+ 1a6:	e8 40 03 00 00       	call   4eb <close>
+ 1ab:	83 c4 10             	add    $0x10,%esp
+  close(p1[1]);
+ 1ae:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	50                   	push   %eax
+ 1b5:	e8 31 03 00 00       	call   4eb <close>
+ 1ba:	83 c4 10             	add    $0x10,%esp
+  close(p2[0]);
+ 1bd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 1c0:	83 ec 0c             	sub    $0xc,%esp
+ 1c3:	50                   	push   %eax
+ 1c4:	e8 22 03 00 00       	call   4eb <close>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+  close(p2[1]);
+ 1cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	50                   	push   %eax
+ 1d3:	e8 13 03 00 00       	call   4eb <close>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "sleepers %d: ", n);
+ 1db:	83 ec 04             	sub    $0x4,%esp
+ 1de:	ff 75 f0             	push   -0x10(%ebp)
+ 1e1:	68 e7 0a 00 00       	push   $0xae7
+ 1e6:	6a 01                	push   $0x1
+ 1e8:	e8 82 04 00 00       	call   66f <printf>
+ 1ed:	83 c4 10             	add    $0x10,%esp
+  benchtime(NROUND, "round trips", t0, t1);
+ 1f0:	ff 75 e4             	push   -0x1c(%ebp)
+ 1f3:	ff 75 e8             	push   -0x18(%ebp)
+ 1f6:	68 f5 0a 00 00       	push   $0xaf5
+ 1fb:	68 a0 0f 00 00       	push   $0xfa0
+ 200:	e8 88 08 00 00       	call   a8d <benchtime>
+ 205:	83 c4 10             	add    $0x10,%esp
+}
+ 208:	90                   	nop
+ 209:	c9                   	leave
+ 20a:	c3                   	ret
+
+0000020b <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 20b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 20f:	83 e4 f0             	and    $0xfffffff0,%esp
+ 212:	ff 71 fc             	push   -0x4(%ecx)
+ 215:	55                   	push   %ebp
+ 216:	89 e5                	mov    %esp,%ebp
+ 218:	51                   	push   %ecx
+ 219:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "pingpong starting\n");
+ 21c:	83 ec 08             	sub    $0x8,%esp
+ 21f:	68 01 0b 00 00       	push   $0xb01
+ 224:	6a 01                	push   $0x1
+ 226:	e8 44 04 00 00       	call   66f <printf>
+ 22b:	83 c4 10             	add    $0x10,%esp
+  run(0);
+ 22e:	83 ec 0c             	sub    $0xc,%esp
+ 231:	6a 00                	push   $0x0
+ 233:	e8 c8 fd ff ff       	call   0 <run>
+ 238:	83 c4 10             	add    $0x10,%esp
+  run(16);
+ 23b:	83 ec 0c             	sub    $0xc,%esp
+ 23e:	6a 10                	push   $0x10
+ 240:	e8 bb fd ff ff       	call   0 <run>
+ 245:	83 c4 10             	add    $0x10,%esp
+  run(48);
+ 248:	83 ec 0c             	sub    $0xc,%esp
+ 24b:	6a 30                	push   $0x30
+ 24d:	e8 ae fd ff ff       	call   0 <run>
+ 252:	83 c4 10             	add    $0x10,%esp
+  printf(1, "pingpong done\n");
+ 255:	83 ec 08             	sub    $0x8,%esp
+ 258:	68 14 0b 00 00       	push   $0xb14
+ 25d:	6a 01                	push   $0x1
+ 25f:	e8 0b 04 00 00       	call   66f <printf>
+ 264:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 267:	e8 57 02 00 00       	call   4c3 <exit>
+
+0000026c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 26c:	55                   	push   %ebp
+ 26d:	89 e5                	mov    %esp,%ebp
+ 26f:	57                   	push   %edi
+ 270:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 271:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 274:	8b 55 10             	mov    0x10(%ebp),%edx
+ 277:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27a:	89 cb                	mov    %ecx,%ebx
+ 27c:	89 df                	mov    %ebx,%edi
+ 27e:	89 d1                	mov    %edx,%ecx
+ 280:	fc                   	cld
+ 281:	f3 aa                	rep stos %al,%es:(%edi)
+ 283:	89 ca                	mov    %ecx,%edx
+ 285:	89 fb                	mov    %edi,%ebx
+ 287:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 28a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 28d:	90                   	nop
+ 28e:	5b                   	pop    %ebx
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+
+00000292 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 292:	55                   	push   %ebp
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 298:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 29e:	90                   	nop
+ 29f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2a2:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a5:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2ae:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2b1:	0f b6 12             	movzbl (%edx),%edx
+ 2b4:	88 10                	mov    %dl,(%eax)
+ 2b6:	0f b6 00             	movzbl (%eax),%eax
+ 2b9:	84 c0                	test   %al,%al
+ 2bb:	75 e2                	jne    29f <strcpy+0xd>
+    ;
+  return os;
+ 2bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c0:	c9                   	leave
+ 2c1:	c3                   	ret
+
+000002c2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2c2:	55                   	push   %ebp
+ 2c3:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2c5:	eb 08                	jmp    2cf <strcmp+0xd>
+    p++, q++;
+ 2c7:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2cb:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	0f b6 00             	movzbl (%eax),%eax
+ 2d5:	84 c0                	test   %al,%al
+ 2d7:	74 10                	je     2e9 <strcmp+0x27>
+ 2d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2dc:	0f b6 10             	movzbl (%eax),%edx
+ 2df:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e2:	0f b6 00             	movzbl (%eax),%eax
+ 2e5:	38 c2                	cmp    %al,%dl
+ 2e7:	74 de                	je     2c7 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	0f b6 d0             	movzbl %al,%edx
+ 2f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f5:	0f b6 00             	movzbl (%eax),%eax
+ 2f8:	0f b6 c0             	movzbl %al,%eax
+ 2fb:	29 c2                	sub    %eax,%edx
+ 2fd:	89 d0                	mov    %edx,%eax
+}
+ 2ff:	5d                   	pop    %ebp
+ 300:	c3                   	ret
+
+00000301 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 301:	55                   	push   %ebp
+ 302:	89 e5                	mov    %esp,%ebp
+ 304:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 307:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 30e:	eb 04                	jmp    314 <strlen+0x13>
+ 310:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 314:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 317:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31a:	01 d0                	add    %edx,%eax
+ 31c:	0f b6 00             	movzbl (%eax),%eax
+ 31f:	84 c0                	test   %al,%al
+ 321:	75 ed                	jne    310 <strlen+0xf>
+    ;
+  return n;
+ 323:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 326:	c9                   	leave
+ 327:	c3                   	ret
+
+00000328 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 328:	55                   	push   %ebp
+ 329:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 32b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 32e:	50                   	push   %eax
+ 32f:	ff 75 0c             	push   0xc(%ebp)
+ 332:	ff 75 08             	push   0x8(%ebp)
+ 335:	e8 32 ff ff ff       	call   26c <stosb>
+ 33a:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 33d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 340:	c9                   	leave
+ 341:	c3                   	ret
+
+00000342 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 342:	55                   	push   %ebp
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	83 ec 04             	sub    $0x4,%esp
+ 348:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 34e:	eb 14                	jmp    364 <strchr+0x22>
+    if(*s == c)
+ 350:	8b 45 08             	mov    0x8(%ebp),%eax
+ 353:	0f b6 00             	movzbl (%eax),%eax
+ 356:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 359:	75 05                	jne    360 <strchr+0x1e>
+      return (char*)s;
+ 35b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35e:	eb 13                	jmp    373 <strchr+0x31>
+  for(; *s; s++)
+ 360:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	0f b6 00             	movzbl (%eax),%eax
+ 36a:	84 c0                	test   %al,%al
+ 36c:	75 e2                	jne    350 <strchr+0xe>
+  return 0;
+ 36e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+
+00000375 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 375:	55                   	push   %ebp
+ 376:	89 e5                	mov    %esp,%ebp
+ 378:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 37b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 382:	eb 42                	jmp    3c6 <gets+0x51>
+    cc = read(0, &c, 1);
+ 384:	83 ec 04             	sub    $0x4,%esp
+ 387:	6a 01                	push   $0x1
+ 389:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 38c:	50                   	push   %eax
+ 38d:	6a 00                	push   $0x0
+ 38f:	e8 47 01 00 00       	call   4db <read>
+ 394:	83 c4 10             	add    $0x10,%esp
+ 397:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 39a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 39e:	7e 33                	jle    3d3 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3a3:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3a9:	89 c2                	mov    %eax,%edx
+ 3ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ae:	01 c2                	add    %eax,%edx
+ 3b0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3b4:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3ba:	3c 0a                	cmp    $0xa,%al
+ 3bc:	74 16                	je     3d4 <gets+0x5f>
+ 3be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3c2:	3c 0d                	cmp    $0xd,%al
+ 3c4:	74 0e                	je     3d4 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c9:	83 c0 01             	add    $0x1,%eax
+ 3cc:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3cf:	7f b3                	jg     384 <gets+0xf>
+ 3d1:	eb 01                	jmp    3d4 <gets+0x5f>
+      break;
+ 3d3:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3d4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3da:	01 d0                	add    %edx,%eax
+ 3dc:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3df:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3e2:	c9                   	leave
+ 3e3:	c3                   	ret
+
+000003e4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3e4:	55                   	push   %ebp
+ 3e5:	89 e5                	mov    %esp,%ebp
+ 3e7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3ea:	83 ec 08             	sub    $0x8,%esp
+ 3ed:	6a 00                	push   $0x0
+ 3ef:	ff 75 08             	push   0x8(%ebp)
+ 3f2:	e8 0c 01 00 00       	call   503 <open>
+ 3f7:	83 c4 10             	add    $0x10,%esp
+ 3fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 401:	79 07                	jns    40a <stat+0x26>
+    return -1;
+ 403:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 408:	eb 25                	jmp    42f <stat+0x4b>
+  r = fstat(fd, st);
+ 40a:	83 ec 08             	sub    $0x8,%esp
+ 40d:	ff 75 0c             	push   0xc(%ebp)
+ 410:	ff 75 f4             	push   -0xc(%ebp)
+ 413:	e8 03 01 00 00       	call   51b <fstat>
+ 418:	83 c4 10             	add    $0x10,%esp
+ 41b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 41e:	83 ec 0c             	sub    $0xc,%esp
+ 421:	ff 75 f4             	push   -0xc(%ebp)
+ 424:	e8 c2 00 00 00       	call   4eb <close>
+ 429:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 42c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 42f:	c9                   	leave
+ 430:	c3                   	ret
+
+00000431 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 431:	55                   	push   %ebp
+ 432:	89 e5                	mov    %esp,%ebp
+ 434:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 437:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 43e:	eb 25                	jmp    465 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 440:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 443:	89 d0                	mov    %edx,%eax
+ 445:	c1 e0 02             	shl    $0x2,%eax
+ 448:	01 d0                	add    %edx,%eax
+ 44a:	01 c0                	add    %eax,%eax
+ 44c:	89 c1                	mov    %eax,%ecx
+ 44e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 451:	8d 50 01             	lea    0x1(%eax),%edx
+ 454:	89 55 08             	mov    %edx,0x8(%ebp)
+ 457:	0f b6 00             	movzbl (%eax),%eax
+ 45a:	0f be c0             	movsbl %al,%eax
+ 45d:	01 c8                	add    %ecx,%eax
+ 45f:	83 e8 30             	sub    $0x30,%eax
+ 462:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 465:	8b 45 08             	mov    0x8(%ebp),%eax
+ 468:	0f b6 00             	movzbl (%eax),%eax
+ 46b:	3c 2f                	cmp    $0x2f,%al
+ 46d:	7e 0a                	jle    479 <atoi+0x48>
+ 46f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 472:	0f b6 00             	movzbl (%eax),%eax
+ 475:	3c 39                	cmp    $0x39,%al
+ 477:	7e c7                	jle    440 <atoi+0xf>
+  return n;
+ 479:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 47c:	c9                   	leave
+ 47d:	c3                   	ret
+
+0000047e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 47e:	55                   	push   %ebp
+ 47f:	89 e5                	mov    %esp,%ebp
+ 481:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 484:	8b 45 08             	mov    0x8(%ebp),%eax
+ 487:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 48a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 490:	eb 17                	jmp    4a9 <memmove+0x2b>
+    *dst++ = *src++;
+ 492:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 495:	8d 42 01             	lea    0x1(%edx),%eax
+ 498:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 49b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 49e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4a1:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4a4:	0f b6 12             	movzbl (%edx),%edx
+ 4a7:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4a9:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4ac:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4af:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4b2:	85 c0                	test   %eax,%eax
+ 4b4:	7f dc                	jg     492 <memmove+0x14>
+  return vdst;
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4b9:	c9                   	leave
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <getschedstat>:
+SYSCALL(getschedstat)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <setshare>:
+SYSCALL(setshare)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <getdiskstat>:
+SYSCALL(getdiskstat)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <getlogstat>:
+SYSCALL(getlogstat)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 59b:	55                   	push   %ebp
+ 59c:	89 e5                	mov    %esp,%ebp
+ 59e:	83 ec 18             	sub    $0x18,%esp
+ 5a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a4:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5a7:	83 ec 04             	sub    $0x4,%esp
+ 5aa:	6a 01                	push   $0x1
+ 5ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5af:	50                   	push   %eax
+ 5b0:	ff 75 08             	push   0x8(%ebp)
+ 5b3:	e8 2b ff ff ff       	call   4e3 <write>
+ 5b8:	83 c4 10             	add    $0x10,%esp
+}
+ 5bb:	90                   	nop
+ 5bc:	c9                   	leave
+ 5bd:	c3                   	ret
+
+000005be <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5be:	55                   	push   %ebp
+ 5bf:	89 e5                	mov    %esp,%ebp
+ 5c1:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5c4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5cb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5cf:	74 17                	je     5e8 <printint+0x2a>
+ 5d1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5d5:	79 11                	jns    5e8 <printint+0x2a>
+    neg = 1;
+ 5d7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5de:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e1:	f7 d8                	neg    %eax
+ 5e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e6:	eb 06                	jmp    5ee <printint+0x30>
+  } else {
+    x = xx;
+ 5e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5f5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5fb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 600:	f7 f1                	div    %ecx
+ 602:	89 d1                	mov    %edx,%ecx
+ 604:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 607:	8d 50 01             	lea    0x1(%eax),%edx
+ 60a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 60d:	0f b6 91 34 0e 00 00 	movzbl 0xe34(%ecx),%edx
+ 614:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 618:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 61e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 623:	f7 f1                	div    %ecx
+ 625:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 628:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 62c:	75 c7                	jne    5f5 <printint+0x37>
+  if(neg)
+ 62e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 632:	74 2d                	je     661 <printint+0xa3>
+    buf[i++] = '-';
+ 634:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 637:	8d 50 01             	lea    0x1(%eax),%edx
+ 63a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 63d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 642:	eb 1d                	jmp    661 <printint+0xa3>
+    putc(fd, buf[i]);
+ 644:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 647:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 64a:	01 d0                	add    %edx,%eax
+ 64c:	0f b6 00             	movzbl (%eax),%eax
+ 64f:	0f be c0             	movsbl %al,%eax
+ 652:	83 ec 08             	sub    $0x8,%esp
+ 655:	50                   	push   %eax
+ 656:	ff 75 08             	push   0x8(%ebp)
+ 659:	e8 3d ff ff ff       	call   59b <putc>
+ 65e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 661:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 665:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 669:	79 d9                	jns    644 <printint+0x86>
+}
+ 66b:	90                   	nop
+ 66c:	90                   	nop
+ 66d:	c9                   	leave
+ 66e:	c3                   	ret
+
+0000066f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 66f:	55                   	push   %ebp
+ 670:	89 e5                	mov    %esp,%ebp
+ 672:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 675:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 67c:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 67f:	83 c0 04             	add    $0x4,%eax
+ 682:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 685:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 68c:	e9 59 01 00 00       	jmp    7ea <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 691:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 694:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 697:	01 d0                	add    %edx,%eax
+ 699:	0f b6 00             	movzbl (%eax),%eax
+ 69c:	0f be c0             	movsbl %al,%eax
+ 69f:	25 ff 00 00 00       	and    $0xff,%eax
+ 6a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ab:	75 2c                	jne    6d9 <printf+0x6a>
+      if(c == '%'){
+ 6ad:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6b1:	75 0c                	jne    6bf <printf+0x50>
+        state = '%';
+ 6b3:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6ba:	e9 27 01 00 00       	jmp    7e6 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6bf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c2:	0f be c0             	movsbl %al,%eax
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+ 6c8:	50                   	push   %eax
+ 6c9:	ff 75 08             	push   0x8(%ebp)
+ 6cc:	e8 ca fe ff ff       	call   59b <putc>
+ 6d1:	83 c4 10             	add    $0x10,%esp
+ 6d4:	e9 0d 01 00 00       	jmp    7e6 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6d9:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6dd:	0f 85 03 01 00 00    	jne    7e6 <printf+0x177>
+      if(c == 'd'){
+ 6e3:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6e7:	75 1e                	jne    707 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ec:	8b 00                	mov    (%eax),%eax
+ 6ee:	6a 01                	push   $0x1
+ 6f0:	6a 0a                	push   $0xa
+ 6f2:	50                   	push   %eax
+ 6f3:	ff 75 08             	push   0x8(%ebp)
+ 6f6:	e8 c3 fe ff ff       	call   5be <printint>
+ 6fb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6fe:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 702:	e9 d8 00 00 00       	jmp    7df <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 707:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 70b:	74 06                	je     713 <printf+0xa4>
+ 70d:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 711:	75 1e                	jne    731 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 713:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 716:	8b 00                	mov    (%eax),%eax
+ 718:	6a 00                	push   $0x0
+ 71a:	6a 10                	push   $0x10
+ 71c:	50                   	push   %eax
+ 71d:	ff 75 08             	push   0x8(%ebp)
+ 720:	e8 99 fe ff ff       	call   5be <printint>
+ 725:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 728:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72c:	e9 ae 00 00 00       	jmp    7df <printf+0x170>
+      } else if(c == 's'){
+ 731:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 735:	75 43                	jne    77a <printf+0x10b>
+        s = (char*)*ap;
+ 737:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73a:	8b 00                	mov    (%eax),%eax
+ 73c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 73f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 743:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 747:	75 25                	jne    76e <printf+0xff>
+          s = "(null)";
+ 749:	c7 45 f4 23 0b 00 00 	movl   $0xb23,-0xc(%ebp)
+        while(*s != 0){
+ 750:	eb 1c                	jmp    76e <printf+0xff>
+          putc(fd, *s);
+ 752:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 755:	0f b6 00             	movzbl (%eax),%eax
+ 758:	0f be c0             	movsbl %al,%eax
+ 75b:	83 ec 08             	sub    $0x8,%esp
+ 75e:	50                   	push   %eax
+ 75f:	ff 75 08             	push   0x8(%ebp)
+ 762:	e8 34 fe ff ff       	call   59b <putc>
+ 767:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 76a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 76e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 771:	0f b6 00             	movzbl (%eax),%eax
+ 774:	84 c0                	test   %al,%al
+ 776:	75 da                	jne    752 <printf+0xe3>
+ 778:	eb 65                	jmp    7df <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 77a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 77e:	75 1d                	jne    79d <printf+0x12e>
+        putc(fd, *ap);
+ 780:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 783:	8b 00                	mov    (%eax),%eax
+ 785:	0f be c0             	movsbl %al,%eax
+ 788:	83 ec 08             	sub    $0x8,%esp
+ 78b:	50                   	push   %eax
+ 78c:	ff 75 08             	push   0x8(%ebp)
+ 78f:	e8 07 fe ff ff       	call   59b <putc>
+ 794:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 797:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 79b:	eb 42                	jmp    7df <printf+0x170>
+      } else if(c == '%'){
+ 79d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7a1:	75 17                	jne    7ba <printf+0x14b>
+        putc(fd, c);
+ 7a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a6:	0f be c0             	movsbl %al,%eax
+ 7a9:	83 ec 08             	sub    $0x8,%esp
+ 7ac:	50                   	push   %eax
+ 7ad:	ff 75 08             	push   0x8(%ebp)
+ 7b0:	e8 e6 fd ff ff       	call   59b <putc>
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	eb 25                	jmp    7df <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7ba:	83 ec 08             	sub    $0x8,%esp
+ 7bd:	6a 25                	push   $0x25
+ 7bf:	ff 75 08             	push   0x8(%ebp)
+ 7c2:	e8 d4 fd ff ff       	call   59b <putc>
+ 7c7:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cd:	0f be c0             	movsbl %al,%eax
+ 7d0:	83 ec 08             	sub    $0x8,%esp
+ 7d3:	50                   	push   %eax
+ 7d4:	ff 75 08             	push   0x8(%ebp)
+ 7d7:	e8 bf fd ff ff       	call   59b <putc>
+ 7dc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7e6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f0:	01 d0                	add    %edx,%eax
+ 7f2:	0f b6 00             	movzbl (%eax),%eax
+ 7f5:	84 c0                	test   %al,%al
+ 7f7:	0f 85 94 fe ff ff    	jne    691 <printf+0x22>
+    }
+  }
+}
+ 7fd:	90                   	nop
+ 7fe:	90                   	nop
+ 7ff:	c9                   	leave
+ 800:	c3                   	ret
+
+00000801 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 801:	55                   	push   %ebp
+ 802:	89 e5                	mov    %esp,%ebp
+ 804:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 807:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80a:	83 e8 08             	sub    $0x8,%eax
+ 80d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 810:	a1 50 0e 00 00       	mov    0xe50,%eax
+ 815:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 818:	eb 24                	jmp    83e <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81d:	8b 00                	mov    (%eax),%eax
+ 81f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 822:	72 12                	jb     836 <free+0x35>
+ 824:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 827:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 82a:	72 24                	jb     850 <free+0x4f>
+ 82c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82f:	8b 00                	mov    (%eax),%eax
+ 831:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 834:	72 1a                	jb     850 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 836:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 839:	8b 00                	mov    (%eax),%eax
+ 83b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 83e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 841:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 844:	73 d4                	jae    81a <free+0x19>
+ 846:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 849:	8b 00                	mov    (%eax),%eax
+ 84b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 84e:	73 ca                	jae    81a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 850:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 853:	8b 40 04             	mov    0x4(%eax),%eax
+ 856:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 85d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 860:	01 c2                	add    %eax,%edx
+ 862:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 865:	8b 00                	mov    (%eax),%eax
+ 867:	39 c2                	cmp    %eax,%edx
+ 869:	75 24                	jne    88f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 86b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 86e:	8b 50 04             	mov    0x4(%eax),%edx
+ 871:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 874:	8b 00                	mov    (%eax),%eax
+ 876:	8b 40 04             	mov    0x4(%eax),%eax
+ 879:	01 c2                	add    %eax,%edx
+ 87b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 87e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 881:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 884:	8b 00                	mov    (%eax),%eax
+ 886:	8b 10                	mov    (%eax),%edx
+ 888:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88b:	89 10                	mov    %edx,(%eax)
+ 88d:	eb 0a                	jmp    899 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 88f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 892:	8b 10                	mov    (%eax),%edx
+ 894:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 897:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 899:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89c:	8b 40 04             	mov    0x4(%eax),%eax
+ 89f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8a6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a9:	01 d0                	add    %edx,%eax
+ 8ab:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8ae:	75 20                	jne    8d0 <free+0xcf>
+    p->s.size += bp->s.size;
+ 8b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b3:	8b 50 04             	mov    0x4(%eax),%edx
+ 8b6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8bc:	01 c2                	add    %eax,%edx
+ 8be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 8c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c7:	8b 10                	mov    (%eax),%edx
+ 8c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cc:	89 10                	mov    %edx,(%eax)
+ 8ce:	eb 08                	jmp    8d8 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 8d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8d6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8db:	a3 50 0e 00 00       	mov    %eax,0xe50
+}
+ 8e0:	90                   	nop
+ 8e1:	c9                   	leave
+ 8e2:	c3                   	ret
+
+000008e3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8e3:	55                   	push   %ebp
+ 8e4:	89 e5                	mov    %esp,%ebp
+ 8e6:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8e9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8f0:	77 07                	ja     8f9 <morecore+0x16>
+    nu = 4096;
+ 8f2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8fc:	c1 e0 03             	shl    $0x3,%eax
+ 8ff:	83 ec 0c             	sub    $0xc,%esp
+ 902:	50                   	push   %eax
+ 903:	e8 43 fc ff ff       	call   54b <sbrk>
+ 908:	83 c4 10             	add    $0x10,%esp
+ 90b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 90e:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 912:	75 07                	jne    91b <morecore+0x38>
+    return 0;
+ 914:	b8 00 00 00 00       	mov    $0x0,%eax
+ 919:	eb 26                	jmp    941 <morecore+0x5e>
+  hp = (Header*)p;
+ 91b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 921:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 924:	8b 55 08             	mov    0x8(%ebp),%edx
+ 927:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 92a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 92d:	83 c0 08             	add    $0x8,%eax
+ 930:	83 ec 0c             	sub    $0xc,%esp
+ 933:	50                   	push   %eax
+ 934:	e8 c8 fe ff ff       	call   801 <free>
+ 939:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 93c:	a1 50 0e 00 00       	mov    0xe50,%eax
+}
+ 941:	c9                   	leave
+ 942:	c3                   	ret
+
+00000943 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 943:	55                   	push   %ebp
+ 944:	89 e5                	mov    %esp,%ebp
+ 946:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 949:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94c:	83 c0 07             	add    $0x7,%eax
+ 94f:	c1 e8 03             	shr    $0x3,%eax
+ 952:	83 c0 01             	add    $0x1,%eax
+ 955:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 958:	a1 50 0e 00 00       	mov    0xe50,%eax
+ 95d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 960:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 964:	75 23                	jne    989 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 966:	c7 45 f0 48 0e 00 00 	movl   $0xe48,-0x10(%ebp)
+ 96d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 970:	a3 50 0e 00 00       	mov    %eax,0xe50
+ 975:	a1 50 0e 00 00       	mov    0xe50,%eax
+ 97a:	a3 48 0e 00 00       	mov    %eax,0xe48
+    base.s.size = 0;
+ 97f:	c7 05 4c 0e 00 00 00 	movl   $0x0,0xe4c
+ 986:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 989:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 98c:	8b 00                	mov    (%eax),%eax
+ 98e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 991:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 994:	8b 40 04             	mov    0x4(%eax),%eax
+ 997:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 99a:	72 4d                	jb     9e9 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 99c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99f:	8b 40 04             	mov    0x4(%eax),%eax
+ 9a2:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 9a5:	75 0c                	jne    9b3 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 9a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9aa:	8b 10                	mov    (%eax),%edx
+ 9ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9af:	89 10                	mov    %edx,(%eax)
+ 9b1:	eb 26                	jmp    9d9 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 9b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b6:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 9bc:	89 c2                	mov    %eax,%edx
+ 9be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 9c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9ca:	c1 e0 03             	shl    $0x3,%eax
+ 9cd:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 9d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9d6:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9dc:	a3 50 0e 00 00       	mov    %eax,0xe50
+      return (void*)(p + 1);
+ 9e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e4:	83 c0 08             	add    $0x8,%eax
+ 9e7:	eb 3b                	jmp    a24 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9e9:	a1 50 0e 00 00       	mov    0xe50,%eax
+ 9ee:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9f1:	75 1e                	jne    a11 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	ff 75 ec             	push   -0x14(%ebp)
+ 9f9:	e8 e5 fe ff ff       	call   8e3 <morecore>
+ 9fe:	83 c4 10             	add    $0x10,%esp
+ a01:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a04:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a08:	75 07                	jne    a11 <malloc+0xce>
+        return 0;
+ a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+ a0f:	eb 13                	jmp    a24 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a14:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1a:	8b 00                	mov    (%eax),%eax
+ a1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a1f:	e9 6d ff ff ff       	jmp    991 <malloc+0x4e>
+  }
+}
+ a24:	c9                   	leave
+ a25:	c3                   	ret
+
+00000a26 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ a26:	55                   	push   %ebp
+ a27:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ a29:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a2c:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a2f:	7e 08                	jle    a39 <ticks+0x13>
+ a31:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a34:	2b 45 08             	sub    0x8(%ebp),%eax
+ a37:	eb 05                	jmp    a3e <ticks+0x18>
+ a39:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ a3e:	5d                   	pop    %ebp
+ a3f:	c3                   	ret
+
+00000a40 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	53                   	push   %ebx
+ a44:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ a47:	8b 45 08             	mov    0x8(%ebp),%eax
+ a4a:	6b d8 64             	imul   $0x64,%eax,%ebx
+ a4d:	ff 75 14             	push   0x14(%ebp)
+ a50:	ff 75 10             	push   0x10(%ebp)
+ a53:	e8 ce ff ff ff       	call   a26 <ticks>
+ a58:	83 c4 08             	add    $0x8,%esp
+ a5b:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ a5d:	89 d8                	mov    %ebx,%eax
+ a5f:	99                   	cltd
+ a60:	f7 f9                	idiv   %ecx
+ a62:	89 c2                	mov    %eax,%edx
+ a64:	8b 45 14             	mov    0x14(%ebp),%eax
+ a67:	2b 45 10             	sub    0x10(%ebp),%eax
+ a6a:	83 ec 04             	sub    $0x4,%esp
+ a6d:	ff 75 0c             	push   0xc(%ebp)
+ a70:	52                   	push   %edx
+ a71:	50                   	push   %eax
+ a72:	ff 75 0c             	push   0xc(%ebp)
+ a75:	ff 75 08             	push   0x8(%ebp)
+ a78:	68 2c 0b 00 00       	push   $0xb2c
+ a7d:	6a 01                	push   $0x1
+ a7f:	e8 eb fb ff ff       	call   66f <printf>
+ a84:	83 c4 20             	add    $0x20,%esp
+}
+ a87:	90                   	nop
+ a88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a8b:	c9                   	leave
+ a8c:	c3                   	ret
+
+00000a8d <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ a8d:	55                   	push   %ebp
+ a8e:	89 e5                	mov    %esp,%ebp
+ a90:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ a93:	ff 75 14             	push   0x14(%ebp)
+ a96:	ff 75 10             	push   0x10(%ebp)
+ a99:	e8 88 ff ff ff       	call   a26 <ticks>
+ a9e:	83 c4 08             	add    $0x8,%esp
+ aa1:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ aa7:	99                   	cltd
+ aa8:	f7 7d 08             	idivl  0x8(%ebp)
+ aab:	89 c2                	mov    %eax,%edx
+ aad:	8b 45 14             	mov    0x14(%ebp),%eax
+ ab0:	2b 45 10             	sub    0x10(%ebp),%eax
+ ab3:	83 ec 08             	sub    $0x8,%esp
+ ab6:	52                   	push   %edx
+ ab7:	50                   	push   %eax
+ ab8:	ff 75 0c             	push   0xc(%ebp)
+ abb:	ff 75 08             	push   0x8(%ebp)
+ abe:	68 4c 0b 00 00       	push   $0xb4c
+ ac3:	6a 01                	push   $0x1
+ ac5:	e8 a5 fb ff ff       	call   66f <printf>
+ aca:	83 c4 20             	add    $0x20,%esp
+}
+ acd:	90                   	nop
+ ace:	c9                   	leave
+ acf:	c3                   	ret
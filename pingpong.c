@@ -0,0 +1,80 @@
+// Pipe ping-pong latency benchmark.
+//
+// Measures the round-trip time of a byte bounced between two
+// processes over a pair of pipes, first alone and then with
+// many idle processes asleep in the background.  Each round
+// trip is two wakeups, so a wakeup that scans every process
+// slows down as the number of sleepers grows.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NROUND 4000
+
+// Measure NROUND round trips with nidle sleepers present.
+void
+run(int nidle)
+{
+  int idle[2], p1[2], p2[2], i, n, pid, t0, t1;
+  char c;
+
+  if(pipe(idle) < 0 || pipe(p1) < 0 || pipe(p2) < 0){
+    printf(1, "pingpong: pipe failed\n");
+    exit();
+  }
+
+  // Idle processes block reading a pipe nobody writes
+  // until the measurement is done.
+  for(n = 0; n < nidle; n++){
+    if((pid = fork()) < 0)
+      break;
+    if(pid == 0){
+      close(idle[1]);
+      read(idle[0], &c, 1);
+      exit();
+    }
+  }
+
+  if((pid = fork()) == 0){
+    for(i = 0; i < NROUND; i++){
+      if(read(p1[0], &c, 1) != 1)
+        break;
+      write(p2[1], &c, 1);
+    }
+    exit();
+  }
+
+  c = 'x';
+  t0 = uptime();
+  for(i = 0; i < NROUND; i++){
+    write(p1[1], &c, 1);
+    if(read(p2[0], &c, 1) != 1)
+      break;
+  }
+  t1 = uptime();
+  wait();
+
+  close(idle[1]);
+  for(i = 0; i < n; i++)
+    wait();
+  close(idle[0]);
+  close(p1[0]);
+  close(p1[1]);
+  close(p2[0]);
+  close(p2[1]);
+
+  printf(1, "sleepers %d: ", n);
+  benchtime(NROUND, "round trips", t0, t1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "pingpong starting\n");
+  run(0);
+  run(16);
+  run(48);
+  printf(1, "pingpong done\n");
+  exit();
+}
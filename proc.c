@@ -6,12 +6,65 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "schedstat.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Per-CPU run queues.  Each CPU picks the next process to run
+// from its own queue, so scheduling decisions are O(1) and CPUs
+// do not contend on ptable.lock.  A CPU holds its rq->lock across
+// the swtch() into and out of a process, playing the role that
+// ptable.lock plays in the original xv6 scheduler: a process
+// that gives up the CPU acquires its CPU's rq->lock, changes
+// proc->state and calls sched(); the scheduler releases it.
+//
+// Each run queue has one FIFO per MLFQ priority level.  Under
+// round robin every process stays at level 0.  Under stride
+// scheduling each level is kept sorted by pass instead.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NMLFQ];  // next process to run at each level
+  struct proc *tail[NMLFQ];
+  int n;                     // number of processes on the queue
+  uint boostgen;             // last priority boost applied
+  uint pass;                 // pass of the last process dispatched
+};
+
+// Stride of a process holding one ticket.
+#define STRIDE1 (1<<16)
+
+// Sleeping processes, hashed by wait channel.  sleep() links
+// a process into the bucket for its chan and wakeup() looks
+// only at that bucket, instead of every ptable entry.  The
+// bucket lock plays the role ptable.lock used to play for
+// sleep and wakeup: it is held while a sleeper goes from
+// checking its condition to SLEEPING, and while waking.
+#define NSLEEPQ 61  // prime, to spread aligned channel addresses
+
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;     // processes sleeping on this bucket
+};
+
+static struct sleepq sleepq[NSLEEPQ];
+
+#define sleephash(chan) (&sleepq[((uint)(chan) >> 2) % NSLEEPQ])
+
+static struct runq runq[NCPU];
+
+int schedpolicy = SCHEDPOLICY;
+
+// Incremented by each MLFQ priority boost.  Processes and run
+// queues compare it with their own boostgen and move back to
+// level 0 lazily, so a boost costs O(1) at tick time.
+static uint boostgen;
+
+// Run queue of the current CPU.  Interrupts must be off.
+#define myrq() (&runq[cpu - cpus])
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -21,12 +74,179 @@ int sched_trace_enabled = 0; // ZYF: for CS550 CPU/process project
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+  struct runq *rq;
+  struct sleepq *sq;
+
   initlock(&ptable.lock, "ptable");
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+    initlock(&rq->lock, "runq");
+  for(sq = sleepq; sq < &sleepq[NSLEEPQ]; sq++)
+    initlock(&sq->lock, "sleepq");
+}
+
+// Move p back to level 0 if a priority boost
+// happened since it last changed level.
+static void
+boostproc(struct proc *p)
+{
+  if(p->boostgen != boostgen){
+    p->boostgen = boostgen;
+    p->level = 0;
+    p->qticks = 0;
+  }
+}
+
+// Apply a pending priority boost to rq by moving every
+// queued process to the tail of level 0.
+static void
+boostrunq(struct runq *rq)
+{
+  struct proc *p;
+  int l;
+
+  rq->boostgen = boostgen;
+  for(l = 1; l < NMLFQ; l++){
+    if(rq->head[l] == 0)
+      continue;
+    for(p = rq->head[l]; p; p = p->rqnext)
+      boostproc(p);
+    if(rq->tail[0])
+      rq->tail[0]->rqnext = rq->head[l];
+    else
+      rq->head[0] = rq->head[l];
+    rq->tail[0] = rq->tail[l];
+    rq->head[l] = rq->tail[l] = 0;
+  }
+}
+
+// Append p to the tail of its level's queue on rq, or under
+// stride scheduling insert it in pass order.
+// Caller must hold rq->lock.
+static void
+runqput(struct runq *rq, struct proc *p)
+{
+  struct proc **pp;
+
+  if(!holding(&rq->lock))
+    panic("runqput");
+  boostproc(p);
+  p->rq = rq;
+  if(schedpolicy == SCHED_STRIDE){
+    // A process returning from sleep must not be able to
+    // claim the CPU time it did not use while asleep.
+    if((int)(p->pass - rq->pass) < 0)
+      p->pass = rq->pass;
+    pp = &rq->head[p->level];
+    while(*pp && (int)((*pp)->pass - p->pass) <= 0)
+      pp = &(*pp)->rqnext;
+    p->rqnext = *pp;
+    *pp = p;
+    if(p->rqnext == 0)
+      rq->tail[p->level] = p;
+  } else {
+    p->rqnext = 0;
+    if(rq->tail[p->level])
+      rq->tail[p->level]->rqnext = p;
+    else
+      rq->head[p->level] = p;
+    rq->tail[p->level] = p;
+  }
+  rq->n++;
+}
+
+// Remove and return the first process at the highest
+// non-empty level of rq, or 0 if rq is empty.
+// Caller must hold rq->lock.
+static struct proc*
+runqget(struct runq *rq)
+{
+  struct proc *p;
+  int l;
+
+  if(rq->boostgen != boostgen)
+    boostrunq(rq);
+  for(l = 0; l < NMLFQ; l++){
+    if((p = rq->head[l]) == 0)
+      continue;
+    rq->head[l] = p->rqnext;
+    if(rq->head[l] == 0)
+      rq->tail[l] = 0;
+    p->rqnext = 0;
+    rq->n--;
+    rq->pass = p->pass;
+    return p;
+  }
+  return 0;
+}
+
+// Mark p RUNNABLE and queue it on rq.
+static void
+makerunnable(struct runq *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  p->state = RUNNABLE;
+  runqput(rq, p);
+  release(&rq->lock);
+}
+
+// Pick the run queue for a process that has never run:
+// the CPU with the fewest queued plus running processes,
+// preferring CPUs other than the current one on ties.
+static struct runq*
+leastloaded(void)
+{
+  int i, c, load, best, bestload;
+
+  pushcli();
+  c = cpu - cpus;
+  best = c;
+  bestload = runq[c].n + 1;  // this CPU is running the caller
+  for(i = 1; i < ncpu; i++){
+    c = (cpu - cpus + i) % ncpu;
+    load = runq[c].n + (cpus[c].proc != 0);
+    if(load < bestload){
+      best = c;
+      bestload = load;
+    }
+  }
+  popcli();
+  return &runq[best];
+}
+
+// Take a process from the busiest other CPU's run queue
+// for the idle CPU whose queue is rq.  The queue lengths are
+// read without locks to pick a victim; only the victim's lock
+// is taken, and only once, so an idle CPU never holds two run
+// queue locks and gives up after a single failed attempt.
+static struct proc*
+steal(struct runq *rq)
+{
+  struct runq *v, *victim;
+  struct proc *p;
+  int n;
+
+  victim = 0;
+  n = 0;
+  for(v = runq; v < &runq[ncpu]; v++){
+    if(v != rq && v->n > n){
+      victim = v;
+      n = v->n;
+    }
+  }
+  if(victim == 0)
+    return 0;
+
+  acquire(&victim->lock);
+  p = runqget(victim);
+  release(&victim->lock);
+  if(p)
+    cpu->nsteal++;
+  else
+    cpu->nstealfail++;
+  return p;
 }
 
 //PAGEBREAK: 32
@@ -50,6 +270,12 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->level = 0;
+  p->qticks = 0;
+  p->boostgen = boostgen;
+  p->tickets = NTICKETS;
+  p->stride = STRIDE1 / NTICKETS;
+  p->pass = 0;
   release(&ptable.lock);
 
   // Allocate kernel stack.
@@ -102,10 +328,30 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  p->state = RUNNABLE;
+  makerunnable(myrq(), p);
+}
+
+// Start a kernel process named name that runs fn(), which must
+// never return.  It has no user memory and no parent.
+struct proc*
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+  p->sz = 0;
+  // forkret() "returns" to fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  makerunnable(leastloaded(), p);
+  return p;
 }
 
 // Grow current process's memory by n bytes.
+// Growing only moves proc->sz: the new pages are
+// allocated and zeroed on first touch (see pagefault()).
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
@@ -114,11 +360,13 @@ growproc(int n)
   
   sz = proc->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if(sz + n >= KERNBASE || sz + n < sz)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
+    segtrunc(proc->seg, sz);
   }
   proc->sz = sz;
   switchuvm(proc);
@@ -147,6 +395,9 @@ fork(void)
   }
   np->sz = proc->sz;
   np->parent = proc;
+  np->tickets = proc->tickets;
+  np->stride = proc->stride;
+  np->pass = proc->pass;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -156,15 +407,15 @@ fork(void)
     if(proc->ofile[i])
       np->ofile[i] = filedup(proc->ofile[i]);
   np->cwd = idup(proc->cwd);
+  segdup(np->seg, proc->seg);
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
  
   pid = np->pid;
 
-  // lock to force the compiler to emit the np->state write last.
-  acquire(&ptable.lock);
-  np->state = RUNNABLE;
-  release(&ptable.lock);
+  // The run queue lock forces the compiler to emit the
+  // np->state write last.
+  makerunnable(leastloaded(), np);
   
   return pid;
 }
@@ -191,25 +442,31 @@ exit(void)
 
   begin_op();
   iput(proc->cwd);
+  segput(proc->seg);
   end_op();
   proc->cwd = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  wakeup(proc->parent);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == proc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
   // Jump into the scheduler, never to return.
+  // wait() may free our kernel stack as soon as it sees ZOMBIE,
+  // so it synchronizes on our run queue lock, which is held
+  // until the scheduler has switched off this stack.
+  acquire(&myrq()->lock);
   proc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -231,7 +488,9 @@ wait(void)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Wait for its CPU to switch off its stack.
+        acquire(&p->rq->lock);
+        release(&p->rq->lock);
         pid = p->pid;
         kfree(p->kstack);
         p->kstack = 0;
@@ -252,7 +511,7 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
     sleep(proc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -269,27 +528,31 @@ void
 scheduler(void)
 {
   struct proc *p;
-  int ran = 0; // CS550: to solve the 100%-CPU-utilization-when-idling problem
+  struct runq *rq;
 
+  rq = myrq();
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    ran = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      ran = 1;
-      
+    // Take the next process off this CPU's run queue,
+    // or steal one from a busier CPU if it is empty.
+    acquire(&rq->lock);
+    if((p = runqget(rq)) == 0){
+      release(&rq->lock);
+      p = steal(rq);
+      acquire(&rq->lock);
+      if(p)
+        p->rq = rq;
+    }
+    if(p){
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
+      // to release rq->lock and then reacquire it
       // before jumping back to us.
       proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      cpu->nswitch++;
       swtch(&cpu->scheduler, proc->context);
       switchkvm();
 
@@ -297,23 +560,23 @@ scheduler(void)
       // It should have changed its p->state before coming back.
       proc = 0;
     }
-    release(&ptable.lock);
+    release(&rq->lock);
 
-    if (ran == 0){
-        halt();
-    }
+    // CS550: to solve the 100%-CPU-utilization-when-idling problem
+    if(p == 0)
+      halt();
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
-// and have changed proc->state.
+// Enter scheduler.  Must hold only this CPU's run queue
+// lock and have changed proc->state.
 void
 sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&myrq()->lock))
+    panic("sched runq lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -334,10 +597,75 @@ yield(void)
     cprintf("[%d]", proc->pid);
   }
 
-  acquire(&ptable.lock);  //DOC: yieldlock
+  acquire(&myrq()->lock);  //DOC: yieldlock
   proc->state = RUNNABLE;
+  runqput(myrq(), proc);
   sched();
-  release(&ptable.lock);
+  release(&myrq()->lock);
+}
+
+// Charge the current process for one timer tick.
+// Returns 1 if it should yield the CPU: always under round
+// robin and stride scheduling, which advances its pass by its
+// stride; under MLFQ when it has used its quantum at this level
+// (and is demoted) or a higher-priority process is waiting.
+int
+timeslice(void)
+{
+  struct runq *rq;
+  int l;
+
+  if(schedpolicy == SCHED_STRIDE)
+    proc->pass += proc->stride;
+  if(schedpolicy != SCHED_MLFQ)
+    return 1;
+
+  boostproc(proc);
+  if(++proc->qticks >= (1 << proc->level)){
+    proc->qticks = 0;
+    if(proc->level < NMLFQ-1){
+      if(sched_trace_enabled)
+        cprintf("[%d:L%d->L%d]", proc->pid, proc->level, proc->level+1);
+      proc->level++;
+    }
+    return 1;
+  }
+
+  // Unlocked peek: a stale answer only delays preemption a tick.
+  pushcli();
+  rq = myrq();
+  for(l = 0; l < proc->level; l++)
+    if(rq->head[l]){
+      popcli();
+      return 1;
+    }
+  popcli();
+  return 0;
+}
+
+// Move every process back to the highest priority level.
+// Called periodically under MLFQ so that processes
+// demoted for using the CPU are not starved.
+void
+priboost(void)
+{
+  boostgen++;
+  if(sched_trace_enabled && schedpolicy == SCHED_MLFQ)
+    cprintf("[boost]");
+}
+
+// Switch scheduling policy; returns the old one.
+int
+setschedpolicy(int policy)
+{
+  int old;
+
+  if(policy != SCHED_RR && policy != SCHED_MLFQ && policy != SCHED_STRIDE)
+    return -1;
+  old = schedpolicy;
+  schedpolicy = policy;
+  priboost();
+  return old;
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -346,8 +674,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding run queue lock from scheduler.
+  release(&myrq()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -356,6 +684,7 @@ forkret(void)
     first = 0;
     iinit(ROOTDEV);
     initlog(ROOTDEV);
+    bfreeinit(ROOTDEV);
   }
   
   // Return to "caller", actually trapret (see allocproc).
@@ -366,58 +695,73 @@ forkret(void)
 void
 sleep(void *chan, struct spinlock *lk)
 {
+  struct sleepq *sq;
+
   if(proc == 0)
     panic("sleep");
 
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // Must acquire the bucket lock for chan in order to
+  // change p->state to SLEEPING.
+  // Once we hold it, we can be guaranteed that we won't
+  // miss any wakeup (wakeup runs with it locked),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  sq = sleephash(chan);
+  acquire(&sq->lock);  //DOC: sleeplock1
+  release(lk);
 
-  // Go to sleep.
+  // Go to sleep.  Take the run queue lock before dropping
+  // the bucket lock so that a wakeup cannot queue us (and
+  // another CPU run us) until sched() has switched off our stack.
   proc->chan = chan;
   proc->state = SLEEPING;
+  proc->sqnext = sq->head;
+  sq->head = proc;
+  acquire(&myrq()->lock);
+  release(&sq->lock);
   sched();
 
   // Tidy up.
   proc->chan = 0;
+  release(&myrq()->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Unlink p from sleep bucket sq and make it runnable.
+// Caller must hold sq->lock.
 static void
-wakeup1(void *chan)
+sqwake(struct sleepq *sq, struct proc *p)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct proc **pp;
+
+  for(pp = &sq->head; *pp != p; pp = &(*pp)->sqnext)
+    if(*pp == 0)
+      panic("sqwake");
+  *pp = p->sqnext;
+  p->sqnext = 0;
+  makerunnable(p->rq, p);
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct sleepq *sq;
+  struct proc *p, *next;
+
+  sq = sleephash(chan);
+  acquire(&sq->lock);
+  for(p = sq->head; p; p = next){
+    next = p->sqnext;
+    if(p->chan == chan)
+      sqwake(sq, p);
+  }
+  release(&sq->lock);
 }
 
 // Kill the process with the given pid.
@@ -427,14 +771,49 @@ int
 kill(int pid)
 {
   struct proc *p;
+  struct sleepq *sq;
+  void *chan;
 
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
       p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      // Wake process from sleep if necessary.  p may wake
+      // and sleep elsewhere before we lock its bucket, so
+      // check again under the lock.
+      while(p->state == SLEEPING){
+        chan = p->chan;
+        sq = sleephash(chan);
+        acquire(&sq->lock);
+        if(p->state == SLEEPING && p->chan == chan){
+          sqwake(sq, p);
+          release(&sq->lock);
+          break;
+        }
+        release(&sq->lock);
+      }
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Give the process with the given pid a stride scheduling
+// share of tickets.
+int
+setshare(int pid, int tickets)
+{
+  struct proc *p;
+
+  if(tickets < 1 || tickets > MAXTICKETS)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      p->tickets = tickets;
+      p->stride = STRIDE1 / tickets;
       release(&ptable.lock);
       return 0;
     }
@@ -443,6 +822,20 @@ kill(int pid)
   return -1;
 }
 
+// Copy the scheduler statistics of the n'th CPU into st.
+int
+getschedstat(int n, struct schedstat *st)
+{
+  if(n < 0 || n >= ncpu)
+    return -1;
+  st->nswitch = cpus[n].nswitch;
+  st->nsteal = cpus[n].nsteal;
+  st->nstealfail = cpus[n].nstealfail;
+  st->idleticks = cpus[n].idleticks;
+  st->nrunnable = runq[n].n;
+  return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -471,6 +864,8 @@ procdump(void)
     else
       state = "???";
     cprintf("%d %s %s", p->pid, state, p->name);
+    if(p->pgdir && p->state != ZOMBIE)
+      cprintf(" sz %dK rss %dK", p->sz/1024, uvmrss(p->pgdir, p->sz)/1024);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
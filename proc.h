@@ -10,6 +10,10 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  uint nswitch;                // Scheduler statistics; see schedstat.h
+  uint nsteal;
+  uint nstealfail;
+  uint idleticks;
   
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -51,6 +55,16 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A loadable ELF segment that exec() mapped without reading
+// it: pages in [va, end) are read from ip on first touch.
+struct vmseg {
+  struct inode *ip;            // Executable, or 0 if slot unused
+  uint va;                     // Page-aligned start address
+  uint end;                    // va + memsz
+  uint off;                    // File offset of va
+  uint filesz;                 // Bytes backed by the file; rest is zero
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -62,10 +76,23 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *sqnext;         // Next process in sleep bucket
+  uint wakeat;                 // Tick at which sys_sleep ends
+  struct proc *tnext;          // Next process in timer wheel slot
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  int logres;                  // Log blocks reserved by begin_op()
+  struct vmseg seg[NSEG];      // Not yet loaded parts of the executable
   char name[16];               // Process name (debugging)
+  struct runq *rq;             // Run queue of the CPU it last ran on
+  struct proc *rqnext;         // Next process on run queue
+  int level;                   // MLFQ priority level, 0 is highest
+  int qticks;                  // Ticks used at the current level
+  uint boostgen;               // Priority boost this level dates from
+  int tickets;                 // Stride scheduling share
+  uint stride;                 // STRIDE1 / tickets
+  uint pass;                   // Virtual time; lowest pass runs next
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,1363 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <pass>:
+
+char buf[512];
+
+void
+pass(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 58             	sub    $0x58,%esp
+  int fd, n, tot, t0, t1;
+  struct bcachestat st0, st1;
+
+  if((fd = open(path, O_RDONLY)) < 0){
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	6a 00                	push   $0x0
+   b:	ff 75 08             	push   0x8(%ebp)
+   e:	e8 d2 03 00 00       	call   3e5 <open>
+  13:	83 c4 10             	add    $0x10,%esp
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  19:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  1d:	79 1a                	jns    39 <pass+0x39>
+    printf(1, "readbench: cannot open %s\n", path);
+  1f:	83 ec 04             	sub    $0x4,%esp
+  22:	ff 75 08             	push   0x8(%ebp)
+  25:	68 b4 09 00 00       	push   $0x9b4
+  2a:	6a 01                	push   $0x1
+  2c:	e8 20 05 00 00       	call   551 <printf>
+  31:	83 c4 10             	add    $0x10,%esp
+    exit();
+  34:	e8 6c 03 00 00       	call   3a5 <exit>
+  }
+  getbcachestat(&st0);
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  3f:	50                   	push   %eax
+  40:	e8 20 04 00 00       	call   465 <getbcachestat>
+  45:	83 c4 10             	add    $0x10,%esp
+  tot = 0;
+  48:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  t0 = uptime();
+  4f:	e8 e9 03 00 00       	call   43d <uptime>
+  54:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  57:	eb 06                	jmp    5f <pass+0x5f>
+    tot += n;
+  59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  5c:	01 45 f4             	add    %eax,-0xc(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	68 00 02 00 00       	push   $0x200
+  67:	68 40 0d 00 00       	push   $0xd40
+  6c:	ff 75 f0             	push   -0x10(%ebp)
+  6f:	e8 49 03 00 00       	call   3bd <read>
+  74:	83 c4 10             	add    $0x10,%esp
+  77:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  7a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  7e:	7f d9                	jg     59 <pass+0x59>
+  t1 = uptime();
+  80:	e8 b8 03 00 00       	call   43d <uptime>
+  85:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  getbcachestat(&st1);
+  88:	83 ec 0c             	sub    $0xc,%esp
+  8b:	8d 45 ac             	lea    -0x54(%ebp),%eax
+  8e:	50                   	push   %eax
+  8f:	e8 d1 03 00 00       	call   465 <getbcachestat>
+  94:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+  97:	83 ec 0c             	sub    $0xc,%esp
+  9a:	ff 75 f0             	push   -0x10(%ebp)
+  9d:	e8 2b 03 00 00       	call   3cd <close>
+  a2:	83 c4 10             	add    $0x10,%esp
+
+  benchrate(tot / 1024, "KB", t0, t1);
+  a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  a8:	8d 90 ff 03 00 00    	lea    0x3ff(%eax),%edx
+  ae:	85 c0                	test   %eax,%eax
+  b0:	0f 48 c2             	cmovs  %edx,%eax
+  b3:	c1 f8 0a             	sar    $0xa,%eax
+  b6:	ff 75 e4             	push   -0x1c(%ebp)
+  b9:	ff 75 ec             	push   -0x14(%ebp)
+  bc:	68 cf 09 00 00       	push   $0x9cf
+  c1:	50                   	push   %eax
+  c2:	e8 5b 08 00 00       	call   922 <benchrate>
+  c7:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d misses, %d read ahead\n",
+         st1.nmiss - st0.nmiss, st1.nahead - st0.nahead);
+  ca:	8b 55 bc             	mov    -0x44(%ebp),%edx
+  cd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  printf(1, "%d misses, %d read ahead\n",
+  d0:	89 d1                	mov    %edx,%ecx
+  d2:	29 c1                	sub    %eax,%ecx
+         st1.nmiss - st0.nmiss, st1.nahead - st0.nahead);
+  d4:	8b 55 b0             	mov    -0x50(%ebp),%edx
+  d7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  printf(1, "%d misses, %d read ahead\n",
+  da:	29 c2                	sub    %eax,%edx
+  dc:	51                   	push   %ecx
+  dd:	52                   	push   %edx
+  de:	68 d2 09 00 00       	push   $0x9d2
+  e3:	6a 01                	push   $0x1
+  e5:	e8 67 04 00 00       	call   551 <printf>
+  ea:	83 c4 10             	add    $0x10,%esp
+}
+  ed:	90                   	nop
+  ee:	c9                   	leave
+  ef:	c3                   	ret
+
+000000f0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  f0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f4:	83 e4 f0             	and    $0xfffffff0,%esp
+  f7:	ff 71 fc             	push   -0x4(%ecx)
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	51                   	push   %ecx
+  fe:	83 ec 14             	sub    $0x14,%esp
+ 101:	89 c8                	mov    %ecx,%eax
+  char *path;
+
+  path = argc > 1 ? argv[1] : "usertests";
+ 103:	83 38 01             	cmpl   $0x1,(%eax)
+ 106:	7e 08                	jle    110 <main+0x20>
+ 108:	8b 40 04             	mov    0x4(%eax),%eax
+ 10b:	8b 40 04             	mov    0x4(%eax),%eax
+ 10e:	eb 05                	jmp    115 <main+0x25>
+ 110:	b8 ec 09 00 00       	mov    $0x9ec,%eax
+ 115:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  printf(1, "readbench %s\n", path);
+ 118:	83 ec 04             	sub    $0x4,%esp
+ 11b:	ff 75 f4             	push   -0xc(%ebp)
+ 11e:	68 f6 09 00 00       	push   $0x9f6
+ 123:	6a 01                	push   $0x1
+ 125:	e8 27 04 00 00       	call   551 <printf>
+ 12a:	83 c4 10             	add    $0x10,%esp
+  pass(path);
+ 12d:	83 ec 0c             	sub    $0xc,%esp
+ 130:	ff 75 f4             	push   -0xc(%ebp)
+ 133:	e8 c8 fe ff ff       	call   0 <pass>
+ 138:	83 c4 10             	add    $0x10,%esp
+  pass(path);
+ 13b:	83 ec 0c             	sub    $0xc,%esp
+ 13e:	ff 75 f4             	push   -0xc(%ebp)
+ 141:	e8 ba fe ff ff       	call   0 <pass>
+ 146:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 149:	e8 57 02 00 00       	call   3a5 <exit>
+
+0000014e <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 14e:	55                   	push   %ebp
+ 14f:	89 e5                	mov    %esp,%ebp
+ 151:	57                   	push   %edi
+ 152:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 153:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 156:	8b 55 10             	mov    0x10(%ebp),%edx
+ 159:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15c:	89 cb                	mov    %ecx,%ebx
+ 15e:	89 df                	mov    %ebx,%edi
+ 160:	89 d1                	mov    %edx,%ecx
+ 162:	fc                   	cld
+ 163:	f3 aa                	rep stos %al,%es:(%edi)
+ 165:	89 ca                	mov    %ecx,%edx
+ 167:	89 fb                	mov    %edi,%ebx
+ 169:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 16c:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 16f:	90                   	nop
+ 170:	5b                   	pop    %ebx
+ 171:	5f                   	pop    %edi
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+
+00000174 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 17a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 180:	90                   	nop
+ 181:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 184:	8d 42 01             	lea    0x1(%edx),%eax
+ 187:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 190:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 193:	0f b6 12             	movzbl (%edx),%edx
+ 196:	88 10                	mov    %dl,(%eax)
+ 198:	0f b6 00             	movzbl (%eax),%eax
+ 19b:	84 c0                	test   %al,%al
+ 19d:	75 e2                	jne    181 <strcpy+0xd>
+    ;
+  return os;
+ 19f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1a7:	eb 08                	jmp    1b1 <strcmp+0xd>
+    p++, q++;
+ 1a9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1ad:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	0f b6 00             	movzbl (%eax),%eax
+ 1b7:	84 c0                	test   %al,%al
+ 1b9:	74 10                	je     1cb <strcmp+0x27>
+ 1bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1be:	0f b6 10             	movzbl (%eax),%edx
+ 1c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c4:	0f b6 00             	movzbl (%eax),%eax
+ 1c7:	38 c2                	cmp    %al,%dl
+ 1c9:	74 de                	je     1a9 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ce:	0f b6 00             	movzbl (%eax),%eax
+ 1d1:	0f b6 d0             	movzbl %al,%edx
+ 1d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d7:	0f b6 00             	movzbl (%eax),%eax
+ 1da:	0f b6 c0             	movzbl %al,%eax
+ 1dd:	29 c2                	sub    %eax,%edx
+ 1df:	89 d0                	mov    %edx,%eax
+}
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f0:	eb 04                	jmp    1f6 <strlen+0x13>
+ 1f2:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1f6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	01 d0                	add    %edx,%eax
+ 1fe:	0f b6 00             	movzbl (%eax),%eax
+ 201:	84 c0                	test   %al,%al
+ 203:	75 ed                	jne    1f2 <strlen+0xf>
+    ;
+  return n;
+ 205:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 20d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 210:	50                   	push   %eax
+ 211:	ff 75 0c             	push   0xc(%ebp)
+ 214:	ff 75 08             	push   0x8(%ebp)
+ 217:	e8 32 ff ff ff       	call   14e <stosb>
+ 21c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 21f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 222:	c9                   	leave
+ 223:	c3                   	ret
+
+00000224 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 224:	55                   	push   %ebp
+ 225:	89 e5                	mov    %esp,%ebp
+ 227:	83 ec 04             	sub    $0x4,%esp
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 230:	eb 14                	jmp    246 <strchr+0x22>
+    if(*s == c)
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+ 235:	0f b6 00             	movzbl (%eax),%eax
+ 238:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23b:	75 05                	jne    242 <strchr+0x1e>
+      return (char*)s;
+ 23d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 240:	eb 13                	jmp    255 <strchr+0x31>
+  for(; *s; s++)
+ 242:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 246:	8b 45 08             	mov    0x8(%ebp),%eax
+ 249:	0f b6 00             	movzbl (%eax),%eax
+ 24c:	84 c0                	test   %al,%al
+ 24e:	75 e2                	jne    232 <strchr+0xe>
+  return 0;
+ 250:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 255:	c9                   	leave
+ 256:	c3                   	ret
+
+00000257 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 257:	55                   	push   %ebp
+ 258:	89 e5                	mov    %esp,%ebp
+ 25a:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 25d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 264:	eb 42                	jmp    2a8 <gets+0x51>
+    cc = read(0, &c, 1);
+ 266:	83 ec 04             	sub    $0x4,%esp
+ 269:	6a 01                	push   $0x1
+ 26b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 26e:	50                   	push   %eax
+ 26f:	6a 00                	push   $0x0
+ 271:	e8 47 01 00 00       	call   3bd <read>
+ 276:	83 c4 10             	add    $0x10,%esp
+ 279:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 27c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 280:	7e 33                	jle    2b5 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 282:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 285:	8d 50 01             	lea    0x1(%eax),%edx
+ 288:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28b:	89 c2                	mov    %eax,%edx
+ 28d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 290:	01 c2                	add    %eax,%edx
+ 292:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 296:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 298:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29c:	3c 0a                	cmp    $0xa,%al
+ 29e:	74 16                	je     2b6 <gets+0x5f>
+ 2a0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a4:	3c 0d                	cmp    $0xd,%al
+ 2a6:	74 0e                	je     2b6 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ab:	83 c0 01             	add    $0x1,%eax
+ 2ae:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b1:	7f b3                	jg     266 <gets+0xf>
+ 2b3:	eb 01                	jmp    2b6 <gets+0x5f>
+      break;
+ 2b5:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bc:	01 d0                	add    %edx,%eax
+ 2be:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2cc:	83 ec 08             	sub    $0x8,%esp
+ 2cf:	6a 00                	push   $0x0
+ 2d1:	ff 75 08             	push   0x8(%ebp)
+ 2d4:	e8 0c 01 00 00       	call   3e5 <open>
+ 2d9:	83 c4 10             	add    $0x10,%esp
+ 2dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e3:	79 07                	jns    2ec <stat+0x26>
+    return -1;
+ 2e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ea:	eb 25                	jmp    311 <stat+0x4b>
+  r = fstat(fd, st);
+ 2ec:	83 ec 08             	sub    $0x8,%esp
+ 2ef:	ff 75 0c             	push   0xc(%ebp)
+ 2f2:	ff 75 f4             	push   -0xc(%ebp)
+ 2f5:	e8 03 01 00 00       	call   3fd <fstat>
+ 2fa:	83 c4 10             	add    $0x10,%esp
+ 2fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 300:	83 ec 0c             	sub    $0xc,%esp
+ 303:	ff 75 f4             	push   -0xc(%ebp)
+ 306:	e8 c2 00 00 00       	call   3cd <close>
+ 30b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 30e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 319:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 320:	eb 25                	jmp    347 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 322:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c1 e0 02             	shl    $0x2,%eax
+ 32a:	01 d0                	add    %edx,%eax
+ 32c:	01 c0                	add    %eax,%eax
+ 32e:	89 c1                	mov    %eax,%ecx
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+ 333:	8d 50 01             	lea    0x1(%eax),%edx
+ 336:	89 55 08             	mov    %edx,0x8(%ebp)
+ 339:	0f b6 00             	movzbl (%eax),%eax
+ 33c:	0f be c0             	movsbl %al,%eax
+ 33f:	01 c8                	add    %ecx,%eax
+ 341:	83 e8 30             	sub    $0x30,%eax
+ 344:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 347:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34a:	0f b6 00             	movzbl (%eax),%eax
+ 34d:	3c 2f                	cmp    $0x2f,%al
+ 34f:	7e 0a                	jle    35b <atoi+0x48>
+ 351:	8b 45 08             	mov    0x8(%ebp),%eax
+ 354:	0f b6 00             	movzbl (%eax),%eax
+ 357:	3c 39                	cmp    $0x39,%al
+ 359:	7e c7                	jle    322 <atoi+0xf>
+  return n;
+ 35b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35e:	c9                   	leave
+ 35f:	c3                   	ret
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 366:	8b 45 08             	mov    0x8(%ebp),%eax
+ 369:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 36c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 372:	eb 17                	jmp    38b <memmove+0x2b>
+    *dst++ = *src++;
+ 374:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 377:	8d 42 01             	lea    0x1(%edx),%eax
+ 37a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 37d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 380:	8d 48 01             	lea    0x1(%eax),%ecx
+ 383:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 386:	0f b6 12             	movzbl (%edx),%edx
+ 389:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38b:	8b 45 10             	mov    0x10(%ebp),%eax
+ 38e:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 391:	89 55 10             	mov    %edx,0x10(%ebp)
+ 394:	85 c0                	test   %eax,%eax
+ 396:	7f dc                	jg     374 <memmove+0x14>
+  return vdst;
+ 398:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39b:	c9                   	leave
+ 39c:	c3                   	ret
+
+0000039d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <exit>:
+SYSCALL(exit)
+ 3a5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <wait>:
+SYSCALL(wait)
+ 3ad:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <pipe>:
+SYSCALL(pipe)
+ 3b5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <read>:
+SYSCALL(read)
+ 3bd:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <write>:
+SYSCALL(write)
+ 3c5:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <close>:
+SYSCALL(close)
+ 3cd:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <kill>:
+SYSCALL(kill)
+ 3d5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <exec>:
+SYSCALL(exec)
+ 3dd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <open>:
+SYSCALL(open)
+ 3e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <mknod>:
+SYSCALL(mknod)
+ 3ed:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <unlink>:
+SYSCALL(unlink)
+ 3f5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <fstat>:
+SYSCALL(fstat)
+ 3fd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <link>:
+SYSCALL(link)
+ 405:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <mkdir>:
+SYSCALL(mkdir)
+ 40d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <chdir>:
+SYSCALL(chdir)
+ 415:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <dup>:
+SYSCALL(dup)
+ 41d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <getpid>:
+SYSCALL(getpid)
+ 425:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <sbrk>:
+SYSCALL(sbrk)
+ 42d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <sleep>:
+SYSCALL(sleep)
+ 435:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <uptime>:
+SYSCALL(uptime)
+ 43d:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 445:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <getschedstat>:
+SYSCALL(getschedstat)
+ 44d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 455:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <setshare>:
+SYSCALL(setshare)
+ 45d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 465:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <getdiskstat>:
+SYSCALL(getdiskstat)
+ 46d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <getlogstat>:
+SYSCALL(getlogstat)
+ 475:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 47d:	55                   	push   %ebp
+ 47e:	89 e5                	mov    %esp,%ebp
+ 480:	83 ec 18             	sub    $0x18,%esp
+ 483:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 486:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 489:	83 ec 04             	sub    $0x4,%esp
+ 48c:	6a 01                	push   $0x1
+ 48e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 491:	50                   	push   %eax
+ 492:	ff 75 08             	push   0x8(%ebp)
+ 495:	e8 2b ff ff ff       	call   3c5 <write>
+ 49a:	83 c4 10             	add    $0x10,%esp
+}
+ 49d:	90                   	nop
+ 49e:	c9                   	leave
+ 49f:	c3                   	ret
+
+000004a0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4a6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4ad:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4b1:	74 17                	je     4ca <printint+0x2a>
+ 4b3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4b7:	79 11                	jns    4ca <printint+0x2a>
+    neg = 1;
+ 4b9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c3:	f7 d8                	neg    %eax
+ 4c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4c8:	eb 06                	jmp    4d0 <printint+0x30>
+  } else {
+    x = xx;
+ 4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4cd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4dd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4e2:	f7 f1                	div    %ecx
+ 4e4:	89 d1                	mov    %edx,%ecx
+ 4e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e9:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ec:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4ef:	0f b6 91 14 0d 00 00 	movzbl 0xd14(%ecx),%edx
+ 4f6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4fa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4fd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 500:	ba 00 00 00 00       	mov    $0x0,%edx
+ 505:	f7 f1                	div    %ecx
+ 507:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 50a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 50e:	75 c7                	jne    4d7 <printint+0x37>
+  if(neg)
+ 510:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 514:	74 2d                	je     543 <printint+0xa3>
+    buf[i++] = '-';
+ 516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 519:	8d 50 01             	lea    0x1(%eax),%edx
+ 51c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 51f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 524:	eb 1d                	jmp    543 <printint+0xa3>
+    putc(fd, buf[i]);
+ 526:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52c:	01 d0                	add    %edx,%eax
+ 52e:	0f b6 00             	movzbl (%eax),%eax
+ 531:	0f be c0             	movsbl %al,%eax
+ 534:	83 ec 08             	sub    $0x8,%esp
+ 537:	50                   	push   %eax
+ 538:	ff 75 08             	push   0x8(%ebp)
+ 53b:	e8 3d ff ff ff       	call   47d <putc>
+ 540:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 543:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 547:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 54b:	79 d9                	jns    526 <printint+0x86>
+}
+ 54d:	90                   	nop
+ 54e:	90                   	nop
+ 54f:	c9                   	leave
+ 550:	c3                   	ret
+
+00000551 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 551:	55                   	push   %ebp
+ 552:	89 e5                	mov    %esp,%ebp
+ 554:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 557:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 55e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 561:	83 c0 04             	add    $0x4,%eax
+ 564:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 567:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 56e:	e9 59 01 00 00       	jmp    6cc <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 573:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 576:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 579:	01 d0                	add    %edx,%eax
+ 57b:	0f b6 00             	movzbl (%eax),%eax
+ 57e:	0f be c0             	movsbl %al,%eax
+ 581:	25 ff 00 00 00       	and    $0xff,%eax
+ 586:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 589:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 58d:	75 2c                	jne    5bb <printf+0x6a>
+      if(c == '%'){
+ 58f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 593:	75 0c                	jne    5a1 <printf+0x50>
+        state = '%';
+ 595:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 59c:	e9 27 01 00 00       	jmp    6c8 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5a4:	0f be c0             	movsbl %al,%eax
+ 5a7:	83 ec 08             	sub    $0x8,%esp
+ 5aa:	50                   	push   %eax
+ 5ab:	ff 75 08             	push   0x8(%ebp)
+ 5ae:	e8 ca fe ff ff       	call   47d <putc>
+ 5b3:	83 c4 10             	add    $0x10,%esp
+ 5b6:	e9 0d 01 00 00       	jmp    6c8 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5bb:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5bf:	0f 85 03 01 00 00    	jne    6c8 <printf+0x177>
+      if(c == 'd'){
+ 5c5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5c9:	75 1e                	jne    5e9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ce:	8b 00                	mov    (%eax),%eax
+ 5d0:	6a 01                	push   $0x1
+ 5d2:	6a 0a                	push   $0xa
+ 5d4:	50                   	push   %eax
+ 5d5:	ff 75 08             	push   0x8(%ebp)
+ 5d8:	e8 c3 fe ff ff       	call   4a0 <printint>
+ 5dd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5e0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5e4:	e9 d8 00 00 00       	jmp    6c1 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5e9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5ed:	74 06                	je     5f5 <printf+0xa4>
+ 5ef:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5f3:	75 1e                	jne    613 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5f8:	8b 00                	mov    (%eax),%eax
+ 5fa:	6a 00                	push   $0x0
+ 5fc:	6a 10                	push   $0x10
+ 5fe:	50                   	push   %eax
+ 5ff:	ff 75 08             	push   0x8(%ebp)
+ 602:	e8 99 fe ff ff       	call   4a0 <printint>
+ 607:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 60a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 60e:	e9 ae 00 00 00       	jmp    6c1 <printf+0x170>
+      } else if(c == 's'){
+ 613:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 617:	75 43                	jne    65c <printf+0x10b>
+        s = (char*)*ap;
+ 619:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 61c:	8b 00                	mov    (%eax),%eax
+ 61e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 621:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 625:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 629:	75 25                	jne    650 <printf+0xff>
+          s = "(null)";
+ 62b:	c7 45 f4 04 0a 00 00 	movl   $0xa04,-0xc(%ebp)
+        while(*s != 0){
+ 632:	eb 1c                	jmp    650 <printf+0xff>
+          putc(fd, *s);
+ 634:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 637:	0f b6 00             	movzbl (%eax),%eax
+ 63a:	0f be c0             	movsbl %al,%eax
+ 63d:	83 ec 08             	sub    $0x8,%esp
+ 640:	50                   	push   %eax
+ 641:	ff 75 08             	push   0x8(%ebp)
+ 644:	e8 34 fe ff ff       	call   47d <putc>
+ 649:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 64c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 650:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 653:	0f b6 00             	movzbl (%eax),%eax
+ 656:	84 c0                	test   %al,%al
+ 658:	75 da                	jne    634 <printf+0xe3>
+ 65a:	eb 65                	jmp    6c1 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 65c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 660:	75 1d                	jne    67f <printf+0x12e>
+        putc(fd, *ap);
+ 662:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 665:	8b 00                	mov    (%eax),%eax
+ 667:	0f be c0             	movsbl %al,%eax
+ 66a:	83 ec 08             	sub    $0x8,%esp
+ 66d:	50                   	push   %eax
+ 66e:	ff 75 08             	push   0x8(%ebp)
+ 671:	e8 07 fe ff ff       	call   47d <putc>
+ 676:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 679:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 67d:	eb 42                	jmp    6c1 <printf+0x170>
+      } else if(c == '%'){
+ 67f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 683:	75 17                	jne    69c <printf+0x14b>
+        putc(fd, c);
+ 685:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 688:	0f be c0             	movsbl %al,%eax
+ 68b:	83 ec 08             	sub    $0x8,%esp
+ 68e:	50                   	push   %eax
+ 68f:	ff 75 08             	push   0x8(%ebp)
+ 692:	e8 e6 fd ff ff       	call   47d <putc>
+ 697:	83 c4 10             	add    $0x10,%esp
+ 69a:	eb 25                	jmp    6c1 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 69c:	83 ec 08             	sub    $0x8,%esp
+ 69f:	6a 25                	push   $0x25
+ 6a1:	ff 75 08             	push   0x8(%ebp)
+ 6a4:	e8 d4 fd ff ff       	call   47d <putc>
+ 6a9:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6af:	0f be c0             	movsbl %al,%eax
+ 6b2:	83 ec 08             	sub    $0x8,%esp
+ 6b5:	50                   	push   %eax
+ 6b6:	ff 75 08             	push   0x8(%ebp)
+ 6b9:	e8 bf fd ff ff       	call   47d <putc>
+ 6be:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6c8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6d2:	01 d0                	add    %edx,%eax
+ 6d4:	0f b6 00             	movzbl (%eax),%eax
+ 6d7:	84 c0                	test   %al,%al
+ 6d9:	0f 85 94 fe ff ff    	jne    573 <printf+0x22>
+    }
+  }
+}
+ 6df:	90                   	nop
+ 6e0:	90                   	nop
+ 6e1:	c9                   	leave
+ 6e2:	c3                   	ret
+
+000006e3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e3:	55                   	push   %ebp
+ 6e4:	89 e5                	mov    %esp,%ebp
+ 6e6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ec:	83 e8 08             	sub    $0x8,%eax
+ 6ef:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f2:	a1 48 0f 00 00       	mov    0xf48,%eax
+ 6f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6fa:	eb 24                	jmp    720 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ff:	8b 00                	mov    (%eax),%eax
+ 701:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 704:	72 12                	jb     718 <free+0x35>
+ 706:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 709:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 70c:	72 24                	jb     732 <free+0x4f>
+ 70e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 711:	8b 00                	mov    (%eax),%eax
+ 713:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 716:	72 1a                	jb     732 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 718:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71b:	8b 00                	mov    (%eax),%eax
+ 71d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 720:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 723:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 726:	73 d4                	jae    6fc <free+0x19>
+ 728:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72b:	8b 00                	mov    (%eax),%eax
+ 72d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 730:	73 ca                	jae    6fc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 732:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 735:	8b 40 04             	mov    0x4(%eax),%eax
+ 738:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 742:	01 c2                	add    %eax,%edx
+ 744:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 747:	8b 00                	mov    (%eax),%eax
+ 749:	39 c2                	cmp    %eax,%edx
+ 74b:	75 24                	jne    771 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 74d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 750:	8b 50 04             	mov    0x4(%eax),%edx
+ 753:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 756:	8b 00                	mov    (%eax),%eax
+ 758:	8b 40 04             	mov    0x4(%eax),%eax
+ 75b:	01 c2                	add    %eax,%edx
+ 75d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 760:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 763:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 766:	8b 00                	mov    (%eax),%eax
+ 768:	8b 10                	mov    (%eax),%edx
+ 76a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 76d:	89 10                	mov    %edx,(%eax)
+ 76f:	eb 0a                	jmp    77b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 771:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 774:	8b 10                	mov    (%eax),%edx
+ 776:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 779:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 77b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77e:	8b 40 04             	mov    0x4(%eax),%eax
+ 781:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 788:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78b:	01 d0                	add    %edx,%eax
+ 78d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 790:	75 20                	jne    7b2 <free+0xcf>
+    p->s.size += bp->s.size;
+ 792:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 795:	8b 50 04             	mov    0x4(%eax),%edx
+ 798:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79b:	8b 40 04             	mov    0x4(%eax),%eax
+ 79e:	01 c2                	add    %eax,%edx
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a9:	8b 10                	mov    (%eax),%edx
+ 7ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ae:	89 10                	mov    %edx,(%eax)
+ 7b0:	eb 08                	jmp    7ba <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7b8:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bd:	a3 48 0f 00 00       	mov    %eax,0xf48
+}
+ 7c2:	90                   	nop
+ 7c3:	c9                   	leave
+ 7c4:	c3                   	ret
+
+000007c5 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7c5:	55                   	push   %ebp
+ 7c6:	89 e5                	mov    %esp,%ebp
+ 7c8:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7cb:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7d2:	77 07                	ja     7db <morecore+0x16>
+    nu = 4096;
+ 7d4:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7de:	c1 e0 03             	shl    $0x3,%eax
+ 7e1:	83 ec 0c             	sub    $0xc,%esp
+ 7e4:	50                   	push   %eax
+ 7e5:	e8 43 fc ff ff       	call   42d <sbrk>
+ 7ea:	83 c4 10             	add    $0x10,%esp
+ 7ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7f0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7f4:	75 07                	jne    7fd <morecore+0x38>
+    return 0;
+ 7f6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7fb:	eb 26                	jmp    823 <morecore+0x5e>
+  hp = (Header*)p;
+ 7fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 800:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 803:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 806:	8b 55 08             	mov    0x8(%ebp),%edx
+ 809:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 80c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 80f:	83 c0 08             	add    $0x8,%eax
+ 812:	83 ec 0c             	sub    $0xc,%esp
+ 815:	50                   	push   %eax
+ 816:	e8 c8 fe ff ff       	call   6e3 <free>
+ 81b:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 81e:	a1 48 0f 00 00       	mov    0xf48,%eax
+}
+ 823:	c9                   	leave
+ 824:	c3                   	ret
+
+00000825 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 825:	55                   	push   %ebp
+ 826:	89 e5                	mov    %esp,%ebp
+ 828:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 82b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82e:	83 c0 07             	add    $0x7,%eax
+ 831:	c1 e8 03             	shr    $0x3,%eax
+ 834:	83 c0 01             	add    $0x1,%eax
+ 837:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 83a:	a1 48 0f 00 00       	mov    0xf48,%eax
+ 83f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 842:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 846:	75 23                	jne    86b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 848:	c7 45 f0 40 0f 00 00 	movl   $0xf40,-0x10(%ebp)
+ 84f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 852:	a3 48 0f 00 00       	mov    %eax,0xf48
+ 857:	a1 48 0f 00 00       	mov    0xf48,%eax
+ 85c:	a3 40 0f 00 00       	mov    %eax,0xf40
+    base.s.size = 0;
+ 861:	c7 05 44 0f 00 00 00 	movl   $0x0,0xf44
+ 868:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 86b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 86e:	8b 00                	mov    (%eax),%eax
+ 870:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 876:	8b 40 04             	mov    0x4(%eax),%eax
+ 879:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 87c:	72 4d                	jb     8cb <malloc+0xa6>
+      if(p->s.size == nunits)
+ 87e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 881:	8b 40 04             	mov    0x4(%eax),%eax
+ 884:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 887:	75 0c                	jne    895 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 889:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88c:	8b 10                	mov    (%eax),%edx
+ 88e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 891:	89 10                	mov    %edx,(%eax)
+ 893:	eb 26                	jmp    8bb <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 895:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 898:	8b 40 04             	mov    0x4(%eax),%eax
+ 89b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 89e:	89 c2                	mov    %eax,%edx
+ 8a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a3:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ac:	c1 e0 03             	shl    $0x3,%eax
+ 8af:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8b8:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8be:	a3 48 0f 00 00       	mov    %eax,0xf48
+      return (void*)(p + 1);
+ 8c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c6:	83 c0 08             	add    $0x8,%eax
+ 8c9:	eb 3b                	jmp    906 <malloc+0xe1>
+    }
+    if(p == freep)
+ 8cb:	a1 48 0f 00 00       	mov    0xf48,%eax
+ 8d0:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8d3:	75 1e                	jne    8f3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8d5:	83 ec 0c             	sub    $0xc,%esp
+ 8d8:	ff 75 ec             	push   -0x14(%ebp)
+ 8db:	e8 e5 fe ff ff       	call   7c5 <morecore>
+ 8e0:	83 c4 10             	add    $0x10,%esp
+ 8e3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ea:	75 07                	jne    8f3 <malloc+0xce>
+        return 0;
+ 8ec:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8f1:	eb 13                	jmp    906 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8fc:	8b 00                	mov    (%eax),%eax
+ 8fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 901:	e9 6d ff ff ff       	jmp    873 <malloc+0x4e>
+  }
+}
+ 906:	c9                   	leave
+ 907:	c3                   	ret
+
+00000908 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 908:	55                   	push   %ebp
+ 909:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 90b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 90e:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 911:	7e 08                	jle    91b <ticks+0x13>
+ 913:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 916:	2b 45 08             	sub    0x8(%ebp),%eax
+ 919:	eb 05                	jmp    920 <ticks+0x18>
+ 91b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 920:	5d                   	pop    %ebp
+ 921:	c3                   	ret
+
+00000922 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 922:	55                   	push   %ebp
+ 923:	89 e5                	mov    %esp,%ebp
+ 925:	53                   	push   %ebx
+ 926:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92c:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 92f:	ff 75 14             	push   0x14(%ebp)
+ 932:	ff 75 10             	push   0x10(%ebp)
+ 935:	e8 ce ff ff ff       	call   908 <ticks>
+ 93a:	83 c4 08             	add    $0x8,%esp
+ 93d:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 93f:	89 d8                	mov    %ebx,%eax
+ 941:	99                   	cltd
+ 942:	f7 f9                	idiv   %ecx
+ 944:	89 c2                	mov    %eax,%edx
+ 946:	8b 45 14             	mov    0x14(%ebp),%eax
+ 949:	2b 45 10             	sub    0x10(%ebp),%eax
+ 94c:	83 ec 04             	sub    $0x4,%esp
+ 94f:	ff 75 0c             	push   0xc(%ebp)
+ 952:	52                   	push   %edx
+ 953:	50                   	push   %eax
+ 954:	ff 75 0c             	push   0xc(%ebp)
+ 957:	ff 75 08             	push   0x8(%ebp)
+ 95a:	68 0c 0a 00 00       	push   $0xa0c
+ 95f:	6a 01                	push   $0x1
+ 961:	e8 eb fb ff ff       	call   551 <printf>
+ 966:	83 c4 20             	add    $0x20,%esp
+}
+ 969:	90                   	nop
+ 96a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 96d:	c9                   	leave
+ 96e:	c3                   	ret
+
+0000096f <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 96f:	55                   	push   %ebp
+ 970:	89 e5                	mov    %esp,%ebp
+ 972:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 975:	ff 75 14             	push   0x14(%ebp)
+ 978:	ff 75 10             	push   0x10(%ebp)
+ 97b:	e8 88 ff ff ff       	call   908 <ticks>
+ 980:	83 c4 08             	add    $0x8,%esp
+ 983:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 989:	99                   	cltd
+ 98a:	f7 7d 08             	idivl  0x8(%ebp)
+ 98d:	89 c2                	mov    %eax,%edx
+ 98f:	8b 45 14             	mov    0x14(%ebp),%eax
+ 992:	2b 45 10             	sub    0x10(%ebp),%eax
+ 995:	83 ec 08             	sub    $0x8,%esp
+ 998:	52                   	push   %edx
+ 999:	50                   	push   %eax
+ 99a:	ff 75 0c             	push   0xc(%ebp)
+ 99d:	ff 75 08             	push   0x8(%ebp)
+ 9a0:	68 2c 0a 00 00       	push   $0xa2c
+ 9a5:	6a 01                	push   $0x1
+ 9a7:	e8 a5 fb ff ff       	call   551 <printf>
+ 9ac:	83 c4 20             	add    $0x20,%esp
+}
+ 9af:	90                   	nop
+ 9b0:	c9                   	leave
+ 9b1:	c3                   	ret
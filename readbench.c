@@ -0,0 +1,54 @@
+// Sequential read throughput benchmark.
+//
+// Reads a file from start to end in 512-byte chunks, the way
+// "cat file > /dev/null" would, and reports the throughput.
+// The first pass after boot finds the file's blocks on disk;
+// the second finds them in the buffer cache.  Read-ahead
+// should bring the first close to the second; to compare
+// with none, build the kernel with "make RA=0".
+//
+// usage: readbench [file]   (default: usertests, the largest)
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "bcachestat.h"
+
+char buf[512];
+
+void
+pass(char *path)
+{
+  int fd, n, tot, t0, t1;
+  struct bcachestat st0, st1;
+
+  if((fd = open(path, O_RDONLY)) < 0){
+    printf(1, "readbench: cannot open %s\n", path);
+    exit();
+  }
+  getbcachestat(&st0);
+  tot = 0;
+  t0 = uptime();
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    tot += n;
+  t1 = uptime();
+  getbcachestat(&st1);
+  close(fd);
+
+  benchrate(tot / 1024, "KB", t0, t1);
+  printf(1, "%d misses, %d read ahead\n",
+         st1.nmiss - st0.nmiss, st1.nahead - st0.nahead);
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *path;
+
+  path = argc > 1 ? argv[1] : "usertests";
+  printf(1, "readbench %s\n", path);
+  pass(path);
+  pass(path);
+  exit();
+}
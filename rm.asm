@@ -0,0 +1,1283 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: rm files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 f4 08 00 00       	push   $0x8f4
+  21:	6a 02                	push   $0x2
+  23:	e8 6b 04 00 00       	call   493 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 b7 02 00 00       	call   2e7 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(unlink(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 02 00 00       	call   337 <unlink>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 08 09 00 00       	push   $0x908
+  74:	6a 02                	push   $0x2
+  76:	e8 18 04 00 00       	call   493 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 57 02 00 00       	call   2e7 <exit>
+
+00000090 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+    ;
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+    ;
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 47 01 00 00       	call   2ff <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 0c 01 00 00       	call   327 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 03 01 00 00       	call   33f <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 c2 00 00 00       	call   30f <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2df:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <exit>:
+SYSCALL(exit)
+ 2e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <wait>:
+SYSCALL(wait)
+ 2ef:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <pipe>:
+SYSCALL(pipe)
+ 2f7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <read>:
+SYSCALL(read)
+ 2ff:	b8 05 00 00 00       	mov    $0x5,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <write>:
+SYSCALL(write)
+ 307:	b8 10 00 00 00       	mov    $0x10,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <close>:
+SYSCALL(close)
+ 30f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <kill>:
+SYSCALL(kill)
+ 317:	b8 06 00 00 00       	mov    $0x6,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <exec>:
+SYSCALL(exec)
+ 31f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <open>:
+SYSCALL(open)
+ 327:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <mknod>:
+SYSCALL(mknod)
+ 32f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <unlink>:
+SYSCALL(unlink)
+ 337:	b8 12 00 00 00       	mov    $0x12,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <fstat>:
+SYSCALL(fstat)
+ 33f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <link>:
+SYSCALL(link)
+ 347:	b8 13 00 00 00       	mov    $0x13,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <mkdir>:
+SYSCALL(mkdir)
+ 34f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <chdir>:
+SYSCALL(chdir)
+ 357:	b8 09 00 00 00       	mov    $0x9,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <dup>:
+SYSCALL(dup)
+ 35f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <getpid>:
+SYSCALL(getpid)
+ 367:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <sbrk>:
+SYSCALL(sbrk)
+ 36f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <sleep>:
+SYSCALL(sleep)
+ 377:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <uptime>:
+SYSCALL(uptime)
+ 37f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 387:	b8 16 00 00 00       	mov    $0x16,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <getschedstat>:
+SYSCALL(getschedstat)
+ 38f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 397:	b8 18 00 00 00       	mov    $0x18,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <setshare>:
+SYSCALL(setshare)
+ 39f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 3a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <getdiskstat>:
+SYSCALL(getdiskstat)
+ 3af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <getlogstat>:
+SYSCALL(getlogstat)
+ 3b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3bf:	55                   	push   %ebp
+ 3c0:	89 e5                	mov    %esp,%ebp
+ 3c2:	83 ec 18             	sub    $0x18,%esp
+ 3c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c8:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3cb:	83 ec 04             	sub    $0x4,%esp
+ 3ce:	6a 01                	push   $0x1
+ 3d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3d3:	50                   	push   %eax
+ 3d4:	ff 75 08             	push   0x8(%ebp)
+ 3d7:	e8 2b ff ff ff       	call   307 <write>
+ 3dc:	83 c4 10             	add    $0x10,%esp
+}
+ 3df:	90                   	nop
+ 3e0:	c9                   	leave
+ 3e1:	c3                   	ret
+
+000003e2 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3e2:	55                   	push   %ebp
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3ef:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3f3:	74 17                	je     40c <printint+0x2a>
+ 3f5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3f9:	79 11                	jns    40c <printint+0x2a>
+    neg = 1;
+ 3fb:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 402:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 405:	f7 d8                	neg    %eax
+ 407:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 40a:	eb 06                	jmp    412 <printint+0x30>
+  } else {
+    x = xx;
+ 40c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 412:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 419:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 41c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 41f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 424:	f7 f1                	div    %ecx
+ 426:	89 d1                	mov    %edx,%ecx
+ 428:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 42b:	8d 50 01             	lea    0x1(%eax),%edx
+ 42e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 431:	0f b6 91 14 0c 00 00 	movzbl 0xc14(%ecx),%edx
+ 438:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 43c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 442:	ba 00 00 00 00       	mov    $0x0,%edx
+ 447:	f7 f1                	div    %ecx
+ 449:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 44c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 450:	75 c7                	jne    419 <printint+0x37>
+  if(neg)
+ 452:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 456:	74 2d                	je     485 <printint+0xa3>
+    buf[i++] = '-';
+ 458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 45b:	8d 50 01             	lea    0x1(%eax),%edx
+ 45e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 461:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 466:	eb 1d                	jmp    485 <printint+0xa3>
+    putc(fd, buf[i]);
+ 468:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 46b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 46e:	01 d0                	add    %edx,%eax
+ 470:	0f b6 00             	movzbl (%eax),%eax
+ 473:	0f be c0             	movsbl %al,%eax
+ 476:	83 ec 08             	sub    $0x8,%esp
+ 479:	50                   	push   %eax
+ 47a:	ff 75 08             	push   0x8(%ebp)
+ 47d:	e8 3d ff ff ff       	call   3bf <putc>
+ 482:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 485:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 489:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 48d:	79 d9                	jns    468 <printint+0x86>
+}
+ 48f:	90                   	nop
+ 490:	90                   	nop
+ 491:	c9                   	leave
+ 492:	c3                   	ret
+
+00000493 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 493:	55                   	push   %ebp
+ 494:	89 e5                	mov    %esp,%ebp
+ 496:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 499:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 4a0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 4a3:	83 c0 04             	add    $0x4,%eax
+ 4a6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 4a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 4b0:	e9 59 01 00 00       	jmp    60e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 4b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4bb:	01 d0                	add    %edx,%eax
+ 4bd:	0f b6 00             	movzbl (%eax),%eax
+ 4c0:	0f be c0             	movsbl %al,%eax
+ 4c3:	25 ff 00 00 00       	and    $0xff,%eax
+ 4c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4cf:	75 2c                	jne    4fd <printf+0x6a>
+      if(c == '%'){
+ 4d1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4d5:	75 0c                	jne    4e3 <printf+0x50>
+        state = '%';
+ 4d7:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4de:	e9 27 01 00 00       	jmp    60a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4e6:	0f be c0             	movsbl %al,%eax
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	50                   	push   %eax
+ 4ed:	ff 75 08             	push   0x8(%ebp)
+ 4f0:	e8 ca fe ff ff       	call   3bf <putc>
+ 4f5:	83 c4 10             	add    $0x10,%esp
+ 4f8:	e9 0d 01 00 00       	jmp    60a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4fd:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 501:	0f 85 03 01 00 00    	jne    60a <printf+0x177>
+      if(c == 'd'){
+ 507:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 50b:	75 1e                	jne    52b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 50d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 510:	8b 00                	mov    (%eax),%eax
+ 512:	6a 01                	push   $0x1
+ 514:	6a 0a                	push   $0xa
+ 516:	50                   	push   %eax
+ 517:	ff 75 08             	push   0x8(%ebp)
+ 51a:	e8 c3 fe ff ff       	call   3e2 <printint>
+ 51f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 522:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 526:	e9 d8 00 00 00       	jmp    603 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 52b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 52f:	74 06                	je     537 <printf+0xa4>
+ 531:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 535:	75 1e                	jne    555 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 537:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 53a:	8b 00                	mov    (%eax),%eax
+ 53c:	6a 00                	push   $0x0
+ 53e:	6a 10                	push   $0x10
+ 540:	50                   	push   %eax
+ 541:	ff 75 08             	push   0x8(%ebp)
+ 544:	e8 99 fe ff ff       	call   3e2 <printint>
+ 549:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 54c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 550:	e9 ae 00 00 00       	jmp    603 <printf+0x170>
+      } else if(c == 's'){
+ 555:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 559:	75 43                	jne    59e <printf+0x10b>
+        s = (char*)*ap;
+ 55b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 55e:	8b 00                	mov    (%eax),%eax
+ 560:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 563:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 567:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 56b:	75 25                	jne    592 <printf+0xff>
+          s = "(null)";
+ 56d:	c7 45 f4 21 09 00 00 	movl   $0x921,-0xc(%ebp)
+        while(*s != 0){
+ 574:	eb 1c                	jmp    592 <printf+0xff>
+          putc(fd, *s);
+ 576:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 579:	0f b6 00             	movzbl (%eax),%eax
+ 57c:	0f be c0             	movsbl %al,%eax
+ 57f:	83 ec 08             	sub    $0x8,%esp
+ 582:	50                   	push   %eax
+ 583:	ff 75 08             	push   0x8(%ebp)
+ 586:	e8 34 fe ff ff       	call   3bf <putc>
+ 58b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 58e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 592:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 595:	0f b6 00             	movzbl (%eax),%eax
+ 598:	84 c0                	test   %al,%al
+ 59a:	75 da                	jne    576 <printf+0xe3>
+ 59c:	eb 65                	jmp    603 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 59e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 5a2:	75 1d                	jne    5c1 <printf+0x12e>
+        putc(fd, *ap);
+ 5a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5a7:	8b 00                	mov    (%eax),%eax
+ 5a9:	0f be c0             	movsbl %al,%eax
+ 5ac:	83 ec 08             	sub    $0x8,%esp
+ 5af:	50                   	push   %eax
+ 5b0:	ff 75 08             	push   0x8(%ebp)
+ 5b3:	e8 07 fe ff ff       	call   3bf <putc>
+ 5b8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5bf:	eb 42                	jmp    603 <printf+0x170>
+      } else if(c == '%'){
+ 5c1:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5c5:	75 17                	jne    5de <printf+0x14b>
+        putc(fd, c);
+ 5c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5ca:	0f be c0             	movsbl %al,%eax
+ 5cd:	83 ec 08             	sub    $0x8,%esp
+ 5d0:	50                   	push   %eax
+ 5d1:	ff 75 08             	push   0x8(%ebp)
+ 5d4:	e8 e6 fd ff ff       	call   3bf <putc>
+ 5d9:	83 c4 10             	add    $0x10,%esp
+ 5dc:	eb 25                	jmp    603 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5de:	83 ec 08             	sub    $0x8,%esp
+ 5e1:	6a 25                	push   $0x25
+ 5e3:	ff 75 08             	push   0x8(%ebp)
+ 5e6:	e8 d4 fd ff ff       	call   3bf <putc>
+ 5eb:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f1:	0f be c0             	movsbl %al,%eax
+ 5f4:	83 ec 08             	sub    $0x8,%esp
+ 5f7:	50                   	push   %eax
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 bf fd ff ff       	call   3bf <putc>
+ 600:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 603:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 60a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 60e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 611:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 614:	01 d0                	add    %edx,%eax
+ 616:	0f b6 00             	movzbl (%eax),%eax
+ 619:	84 c0                	test   %al,%al
+ 61b:	0f 85 94 fe ff ff    	jne    4b5 <printf+0x22>
+    }
+  }
+}
+ 621:	90                   	nop
+ 622:	90                   	nop
+ 623:	c9                   	leave
+ 624:	c3                   	ret
+
+00000625 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 625:	55                   	push   %ebp
+ 626:	89 e5                	mov    %esp,%ebp
+ 628:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 62b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62e:	83 e8 08             	sub    $0x8,%eax
+ 631:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 634:	a1 30 0c 00 00       	mov    0xc30,%eax
+ 639:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 63c:	eb 24                	jmp    662 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 63e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 641:	8b 00                	mov    (%eax),%eax
+ 643:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 646:	72 12                	jb     65a <free+0x35>
+ 648:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 64b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 64e:	72 24                	jb     674 <free+0x4f>
+ 650:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 653:	8b 00                	mov    (%eax),%eax
+ 655:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 658:	72 1a                	jb     674 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 65d:	8b 00                	mov    (%eax),%eax
+ 65f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 662:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 665:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 668:	73 d4                	jae    63e <free+0x19>
+ 66a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66d:	8b 00                	mov    (%eax),%eax
+ 66f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 672:	73 ca                	jae    63e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 674:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 677:	8b 40 04             	mov    0x4(%eax),%eax
+ 67a:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 681:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 684:	01 c2                	add    %eax,%edx
+ 686:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 689:	8b 00                	mov    (%eax),%eax
+ 68b:	39 c2                	cmp    %eax,%edx
+ 68d:	75 24                	jne    6b3 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 68f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 692:	8b 50 04             	mov    0x4(%eax),%edx
+ 695:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 698:	8b 00                	mov    (%eax),%eax
+ 69a:	8b 40 04             	mov    0x4(%eax),%eax
+ 69d:	01 c2                	add    %eax,%edx
+ 69f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a8:	8b 00                	mov    (%eax),%eax
+ 6aa:	8b 10                	mov    (%eax),%edx
+ 6ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6af:	89 10                	mov    %edx,(%eax)
+ 6b1:	eb 0a                	jmp    6bd <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b6:	8b 10                	mov    (%eax),%edx
+ 6b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bb:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cd:	01 d0                	add    %edx,%eax
+ 6cf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6d2:	75 20                	jne    6f4 <free+0xcf>
+    p->s.size += bp->s.size;
+ 6d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d7:	8b 50 04             	mov    0x4(%eax),%edx
+ 6da:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6dd:	8b 40 04             	mov    0x4(%eax),%eax
+ 6e0:	01 c2                	add    %eax,%edx
+ 6e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e5:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6eb:	8b 10                	mov    (%eax),%edx
+ 6ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f0:	89 10                	mov    %edx,(%eax)
+ 6f2:	eb 08                	jmp    6fc <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6fa:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ff:	a3 30 0c 00 00       	mov    %eax,0xc30
+}
+ 704:	90                   	nop
+ 705:	c9                   	leave
+ 706:	c3                   	ret
+
+00000707 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 707:	55                   	push   %ebp
+ 708:	89 e5                	mov    %esp,%ebp
+ 70a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 70d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 714:	77 07                	ja     71d <morecore+0x16>
+    nu = 4096;
+ 716:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 71d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 720:	c1 e0 03             	shl    $0x3,%eax
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	50                   	push   %eax
+ 727:	e8 43 fc ff ff       	call   36f <sbrk>
+ 72c:	83 c4 10             	add    $0x10,%esp
+ 72f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 732:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 736:	75 07                	jne    73f <morecore+0x38>
+    return 0;
+ 738:	b8 00 00 00 00       	mov    $0x0,%eax
+ 73d:	eb 26                	jmp    765 <morecore+0x5e>
+  hp = (Header*)p;
+ 73f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 742:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 745:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 748:	8b 55 08             	mov    0x8(%ebp),%edx
+ 74b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 74e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 751:	83 c0 08             	add    $0x8,%eax
+ 754:	83 ec 0c             	sub    $0xc,%esp
+ 757:	50                   	push   %eax
+ 758:	e8 c8 fe ff ff       	call   625 <free>
+ 75d:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 760:	a1 30 0c 00 00       	mov    0xc30,%eax
+}
+ 765:	c9                   	leave
+ 766:	c3                   	ret
+
+00000767 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 767:	55                   	push   %ebp
+ 768:	89 e5                	mov    %esp,%ebp
+ 76a:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 76d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 770:	83 c0 07             	add    $0x7,%eax
+ 773:	c1 e8 03             	shr    $0x3,%eax
+ 776:	83 c0 01             	add    $0x1,%eax
+ 779:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 77c:	a1 30 0c 00 00       	mov    0xc30,%eax
+ 781:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 784:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 788:	75 23                	jne    7ad <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 78a:	c7 45 f0 28 0c 00 00 	movl   $0xc28,-0x10(%ebp)
+ 791:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 794:	a3 30 0c 00 00       	mov    %eax,0xc30
+ 799:	a1 30 0c 00 00       	mov    0xc30,%eax
+ 79e:	a3 28 0c 00 00       	mov    %eax,0xc28
+    base.s.size = 0;
+ 7a3:	c7 05 2c 0c 00 00 00 	movl   $0x0,0xc2c
+ 7aa:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b0:	8b 00                	mov    (%eax),%eax
+ 7b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b8:	8b 40 04             	mov    0x4(%eax),%eax
+ 7bb:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7be:	72 4d                	jb     80d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c3:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7c9:	75 0c                	jne    7d7 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ce:	8b 10                	mov    (%eax),%edx
+ 7d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7d3:	89 10                	mov    %edx,(%eax)
+ 7d5:	eb 26                	jmp    7fd <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7da:	8b 40 04             	mov    0x4(%eax),%eax
+ 7dd:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7e0:	89 c2                	mov    %eax,%edx
+ 7e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e5:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7eb:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ee:	c1 e0 03             	shl    $0x3,%eax
+ 7f1:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7fa:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 800:	a3 30 0c 00 00       	mov    %eax,0xc30
+      return (void*)(p + 1);
+ 805:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 808:	83 c0 08             	add    $0x8,%eax
+ 80b:	eb 3b                	jmp    848 <malloc+0xe1>
+    }
+    if(p == freep)
+ 80d:	a1 30 0c 00 00       	mov    0xc30,%eax
+ 812:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 815:	75 1e                	jne    835 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 817:	83 ec 0c             	sub    $0xc,%esp
+ 81a:	ff 75 ec             	push   -0x14(%ebp)
+ 81d:	e8 e5 fe ff ff       	call   707 <morecore>
+ 822:	83 c4 10             	add    $0x10,%esp
+ 825:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 828:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 82c:	75 07                	jne    835 <malloc+0xce>
+        return 0;
+ 82e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 833:	eb 13                	jmp    848 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 838:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 83b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83e:	8b 00                	mov    (%eax),%eax
+ 840:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 843:	e9 6d ff ff ff       	jmp    7b5 <malloc+0x4e>
+  }
+}
+ 848:	c9                   	leave
+ 849:	c3                   	ret
+
+0000084a <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 84a:	55                   	push   %ebp
+ 84b:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 84d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 850:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 853:	7e 08                	jle    85d <ticks+0x13>
+ 855:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 858:	2b 45 08             	sub    0x8(%ebp),%eax
+ 85b:	eb 05                	jmp    862 <ticks+0x18>
+ 85d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 862:	5d                   	pop    %ebp
+ 863:	c3                   	ret
+
+00000864 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 864:	55                   	push   %ebp
+ 865:	89 e5                	mov    %esp,%ebp
+ 867:	53                   	push   %ebx
+ 868:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 86b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86e:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 871:	ff 75 14             	push   0x14(%ebp)
+ 874:	ff 75 10             	push   0x10(%ebp)
+ 877:	e8 ce ff ff ff       	call   84a <ticks>
+ 87c:	83 c4 08             	add    $0x8,%esp
+ 87f:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 881:	89 d8                	mov    %ebx,%eax
+ 883:	99                   	cltd
+ 884:	f7 f9                	idiv   %ecx
+ 886:	89 c2                	mov    %eax,%edx
+ 888:	8b 45 14             	mov    0x14(%ebp),%eax
+ 88b:	2b 45 10             	sub    0x10(%ebp),%eax
+ 88e:	83 ec 04             	sub    $0x4,%esp
+ 891:	ff 75 0c             	push   0xc(%ebp)
+ 894:	52                   	push   %edx
+ 895:	50                   	push   %eax
+ 896:	ff 75 0c             	push   0xc(%ebp)
+ 899:	ff 75 08             	push   0x8(%ebp)
+ 89c:	68 28 09 00 00       	push   $0x928
+ 8a1:	6a 01                	push   $0x1
+ 8a3:	e8 eb fb ff ff       	call   493 <printf>
+ 8a8:	83 c4 20             	add    $0x20,%esp
+}
+ 8ab:	90                   	nop
+ 8ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8af:	c9                   	leave
+ 8b0:	c3                   	ret
+
+000008b1 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 8b1:	55                   	push   %ebp
+ 8b2:	89 e5                	mov    %esp,%ebp
+ 8b4:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 8b7:	ff 75 14             	push   0x14(%ebp)
+ 8ba:	ff 75 10             	push   0x10(%ebp)
+ 8bd:	e8 88 ff ff ff       	call   84a <ticks>
+ 8c2:	83 c4 08             	add    $0x8,%esp
+ 8c5:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 8cb:	99                   	cltd
+ 8cc:	f7 7d 08             	idivl  0x8(%ebp)
+ 8cf:	89 c2                	mov    %eax,%edx
+ 8d1:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8d4:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8d7:	83 ec 08             	sub    $0x8,%esp
+ 8da:	52                   	push   %edx
+ 8db:	50                   	push   %eax
+ 8dc:	ff 75 0c             	push   0xc(%ebp)
+ 8df:	ff 75 08             	push   0x8(%ebp)
+ 8e2:	68 48 09 00 00       	push   $0x948
+ 8e7:	6a 01                	push   $0x1
+ 8e9:	e8 a5 fb ff ff       	call   493 <printf>
+ 8ee:	83 c4 20             	add    $0x20,%esp
+}
+ 8f1:	90                   	nop
+ 8f2:	c9                   	leave
+ 8f3:	c3                   	ret
@@ -0,0 +1,1491 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <pingpong>:
+#define NROUND 2000
+
+// Bounce a byte NROUND times between two processes.
+void
+pingpong(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int p1[2], p2[2], i, pid;
+  char c;
+
+  if(pipe(p1) < 0 || pipe(p2) < 0){
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+   c:	50                   	push   %eax
+   d:	e8 90 04 00 00       	call   4a2 <pipe>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	85 c0                	test   %eax,%eax
+  17:	78 13                	js     2c <pingpong+0x2c>
+  19:	83 ec 0c             	sub    $0xc,%esp
+  1c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  1f:	50                   	push   %eax
+  20:	e8 7d 04 00 00       	call   4a2 <pipe>
+  25:	83 c4 10             	add    $0x10,%esp
+  28:	85 c0                	test   %eax,%eax
+  2a:	79 17                	jns    43 <pingpong+0x43>
+    printf(1, "schedbench: pipe failed\n");
+  2c:	83 ec 08             	sub    $0x8,%esp
+  2f:	68 a0 0a 00 00       	push   $0xaa0
+  34:	6a 01                	push   $0x1
+  36:	e8 03 06 00 00       	call   63e <printf>
+  3b:	83 c4 10             	add    $0x10,%esp
+    exit();
+  3e:	e8 4f 04 00 00       	call   492 <exit>
+  }
+  pid = fork();
+  43:	e8 42 04 00 00       	call   48a <fork>
+  48:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+  4b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  4f:	79 17                	jns    68 <pingpong+0x68>
+    printf(1, "schedbench: fork failed\n");
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	68 b9 0a 00 00       	push   $0xab9
+  59:	6a 01                	push   $0x1
+  5b:	e8 de 05 00 00       	call   63e <printf>
+  60:	83 c4 10             	add    $0x10,%esp
+    exit();
+  63:	e8 2a 04 00 00       	call   492 <exit>
+  }
+  if(pid == 0){
+  68:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  6c:	75 4d                	jne    bb <pingpong+0xbb>
+    for(i = 0; i < NROUND; i++){
+  6e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  75:	eb 33                	jmp    aa <pingpong+0xaa>
+      if(read(p1[0], &c, 1) != 1)
+  77:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  7a:	83 ec 04             	sub    $0x4,%esp
+  7d:	6a 01                	push   $0x1
+  7f:	8d 55 df             	lea    -0x21(%ebp),%edx
+  82:	52                   	push   %edx
+  83:	50                   	push   %eax
+  84:	e8 21 04 00 00       	call   4aa <read>
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	83 f8 01             	cmp    $0x1,%eax
+  8f:	75 24                	jne    b5 <pingpong+0xb5>
+        break;
+      write(p2[1], &c, 1);
+  91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  94:	83 ec 04             	sub    $0x4,%esp
+  97:	6a 01                	push   $0x1
+  99:	8d 55 df             	lea    -0x21(%ebp),%edx
+  9c:	52                   	push   %edx
+  9d:	50                   	push   %eax
+  9e:	e8 0f 04 00 00       	call   4b2 <write>
+  a3:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NROUND; i++){
+  a6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  aa:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+  b1:	7e c4                	jle    77 <pingpong+0x77>
+  b3:	eb 01                	jmp    b6 <pingpong+0xb6>
+        break;
+  b5:	90                   	nop
+    }
+    exit();
+  b6:	e8 d7 03 00 00       	call   492 <exit>
+  }
+  c = 'x';
+  bb:	c6 45 df 78          	movb   $0x78,-0x21(%ebp)
+  for(i = 0; i < NROUND; i++){
+  bf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  c6:	eb 33                	jmp    fb <pingpong+0xfb>
+    write(p1[1], &c, 1);
+  c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	6a 01                	push   $0x1
+  d0:	8d 55 df             	lea    -0x21(%ebp),%edx
+  d3:	52                   	push   %edx
+  d4:	50                   	push   %eax
+  d5:	e8 d8 03 00 00       	call   4b2 <write>
+  da:	83 c4 10             	add    $0x10,%esp
+    if(read(p2[0], &c, 1) != 1)
+  dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e0:	83 ec 04             	sub    $0x4,%esp
+  e3:	6a 01                	push   $0x1
+  e5:	8d 55 df             	lea    -0x21(%ebp),%edx
+  e8:	52                   	push   %edx
+  e9:	50                   	push   %eax
+  ea:	e8 bb 03 00 00       	call   4aa <read>
+  ef:	83 c4 10             	add    $0x10,%esp
+  f2:	83 f8 01             	cmp    $0x1,%eax
+  f5:	75 0f                	jne    106 <pingpong+0x106>
+  for(i = 0; i < NROUND; i++){
+  f7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  fb:	81 7d f4 cf 07 00 00 	cmpl   $0x7cf,-0xc(%ebp)
+ 102:	7e c4                	jle    c8 <pingpong+0xc8>
+ 104:	eb 01                	jmp    107 <pingpong+0x107>
+      break;
+ 106:	90                   	nop
+  }
+  wait();
+ 107:	e8 8e 03 00 00       	call   49a <wait>
+  exit();
+ 10c:	e8 81 03 00 00       	call   492 <exit>
+
+00000111 <nswitch>:
+}
+
+// Return the number of context switches all CPUs have made.
+uint
+nswitch(void)
+{
+ 111:	55                   	push   %ebp
+ 112:	89 e5                	mov    %esp,%ebp
+ 114:	83 ec 28             	sub    $0x28,%esp
+  struct schedstat st;
+  uint n;
+  int i;
+
+  n = 0;
+ 117:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+ 11e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 125:	eb 0a                	jmp    131 <nswitch+0x20>
+    n += st.nswitch;
+ 127:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 12a:	01 45 f4             	add    %eax,-0xc(%ebp)
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+ 12d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 137:	50                   	push   %eax
+ 138:	ff 75 f0             	push   -0x10(%ebp)
+ 13b:	e8 fa 03 00 00       	call   53a <getschedstat>
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	85 c0                	test   %eax,%eax
+ 145:	74 e0                	je     127 <nswitch+0x16>
+  return n;
+ 147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <run>:
+
+// Run npair ping-pong pairs concurrently and report
+// context switches per second.
+void
+run(int npair)
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+ 14f:	83 ec 28             	sub    $0x28,%esp
+  int i, t0, t1;
+  uint n0, n;
+
+  n0 = nswitch();
+ 152:	e8 ba ff ff ff       	call   111 <nswitch>
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  t0 = uptime();
+ 15a:	e8 cb 03 00 00       	call   52a <uptime>
+ 15f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < npair; i++){
+ 162:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 169:	eb 12                	jmp    17d <run+0x31>
+    if(fork() == 0)
+ 16b:	e8 1a 03 00 00       	call   48a <fork>
+ 170:	85 c0                	test   %eax,%eax
+ 172:	75 05                	jne    179 <run+0x2d>
+      pingpong();
+ 174:	e8 87 fe ff ff       	call   0 <pingpong>
+  for(i = 0; i < npair; i++){
+ 179:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 17d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 180:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 183:	7c e6                	jl     16b <run+0x1f>
+  }
+  for(i = 0; i < npair; i++)
+ 185:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18c:	eb 09                	jmp    197 <run+0x4b>
+    wait();
+ 18e:	e8 07 03 00 00       	call   49a <wait>
+  for(i = 0; i < npair; i++)
+ 193:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 197:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19a:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 19d:	7c ef                	jl     18e <run+0x42>
+  t1 = uptime();
+ 19f:	e8 86 03 00 00       	call   52a <uptime>
+ 1a4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  n = nswitch() - n0;
+ 1a7:	e8 65 ff ff ff       	call   111 <nswitch>
+ 1ac:	2b 45 f0             	sub    -0x10(%ebp),%eax
+ 1af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  printf(1, "pairs %d: ", npair);
+ 1b2:	83 ec 04             	sub    $0x4,%esp
+ 1b5:	ff 75 08             	push   0x8(%ebp)
+ 1b8:	68 d2 0a 00 00       	push   $0xad2
+ 1bd:	6a 01                	push   $0x1
+ 1bf:	e8 7a 04 00 00       	call   63e <printf>
+ 1c4:	83 c4 10             	add    $0x10,%esp
+  benchrate(n, "switches", t0, t1);
+ 1c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1ca:	ff 75 e8             	push   -0x18(%ebp)
+ 1cd:	ff 75 ec             	push   -0x14(%ebp)
+ 1d0:	68 dd 0a 00 00       	push   $0xadd
+ 1d5:	50                   	push   %eax
+ 1d6:	e8 34 08 00 00       	call   a0f <benchrate>
+ 1db:	83 c4 10             	add    $0x10,%esp
+}
+ 1de:	90                   	nop
+ 1df:	c9                   	leave
+ 1e0:	c3                   	ret
+
+000001e1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 1e1:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1e5:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1e8:	ff 71 fc             	push   -0x4(%ecx)
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	51                   	push   %ecx
+ 1ef:	83 ec 14             	sub    $0x14,%esp
+  int npair;
+
+  printf(1, "schedbench starting\n");
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	68 e6 0a 00 00       	push   $0xae6
+ 1fa:	6a 01                	push   $0x1
+ 1fc:	e8 3d 04 00 00       	call   63e <printf>
+ 201:	83 c4 10             	add    $0x10,%esp
+  for(npair = 1; npair <= 8; npair *= 2)
+ 204:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 20b:	eb 11                	jmp    21e <main+0x3d>
+    run(npair);
+ 20d:	83 ec 0c             	sub    $0xc,%esp
+ 210:	ff 75 f4             	push   -0xc(%ebp)
+ 213:	e8 34 ff ff ff       	call   14c <run>
+ 218:	83 c4 10             	add    $0x10,%esp
+  for(npair = 1; npair <= 8; npair *= 2)
+ 21b:	d1 65 f4             	shll   -0xc(%ebp)
+ 21e:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+ 222:	7e e9                	jle    20d <main+0x2c>
+  printf(1, "schedbench done\n");
+ 224:	83 ec 08             	sub    $0x8,%esp
+ 227:	68 fb 0a 00 00       	push   $0xafb
+ 22c:	6a 01                	push   $0x1
+ 22e:	e8 0b 04 00 00       	call   63e <printf>
+ 233:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 236:	e8 57 02 00 00       	call   492 <exit>
+
+0000023b <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 23b:	55                   	push   %ebp
+ 23c:	89 e5                	mov    %esp,%ebp
+ 23e:	57                   	push   %edi
+ 23f:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 240:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 243:	8b 55 10             	mov    0x10(%ebp),%edx
+ 246:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 249:	89 cb                	mov    %ecx,%ebx
+ 24b:	89 df                	mov    %ebx,%edi
+ 24d:	89 d1                	mov    %edx,%ecx
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+ 252:	89 ca                	mov    %ecx,%edx
+ 254:	89 fb                	mov    %edi,%ebx
+ 256:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 259:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 25c:	90                   	nop
+ 25d:	5b                   	pop    %ebx
+ 25e:	5f                   	pop    %edi
+ 25f:	5d                   	pop    %ebp
+ 260:	c3                   	ret
+
+00000261 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 261:	55                   	push   %ebp
+ 262:	89 e5                	mov    %esp,%ebp
+ 264:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 26d:	90                   	nop
+ 26e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 271:	8d 42 01             	lea    0x1(%edx),%eax
+ 274:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 27d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 280:	0f b6 12             	movzbl (%edx),%edx
+ 283:	88 10                	mov    %dl,(%eax)
+ 285:	0f b6 00             	movzbl (%eax),%eax
+ 288:	84 c0                	test   %al,%al
+ 28a:	75 e2                	jne    26e <strcpy+0xd>
+    ;
+  return os;
+ 28c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 28f:	c9                   	leave
+ 290:	c3                   	ret
+
+00000291 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 291:	55                   	push   %ebp
+ 292:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 294:	eb 08                	jmp    29e <strcmp+0xd>
+    p++, q++;
+ 296:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 29a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 29e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a1:	0f b6 00             	movzbl (%eax),%eax
+ 2a4:	84 c0                	test   %al,%al
+ 2a6:	74 10                	je     2b8 <strcmp+0x27>
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	0f b6 10             	movzbl (%eax),%edx
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	0f b6 00             	movzbl (%eax),%eax
+ 2b4:	38 c2                	cmp    %al,%dl
+ 2b6:	74 de                	je     296 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bb:	0f b6 00             	movzbl (%eax),%eax
+ 2be:	0f b6 d0             	movzbl %al,%edx
+ 2c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c4:	0f b6 00             	movzbl (%eax),%eax
+ 2c7:	0f b6 c0             	movzbl %al,%eax
+ 2ca:	29 c2                	sub    %eax,%edx
+ 2cc:	89 d0                	mov    %edx,%eax
+}
+ 2ce:	5d                   	pop    %ebp
+ 2cf:	c3                   	ret
+
+000002d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2d6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2dd:	eb 04                	jmp    2e3 <strlen+0x13>
+ 2df:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2e3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e9:	01 d0                	add    %edx,%eax
+ 2eb:	0f b6 00             	movzbl (%eax),%eax
+ 2ee:	84 c0                	test   %al,%al
+ 2f0:	75 ed                	jne    2df <strlen+0xf>
+    ;
+  return n;
+ 2f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2f5:	c9                   	leave
+ 2f6:	c3                   	ret
+
+000002f7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2fa:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2fd:	50                   	push   %eax
+ 2fe:	ff 75 0c             	push   0xc(%ebp)
+ 301:	ff 75 08             	push   0x8(%ebp)
+ 304:	e8 32 ff ff ff       	call   23b <stosb>
+ 309:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 30c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 30f:	c9                   	leave
+ 310:	c3                   	ret
+
+00000311 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 311:	55                   	push   %ebp
+ 312:	89 e5                	mov    %esp,%ebp
+ 314:	83 ec 04             	sub    $0x4,%esp
+ 317:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31a:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 31d:	eb 14                	jmp    333 <strchr+0x22>
+    if(*s == c)
+ 31f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 322:	0f b6 00             	movzbl (%eax),%eax
+ 325:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 328:	75 05                	jne    32f <strchr+0x1e>
+      return (char*)s;
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	eb 13                	jmp    342 <strchr+0x31>
+  for(; *s; s++)
+ 32f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 00             	movzbl (%eax),%eax
+ 339:	84 c0                	test   %al,%al
+ 33b:	75 e2                	jne    31f <strchr+0xe>
+  return 0;
+ 33d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 342:	c9                   	leave
+ 343:	c3                   	ret
+
+00000344 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 34a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 351:	eb 42                	jmp    395 <gets+0x51>
+    cc = read(0, &c, 1);
+ 353:	83 ec 04             	sub    $0x4,%esp
+ 356:	6a 01                	push   $0x1
+ 358:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 35b:	50                   	push   %eax
+ 35c:	6a 00                	push   $0x0
+ 35e:	e8 47 01 00 00       	call   4aa <read>
+ 363:	83 c4 10             	add    $0x10,%esp
+ 366:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 369:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 36d:	7e 33                	jle    3a2 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 36f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 372:	8d 50 01             	lea    0x1(%eax),%edx
+ 375:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 378:	89 c2                	mov    %eax,%edx
+ 37a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37d:	01 c2                	add    %eax,%edx
+ 37f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 383:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 385:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 389:	3c 0a                	cmp    $0xa,%al
+ 38b:	74 16                	je     3a3 <gets+0x5f>
+ 38d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 391:	3c 0d                	cmp    $0xd,%al
+ 393:	74 0e                	je     3a3 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 395:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 398:	83 c0 01             	add    $0x1,%eax
+ 39b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 39e:	7f b3                	jg     353 <gets+0xf>
+ 3a0:	eb 01                	jmp    3a3 <gets+0x5f>
+      break;
+ 3a2:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a9:	01 d0                	add    %edx,%eax
+ 3ab:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b1:	c9                   	leave
+ 3b2:	c3                   	ret
+
+000003b3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3b3:	55                   	push   %ebp
+ 3b4:	89 e5                	mov    %esp,%ebp
+ 3b6:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	6a 00                	push   $0x0
+ 3be:	ff 75 08             	push   0x8(%ebp)
+ 3c1:	e8 0c 01 00 00       	call   4d2 <open>
+ 3c6:	83 c4 10             	add    $0x10,%esp
+ 3c9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3d0:	79 07                	jns    3d9 <stat+0x26>
+    return -1;
+ 3d2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3d7:	eb 25                	jmp    3fe <stat+0x4b>
+  r = fstat(fd, st);
+ 3d9:	83 ec 08             	sub    $0x8,%esp
+ 3dc:	ff 75 0c             	push   0xc(%ebp)
+ 3df:	ff 75 f4             	push   -0xc(%ebp)
+ 3e2:	e8 03 01 00 00       	call   4ea <fstat>
+ 3e7:	83 c4 10             	add    $0x10,%esp
+ 3ea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3ed:	83 ec 0c             	sub    $0xc,%esp
+ 3f0:	ff 75 f4             	push   -0xc(%ebp)
+ 3f3:	e8 c2 00 00 00       	call   4ba <close>
+ 3f8:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3fb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3fe:	c9                   	leave
+ 3ff:	c3                   	ret
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 406:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 40d:	eb 25                	jmp    434 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 40f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 412:	89 d0                	mov    %edx,%eax
+ 414:	c1 e0 02             	shl    $0x2,%eax
+ 417:	01 d0                	add    %edx,%eax
+ 419:	01 c0                	add    %eax,%eax
+ 41b:	89 c1                	mov    %eax,%ecx
+ 41d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 420:	8d 50 01             	lea    0x1(%eax),%edx
+ 423:	89 55 08             	mov    %edx,0x8(%ebp)
+ 426:	0f b6 00             	movzbl (%eax),%eax
+ 429:	0f be c0             	movsbl %al,%eax
+ 42c:	01 c8                	add    %ecx,%eax
+ 42e:	83 e8 30             	sub    $0x30,%eax
+ 431:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 434:	8b 45 08             	mov    0x8(%ebp),%eax
+ 437:	0f b6 00             	movzbl (%eax),%eax
+ 43a:	3c 2f                	cmp    $0x2f,%al
+ 43c:	7e 0a                	jle    448 <atoi+0x48>
+ 43e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 441:	0f b6 00             	movzbl (%eax),%eax
+ 444:	3c 39                	cmp    $0x39,%al
+ 446:	7e c7                	jle    40f <atoi+0xf>
+  return n;
+ 448:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 459:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 45c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 45f:	eb 17                	jmp    478 <memmove+0x2b>
+    *dst++ = *src++;
+ 461:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 464:	8d 42 01             	lea    0x1(%edx),%eax
+ 467:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 46a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 46d:	8d 48 01             	lea    0x1(%eax),%ecx
+ 470:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 473:	0f b6 12             	movzbl (%edx),%edx
+ 476:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 478:	8b 45 10             	mov    0x10(%ebp),%eax
+ 47b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 47e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 481:	85 c0                	test   %eax,%eax
+ 483:	7f dc                	jg     461 <memmove+0x14>
+  return vdst;
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 488:	c9                   	leave
+ 489:	c3                   	ret
+
+0000048a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 48a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <exit>:
+SYSCALL(exit)
+ 492:	b8 02 00 00 00       	mov    $0x2,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <wait>:
+SYSCALL(wait)
+ 49a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <pipe>:
+SYSCALL(pipe)
+ 4a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <read>:
+SYSCALL(read)
+ 4aa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4af:	cd 40                	int    $0x40
+ 4b1:	c3                   	ret
+
+000004b2 <write>:
+SYSCALL(write)
+ 4b2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b7:	cd 40                	int    $0x40
+ 4b9:	c3                   	ret
+
+000004ba <close>:
+SYSCALL(close)
+ 4ba:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4bf:	cd 40                	int    $0x40
+ 4c1:	c3                   	ret
+
+000004c2 <kill>:
+SYSCALL(kill)
+ 4c2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c7:	cd 40                	int    $0x40
+ 4c9:	c3                   	ret
+
+000004ca <exec>:
+SYSCALL(exec)
+ 4ca:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4cf:	cd 40                	int    $0x40
+ 4d1:	c3                   	ret
+
+000004d2 <open>:
+SYSCALL(open)
+ 4d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d7:	cd 40                	int    $0x40
+ 4d9:	c3                   	ret
+
+000004da <mknod>:
+SYSCALL(mknod)
+ 4da:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <unlink>:
+SYSCALL(unlink)
+ 4e2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e7:	cd 40                	int    $0x40
+ 4e9:	c3                   	ret
+
+000004ea <fstat>:
+SYSCALL(fstat)
+ 4ea:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <link>:
+SYSCALL(link)
+ 4f2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4f7:	cd 40                	int    $0x40
+ 4f9:	c3                   	ret
+
+000004fa <mkdir>:
+SYSCALL(mkdir)
+ 4fa:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ff:	cd 40                	int    $0x40
+ 501:	c3                   	ret
+
+00000502 <chdir>:
+SYSCALL(chdir)
+ 502:	b8 09 00 00 00       	mov    $0x9,%eax
+ 507:	cd 40                	int    $0x40
+ 509:	c3                   	ret
+
+0000050a <dup>:
+SYSCALL(dup)
+ 50a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 50f:	cd 40                	int    $0x40
+ 511:	c3                   	ret
+
+00000512 <getpid>:
+SYSCALL(getpid)
+ 512:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 517:	cd 40                	int    $0x40
+ 519:	c3                   	ret
+
+0000051a <sbrk>:
+SYSCALL(sbrk)
+ 51a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <sleep>:
+SYSCALL(sleep)
+ 522:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 527:	cd 40                	int    $0x40
+ 529:	c3                   	ret
+
+0000052a <uptime>:
+SYSCALL(uptime)
+ 52a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 52f:	cd 40                	int    $0x40
+ 531:	c3                   	ret
+
+00000532 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 532:	b8 16 00 00 00       	mov    $0x16,%eax
+ 537:	cd 40                	int    $0x40
+ 539:	c3                   	ret
+
+0000053a <getschedstat>:
+SYSCALL(getschedstat)
+ 53a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 53f:	cd 40                	int    $0x40
+ 541:	c3                   	ret
+
+00000542 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 542:	b8 18 00 00 00       	mov    $0x18,%eax
+ 547:	cd 40                	int    $0x40
+ 549:	c3                   	ret
+
+0000054a <setshare>:
+SYSCALL(setshare)
+ 54a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 54f:	cd 40                	int    $0x40
+ 551:	c3                   	ret
+
+00000552 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 552:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 557:	cd 40                	int    $0x40
+ 559:	c3                   	ret
+
+0000055a <getdiskstat>:
+SYSCALL(getdiskstat)
+ 55a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 55f:	cd 40                	int    $0x40
+ 561:	c3                   	ret
+
+00000562 <getlogstat>:
+SYSCALL(getlogstat)
+ 562:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 567:	cd 40                	int    $0x40
+ 569:	c3                   	ret
+
+0000056a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 56a:	55                   	push   %ebp
+ 56b:	89 e5                	mov    %esp,%ebp
+ 56d:	83 ec 18             	sub    $0x18,%esp
+ 570:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 573:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 576:	83 ec 04             	sub    $0x4,%esp
+ 579:	6a 01                	push   $0x1
+ 57b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 57e:	50                   	push   %eax
+ 57f:	ff 75 08             	push   0x8(%ebp)
+ 582:	e8 2b ff ff ff       	call   4b2 <write>
+ 587:	83 c4 10             	add    $0x10,%esp
+}
+ 58a:	90                   	nop
+ 58b:	c9                   	leave
+ 58c:	c3                   	ret
+
+0000058d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 58d:	55                   	push   %ebp
+ 58e:	89 e5                	mov    %esp,%ebp
+ 590:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 593:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 59a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 59e:	74 17                	je     5b7 <printint+0x2a>
+ 5a0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5a4:	79 11                	jns    5b7 <printint+0x2a>
+    neg = 1;
+ 5a6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b0:	f7 d8                	neg    %eax
+ 5b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5b5:	eb 06                	jmp    5bd <printint+0x30>
+  } else {
+    x = xx;
+ 5b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5ca:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5cf:	f7 f1                	div    %ecx
+ 5d1:	89 d1                	mov    %edx,%ecx
+ 5d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d6:	8d 50 01             	lea    0x1(%eax),%edx
+ 5d9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5dc:	0f b6 91 58 0e 00 00 	movzbl 0xe58(%ecx),%edx
+ 5e3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5ed:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5f2:	f7 f1                	div    %ecx
+ 5f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5fb:	75 c7                	jne    5c4 <printint+0x37>
+  if(neg)
+ 5fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 601:	74 2d                	je     630 <printint+0xa3>
+    buf[i++] = '-';
+ 603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 606:	8d 50 01             	lea    0x1(%eax),%edx
+ 609:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 60c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 611:	eb 1d                	jmp    630 <printint+0xa3>
+    putc(fd, buf[i]);
+ 613:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 616:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 619:	01 d0                	add    %edx,%eax
+ 61b:	0f b6 00             	movzbl (%eax),%eax
+ 61e:	0f be c0             	movsbl %al,%eax
+ 621:	83 ec 08             	sub    $0x8,%esp
+ 624:	50                   	push   %eax
+ 625:	ff 75 08             	push   0x8(%ebp)
+ 628:	e8 3d ff ff ff       	call   56a <putc>
+ 62d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 630:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 634:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 638:	79 d9                	jns    613 <printint+0x86>
+}
+ 63a:	90                   	nop
+ 63b:	90                   	nop
+ 63c:	c9                   	leave
+ 63d:	c3                   	ret
+
+0000063e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 63e:	55                   	push   %ebp
+ 63f:	89 e5                	mov    %esp,%ebp
+ 641:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 644:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 64b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 64e:	83 c0 04             	add    $0x4,%eax
+ 651:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 654:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 65b:	e9 59 01 00 00       	jmp    7b9 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 660:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 663:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 666:	01 d0                	add    %edx,%eax
+ 668:	0f b6 00             	movzbl (%eax),%eax
+ 66b:	0f be c0             	movsbl %al,%eax
+ 66e:	25 ff 00 00 00       	and    $0xff,%eax
+ 673:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 676:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 67a:	75 2c                	jne    6a8 <printf+0x6a>
+      if(c == '%'){
+ 67c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 680:	75 0c                	jne    68e <printf+0x50>
+        state = '%';
+ 682:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 689:	e9 27 01 00 00       	jmp    7b5 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 68e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 691:	0f be c0             	movsbl %al,%eax
+ 694:	83 ec 08             	sub    $0x8,%esp
+ 697:	50                   	push   %eax
+ 698:	ff 75 08             	push   0x8(%ebp)
+ 69b:	e8 ca fe ff ff       	call   56a <putc>
+ 6a0:	83 c4 10             	add    $0x10,%esp
+ 6a3:	e9 0d 01 00 00       	jmp    7b5 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6a8:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6ac:	0f 85 03 01 00 00    	jne    7b5 <printf+0x177>
+      if(c == 'd'){
+ 6b2:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6b6:	75 1e                	jne    6d6 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6b8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6bb:	8b 00                	mov    (%eax),%eax
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	6a 0a                	push   $0xa
+ 6c1:	50                   	push   %eax
+ 6c2:	ff 75 08             	push   0x8(%ebp)
+ 6c5:	e8 c3 fe ff ff       	call   58d <printint>
+ 6ca:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6cd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6d1:	e9 d8 00 00 00       	jmp    7ae <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6d6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6da:	74 06                	je     6e2 <printf+0xa4>
+ 6dc:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6e0:	75 1e                	jne    700 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6e5:	8b 00                	mov    (%eax),%eax
+ 6e7:	6a 00                	push   $0x0
+ 6e9:	6a 10                	push   $0x10
+ 6eb:	50                   	push   %eax
+ 6ec:	ff 75 08             	push   0x8(%ebp)
+ 6ef:	e8 99 fe ff ff       	call   58d <printint>
+ 6f4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6f7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6fb:	e9 ae 00 00 00       	jmp    7ae <printf+0x170>
+      } else if(c == 's'){
+ 700:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 704:	75 43                	jne    749 <printf+0x10b>
+        s = (char*)*ap;
+ 706:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 709:	8b 00                	mov    (%eax),%eax
+ 70b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 70e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 712:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 716:	75 25                	jne    73d <printf+0xff>
+          s = "(null)";
+ 718:	c7 45 f4 0c 0b 00 00 	movl   $0xb0c,-0xc(%ebp)
+        while(*s != 0){
+ 71f:	eb 1c                	jmp    73d <printf+0xff>
+          putc(fd, *s);
+ 721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 724:	0f b6 00             	movzbl (%eax),%eax
+ 727:	0f be c0             	movsbl %al,%eax
+ 72a:	83 ec 08             	sub    $0x8,%esp
+ 72d:	50                   	push   %eax
+ 72e:	ff 75 08             	push   0x8(%ebp)
+ 731:	e8 34 fe ff ff       	call   56a <putc>
+ 736:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 739:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 73d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 740:	0f b6 00             	movzbl (%eax),%eax
+ 743:	84 c0                	test   %al,%al
+ 745:	75 da                	jne    721 <printf+0xe3>
+ 747:	eb 65                	jmp    7ae <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 749:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 74d:	75 1d                	jne    76c <printf+0x12e>
+        putc(fd, *ap);
+ 74f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 752:	8b 00                	mov    (%eax),%eax
+ 754:	0f be c0             	movsbl %al,%eax
+ 757:	83 ec 08             	sub    $0x8,%esp
+ 75a:	50                   	push   %eax
+ 75b:	ff 75 08             	push   0x8(%ebp)
+ 75e:	e8 07 fe ff ff       	call   56a <putc>
+ 763:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 766:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 76a:	eb 42                	jmp    7ae <printf+0x170>
+      } else if(c == '%'){
+ 76c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 770:	75 17                	jne    789 <printf+0x14b>
+        putc(fd, c);
+ 772:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 775:	0f be c0             	movsbl %al,%eax
+ 778:	83 ec 08             	sub    $0x8,%esp
+ 77b:	50                   	push   %eax
+ 77c:	ff 75 08             	push   0x8(%ebp)
+ 77f:	e8 e6 fd ff ff       	call   56a <putc>
+ 784:	83 c4 10             	add    $0x10,%esp
+ 787:	eb 25                	jmp    7ae <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 789:	83 ec 08             	sub    $0x8,%esp
+ 78c:	6a 25                	push   $0x25
+ 78e:	ff 75 08             	push   0x8(%ebp)
+ 791:	e8 d4 fd ff ff       	call   56a <putc>
+ 796:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 799:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 79c:	0f be c0             	movsbl %al,%eax
+ 79f:	83 ec 08             	sub    $0x8,%esp
+ 7a2:	50                   	push   %eax
+ 7a3:	ff 75 08             	push   0x8(%ebp)
+ 7a6:	e8 bf fd ff ff       	call   56a <putc>
+ 7ab:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7ae:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7b5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7bc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7bf:	01 d0                	add    %edx,%eax
+ 7c1:	0f b6 00             	movzbl (%eax),%eax
+ 7c4:	84 c0                	test   %al,%al
+ 7c6:	0f 85 94 fe ff ff    	jne    660 <printf+0x22>
+    }
+  }
+}
+ 7cc:	90                   	nop
+ 7cd:	90                   	nop
+ 7ce:	c9                   	leave
+ 7cf:	c3                   	ret
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d9:	83 e8 08             	sub    $0x8,%eax
+ 7dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7df:	a1 74 0e 00 00       	mov    0xe74,%eax
+ 7e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7e7:	eb 24                	jmp    80d <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ec:	8b 00                	mov    (%eax),%eax
+ 7ee:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7f1:	72 12                	jb     805 <free+0x35>
+ 7f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7f9:	72 24                	jb     81f <free+0x4f>
+ 7fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fe:	8b 00                	mov    (%eax),%eax
+ 800:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 803:	72 1a                	jb     81f <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 805:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 80d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 810:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 813:	73 d4                	jae    7e9 <free+0x19>
+ 815:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 81d:	73 ca                	jae    7e9 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 81f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 822:	8b 40 04             	mov    0x4(%eax),%eax
+ 825:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 82c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82f:	01 c2                	add    %eax,%edx
+ 831:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 834:	8b 00                	mov    (%eax),%eax
+ 836:	39 c2                	cmp    %eax,%edx
+ 838:	75 24                	jne    85e <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 83a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83d:	8b 50 04             	mov    0x4(%eax),%edx
+ 840:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 843:	8b 00                	mov    (%eax),%eax
+ 845:	8b 40 04             	mov    0x4(%eax),%eax
+ 848:	01 c2                	add    %eax,%edx
+ 84a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 84d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 850:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 853:	8b 00                	mov    (%eax),%eax
+ 855:	8b 10                	mov    (%eax),%edx
+ 857:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 85a:	89 10                	mov    %edx,(%eax)
+ 85c:	eb 0a                	jmp    868 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 85e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 861:	8b 10                	mov    (%eax),%edx
+ 863:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 866:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 868:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86b:	8b 40 04             	mov    0x4(%eax),%eax
+ 86e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 875:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 878:	01 d0                	add    %edx,%eax
+ 87a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 87d:	75 20                	jne    89f <free+0xcf>
+    p->s.size += bp->s.size;
+ 87f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 882:	8b 50 04             	mov    0x4(%eax),%edx
+ 885:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 888:	8b 40 04             	mov    0x4(%eax),%eax
+ 88b:	01 c2                	add    %eax,%edx
+ 88d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 890:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 893:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 896:	8b 10                	mov    (%eax),%edx
+ 898:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89b:	89 10                	mov    %edx,(%eax)
+ 89d:	eb 08                	jmp    8a7 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 89f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 8a5:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 8a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8aa:	a3 74 0e 00 00       	mov    %eax,0xe74
+}
+ 8af:	90                   	nop
+ 8b0:	c9                   	leave
+ 8b1:	c3                   	ret
+
+000008b2 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 8b2:	55                   	push   %ebp
+ 8b3:	89 e5                	mov    %esp,%ebp
+ 8b5:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 8b8:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 8bf:	77 07                	ja     8c8 <morecore+0x16>
+    nu = 4096;
+ 8c1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 8c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cb:	c1 e0 03             	shl    $0x3,%eax
+ 8ce:	83 ec 0c             	sub    $0xc,%esp
+ 8d1:	50                   	push   %eax
+ 8d2:	e8 43 fc ff ff       	call   51a <sbrk>
+ 8d7:	83 c4 10             	add    $0x10,%esp
+ 8da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 8dd:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 8e1:	75 07                	jne    8ea <morecore+0x38>
+    return 0;
+ 8e3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8e8:	eb 26                	jmp    910 <morecore+0x5e>
+  hp = (Header*)p;
+ 8ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 8f0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f3:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8f6:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8fc:	83 c0 08             	add    $0x8,%eax
+ 8ff:	83 ec 0c             	sub    $0xc,%esp
+ 902:	50                   	push   %eax
+ 903:	e8 c8 fe ff ff       	call   7d0 <free>
+ 908:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 90b:	a1 74 0e 00 00       	mov    0xe74,%eax
+}
+ 910:	c9                   	leave
+ 911:	c3                   	ret
+
+00000912 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 912:	55                   	push   %ebp
+ 913:	89 e5                	mov    %esp,%ebp
+ 915:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 918:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91b:	83 c0 07             	add    $0x7,%eax
+ 91e:	c1 e8 03             	shr    $0x3,%eax
+ 921:	83 c0 01             	add    $0x1,%eax
+ 924:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 927:	a1 74 0e 00 00       	mov    0xe74,%eax
+ 92c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 92f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 933:	75 23                	jne    958 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 935:	c7 45 f0 6c 0e 00 00 	movl   $0xe6c,-0x10(%ebp)
+ 93c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 93f:	a3 74 0e 00 00       	mov    %eax,0xe74
+ 944:	a1 74 0e 00 00       	mov    0xe74,%eax
+ 949:	a3 6c 0e 00 00       	mov    %eax,0xe6c
+    base.s.size = 0;
+ 94e:	c7 05 70 0e 00 00 00 	movl   $0x0,0xe70
+ 955:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 958:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95b:	8b 00                	mov    (%eax),%eax
+ 95d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 963:	8b 40 04             	mov    0x4(%eax),%eax
+ 966:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 969:	72 4d                	jb     9b8 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 96b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 96e:	8b 40 04             	mov    0x4(%eax),%eax
+ 971:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 974:	75 0c                	jne    982 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 979:	8b 10                	mov    (%eax),%edx
+ 97b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 97e:	89 10                	mov    %edx,(%eax)
+ 980:	eb 26                	jmp    9a8 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 985:	8b 40 04             	mov    0x4(%eax),%eax
+ 988:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 98b:	89 c2                	mov    %eax,%edx
+ 98d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 990:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 993:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 996:	8b 40 04             	mov    0x4(%eax),%eax
+ 999:	c1 e0 03             	shl    $0x3,%eax
+ 99c:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 9a5:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 9a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ab:	a3 74 0e 00 00       	mov    %eax,0xe74
+      return (void*)(p + 1);
+ 9b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9b3:	83 c0 08             	add    $0x8,%eax
+ 9b6:	eb 3b                	jmp    9f3 <malloc+0xe1>
+    }
+    if(p == freep)
+ 9b8:	a1 74 0e 00 00       	mov    0xe74,%eax
+ 9bd:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 9c0:	75 1e                	jne    9e0 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 9c2:	83 ec 0c             	sub    $0xc,%esp
+ 9c5:	ff 75 ec             	push   -0x14(%ebp)
+ 9c8:	e8 e5 fe ff ff       	call   8b2 <morecore>
+ 9cd:	83 c4 10             	add    $0x10,%esp
+ 9d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9d3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9d7:	75 07                	jne    9e0 <malloc+0xce>
+        return 0;
+ 9d9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9de:	eb 13                	jmp    9f3 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e9:	8b 00                	mov    (%eax),%eax
+ 9eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9ee:	e9 6d ff ff ff       	jmp    960 <malloc+0x4e>
+  }
+}
+ 9f3:	c9                   	leave
+ 9f4:	c3                   	ret
+
+000009f5 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 9f5:	55                   	push   %ebp
+ 9f6:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 9f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9fb:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 9fe:	7e 08                	jle    a08 <ticks+0x13>
+ a00:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a03:	2b 45 08             	sub    0x8(%ebp),%eax
+ a06:	eb 05                	jmp    a0d <ticks+0x18>
+ a08:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ a0d:	5d                   	pop    %ebp
+ a0e:	c3                   	ret
+
+00000a0f <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ a0f:	55                   	push   %ebp
+ a10:	89 e5                	mov    %esp,%ebp
+ a12:	53                   	push   %ebx
+ a13:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ a16:	8b 45 08             	mov    0x8(%ebp),%eax
+ a19:	6b d8 64             	imul   $0x64,%eax,%ebx
+ a1c:	ff 75 14             	push   0x14(%ebp)
+ a1f:	ff 75 10             	push   0x10(%ebp)
+ a22:	e8 ce ff ff ff       	call   9f5 <ticks>
+ a27:	83 c4 08             	add    $0x8,%esp
+ a2a:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ a2c:	89 d8                	mov    %ebx,%eax
+ a2e:	99                   	cltd
+ a2f:	f7 f9                	idiv   %ecx
+ a31:	89 c2                	mov    %eax,%edx
+ a33:	8b 45 14             	mov    0x14(%ebp),%eax
+ a36:	2b 45 10             	sub    0x10(%ebp),%eax
+ a39:	83 ec 04             	sub    $0x4,%esp
+ a3c:	ff 75 0c             	push   0xc(%ebp)
+ a3f:	52                   	push   %edx
+ a40:	50                   	push   %eax
+ a41:	ff 75 0c             	push   0xc(%ebp)
+ a44:	ff 75 08             	push   0x8(%ebp)
+ a47:	68 14 0b 00 00       	push   $0xb14
+ a4c:	6a 01                	push   $0x1
+ a4e:	e8 eb fb ff ff       	call   63e <printf>
+ a53:	83 c4 20             	add    $0x20,%esp
+}
+ a56:	90                   	nop
+ a57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a5a:	c9                   	leave
+ a5b:	c3                   	ret
+
+00000a5c <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ a5c:	55                   	push   %ebp
+ a5d:	89 e5                	mov    %esp,%ebp
+ a5f:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ a62:	ff 75 14             	push   0x14(%ebp)
+ a65:	ff 75 10             	push   0x10(%ebp)
+ a68:	e8 88 ff ff ff       	call   9f5 <ticks>
+ a6d:	83 c4 08             	add    $0x8,%esp
+ a70:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ a76:	99                   	cltd
+ a77:	f7 7d 08             	idivl  0x8(%ebp)
+ a7a:	89 c2                	mov    %eax,%edx
+ a7c:	8b 45 14             	mov    0x14(%ebp),%eax
+ a7f:	2b 45 10             	sub    0x10(%ebp),%eax
+ a82:	83 ec 08             	sub    $0x8,%esp
+ a85:	52                   	push   %edx
+ a86:	50                   	push   %eax
+ a87:	ff 75 0c             	push   0xc(%ebp)
+ a8a:	ff 75 08             	push   0x8(%ebp)
+ a8d:	68 34 0b 00 00       	push   $0xb34
+ a92:	6a 01                	push   $0x1
+ a94:	e8 a5 fb ff ff       	call   63e <printf>
+ a99:	83 c4 20             	add    $0x20,%esp
+}
+ a9c:	90                   	nop
+ a9d:	c9                   	leave
+ a9e:	c3                   	ret
@@ -0,0 +1,97 @@
+// Context switch benchmark for the scheduler.
+//
+// Runs 1, 2, 4 and 8 pairs of processes that bounce a byte
+// back and forth over a pair of pipes.  Every round trip
+// blocks each side once.  The switch counts are the kernel's,
+// summed over all CPUs.  Boot with "make qemu CPUS=n" for n = 1, 2, 4, 8 to compare
+// how the scheduler scales with the number of CPUs.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "schedstat.h"
+
+#define NROUND 2000
+
+// Bounce a byte NROUND times between two processes.
+void
+pingpong(void)
+{
+  int p1[2], p2[2], i, pid;
+  char c;
+
+  if(pipe(p1) < 0 || pipe(p2) < 0){
+    printf(1, "schedbench: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "schedbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < NROUND; i++){
+      if(read(p1[0], &c, 1) != 1)
+        break;
+      write(p2[1], &c, 1);
+    }
+    exit();
+  }
+  c = 'x';
+  for(i = 0; i < NROUND; i++){
+    write(p1[1], &c, 1);
+    if(read(p2[0], &c, 1) != 1)
+      break;
+  }
+  wait();
+  exit();
+}
+
+// Return the number of context switches all CPUs have made.
+uint
+nswitch(void)
+{
+  struct schedstat st;
+  uint n;
+  int i;
+
+  n = 0;
+  for(i = 0; getschedstat(i, &st) == 0; i++)
+    n += st.nswitch;
+  return n;
+}
+
+// Run npair ping-pong pairs concurrently and report
+// context switches per second.
+void
+run(int npair)
+{
+  int i, t0, t1;
+  uint n0, n;
+
+  n0 = nswitch();
+  t0 = uptime();
+  for(i = 0; i < npair; i++){
+    if(fork() == 0)
+      pingpong();
+  }
+  for(i = 0; i < npair; i++)
+    wait();
+  t1 = uptime();
+  n = nswitch() - n0;
+
+  printf(1, "pairs %d: ", npair);
+  benchrate(n, "switches", t0, t1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int npair;
+
+  printf(1, "schedbench starting\n");
+  for(npair = 1; npair <= 8; npair *= 2)
+    run(npair);
+  printf(1, "schedbench done\n");
+  exit();
+}
@@ -0,0 +1,8 @@
+// Per-CPU scheduler statistics, returned by getschedstat().
+struct schedstat {
+  uint nswitch;     // Processes switched to by this CPU
+  uint nsteal;      // Processes stolen from another CPU's run queue
+  uint nstealfail;  // Steal attempts that found the victim empty
+  uint idleticks;   // Timer ticks that found the CPU idle
+  uint nrunnable;   // Processes waiting on this CPU's run queue
+};
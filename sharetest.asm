@@ -0,0 +1,1515 @@
+
+_sharetest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <spin>:
+
+// Wait for the go byte, then count loop iterations
+// for SPINTICKS ticks and report the count as spinner id.
+void
+spin(int id, int go, int out)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  uint n, end, r[2];
+  char c;
+
+  if(read(go, &c, 1) != 1)
+   6:	83 ec 04             	sub    $0x4,%esp
+   9:	6a 01                	push   $0x1
+   b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+   e:	50                   	push   %eax
+   f:	ff 75 0c             	push   0xc(%ebp)
+  12:	e8 27 05 00 00       	call   53e <read>
+  17:	83 c4 10             	add    $0x10,%esp
+  1a:	83 f8 01             	cmp    $0x1,%eax
+  1d:	74 05                	je     24 <spin+0x24>
+    exit();
+  1f:	e8 02 05 00 00       	call   526 <exit>
+  end = uptime() + SPINTICKS;
+  24:	e8 95 05 00 00       	call   5be <uptime>
+  29:	05 f4 01 00 00       	add    $0x1f4,%eax
+  2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(n = 0; ; n++)
+  31:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if((n & 0xfff) == 0 && uptime() >= end)
+  38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  40:	85 c0                	test   %eax,%eax
+  42:	75 0a                	jne    4e <spin+0x4e>
+  44:	e8 75 05 00 00       	call   5be <uptime>
+  49:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  4c:	73 06                	jae    54 <spin+0x54>
+  for(n = 0; ; n++)
+  4e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if((n & 0xfff) == 0 && uptime() >= end)
+  52:	eb e4                	jmp    38 <spin+0x38>
+      break;
+  54:	90                   	nop
+  r[0] = id;
+  55:	8b 45 08             	mov    0x8(%ebp),%eax
+  58:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  r[1] = n;
+  5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  write(out, r, sizeof(r));
+  61:	83 ec 04             	sub    $0x4,%esp
+  64:	6a 08                	push   $0x8
+  66:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  69:	50                   	push   %eax
+  6a:	ff 75 10             	push   0x10(%ebp)
+  6d:	e8 d4 04 00 00       	call   546 <write>
+  72:	83 c4 10             	add    $0x10,%esp
+  exit();
+  75:	e8 ac 04 00 00       	call   526 <exit>
+
+0000007a <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  7a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  7e:	83 e4 f0             	and    $0xfffffff0,%esp
+  81:	ff 71 fc             	push   -0x4(%ecx)
+  84:	55                   	push   %ebp
+  85:	89 e5                	mov    %esp,%ebp
+  87:	51                   	push   %ecx
+  88:	83 ec 44             	sub    $0x44,%esp
+  int go[2], out[2], i, old, pid, total;
+  uint n[NSPIN], r[2], sum;
+
+  printf(1, "sharetest starting\n");
+  8b:	83 ec 08             	sub    $0x8,%esp
+  8e:	68 34 0b 00 00       	push   $0xb34
+  93:	6a 01                	push   $0x1
+  95:	e8 38 06 00 00       	call   6d2 <printf>
+  9a:	83 c4 10             	add    $0x10,%esp
+  if(pipe(go) < 0 || pipe(out) < 0){
+  9d:	83 ec 0c             	sub    $0xc,%esp
+  a0:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  a3:	50                   	push   %eax
+  a4:	e8 8d 04 00 00       	call   536 <pipe>
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	85 c0                	test   %eax,%eax
+  ae:	78 13                	js     c3 <main+0x49>
+  b0:	83 ec 0c             	sub    $0xc,%esp
+  b3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  b6:	50                   	push   %eax
+  b7:	e8 7a 04 00 00       	call   536 <pipe>
+  bc:	83 c4 10             	add    $0x10,%esp
+  bf:	85 c0                	test   %eax,%eax
+  c1:	79 17                	jns    da <main+0x60>
+    printf(1, "sharetest: pipe failed\n");
+  c3:	83 ec 08             	sub    $0x8,%esp
+  c6:	68 48 0b 00 00       	push   $0xb48
+  cb:	6a 01                	push   $0x1
+  cd:	e8 00 06 00 00       	call   6d2 <printf>
+  d2:	83 c4 10             	add    $0x10,%esp
+    exit();
+  d5:	e8 4c 04 00 00       	call   526 <exit>
+  }
+  if((old = setschedpolicy(SCHED_STRIDE)) < 0){
+  da:	83 ec 0c             	sub    $0xc,%esp
+  dd:	6a 02                	push   $0x2
+  df:	e8 f2 04 00 00       	call   5d6 <setschedpolicy>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  ea:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  ee:	79 17                	jns    107 <main+0x8d>
+    printf(1, "sharetest: setschedpolicy failed\n");
+  f0:	83 ec 08             	sub    $0x8,%esp
+  f3:	68 60 0b 00 00       	push   $0xb60
+  f8:	6a 01                	push   $0x1
+  fa:	e8 d3 05 00 00       	call   6d2 <printf>
+  ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 102:	e8 1f 04 00 00       	call   526 <exit>
+  }
+
+  total = 0;
+ 107:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; i < NSPIN; i++){
+ 10e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 115:	e9 86 00 00 00       	jmp    1a0 <main+0x126>
+    total += tickets[i];
+ 11a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 11d:	8b 04 85 14 0f 00 00 	mov    0xf14(,%eax,4),%eax
+ 124:	01 45 f0             	add    %eax,-0x10(%ebp)
+    pid = fork();
+ 127:	e8 f2 03 00 00       	call   51e <fork>
+ 12c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(pid < 0){
+ 12f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 133:	79 17                	jns    14c <main+0xd2>
+      printf(1, "sharetest: fork failed\n");
+ 135:	83 ec 08             	sub    $0x8,%esp
+ 138:	68 82 0b 00 00       	push   $0xb82
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 8e 05 00 00       	call   6d2 <printf>
+ 144:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 147:	e8 da 03 00 00       	call   526 <exit>
+    }
+    if(pid == 0)
+ 14c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 150:	75 16                	jne    168 <main+0xee>
+      spin(i, go[0], out[1]);
+ 152:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 155:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 158:	83 ec 04             	sub    $0x4,%esp
+ 15b:	52                   	push   %edx
+ 15c:	50                   	push   %eax
+ 15d:	ff 75 f4             	push   -0xc(%ebp)
+ 160:	e8 9b fe ff ff       	call   0 <spin>
+ 165:	83 c4 10             	add    $0x10,%esp
+    if(setshare(pid, tickets[i]) < 0){
+ 168:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16b:	8b 04 85 14 0f 00 00 	mov    0xf14(,%eax,4),%eax
+ 172:	83 ec 08             	sub    $0x8,%esp
+ 175:	50                   	push   %eax
+ 176:	ff 75 e4             	push   -0x1c(%ebp)
+ 179:	e8 60 04 00 00       	call   5de <setshare>
+ 17e:	83 c4 10             	add    $0x10,%esp
+ 181:	85 c0                	test   %eax,%eax
+ 183:	79 17                	jns    19c <main+0x122>
+      printf(1, "sharetest: setshare failed\n");
+ 185:	83 ec 08             	sub    $0x8,%esp
+ 188:	68 9a 0b 00 00       	push   $0xb9a
+ 18d:	6a 01                	push   $0x1
+ 18f:	e8 3e 05 00 00       	call   6d2 <printf>
+ 194:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 197:	e8 8a 03 00 00       	call   526 <exit>
+  for(i = 0; i < NSPIN; i++){
+ 19c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1a0:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 1a4:	0f 8e 70 ff ff ff    	jle    11a <main+0xa0>
+    }
+  }
+
+  // Start all spinners together.
+  for(i = 0; i < NSPIN; i++)
+ 1aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1b1:	eb 1a                	jmp    1cd <main+0x153>
+    write(go[1], "x", 1);
+ 1b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1b6:	83 ec 04             	sub    $0x4,%esp
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	68 b6 0b 00 00       	push   $0xbb6
+ 1c0:	50                   	push   %eax
+ 1c1:	e8 80 03 00 00       	call   546 <write>
+ 1c6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSPIN; i++)
+ 1c9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1cd:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 1d1:	7e e0                	jle    1b3 <main+0x139>
+  sum = 0;
+ 1d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; i < NSPIN; i++){
+ 1da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1e1:	eb 4d                	jmp    230 <main+0x1b6>
+    if(read(out[0], r, sizeof(r)) != sizeof(r) || r[0] >= NSPIN){
+ 1e3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1e6:	83 ec 04             	sub    $0x4,%esp
+ 1e9:	6a 08                	push   $0x8
+ 1eb:	8d 55 c0             	lea    -0x40(%ebp),%edx
+ 1ee:	52                   	push   %edx
+ 1ef:	50                   	push   %eax
+ 1f0:	e8 49 03 00 00       	call   53e <read>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+ 1f8:	83 f8 08             	cmp    $0x8,%eax
+ 1fb:	75 08                	jne    205 <main+0x18b>
+ 1fd:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 200:	83 f8 02             	cmp    $0x2,%eax
+ 203:	76 17                	jbe    21c <main+0x1a2>
+      printf(1, "sharetest: read failed\n");
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	68 b8 0b 00 00       	push   $0xbb8
+ 20d:	6a 01                	push   $0x1
+ 20f:	e8 be 04 00 00       	call   6d2 <printf>
+ 214:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 217:	e8 0a 03 00 00       	call   526 <exit>
+    }
+    n[r[0]] = r[1];
+ 21c:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 21f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 222:	89 54 85 c8          	mov    %edx,-0x38(%ebp,%eax,4)
+    sum += r[1];
+ 226:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 229:	01 45 ec             	add    %eax,-0x14(%ebp)
+  for(i = 0; i < NSPIN; i++){
+ 22c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 230:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 234:	7e ad                	jle    1e3 <main+0x169>
+  }
+  for(i = 0; i < NSPIN; i++)
+ 236:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 23d:	eb 09                	jmp    248 <main+0x1ce>
+    wait();
+ 23f:	e8 ea 02 00 00       	call   52e <wait>
+  for(i = 0; i < NSPIN; i++)
+ 244:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 248:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 24c:	7e f1                	jle    23f <main+0x1c5>
+  setschedpolicy(old);
+ 24e:	83 ec 0c             	sub    $0xc,%esp
+ 251:	ff 75 e8             	push   -0x18(%ebp)
+ 254:	e8 7d 03 00 00       	call   5d6 <setschedpolicy>
+ 259:	83 c4 10             	add    $0x10,%esp
+
+  sum = sum / 100 + 1;
+ 25c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 25f:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+ 264:	f7 e2                	mul    %edx
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	c1 e8 05             	shr    $0x5,%eax
+ 26b:	83 c0 01             	add    $0x1,%eax
+ 26e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < NSPIN; i++)
+ 271:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 278:	eb 4a                	jmp    2c4 <main+0x24a>
+    printf(1, "spinner %d: %d tickets, requested %d%% achieved %d%%\n",
+           i, tickets[i], tickets[i] * 100 / total, n[i] / sum);
+ 27a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 27d:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    printf(1, "spinner %d: %d tickets, requested %d%% achieved %d%%\n",
+ 281:	ba 00 00 00 00       	mov    $0x0,%edx
+ 286:	f7 75 ec             	divl   -0x14(%ebp)
+ 289:	89 c1                	mov    %eax,%ecx
+           i, tickets[i], tickets[i] * 100 / total, n[i] / sum);
+ 28b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 28e:	8b 04 85 14 0f 00 00 	mov    0xf14(,%eax,4),%eax
+ 295:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "spinner %d: %d tickets, requested %d%% achieved %d%%\n",
+ 298:	99                   	cltd
+ 299:	f7 7d f0             	idivl  -0x10(%ebp)
+ 29c:	89 c2                	mov    %eax,%edx
+ 29e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a1:	8b 04 85 14 0f 00 00 	mov    0xf14(,%eax,4),%eax
+ 2a8:	83 ec 08             	sub    $0x8,%esp
+ 2ab:	51                   	push   %ecx
+ 2ac:	52                   	push   %edx
+ 2ad:	50                   	push   %eax
+ 2ae:	ff 75 f4             	push   -0xc(%ebp)
+ 2b1:	68 d0 0b 00 00       	push   $0xbd0
+ 2b6:	6a 01                	push   $0x1
+ 2b8:	e8 15 04 00 00       	call   6d2 <printf>
+ 2bd:	83 c4 20             	add    $0x20,%esp
+  for(i = 0; i < NSPIN; i++)
+ 2c0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2c4:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 2c8:	7e b0                	jle    27a <main+0x200>
+  exit();
+ 2ca:	e8 57 02 00 00       	call   526 <exit>
+
+000002cf <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2cf:	55                   	push   %ebp
+ 2d0:	89 e5                	mov    %esp,%ebp
+ 2d2:	57                   	push   %edi
+ 2d3:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d7:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2dd:	89 cb                	mov    %ecx,%ebx
+ 2df:	89 df                	mov    %ebx,%edi
+ 2e1:	89 d1                	mov    %edx,%ecx
+ 2e3:	fc                   	cld
+ 2e4:	f3 aa                	rep stos %al,%es:(%edi)
+ 2e6:	89 ca                	mov    %ecx,%edx
+ 2e8:	89 fb                	mov    %edi,%ebx
+ 2ea:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2ed:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 2f0:	90                   	nop
+ 2f1:	5b                   	pop    %ebx
+ 2f2:	5f                   	pop    %edi
+ 2f3:	5d                   	pop    %ebp
+ 2f4:	c3                   	ret
+
+000002f5 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2f5:	55                   	push   %ebp
+ 2f6:	89 e5                	mov    %esp,%ebp
+ 2f8:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 2fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 301:	90                   	nop
+ 302:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 305:	8d 42 01             	lea    0x1(%edx),%eax
+ 308:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 30b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 311:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 314:	0f b6 12             	movzbl (%edx),%edx
+ 317:	88 10                	mov    %dl,(%eax)
+ 319:	0f b6 00             	movzbl (%eax),%eax
+ 31c:	84 c0                	test   %al,%al
+ 31e:	75 e2                	jne    302 <strcpy+0xd>
+    ;
+  return os;
+ 320:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+
+00000325 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 325:	55                   	push   %ebp
+ 326:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 328:	eb 08                	jmp    332 <strcmp+0xd>
+    p++, q++;
+ 32a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 32e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 332:	8b 45 08             	mov    0x8(%ebp),%eax
+ 335:	0f b6 00             	movzbl (%eax),%eax
+ 338:	84 c0                	test   %al,%al
+ 33a:	74 10                	je     34c <strcmp+0x27>
+ 33c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33f:	0f b6 10             	movzbl (%eax),%edx
+ 342:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 345:	0f b6 00             	movzbl (%eax),%eax
+ 348:	38 c2                	cmp    %al,%dl
+ 34a:	74 de                	je     32a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 34c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34f:	0f b6 00             	movzbl (%eax),%eax
+ 352:	0f b6 d0             	movzbl %al,%edx
+ 355:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	0f b6 c0             	movzbl %al,%eax
+ 35e:	29 c2                	sub    %eax,%edx
+ 360:	89 d0                	mov    %edx,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+
+00000364 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 36a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 371:	eb 04                	jmp    377 <strlen+0x13>
+ 373:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 377:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 37a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37d:	01 d0                	add    %edx,%eax
+ 37f:	0f b6 00             	movzbl (%eax),%eax
+ 382:	84 c0                	test   %al,%al
+ 384:	75 ed                	jne    373 <strlen+0xf>
+    ;
+  return n;
+ 386:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 389:	c9                   	leave
+ 38a:	c3                   	ret
+
+0000038b <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 38b:	55                   	push   %ebp
+ 38c:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 38e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 391:	50                   	push   %eax
+ 392:	ff 75 0c             	push   0xc(%ebp)
+ 395:	ff 75 08             	push   0x8(%ebp)
+ 398:	e8 32 ff ff ff       	call   2cf <stosb>
+ 39d:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3a0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+
+000003a5 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3a5:	55                   	push   %ebp
+ 3a6:	89 e5                	mov    %esp,%ebp
+ 3a8:	83 ec 04             	sub    $0x4,%esp
+ 3ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ae:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3b1:	eb 14                	jmp    3c7 <strchr+0x22>
+    if(*s == c)
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 00             	movzbl (%eax),%eax
+ 3b9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3bc:	75 05                	jne    3c3 <strchr+0x1e>
+      return (char*)s;
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c1:	eb 13                	jmp    3d6 <strchr+0x31>
+  for(; *s; s++)
+ 3c3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ca:	0f b6 00             	movzbl (%eax),%eax
+ 3cd:	84 c0                	test   %al,%al
+ 3cf:	75 e2                	jne    3b3 <strchr+0xe>
+  return 0;
+ 3d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3d6:	c9                   	leave
+ 3d7:	c3                   	ret
+
+000003d8 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3d8:	55                   	push   %ebp
+ 3d9:	89 e5                	mov    %esp,%ebp
+ 3db:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3e5:	eb 42                	jmp    429 <gets+0x51>
+    cc = read(0, &c, 1);
+ 3e7:	83 ec 04             	sub    $0x4,%esp
+ 3ea:	6a 01                	push   $0x1
+ 3ec:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3ef:	50                   	push   %eax
+ 3f0:	6a 00                	push   $0x0
+ 3f2:	e8 47 01 00 00       	call   53e <read>
+ 3f7:	83 c4 10             	add    $0x10,%esp
+ 3fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 401:	7e 33                	jle    436 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 403:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 406:	8d 50 01             	lea    0x1(%eax),%edx
+ 409:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 40c:	89 c2                	mov    %eax,%edx
+ 40e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 411:	01 c2                	add    %eax,%edx
+ 413:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 417:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 419:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 41d:	3c 0a                	cmp    $0xa,%al
+ 41f:	74 16                	je     437 <gets+0x5f>
+ 421:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 425:	3c 0d                	cmp    $0xd,%al
+ 427:	74 0e                	je     437 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 42c:	83 c0 01             	add    $0x1,%eax
+ 42f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 432:	7f b3                	jg     3e7 <gets+0xf>
+ 434:	eb 01                	jmp    437 <gets+0x5f>
+      break;
+ 436:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 437:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 43a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43d:	01 d0                	add    %edx,%eax
+ 43f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 442:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 445:	c9                   	leave
+ 446:	c3                   	ret
+
+00000447 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 447:	55                   	push   %ebp
+ 448:	89 e5                	mov    %esp,%ebp
+ 44a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 44d:	83 ec 08             	sub    $0x8,%esp
+ 450:	6a 00                	push   $0x0
+ 452:	ff 75 08             	push   0x8(%ebp)
+ 455:	e8 0c 01 00 00       	call   566 <open>
+ 45a:	83 c4 10             	add    $0x10,%esp
+ 45d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 460:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 464:	79 07                	jns    46d <stat+0x26>
+    return -1;
+ 466:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 46b:	eb 25                	jmp    492 <stat+0x4b>
+  r = fstat(fd, st);
+ 46d:	83 ec 08             	sub    $0x8,%esp
+ 470:	ff 75 0c             	push   0xc(%ebp)
+ 473:	ff 75 f4             	push   -0xc(%ebp)
+ 476:	e8 03 01 00 00       	call   57e <fstat>
+ 47b:	83 c4 10             	add    $0x10,%esp
+ 47e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 481:	83 ec 0c             	sub    $0xc,%esp
+ 484:	ff 75 f4             	push   -0xc(%ebp)
+ 487:	e8 c2 00 00 00       	call   54e <close>
+ 48c:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 48f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 492:	c9                   	leave
+ 493:	c3                   	ret
+
+00000494 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 494:	55                   	push   %ebp
+ 495:	89 e5                	mov    %esp,%ebp
+ 497:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 49a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4a1:	eb 25                	jmp    4c8 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4a3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	c1 e0 02             	shl    $0x2,%eax
+ 4ab:	01 d0                	add    %edx,%eax
+ 4ad:	01 c0                	add    %eax,%eax
+ 4af:	89 c1                	mov    %eax,%ecx
+ 4b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b4:	8d 50 01             	lea    0x1(%eax),%edx
+ 4b7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4ba:	0f b6 00             	movzbl (%eax),%eax
+ 4bd:	0f be c0             	movsbl %al,%eax
+ 4c0:	01 c8                	add    %ecx,%eax
+ 4c2:	83 e8 30             	sub    $0x30,%eax
+ 4c5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cb:	0f b6 00             	movzbl (%eax),%eax
+ 4ce:	3c 2f                	cmp    $0x2f,%al
+ 4d0:	7e 0a                	jle    4dc <atoi+0x48>
+ 4d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d5:	0f b6 00             	movzbl (%eax),%eax
+ 4d8:	3c 39                	cmp    $0x39,%al
+ 4da:	7e c7                	jle    4a3 <atoi+0xf>
+  return n;
+ 4dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4df:	c9                   	leave
+ 4e0:	c3                   	ret
+
+000004e1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4e1:	55                   	push   %ebp
+ 4e2:	89 e5                	mov    %esp,%ebp
+ 4e4:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 4e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ea:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4f0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4f3:	eb 17                	jmp    50c <memmove+0x2b>
+    *dst++ = *src++;
+ 4f5:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4f8:	8d 42 01             	lea    0x1(%edx),%eax
+ 4fb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 501:	8d 48 01             	lea    0x1(%eax),%ecx
+ 504:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 507:	0f b6 12             	movzbl (%edx),%edx
+ 50a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 50c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 50f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 512:	89 55 10             	mov    %edx,0x10(%ebp)
+ 515:	85 c0                	test   %eax,%eax
+ 517:	7f dc                	jg     4f5 <memmove+0x14>
+  return vdst;
+ 519:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 51c:	c9                   	leave
+ 51d:	c3                   	ret
+
+0000051e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 51e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <exit>:
+SYSCALL(exit)
+ 526:	b8 02 00 00 00       	mov    $0x2,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <wait>:
+SYSCALL(wait)
+ 52e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <pipe>:
+SYSCALL(pipe)
+ 536:	b8 04 00 00 00       	mov    $0x4,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <read>:
+SYSCALL(read)
+ 53e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <write>:
+SYSCALL(write)
+ 546:	b8 10 00 00 00       	mov    $0x10,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <close>:
+SYSCALL(close)
+ 54e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <kill>:
+SYSCALL(kill)
+ 556:	b8 06 00 00 00       	mov    $0x6,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <exec>:
+SYSCALL(exec)
+ 55e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <open>:
+SYSCALL(open)
+ 566:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <mknod>:
+SYSCALL(mknod)
+ 56e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <unlink>:
+SYSCALL(unlink)
+ 576:	b8 12 00 00 00       	mov    $0x12,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <fstat>:
+SYSCALL(fstat)
+ 57e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <link>:
+SYSCALL(link)
+ 586:	b8 13 00 00 00       	mov    $0x13,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <mkdir>:
+SYSCALL(mkdir)
+ 58e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <chdir>:
+SYSCALL(chdir)
+ 596:	b8 09 00 00 00       	mov    $0x9,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <dup>:
+SYSCALL(dup)
+ 59e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <getpid>:
+SYSCALL(getpid)
+ 5a6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <sbrk>:
+SYSCALL(sbrk)
+ 5ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <sleep>:
+SYSCALL(sleep)
+ 5b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <uptime>:
+SYSCALL(uptime)
+ 5be:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 5c6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <getschedstat>:
+SYSCALL(getschedstat)
+ 5ce:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 5d6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <setshare>:
+SYSCALL(setshare)
+ 5de:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 5e6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <getdiskstat>:
+SYSCALL(getdiskstat)
+ 5ee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <getlogstat>:
+SYSCALL(getlogstat)
+ 5f6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5fe:	55                   	push   %ebp
+ 5ff:	89 e5                	mov    %esp,%ebp
+ 601:	83 ec 18             	sub    $0x18,%esp
+ 604:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 607:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 60a:	83 ec 04             	sub    $0x4,%esp
+ 60d:	6a 01                	push   $0x1
+ 60f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 612:	50                   	push   %eax
+ 613:	ff 75 08             	push   0x8(%ebp)
+ 616:	e8 2b ff ff ff       	call   546 <write>
+ 61b:	83 c4 10             	add    $0x10,%esp
+}
+ 61e:	90                   	nop
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+
+00000621 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 621:	55                   	push   %ebp
+ 622:	89 e5                	mov    %esp,%ebp
+ 624:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 627:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 62e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 632:	74 17                	je     64b <printint+0x2a>
+ 634:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 638:	79 11                	jns    64b <printint+0x2a>
+    neg = 1;
+ 63a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 641:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 644:	f7 d8                	neg    %eax
+ 646:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 649:	eb 06                	jmp    651 <printint+0x30>
+  } else {
+    x = xx;
+ 64b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 64e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 651:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 658:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 65b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 65e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 663:	f7 f1                	div    %ecx
+ 665:	89 d1                	mov    %edx,%ecx
+ 667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 66a:	8d 50 01             	lea    0x1(%eax),%edx
+ 66d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 670:	0f b6 91 20 0f 00 00 	movzbl 0xf20(%ecx),%edx
+ 677:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 67b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 67e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 681:	ba 00 00 00 00       	mov    $0x0,%edx
+ 686:	f7 f1                	div    %ecx
+ 688:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 68b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 68f:	75 c7                	jne    658 <printint+0x37>
+  if(neg)
+ 691:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 695:	74 2d                	je     6c4 <printint+0xa3>
+    buf[i++] = '-';
+ 697:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 69a:	8d 50 01             	lea    0x1(%eax),%edx
+ 69d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6a0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6a5:	eb 1d                	jmp    6c4 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6a7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ad:	01 d0                	add    %edx,%eax
+ 6af:	0f b6 00             	movzbl (%eax),%eax
+ 6b2:	0f be c0             	movsbl %al,%eax
+ 6b5:	83 ec 08             	sub    $0x8,%esp
+ 6b8:	50                   	push   %eax
+ 6b9:	ff 75 08             	push   0x8(%ebp)
+ 6bc:	e8 3d ff ff ff       	call   5fe <putc>
+ 6c1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 6c4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 6c8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6cc:	79 d9                	jns    6a7 <printint+0x86>
+}
+ 6ce:	90                   	nop
+ 6cf:	90                   	nop
+ 6d0:	c9                   	leave
+ 6d1:	c3                   	ret
+
+000006d2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 6d2:	55                   	push   %ebp
+ 6d3:	89 e5                	mov    %esp,%ebp
+ 6d5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 6d8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6df:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6e2:	83 c0 04             	add    $0x4,%eax
+ 6e5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6ef:	e9 59 01 00 00       	jmp    84d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6fa:	01 d0                	add    %edx,%eax
+ 6fc:	0f b6 00             	movzbl (%eax),%eax
+ 6ff:	0f be c0             	movsbl %al,%eax
+ 702:	25 ff 00 00 00       	and    $0xff,%eax
+ 707:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 70a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 70e:	75 2c                	jne    73c <printf+0x6a>
+      if(c == '%'){
+ 710:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 714:	75 0c                	jne    722 <printf+0x50>
+        state = '%';
+ 716:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 71d:	e9 27 01 00 00       	jmp    849 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 722:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 725:	0f be c0             	movsbl %al,%eax
+ 728:	83 ec 08             	sub    $0x8,%esp
+ 72b:	50                   	push   %eax
+ 72c:	ff 75 08             	push   0x8(%ebp)
+ 72f:	e8 ca fe ff ff       	call   5fe <putc>
+ 734:	83 c4 10             	add    $0x10,%esp
+ 737:	e9 0d 01 00 00       	jmp    849 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 73c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 740:	0f 85 03 01 00 00    	jne    849 <printf+0x177>
+      if(c == 'd'){
+ 746:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 74a:	75 1e                	jne    76a <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 74c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 74f:	8b 00                	mov    (%eax),%eax
+ 751:	6a 01                	push   $0x1
+ 753:	6a 0a                	push   $0xa
+ 755:	50                   	push   %eax
+ 756:	ff 75 08             	push   0x8(%ebp)
+ 759:	e8 c3 fe ff ff       	call   621 <printint>
+ 75e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 761:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 765:	e9 d8 00 00 00       	jmp    842 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 76a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 76e:	74 06                	je     776 <printf+0xa4>
+ 770:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 774:	75 1e                	jne    794 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 776:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 779:	8b 00                	mov    (%eax),%eax
+ 77b:	6a 00                	push   $0x0
+ 77d:	6a 10                	push   $0x10
+ 77f:	50                   	push   %eax
+ 780:	ff 75 08             	push   0x8(%ebp)
+ 783:	e8 99 fe ff ff       	call   621 <printint>
+ 788:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 78b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 78f:	e9 ae 00 00 00       	jmp    842 <printf+0x170>
+      } else if(c == 's'){
+ 794:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 798:	75 43                	jne    7dd <printf+0x10b>
+        s = (char*)*ap;
+ 79a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79d:	8b 00                	mov    (%eax),%eax
+ 79f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7a2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7a6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7aa:	75 25                	jne    7d1 <printf+0xff>
+          s = "(null)";
+ 7ac:	c7 45 f4 06 0c 00 00 	movl   $0xc06,-0xc(%ebp)
+        while(*s != 0){
+ 7b3:	eb 1c                	jmp    7d1 <printf+0xff>
+          putc(fd, *s);
+ 7b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b8:	0f b6 00             	movzbl (%eax),%eax
+ 7bb:	0f be c0             	movsbl %al,%eax
+ 7be:	83 ec 08             	sub    $0x8,%esp
+ 7c1:	50                   	push   %eax
+ 7c2:	ff 75 08             	push   0x8(%ebp)
+ 7c5:	e8 34 fe ff ff       	call   5fe <putc>
+ 7ca:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 7cd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 7d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d4:	0f b6 00             	movzbl (%eax),%eax
+ 7d7:	84 c0                	test   %al,%al
+ 7d9:	75 da                	jne    7b5 <printf+0xe3>
+ 7db:	eb 65                	jmp    842 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7dd:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7e1:	75 1d                	jne    800 <printf+0x12e>
+        putc(fd, *ap);
+ 7e3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e6:	8b 00                	mov    (%eax),%eax
+ 7e8:	0f be c0             	movsbl %al,%eax
+ 7eb:	83 ec 08             	sub    $0x8,%esp
+ 7ee:	50                   	push   %eax
+ 7ef:	ff 75 08             	push   0x8(%ebp)
+ 7f2:	e8 07 fe ff ff       	call   5fe <putc>
+ 7f7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7fa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7fe:	eb 42                	jmp    842 <printf+0x170>
+      } else if(c == '%'){
+ 800:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 804:	75 17                	jne    81d <printf+0x14b>
+        putc(fd, c);
+ 806:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 809:	0f be c0             	movsbl %al,%eax
+ 80c:	83 ec 08             	sub    $0x8,%esp
+ 80f:	50                   	push   %eax
+ 810:	ff 75 08             	push   0x8(%ebp)
+ 813:	e8 e6 fd ff ff       	call   5fe <putc>
+ 818:	83 c4 10             	add    $0x10,%esp
+ 81b:	eb 25                	jmp    842 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 81d:	83 ec 08             	sub    $0x8,%esp
+ 820:	6a 25                	push   $0x25
+ 822:	ff 75 08             	push   0x8(%ebp)
+ 825:	e8 d4 fd ff ff       	call   5fe <putc>
+ 82a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 82d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 830:	0f be c0             	movsbl %al,%eax
+ 833:	83 ec 08             	sub    $0x8,%esp
+ 836:	50                   	push   %eax
+ 837:	ff 75 08             	push   0x8(%ebp)
+ 83a:	e8 bf fd ff ff       	call   5fe <putc>
+ 83f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 842:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 849:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 84d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 850:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 853:	01 d0                	add    %edx,%eax
+ 855:	0f b6 00             	movzbl (%eax),%eax
+ 858:	84 c0                	test   %al,%al
+ 85a:	0f 85 94 fe ff ff    	jne    6f4 <printf+0x22>
+    }
+  }
+}
+ 860:	90                   	nop
+ 861:	90                   	nop
+ 862:	c9                   	leave
+ 863:	c3                   	ret
+
+00000864 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 864:	55                   	push   %ebp
+ 865:	89 e5                	mov    %esp,%ebp
+ 867:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 86a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86d:	83 e8 08             	sub    $0x8,%eax
+ 870:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 873:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ 878:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 87b:	eb 24                	jmp    8a1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 87d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 880:	8b 00                	mov    (%eax),%eax
+ 882:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 885:	72 12                	jb     899 <free+0x35>
+ 887:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 88a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 88d:	72 24                	jb     8b3 <free+0x4f>
+ 88f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 892:	8b 00                	mov    (%eax),%eax
+ 894:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 897:	72 1a                	jb     8b3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 899:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 89c:	8b 00                	mov    (%eax),%eax
+ 89e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8a4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8a7:	73 d4                	jae    87d <free+0x19>
+ 8a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ac:	8b 00                	mov    (%eax),%eax
+ 8ae:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8b1:	73 ca                	jae    87d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8b6:	8b 40 04             	mov    0x4(%eax),%eax
+ 8b9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 8c0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8c3:	01 c2                	add    %eax,%edx
+ 8c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8c8:	8b 00                	mov    (%eax),%eax
+ 8ca:	39 c2                	cmp    %eax,%edx
+ 8cc:	75 24                	jne    8f2 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 8ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8d1:	8b 50 04             	mov    0x4(%eax),%edx
+ 8d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d7:	8b 00                	mov    (%eax),%eax
+ 8d9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8dc:	01 c2                	add    %eax,%edx
+ 8de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8e1:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e7:	8b 00                	mov    (%eax),%eax
+ 8e9:	8b 10                	mov    (%eax),%edx
+ 8eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ee:	89 10                	mov    %edx,(%eax)
+ 8f0:	eb 0a                	jmp    8fc <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 8f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f5:	8b 10                	mov    (%eax),%edx
+ 8f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8fa:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 8fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ff:	8b 40 04             	mov    0x4(%eax),%eax
+ 902:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 909:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90c:	01 d0                	add    %edx,%eax
+ 90e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 911:	75 20                	jne    933 <free+0xcf>
+    p->s.size += bp->s.size;
+ 913:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 916:	8b 50 04             	mov    0x4(%eax),%edx
+ 919:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 91c:	8b 40 04             	mov    0x4(%eax),%eax
+ 91f:	01 c2                	add    %eax,%edx
+ 921:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 924:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 927:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 92a:	8b 10                	mov    (%eax),%edx
+ 92c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 92f:	89 10                	mov    %edx,(%eax)
+ 931:	eb 08                	jmp    93b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 933:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 936:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 939:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 93b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 93e:	a3 3c 0f 00 00       	mov    %eax,0xf3c
+}
+ 943:	90                   	nop
+ 944:	c9                   	leave
+ 945:	c3                   	ret
+
+00000946 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 946:	55                   	push   %ebp
+ 947:	89 e5                	mov    %esp,%ebp
+ 949:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 94c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 953:	77 07                	ja     95c <morecore+0x16>
+    nu = 4096;
+ 955:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 95c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 95f:	c1 e0 03             	shl    $0x3,%eax
+ 962:	83 ec 0c             	sub    $0xc,%esp
+ 965:	50                   	push   %eax
+ 966:	e8 43 fc ff ff       	call   5ae <sbrk>
+ 96b:	83 c4 10             	add    $0x10,%esp
+ 96e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 971:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 975:	75 07                	jne    97e <morecore+0x38>
+    return 0;
+ 977:	b8 00 00 00 00       	mov    $0x0,%eax
+ 97c:	eb 26                	jmp    9a4 <morecore+0x5e>
+  hp = (Header*)p;
+ 97e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 981:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 984:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 987:	8b 55 08             	mov    0x8(%ebp),%edx
+ 98a:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 98d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 990:	83 c0 08             	add    $0x8,%eax
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	50                   	push   %eax
+ 997:	e8 c8 fe ff ff       	call   864 <free>
+ 99c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 99f:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+}
+ 9a4:	c9                   	leave
+ 9a5:	c3                   	ret
+
+000009a6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 9a6:	55                   	push   %ebp
+ 9a7:	89 e5                	mov    %esp,%ebp
+ 9a9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9af:	83 c0 07             	add    $0x7,%eax
+ 9b2:	c1 e8 03             	shr    $0x3,%eax
+ 9b5:	83 c0 01             	add    $0x1,%eax
+ 9b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 9bb:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ 9c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9c3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9c7:	75 23                	jne    9ec <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 9c9:	c7 45 f0 34 0f 00 00 	movl   $0xf34,-0x10(%ebp)
+ 9d0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d3:	a3 3c 0f 00 00       	mov    %eax,0xf3c
+ 9d8:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ 9dd:	a3 34 0f 00 00       	mov    %eax,0xf34
+    base.s.size = 0;
+ 9e2:	c7 05 38 0f 00 00 00 	movl   $0x0,0xf38
+ 9e9:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9ef:	8b 00                	mov    (%eax),%eax
+ 9f1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 9f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9f7:	8b 40 04             	mov    0x4(%eax),%eax
+ 9fa:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 9fd:	72 4d                	jb     a4c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 9ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a02:	8b 40 04             	mov    0x4(%eax),%eax
+ a05:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a08:	75 0c                	jne    a16 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0d:	8b 10                	mov    (%eax),%edx
+ a0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a12:	89 10                	mov    %edx,(%eax)
+ a14:	eb 26                	jmp    a3c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a19:	8b 40 04             	mov    0x4(%eax),%eax
+ a1c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a1f:	89 c2                	mov    %eax,%edx
+ a21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a24:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2a:	8b 40 04             	mov    0x4(%eax),%eax
+ a2d:	c1 e0 03             	shl    $0x3,%eax
+ a30:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a36:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a39:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a3c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3f:	a3 3c 0f 00 00       	mov    %eax,0xf3c
+      return (void*)(p + 1);
+ a44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a47:	83 c0 08             	add    $0x8,%eax
+ a4a:	eb 3b                	jmp    a87 <malloc+0xe1>
+    }
+    if(p == freep)
+ a4c:	a1 3c 0f 00 00       	mov    0xf3c,%eax
+ a51:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a54:	75 1e                	jne    a74 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ a56:	83 ec 0c             	sub    $0xc,%esp
+ a59:	ff 75 ec             	push   -0x14(%ebp)
+ a5c:	e8 e5 fe ff ff       	call   946 <morecore>
+ a61:	83 c4 10             	add    $0x10,%esp
+ a64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ a67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a6b:	75 07                	jne    a74 <malloc+0xce>
+        return 0;
+ a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+ a72:	eb 13                	jmp    a87 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a7a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7d:	8b 00                	mov    (%eax),%eax
+ a7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a82:	e9 6d ff ff ff       	jmp    9f4 <malloc+0x4e>
+  }
+}
+ a87:	c9                   	leave
+ a88:	c3                   	ret
+
+00000a89 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ a89:	55                   	push   %ebp
+ a8a:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ a8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a8f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ a92:	7e 08                	jle    a9c <ticks+0x13>
+ a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a97:	2b 45 08             	sub    0x8(%ebp),%eax
+ a9a:	eb 05                	jmp    aa1 <ticks+0x18>
+ a9c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ aa1:	5d                   	pop    %ebp
+ aa2:	c3                   	ret
+
+00000aa3 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ aa3:	55                   	push   %ebp
+ aa4:	89 e5                	mov    %esp,%ebp
+ aa6:	53                   	push   %ebx
+ aa7:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+ aad:	6b d8 64             	imul   $0x64,%eax,%ebx
+ ab0:	ff 75 14             	push   0x14(%ebp)
+ ab3:	ff 75 10             	push   0x10(%ebp)
+ ab6:	e8 ce ff ff ff       	call   a89 <ticks>
+ abb:	83 c4 08             	add    $0x8,%esp
+ abe:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ ac0:	89 d8                	mov    %ebx,%eax
+ ac2:	99                   	cltd
+ ac3:	f7 f9                	idiv   %ecx
+ ac5:	89 c2                	mov    %eax,%edx
+ ac7:	8b 45 14             	mov    0x14(%ebp),%eax
+ aca:	2b 45 10             	sub    0x10(%ebp),%eax
+ acd:	83 ec 04             	sub    $0x4,%esp
+ ad0:	ff 75 0c             	push   0xc(%ebp)
+ ad3:	52                   	push   %edx
+ ad4:	50                   	push   %eax
+ ad5:	ff 75 0c             	push   0xc(%ebp)
+ ad8:	ff 75 08             	push   0x8(%ebp)
+ adb:	68 10 0c 00 00       	push   $0xc10
+ ae0:	6a 01                	push   $0x1
+ ae2:	e8 eb fb ff ff       	call   6d2 <printf>
+ ae7:	83 c4 20             	add    $0x20,%esp
+}
+ aea:	90                   	nop
+ aeb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ aee:	c9                   	leave
+ aef:	c3                   	ret
+
+00000af0 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ af6:	ff 75 14             	push   0x14(%ebp)
+ af9:	ff 75 10             	push   0x10(%ebp)
+ afc:	e8 88 ff ff ff       	call   a89 <ticks>
+ b01:	83 c4 08             	add    $0x8,%esp
+ b04:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ b0a:	99                   	cltd
+ b0b:	f7 7d 08             	idivl  0x8(%ebp)
+ b0e:	89 c2                	mov    %eax,%edx
+ b10:	8b 45 14             	mov    0x14(%ebp),%eax
+ b13:	2b 45 10             	sub    0x10(%ebp),%eax
+ b16:	83 ec 08             	sub    $0x8,%esp
+ b19:	52                   	push   %edx
+ b1a:	50                   	push   %eax
+ b1b:	ff 75 0c             	push   0xc(%ebp)
+ b1e:	ff 75 08             	push   0x8(%ebp)
+ b21:	68 30 0c 00 00       	push   $0xc30
+ b26:	6a 01                	push   $0x1
+ b28:	e8 a5 fb ff ff       	call   6d2 <printf>
+ b2d:	83 c4 20             	add    $0x20,%esp
+}
+ b30:	90                   	nop
+ b31:	c9                   	leave
+ b32:	c3                   	ret
@@ -0,0 +1,89 @@
+// Test stride scheduling: run spinners with different
+// setshare() ticket counts under SCHED_STRIDE and compare
+// the CPU share each achieved with the share it requested.
+// Run on a single CPU ("make qemu CPUS=1") for exact shares.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NSPIN 3
+#define SPINTICKS 500
+
+int tickets[NSPIN] = { 100, 200, 300 };
+
+// Wait for the go byte, then count loop iterations
+// for SPINTICKS ticks and report the count as spinner id.
+void
+spin(int id, int go, int out)
+{
+  uint n, end, r[2];
+  char c;
+
+  if(read(go, &c, 1) != 1)
+    exit();
+  end = uptime() + SPINTICKS;
+  for(n = 0; ; n++)
+    if((n & 0xfff) == 0 && uptime() >= end)
+      break;
+  r[0] = id;
+  r[1] = n;
+  write(out, r, sizeof(r));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int go[2], out[2], i, old, pid, total;
+  uint n[NSPIN], r[2], sum;
+
+  printf(1, "sharetest starting\n");
+  if(pipe(go) < 0 || pipe(out) < 0){
+    printf(1, "sharetest: pipe failed\n");
+    exit();
+  }
+  if((old = setschedpolicy(SCHED_STRIDE)) < 0){
+    printf(1, "sharetest: setschedpolicy failed\n");
+    exit();
+  }
+
+  total = 0;
+  for(i = 0; i < NSPIN; i++){
+    total += tickets[i];
+    pid = fork();
+    if(pid < 0){
+      printf(1, "sharetest: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      spin(i, go[0], out[1]);
+    if(setshare(pid, tickets[i]) < 0){
+      printf(1, "sharetest: setshare failed\n");
+      exit();
+    }
+  }
+
+  // Start all spinners together.
+  for(i = 0; i < NSPIN; i++)
+    write(go[1], "x", 1);
+  sum = 0;
+  for(i = 0; i < NSPIN; i++){
+    if(read(out[0], r, sizeof(r)) != sizeof(r) || r[0] >= NSPIN){
+      printf(1, "sharetest: read failed\n");
+      exit();
+    }
+    n[r[0]] = r[1];
+    sum += r[1];
+  }
+  for(i = 0; i < NSPIN; i++)
+    wait();
+  setschedpolicy(old);
+
+  sum = sum / 100 + 1;
+  for(i = 0; i < NSPIN; i++)
+    printf(1, "spinner %d: %d tickets, requested %d%% achieved %d%%\n",
+           i, tickets[i], tickets[i] * 100 / total, n[i] / sum);
+  exit();
+}
@@ -0,0 +1,1275 @@
+
+_sleep-echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+    int i = 0;
+  14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	sleep(500);
+  1b:	83 ec 0c             	sub    $0xc,%esp
+  1e:	68 f4 01 00 00       	push   $0x1f4
+  23:	e8 46 03 00 00       	call   36e <sleep>
+  28:	83 c4 10             	add    $0x10,%esp
+    
+    for (i = 1; i < argc; i++)
+  2b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  32:	eb 35                	jmp    69 <main+0x69>
+    {
+        printf(1, argv[i]);
+  34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  37:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3e:	8b 43 04             	mov    0x4(%ebx),%eax
+  41:	01 d0                	add    %edx,%eax
+  43:	8b 00                	mov    (%eax),%eax
+  45:	83 ec 08             	sub    $0x8,%esp
+  48:	50                   	push   %eax
+  49:	6a 01                	push   $0x1
+  4b:	e8 3a 04 00 00       	call   48a <printf>
+  50:	83 c4 10             	add    $0x10,%esp
+        printf(1, " ");
+  53:	83 ec 08             	sub    $0x8,%esp
+  56:	68 ec 08 00 00       	push   $0x8ec
+  5b:	6a 01                	push   $0x1
+  5d:	e8 28 04 00 00       	call   48a <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+    for (i = 1; i < argc; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  6c:	3b 03                	cmp    (%ebx),%eax
+  6e:	7c c4                	jl     34 <main+0x34>
+    }
+
+    printf(1, "\n");
+  70:	83 ec 08             	sub    $0x8,%esp
+  73:	68 ee 08 00 00       	push   $0x8ee
+  78:	6a 01                	push   $0x1
+  7a:	e8 0b 04 00 00       	call   48a <printf>
+  7f:	83 c4 10             	add    $0x10,%esp
+    
+    exit();
+  82:	e8 57 02 00 00       	call   2de <exit>
+
+00000087 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  87:	55                   	push   %ebp
+  88:	89 e5                	mov    %esp,%ebp
+  8a:	57                   	push   %edi
+  8b:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8f:	8b 55 10             	mov    0x10(%ebp),%edx
+  92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  95:	89 cb                	mov    %ecx,%ebx
+  97:	89 df                	mov    %ebx,%edi
+  99:	89 d1                	mov    %edx,%ecx
+  9b:	fc                   	cld
+  9c:	f3 aa                	rep stos %al,%es:(%edi)
+  9e:	89 ca                	mov    %ecx,%edx
+  a0:	89 fb                	mov    %edi,%ebx
+  a2:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  a5:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  a8:	90                   	nop
+  a9:	5b                   	pop    %ebx
+  aa:	5f                   	pop    %edi
+  ab:	5d                   	pop    %ebp
+  ac:	c3                   	ret
+
+000000ad <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  ad:	55                   	push   %ebp
+  ae:	89 e5                	mov    %esp,%ebp
+  b0:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  b6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  b9:	90                   	nop
+  ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  bd:	8d 42 01             	lea    0x1(%edx),%eax
+  c0:	89 45 0c             	mov    %eax,0xc(%ebp)
+  c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c6:	8d 48 01             	lea    0x1(%eax),%ecx
+  c9:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  cc:	0f b6 12             	movzbl (%edx),%edx
+  cf:	88 10                	mov    %dl,(%eax)
+  d1:	0f b6 00             	movzbl (%eax),%eax
+  d4:	84 c0                	test   %al,%al
+  d6:	75 e2                	jne    ba <strcpy+0xd>
+    ;
+  return os;
+  d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  db:	c9                   	leave
+  dc:	c3                   	ret
+
+000000dd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  dd:	55                   	push   %ebp
+  de:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e0:	eb 08                	jmp    ea <strcmp+0xd>
+    p++, q++;
+  e2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  e6:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  ed:	0f b6 00             	movzbl (%eax),%eax
+  f0:	84 c0                	test   %al,%al
+  f2:	74 10                	je     104 <strcmp+0x27>
+  f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  f7:	0f b6 10             	movzbl (%eax),%edx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	0f b6 00             	movzbl (%eax),%eax
+ 100:	38 c2                	cmp    %al,%dl
+ 102:	74 de                	je     e2 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 104:	8b 45 08             	mov    0x8(%ebp),%eax
+ 107:	0f b6 00             	movzbl (%eax),%eax
+ 10a:	0f b6 d0             	movzbl %al,%edx
+ 10d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 c0             	movzbl %al,%eax
+ 116:	29 c2                	sub    %eax,%edx
+ 118:	89 d0                	mov    %edx,%eax
+}
+ 11a:	5d                   	pop    %ebp
+ 11b:	c3                   	ret
+
+0000011c <strlen>:
+
+uint
+strlen(char *s)
+{
+ 11c:	55                   	push   %ebp
+ 11d:	89 e5                	mov    %esp,%ebp
+ 11f:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 122:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 129:	eb 04                	jmp    12f <strlen+0x13>
+ 12b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 12f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 132:	8b 45 08             	mov    0x8(%ebp),%eax
+ 135:	01 d0                	add    %edx,%eax
+ 137:	0f b6 00             	movzbl (%eax),%eax
+ 13a:	84 c0                	test   %al,%al
+ 13c:	75 ed                	jne    12b <strlen+0xf>
+    ;
+  return n;
+ 13e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 141:	c9                   	leave
+ 142:	c3                   	ret
+
+00000143 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 143:	55                   	push   %ebp
+ 144:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 146:	8b 45 10             	mov    0x10(%ebp),%eax
+ 149:	50                   	push   %eax
+ 14a:	ff 75 0c             	push   0xc(%ebp)
+ 14d:	ff 75 08             	push   0x8(%ebp)
+ 150:	e8 32 ff ff ff       	call   87 <stosb>
+ 155:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+
+0000015d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 15d:	55                   	push   %ebp
+ 15e:	89 e5                	mov    %esp,%ebp
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 166:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 169:	eb 14                	jmp    17f <strchr+0x22>
+    if(*s == c)
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	0f b6 00             	movzbl (%eax),%eax
+ 171:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 174:	75 05                	jne    17b <strchr+0x1e>
+      return (char*)s;
+ 176:	8b 45 08             	mov    0x8(%ebp),%eax
+ 179:	eb 13                	jmp    18e <strchr+0x31>
+  for(; *s; s++)
+ 17b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	0f b6 00             	movzbl (%eax),%eax
+ 185:	84 c0                	test   %al,%al
+ 187:	75 e2                	jne    16b <strchr+0xe>
+  return 0;
+ 189:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 18e:	c9                   	leave
+ 18f:	c3                   	ret
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 196:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 19d:	eb 42                	jmp    1e1 <gets+0x51>
+    cc = read(0, &c, 1);
+ 19f:	83 ec 04             	sub    $0x4,%esp
+ 1a2:	6a 01                	push   $0x1
+ 1a4:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1a7:	50                   	push   %eax
+ 1a8:	6a 00                	push   $0x0
+ 1aa:	e8 47 01 00 00       	call   2f6 <read>
+ 1af:	83 c4 10             	add    $0x10,%esp
+ 1b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1b5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1b9:	7e 33                	jle    1ee <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1be:	8d 50 01             	lea    0x1(%eax),%edx
+ 1c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1c4:	89 c2                	mov    %eax,%edx
+ 1c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c9:	01 c2                	add    %eax,%edx
+ 1cb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1cf:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1d1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d5:	3c 0a                	cmp    $0xa,%al
+ 1d7:	74 16                	je     1ef <gets+0x5f>
+ 1d9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1dd:	3c 0d                	cmp    $0xd,%al
+ 1df:	74 0e                	je     1ef <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e4:	83 c0 01             	add    $0x1,%eax
+ 1e7:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1ea:	7f b3                	jg     19f <gets+0xf>
+ 1ec:	eb 01                	jmp    1ef <gets+0x5f>
+      break;
+ 1ee:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f5:	01 d0                	add    %edx,%eax
+ 1f7:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1fa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1fd:	c9                   	leave
+ 1fe:	c3                   	ret
+
+000001ff <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ff:	55                   	push   %ebp
+ 200:	89 e5                	mov    %esp,%ebp
+ 202:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 0c 01 00 00       	call   31e <open>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 218:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 21c:	79 07                	jns    225 <stat+0x26>
+    return -1;
+ 21e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 223:	eb 25                	jmp    24a <stat+0x4b>
+  r = fstat(fd, st);
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	ff 75 0c             	push   0xc(%ebp)
+ 22b:	ff 75 f4             	push   -0xc(%ebp)
+ 22e:	e8 03 01 00 00       	call   336 <fstat>
+ 233:	83 c4 10             	add    $0x10,%esp
+ 236:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 239:	83 ec 0c             	sub    $0xc,%esp
+ 23c:	ff 75 f4             	push   -0xc(%ebp)
+ 23f:	e8 c2 00 00 00       	call   306 <close>
+ 244:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 247:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 24a:	c9                   	leave
+ 24b:	c3                   	ret
+
+0000024c <atoi>:
+
+int
+atoi(const char *s)
+{
+ 24c:	55                   	push   %ebp
+ 24d:	89 e5                	mov    %esp,%ebp
+ 24f:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 252:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 259:	eb 25                	jmp    280 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 25b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 25e:	89 d0                	mov    %edx,%eax
+ 260:	c1 e0 02             	shl    $0x2,%eax
+ 263:	01 d0                	add    %edx,%eax
+ 265:	01 c0                	add    %eax,%eax
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26c:	8d 50 01             	lea    0x1(%eax),%edx
+ 26f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 272:	0f b6 00             	movzbl (%eax),%eax
+ 275:	0f be c0             	movsbl %al,%eax
+ 278:	01 c8                	add    %ecx,%eax
+ 27a:	83 e8 30             	sub    $0x30,%eax
+ 27d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 280:	8b 45 08             	mov    0x8(%ebp),%eax
+ 283:	0f b6 00             	movzbl (%eax),%eax
+ 286:	3c 2f                	cmp    $0x2f,%al
+ 288:	7e 0a                	jle    294 <atoi+0x48>
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	0f b6 00             	movzbl (%eax),%eax
+ 290:	3c 39                	cmp    $0x39,%al
+ 292:	7e c7                	jle    25b <atoi+0xf>
+  return n;
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+
+00000299 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 299:	55                   	push   %ebp
+ 29a:	89 e5                	mov    %esp,%ebp
+ 29c:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 29f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2ab:	eb 17                	jmp    2c4 <memmove+0x2b>
+    *dst++ = *src++;
+ 2ad:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b0:	8d 42 01             	lea    0x1(%edx),%eax
+ 2b3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2b9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2bc:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2bf:	0f b6 12             	movzbl (%edx),%edx
+ 2c2:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2c4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c7:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2ca:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2cd:	85 c0                	test   %eax,%eax
+ 2cf:	7f dc                	jg     2ad <memmove+0x14>
+  return vdst;
+ 2d1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+
+000002d6 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2d6:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <exit>:
+SYSCALL(exit)
+ 2de:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <wait>:
+SYSCALL(wait)
+ 2e6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <pipe>:
+SYSCALL(pipe)
+ 2ee:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <read>:
+SYSCALL(read)
+ 2f6:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <write>:
+SYSCALL(write)
+ 2fe:	b8 10 00 00 00       	mov    $0x10,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <close>:
+SYSCALL(close)
+ 306:	b8 15 00 00 00       	mov    $0x15,%eax
+ 30b:	cd 40                	int    $0x40
+ 30d:	c3                   	ret
+
+0000030e <kill>:
+SYSCALL(kill)
+ 30e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 313:	cd 40                	int    $0x40
+ 315:	c3                   	ret
+
+00000316 <exec>:
+SYSCALL(exec)
+ 316:	b8 07 00 00 00       	mov    $0x7,%eax
+ 31b:	cd 40                	int    $0x40
+ 31d:	c3                   	ret
+
+0000031e <open>:
+SYSCALL(open)
+ 31e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 323:	cd 40                	int    $0x40
+ 325:	c3                   	ret
+
+00000326 <mknod>:
+SYSCALL(mknod)
+ 326:	b8 11 00 00 00       	mov    $0x11,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <unlink>:
+SYSCALL(unlink)
+ 32e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <fstat>:
+SYSCALL(fstat)
+ 336:	b8 08 00 00 00       	mov    $0x8,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <link>:
+SYSCALL(link)
+ 33e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <mkdir>:
+SYSCALL(mkdir)
+ 346:	b8 14 00 00 00       	mov    $0x14,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <chdir>:
+SYSCALL(chdir)
+ 34e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <dup>:
+SYSCALL(dup)
+ 356:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <getpid>:
+SYSCALL(getpid)
+ 35e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <sbrk>:
+SYSCALL(sbrk)
+ 366:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <sleep>:
+SYSCALL(sleep)
+ 36e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <uptime>:
+SYSCALL(uptime)
+ 376:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 37e:	b8 16 00 00 00       	mov    $0x16,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <getschedstat>:
+SYSCALL(getschedstat)
+ 386:	b8 17 00 00 00       	mov    $0x17,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 38e:	b8 18 00 00 00       	mov    $0x18,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <setshare>:
+SYSCALL(setshare)
+ 396:	b8 19 00 00 00       	mov    $0x19,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <getbcachestat>:
+SYSCALL(getbcachestat)
+ 39e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 3a6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <getlogstat>:
+SYSCALL(getlogstat)
+ 3ae:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3b6:	55                   	push   %ebp
+ 3b7:	89 e5                	mov    %esp,%ebp
+ 3b9:	83 ec 18             	sub    $0x18,%esp
+ 3bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bf:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3c2:	83 ec 04             	sub    $0x4,%esp
+ 3c5:	6a 01                	push   $0x1
+ 3c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3ca:	50                   	push   %eax
+ 3cb:	ff 75 08             	push   0x8(%ebp)
+ 3ce:	e8 2b ff ff ff       	call   2fe <write>
+ 3d3:	83 c4 10             	add    $0x10,%esp
+}
+ 3d6:	90                   	nop
+ 3d7:	c9                   	leave
+ 3d8:	c3                   	ret
+
+000003d9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d9:	55                   	push   %ebp
+ 3da:	89 e5                	mov    %esp,%ebp
+ 3dc:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 3df:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 3e6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 3ea:	74 17                	je     403 <printint+0x2a>
+ 3ec:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 3f0:	79 11                	jns    403 <printint+0x2a>
+    neg = 1;
+ 3f2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fc:	f7 d8                	neg    %eax
+ 3fe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 401:	eb 06                	jmp    409 <printint+0x30>
+  } else {
+    x = xx;
+ 403:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 406:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 409:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 410:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 413:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 416:	ba 00 00 00 00       	mov    $0x0,%edx
+ 41b:	f7 f1                	div    %ecx
+ 41d:	89 d1                	mov    %edx,%ecx
+ 41f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 422:	8d 50 01             	lea    0x1(%eax),%edx
+ 425:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 428:	0f b6 91 e4 0b 00 00 	movzbl 0xbe4(%ecx),%edx
+ 42f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 433:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 436:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 439:	ba 00 00 00 00       	mov    $0x0,%edx
+ 43e:	f7 f1                	div    %ecx
+ 440:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 443:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 447:	75 c7                	jne    410 <printint+0x37>
+  if(neg)
+ 449:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 44d:	74 2d                	je     47c <printint+0xa3>
+    buf[i++] = '-';
+ 44f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 452:	8d 50 01             	lea    0x1(%eax),%edx
+ 455:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 458:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 45d:	eb 1d                	jmp    47c <printint+0xa3>
+    putc(fd, buf[i]);
+ 45f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 465:	01 d0                	add    %edx,%eax
+ 467:	0f b6 00             	movzbl (%eax),%eax
+ 46a:	0f be c0             	movsbl %al,%eax
+ 46d:	83 ec 08             	sub    $0x8,%esp
+ 470:	50                   	push   %eax
+ 471:	ff 75 08             	push   0x8(%ebp)
+ 474:	e8 3d ff ff ff       	call   3b6 <putc>
+ 479:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 47c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 480:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 484:	79 d9                	jns    45f <printint+0x86>
+}
+ 486:	90                   	nop
+ 487:	90                   	nop
+ 488:	c9                   	leave
+ 489:	c3                   	ret
+
+0000048a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 48a:	55                   	push   %ebp
+ 48b:	89 e5                	mov    %esp,%ebp
+ 48d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 490:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 497:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 49a:	83 c0 04             	add    $0x4,%eax
+ 49d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 4a0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 4a7:	e9 59 01 00 00       	jmp    605 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 4ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4af:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4b2:	01 d0                	add    %edx,%eax
+ 4b4:	0f b6 00             	movzbl (%eax),%eax
+ 4b7:	0f be c0             	movsbl %al,%eax
+ 4ba:	25 ff 00 00 00       	and    $0xff,%eax
+ 4bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4c6:	75 2c                	jne    4f4 <printf+0x6a>
+      if(c == '%'){
+ 4c8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4cc:	75 0c                	jne    4da <printf+0x50>
+        state = '%';
+ 4ce:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 4d5:	e9 27 01 00 00       	jmp    601 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 4da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 4dd:	0f be c0             	movsbl %al,%eax
+ 4e0:	83 ec 08             	sub    $0x8,%esp
+ 4e3:	50                   	push   %eax
+ 4e4:	ff 75 08             	push   0x8(%ebp)
+ 4e7:	e8 ca fe ff ff       	call   3b6 <putc>
+ 4ec:	83 c4 10             	add    $0x10,%esp
+ 4ef:	e9 0d 01 00 00       	jmp    601 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4f4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4f8:	0f 85 03 01 00 00    	jne    601 <printf+0x177>
+      if(c == 'd'){
+ 4fe:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 502:	75 1e                	jne    522 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 504:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 507:	8b 00                	mov    (%eax),%eax
+ 509:	6a 01                	push   $0x1
+ 50b:	6a 0a                	push   $0xa
+ 50d:	50                   	push   %eax
+ 50e:	ff 75 08             	push   0x8(%ebp)
+ 511:	e8 c3 fe ff ff       	call   3d9 <printint>
+ 516:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 519:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 51d:	e9 d8 00 00 00       	jmp    5fa <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 522:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 526:	74 06                	je     52e <printf+0xa4>
+ 528:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 52c:	75 1e                	jne    54c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 52e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 531:	8b 00                	mov    (%eax),%eax
+ 533:	6a 00                	push   $0x0
+ 535:	6a 10                	push   $0x10
+ 537:	50                   	push   %eax
+ 538:	ff 75 08             	push   0x8(%ebp)
+ 53b:	e8 99 fe ff ff       	call   3d9 <printint>
+ 540:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 543:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 547:	e9 ae 00 00 00       	jmp    5fa <printf+0x170>
+      } else if(c == 's'){
+ 54c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 550:	75 43                	jne    595 <printf+0x10b>
+        s = (char*)*ap;
+ 552:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 555:	8b 00                	mov    (%eax),%eax
+ 557:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 55a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 55e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 562:	75 25                	jne    589 <printf+0xff>
+          s = "(null)";
+ 564:	c7 45 f4 f0 08 00 00 	movl   $0x8f0,-0xc(%ebp)
+        while(*s != 0){
+ 56b:	eb 1c                	jmp    589 <printf+0xff>
+          putc(fd, *s);
+ 56d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 570:	0f b6 00             	movzbl (%eax),%eax
+ 573:	0f be c0             	movsbl %al,%eax
+ 576:	83 ec 08             	sub    $0x8,%esp
+ 579:	50                   	push   %eax
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 34 fe ff ff       	call   3b6 <putc>
+ 582:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 585:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 589:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 58c:	0f b6 00             	movzbl (%eax),%eax
+ 58f:	84 c0                	test   %al,%al
+ 591:	75 da                	jne    56d <printf+0xe3>
+ 593:	eb 65                	jmp    5fa <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 595:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 599:	75 1d                	jne    5b8 <printf+0x12e>
+        putc(fd, *ap);
+ 59b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 59e:	8b 00                	mov    (%eax),%eax
+ 5a0:	0f be c0             	movsbl %al,%eax
+ 5a3:	83 ec 08             	sub    $0x8,%esp
+ 5a6:	50                   	push   %eax
+ 5a7:	ff 75 08             	push   0x8(%ebp)
+ 5aa:	e8 07 fe ff ff       	call   3b6 <putc>
+ 5af:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5b2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5b6:	eb 42                	jmp    5fa <printf+0x170>
+      } else if(c == '%'){
+ 5b8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5bc:	75 17                	jne    5d5 <printf+0x14b>
+        putc(fd, c);
+ 5be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5c1:	0f be c0             	movsbl %al,%eax
+ 5c4:	83 ec 08             	sub    $0x8,%esp
+ 5c7:	50                   	push   %eax
+ 5c8:	ff 75 08             	push   0x8(%ebp)
+ 5cb:	e8 e6 fd ff ff       	call   3b6 <putc>
+ 5d0:	83 c4 10             	add    $0x10,%esp
+ 5d3:	eb 25                	jmp    5fa <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 5d5:	83 ec 08             	sub    $0x8,%esp
+ 5d8:	6a 25                	push   $0x25
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 d4 fd ff ff       	call   3b6 <putc>
+ 5e2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 5e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5e8:	0f be c0             	movsbl %al,%eax
+ 5eb:	83 ec 08             	sub    $0x8,%esp
+ 5ee:	50                   	push   %eax
+ 5ef:	ff 75 08             	push   0x8(%ebp)
+ 5f2:	e8 bf fd ff ff       	call   3b6 <putc>
+ 5f7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5fa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 601:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 605:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 608:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 60b:	01 d0                	add    %edx,%eax
+ 60d:	0f b6 00             	movzbl (%eax),%eax
+ 610:	84 c0                	test   %al,%al
+ 612:	0f 85 94 fe ff ff    	jne    4ac <printf+0x22>
+    }
+  }
+}
+ 618:	90                   	nop
+ 619:	90                   	nop
+ 61a:	c9                   	leave
+ 61b:	c3                   	ret
+
+0000061c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 61c:	55                   	push   %ebp
+ 61d:	89 e5                	mov    %esp,%ebp
+ 61f:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 622:	8b 45 08             	mov    0x8(%ebp),%eax
+ 625:	83 e8 08             	sub    $0x8,%eax
+ 628:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 62b:	a1 00 0c 00 00       	mov    0xc00,%eax
+ 630:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 633:	eb 24                	jmp    659 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 635:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 638:	8b 00                	mov    (%eax),%eax
+ 63a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 63d:	72 12                	jb     651 <free+0x35>
+ 63f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 642:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 645:	72 24                	jb     66b <free+0x4f>
+ 647:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 64a:	8b 00                	mov    (%eax),%eax
+ 64c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 64f:	72 1a                	jb     66b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 654:	8b 00                	mov    (%eax),%eax
+ 656:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 659:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 65c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 65f:	73 d4                	jae    635 <free+0x19>
+ 661:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 664:	8b 00                	mov    (%eax),%eax
+ 666:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 669:	73 ca                	jae    635 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 66b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 66e:	8b 40 04             	mov    0x4(%eax),%eax
+ 671:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 678:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 67b:	01 c2                	add    %eax,%edx
+ 67d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 680:	8b 00                	mov    (%eax),%eax
+ 682:	39 c2                	cmp    %eax,%edx
+ 684:	75 24                	jne    6aa <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 686:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 689:	8b 50 04             	mov    0x4(%eax),%edx
+ 68c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68f:	8b 00                	mov    (%eax),%eax
+ 691:	8b 40 04             	mov    0x4(%eax),%eax
+ 694:	01 c2                	add    %eax,%edx
+ 696:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 699:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 69c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69f:	8b 00                	mov    (%eax),%eax
+ 6a1:	8b 10                	mov    (%eax),%edx
+ 6a3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a6:	89 10                	mov    %edx,(%eax)
+ 6a8:	eb 0a                	jmp    6b4 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6aa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ad:	8b 10                	mov    (%eax),%edx
+ 6af:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6b2:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ba:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c4:	01 d0                	add    %edx,%eax
+ 6c6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6c9:	75 20                	jne    6eb <free+0xcf>
+    p->s.size += bp->s.size;
+ 6cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ce:	8b 50 04             	mov    0x4(%eax),%edx
+ 6d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d4:	8b 40 04             	mov    0x4(%eax),%eax
+ 6d7:	01 c2                	add    %eax,%edx
+ 6d9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6dc:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e2:	8b 10                	mov    (%eax),%edx
+ 6e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e7:	89 10                	mov    %edx,(%eax)
+ 6e9:	eb 08                	jmp    6f3 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 6eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ee:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6f1:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 6f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f6:	a3 00 0c 00 00       	mov    %eax,0xc00
+}
+ 6fb:	90                   	nop
+ 6fc:	c9                   	leave
+ 6fd:	c3                   	ret
+
+000006fe <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6fe:	55                   	push   %ebp
+ 6ff:	89 e5                	mov    %esp,%ebp
+ 701:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 704:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 70b:	77 07                	ja     714 <morecore+0x16>
+    nu = 4096;
+ 70d:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 714:	8b 45 08             	mov    0x8(%ebp),%eax
+ 717:	c1 e0 03             	shl    $0x3,%eax
+ 71a:	83 ec 0c             	sub    $0xc,%esp
+ 71d:	50                   	push   %eax
+ 71e:	e8 43 fc ff ff       	call   366 <sbrk>
+ 723:	83 c4 10             	add    $0x10,%esp
+ 726:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 729:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 72d:	75 07                	jne    736 <morecore+0x38>
+    return 0;
+ 72f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 734:	eb 26                	jmp    75c <morecore+0x5e>
+  hp = (Header*)p;
+ 736:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 739:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 73c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 73f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 742:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 745:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 748:	83 c0 08             	add    $0x8,%eax
+ 74b:	83 ec 0c             	sub    $0xc,%esp
+ 74e:	50                   	push   %eax
+ 74f:	e8 c8 fe ff ff       	call   61c <free>
+ 754:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 757:	a1 00 0c 00 00       	mov    0xc00,%eax
+}
+ 75c:	c9                   	leave
+ 75d:	c3                   	ret
+
+0000075e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 75e:	55                   	push   %ebp
+ 75f:	89 e5                	mov    %esp,%ebp
+ 761:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 764:	8b 45 08             	mov    0x8(%ebp),%eax
+ 767:	83 c0 07             	add    $0x7,%eax
+ 76a:	c1 e8 03             	shr    $0x3,%eax
+ 76d:	83 c0 01             	add    $0x1,%eax
+ 770:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 773:	a1 00 0c 00 00       	mov    0xc00,%eax
+ 778:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 77b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 77f:	75 23                	jne    7a4 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 781:	c7 45 f0 f8 0b 00 00 	movl   $0xbf8,-0x10(%ebp)
+ 788:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 78b:	a3 00 0c 00 00       	mov    %eax,0xc00
+ 790:	a1 00 0c 00 00       	mov    0xc00,%eax
+ 795:	a3 f8 0b 00 00       	mov    %eax,0xbf8
+    base.s.size = 0;
+ 79a:	c7 05 fc 0b 00 00 00 	movl   $0x0,0xbfc
+ 7a1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a7:	8b 00                	mov    (%eax),%eax
+ 7a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7af:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7b5:	72 4d                	jb     804 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ba:	8b 40 04             	mov    0x4(%eax),%eax
+ 7bd:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7c0:	75 0c                	jne    7ce <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c5:	8b 10                	mov    (%eax),%edx
+ 7c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ca:	89 10                	mov    %edx,(%eax)
+ 7cc:	eb 26                	jmp    7f4 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 7ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d1:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 7d7:	89 c2                	mov    %eax,%edx
+ 7d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7dc:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 7df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e2:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e5:	c1 e0 03             	shl    $0x3,%eax
+ 7e8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 7eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ee:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7f1:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f7:	a3 00 0c 00 00       	mov    %eax,0xc00
+      return (void*)(p + 1);
+ 7fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ff:	83 c0 08             	add    $0x8,%eax
+ 802:	eb 3b                	jmp    83f <malloc+0xe1>
+    }
+    if(p == freep)
+ 804:	a1 00 0c 00 00       	mov    0xc00,%eax
+ 809:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 80c:	75 1e                	jne    82c <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 80e:	83 ec 0c             	sub    $0xc,%esp
+ 811:	ff 75 ec             	push   -0x14(%ebp)
+ 814:	e8 e5 fe ff ff       	call   6fe <morecore>
+ 819:	83 c4 10             	add    $0x10,%esp
+ 81c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 81f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 823:	75 07                	jne    82c <malloc+0xce>
+        return 0;
+ 825:	b8 00 00 00 00       	mov    $0x0,%eax
+ 82a:	eb 13                	jmp    83f <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 82c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 832:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 835:	8b 00                	mov    (%eax),%eax
+ 837:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 83a:	e9 6d ff ff ff       	jmp    7ac <malloc+0x4e>
+  }
+}
+ 83f:	c9                   	leave
+ 840:	c3                   	ret
+
+00000841 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 841:	55                   	push   %ebp
+ 842:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 844:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 847:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 84a:	7e 08                	jle    854 <ticks+0x13>
+ 84c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 84f:	2b 45 08             	sub    0x8(%ebp),%eax
+ 852:	eb 05                	jmp    859 <ticks+0x18>
+ 854:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 859:	5d                   	pop    %ebp
+ 85a:	c3                   	ret
+
+0000085b <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 85b:	55                   	push   %ebp
+ 85c:	89 e5                	mov    %esp,%ebp
+ 85e:	53                   	push   %ebx
+ 85f:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 862:	8b 45 08             	mov    0x8(%ebp),%eax
+ 865:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 868:	ff 75 14             	push   0x14(%ebp)
+ 86b:	ff 75 10             	push   0x10(%ebp)
+ 86e:	e8 ce ff ff ff       	call   841 <ticks>
+ 873:	83 c4 08             	add    $0x8,%esp
+ 876:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 878:	89 d8                	mov    %ebx,%eax
+ 87a:	99                   	cltd
+ 87b:	f7 f9                	idiv   %ecx
+ 87d:	89 c2                	mov    %eax,%edx
+ 87f:	8b 45 14             	mov    0x14(%ebp),%eax
+ 882:	2b 45 10             	sub    0x10(%ebp),%eax
+ 885:	83 ec 04             	sub    $0x4,%esp
+ 888:	ff 75 0c             	push   0xc(%ebp)
+ 88b:	52                   	push   %edx
+ 88c:	50                   	push   %eax
+ 88d:	ff 75 0c             	push   0xc(%ebp)
+ 890:	ff 75 08             	push   0x8(%ebp)
+ 893:	68 f8 08 00 00       	push   $0x8f8
+ 898:	6a 01                	push   $0x1
+ 89a:	e8 eb fb ff ff       	call   48a <printf>
+ 89f:	83 c4 20             	add    $0x20,%esp
+}
+ 8a2:	90                   	nop
+ 8a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 8a6:	c9                   	leave
+ 8a7:	c3                   	ret
+
+000008a8 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 8a8:	55                   	push   %ebp
+ 8a9:	89 e5                	mov    %esp,%ebp
+ 8ab:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 8ae:	ff 75 14             	push   0x14(%ebp)
+ 8b1:	ff 75 10             	push   0x10(%ebp)
+ 8b4:	e8 88 ff ff ff       	call   841 <ticks>
+ 8b9:	83 c4 08             	add    $0x8,%esp
+ 8bc:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 8c2:	99                   	cltd
+ 8c3:	f7 7d 08             	idivl  0x8(%ebp)
+ 8c6:	89 c2                	mov    %eax,%edx
+ 8c8:	8b 45 14             	mov    0x14(%ebp),%eax
+ 8cb:	2b 45 10             	sub    0x10(%ebp),%eax
+ 8ce:	83 ec 08             	sub    $0x8,%esp
+ 8d1:	52                   	push   %edx
+ 8d2:	50                   	push   %eax
+ 8d3:	ff 75 0c             	push   0xc(%ebp)
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	68 18 09 00 00       	push   $0x918
+ 8de:	6a 01                	push   $0x1
+ 8e0:	e8 a5 fb ff ff       	call   48a <printf>
+ 8e5:	83 c4 20             	add    $0x20,%esp
+}
+ 8e8:	90                   	nop
+ 8e9:	c9                   	leave
+ 8ea:	c3                   	ret
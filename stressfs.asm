@@ -0,0 +1,1349 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 b8 09 00 00       	push   $0x9b8
+  30:	6a 01                	push   $0x1
+  32:	e8 1e 05 00 00       	call   555 <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 40 03 00 00       	call   3a1 <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 cb 09 00 00       	push   $0x9cb
+  7d:	6a 01                	push   $0x1
+  7f:	e8 d1 04 00 00       	call   555 <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 43 03 00 00       	call   3e9 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 fd 02 00 00       	call   3c9 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 ed 02 00 00       	call   3d1 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 d5 09 00 00       	push   $0x9d5
+  ef:	6a 01                	push   $0x1
+  f1:	e8 5f 04 00 00       	call   555 <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 e2 02 00 00       	call   3e9 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 94 02 00 00       	call   3c1 <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 8c 02 00 00       	call   3d1 <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 64 02 00 00       	call   3b1 <wait>
+  
+  exit();
+ 14d:	e8 57 02 00 00       	call   3a9 <exit>
+
+00000152 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+    ;
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+    p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+    ;
+  return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+    if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+      return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+  for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+  return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 47 01 00 00       	call   3c1 <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+      break;
+ 2b9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 0c 01 00 00       	call   3e9 <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+    return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 03 01 00 00       	call   401 <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 c2 00 00 00       	call   3d1 <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+  return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 376:	eb 17                	jmp    38f <memmove+0x2b>
+    *dst++ = *src++;
+ 378:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37b:	8d 42 01             	lea    0x1(%edx),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 384:	8d 48 01             	lea    0x1(%eax),%ecx
+ 387:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38a:	0f b6 12             	movzbl (%edx),%edx
+ 38d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 392:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 395:	89 55 10             	mov    %edx,0x10(%ebp)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f dc                	jg     378 <memmove+0x14>
+  return vdst;
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3a1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <exit>:
+SYSCALL(exit)
+ 3a9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <wait>:
+SYSCALL(wait)
+ 3b1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <pipe>:
+SYSCALL(pipe)
+ 3b9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <read>:
+SYSCALL(read)
+ 3c1:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <write>:
+SYSCALL(write)
+ 3c9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <close>:
+SYSCALL(close)
+ 3d1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <kill>:
+SYSCALL(kill)
+ 3d9:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <exec>:
+SYSCALL(exec)
+ 3e1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <open>:
+SYSCALL(open)
+ 3e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <mknod>:
+SYSCALL(mknod)
+ 3f1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <unlink>:
+SYSCALL(unlink)
+ 3f9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <fstat>:
+SYSCALL(fstat)
+ 401:	b8 08 00 00 00       	mov    $0x8,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <link>:
+SYSCALL(link)
+ 409:	b8 13 00 00 00       	mov    $0x13,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <mkdir>:
+SYSCALL(mkdir)
+ 411:	b8 14 00 00 00       	mov    $0x14,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <chdir>:
+SYSCALL(chdir)
+ 419:	b8 09 00 00 00       	mov    $0x9,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <dup>:
+SYSCALL(dup)
+ 421:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <getpid>:
+SYSCALL(getpid)
+ 429:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <sbrk>:
+SYSCALL(sbrk)
+ 431:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <sleep>:
+SYSCALL(sleep)
+ 439:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <uptime>:
+SYSCALL(uptime)
+ 441:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 449:	b8 16 00 00 00       	mov    $0x16,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <getschedstat>:
+SYSCALL(getschedstat)
+ 451:	b8 17 00 00 00       	mov    $0x17,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 459:	b8 18 00 00 00       	mov    $0x18,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <setshare>:
+SYSCALL(setshare)
+ 461:	b8 19 00 00 00       	mov    $0x19,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 469:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 471:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <getlogstat>:
+SYSCALL(getlogstat)
+ 479:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 481:	55                   	push   %ebp
+ 482:	89 e5                	mov    %esp,%ebp
+ 484:	83 ec 18             	sub    $0x18,%esp
+ 487:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 48d:	83 ec 04             	sub    $0x4,%esp
+ 490:	6a 01                	push   $0x1
+ 492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 495:	50                   	push   %eax
+ 496:	ff 75 08             	push   0x8(%ebp)
+ 499:	e8 2b ff ff ff       	call   3c9 <write>
+ 49e:	83 c4 10             	add    $0x10,%esp
+}
+ 4a1:	90                   	nop
+ 4a2:	c9                   	leave
+ 4a3:	c3                   	ret
+
+000004a4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a4:	55                   	push   %ebp
+ 4a5:	89 e5                	mov    %esp,%ebp
+ 4a7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4aa:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4b1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4b5:	74 17                	je     4ce <printint+0x2a>
+ 4b7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4bb:	79 11                	jns    4ce <printint+0x2a>
+    neg = 1;
+ 4bd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c7:	f7 d8                	neg    %eax
+ 4c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4cc:	eb 06                	jmp    4d4 <printint+0x30>
+  } else {
+    x = xx;
+ 4ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4d4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4e1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4e6:	f7 f1                	div    %ecx
+ 4e8:	89 d1                	mov    %edx,%ecx
+ 4ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4ed:	8d 50 01             	lea    0x1(%eax),%edx
+ 4f0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4f3:	0f b6 91 cc 0c 00 00 	movzbl 0xccc(%ecx),%edx
+ 4fa:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4fe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 501:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 504:	ba 00 00 00 00       	mov    $0x0,%edx
+ 509:	f7 f1                	div    %ecx
+ 50b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 50e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 512:	75 c7                	jne    4db <printint+0x37>
+  if(neg)
+ 514:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 518:	74 2d                	je     547 <printint+0xa3>
+    buf[i++] = '-';
+ 51a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 51d:	8d 50 01             	lea    0x1(%eax),%edx
+ 520:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 523:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 528:	eb 1d                	jmp    547 <printint+0xa3>
+    putc(fd, buf[i]);
+ 52a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 52d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 530:	01 d0                	add    %edx,%eax
+ 532:	0f b6 00             	movzbl (%eax),%eax
+ 535:	0f be c0             	movsbl %al,%eax
+ 538:	83 ec 08             	sub    $0x8,%esp
+ 53b:	50                   	push   %eax
+ 53c:	ff 75 08             	push   0x8(%ebp)
+ 53f:	e8 3d ff ff ff       	call   481 <putc>
+ 544:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 547:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 54b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 54f:	79 d9                	jns    52a <printint+0x86>
+}
+ 551:	90                   	nop
+ 552:	90                   	nop
+ 553:	c9                   	leave
+ 554:	c3                   	ret
+
+00000555 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 555:	55                   	push   %ebp
+ 556:	89 e5                	mov    %esp,%ebp
+ 558:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 55b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 562:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 565:	83 c0 04             	add    $0x4,%eax
+ 568:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 56b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 572:	e9 59 01 00 00       	jmp    6d0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 577:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 57a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 57d:	01 d0                	add    %edx,%eax
+ 57f:	0f b6 00             	movzbl (%eax),%eax
+ 582:	0f be c0             	movsbl %al,%eax
+ 585:	25 ff 00 00 00       	and    $0xff,%eax
+ 58a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 58d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 591:	75 2c                	jne    5bf <printf+0x6a>
+      if(c == '%'){
+ 593:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 597:	75 0c                	jne    5a5 <printf+0x50>
+        state = '%';
+ 599:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5a0:	e9 27 01 00 00       	jmp    6cc <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5a8:	0f be c0             	movsbl %al,%eax
+ 5ab:	83 ec 08             	sub    $0x8,%esp
+ 5ae:	50                   	push   %eax
+ 5af:	ff 75 08             	push   0x8(%ebp)
+ 5b2:	e8 ca fe ff ff       	call   481 <putc>
+ 5b7:	83 c4 10             	add    $0x10,%esp
+ 5ba:	e9 0d 01 00 00       	jmp    6cc <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5bf:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5c3:	0f 85 03 01 00 00    	jne    6cc <printf+0x177>
+      if(c == 'd'){
+ 5c9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5cd:	75 1e                	jne    5ed <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5cf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d2:	8b 00                	mov    (%eax),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	6a 0a                	push   $0xa
+ 5d8:	50                   	push   %eax
+ 5d9:	ff 75 08             	push   0x8(%ebp)
+ 5dc:	e8 c3 fe ff ff       	call   4a4 <printint>
+ 5e1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5e4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5e8:	e9 d8 00 00 00       	jmp    6c5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5ed:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5f1:	74 06                	je     5f9 <printf+0xa4>
+ 5f3:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5f7:	75 1e                	jne    617 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5f9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5fc:	8b 00                	mov    (%eax),%eax
+ 5fe:	6a 00                	push   $0x0
+ 600:	6a 10                	push   $0x10
+ 602:	50                   	push   %eax
+ 603:	ff 75 08             	push   0x8(%ebp)
+ 606:	e8 99 fe ff ff       	call   4a4 <printint>
+ 60b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 60e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 612:	e9 ae 00 00 00       	jmp    6c5 <printf+0x170>
+      } else if(c == 's'){
+ 617:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 61b:	75 43                	jne    660 <printf+0x10b>
+        s = (char*)*ap;
+ 61d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 620:	8b 00                	mov    (%eax),%eax
+ 622:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 625:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 629:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 62d:	75 25                	jne    654 <printf+0xff>
+          s = "(null)";
+ 62f:	c7 45 f4 db 09 00 00 	movl   $0x9db,-0xc(%ebp)
+        while(*s != 0){
+ 636:	eb 1c                	jmp    654 <printf+0xff>
+          putc(fd, *s);
+ 638:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 63b:	0f b6 00             	movzbl (%eax),%eax
+ 63e:	0f be c0             	movsbl %al,%eax
+ 641:	83 ec 08             	sub    $0x8,%esp
+ 644:	50                   	push   %eax
+ 645:	ff 75 08             	push   0x8(%ebp)
+ 648:	e8 34 fe ff ff       	call   481 <putc>
+ 64d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 650:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 654:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 657:	0f b6 00             	movzbl (%eax),%eax
+ 65a:	84 c0                	test   %al,%al
+ 65c:	75 da                	jne    638 <printf+0xe3>
+ 65e:	eb 65                	jmp    6c5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 660:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 664:	75 1d                	jne    683 <printf+0x12e>
+        putc(fd, *ap);
+ 666:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 669:	8b 00                	mov    (%eax),%eax
+ 66b:	0f be c0             	movsbl %al,%eax
+ 66e:	83 ec 08             	sub    $0x8,%esp
+ 671:	50                   	push   %eax
+ 672:	ff 75 08             	push   0x8(%ebp)
+ 675:	e8 07 fe ff ff       	call   481 <putc>
+ 67a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 67d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 681:	eb 42                	jmp    6c5 <printf+0x170>
+      } else if(c == '%'){
+ 683:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 687:	75 17                	jne    6a0 <printf+0x14b>
+        putc(fd, c);
+ 689:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 68c:	0f be c0             	movsbl %al,%eax
+ 68f:	83 ec 08             	sub    $0x8,%esp
+ 692:	50                   	push   %eax
+ 693:	ff 75 08             	push   0x8(%ebp)
+ 696:	e8 e6 fd ff ff       	call   481 <putc>
+ 69b:	83 c4 10             	add    $0x10,%esp
+ 69e:	eb 25                	jmp    6c5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6a0:	83 ec 08             	sub    $0x8,%esp
+ 6a3:	6a 25                	push   $0x25
+ 6a5:	ff 75 08             	push   0x8(%ebp)
+ 6a8:	e8 d4 fd ff ff       	call   481 <putc>
+ 6ad:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6b3:	0f be c0             	movsbl %al,%eax
+ 6b6:	83 ec 08             	sub    $0x8,%esp
+ 6b9:	50                   	push   %eax
+ 6ba:	ff 75 08             	push   0x8(%ebp)
+ 6bd:	e8 bf fd ff ff       	call   481 <putc>
+ 6c2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6c5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6cc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6d6:	01 d0                	add    %edx,%eax
+ 6d8:	0f b6 00             	movzbl (%eax),%eax
+ 6db:	84 c0                	test   %al,%al
+ 6dd:	0f 85 94 fe ff ff    	jne    577 <printf+0x22>
+    }
+  }
+}
+ 6e3:	90                   	nop
+ 6e4:	90                   	nop
+ 6e5:	c9                   	leave
+ 6e6:	c3                   	ret
+
+000006e7 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e7:	55                   	push   %ebp
+ 6e8:	89 e5                	mov    %esp,%ebp
+ 6ea:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f0:	83 e8 08             	sub    $0x8,%eax
+ 6f3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f6:	a1 e8 0c 00 00       	mov    0xce8,%eax
+ 6fb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6fe:	eb 24                	jmp    724 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 700:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 703:	8b 00                	mov    (%eax),%eax
+ 705:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 708:	72 12                	jb     71c <free+0x35>
+ 70a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 70d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 710:	72 24                	jb     736 <free+0x4f>
+ 712:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 715:	8b 00                	mov    (%eax),%eax
+ 717:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 71a:	72 1a                	jb     736 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 71c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71f:	8b 00                	mov    (%eax),%eax
+ 721:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 724:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 727:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 72a:	73 d4                	jae    700 <free+0x19>
+ 72c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72f:	8b 00                	mov    (%eax),%eax
+ 731:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 734:	73 ca                	jae    700 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 736:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 739:	8b 40 04             	mov    0x4(%eax),%eax
+ 73c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 743:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 746:	01 c2                	add    %eax,%edx
+ 748:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74b:	8b 00                	mov    (%eax),%eax
+ 74d:	39 c2                	cmp    %eax,%edx
+ 74f:	75 24                	jne    775 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 751:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 754:	8b 50 04             	mov    0x4(%eax),%edx
+ 757:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75a:	8b 00                	mov    (%eax),%eax
+ 75c:	8b 40 04             	mov    0x4(%eax),%eax
+ 75f:	01 c2                	add    %eax,%edx
+ 761:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 764:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 767:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76a:	8b 00                	mov    (%eax),%eax
+ 76c:	8b 10                	mov    (%eax),%edx
+ 76e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 771:	89 10                	mov    %edx,(%eax)
+ 773:	eb 0a                	jmp    77f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 775:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 778:	8b 10                	mov    (%eax),%edx
+ 77a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 77d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 77f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 782:	8b 40 04             	mov    0x4(%eax),%eax
+ 785:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 78c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78f:	01 d0                	add    %edx,%eax
+ 791:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 794:	75 20                	jne    7b6 <free+0xcf>
+    p->s.size += bp->s.size;
+ 796:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 799:	8b 50 04             	mov    0x4(%eax),%edx
+ 79c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79f:	8b 40 04             	mov    0x4(%eax),%eax
+ 7a2:	01 c2                	add    %eax,%edx
+ 7a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7aa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ad:	8b 10                	mov    (%eax),%edx
+ 7af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b2:	89 10                	mov    %edx,(%eax)
+ 7b4:	eb 08                	jmp    7be <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7bc:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c1:	a3 e8 0c 00 00       	mov    %eax,0xce8
+}
+ 7c6:	90                   	nop
+ 7c7:	c9                   	leave
+ 7c8:	c3                   	ret
+
+000007c9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 7c9:	55                   	push   %ebp
+ 7ca:	89 e5                	mov    %esp,%ebp
+ 7cc:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 7cf:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7d6:	77 07                	ja     7df <morecore+0x16>
+    nu = 4096;
+ 7d8:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e2:	c1 e0 03             	shl    $0x3,%eax
+ 7e5:	83 ec 0c             	sub    $0xc,%esp
+ 7e8:	50                   	push   %eax
+ 7e9:	e8 43 fc ff ff       	call   431 <sbrk>
+ 7ee:	83 c4 10             	add    $0x10,%esp
+ 7f1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7f4:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7f8:	75 07                	jne    801 <morecore+0x38>
+    return 0;
+ 7fa:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7ff:	eb 26                	jmp    827 <morecore+0x5e>
+  hp = (Header*)p;
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 807:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 80a:	8b 55 08             	mov    0x8(%ebp),%edx
+ 80d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 810:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 813:	83 c0 08             	add    $0x8,%eax
+ 816:	83 ec 0c             	sub    $0xc,%esp
+ 819:	50                   	push   %eax
+ 81a:	e8 c8 fe ff ff       	call   6e7 <free>
+ 81f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 822:	a1 e8 0c 00 00       	mov    0xce8,%eax
+}
+ 827:	c9                   	leave
+ 828:	c3                   	ret
+
+00000829 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 829:	55                   	push   %ebp
+ 82a:	89 e5                	mov    %esp,%ebp
+ 82c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 82f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 832:	83 c0 07             	add    $0x7,%eax
+ 835:	c1 e8 03             	shr    $0x3,%eax
+ 838:	83 c0 01             	add    $0x1,%eax
+ 83b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 83e:	a1 e8 0c 00 00       	mov    0xce8,%eax
+ 843:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 846:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 84a:	75 23                	jne    86f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 84c:	c7 45 f0 e0 0c 00 00 	movl   $0xce0,-0x10(%ebp)
+ 853:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 856:	a3 e8 0c 00 00       	mov    %eax,0xce8
+ 85b:	a1 e8 0c 00 00       	mov    0xce8,%eax
+ 860:	a3 e0 0c 00 00       	mov    %eax,0xce0
+    base.s.size = 0;
+ 865:	c7 05 e4 0c 00 00 00 	movl   $0x0,0xce4
+ 86c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 86f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87a:	8b 40 04             	mov    0x4(%eax),%eax
+ 87d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 880:	72 4d                	jb     8cf <malloc+0xa6>
+      if(p->s.size == nunits)
+ 882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 885:	8b 40 04             	mov    0x4(%eax),%eax
+ 888:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 88b:	75 0c                	jne    899 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 88d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 890:	8b 10                	mov    (%eax),%edx
+ 892:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 895:	89 10                	mov    %edx,(%eax)
+ 897:	eb 26                	jmp    8bf <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89c:	8b 40 04             	mov    0x4(%eax),%eax
+ 89f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8a2:	89 c2                	mov    %eax,%edx
+ 8a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ad:	8b 40 04             	mov    0x4(%eax),%eax
+ 8b0:	c1 e0 03             	shl    $0x3,%eax
+ 8b3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8bc:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c2:	a3 e8 0c 00 00       	mov    %eax,0xce8
+      return (void*)(p + 1);
+ 8c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	eb 3b                	jmp    90a <malloc+0xe1>
+    }
+    if(p == freep)
+ 8cf:	a1 e8 0c 00 00       	mov    0xce8,%eax
+ 8d4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8d7:	75 1e                	jne    8f7 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 ec 0c             	sub    $0xc,%esp
+ 8dc:	ff 75 ec             	push   -0x14(%ebp)
+ 8df:	e8 e5 fe ff ff       	call   7c9 <morecore>
+ 8e4:	83 c4 10             	add    $0x10,%esp
+ 8e7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ee:	75 07                	jne    8f7 <malloc+0xce>
+        return 0;
+ 8f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8f5:	eb 13                	jmp    90a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 900:	8b 00                	mov    (%eax),%eax
+ 902:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 905:	e9 6d ff ff ff       	jmp    877 <malloc+0x4e>
+  }
+}
+ 90a:	c9                   	leave
+ 90b:	c3                   	ret
+
+0000090c <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 90c:	55                   	push   %ebp
+ 90d:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 90f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 912:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 915:	7e 08                	jle    91f <ticks+0x13>
+ 917:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 91a:	2b 45 08             	sub    0x8(%ebp),%eax
+ 91d:	eb 05                	jmp    924 <ticks+0x18>
+ 91f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 924:	5d                   	pop    %ebp
+ 925:	c3                   	ret
+
+00000926 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 926:	55                   	push   %ebp
+ 927:	89 e5                	mov    %esp,%ebp
+ 929:	53                   	push   %ebx
+ 92a:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 92d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 930:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 933:	ff 75 14             	push   0x14(%ebp)
+ 936:	ff 75 10             	push   0x10(%ebp)
+ 939:	e8 ce ff ff ff       	call   90c <ticks>
+ 93e:	83 c4 08             	add    $0x8,%esp
+ 941:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 943:	89 d8                	mov    %ebx,%eax
+ 945:	99                   	cltd
+ 946:	f7 f9                	idiv   %ecx
+ 948:	89 c2                	mov    %eax,%edx
+ 94a:	8b 45 14             	mov    0x14(%ebp),%eax
+ 94d:	2b 45 10             	sub    0x10(%ebp),%eax
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	ff 75 0c             	push   0xc(%ebp)
+ 956:	52                   	push   %edx
+ 957:	50                   	push   %eax
+ 958:	ff 75 0c             	push   0xc(%ebp)
+ 95b:	ff 75 08             	push   0x8(%ebp)
+ 95e:	68 e4 09 00 00       	push   $0x9e4
+ 963:	6a 01                	push   $0x1
+ 965:	e8 eb fb ff ff       	call   555 <printf>
+ 96a:	83 c4 20             	add    $0x20,%esp
+}
+ 96d:	90                   	nop
+ 96e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 971:	c9                   	leave
+ 972:	c3                   	ret
+
+00000973 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 973:	55                   	push   %ebp
+ 974:	89 e5                	mov    %esp,%ebp
+ 976:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 979:	ff 75 14             	push   0x14(%ebp)
+ 97c:	ff 75 10             	push   0x10(%ebp)
+ 97f:	e8 88 ff ff ff       	call   90c <ticks>
+ 984:	83 c4 08             	add    $0x8,%esp
+ 987:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 98d:	99                   	cltd
+ 98e:	f7 7d 08             	idivl  0x8(%ebp)
+ 991:	89 c2                	mov    %eax,%edx
+ 993:	8b 45 14             	mov    0x14(%ebp),%eax
+ 996:	2b 45 10             	sub    0x10(%ebp),%eax
+ 999:	83 ec 08             	sub    $0x8,%esp
+ 99c:	52                   	push   %edx
+ 99d:	50                   	push   %eax
+ 99e:	ff 75 0c             	push   0xc(%ebp)
+ 9a1:	ff 75 08             	push   0x8(%ebp)
+ 9a4:	68 04 0a 00 00       	push   $0xa04
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	e8 a5 fb ff ff       	call   555 <printf>
+ 9b0:	83 c4 20             	add    $0x20,%esp
+}
+ 9b3:	90                   	nop
+ 9b4:	c9                   	leave
+ 9b5:	c3                   	ret
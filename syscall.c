@@ -19,12 +19,15 @@ fetchint(uint addr, int *ip)
 {
   if(addr >= proc->sz || addr+4 > proc->sz)
     return -1;
+  if(uvmprefault(addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
 
 // Fetch the nul-terminated string at addr from the current process.
 // Doesn't actually copy the string - just sets *pp to point at it.
+// Faults in each page of the string before looking at it.
 // Returns length of string, not including nul.
 int
 fetchstr(uint addr, char **pp)
@@ -35,9 +38,12 @@ fetchstr(uint addr, char **pp)
     return -1;
   *pp = (char*)addr;
   ep = (char*)proc->sz;
-  for(s = *pp; s < ep; s++)
+  for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) && uvmprefault((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
+  }
   return -1;
 }
 
@@ -50,9 +56,11 @@ argint(int n, int *ip)
 
 // Fetch the nth word-sized system call argument as a pointer
 // to a block of memory of size n bytes.  Check that the pointer
-// lies within the process address space.
+// lies within the process address space, and fault the block in.
+// Set write if the kernel will write the block, to also break
+// copy-on-write sharing; blocks the kernel only reads stay shared.
 int
-argptr(int n, char **pp, int size)
+argptr(int n, char **pp, int size, int write)
 {
   int i;
   
@@ -60,6 +68,8 @@ argptr(int n, char **pp, int size)
     return -1;
   if((uint)i >= proc->sz || (uint)i+size > proc->sz)
     return -1;
+  if(uvmprefault(i, size, write) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
@@ -99,6 +109,12 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_enable_sched_trace(void);
+extern int sys_getschedstat(void);
+extern int sys_setschedpolicy(void);
+extern int sys_setshare(void);
+extern int sys_getbcachestat(void);
+extern int sys_getdiskstat(void);
+extern int sys_getlogstat(void);
 
 
 static int (*syscalls[])(void) = {
@@ -124,6 +140,12 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
 [SYS_enable_sched_trace]   sys_enable_sched_trace,
+[SYS_getschedstat]   sys_getschedstat,
+[SYS_setschedpolicy]   sys_setschedpolicy,
+[SYS_setshare]   sys_setshare,
+[SYS_getbcachestat]   sys_getbcachestat,
+[SYS_getdiskstat]   sys_getdiskstat,
+[SYS_getlogstat]    sys_getlogstat,
 
 };
 
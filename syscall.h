@@ -21,4 +21,10 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_enable_sched_trace  22
+#define SYS_getschedstat  23
+#define SYS_setschedpolicy  24
+#define SYS_setshare  25
+#define SYS_getbcachestat  26
+#define SYS_getdiskstat  27
+#define SYS_getlogstat   28
 
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "schedstat.h"
 
 int
 sys_fork(void)
@@ -64,14 +65,19 @@ sys_sleep(void)
   
   if(argint(0, &n) < 0)
     return -1;
+  if(n <= 0)
+    return 0;
   acquire(&tickslock);
   ticks0 = ticks;
+  proc->wakeat = ticks0 + n;
+  timeradd(proc);
   while(ticks - ticks0 < n){
     if(proc->killed){
+      timerdel(proc);
       release(&tickslock);
       return -1;
     }
-    sleep(&ticks, &tickslock);
+    sleep(&proc->wakeat, &tickslock);
   }
   release(&tickslock);
   return 0;
@@ -100,3 +106,34 @@ int sys_enable_sched_trace(void)
 
   return 0;
 }
+
+int
+sys_getschedstat(void)
+{
+  int n;
+  struct schedstat *st;
+
+  if(argint(0, &n) < 0 || argptr(1, (void*)&st, sizeof(*st), 1) < 0)
+    return -1;
+  return getschedstat(n, st);
+}
+
+int
+sys_setschedpolicy(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setschedpolicy(policy);
+}
+
+int
+sys_setshare(void)
+{
+  int pid, tickets;
+
+  if(argint(0, &pid) < 0 || argint(1, &tickets) < 0)
+    return -1;
+  return setshare(pid, tickets);
+}
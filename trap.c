@@ -13,6 +13,17 @@ struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+int diskirq;  // IRQ of a disk whose line is assigned at boot, or 0
+
+// Timer wheel for sys_sleep.  A sleeping process is linked
+// into the slot for its wake-up tick, and the tick handler
+// looks only at the current slot, so each tick costs time
+// proportional to the timers in that slot rather than
+// waking every sleeper to recheck its deadline.
+// Protected by tickslock.
+#define NTIMERWHEEL 128
+
+static struct proc *timerwheel[NTIMERWHEEL];
 
 void
 tvinit(void)
@@ -26,6 +37,52 @@ tvinit(void)
   initlock(&tickslock, "time");
 }
 
+// Arrange for p to be woken at tick p->wakeat.
+// Caller must hold tickslock.
+void
+timeradd(struct proc *p)
+{
+  struct proc **slot;
+
+  slot = &timerwheel[p->wakeat % NTIMERWHEEL];
+  p->tnext = *slot;
+  *slot = p;
+}
+
+// Cancel p's timer if it has not expired yet.
+// Caller must hold tickslock.
+void
+timerdel(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &timerwheel[p->wakeat % NTIMERWHEEL]; *pp; pp = &(*pp)->tnext){
+    if(*pp == p){
+      *pp = p->tnext;
+      p->tnext = 0;
+      return;
+    }
+  }
+}
+
+// Wake the processes whose timers expire at this tick.
+// Caller must hold tickslock.
+static void
+timerexpire(void)
+{
+  struct proc **pp, *p;
+
+  pp = &timerwheel[ticks % NTIMERWHEEL];
+  while((p = *pp) != 0){
+    if(p->wakeat == ticks){
+      *pp = p->tnext;
+      p->tnext = 0;
+      wakeup(&p->wakeat);
+    } else
+      pp = &p->tnext;
+  }
+}
+
 void
 idtinit(void)
 {
@@ -51,9 +108,13 @@ trap(struct trapframe *tf)
     if(cpu->id == 0){
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      if(ticks % MLFQBOOST == 0)
+        priboost();
+      timerexpire();
       release(&tickslock);
     }
+    if(proc == 0)
+      cpu->idleticks++;
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -77,9 +138,21 @@ trap(struct trapframe *tf)
             cpu->id, tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    // Copy-on-write and other recoverable faults on user
+    // addresses, from user code or from the kernel
+    // touching user memory in a system call.
+    if(proc && pagefault(rcr2(), tf->err) == 0)
+      break;
+    // fall through
    
   //PAGEBREAK: 13
   default:
+    if(diskirq && tf->trapno == T_IRQ0 + diskirq){
+      ideintr();
+      lapiceoi();
+      break;
+    }
     if(proc == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -100,9 +173,11 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick
+  // once it has used up its time slice.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     timeslice())
     yield();
 
   // Check if the process has been killed since we yielded
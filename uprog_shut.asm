@@ -0,0 +1,1250 @@
+
+_uprog_shut:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <shutdown>:
+   stub functions for the system call user space wrapper functions are provided. 
+   REMEMBER to disable the stub functions (by commenting the following macro) to 
+   allow your implementation to work properly. */
+#define STUB_FUNCS
+#ifdef STUB_FUNCS
+void shutdown(void) {}
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	90                   	nop
+   4:	5d                   	pop    %ebp
+   5:	c3                   	ret
+
+00000006 <main>:
+#endif
+
+
+int 
+main(int argc, char * argv[])
+{
+   6:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   a:	83 e4 f0             	and    $0xfffffff0,%esp
+   d:	ff 71 fc             	push   -0x4(%ecx)
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	51                   	push   %ecx
+  14:	83 ec 04             	sub    $0x4,%esp
+    printf(1, "BYE~\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 98 08 00 00       	push   $0x898
+  1f:	6a 01                	push   $0x1
+  21:	e8 10 04 00 00       	call   436 <printf>
+  26:	83 c4 10             	add    $0x10,%esp
+    shutdown();
+  29:	e8 d2 ff ff ff       	call   0 <shutdown>
+    exit(); //return 0;
+  2e:	e8 57 02 00 00       	call   28a <exit>
+
+00000033 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  33:	55                   	push   %ebp
+  34:	89 e5                	mov    %esp,%ebp
+  36:	57                   	push   %edi
+  37:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  38:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  41:	89 cb                	mov    %ecx,%ebx
+  43:	89 df                	mov    %ebx,%edi
+  45:	89 d1                	mov    %edx,%ecx
+  47:	fc                   	cld
+  48:	f3 aa                	rep stos %al,%es:(%edi)
+  4a:	89 ca                	mov    %ecx,%edx
+  4c:	89 fb                	mov    %edi,%ebx
+  4e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  51:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  54:	90                   	nop
+  55:	5b                   	pop    %ebx
+  56:	5f                   	pop    %edi
+  57:	5d                   	pop    %ebp
+  58:	c3                   	ret
+
+00000059 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  59:	55                   	push   %ebp
+  5a:	89 e5                	mov    %esp,%ebp
+  5c:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  62:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  65:	90                   	nop
+  66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  69:	8d 42 01             	lea    0x1(%edx),%eax
+  6c:	89 45 0c             	mov    %eax,0xc(%ebp)
+  6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  72:	8d 48 01             	lea    0x1(%eax),%ecx
+  75:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  78:	0f b6 12             	movzbl (%edx),%edx
+  7b:	88 10                	mov    %dl,(%eax)
+  7d:	0f b6 00             	movzbl (%eax),%eax
+  80:	84 c0                	test   %al,%al
+  82:	75 e2                	jne    66 <strcpy+0xd>
+    ;
+  return os;
+  84:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  87:	c9                   	leave
+  88:	c3                   	ret
+
+00000089 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  89:	55                   	push   %ebp
+  8a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  8c:	eb 08                	jmp    96 <strcmp+0xd>
+    p++, q++;
+  8e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  92:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  96:	8b 45 08             	mov    0x8(%ebp),%eax
+  99:	0f b6 00             	movzbl (%eax),%eax
+  9c:	84 c0                	test   %al,%al
+  9e:	74 10                	je     b0 <strcmp+0x27>
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	0f b6 10             	movzbl (%eax),%edx
+  a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a9:	0f b6 00             	movzbl (%eax),%eax
+  ac:	38 c2                	cmp    %al,%dl
+  ae:	74 de                	je     8e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	0f b6 00             	movzbl (%eax),%eax
+  b6:	0f b6 d0             	movzbl %al,%edx
+  b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	0f b6 c0             	movzbl %al,%eax
+  c2:	29 c2                	sub    %eax,%edx
+  c4:	89 d0                	mov    %edx,%eax
+}
+  c6:	5d                   	pop    %ebp
+  c7:	c3                   	ret
+
+000000c8 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  cb:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  d5:	eb 04                	jmp    db <strlen+0x13>
+  d7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  de:	8b 45 08             	mov    0x8(%ebp),%eax
+  e1:	01 d0                	add    %edx,%eax
+  e3:	0f b6 00             	movzbl (%eax),%eax
+  e6:	84 c0                	test   %al,%al
+  e8:	75 ed                	jne    d7 <strlen+0xf>
+    ;
+  return n;
+  ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  ed:	c9                   	leave
+  ee:	c3                   	ret
+
+000000ef <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  ef:	55                   	push   %ebp
+  f0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  f5:	50                   	push   %eax
+  f6:	ff 75 0c             	push   0xc(%ebp)
+  f9:	ff 75 08             	push   0x8(%ebp)
+  fc:	e8 32 ff ff ff       	call   33 <stosb>
+ 101:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 104:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+
+00000109 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 04             	sub    $0x4,%esp
+ 10f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 112:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 115:	eb 14                	jmp    12b <strchr+0x22>
+    if(*s == c)
+ 117:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11a:	0f b6 00             	movzbl (%eax),%eax
+ 11d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 120:	75 05                	jne    127 <strchr+0x1e>
+      return (char*)s;
+ 122:	8b 45 08             	mov    0x8(%ebp),%eax
+ 125:	eb 13                	jmp    13a <strchr+0x31>
+  for(; *s; s++)
+ 127:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	84 c0                	test   %al,%al
+ 133:	75 e2                	jne    117 <strchr+0xe>
+  return 0;
+ 135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 13a:	c9                   	leave
+ 13b:	c3                   	ret
+
+0000013c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 142:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 149:	eb 42                	jmp    18d <gets+0x51>
+    cc = read(0, &c, 1);
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	6a 01                	push   $0x1
+ 150:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 153:	50                   	push   %eax
+ 154:	6a 00                	push   $0x0
+ 156:	e8 47 01 00 00       	call   2a2 <read>
+ 15b:	83 c4 10             	add    $0x10,%esp
+ 15e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 161:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 165:	7e 33                	jle    19a <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 167:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16a:	8d 50 01             	lea    0x1(%eax),%edx
+ 16d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 170:	89 c2                	mov    %eax,%edx
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	01 c2                	add    %eax,%edx
+ 177:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 17d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 181:	3c 0a                	cmp    $0xa,%al
+ 183:	74 16                	je     19b <gets+0x5f>
+ 185:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 189:	3c 0d                	cmp    $0xd,%al
+ 18b:	74 0e                	je     19b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 18d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 196:	7f b3                	jg     14b <gets+0xf>
+ 198:	eb 01                	jmp    19b <gets+0x5f>
+      break;
+ 19a:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 19b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 19e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a1:	01 d0                	add    %edx,%eax
+ 1a3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a9:	c9                   	leave
+ 1aa:	c3                   	ret
+
+000001ab <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ab:	55                   	push   %ebp
+ 1ac:	89 e5                	mov    %esp,%ebp
+ 1ae:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	ff 75 08             	push   0x8(%ebp)
+ 1b9:	e8 0c 01 00 00       	call   2ca <open>
+ 1be:	83 c4 10             	add    $0x10,%esp
+ 1c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c8:	79 07                	jns    1d1 <stat+0x26>
+    return -1;
+ 1ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1cf:	eb 25                	jmp    1f6 <stat+0x4b>
+  r = fstat(fd, st);
+ 1d1:	83 ec 08             	sub    $0x8,%esp
+ 1d4:	ff 75 0c             	push   0xc(%ebp)
+ 1d7:	ff 75 f4             	push   -0xc(%ebp)
+ 1da:	e8 03 01 00 00       	call   2e2 <fstat>
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1e5:	83 ec 0c             	sub    $0xc,%esp
+ 1e8:	ff 75 f4             	push   -0xc(%ebp)
+ 1eb:	e8 c2 00 00 00       	call   2b2 <close>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1f6:	c9                   	leave
+ 1f7:	c3                   	ret
+
+000001f8 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f8:	55                   	push   %ebp
+ 1f9:	89 e5                	mov    %esp,%ebp
+ 1fb:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 205:	eb 25                	jmp    22c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 207:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 20a:	89 d0                	mov    %edx,%eax
+ 20c:	c1 e0 02             	shl    $0x2,%eax
+ 20f:	01 d0                	add    %edx,%eax
+ 211:	01 c0                	add    %eax,%eax
+ 213:	89 c1                	mov    %eax,%ecx
+ 215:	8b 45 08             	mov    0x8(%ebp),%eax
+ 218:	8d 50 01             	lea    0x1(%eax),%edx
+ 21b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 21e:	0f b6 00             	movzbl (%eax),%eax
+ 221:	0f be c0             	movsbl %al,%eax
+ 224:	01 c8                	add    %ecx,%eax
+ 226:	83 e8 30             	sub    $0x30,%eax
+ 229:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 22c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22f:	0f b6 00             	movzbl (%eax),%eax
+ 232:	3c 2f                	cmp    $0x2f,%al
+ 234:	7e 0a                	jle    240 <atoi+0x48>
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	3c 39                	cmp    $0x39,%al
+ 23e:	7e c7                	jle    207 <atoi+0xf>
+  return n;
+ 240:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+
+00000245 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 245:	55                   	push   %ebp
+ 246:	89 e5                	mov    %esp,%ebp
+ 248:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 251:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 254:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 257:	eb 17                	jmp    270 <memmove+0x2b>
+    *dst++ = *src++;
+ 259:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 25c:	8d 42 01             	lea    0x1(%edx),%eax
+ 25f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 262:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 265:	8d 48 01             	lea    0x1(%eax),%ecx
+ 268:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 26b:	0f b6 12             	movzbl (%edx),%edx
+ 26e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 270:	8b 45 10             	mov    0x10(%ebp),%eax
+ 273:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 276:	89 55 10             	mov    %edx,0x10(%ebp)
+ 279:	85 c0                	test   %eax,%eax
+ 27b:	7f dc                	jg     259 <memmove+0x14>
+  return vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 280:	c9                   	leave
+ 281:	c3                   	ret
+
+00000282 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 282:	b8 01 00 00 00       	mov    $0x1,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+0000028a <exit>:
+SYSCALL(exit)
+ 28a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+00000292 <wait>:
+SYSCALL(wait)
+ 292:	b8 03 00 00 00       	mov    $0x3,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+0000029a <pipe>:
+SYSCALL(pipe)
+ 29a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+000002a2 <read>:
+SYSCALL(read)
+ 2a2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+000002aa <write>:
+SYSCALL(write)
+ 2aa:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <close>:
+SYSCALL(close)
+ 2b2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <kill>:
+SYSCALL(kill)
+ 2ba:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <exec>:
+SYSCALL(exec)
+ 2c2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <open>:
+SYSCALL(open)
+ 2ca:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <mknod>:
+SYSCALL(mknod)
+ 2d2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <unlink>:
+SYSCALL(unlink)
+ 2da:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <fstat>:
+SYSCALL(fstat)
+ 2e2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <link>:
+SYSCALL(link)
+ 2ea:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <mkdir>:
+SYSCALL(mkdir)
+ 2f2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <chdir>:
+SYSCALL(chdir)
+ 2fa:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <dup>:
+SYSCALL(dup)
+ 302:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <getpid>:
+SYSCALL(getpid)
+ 30a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <sbrk>:
+SYSCALL(sbrk)
+ 312:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <sleep>:
+SYSCALL(sleep)
+ 31a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <uptime>:
+SYSCALL(uptime)
+ 322:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 32a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <getschedstat>:
+SYSCALL(getschedstat)
+ 332:	b8 17 00 00 00       	mov    $0x17,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 33a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <setshare>:
+SYSCALL(setshare)
+ 342:	b8 19 00 00 00       	mov    $0x19,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <getbcachestat>:
+SYSCALL(getbcachestat)
+ 34a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <getdiskstat>:
+SYSCALL(getdiskstat)
+ 352:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <getlogstat>:
+SYSCALL(getlogstat)
+ 35a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 362:	55                   	push   %ebp
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	83 ec 18             	sub    $0x18,%esp
+ 368:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 36e:	83 ec 04             	sub    $0x4,%esp
+ 371:	6a 01                	push   $0x1
+ 373:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 376:	50                   	push   %eax
+ 377:	ff 75 08             	push   0x8(%ebp)
+ 37a:	e8 2b ff ff ff       	call   2aa <write>
+ 37f:	83 c4 10             	add    $0x10,%esp
+}
+ 382:	90                   	nop
+ 383:	c9                   	leave
+ 384:	c3                   	ret
+
+00000385 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 385:	55                   	push   %ebp
+ 386:	89 e5                	mov    %esp,%ebp
+ 388:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 38b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 392:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 396:	74 17                	je     3af <printint+0x2a>
+ 398:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 39c:	79 11                	jns    3af <printint+0x2a>
+    neg = 1;
+ 39e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 3a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a8:	f7 d8                	neg    %eax
+ 3aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3ad:	eb 06                	jmp    3b5 <printint+0x30>
+  } else {
+    x = xx;
+ 3af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3b5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3bc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3bf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3c2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3c7:	f7 f1                	div    %ecx
+ 3c9:	89 d1                	mov    %edx,%ecx
+ 3cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ce:	8d 50 01             	lea    0x1(%eax),%edx
+ 3d1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3d4:	0f b6 91 b0 0b 00 00 	movzbl 0xbb0(%ecx),%edx
+ 3db:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 3df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3e2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3e5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3ea:	f7 f1                	div    %ecx
+ 3ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 3f3:	75 c7                	jne    3bc <printint+0x37>
+  if(neg)
+ 3f5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3f9:	74 2d                	je     428 <printint+0xa3>
+    buf[i++] = '-';
+ 3fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3fe:	8d 50 01             	lea    0x1(%eax),%edx
+ 401:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 404:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 409:	eb 1d                	jmp    428 <printint+0xa3>
+    putc(fd, buf[i]);
+ 40b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 40e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 411:	01 d0                	add    %edx,%eax
+ 413:	0f b6 00             	movzbl (%eax),%eax
+ 416:	0f be c0             	movsbl %al,%eax
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	50                   	push   %eax
+ 41d:	ff 75 08             	push   0x8(%ebp)
+ 420:	e8 3d ff ff ff       	call   362 <putc>
+ 425:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 428:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 42c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 430:	79 d9                	jns    40b <printint+0x86>
+}
+ 432:	90                   	nop
+ 433:	90                   	nop
+ 434:	c9                   	leave
+ 435:	c3                   	ret
+
+00000436 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 436:	55                   	push   %ebp
+ 437:	89 e5                	mov    %esp,%ebp
+ 439:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 43c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 443:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 446:	83 c0 04             	add    $0x4,%eax
+ 449:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 44c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 453:	e9 59 01 00 00       	jmp    5b1 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 458:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 45b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 45e:	01 d0                	add    %edx,%eax
+ 460:	0f b6 00             	movzbl (%eax),%eax
+ 463:	0f be c0             	movsbl %al,%eax
+ 466:	25 ff 00 00 00       	and    $0xff,%eax
+ 46b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 46e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 472:	75 2c                	jne    4a0 <printf+0x6a>
+      if(c == '%'){
+ 474:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 478:	75 0c                	jne    486 <printf+0x50>
+        state = '%';
+ 47a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 481:	e9 27 01 00 00       	jmp    5ad <printf+0x177>
+      } else {
+        putc(fd, c);
+ 486:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 489:	0f be c0             	movsbl %al,%eax
+ 48c:	83 ec 08             	sub    $0x8,%esp
+ 48f:	50                   	push   %eax
+ 490:	ff 75 08             	push   0x8(%ebp)
+ 493:	e8 ca fe ff ff       	call   362 <putc>
+ 498:	83 c4 10             	add    $0x10,%esp
+ 49b:	e9 0d 01 00 00       	jmp    5ad <printf+0x177>
+      }
+    } else if(state == '%'){
+ 4a0:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 4a4:	0f 85 03 01 00 00    	jne    5ad <printf+0x177>
+      if(c == 'd'){
+ 4aa:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4ae:	75 1e                	jne    4ce <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4b0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4b3:	8b 00                	mov    (%eax),%eax
+ 4b5:	6a 01                	push   $0x1
+ 4b7:	6a 0a                	push   $0xa
+ 4b9:	50                   	push   %eax
+ 4ba:	ff 75 08             	push   0x8(%ebp)
+ 4bd:	e8 c3 fe ff ff       	call   385 <printint>
+ 4c2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4c5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4c9:	e9 d8 00 00 00       	jmp    5a6 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 4ce:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 4d2:	74 06                	je     4da <printf+0xa4>
+ 4d4:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 4d8:	75 1e                	jne    4f8 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 4da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4dd:	8b 00                	mov    (%eax),%eax
+ 4df:	6a 00                	push   $0x0
+ 4e1:	6a 10                	push   $0x10
+ 4e3:	50                   	push   %eax
+ 4e4:	ff 75 08             	push   0x8(%ebp)
+ 4e7:	e8 99 fe ff ff       	call   385 <printint>
+ 4ec:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4ef:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4f3:	e9 ae 00 00 00       	jmp    5a6 <printf+0x170>
+      } else if(c == 's'){
+ 4f8:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 4fc:	75 43                	jne    541 <printf+0x10b>
+        s = (char*)*ap;
+ 4fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 501:	8b 00                	mov    (%eax),%eax
+ 503:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 506:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 50a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 50e:	75 25                	jne    535 <printf+0xff>
+          s = "(null)";
+ 510:	c7 45 f4 9e 08 00 00 	movl   $0x89e,-0xc(%ebp)
+        while(*s != 0){
+ 517:	eb 1c                	jmp    535 <printf+0xff>
+          putc(fd, *s);
+ 519:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 51c:	0f b6 00             	movzbl (%eax),%eax
+ 51f:	0f be c0             	movsbl %al,%eax
+ 522:	83 ec 08             	sub    $0x8,%esp
+ 525:	50                   	push   %eax
+ 526:	ff 75 08             	push   0x8(%ebp)
+ 529:	e8 34 fe ff ff       	call   362 <putc>
+ 52e:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 531:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 538:	0f b6 00             	movzbl (%eax),%eax
+ 53b:	84 c0                	test   %al,%al
+ 53d:	75 da                	jne    519 <printf+0xe3>
+ 53f:	eb 65                	jmp    5a6 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 541:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 545:	75 1d                	jne    564 <printf+0x12e>
+        putc(fd, *ap);
+ 547:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 54a:	8b 00                	mov    (%eax),%eax
+ 54c:	0f be c0             	movsbl %al,%eax
+ 54f:	83 ec 08             	sub    $0x8,%esp
+ 552:	50                   	push   %eax
+ 553:	ff 75 08             	push   0x8(%ebp)
+ 556:	e8 07 fe ff ff       	call   362 <putc>
+ 55b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 55e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 562:	eb 42                	jmp    5a6 <printf+0x170>
+      } else if(c == '%'){
+ 564:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 568:	75 17                	jne    581 <printf+0x14b>
+        putc(fd, c);
+ 56a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 56d:	0f be c0             	movsbl %al,%eax
+ 570:	83 ec 08             	sub    $0x8,%esp
+ 573:	50                   	push   %eax
+ 574:	ff 75 08             	push   0x8(%ebp)
+ 577:	e8 e6 fd ff ff       	call   362 <putc>
+ 57c:	83 c4 10             	add    $0x10,%esp
+ 57f:	eb 25                	jmp    5a6 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 581:	83 ec 08             	sub    $0x8,%esp
+ 584:	6a 25                	push   $0x25
+ 586:	ff 75 08             	push   0x8(%ebp)
+ 589:	e8 d4 fd ff ff       	call   362 <putc>
+ 58e:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 591:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 594:	0f be c0             	movsbl %al,%eax
+ 597:	83 ec 08             	sub    $0x8,%esp
+ 59a:	50                   	push   %eax
+ 59b:	ff 75 08             	push   0x8(%ebp)
+ 59e:	e8 bf fd ff ff       	call   362 <putc>
+ 5a3:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 5a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5ad:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5b7:	01 d0                	add    %edx,%eax
+ 5b9:	0f b6 00             	movzbl (%eax),%eax
+ 5bc:	84 c0                	test   %al,%al
+ 5be:	0f 85 94 fe ff ff    	jne    458 <printf+0x22>
+    }
+  }
+}
+ 5c4:	90                   	nop
+ 5c5:	90                   	nop
+ 5c6:	c9                   	leave
+ 5c7:	c3                   	ret
+
+000005c8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c8:	55                   	push   %ebp
+ 5c9:	89 e5                	mov    %esp,%ebp
+ 5cb:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d1:	83 e8 08             	sub    $0x8,%eax
+ 5d4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d7:	a1 cc 0b 00 00       	mov    0xbcc,%eax
+ 5dc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 5df:	eb 24                	jmp    605 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5e4:	8b 00                	mov    (%eax),%eax
+ 5e6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5e9:	72 12                	jb     5fd <free+0x35>
+ 5eb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 5ee:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5f1:	72 24                	jb     617 <free+0x4f>
+ 5f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5f6:	8b 00                	mov    (%eax),%eax
+ 5f8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 5fb:	72 1a                	jb     617 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 600:	8b 00                	mov    (%eax),%eax
+ 602:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 605:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 608:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 60b:	73 d4                	jae    5e1 <free+0x19>
+ 60d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 610:	8b 00                	mov    (%eax),%eax
+ 612:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 615:	73 ca                	jae    5e1 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 617:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 61a:	8b 40 04             	mov    0x4(%eax),%eax
+ 61d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 624:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 627:	01 c2                	add    %eax,%edx
+ 629:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 62c:	8b 00                	mov    (%eax),%eax
+ 62e:	39 c2                	cmp    %eax,%edx
+ 630:	75 24                	jne    656 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 632:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 635:	8b 50 04             	mov    0x4(%eax),%edx
+ 638:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 63b:	8b 00                	mov    (%eax),%eax
+ 63d:	8b 40 04             	mov    0x4(%eax),%eax
+ 640:	01 c2                	add    %eax,%edx
+ 642:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 645:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 648:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 64b:	8b 00                	mov    (%eax),%eax
+ 64d:	8b 10                	mov    (%eax),%edx
+ 64f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 652:	89 10                	mov    %edx,(%eax)
+ 654:	eb 0a                	jmp    660 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 656:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 659:	8b 10                	mov    (%eax),%edx
+ 65b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 65e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 660:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 663:	8b 40 04             	mov    0x4(%eax),%eax
+ 666:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 66d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 670:	01 d0                	add    %edx,%eax
+ 672:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 675:	75 20                	jne    697 <free+0xcf>
+    p->s.size += bp->s.size;
+ 677:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67a:	8b 50 04             	mov    0x4(%eax),%edx
+ 67d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 680:	8b 40 04             	mov    0x4(%eax),%eax
+ 683:	01 c2                	add    %eax,%edx
+ 685:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 688:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 68b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 68e:	8b 10                	mov    (%eax),%edx
+ 690:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 693:	89 10                	mov    %edx,(%eax)
+ 695:	eb 08                	jmp    69f <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 697:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 69d:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 69f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a2:	a3 cc 0b 00 00       	mov    %eax,0xbcc
+}
+ 6a7:	90                   	nop
+ 6a8:	c9                   	leave
+ 6a9:	c3                   	ret
+
+000006aa <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6aa:	55                   	push   %ebp
+ 6ab:	89 e5                	mov    %esp,%ebp
+ 6ad:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6b0:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6b7:	77 07                	ja     6c0 <morecore+0x16>
+    nu = 4096;
+ 6b9:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 6c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c3:	c1 e0 03             	shl    $0x3,%eax
+ 6c6:	83 ec 0c             	sub    $0xc,%esp
+ 6c9:	50                   	push   %eax
+ 6ca:	e8 43 fc ff ff       	call   312 <sbrk>
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 6d5:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 6d9:	75 07                	jne    6e2 <morecore+0x38>
+    return 0;
+ 6db:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6e0:	eb 26                	jmp    708 <morecore+0x5e>
+  hp = (Header*)p;
+ 6e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 6e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6eb:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ee:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6f4:	83 c0 08             	add    $0x8,%eax
+ 6f7:	83 ec 0c             	sub    $0xc,%esp
+ 6fa:	50                   	push   %eax
+ 6fb:	e8 c8 fe ff ff       	call   5c8 <free>
+ 700:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 703:	a1 cc 0b 00 00       	mov    0xbcc,%eax
+}
+ 708:	c9                   	leave
+ 709:	c3                   	ret
+
+0000070a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 70a:	55                   	push   %ebp
+ 70b:	89 e5                	mov    %esp,%ebp
+ 70d:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 710:	8b 45 08             	mov    0x8(%ebp),%eax
+ 713:	83 c0 07             	add    $0x7,%eax
+ 716:	c1 e8 03             	shr    $0x3,%eax
+ 719:	83 c0 01             	add    $0x1,%eax
+ 71c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 71f:	a1 cc 0b 00 00       	mov    0xbcc,%eax
+ 724:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 727:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 72b:	75 23                	jne    750 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 72d:	c7 45 f0 c4 0b 00 00 	movl   $0xbc4,-0x10(%ebp)
+ 734:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 737:	a3 cc 0b 00 00       	mov    %eax,0xbcc
+ 73c:	a1 cc 0b 00 00       	mov    0xbcc,%eax
+ 741:	a3 c4 0b 00 00       	mov    %eax,0xbc4
+    base.s.size = 0;
+ 746:	c7 05 c8 0b 00 00 00 	movl   $0x0,0xbc8
+ 74d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 750:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 753:	8b 00                	mov    (%eax),%eax
+ 755:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 758:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75b:	8b 40 04             	mov    0x4(%eax),%eax
+ 75e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 761:	72 4d                	jb     7b0 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 763:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 766:	8b 40 04             	mov    0x4(%eax),%eax
+ 769:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 76c:	75 0c                	jne    77a <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 76e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 771:	8b 10                	mov    (%eax),%edx
+ 773:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 776:	89 10                	mov    %edx,(%eax)
+ 778:	eb 26                	jmp    7a0 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 77a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77d:	8b 40 04             	mov    0x4(%eax),%eax
+ 780:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 783:	89 c2                	mov    %eax,%edx
+ 785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 788:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 78b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78e:	8b 40 04             	mov    0x4(%eax),%eax
+ 791:	c1 e0 03             	shl    $0x3,%eax
+ 794:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 79d:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 7a0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a3:	a3 cc 0b 00 00       	mov    %eax,0xbcc
+      return (void*)(p + 1);
+ 7a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ab:	83 c0 08             	add    $0x8,%eax
+ 7ae:	eb 3b                	jmp    7eb <malloc+0xe1>
+    }
+    if(p == freep)
+ 7b0:	a1 cc 0b 00 00       	mov    0xbcc,%eax
+ 7b5:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7b8:	75 1e                	jne    7d8 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7ba:	83 ec 0c             	sub    $0xc,%esp
+ 7bd:	ff 75 ec             	push   -0x14(%ebp)
+ 7c0:	e8 e5 fe ff ff       	call   6aa <morecore>
+ 7c5:	83 c4 10             	add    $0x10,%esp
+ 7c8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 7cb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7cf:	75 07                	jne    7d8 <malloc+0xce>
+        return 0;
+ 7d1:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7d6:	eb 13                	jmp    7eb <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e1:	8b 00                	mov    (%eax),%eax
+ 7e3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7e6:	e9 6d ff ff ff       	jmp    758 <malloc+0x4e>
+  }
+}
+ 7eb:	c9                   	leave
+ 7ec:	c3                   	ret
+
+000007ed <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 7ed:	55                   	push   %ebp
+ 7ee:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 7f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7f3:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 7f6:	7e 08                	jle    800 <ticks+0x13>
+ 7f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7fb:	2b 45 08             	sub    0x8(%ebp),%eax
+ 7fe:	eb 05                	jmp    805 <ticks+0x18>
+ 800:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 805:	5d                   	pop    %ebp
+ 806:	c3                   	ret
+
+00000807 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 807:	55                   	push   %ebp
+ 808:	89 e5                	mov    %esp,%ebp
+ 80a:	53                   	push   %ebx
+ 80b:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 80e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 811:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 814:	ff 75 14             	push   0x14(%ebp)
+ 817:	ff 75 10             	push   0x10(%ebp)
+ 81a:	e8 ce ff ff ff       	call   7ed <ticks>
+ 81f:	83 c4 08             	add    $0x8,%esp
+ 822:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 824:	89 d8                	mov    %ebx,%eax
+ 826:	99                   	cltd
+ 827:	f7 f9                	idiv   %ecx
+ 829:	89 c2                	mov    %eax,%edx
+ 82b:	8b 45 14             	mov    0x14(%ebp),%eax
+ 82e:	2b 45 10             	sub    0x10(%ebp),%eax
+ 831:	83 ec 04             	sub    $0x4,%esp
+ 834:	ff 75 0c             	push   0xc(%ebp)
+ 837:	52                   	push   %edx
+ 838:	50                   	push   %eax
+ 839:	ff 75 0c             	push   0xc(%ebp)
+ 83c:	ff 75 08             	push   0x8(%ebp)
+ 83f:	68 a8 08 00 00       	push   $0x8a8
+ 844:	6a 01                	push   $0x1
+ 846:	e8 eb fb ff ff       	call   436 <printf>
+ 84b:	83 c4 20             	add    $0x20,%esp
+}
+ 84e:	90                   	nop
+ 84f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 852:	c9                   	leave
+ 853:	c3                   	ret
+
+00000854 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 854:	55                   	push   %ebp
+ 855:	89 e5                	mov    %esp,%ebp
+ 857:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 85a:	ff 75 14             	push   0x14(%ebp)
+ 85d:	ff 75 10             	push   0x10(%ebp)
+ 860:	e8 88 ff ff ff       	call   7ed <ticks>
+ 865:	83 c4 08             	add    $0x8,%esp
+ 868:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 86e:	99                   	cltd
+ 86f:	f7 7d 08             	idivl  0x8(%ebp)
+ 872:	89 c2                	mov    %eax,%edx
+ 874:	8b 45 14             	mov    0x14(%ebp),%eax
+ 877:	2b 45 10             	sub    0x10(%ebp),%eax
+ 87a:	83 ec 08             	sub    $0x8,%esp
+ 87d:	52                   	push   %edx
+ 87e:	50                   	push   %eax
+ 87f:	ff 75 0c             	push   0xc(%ebp)
+ 882:	ff 75 08             	push   0x8(%ebp)
+ 885:	68 c8 08 00 00       	push   $0x8c8
+ 88a:	6a 01                	push   $0x1
+ 88c:	e8 a5 fb ff ff       	call   436 <printf>
+ 891:	83 c4 20             	add    $0x20,%esp
+}
+ 894:	90                   	nop
+ 895:	c9                   	leave
+ 896:	c3                   	ret
@@ -1,5 +1,9 @@
 struct stat;
 struct rtcdate;
+struct schedstat;
+struct bcachestat;
+struct diskstat;
+struct logstat;
 
 // system calls
 int fork(void);
@@ -23,6 +27,12 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int getschedstat(int, struct schedstat*);
+int setschedpolicy(int);
+int setshare(int, int);
+int getbcachestat(struct bcachestat*);
+int getdiskstat(struct diskstat*);
+int getlogstat(struct logstat*);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -38,4 +48,8 @@ void* malloc(uint);
 void free(void*);
 int atoi(const char*);
 
+// bench.c
+void benchrate(int, char*, int, int);
+void benchtime(int, char*, int, int);
+
 void enable_sched_trace(int enable);
@@ -0,0 +1,8266 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+       6:	a1 78 6d 00 00       	mov    0x6d78,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 ee 4b 00 00       	push   $0x4bee
+      13:	50                   	push   %eax
+      14:	e8 5c 47 00 00       	call   4775 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 f9 4b 00 00       	push   $0x4bf9
+      24:	e8 08 46 00 00       	call   4631 <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      30:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 01 4c 00 00       	push   $0x4c01
+      3d:	50                   	push   %eax
+      3e:	e8 32 47 00 00       	call   4775 <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    exit();
+      46:	e8 7e 45 00 00       	call   45c9 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 f9 4b 00 00       	push   $0x4bf9
+      53:	e8 e1 45 00 00       	call   4639 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 0f 4c 00 00       	push   $0x4c0f
+      6c:	50                   	push   %eax
+      6d:	e8 03 47 00 00       	call   4775 <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+    exit();
+      75:	e8 4f 45 00 00       	call   45c9 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 25 4c 00 00       	push   $0x4c25
+      82:	e8 92 45 00 00       	call   4619 <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 30 4c 00 00       	push   $0x4c30
+      9b:	50                   	push   %eax
+      9c:	e8 d4 46 00 00       	call   4775 <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a4:	e8 20 45 00 00       	call   45c9 <exit>
+  }
+  if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 4a 4c 00 00       	push   $0x4c4a
+      b1:	e8 83 45 00 00       	call   4639 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      bd:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 4c 4c 00 00       	push   $0x4c4c
+      ca:	50                   	push   %eax
+      cb:	e8 a5 46 00 00       	call   4775 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      d3:	e8 f1 44 00 00       	call   45c9 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      d8:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 5c 4c 00 00       	push   $0x4c5c
+      e5:	50                   	push   %eax
+      e6:	e8 8a 46 00 00       	call   4775 <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      f7:	a1 78 6d 00 00       	mov    0x6d78,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 6a 4c 00 00       	push   $0x4c6a
+     104:	50                   	push   %eax
+     105:	e8 6b 46 00 00       	call   4775 <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     10d:	e8 af 44 00 00       	call   45c1 <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     11b:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 79 4c 00 00       	push   $0x4c79
+     128:	50                   	push   %eax
+     129:	e8 47 46 00 00       	call   4775 <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     131:	e8 93 44 00 00       	call   45c9 <exit>
+  }
+  if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 f9 4b 00 00       	push   $0x4bf9
+     148:	e8 e4 44 00 00       	call   4631 <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     154:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 01 4c 00 00       	push   $0x4c01
+     161:	50                   	push   %eax
+     162:	e8 0e 46 00 00       	call   4775 <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+      exit();
+     16a:	e8 5a 44 00 00       	call   45c9 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 f9 4b 00 00       	push   $0x4bf9
+     177:	e8 bd 44 00 00       	call   4639 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     183:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 86 4c 00 00       	push   $0x4c86
+     190:	50                   	push   %eax
+     191:	e8 df 45 00 00       	call   4775 <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+      exit();
+     199:	e8 2b 44 00 00       	call   45c9 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 25 4c 00 00       	push   $0x4c25
+     1a6:	e8 6e 44 00 00       	call   4619 <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 30 4c 00 00       	push   $0x4c30
+     1bf:	50                   	push   %eax
+     1c0:	e8 b0 45 00 00       	call   4775 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1c8:	e8 fc 43 00 00       	call   45c9 <exit>
+    }
+    exit();
+     1cd:	e8 f7 43 00 00       	call   45c9 <exit>
+  }
+  wait();
+     1d2:	e8 fa 43 00 00       	call   45d1 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1d7:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 9a 4c 00 00       	push   $0x4c9a
+     1e4:	50                   	push   %eax
+     1e5:	e8 8b 45 00 00       	call   4775 <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1f6:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 ac 4c 00 00       	push   $0x4cac
+     203:	50                   	push   %eax
+     204:	e8 6c 45 00 00       	call   4775 <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 bb 4c 00 00       	push   $0x4cbb
+     214:	e8 18 44 00 00       	call   4631 <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     220:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 c1 4c 00 00       	push   $0x4cc1
+     22d:	50                   	push   %eax
+     22e:	e8 42 45 00 00       	call   4775 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+    exit();
+     236:	e8 8e 43 00 00       	call   45c9 <exit>
+  }
+  pid = fork();
+     23b:	e8 81 43 00 00       	call   45c1 <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     249:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 79 4c 00 00       	push   $0x4c79
+     256:	50                   	push   %eax
+     257:	e8 19 45 00 00       	call   4775 <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 65 43 00 00       	call   45c9 <exit>
+  }
+  if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 bb 4c 00 00       	push   $0x4cbb
+     274:	e8 90 43 00 00       	call   4609 <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     285:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 d8 4c 00 00       	push   $0x4cd8
+     292:	50                   	push   %eax
+     293:	e8 dd 44 00 00       	call   4775 <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+      exit();
+     29b:	e8 29 43 00 00       	call   45c9 <exit>
+    }
+    exit();
+     2a0:	e8 24 43 00 00       	call   45c9 <exit>
+  }
+  sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 aa 43 00 00       	call   4659 <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 bb 4c 00 00       	push   $0x4cbb
+     2ba:	e8 5a 43 00 00       	call   4619 <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2c6:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 fc 4c 00 00       	push   $0x4cfc
+     2d3:	50                   	push   %eax
+     2d4:	e8 9c 44 00 00       	call   4775 <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2dc:	e8 e8 42 00 00       	call   45c9 <exit>
+  }
+  wait();
+     2e1:	e8 eb 42 00 00       	call   45d1 <wait>
+  printf(stdout, "openiput test ok\n");
+     2e6:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 0b 4d 00 00       	push   $0x4d0b
+     2f3:	50                   	push   %eax
+     2f4:	e8 7c 44 00 00       	call   4775 <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     305:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 1d 4d 00 00       	push   $0x4d1d
+     312:	50                   	push   %eax
+     313:	e8 5d 44 00 00       	call   4775 <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 d8 4b 00 00       	push   $0x4bd8
+     325:	e8 df 42 00 00       	call   4609 <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     336:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 28 4d 00 00       	push   $0x4d28
+     343:	50                   	push   %eax
+     344:	e8 2c 44 00 00       	call   4775 <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34c:	e8 78 42 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 95 42 00 00       	call   45f1 <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 3b 4d 00 00       	push   $0x4d3b
+     369:	e8 9b 42 00 00       	call   4609 <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 48 4d 00 00       	push   $0x4d48
+     387:	50                   	push   %eax
+     388:	e8 e8 43 00 00       	call   4775 <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     390:	e8 34 42 00 00       	call   45c9 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     395:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 66 4d 00 00       	push   $0x4d66
+     3a2:	50                   	push   %eax
+     3a3:	e8 cd 43 00 00       	call   4775 <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <textbusytest>:
+// which must not change under it: the executable can be
+// neither opened for writing nor written through a descriptor
+// opened before the program started, until it exits.
+void
+textbusytest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 38             	sub    $0x38,%esp
+  int fd, src, n, in[2], out[2];
+  char c, *args[] = { "textcopy", 0 };
+     3b4:	c7 45 d0 74 4d 00 00 	movl   $0x4d74,-0x30(%ebp)
+     3bb:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+
+  printf(stdout, "text busy test\n");
+     3c2:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     3c7:	83 ec 08             	sub    $0x8,%esp
+     3ca:	68 7d 4d 00 00       	push   $0x4d7d
+     3cf:	50                   	push   %eax
+     3d0:	e8 a0 43 00 00       	call   4775 <printf>
+     3d5:	83 c4 10             	add    $0x10,%esp
+  if(open("usertests", O_RDWR) >= 0){
+     3d8:	83 ec 08             	sub    $0x8,%esp
+     3db:	6a 02                	push   $0x2
+     3dd:	68 8d 4d 00 00       	push   $0x4d8d
+     3e2:	e8 22 42 00 00       	call   4609 <open>
+     3e7:	83 c4 10             	add    $0x10,%esp
+     3ea:	85 c0                	test   %eax,%eax
+     3ec:	78 1b                	js     409 <textbusytest+0x5b>
+    printf(stdout, "opened running usertests for writing!\n");
+     3ee:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     3f3:	83 ec 08             	sub    $0x8,%esp
+     3f6:	68 98 4d 00 00       	push   $0x4d98
+     3fb:	50                   	push   %eax
+     3fc:	e8 74 43 00 00       	call   4775 <printf>
+     401:	83 c4 10             	add    $0x10,%esp
+    exit();
+     404:	e8 c0 41 00 00       	call   45c9 <exit>
+  }
+
+  // Run a copy of cat that echoes one pipe to another while
+  // the copy is still open for writing.
+  src = open("cat", O_RDONLY);
+     409:	83 ec 08             	sub    $0x8,%esp
+     40c:	6a 00                	push   $0x0
+     40e:	68 bf 4d 00 00       	push   $0x4dbf
+     413:	e8 f1 41 00 00       	call   4609 <open>
+     418:	83 c4 10             	add    $0x10,%esp
+     41b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  fd = open("textcopy", O_CREATE|O_RDWR);
+     41e:	83 ec 08             	sub    $0x8,%esp
+     421:	68 02 02 00 00       	push   $0x202
+     426:	68 74 4d 00 00       	push   $0x4d74
+     42b:	e8 d9 41 00 00       	call   4609 <open>
+     430:	83 c4 10             	add    $0x10,%esp
+     433:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(src < 0 || fd < 0){
+     436:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     43a:	78 06                	js     442 <textbusytest+0x94>
+     43c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     440:	79 31                	jns    473 <textbusytest+0xc5>
+    printf(stdout, "cannot copy cat\n");
+     442:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     447:	83 ec 08             	sub    $0x8,%esp
+     44a:	68 c3 4d 00 00       	push   $0x4dc3
+     44f:	50                   	push   %eax
+     450:	e8 20 43 00 00       	call   4775 <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+    exit();
+     458:	e8 6c 41 00 00       	call   45c9 <exit>
+  }
+  while((n = read(src, buf, sizeof(buf))) > 0)
+    write(fd, buf, n);
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	ff 75 ec             	push   -0x14(%ebp)
+     463:	68 a0 6d 00 00       	push   $0x6da0
+     468:	ff 75 f0             	push   -0x10(%ebp)
+     46b:	e8 79 41 00 00       	call   45e9 <write>
+     470:	83 c4 10             	add    $0x10,%esp
+  while((n = read(src, buf, sizeof(buf))) > 0)
+     473:	83 ec 04             	sub    $0x4,%esp
+     476:	68 00 20 00 00       	push   $0x2000
+     47b:	68 a0 6d 00 00       	push   $0x6da0
+     480:	ff 75 f4             	push   -0xc(%ebp)
+     483:	e8 59 41 00 00       	call   45e1 <read>
+     488:	83 c4 10             	add    $0x10,%esp
+     48b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     48e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     492:	7f c9                	jg     45d <textbusytest+0xaf>
+  close(src);
+     494:	83 ec 0c             	sub    $0xc,%esp
+     497:	ff 75 f4             	push   -0xc(%ebp)
+     49a:	e8 52 41 00 00       	call   45f1 <close>
+     49f:	83 c4 10             	add    $0x10,%esp
+  if(pipe(in) < 0 || pipe(out) < 0){
+     4a2:	83 ec 0c             	sub    $0xc,%esp
+     4a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     4a8:	50                   	push   %eax
+     4a9:	e8 2b 41 00 00       	call   45d9 <pipe>
+     4ae:	83 c4 10             	add    $0x10,%esp
+     4b1:	85 c0                	test   %eax,%eax
+     4b3:	78 13                	js     4c8 <textbusytest+0x11a>
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     4bb:	50                   	push   %eax
+     4bc:	e8 18 41 00 00       	call   45d9 <pipe>
+     4c1:	83 c4 10             	add    $0x10,%esp
+     4c4:	85 c0                	test   %eax,%eax
+     4c6:	79 1b                	jns    4e3 <textbusytest+0x135>
+    printf(stdout, "pipe failed\n");
+     4c8:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     4cd:	83 ec 08             	sub    $0x8,%esp
+     4d0:	68 d4 4d 00 00       	push   $0x4dd4
+     4d5:	50                   	push   %eax
+     4d6:	e8 9a 42 00 00       	call   4775 <printf>
+     4db:	83 c4 10             	add    $0x10,%esp
+    exit();
+     4de:	e8 e6 40 00 00       	call   45c9 <exit>
+  }
+  if(fork() == 0){
+     4e3:	e8 d9 40 00 00       	call   45c1 <fork>
+     4e8:	85 c0                	test   %eax,%eax
+     4ea:	0f 85 9b 00 00 00    	jne    58b <textbusytest+0x1dd>
+    close(0);
+     4f0:	83 ec 0c             	sub    $0xc,%esp
+     4f3:	6a 00                	push   $0x0
+     4f5:	e8 f7 40 00 00       	call   45f1 <close>
+     4fa:	83 c4 10             	add    $0x10,%esp
+    dup(in[0]);
+     4fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     500:	83 ec 0c             	sub    $0xc,%esp
+     503:	50                   	push   %eax
+     504:	e8 38 41 00 00       	call   4641 <dup>
+     509:	83 c4 10             	add    $0x10,%esp
+    close(1);
+     50c:	83 ec 0c             	sub    $0xc,%esp
+     50f:	6a 01                	push   $0x1
+     511:	e8 db 40 00 00       	call   45f1 <close>
+     516:	83 c4 10             	add    $0x10,%esp
+    dup(out[1]);
+     519:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     51c:	83 ec 0c             	sub    $0xc,%esp
+     51f:	50                   	push   %eax
+     520:	e8 1c 41 00 00       	call   4641 <dup>
+     525:	83 c4 10             	add    $0x10,%esp
+    close(in[0]);
+     528:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     52b:	83 ec 0c             	sub    $0xc,%esp
+     52e:	50                   	push   %eax
+     52f:	e8 bd 40 00 00       	call   45f1 <close>
+     534:	83 c4 10             	add    $0x10,%esp
+    close(in[1]);
+     537:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     53a:	83 ec 0c             	sub    $0xc,%esp
+     53d:	50                   	push   %eax
+     53e:	e8 ae 40 00 00       	call   45f1 <close>
+     543:	83 c4 10             	add    $0x10,%esp
+    close(out[0]);
+     546:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     549:	83 ec 0c             	sub    $0xc,%esp
+     54c:	50                   	push   %eax
+     54d:	e8 9f 40 00 00       	call   45f1 <close>
+     552:	83 c4 10             	add    $0x10,%esp
+    close(out[1]);
+     555:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     558:	83 ec 0c             	sub    $0xc,%esp
+     55b:	50                   	push   %eax
+     55c:	e8 90 40 00 00       	call   45f1 <close>
+     561:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     564:	83 ec 0c             	sub    $0xc,%esp
+     567:	ff 75 f0             	push   -0x10(%ebp)
+     56a:	e8 82 40 00 00       	call   45f1 <close>
+     56f:	83 c4 10             	add    $0x10,%esp
+    exec("textcopy", args);
+     572:	83 ec 08             	sub    $0x8,%esp
+     575:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     578:	50                   	push   %eax
+     579:	68 74 4d 00 00       	push   $0x4d74
+     57e:	e8 7e 40 00 00       	call   4601 <exec>
+     583:	83 c4 10             	add    $0x10,%esp
+    exit();
+     586:	e8 3e 40 00 00       	call   45c9 <exit>
+  }
+  close(in[0]);
+     58b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     58e:	83 ec 0c             	sub    $0xc,%esp
+     591:	50                   	push   %eax
+     592:	e8 5a 40 00 00       	call   45f1 <close>
+     597:	83 c4 10             	add    $0x10,%esp
+  close(out[1]);
+     59a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     59d:	83 ec 0c             	sub    $0xc,%esp
+     5a0:	50                   	push   %eax
+     5a1:	e8 4b 40 00 00       	call   45f1 <close>
+     5a6:	83 c4 10             	add    $0x10,%esp
+
+  // Once it echoes a byte, it is running from textcopy.
+  write(in[1], "x", 1);
+     5a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     5ac:	83 ec 04             	sub    $0x4,%esp
+     5af:	6a 01                	push   $0x1
+     5b1:	68 e1 4d 00 00       	push   $0x4de1
+     5b6:	50                   	push   %eax
+     5b7:	e8 2d 40 00 00       	call   45e9 <write>
+     5bc:	83 c4 10             	add    $0x10,%esp
+  if(read(out[0], &c, 1) != 1){
+     5bf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     5c2:	83 ec 04             	sub    $0x4,%esp
+     5c5:	6a 01                	push   $0x1
+     5c7:	8d 55 db             	lea    -0x25(%ebp),%edx
+     5ca:	52                   	push   %edx
+     5cb:	50                   	push   %eax
+     5cc:	e8 10 40 00 00       	call   45e1 <read>
+     5d1:	83 c4 10             	add    $0x10,%esp
+     5d4:	83 f8 01             	cmp    $0x1,%eax
+     5d7:	74 1b                	je     5f4 <textbusytest+0x246>
+    printf(stdout, "textcopy did not run\n");
+     5d9:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     5de:	83 ec 08             	sub    $0x8,%esp
+     5e1:	68 e3 4d 00 00       	push   $0x4de3
+     5e6:	50                   	push   %eax
+     5e7:	e8 89 41 00 00       	call   4775 <printf>
+     5ec:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5ef:	e8 d5 3f 00 00       	call   45c9 <exit>
+  }
+  if(write(fd, "x", 1) >= 0){
+     5f4:	83 ec 04             	sub    $0x4,%esp
+     5f7:	6a 01                	push   $0x1
+     5f9:	68 e1 4d 00 00       	push   $0x4de1
+     5fe:	ff 75 f0             	push   -0x10(%ebp)
+     601:	e8 e3 3f 00 00       	call   45e9 <write>
+     606:	83 c4 10             	add    $0x10,%esp
+     609:	85 c0                	test   %eax,%eax
+     60b:	78 1b                	js     628 <textbusytest+0x27a>
+    printf(stdout, "wrote running textcopy!\n");
+     60d:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     612:	83 ec 08             	sub    $0x8,%esp
+     615:	68 f9 4d 00 00       	push   $0x4df9
+     61a:	50                   	push   %eax
+     61b:	e8 55 41 00 00       	call   4775 <printf>
+     620:	83 c4 10             	add    $0x10,%esp
+    exit();
+     623:	e8 a1 3f 00 00       	call   45c9 <exit>
+  }
+  close(in[1]);
+     628:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     62b:	83 ec 0c             	sub    $0xc,%esp
+     62e:	50                   	push   %eax
+     62f:	e8 bd 3f 00 00       	call   45f1 <close>
+     634:	83 c4 10             	add    $0x10,%esp
+  wait();
+     637:	e8 95 3f 00 00       	call   45d1 <wait>
+  close(out[0]);
+     63c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     63f:	83 ec 0c             	sub    $0xc,%esp
+     642:	50                   	push   %eax
+     643:	e8 a9 3f 00 00       	call   45f1 <close>
+     648:	83 c4 10             	add    $0x10,%esp
+  if(write(fd, "x", 1) != 1){
+     64b:	83 ec 04             	sub    $0x4,%esp
+     64e:	6a 01                	push   $0x1
+     650:	68 e1 4d 00 00       	push   $0x4de1
+     655:	ff 75 f0             	push   -0x10(%ebp)
+     658:	e8 8c 3f 00 00       	call   45e9 <write>
+     65d:	83 c4 10             	add    $0x10,%esp
+     660:	83 f8 01             	cmp    $0x1,%eax
+     663:	74 1b                	je     680 <textbusytest+0x2d2>
+    printf(stdout, "cannot write textcopy after it exited\n");
+     665:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     66a:	83 ec 08             	sub    $0x8,%esp
+     66d:	68 14 4e 00 00       	push   $0x4e14
+     672:	50                   	push   %eax
+     673:	e8 fd 40 00 00       	call   4775 <printf>
+     678:	83 c4 10             	add    $0x10,%esp
+    exit();
+     67b:	e8 49 3f 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+     680:	83 ec 0c             	sub    $0xc,%esp
+     683:	ff 75 f0             	push   -0x10(%ebp)
+     686:	e8 66 3f 00 00       	call   45f1 <close>
+     68b:	83 c4 10             	add    $0x10,%esp
+  unlink("textcopy");
+     68e:	83 ec 0c             	sub    $0xc,%esp
+     691:	68 74 4d 00 00       	push   $0x4d74
+     696:	e8 7e 3f 00 00       	call   4619 <unlink>
+     69b:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "text busy test ok\n");
+     69e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     6a3:	83 ec 08             	sub    $0x8,%esp
+     6a6:	68 3b 4e 00 00       	push   $0x4e3b
+     6ab:	50                   	push   %eax
+     6ac:	e8 c4 40 00 00       	call   4775 <printf>
+     6b1:	83 c4 10             	add    $0x10,%esp
+}
+     6b4:	90                   	nop
+     6b5:	c9                   	leave
+     6b6:	c3                   	ret
+
+000006b7 <writetest>:
+
+void
+writetest(void)
+{
+     6b7:	55                   	push   %ebp
+     6b8:	89 e5                	mov    %esp,%ebp
+     6ba:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     6bd:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     6c2:	83 ec 08             	sub    $0x8,%esp
+     6c5:	68 4e 4e 00 00       	push   $0x4e4e
+     6ca:	50                   	push   %eax
+     6cb:	e8 a5 40 00 00       	call   4775 <printf>
+     6d0:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     6d3:	83 ec 08             	sub    $0x8,%esp
+     6d6:	68 02 02 00 00       	push   $0x202
+     6db:	68 5f 4e 00 00       	push   $0x4e5f
+     6e0:	e8 24 3f 00 00       	call   4609 <open>
+     6e5:	83 c4 10             	add    $0x10,%esp
+     6e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     6eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     6ef:	78 22                	js     713 <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     6f1:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     6f6:	83 ec 08             	sub    $0x8,%esp
+     6f9:	68 65 4e 00 00       	push   $0x4e65
+     6fe:	50                   	push   %eax
+     6ff:	e8 71 40 00 00       	call   4775 <printf>
+     704:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     707:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     70e:	e9 8f 00 00 00       	jmp    7a2 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     713:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     718:	83 ec 08             	sub    $0x8,%esp
+     71b:	68 80 4e 00 00       	push   $0x4e80
+     720:	50                   	push   %eax
+     721:	e8 4f 40 00 00       	call   4775 <printf>
+     726:	83 c4 10             	add    $0x10,%esp
+    exit();
+     729:	e8 9b 3e 00 00       	call   45c9 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     72e:	83 ec 04             	sub    $0x4,%esp
+     731:	6a 0a                	push   $0xa
+     733:	68 9c 4e 00 00       	push   $0x4e9c
+     738:	ff 75 f0             	push   -0x10(%ebp)
+     73b:	e8 a9 3e 00 00       	call   45e9 <write>
+     740:	83 c4 10             	add    $0x10,%esp
+     743:	83 f8 0a             	cmp    $0xa,%eax
+     746:	74 1e                	je     766 <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     748:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     74d:	83 ec 04             	sub    $0x4,%esp
+     750:	ff 75 f4             	push   -0xc(%ebp)
+     753:	68 a8 4e 00 00       	push   $0x4ea8
+     758:	50                   	push   %eax
+     759:	e8 17 40 00 00       	call   4775 <printf>
+     75e:	83 c4 10             	add    $0x10,%esp
+      exit();
+     761:	e8 63 3e 00 00       	call   45c9 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     766:	83 ec 04             	sub    $0x4,%esp
+     769:	6a 0a                	push   $0xa
+     76b:	68 cc 4e 00 00       	push   $0x4ecc
+     770:	ff 75 f0             	push   -0x10(%ebp)
+     773:	e8 71 3e 00 00       	call   45e9 <write>
+     778:	83 c4 10             	add    $0x10,%esp
+     77b:	83 f8 0a             	cmp    $0xa,%eax
+     77e:	74 1e                	je     79e <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     780:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     785:	83 ec 04             	sub    $0x4,%esp
+     788:	ff 75 f4             	push   -0xc(%ebp)
+     78b:	68 d8 4e 00 00       	push   $0x4ed8
+     790:	50                   	push   %eax
+     791:	e8 df 3f 00 00       	call   4775 <printf>
+     796:	83 c4 10             	add    $0x10,%esp
+      exit();
+     799:	e8 2b 3e 00 00       	call   45c9 <exit>
+  for(i = 0; i < 100; i++){
+     79e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     7a2:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     7a6:	7e 86                	jle    72e <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     7a8:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     7ad:	83 ec 08             	sub    $0x8,%esp
+     7b0:	68 fc 4e 00 00       	push   $0x4efc
+     7b5:	50                   	push   %eax
+     7b6:	e8 ba 3f 00 00       	call   4775 <printf>
+     7bb:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     7be:	83 ec 0c             	sub    $0xc,%esp
+     7c1:	ff 75 f0             	push   -0x10(%ebp)
+     7c4:	e8 28 3e 00 00       	call   45f1 <close>
+     7c9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     7cc:	83 ec 08             	sub    $0x8,%esp
+     7cf:	6a 00                	push   $0x0
+     7d1:	68 5f 4e 00 00       	push   $0x4e5f
+     7d6:	e8 2e 3e 00 00       	call   4609 <open>
+     7db:	83 c4 10             	add    $0x10,%esp
+     7de:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     7e1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     7e5:	78 3c                	js     823 <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     7e7:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     7ec:	83 ec 08             	sub    $0x8,%esp
+     7ef:	68 07 4f 00 00       	push   $0x4f07
+     7f4:	50                   	push   %eax
+     7f5:	e8 7b 3f 00 00       	call   4775 <printf>
+     7fa:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     7fd:	83 ec 04             	sub    $0x4,%esp
+     800:	68 d0 07 00 00       	push   $0x7d0
+     805:	68 a0 6d 00 00       	push   $0x6da0
+     80a:	ff 75 f0             	push   -0x10(%ebp)
+     80d:	e8 cf 3d 00 00       	call   45e1 <read>
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     818:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     81f:	75 57                	jne    878 <writetest+0x1c1>
+     821:	eb 1b                	jmp    83e <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     823:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	68 20 4f 00 00       	push   $0x4f20
+     830:	50                   	push   %eax
+     831:	e8 3f 3f 00 00       	call   4775 <printf>
+     836:	83 c4 10             	add    $0x10,%esp
+    exit();
+     839:	e8 8b 3d 00 00       	call   45c9 <exit>
+    printf(stdout, "read succeeded ok\n");
+     83e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     843:	83 ec 08             	sub    $0x8,%esp
+     846:	68 3b 4f 00 00       	push   $0x4f3b
+     84b:	50                   	push   %eax
+     84c:	e8 24 3f 00 00       	call   4775 <printf>
+     851:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     854:	83 ec 0c             	sub    $0xc,%esp
+     857:	ff 75 f0             	push   -0x10(%ebp)
+     85a:	e8 92 3d 00 00       	call   45f1 <close>
+     85f:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     862:	83 ec 0c             	sub    $0xc,%esp
+     865:	68 5f 4e 00 00       	push   $0x4e5f
+     86a:	e8 aa 3d 00 00       	call   4619 <unlink>
+     86f:	83 c4 10             	add    $0x10,%esp
+     872:	85 c0                	test   %eax,%eax
+     874:	79 38                	jns    8ae <writetest+0x1f7>
+     876:	eb 1b                	jmp    893 <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     878:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     87d:	83 ec 08             	sub    $0x8,%esp
+     880:	68 4e 4f 00 00       	push   $0x4f4e
+     885:	50                   	push   %eax
+     886:	e8 ea 3e 00 00       	call   4775 <printf>
+     88b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     88e:	e8 36 3d 00 00       	call   45c9 <exit>
+    printf(stdout, "unlink small failed\n");
+     893:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     898:	83 ec 08             	sub    $0x8,%esp
+     89b:	68 5b 4f 00 00       	push   $0x4f5b
+     8a0:	50                   	push   %eax
+     8a1:	e8 cf 3e 00 00       	call   4775 <printf>
+     8a6:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8a9:	e8 1b 3d 00 00       	call   45c9 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     8ae:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     8b3:	83 ec 08             	sub    $0x8,%esp
+     8b6:	68 70 4f 00 00       	push   $0x4f70
+     8bb:	50                   	push   %eax
+     8bc:	e8 b4 3e 00 00       	call   4775 <printf>
+     8c1:	83 c4 10             	add    $0x10,%esp
+}
+     8c4:	90                   	nop
+     8c5:	c9                   	leave
+     8c6:	c3                   	ret
+
+000008c7 <writetest1>:
+// well within the free space of kernelmemfs's disk.
+#define NBIGBLOCK 2048
+
+void
+writetest1(void)
+{
+     8c7:	55                   	push   %ebp
+     8c8:	89 e5                	mov    %esp,%ebp
+     8ca:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     8cd:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     8d2:	83 ec 08             	sub    $0x8,%esp
+     8d5:	68 84 4f 00 00       	push   $0x4f84
+     8da:	50                   	push   %eax
+     8db:	e8 95 3e 00 00       	call   4775 <printf>
+     8e0:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     8e3:	83 ec 08             	sub    $0x8,%esp
+     8e6:	68 02 02 00 00       	push   $0x202
+     8eb:	68 94 4f 00 00       	push   $0x4f94
+     8f0:	e8 14 3d 00 00       	call   4609 <open>
+     8f5:	83 c4 10             	add    $0x10,%esp
+     8f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     8fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     8ff:	79 1b                	jns    91c <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     901:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     906:	83 ec 08             	sub    $0x8,%esp
+     909:	68 98 4f 00 00       	push   $0x4f98
+     90e:	50                   	push   %eax
+     90f:	e8 61 3e 00 00       	call   4775 <printf>
+     914:	83 c4 10             	add    $0x10,%esp
+    exit();
+     917:	e8 ad 3c 00 00       	call   45c9 <exit>
+  }
+
+  for(i = 0; i < NBIGBLOCK; i++){
+     91c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     923:	eb 4b                	jmp    970 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     925:	ba a0 6d 00 00       	mov    $0x6da0,%edx
+     92a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     92d:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     92f:	83 ec 04             	sub    $0x4,%esp
+     932:	68 00 02 00 00       	push   $0x200
+     937:	68 a0 6d 00 00       	push   $0x6da0
+     93c:	ff 75 ec             	push   -0x14(%ebp)
+     93f:	e8 a5 3c 00 00       	call   45e9 <write>
+     944:	83 c4 10             	add    $0x10,%esp
+     947:	3d 00 02 00 00       	cmp    $0x200,%eax
+     94c:	74 1e                	je     96c <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     94e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     953:	83 ec 04             	sub    $0x4,%esp
+     956:	ff 75 f4             	push   -0xc(%ebp)
+     959:	68 b2 4f 00 00       	push   $0x4fb2
+     95e:	50                   	push   %eax
+     95f:	e8 11 3e 00 00       	call   4775 <printf>
+     964:	83 c4 10             	add    $0x10,%esp
+      exit();
+     967:	e8 5d 3c 00 00       	call   45c9 <exit>
+  for(i = 0; i < NBIGBLOCK; i++){
+     96c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     970:	81 7d f4 ff 07 00 00 	cmpl   $0x7ff,-0xc(%ebp)
+     977:	7e ac                	jle    925 <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     979:	83 ec 0c             	sub    $0xc,%esp
+     97c:	ff 75 ec             	push   -0x14(%ebp)
+     97f:	e8 6d 3c 00 00       	call   45f1 <close>
+     984:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     987:	83 ec 08             	sub    $0x8,%esp
+     98a:	6a 00                	push   $0x0
+     98c:	68 94 4f 00 00       	push   $0x4f94
+     991:	e8 73 3c 00 00       	call   4609 <open>
+     996:	83 c4 10             	add    $0x10,%esp
+     999:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     99c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9a0:	79 1b                	jns    9bd <writetest1+0xf6>
+    printf(stdout, "error: open big failed!\n");
+     9a2:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     9a7:	83 ec 08             	sub    $0x8,%esp
+     9aa:	68 d0 4f 00 00       	push   $0x4fd0
+     9af:	50                   	push   %eax
+     9b0:	e8 c0 3d 00 00       	call   4775 <printf>
+     9b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9b8:	e8 0c 3c 00 00       	call   45c9 <exit>
+  }
+
+  n = 0;
+     9bd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     9c4:	83 ec 04             	sub    $0x4,%esp
+     9c7:	68 00 02 00 00       	push   $0x200
+     9cc:	68 a0 6d 00 00       	push   $0x6da0
+     9d1:	ff 75 ec             	push   -0x14(%ebp)
+     9d4:	e8 08 3c 00 00       	call   45e1 <read>
+     9d9:	83 c4 10             	add    $0x10,%esp
+     9dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     9df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     9e3:	75 27                	jne    a0c <writetest1+0x145>
+      if(n != NBIGBLOCK){
+     9e5:	81 7d f0 00 08 00 00 	cmpl   $0x800,-0x10(%ebp)
+     9ec:	74 7d                	je     a6b <writetest1+0x1a4>
+        printf(stdout, "read only %d blocks from big\n", n);
+     9ee:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     9f3:	83 ec 04             	sub    $0x4,%esp
+     9f6:	ff 75 f0             	push   -0x10(%ebp)
+     9f9:	68 e9 4f 00 00       	push   $0x4fe9
+     9fe:	50                   	push   %eax
+     9ff:	e8 71 3d 00 00       	call   4775 <printf>
+     a04:	83 c4 10             	add    $0x10,%esp
+        exit();
+     a07:	e8 bd 3b 00 00       	call   45c9 <exit>
+      }
+      break;
+    } else if(i != 512){
+     a0c:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     a13:	74 1e                	je     a33 <writetest1+0x16c>
+      printf(stdout, "read failed %d\n", i);
+     a15:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     a1a:	83 ec 04             	sub    $0x4,%esp
+     a1d:	ff 75 f4             	push   -0xc(%ebp)
+     a20:	68 07 50 00 00       	push   $0x5007
+     a25:	50                   	push   %eax
+     a26:	e8 4a 3d 00 00       	call   4775 <printf>
+     a2b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     a2e:	e8 96 3b 00 00       	call   45c9 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     a33:	b8 a0 6d 00 00       	mov    $0x6da0,%eax
+     a38:	8b 00                	mov    (%eax),%eax
+     a3a:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     a3d:	74 23                	je     a62 <writetest1+0x19b>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     a3f:	b8 a0 6d 00 00       	mov    $0x6da0,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     a44:	8b 10                	mov    (%eax),%edx
+     a46:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     a4b:	52                   	push   %edx
+     a4c:	ff 75 f0             	push   -0x10(%ebp)
+     a4f:	68 18 50 00 00       	push   $0x5018
+     a54:	50                   	push   %eax
+     a55:	e8 1b 3d 00 00       	call   4775 <printf>
+     a5a:	83 c4 10             	add    $0x10,%esp
+      exit();
+     a5d:	e8 67 3b 00 00       	call   45c9 <exit>
+    }
+    n++;
+     a62:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     a66:	e9 59 ff ff ff       	jmp    9c4 <writetest1+0xfd>
+      break;
+     a6b:	90                   	nop
+  }
+  close(fd);
+     a6c:	83 ec 0c             	sub    $0xc,%esp
+     a6f:	ff 75 ec             	push   -0x14(%ebp)
+     a72:	e8 7a 3b 00 00       	call   45f1 <close>
+     a77:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     a7a:	83 ec 0c             	sub    $0xc,%esp
+     a7d:	68 94 4f 00 00       	push   $0x4f94
+     a82:	e8 92 3b 00 00       	call   4619 <unlink>
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	85 c0                	test   %eax,%eax
+     a8c:	79 1b                	jns    aa9 <writetest1+0x1e2>
+    printf(stdout, "unlink big failed\n");
+     a8e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     a93:	83 ec 08             	sub    $0x8,%esp
+     a96:	68 38 50 00 00       	push   $0x5038
+     a9b:	50                   	push   %eax
+     a9c:	e8 d4 3c 00 00       	call   4775 <printf>
+     aa1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     aa4:	e8 20 3b 00 00       	call   45c9 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     aa9:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     aae:	83 ec 08             	sub    $0x8,%esp
+     ab1:	68 4b 50 00 00       	push   $0x504b
+     ab6:	50                   	push   %eax
+     ab7:	e8 b9 3c 00 00       	call   4775 <printf>
+     abc:	83 c4 10             	add    $0x10,%esp
+}
+     abf:	90                   	nop
+     ac0:	c9                   	leave
+     ac1:	c3                   	ret
+
+00000ac2 <createtest>:
+
+void
+createtest(void)
+{
+     ac2:	55                   	push   %ebp
+     ac3:	89 e5                	mov    %esp,%ebp
+     ac5:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     ac8:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     acd:	83 ec 08             	sub    $0x8,%esp
+     ad0:	68 5c 50 00 00       	push   $0x505c
+     ad5:	50                   	push   %eax
+     ad6:	e8 9a 3c 00 00       	call   4775 <printf>
+     adb:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     ade:	c6 05 a0 8d 00 00 61 	movb   $0x61,0x8da0
+  name[2] = '\0';
+     ae5:	c6 05 a2 8d 00 00 00 	movb   $0x0,0x8da2
+  for(i = 0; i < 52; i++){
+     aec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     af3:	eb 35                	jmp    b2a <createtest+0x68>
+    name[1] = '0' + i;
+     af5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     af8:	83 c0 30             	add    $0x30,%eax
+     afb:	a2 a1 8d 00 00       	mov    %al,0x8da1
+    fd = open(name, O_CREATE|O_RDWR);
+     b00:	83 ec 08             	sub    $0x8,%esp
+     b03:	68 02 02 00 00       	push   $0x202
+     b08:	68 a0 8d 00 00       	push   $0x8da0
+     b0d:	e8 f7 3a 00 00       	call   4609 <open>
+     b12:	83 c4 10             	add    $0x10,%esp
+     b15:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     b18:	83 ec 0c             	sub    $0xc,%esp
+     b1b:	ff 75 f0             	push   -0x10(%ebp)
+     b1e:	e8 ce 3a 00 00       	call   45f1 <close>
+     b23:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     b26:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     b2a:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     b2e:	7e c5                	jle    af5 <createtest+0x33>
+  }
+  name[0] = 'a';
+     b30:	c6 05 a0 8d 00 00 61 	movb   $0x61,0x8da0
+  name[2] = '\0';
+     b37:	c6 05 a2 8d 00 00 00 	movb   $0x0,0x8da2
+  for(i = 0; i < 52; i++){
+     b3e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     b45:	eb 1f                	jmp    b66 <createtest+0xa4>
+    name[1] = '0' + i;
+     b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b4a:	83 c0 30             	add    $0x30,%eax
+     b4d:	a2 a1 8d 00 00       	mov    %al,0x8da1
+    unlink(name);
+     b52:	83 ec 0c             	sub    $0xc,%esp
+     b55:	68 a0 8d 00 00       	push   $0x8da0
+     b5a:	e8 ba 3a 00 00       	call   4619 <unlink>
+     b5f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     b62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     b66:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     b6a:	7e db                	jle    b47 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     b6c:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     b71:	83 ec 08             	sub    $0x8,%esp
+     b74:	68 84 50 00 00       	push   $0x5084
+     b79:	50                   	push   %eax
+     b7a:	e8 f6 3b 00 00       	call   4775 <printf>
+     b7f:	83 c4 10             	add    $0x10,%esp
+}
+     b82:	90                   	nop
+     b83:	c9                   	leave
+     b84:	c3                   	ret
+
+00000b85 <dirtest>:
+
+void dirtest(void)
+{
+     b85:	55                   	push   %ebp
+     b86:	89 e5                	mov    %esp,%ebp
+     b88:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     b8b:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     b90:	83 ec 08             	sub    $0x8,%esp
+     b93:	68 aa 50 00 00       	push   $0x50aa
+     b98:	50                   	push   %eax
+     b99:	e8 d7 3b 00 00       	call   4775 <printf>
+     b9e:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     ba1:	83 ec 0c             	sub    $0xc,%esp
+     ba4:	68 b6 50 00 00       	push   $0x50b6
+     ba9:	e8 83 3a 00 00       	call   4631 <mkdir>
+     bae:	83 c4 10             	add    $0x10,%esp
+     bb1:	85 c0                	test   %eax,%eax
+     bb3:	79 1b                	jns    bd0 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     bb5:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     bba:	83 ec 08             	sub    $0x8,%esp
+     bbd:	68 01 4c 00 00       	push   $0x4c01
+     bc2:	50                   	push   %eax
+     bc3:	e8 ad 3b 00 00       	call   4775 <printf>
+     bc8:	83 c4 10             	add    $0x10,%esp
+    exit();
+     bcb:	e8 f9 39 00 00       	call   45c9 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     bd0:	83 ec 0c             	sub    $0xc,%esp
+     bd3:	68 b6 50 00 00       	push   $0x50b6
+     bd8:	e8 5c 3a 00 00       	call   4639 <chdir>
+     bdd:	83 c4 10             	add    $0x10,%esp
+     be0:	85 c0                	test   %eax,%eax
+     be2:	79 1b                	jns    bff <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     be4:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     be9:	83 ec 08             	sub    $0x8,%esp
+     bec:	68 bb 50 00 00       	push   $0x50bb
+     bf1:	50                   	push   %eax
+     bf2:	e8 7e 3b 00 00       	call   4775 <printf>
+     bf7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     bfa:	e8 ca 39 00 00       	call   45c9 <exit>
+  }
+
+  if(chdir("..") < 0){
+     bff:	83 ec 0c             	sub    $0xc,%esp
+     c02:	68 ce 50 00 00       	push   $0x50ce
+     c07:	e8 2d 3a 00 00       	call   4639 <chdir>
+     c0c:	83 c4 10             	add    $0x10,%esp
+     c0f:	85 c0                	test   %eax,%eax
+     c11:	79 1b                	jns    c2e <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     c13:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     c18:	83 ec 08             	sub    $0x8,%esp
+     c1b:	68 d1 50 00 00       	push   $0x50d1
+     c20:	50                   	push   %eax
+     c21:	e8 4f 3b 00 00       	call   4775 <printf>
+     c26:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c29:	e8 9b 39 00 00       	call   45c9 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     c2e:	83 ec 0c             	sub    $0xc,%esp
+     c31:	68 b6 50 00 00       	push   $0x50b6
+     c36:	e8 de 39 00 00       	call   4619 <unlink>
+     c3b:	83 c4 10             	add    $0x10,%esp
+     c3e:	85 c0                	test   %eax,%eax
+     c40:	79 1b                	jns    c5d <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     c42:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     c47:	83 ec 08             	sub    $0x8,%esp
+     c4a:	68 e2 50 00 00       	push   $0x50e2
+     c4f:	50                   	push   %eax
+     c50:	e8 20 3b 00 00       	call   4775 <printf>
+     c55:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c58:	e8 6c 39 00 00       	call   45c9 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     c5d:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     c62:	83 ec 08             	sub    $0x8,%esp
+     c65:	68 f6 50 00 00       	push   $0x50f6
+     c6a:	50                   	push   %eax
+     c6b:	e8 05 3b 00 00       	call   4775 <printf>
+     c70:	83 c4 10             	add    $0x10,%esp
+}
+     c73:	90                   	nop
+     c74:	c9                   	leave
+     c75:	c3                   	ret
+
+00000c76 <exectest>:
+
+void
+exectest(void)
+{
+     c76:	55                   	push   %ebp
+     c77:	89 e5                	mov    %esp,%ebp
+     c79:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     c7c:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     c81:	83 ec 08             	sub    $0x8,%esp
+     c84:	68 05 51 00 00       	push   $0x5105
+     c89:	50                   	push   %eax
+     c8a:	e8 e6 3a 00 00       	call   4775 <printf>
+     c8f:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     c92:	83 ec 08             	sub    $0x8,%esp
+     c95:	68 64 6d 00 00       	push   $0x6d64
+     c9a:	68 d8 4b 00 00       	push   $0x4bd8
+     c9f:	e8 5d 39 00 00       	call   4601 <exec>
+     ca4:	83 c4 10             	add    $0x10,%esp
+     ca7:	85 c0                	test   %eax,%eax
+     ca9:	79 1b                	jns    cc6 <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     cab:	a1 78 6d 00 00       	mov    0x6d78,%eax
+     cb0:	83 ec 08             	sub    $0x8,%esp
+     cb3:	68 10 51 00 00       	push   $0x5110
+     cb8:	50                   	push   %eax
+     cb9:	e8 b7 3a 00 00       	call   4775 <printf>
+     cbe:	83 c4 10             	add    $0x10,%esp
+    exit();
+     cc1:	e8 03 39 00 00       	call   45c9 <exit>
+  }
+}
+     cc6:	90                   	nop
+     cc7:	c9                   	leave
+     cc8:	c3                   	ret
+
+00000cc9 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     cc9:	55                   	push   %ebp
+     cca:	89 e5                	mov    %esp,%ebp
+     ccc:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     ccf:	83 ec 0c             	sub    $0xc,%esp
+     cd2:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     cd5:	50                   	push   %eax
+     cd6:	e8 fe 38 00 00       	call   45d9 <pipe>
+     cdb:	83 c4 10             	add    $0x10,%esp
+     cde:	85 c0                	test   %eax,%eax
+     ce0:	74 17                	je     cf9 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     ce2:	83 ec 08             	sub    $0x8,%esp
+     ce5:	68 22 51 00 00       	push   $0x5122
+     cea:	6a 01                	push   $0x1
+     cec:	e8 84 3a 00 00       	call   4775 <printf>
+     cf1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     cf4:	e8 d0 38 00 00       	call   45c9 <exit>
+  }
+  pid = fork();
+     cf9:	e8 c3 38 00 00       	call   45c1 <fork>
+     cfe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     d01:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     d08:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     d0c:	0f 85 89 00 00 00    	jne    d9b <pipe1+0xd2>
+    close(fds[0]);
+     d12:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     d15:	83 ec 0c             	sub    $0xc,%esp
+     d18:	50                   	push   %eax
+     d19:	e8 d3 38 00 00       	call   45f1 <close>
+     d1e:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     d21:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     d28:	eb 66                	jmp    d90 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     d2a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     d31:	eb 19                	jmp    d4c <pipe1+0x83>
+        buf[i] = seq++;
+     d33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d36:	8d 50 01             	lea    0x1(%eax),%edx
+     d39:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     d3c:	89 c2                	mov    %eax,%edx
+     d3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d41:	05 a0 6d 00 00       	add    $0x6da0,%eax
+     d46:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     d48:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d4c:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     d53:	7e de                	jle    d33 <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     d55:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     d58:	83 ec 04             	sub    $0x4,%esp
+     d5b:	68 09 04 00 00       	push   $0x409
+     d60:	68 a0 6d 00 00       	push   $0x6da0
+     d65:	50                   	push   %eax
+     d66:	e8 7e 38 00 00       	call   45e9 <write>
+     d6b:	83 c4 10             	add    $0x10,%esp
+     d6e:	3d 09 04 00 00       	cmp    $0x409,%eax
+     d73:	74 17                	je     d8c <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     d75:	83 ec 08             	sub    $0x8,%esp
+     d78:	68 31 51 00 00       	push   $0x5131
+     d7d:	6a 01                	push   $0x1
+     d7f:	e8 f1 39 00 00       	call   4775 <printf>
+     d84:	83 c4 10             	add    $0x10,%esp
+        exit();
+     d87:	e8 3d 38 00 00       	call   45c9 <exit>
+    for(n = 0; n < 5; n++){
+     d8c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     d90:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     d94:	7e 94                	jle    d2a <pipe1+0x61>
+      }
+    }
+    exit();
+     d96:	e8 2e 38 00 00       	call   45c9 <exit>
+  } else if(pid > 0){
+     d9b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     d9f:	0f 8e f4 00 00 00    	jle    e99 <pipe1+0x1d0>
+    close(fds[1]);
+     da5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     da8:	83 ec 0c             	sub    $0xc,%esp
+     dab:	50                   	push   %eax
+     dac:	e8 40 38 00 00       	call   45f1 <close>
+     db1:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     db4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     dbb:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     dc2:	eb 66                	jmp    e2a <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     dc4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     dcb:	eb 3b                	jmp    e08 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     dcd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     dd0:	05 a0 6d 00 00       	add    $0x6da0,%eax
+     dd5:	0f b6 00             	movzbl (%eax),%eax
+     dd8:	0f be c8             	movsbl %al,%ecx
+     ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dde:	8d 50 01             	lea    0x1(%eax),%edx
+     de1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     de4:	31 c8                	xor    %ecx,%eax
+     de6:	0f b6 c0             	movzbl %al,%eax
+     de9:	85 c0                	test   %eax,%eax
+     deb:	74 17                	je     e04 <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     ded:	83 ec 08             	sub    $0x8,%esp
+     df0:	68 3f 51 00 00       	push   $0x513f
+     df5:	6a 01                	push   $0x1
+     df7:	e8 79 39 00 00       	call   4775 <printf>
+     dfc:	83 c4 10             	add    $0x10,%esp
+     dff:	e9 ac 00 00 00       	jmp    eb0 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     e04:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     e08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e0b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     e0e:	7c bd                	jl     dcd <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     e10:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     e13:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     e16:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     e19:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e1c:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     e21:	76 07                	jbe    e2a <pipe1+0x161>
+        cc = sizeof(buf);
+     e23:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     e2a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     e2d:	83 ec 04             	sub    $0x4,%esp
+     e30:	ff 75 e8             	push   -0x18(%ebp)
+     e33:	68 a0 6d 00 00       	push   $0x6da0
+     e38:	50                   	push   %eax
+     e39:	e8 a3 37 00 00       	call   45e1 <read>
+     e3e:	83 c4 10             	add    $0x10,%esp
+     e41:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     e44:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     e48:	0f 8f 76 ff ff ff    	jg     dc4 <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     e4e:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     e55:	74 1a                	je     e71 <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     e57:	83 ec 04             	sub    $0x4,%esp
+     e5a:	ff 75 e4             	push   -0x1c(%ebp)
+     e5d:	68 4d 51 00 00       	push   $0x514d
+     e62:	6a 01                	push   $0x1
+     e64:	e8 0c 39 00 00       	call   4775 <printf>
+     e69:	83 c4 10             	add    $0x10,%esp
+      exit();
+     e6c:	e8 58 37 00 00       	call   45c9 <exit>
+    }
+    close(fds[0]);
+     e71:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     e74:	83 ec 0c             	sub    $0xc,%esp
+     e77:	50                   	push   %eax
+     e78:	e8 74 37 00 00       	call   45f1 <close>
+     e7d:	83 c4 10             	add    $0x10,%esp
+    wait();
+     e80:	e8 4c 37 00 00       	call   45d1 <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     e85:	83 ec 08             	sub    $0x8,%esp
+     e88:	68 73 51 00 00       	push   $0x5173
+     e8d:	6a 01                	push   $0x1
+     e8f:	e8 e1 38 00 00       	call   4775 <printf>
+     e94:	83 c4 10             	add    $0x10,%esp
+     e97:	eb 17                	jmp    eb0 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     e99:	83 ec 08             	sub    $0x8,%esp
+     e9c:	68 64 51 00 00       	push   $0x5164
+     ea1:	6a 01                	push   $0x1
+     ea3:	e8 cd 38 00 00       	call   4775 <printf>
+     ea8:	83 c4 10             	add    $0x10,%esp
+    exit();
+     eab:	e8 19 37 00 00       	call   45c9 <exit>
+}
+     eb0:	c9                   	leave
+     eb1:	c3                   	ret
+
+00000eb2 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     eb2:	55                   	push   %ebp
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     eb8:	83 ec 08             	sub    $0x8,%esp
+     ebb:	68 7d 51 00 00       	push   $0x517d
+     ec0:	6a 01                	push   $0x1
+     ec2:	e8 ae 38 00 00       	call   4775 <printf>
+     ec7:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+     eca:	e8 f2 36 00 00       	call   45c1 <fork>
+     ecf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+     ed2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ed6:	75 03                	jne    edb <preempt+0x29>
+    for(;;)
+     ed8:	90                   	nop
+     ed9:	eb fd                	jmp    ed8 <preempt+0x26>
+      ;
+
+  pid2 = fork();
+     edb:	e8 e1 36 00 00       	call   45c1 <fork>
+     ee0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+     ee3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ee7:	75 03                	jne    eec <preempt+0x3a>
+    for(;;)
+     ee9:	90                   	nop
+     eea:	eb fd                	jmp    ee9 <preempt+0x37>
+      ;
+
+  pipe(pfds);
+     eec:	83 ec 0c             	sub    $0xc,%esp
+     eef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     ef2:	50                   	push   %eax
+     ef3:	e8 e1 36 00 00       	call   45d9 <pipe>
+     ef8:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     efb:	e8 c1 36 00 00       	call   45c1 <fork>
+     f00:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+     f03:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f07:	75 4e                	jne    f57 <preempt+0xa5>
+    close(pfds[0]);
+     f09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f0c:	83 ec 0c             	sub    $0xc,%esp
+     f0f:	50                   	push   %eax
+     f10:	e8 dc 36 00 00       	call   45f1 <close>
+     f15:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+     f18:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f1b:	83 ec 04             	sub    $0x4,%esp
+     f1e:	6a 01                	push   $0x1
+     f20:	68 e1 4d 00 00       	push   $0x4de1
+     f25:	50                   	push   %eax
+     f26:	e8 be 36 00 00       	call   45e9 <write>
+     f2b:	83 c4 10             	add    $0x10,%esp
+     f2e:	83 f8 01             	cmp    $0x1,%eax
+     f31:	74 12                	je     f45 <preempt+0x93>
+      printf(1, "preempt write error");
+     f33:	83 ec 08             	sub    $0x8,%esp
+     f36:	68 87 51 00 00       	push   $0x5187
+     f3b:	6a 01                	push   $0x1
+     f3d:	e8 33 38 00 00       	call   4775 <printf>
+     f42:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+     f45:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f48:	83 ec 0c             	sub    $0xc,%esp
+     f4b:	50                   	push   %eax
+     f4c:	e8 a0 36 00 00       	call   45f1 <close>
+     f51:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     f54:	90                   	nop
+     f55:	eb fd                	jmp    f54 <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+     f57:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f5a:	83 ec 0c             	sub    $0xc,%esp
+     f5d:	50                   	push   %eax
+     f5e:	e8 8e 36 00 00       	call   45f1 <close>
+     f63:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     f66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f69:	83 ec 04             	sub    $0x4,%esp
+     f6c:	68 00 20 00 00       	push   $0x2000
+     f71:	68 a0 6d 00 00       	push   $0x6da0
+     f76:	50                   	push   %eax
+     f77:	e8 65 36 00 00       	call   45e1 <read>
+     f7c:	83 c4 10             	add    $0x10,%esp
+     f7f:	83 f8 01             	cmp    $0x1,%eax
+     f82:	74 14                	je     f98 <preempt+0xe6>
+    printf(1, "preempt read error");
+     f84:	83 ec 08             	sub    $0x8,%esp
+     f87:	68 9b 51 00 00       	push   $0x519b
+     f8c:	6a 01                	push   $0x1
+     f8e:	e8 e2 37 00 00       	call   4775 <printf>
+     f93:	83 c4 10             	add    $0x10,%esp
+     f96:	eb 7e                	jmp    1016 <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+     f98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f9b:	83 ec 0c             	sub    $0xc,%esp
+     f9e:	50                   	push   %eax
+     f9f:	e8 4d 36 00 00       	call   45f1 <close>
+     fa4:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+     fa7:	83 ec 08             	sub    $0x8,%esp
+     faa:	68 ae 51 00 00       	push   $0x51ae
+     faf:	6a 01                	push   $0x1
+     fb1:	e8 bf 37 00 00       	call   4775 <printf>
+     fb6:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+     fb9:	83 ec 0c             	sub    $0xc,%esp
+     fbc:	ff 75 f4             	push   -0xc(%ebp)
+     fbf:	e8 35 36 00 00       	call   45f9 <kill>
+     fc4:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+     fc7:	83 ec 0c             	sub    $0xc,%esp
+     fca:	ff 75 f0             	push   -0x10(%ebp)
+     fcd:	e8 27 36 00 00       	call   45f9 <kill>
+     fd2:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+     fd5:	83 ec 0c             	sub    $0xc,%esp
+     fd8:	ff 75 ec             	push   -0x14(%ebp)
+     fdb:	e8 19 36 00 00       	call   45f9 <kill>
+     fe0:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+     fe3:	83 ec 08             	sub    $0x8,%esp
+     fe6:	68 b7 51 00 00       	push   $0x51b7
+     feb:	6a 01                	push   $0x1
+     fed:	e8 83 37 00 00       	call   4775 <printf>
+     ff2:	83 c4 10             	add    $0x10,%esp
+  wait();
+     ff5:	e8 d7 35 00 00       	call   45d1 <wait>
+  wait();
+     ffa:	e8 d2 35 00 00       	call   45d1 <wait>
+  wait();
+     fff:	e8 cd 35 00 00       	call   45d1 <wait>
+  printf(1, "preempt ok\n");
+    1004:	83 ec 08             	sub    $0x8,%esp
+    1007:	68 c0 51 00 00       	push   $0x51c0
+    100c:	6a 01                	push   $0x1
+    100e:	e8 62 37 00 00       	call   4775 <printf>
+    1013:	83 c4 10             	add    $0x10,%esp
+}
+    1016:	c9                   	leave
+    1017:	c3                   	ret
+
+00001018 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    1018:	55                   	push   %ebp
+    1019:	89 e5                	mov    %esp,%ebp
+    101b:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    101e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1025:	eb 4f                	jmp    1076 <exitwait+0x5e>
+    pid = fork();
+    1027:	e8 95 35 00 00       	call   45c1 <fork>
+    102c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    102f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1033:	79 14                	jns    1049 <exitwait+0x31>
+      printf(1, "fork failed\n");
+    1035:	83 ec 08             	sub    $0x8,%esp
+    1038:	68 79 4c 00 00       	push   $0x4c79
+    103d:	6a 01                	push   $0x1
+    103f:	e8 31 37 00 00       	call   4775 <printf>
+    1044:	83 c4 10             	add    $0x10,%esp
+      return;
+    1047:	eb 45                	jmp    108e <exitwait+0x76>
+    }
+    if(pid){
+    1049:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    104d:	74 1e                	je     106d <exitwait+0x55>
+      if(wait() != pid){
+    104f:	e8 7d 35 00 00       	call   45d1 <wait>
+    1054:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1057:	74 19                	je     1072 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+    1059:	83 ec 08             	sub    $0x8,%esp
+    105c:	68 cc 51 00 00       	push   $0x51cc
+    1061:	6a 01                	push   $0x1
+    1063:	e8 0d 37 00 00       	call   4775 <printf>
+    1068:	83 c4 10             	add    $0x10,%esp
+        return;
+    106b:	eb 21                	jmp    108e <exitwait+0x76>
+      }
+    } else {
+      exit();
+    106d:	e8 57 35 00 00       	call   45c9 <exit>
+  for(i = 0; i < 100; i++){
+    1072:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1076:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    107a:	7e ab                	jle    1027 <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+    107c:	83 ec 08             	sub    $0x8,%esp
+    107f:	68 dc 51 00 00       	push   $0x51dc
+    1084:	6a 01                	push   $0x1
+    1086:	e8 ea 36 00 00       	call   4775 <printf>
+    108b:	83 c4 10             	add    $0x10,%esp
+}
+    108e:	c9                   	leave
+    108f:	c3                   	ret
+
+00001090 <mem>:
+
+void
+mem(void)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    1096:	83 ec 08             	sub    $0x8,%esp
+    1099:	68 e9 51 00 00       	push   $0x51e9
+    109e:	6a 01                	push   $0x1
+    10a0:	e8 d0 36 00 00       	call   4775 <printf>
+    10a5:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    10a8:	e8 9c 35 00 00       	call   4649 <getpid>
+    10ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    10b0:	e8 0c 35 00 00       	call   45c1 <fork>
+    10b5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    10bc:	0f 85 b7 00 00 00    	jne    1179 <mem+0xe9>
+    m1 = 0;
+    10c2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    10c9:	eb 0e                	jmp    10d9 <mem+0x49>
+      *(char**)m2 = m1;
+    10cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10ce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    10d1:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    10d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    10d9:	83 ec 0c             	sub    $0xc,%esp
+    10dc:	68 11 27 00 00       	push   $0x2711
+    10e1:	e8 63 39 00 00       	call   4a49 <malloc>
+    10e6:	83 c4 10             	add    $0x10,%esp
+    10e9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    10ec:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    10f0:	75 d9                	jne    10cb <mem+0x3b>
+    }
+    while(m1){
+    10f2:	eb 1c                	jmp    1110 <mem+0x80>
+      m2 = *(char**)m1;
+    10f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10f7:	8b 00                	mov    (%eax),%eax
+    10f9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    10fc:	83 ec 0c             	sub    $0xc,%esp
+    10ff:	ff 75 f4             	push   -0xc(%ebp)
+    1102:	e8 00 38 00 00       	call   4907 <free>
+    1107:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    110a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    110d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    1110:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1114:	75 de                	jne    10f4 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    1116:	83 ec 0c             	sub    $0xc,%esp
+    1119:	68 00 50 00 00       	push   $0x5000
+    111e:	e8 26 39 00 00       	call   4a49 <malloc>
+    1123:	83 c4 10             	add    $0x10,%esp
+    1126:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    1129:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    112d:	75 25                	jne    1154 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    112f:	83 ec 08             	sub    $0x8,%esp
+    1132:	68 f3 51 00 00       	push   $0x51f3
+    1137:	6a 01                	push   $0x1
+    1139:	e8 37 36 00 00       	call   4775 <printf>
+    113e:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    1141:	83 ec 0c             	sub    $0xc,%esp
+    1144:	ff 75 f0             	push   -0x10(%ebp)
+    1147:	e8 ad 34 00 00       	call   45f9 <kill>
+    114c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    114f:	e8 75 34 00 00       	call   45c9 <exit>
+    }
+    free(m1);
+    1154:	83 ec 0c             	sub    $0xc,%esp
+    1157:	ff 75 f4             	push   -0xc(%ebp)
+    115a:	e8 a8 37 00 00       	call   4907 <free>
+    115f:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    1162:	83 ec 08             	sub    $0x8,%esp
+    1165:	68 0d 52 00 00       	push   $0x520d
+    116a:	6a 01                	push   $0x1
+    116c:	e8 04 36 00 00       	call   4775 <printf>
+    1171:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1174:	e8 50 34 00 00       	call   45c9 <exit>
+  } else {
+    wait();
+    1179:	e8 53 34 00 00       	call   45d1 <wait>
+  }
+}
+    117e:	90                   	nop
+    117f:	c9                   	leave
+    1180:	c3                   	ret
+
+00001181 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    1181:	55                   	push   %ebp
+    1182:	89 e5                	mov    %esp,%ebp
+    1184:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    1187:	83 ec 08             	sub    $0x8,%esp
+    118a:	68 15 52 00 00       	push   $0x5215
+    118f:	6a 01                	push   $0x1
+    1191:	e8 df 35 00 00       	call   4775 <printf>
+    1196:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    1199:	83 ec 0c             	sub    $0xc,%esp
+    119c:	68 24 52 00 00       	push   $0x5224
+    11a1:	e8 73 34 00 00       	call   4619 <unlink>
+    11a6:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    11a9:	83 ec 08             	sub    $0x8,%esp
+    11ac:	68 02 02 00 00       	push   $0x202
+    11b1:	68 24 52 00 00       	push   $0x5224
+    11b6:	e8 4e 34 00 00       	call   4609 <open>
+    11bb:	83 c4 10             	add    $0x10,%esp
+    11be:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    11c1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    11c5:	79 17                	jns    11de <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    11c7:	83 ec 08             	sub    $0x8,%esp
+    11ca:	68 30 52 00 00       	push   $0x5230
+    11cf:	6a 01                	push   $0x1
+    11d1:	e8 9f 35 00 00       	call   4775 <printf>
+    11d6:	83 c4 10             	add    $0x10,%esp
+    return;
+    11d9:	e9 84 01 00 00       	jmp    1362 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    11de:	e8 de 33 00 00       	call   45c1 <fork>
+    11e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    11e6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    11ea:	75 07                	jne    11f3 <sharedfd+0x72>
+    11ec:	b8 63 00 00 00       	mov    $0x63,%eax
+    11f1:	eb 05                	jmp    11f8 <sharedfd+0x77>
+    11f3:	b8 70 00 00 00       	mov    $0x70,%eax
+    11f8:	83 ec 04             	sub    $0x4,%esp
+    11fb:	6a 0a                	push   $0xa
+    11fd:	50                   	push   %eax
+    11fe:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1201:	50                   	push   %eax
+    1202:	e8 27 32 00 00       	call   442e <memset>
+    1207:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    120a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1211:	eb 31                	jmp    1244 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1213:	83 ec 04             	sub    $0x4,%esp
+    1216:	6a 0a                	push   $0xa
+    1218:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    121b:	50                   	push   %eax
+    121c:	ff 75 e8             	push   -0x18(%ebp)
+    121f:	e8 c5 33 00 00       	call   45e9 <write>
+    1224:	83 c4 10             	add    $0x10,%esp
+    1227:	83 f8 0a             	cmp    $0xa,%eax
+    122a:	74 14                	je     1240 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    122c:	83 ec 08             	sub    $0x8,%esp
+    122f:	68 5c 52 00 00       	push   $0x525c
+    1234:	6a 01                	push   $0x1
+    1236:	e8 3a 35 00 00       	call   4775 <printf>
+    123b:	83 c4 10             	add    $0x10,%esp
+      break;
+    123e:	eb 0d                	jmp    124d <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    1240:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1244:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    124b:	7e c6                	jle    1213 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    124d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1251:	75 05                	jne    1258 <sharedfd+0xd7>
+    exit();
+    1253:	e8 71 33 00 00       	call   45c9 <exit>
+  else
+    wait();
+    1258:	e8 74 33 00 00       	call   45d1 <wait>
+  close(fd);
+    125d:	83 ec 0c             	sub    $0xc,%esp
+    1260:	ff 75 e8             	push   -0x18(%ebp)
+    1263:	e8 89 33 00 00       	call   45f1 <close>
+    1268:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    126b:	83 ec 08             	sub    $0x8,%esp
+    126e:	6a 00                	push   $0x0
+    1270:	68 24 52 00 00       	push   $0x5224
+    1275:	e8 8f 33 00 00       	call   4609 <open>
+    127a:	83 c4 10             	add    $0x10,%esp
+    127d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1280:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1284:	79 17                	jns    129d <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1286:	83 ec 08             	sub    $0x8,%esp
+    1289:	68 7c 52 00 00       	push   $0x527c
+    128e:	6a 01                	push   $0x1
+    1290:	e8 e0 34 00 00       	call   4775 <printf>
+    1295:	83 c4 10             	add    $0x10,%esp
+    return;
+    1298:	e9 c5 00 00 00       	jmp    1362 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    129d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    12a4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    12aa:	eb 3b                	jmp    12e7 <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    12ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    12b3:	eb 2a                	jmp    12df <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    12b5:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    12b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12bb:	01 d0                	add    %edx,%eax
+    12bd:	0f b6 00             	movzbl (%eax),%eax
+    12c0:	3c 63                	cmp    $0x63,%al
+    12c2:	75 04                	jne    12c8 <sharedfd+0x147>
+        nc++;
+    12c4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    12c8:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    12cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ce:	01 d0                	add    %edx,%eax
+    12d0:	0f b6 00             	movzbl (%eax),%eax
+    12d3:	3c 70                	cmp    $0x70,%al
+    12d5:	75 04                	jne    12db <sharedfd+0x15a>
+        np++;
+    12d7:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    12db:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    12df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12e2:	83 f8 09             	cmp    $0x9,%eax
+    12e5:	76 ce                	jbe    12b5 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    12e7:	83 ec 04             	sub    $0x4,%esp
+    12ea:	6a 0a                	push   $0xa
+    12ec:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    12ef:	50                   	push   %eax
+    12f0:	ff 75 e8             	push   -0x18(%ebp)
+    12f3:	e8 e9 32 00 00       	call   45e1 <read>
+    12f8:	83 c4 10             	add    $0x10,%esp
+    12fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    12fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1302:	7f a8                	jg     12ac <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    1304:	83 ec 0c             	sub    $0xc,%esp
+    1307:	ff 75 e8             	push   -0x18(%ebp)
+    130a:	e8 e2 32 00 00       	call   45f1 <close>
+    130f:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    1312:	83 ec 0c             	sub    $0xc,%esp
+    1315:	68 24 52 00 00       	push   $0x5224
+    131a:	e8 fa 32 00 00       	call   4619 <unlink>
+    131f:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    1322:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    1329:	75 1d                	jne    1348 <sharedfd+0x1c7>
+    132b:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    1332:	75 14                	jne    1348 <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    1334:	83 ec 08             	sub    $0x8,%esp
+    1337:	68 a7 52 00 00       	push   $0x52a7
+    133c:	6a 01                	push   $0x1
+    133e:	e8 32 34 00 00       	call   4775 <printf>
+    1343:	83 c4 10             	add    $0x10,%esp
+    1346:	eb 1a                	jmp    1362 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1348:	ff 75 ec             	push   -0x14(%ebp)
+    134b:	ff 75 f0             	push   -0x10(%ebp)
+    134e:	68 b4 52 00 00       	push   $0x52b4
+    1353:	6a 01                	push   $0x1
+    1355:	e8 1b 34 00 00       	call   4775 <printf>
+    135a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    135d:	e8 67 32 00 00       	call   45c9 <exit>
+  }
+}
+    1362:	c9                   	leave
+    1363:	c3                   	ret
+
+00001364 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    1364:	55                   	push   %ebp
+    1365:	89 e5                	mov    %esp,%ebp
+    1367:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    136a:	c7 45 c8 c9 52 00 00 	movl   $0x52c9,-0x38(%ebp)
+    1371:	c7 45 cc cc 52 00 00 	movl   $0x52cc,-0x34(%ebp)
+    1378:	c7 45 d0 cf 52 00 00 	movl   $0x52cf,-0x30(%ebp)
+    137f:	c7 45 d4 d2 52 00 00 	movl   $0x52d2,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    1386:	83 ec 08             	sub    $0x8,%esp
+    1389:	68 d5 52 00 00       	push   $0x52d5
+    138e:	6a 01                	push   $0x1
+    1390:	e8 e0 33 00 00       	call   4775 <printf>
+    1395:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1398:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    139f:	e9 f0 00 00 00       	jmp    1494 <fourfiles+0x130>
+    fname = names[pi];
+    13a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    13a7:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    13ab:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    13ae:	83 ec 0c             	sub    $0xc,%esp
+    13b1:	ff 75 e4             	push   -0x1c(%ebp)
+    13b4:	e8 60 32 00 00       	call   4619 <unlink>
+    13b9:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    13bc:	e8 00 32 00 00       	call   45c1 <fork>
+    13c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    13c4:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    13c8:	79 17                	jns    13e1 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    13ca:	83 ec 08             	sub    $0x8,%esp
+    13cd:	68 79 4c 00 00       	push   $0x4c79
+    13d2:	6a 01                	push   $0x1
+    13d4:	e8 9c 33 00 00       	call   4775 <printf>
+    13d9:	83 c4 10             	add    $0x10,%esp
+      exit();
+    13dc:	e8 e8 31 00 00       	call   45c9 <exit>
+    }
+
+    if(pid == 0){
+    13e1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    13e5:	0f 85 a5 00 00 00    	jne    1490 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    13eb:	83 ec 08             	sub    $0x8,%esp
+    13ee:	68 02 02 00 00       	push   $0x202
+    13f3:	ff 75 e4             	push   -0x1c(%ebp)
+    13f6:	e8 0e 32 00 00       	call   4609 <open>
+    13fb:	83 c4 10             	add    $0x10,%esp
+    13fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    1401:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1405:	79 17                	jns    141e <fourfiles+0xba>
+        printf(1, "create failed\n");
+    1407:	83 ec 08             	sub    $0x8,%esp
+    140a:	68 e5 52 00 00       	push   $0x52e5
+    140f:	6a 01                	push   $0x1
+    1411:	e8 5f 33 00 00       	call   4775 <printf>
+    1416:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1419:	e8 ab 31 00 00       	call   45c9 <exit>
+      }
+      
+      memset(buf, '0'+pi, 512);
+    141e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1421:	83 c0 30             	add    $0x30,%eax
+    1424:	83 ec 04             	sub    $0x4,%esp
+    1427:	68 00 02 00 00       	push   $0x200
+    142c:	50                   	push   %eax
+    142d:	68 a0 6d 00 00       	push   $0x6da0
+    1432:	e8 f7 2f 00 00       	call   442e <memset>
+    1437:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    143a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1441:	eb 42                	jmp    1485 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    1443:	83 ec 04             	sub    $0x4,%esp
+    1446:	68 f4 01 00 00       	push   $0x1f4
+    144b:	68 a0 6d 00 00       	push   $0x6da0
+    1450:	ff 75 e0             	push   -0x20(%ebp)
+    1453:	e8 91 31 00 00       	call   45e9 <write>
+    1458:	83 c4 10             	add    $0x10,%esp
+    145b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    145e:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    1465:	74 1a                	je     1481 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    1467:	83 ec 04             	sub    $0x4,%esp
+    146a:	ff 75 dc             	push   -0x24(%ebp)
+    146d:	68 f4 52 00 00       	push   $0x52f4
+    1472:	6a 01                	push   $0x1
+    1474:	e8 fc 32 00 00       	call   4775 <printf>
+    1479:	83 c4 10             	add    $0x10,%esp
+          exit();
+    147c:	e8 48 31 00 00       	call   45c9 <exit>
+      for(i = 0; i < 12; i++){
+    1481:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1485:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    1489:	7e b8                	jle    1443 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    148b:	e8 39 31 00 00       	call   45c9 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1490:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1494:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1498:	0f 8e 06 ff ff ff    	jle    13a4 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    149e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    14a5:	eb 09                	jmp    14b0 <fourfiles+0x14c>
+    wait();
+    14a7:	e8 25 31 00 00       	call   45d1 <wait>
+  for(pi = 0; pi < 4; pi++){
+    14ac:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    14b0:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    14b4:	7e f1                	jle    14a7 <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    14b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    14bd:	e9 d4 00 00 00       	jmp    1596 <fourfiles+0x232>
+    fname = names[i];
+    14c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14c5:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    14c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    14cc:	83 ec 08             	sub    $0x8,%esp
+    14cf:	6a 00                	push   $0x0
+    14d1:	ff 75 e4             	push   -0x1c(%ebp)
+    14d4:	e8 30 31 00 00       	call   4609 <open>
+    14d9:	83 c4 10             	add    $0x10,%esp
+    14dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    14df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    14e6:	eb 4a                	jmp    1532 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    14e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    14ef:	eb 33                	jmp    1524 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    14f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    14f4:	05 a0 6d 00 00       	add    $0x6da0,%eax
+    14f9:	0f b6 00             	movzbl (%eax),%eax
+    14fc:	0f be d0             	movsbl %al,%edx
+    14ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1502:	83 c0 30             	add    $0x30,%eax
+    1505:	39 c2                	cmp    %eax,%edx
+    1507:	74 17                	je     1520 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    1509:	83 ec 08             	sub    $0x8,%esp
+    150c:	68 05 53 00 00       	push   $0x5305
+    1511:	6a 01                	push   $0x1
+    1513:	e8 5d 32 00 00       	call   4775 <printf>
+    1518:	83 c4 10             	add    $0x10,%esp
+          exit();
+    151b:	e8 a9 30 00 00       	call   45c9 <exit>
+      for(j = 0; j < n; j++){
+    1520:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1524:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1527:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    152a:	7c c5                	jl     14f1 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    152c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    152f:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1532:	83 ec 04             	sub    $0x4,%esp
+    1535:	68 00 20 00 00       	push   $0x2000
+    153a:	68 a0 6d 00 00       	push   $0x6da0
+    153f:	ff 75 e0             	push   -0x20(%ebp)
+    1542:	e8 9a 30 00 00       	call   45e1 <read>
+    1547:	83 c4 10             	add    $0x10,%esp
+    154a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    154d:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1551:	7f 95                	jg     14e8 <fourfiles+0x184>
+    }
+    close(fd);
+    1553:	83 ec 0c             	sub    $0xc,%esp
+    1556:	ff 75 e0             	push   -0x20(%ebp)
+    1559:	e8 93 30 00 00       	call   45f1 <close>
+    155e:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    1561:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    1568:	74 1a                	je     1584 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    156a:	83 ec 04             	sub    $0x4,%esp
+    156d:	ff 75 ec             	push   -0x14(%ebp)
+    1570:	68 11 53 00 00       	push   $0x5311
+    1575:	6a 01                	push   $0x1
+    1577:	e8 f9 31 00 00       	call   4775 <printf>
+    157c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    157f:	e8 45 30 00 00       	call   45c9 <exit>
+    }
+    unlink(fname);
+    1584:	83 ec 0c             	sub    $0xc,%esp
+    1587:	ff 75 e4             	push   -0x1c(%ebp)
+    158a:	e8 8a 30 00 00       	call   4619 <unlink>
+    158f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1592:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1596:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    159a:	0f 8e 22 ff ff ff    	jle    14c2 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    15a0:	83 ec 08             	sub    $0x8,%esp
+    15a3:	68 22 53 00 00       	push   $0x5322
+    15a8:	6a 01                	push   $0x1
+    15aa:	e8 c6 31 00 00       	call   4775 <printf>
+    15af:	83 c4 10             	add    $0x10,%esp
+}
+    15b2:	90                   	nop
+    15b3:	c9                   	leave
+    15b4:	c3                   	ret
+
+000015b5 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    15b5:	55                   	push   %ebp
+    15b6:	89 e5                	mov    %esp,%ebp
+    15b8:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    15bb:	83 ec 08             	sub    $0x8,%esp
+    15be:	68 30 53 00 00       	push   $0x5330
+    15c3:	6a 01                	push   $0x1
+    15c5:	e8 ab 31 00 00       	call   4775 <printf>
+    15ca:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    15cd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    15d4:	e9 f6 00 00 00       	jmp    16cf <createdelete+0x11a>
+    pid = fork();
+    15d9:	e8 e3 2f 00 00       	call   45c1 <fork>
+    15de:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    15e1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    15e5:	79 17                	jns    15fe <createdelete+0x49>
+      printf(1, "fork failed\n");
+    15e7:	83 ec 08             	sub    $0x8,%esp
+    15ea:	68 79 4c 00 00       	push   $0x4c79
+    15ef:	6a 01                	push   $0x1
+    15f1:	e8 7f 31 00 00       	call   4775 <printf>
+    15f6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    15f9:	e8 cb 2f 00 00       	call   45c9 <exit>
+    }
+
+    if(pid == 0){
+    15fe:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1602:	0f 85 c3 00 00 00    	jne    16cb <createdelete+0x116>
+      name[0] = 'p' + pi;
+    1608:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    160b:	83 c0 70             	add    $0x70,%eax
+    160e:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    1611:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    1615:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    161c:	e9 9b 00 00 00       	jmp    16bc <createdelete+0x107>
+        name[1] = '0' + i;
+    1621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1624:	83 c0 30             	add    $0x30,%eax
+    1627:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    162a:	83 ec 08             	sub    $0x8,%esp
+    162d:	68 02 02 00 00       	push   $0x202
+    1632:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1635:	50                   	push   %eax
+    1636:	e8 ce 2f 00 00       	call   4609 <open>
+    163b:	83 c4 10             	add    $0x10,%esp
+    163e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    1641:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1645:	79 17                	jns    165e <createdelete+0xa9>
+          printf(1, "create failed\n");
+    1647:	83 ec 08             	sub    $0x8,%esp
+    164a:	68 e5 52 00 00       	push   $0x52e5
+    164f:	6a 01                	push   $0x1
+    1651:	e8 1f 31 00 00       	call   4775 <printf>
+    1656:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1659:	e8 6b 2f 00 00       	call   45c9 <exit>
+        }
+        close(fd);
+    165e:	83 ec 0c             	sub    $0xc,%esp
+    1661:	ff 75 ec             	push   -0x14(%ebp)
+    1664:	e8 88 2f 00 00       	call   45f1 <close>
+    1669:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    166c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1670:	7e 46                	jle    16b8 <createdelete+0x103>
+    1672:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1675:	83 e0 01             	and    $0x1,%eax
+    1678:	85 c0                	test   %eax,%eax
+    167a:	75 3c                	jne    16b8 <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    167c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    167f:	89 c2                	mov    %eax,%edx
+    1681:	c1 ea 1f             	shr    $0x1f,%edx
+    1684:	01 d0                	add    %edx,%eax
+    1686:	d1 f8                	sar    %eax
+    1688:	83 c0 30             	add    $0x30,%eax
+    168b:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    168e:	83 ec 0c             	sub    $0xc,%esp
+    1691:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1694:	50                   	push   %eax
+    1695:	e8 7f 2f 00 00       	call   4619 <unlink>
+    169a:	83 c4 10             	add    $0x10,%esp
+    169d:	85 c0                	test   %eax,%eax
+    169f:	79 17                	jns    16b8 <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    16a1:	83 ec 08             	sub    $0x8,%esp
+    16a4:	68 fc 4c 00 00       	push   $0x4cfc
+    16a9:	6a 01                	push   $0x1
+    16ab:	e8 c5 30 00 00       	call   4775 <printf>
+    16b0:	83 c4 10             	add    $0x10,%esp
+            exit();
+    16b3:	e8 11 2f 00 00       	call   45c9 <exit>
+      for(i = 0; i < N; i++){
+    16b8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    16bc:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    16c0:	0f 8e 5b ff ff ff    	jle    1621 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    16c6:	e8 fe 2e 00 00       	call   45c9 <exit>
+  for(pi = 0; pi < 4; pi++){
+    16cb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    16cf:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    16d3:	0f 8e 00 ff ff ff    	jle    15d9 <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    16d9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    16e0:	eb 09                	jmp    16eb <createdelete+0x136>
+    wait();
+    16e2:	e8 ea 2e 00 00       	call   45d1 <wait>
+  for(pi = 0; pi < 4; pi++){
+    16e7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    16eb:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    16ef:	7e f1                	jle    16e2 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    16f1:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    16f5:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    16f9:	88 45 c9             	mov    %al,-0x37(%ebp)
+    16fc:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    1700:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    1703:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    170a:	e9 b2 00 00 00       	jmp    17c1 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    170f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1716:	e9 98 00 00 00       	jmp    17b3 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    171b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    171e:	83 c0 70             	add    $0x70,%eax
+    1721:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1724:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1727:	83 c0 30             	add    $0x30,%eax
+    172a:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    172d:	83 ec 08             	sub    $0x8,%esp
+    1730:	6a 00                	push   $0x0
+    1732:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1735:	50                   	push   %eax
+    1736:	e8 ce 2e 00 00       	call   4609 <open>
+    173b:	83 c4 10             	add    $0x10,%esp
+    173e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    1741:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1745:	74 06                	je     174d <createdelete+0x198>
+    1747:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    174b:	7e 21                	jle    176e <createdelete+0x1b9>
+    174d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1751:	79 1b                	jns    176e <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1753:	83 ec 04             	sub    $0x4,%esp
+    1756:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1759:	50                   	push   %eax
+    175a:	68 44 53 00 00       	push   $0x5344
+    175f:	6a 01                	push   $0x1
+    1761:	e8 0f 30 00 00       	call   4775 <printf>
+    1766:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1769:	e8 5b 2e 00 00       	call   45c9 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    176e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1772:	7e 27                	jle    179b <createdelete+0x1e6>
+    1774:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1778:	7f 21                	jg     179b <createdelete+0x1e6>
+    177a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    177e:	78 1b                	js     179b <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1780:	83 ec 04             	sub    $0x4,%esp
+    1783:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1786:	50                   	push   %eax
+    1787:	68 68 53 00 00       	push   $0x5368
+    178c:	6a 01                	push   $0x1
+    178e:	e8 e2 2f 00 00       	call   4775 <printf>
+    1793:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1796:	e8 2e 2e 00 00       	call   45c9 <exit>
+      }
+      if(fd >= 0)
+    179b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    179f:	78 0e                	js     17af <createdelete+0x1fa>
+        close(fd);
+    17a1:	83 ec 0c             	sub    $0xc,%esp
+    17a4:	ff 75 ec             	push   -0x14(%ebp)
+    17a7:	e8 45 2e 00 00       	call   45f1 <close>
+    17ac:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    17af:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    17b3:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    17b7:	0f 8e 5e ff ff ff    	jle    171b <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    17bd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    17c1:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    17c5:	0f 8e 44 ff ff ff    	jle    170f <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    17cb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    17d2:	eb 38                	jmp    180c <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    17d4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    17db:	eb 25                	jmp    1802 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    17dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17e0:	83 c0 70             	add    $0x70,%eax
+    17e3:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    17e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17e9:	83 c0 30             	add    $0x30,%eax
+    17ec:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    17ef:	83 ec 0c             	sub    $0xc,%esp
+    17f2:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    17f5:	50                   	push   %eax
+    17f6:	e8 1e 2e 00 00       	call   4619 <unlink>
+    17fb:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    17fe:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1802:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1806:	7e d5                	jle    17dd <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    1808:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    180c:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1810:	7e c2                	jle    17d4 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    1812:	83 ec 08             	sub    $0x8,%esp
+    1815:	68 88 53 00 00       	push   $0x5388
+    181a:	6a 01                	push   $0x1
+    181c:	e8 54 2f 00 00       	call   4775 <printf>
+    1821:	83 c4 10             	add    $0x10,%esp
+}
+    1824:	90                   	nop
+    1825:	c9                   	leave
+    1826:	c3                   	ret
+
+00001827 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1827:	55                   	push   %ebp
+    1828:	89 e5                	mov    %esp,%ebp
+    182a:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    182d:	83 ec 08             	sub    $0x8,%esp
+    1830:	68 99 53 00 00       	push   $0x5399
+    1835:	6a 01                	push   $0x1
+    1837:	e8 39 2f 00 00       	call   4775 <printf>
+    183c:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    183f:	83 ec 08             	sub    $0x8,%esp
+    1842:	68 02 02 00 00       	push   $0x202
+    1847:	68 aa 53 00 00       	push   $0x53aa
+    184c:	e8 b8 2d 00 00       	call   4609 <open>
+    1851:	83 c4 10             	add    $0x10,%esp
+    1854:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1857:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    185b:	79 17                	jns    1874 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    185d:	83 ec 08             	sub    $0x8,%esp
+    1860:	68 b5 53 00 00       	push   $0x53b5
+    1865:	6a 01                	push   $0x1
+    1867:	e8 09 2f 00 00       	call   4775 <printf>
+    186c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    186f:	e8 55 2d 00 00       	call   45c9 <exit>
+  }
+  write(fd, "hello", 5);
+    1874:	83 ec 04             	sub    $0x4,%esp
+    1877:	6a 05                	push   $0x5
+    1879:	68 cf 53 00 00       	push   $0x53cf
+    187e:	ff 75 f4             	push   -0xc(%ebp)
+    1881:	e8 63 2d 00 00       	call   45e9 <write>
+    1886:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    1889:	83 ec 0c             	sub    $0xc,%esp
+    188c:	ff 75 f4             	push   -0xc(%ebp)
+    188f:	e8 5d 2d 00 00       	call   45f1 <close>
+    1894:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    1897:	83 ec 08             	sub    $0x8,%esp
+    189a:	6a 02                	push   $0x2
+    189c:	68 aa 53 00 00       	push   $0x53aa
+    18a1:	e8 63 2d 00 00       	call   4609 <open>
+    18a6:	83 c4 10             	add    $0x10,%esp
+    18a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    18ac:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    18b0:	79 17                	jns    18c9 <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    18b2:	83 ec 08             	sub    $0x8,%esp
+    18b5:	68 d5 53 00 00       	push   $0x53d5
+    18ba:	6a 01                	push   $0x1
+    18bc:	e8 b4 2e 00 00       	call   4775 <printf>
+    18c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    18c4:	e8 00 2d 00 00       	call   45c9 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    18c9:	83 ec 0c             	sub    $0xc,%esp
+    18cc:	68 aa 53 00 00       	push   $0x53aa
+    18d1:	e8 43 2d 00 00       	call   4619 <unlink>
+    18d6:	83 c4 10             	add    $0x10,%esp
+    18d9:	85 c0                	test   %eax,%eax
+    18db:	74 17                	je     18f4 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    18dd:	83 ec 08             	sub    $0x8,%esp
+    18e0:	68 ed 53 00 00       	push   $0x53ed
+    18e5:	6a 01                	push   $0x1
+    18e7:	e8 89 2e 00 00       	call   4775 <printf>
+    18ec:	83 c4 10             	add    $0x10,%esp
+    exit();
+    18ef:	e8 d5 2c 00 00       	call   45c9 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    18f4:	83 ec 08             	sub    $0x8,%esp
+    18f7:	68 02 02 00 00       	push   $0x202
+    18fc:	68 aa 53 00 00       	push   $0x53aa
+    1901:	e8 03 2d 00 00       	call   4609 <open>
+    1906:	83 c4 10             	add    $0x10,%esp
+    1909:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    190c:	83 ec 04             	sub    $0x4,%esp
+    190f:	6a 03                	push   $0x3
+    1911:	68 07 54 00 00       	push   $0x5407
+    1916:	ff 75 f0             	push   -0x10(%ebp)
+    1919:	e8 cb 2c 00 00       	call   45e9 <write>
+    191e:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    1921:	83 ec 0c             	sub    $0xc,%esp
+    1924:	ff 75 f0             	push   -0x10(%ebp)
+    1927:	e8 c5 2c 00 00       	call   45f1 <close>
+    192c:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    192f:	83 ec 04             	sub    $0x4,%esp
+    1932:	68 00 20 00 00       	push   $0x2000
+    1937:	68 a0 6d 00 00       	push   $0x6da0
+    193c:	ff 75 f4             	push   -0xc(%ebp)
+    193f:	e8 9d 2c 00 00       	call   45e1 <read>
+    1944:	83 c4 10             	add    $0x10,%esp
+    1947:	83 f8 05             	cmp    $0x5,%eax
+    194a:	74 17                	je     1963 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    194c:	83 ec 08             	sub    $0x8,%esp
+    194f:	68 0b 54 00 00       	push   $0x540b
+    1954:	6a 01                	push   $0x1
+    1956:	e8 1a 2e 00 00       	call   4775 <printf>
+    195b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    195e:	e8 66 2c 00 00       	call   45c9 <exit>
+  }
+  if(buf[0] != 'h'){
+    1963:	0f b6 05 a0 6d 00 00 	movzbl 0x6da0,%eax
+    196a:	3c 68                	cmp    $0x68,%al
+    196c:	74 17                	je     1985 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    196e:	83 ec 08             	sub    $0x8,%esp
+    1971:	68 22 54 00 00       	push   $0x5422
+    1976:	6a 01                	push   $0x1
+    1978:	e8 f8 2d 00 00       	call   4775 <printf>
+    197d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1980:	e8 44 2c 00 00       	call   45c9 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    1985:	83 ec 04             	sub    $0x4,%esp
+    1988:	6a 0a                	push   $0xa
+    198a:	68 a0 6d 00 00       	push   $0x6da0
+    198f:	ff 75 f4             	push   -0xc(%ebp)
+    1992:	e8 52 2c 00 00       	call   45e9 <write>
+    1997:	83 c4 10             	add    $0x10,%esp
+    199a:	83 f8 0a             	cmp    $0xa,%eax
+    199d:	74 17                	je     19b6 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    199f:	83 ec 08             	sub    $0x8,%esp
+    19a2:	68 39 54 00 00       	push   $0x5439
+    19a7:	6a 01                	push   $0x1
+    19a9:	e8 c7 2d 00 00       	call   4775 <printf>
+    19ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19b1:	e8 13 2c 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    19b6:	83 ec 0c             	sub    $0xc,%esp
+    19b9:	ff 75 f4             	push   -0xc(%ebp)
+    19bc:	e8 30 2c 00 00       	call   45f1 <close>
+    19c1:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    19c4:	83 ec 0c             	sub    $0xc,%esp
+    19c7:	68 aa 53 00 00       	push   $0x53aa
+    19cc:	e8 48 2c 00 00       	call   4619 <unlink>
+    19d1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    19d4:	83 ec 08             	sub    $0x8,%esp
+    19d7:	68 52 54 00 00       	push   $0x5452
+    19dc:	6a 01                	push   $0x1
+    19de:	e8 92 2d 00 00       	call   4775 <printf>
+    19e3:	83 c4 10             	add    $0x10,%esp
+}
+    19e6:	90                   	nop
+    19e7:	c9                   	leave
+    19e8:	c3                   	ret
+
+000019e9 <linktest>:
+
+void
+linktest(void)
+{
+    19e9:	55                   	push   %ebp
+    19ea:	89 e5                	mov    %esp,%ebp
+    19ec:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    19ef:	83 ec 08             	sub    $0x8,%esp
+    19f2:	68 61 54 00 00       	push   $0x5461
+    19f7:	6a 01                	push   $0x1
+    19f9:	e8 77 2d 00 00       	call   4775 <printf>
+    19fe:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    1a01:	83 ec 0c             	sub    $0xc,%esp
+    1a04:	68 6b 54 00 00       	push   $0x546b
+    1a09:	e8 0b 2c 00 00       	call   4619 <unlink>
+    1a0e:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    1a11:	83 ec 0c             	sub    $0xc,%esp
+    1a14:	68 6f 54 00 00       	push   $0x546f
+    1a19:	e8 fb 2b 00 00       	call   4619 <unlink>
+    1a1e:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1a21:	83 ec 08             	sub    $0x8,%esp
+    1a24:	68 02 02 00 00       	push   $0x202
+    1a29:	68 6b 54 00 00       	push   $0x546b
+    1a2e:	e8 d6 2b 00 00       	call   4609 <open>
+    1a33:	83 c4 10             	add    $0x10,%esp
+    1a36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1a39:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1a3d:	79 17                	jns    1a56 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    1a3f:	83 ec 08             	sub    $0x8,%esp
+    1a42:	68 73 54 00 00       	push   $0x5473
+    1a47:	6a 01                	push   $0x1
+    1a49:	e8 27 2d 00 00       	call   4775 <printf>
+    1a4e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a51:	e8 73 2b 00 00       	call   45c9 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    1a56:	83 ec 04             	sub    $0x4,%esp
+    1a59:	6a 05                	push   $0x5
+    1a5b:	68 cf 53 00 00       	push   $0x53cf
+    1a60:	ff 75 f4             	push   -0xc(%ebp)
+    1a63:	e8 81 2b 00 00       	call   45e9 <write>
+    1a68:	83 c4 10             	add    $0x10,%esp
+    1a6b:	83 f8 05             	cmp    $0x5,%eax
+    1a6e:	74 17                	je     1a87 <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    1a70:	83 ec 08             	sub    $0x8,%esp
+    1a73:	68 86 54 00 00       	push   $0x5486
+    1a78:	6a 01                	push   $0x1
+    1a7a:	e8 f6 2c 00 00       	call   4775 <printf>
+    1a7f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a82:	e8 42 2b 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    1a87:	83 ec 0c             	sub    $0xc,%esp
+    1a8a:	ff 75 f4             	push   -0xc(%ebp)
+    1a8d:	e8 5f 2b 00 00       	call   45f1 <close>
+    1a92:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    1a95:	83 ec 08             	sub    $0x8,%esp
+    1a98:	68 6f 54 00 00       	push   $0x546f
+    1a9d:	68 6b 54 00 00       	push   $0x546b
+    1aa2:	e8 82 2b 00 00       	call   4629 <link>
+    1aa7:	83 c4 10             	add    $0x10,%esp
+    1aaa:	85 c0                	test   %eax,%eax
+    1aac:	79 17                	jns    1ac5 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    1aae:	83 ec 08             	sub    $0x8,%esp
+    1ab1:	68 98 54 00 00       	push   $0x5498
+    1ab6:	6a 01                	push   $0x1
+    1ab8:	e8 b8 2c 00 00       	call   4775 <printf>
+    1abd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ac0:	e8 04 2b 00 00       	call   45c9 <exit>
+  }
+  unlink("lf1");
+    1ac5:	83 ec 0c             	sub    $0xc,%esp
+    1ac8:	68 6b 54 00 00       	push   $0x546b
+    1acd:	e8 47 2b 00 00       	call   4619 <unlink>
+    1ad2:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    1ad5:	83 ec 08             	sub    $0x8,%esp
+    1ad8:	6a 00                	push   $0x0
+    1ada:	68 6b 54 00 00       	push   $0x546b
+    1adf:	e8 25 2b 00 00       	call   4609 <open>
+    1ae4:	83 c4 10             	add    $0x10,%esp
+    1ae7:	85 c0                	test   %eax,%eax
+    1ae9:	78 17                	js     1b02 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1aeb:	83 ec 08             	sub    $0x8,%esp
+    1aee:	68 b0 54 00 00       	push   $0x54b0
+    1af3:	6a 01                	push   $0x1
+    1af5:	e8 7b 2c 00 00       	call   4775 <printf>
+    1afa:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1afd:	e8 c7 2a 00 00       	call   45c9 <exit>
+  }
+
+  fd = open("lf2", 0);
+    1b02:	83 ec 08             	sub    $0x8,%esp
+    1b05:	6a 00                	push   $0x0
+    1b07:	68 6f 54 00 00       	push   $0x546f
+    1b0c:	e8 f8 2a 00 00       	call   4609 <open>
+    1b11:	83 c4 10             	add    $0x10,%esp
+    1b14:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1b17:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1b1b:	79 17                	jns    1b34 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    1b1d:	83 ec 08             	sub    $0x8,%esp
+    1b20:	68 d5 54 00 00       	push   $0x54d5
+    1b25:	6a 01                	push   $0x1
+    1b27:	e8 49 2c 00 00       	call   4775 <printf>
+    1b2c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b2f:	e8 95 2a 00 00       	call   45c9 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1b34:	83 ec 04             	sub    $0x4,%esp
+    1b37:	68 00 20 00 00       	push   $0x2000
+    1b3c:	68 a0 6d 00 00       	push   $0x6da0
+    1b41:	ff 75 f4             	push   -0xc(%ebp)
+    1b44:	e8 98 2a 00 00       	call   45e1 <read>
+    1b49:	83 c4 10             	add    $0x10,%esp
+    1b4c:	83 f8 05             	cmp    $0x5,%eax
+    1b4f:	74 17                	je     1b68 <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    1b51:	83 ec 08             	sub    $0x8,%esp
+    1b54:	68 e6 54 00 00       	push   $0x54e6
+    1b59:	6a 01                	push   $0x1
+    1b5b:	e8 15 2c 00 00       	call   4775 <printf>
+    1b60:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b63:	e8 61 2a 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    1b68:	83 ec 0c             	sub    $0xc,%esp
+    1b6b:	ff 75 f4             	push   -0xc(%ebp)
+    1b6e:	e8 7e 2a 00 00       	call   45f1 <close>
+    1b73:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    1b76:	83 ec 08             	sub    $0x8,%esp
+    1b79:	68 6f 54 00 00       	push   $0x546f
+    1b7e:	68 6f 54 00 00       	push   $0x546f
+    1b83:	e8 a1 2a 00 00       	call   4629 <link>
+    1b88:	83 c4 10             	add    $0x10,%esp
+    1b8b:	85 c0                	test   %eax,%eax
+    1b8d:	78 17                	js     1ba6 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1b8f:	83 ec 08             	sub    $0x8,%esp
+    1b92:	68 f7 54 00 00       	push   $0x54f7
+    1b97:	6a 01                	push   $0x1
+    1b99:	e8 d7 2b 00 00       	call   4775 <printf>
+    1b9e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ba1:	e8 23 2a 00 00       	call   45c9 <exit>
+  }
+
+  unlink("lf2");
+    1ba6:	83 ec 0c             	sub    $0xc,%esp
+    1ba9:	68 6f 54 00 00       	push   $0x546f
+    1bae:	e8 66 2a 00 00       	call   4619 <unlink>
+    1bb3:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    1bb6:	83 ec 08             	sub    $0x8,%esp
+    1bb9:	68 6b 54 00 00       	push   $0x546b
+    1bbe:	68 6f 54 00 00       	push   $0x546f
+    1bc3:	e8 61 2a 00 00       	call   4629 <link>
+    1bc8:	83 c4 10             	add    $0x10,%esp
+    1bcb:	85 c0                	test   %eax,%eax
+    1bcd:	78 17                	js     1be6 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    1bcf:	83 ec 08             	sub    $0x8,%esp
+    1bd2:	68 18 55 00 00       	push   $0x5518
+    1bd7:	6a 01                	push   $0x1
+    1bd9:	e8 97 2b 00 00       	call   4775 <printf>
+    1bde:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1be1:	e8 e3 29 00 00       	call   45c9 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    1be6:	83 ec 08             	sub    $0x8,%esp
+    1be9:	68 6b 54 00 00       	push   $0x546b
+    1bee:	68 3b 55 00 00       	push   $0x553b
+    1bf3:	e8 31 2a 00 00       	call   4629 <link>
+    1bf8:	83 c4 10             	add    $0x10,%esp
+    1bfb:	85 c0                	test   %eax,%eax
+    1bfd:	78 17                	js     1c16 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1bff:	83 ec 08             	sub    $0x8,%esp
+    1c02:	68 3d 55 00 00       	push   $0x553d
+    1c07:	6a 01                	push   $0x1
+    1c09:	e8 67 2b 00 00       	call   4775 <printf>
+    1c0e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c11:	e8 b3 29 00 00       	call   45c9 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    1c16:	83 ec 08             	sub    $0x8,%esp
+    1c19:	68 59 55 00 00       	push   $0x5559
+    1c1e:	6a 01                	push   $0x1
+    1c20:	e8 50 2b 00 00       	call   4775 <printf>
+    1c25:	83 c4 10             	add    $0x10,%esp
+}
+    1c28:	90                   	nop
+    1c29:	c9                   	leave
+    1c2a:	c3                   	ret
+
+00001c2b <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1c2b:	55                   	push   %ebp
+    1c2c:	89 e5                	mov    %esp,%ebp
+    1c2e:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1c31:	83 ec 08             	sub    $0x8,%esp
+    1c34:	68 66 55 00 00       	push   $0x5566
+    1c39:	6a 01                	push   $0x1
+    1c3b:	e8 35 2b 00 00       	call   4775 <printf>
+    1c40:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    1c43:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1c47:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    1c4b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1c52:	e9 fc 00 00 00       	jmp    1d53 <concreate+0x128>
+    file[1] = '0' + i;
+    1c57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c5a:	83 c0 30             	add    $0x30,%eax
+    1c5d:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1c60:	83 ec 0c             	sub    $0xc,%esp
+    1c63:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c66:	50                   	push   %eax
+    1c67:	e8 ad 29 00 00       	call   4619 <unlink>
+    1c6c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1c6f:	e8 4d 29 00 00       	call   45c1 <fork>
+    1c74:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    1c77:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c7b:	74 3b                	je     1cb8 <concreate+0x8d>
+    1c7d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1c80:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1c85:	89 c8                	mov    %ecx,%eax
+    1c87:	f7 ea                	imul   %edx
+    1c89:	89 c8                	mov    %ecx,%eax
+    1c8b:	c1 f8 1f             	sar    $0x1f,%eax
+    1c8e:	29 c2                	sub    %eax,%edx
+    1c90:	89 d0                	mov    %edx,%eax
+    1c92:	01 c0                	add    %eax,%eax
+    1c94:	01 d0                	add    %edx,%eax
+    1c96:	29 c1                	sub    %eax,%ecx
+    1c98:	89 ca                	mov    %ecx,%edx
+    1c9a:	83 fa 01             	cmp    $0x1,%edx
+    1c9d:	75 19                	jne    1cb8 <concreate+0x8d>
+      link("C0", file);
+    1c9f:	83 ec 08             	sub    $0x8,%esp
+    1ca2:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ca5:	50                   	push   %eax
+    1ca6:	68 76 55 00 00       	push   $0x5576
+    1cab:	e8 79 29 00 00       	call   4629 <link>
+    1cb0:	83 c4 10             	add    $0x10,%esp
+    1cb3:	e9 87 00 00 00       	jmp    1d3f <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    1cb8:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1cbc:	75 3b                	jne    1cf9 <concreate+0xce>
+    1cbe:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1cc1:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1cc6:	89 c8                	mov    %ecx,%eax
+    1cc8:	f7 ea                	imul   %edx
+    1cca:	d1 fa                	sar    %edx
+    1ccc:	89 c8                	mov    %ecx,%eax
+    1cce:	c1 f8 1f             	sar    $0x1f,%eax
+    1cd1:	29 c2                	sub    %eax,%edx
+    1cd3:	89 d0                	mov    %edx,%eax
+    1cd5:	c1 e0 02             	shl    $0x2,%eax
+    1cd8:	01 d0                	add    %edx,%eax
+    1cda:	29 c1                	sub    %eax,%ecx
+    1cdc:	89 ca                	mov    %ecx,%edx
+    1cde:	83 fa 01             	cmp    $0x1,%edx
+    1ce1:	75 16                	jne    1cf9 <concreate+0xce>
+      link("C0", file);
+    1ce3:	83 ec 08             	sub    $0x8,%esp
+    1ce6:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ce9:	50                   	push   %eax
+    1cea:	68 76 55 00 00       	push   $0x5576
+    1cef:	e8 35 29 00 00       	call   4629 <link>
+    1cf4:	83 c4 10             	add    $0x10,%esp
+    1cf7:	eb 46                	jmp    1d3f <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1cf9:	83 ec 08             	sub    $0x8,%esp
+    1cfc:	68 02 02 00 00       	push   $0x202
+    1d01:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1d04:	50                   	push   %eax
+    1d05:	e8 ff 28 00 00       	call   4609 <open>
+    1d0a:	83 c4 10             	add    $0x10,%esp
+    1d0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    1d10:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1d14:	79 1b                	jns    1d31 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    1d16:	83 ec 04             	sub    $0x4,%esp
+    1d19:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1d1c:	50                   	push   %eax
+    1d1d:	68 79 55 00 00       	push   $0x5579
+    1d22:	6a 01                	push   $0x1
+    1d24:	e8 4c 2a 00 00       	call   4775 <printf>
+    1d29:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1d2c:	e8 98 28 00 00       	call   45c9 <exit>
+      }
+      close(fd);
+    1d31:	83 ec 0c             	sub    $0xc,%esp
+    1d34:	ff 75 ec             	push   -0x14(%ebp)
+    1d37:	e8 b5 28 00 00       	call   45f1 <close>
+    1d3c:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1d3f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1d43:	75 05                	jne    1d4a <concreate+0x11f>
+      exit();
+    1d45:	e8 7f 28 00 00       	call   45c9 <exit>
+    else
+      wait();
+    1d4a:	e8 82 28 00 00       	call   45d1 <wait>
+  for(i = 0; i < 40; i++){
+    1d4f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1d53:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1d57:	0f 8e fa fe ff ff    	jle    1c57 <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1d5d:	83 ec 04             	sub    $0x4,%esp
+    1d60:	6a 28                	push   $0x28
+    1d62:	6a 00                	push   $0x0
+    1d64:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1d67:	50                   	push   %eax
+    1d68:	e8 c1 26 00 00       	call   442e <memset>
+    1d6d:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1d70:	83 ec 08             	sub    $0x8,%esp
+    1d73:	6a 00                	push   $0x0
+    1d75:	68 3b 55 00 00       	push   $0x553b
+    1d7a:	e8 8a 28 00 00       	call   4609 <open>
+    1d7f:	83 c4 10             	add    $0x10,%esp
+    1d82:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    1d85:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1d8c:	e9 99 00 00 00       	jmp    1e2a <concreate+0x1ff>
+    if(de.inum == 0)
+    1d91:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    1d95:	66 85 c0             	test   %ax,%ax
+    1d98:	0f 84 8b 00 00 00    	je     1e29 <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1d9e:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    1da2:	3c 43                	cmp    $0x43,%al
+    1da4:	0f 85 80 00 00 00    	jne    1e2a <concreate+0x1ff>
+    1daa:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    1dae:	84 c0                	test   %al,%al
+    1db0:	75 78                	jne    1e2a <concreate+0x1ff>
+      i = de.name[1] - '0';
+    1db2:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    1db6:	0f be c0             	movsbl %al,%eax
+    1db9:	83 e8 30             	sub    $0x30,%eax
+    1dbc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    1dbf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1dc3:	78 08                	js     1dcd <concreate+0x1a2>
+    1dc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dc8:	83 f8 27             	cmp    $0x27,%eax
+    1dcb:	76 1e                	jbe    1deb <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    1dcd:	83 ec 04             	sub    $0x4,%esp
+    1dd0:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1dd3:	83 c0 02             	add    $0x2,%eax
+    1dd6:	50                   	push   %eax
+    1dd7:	68 95 55 00 00       	push   $0x5595
+    1ddc:	6a 01                	push   $0x1
+    1dde:	e8 92 29 00 00       	call   4775 <printf>
+    1de3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1de6:	e8 de 27 00 00       	call   45c9 <exit>
+      }
+      if(fa[i]){
+    1deb:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1dee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1df1:	01 d0                	add    %edx,%eax
+    1df3:	0f b6 00             	movzbl (%eax),%eax
+    1df6:	84 c0                	test   %al,%al
+    1df8:	74 1e                	je     1e18 <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1dfa:	83 ec 04             	sub    $0x4,%esp
+    1dfd:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1e00:	83 c0 02             	add    $0x2,%eax
+    1e03:	50                   	push   %eax
+    1e04:	68 ae 55 00 00       	push   $0x55ae
+    1e09:	6a 01                	push   $0x1
+    1e0b:	e8 65 29 00 00       	call   4775 <printf>
+    1e10:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1e13:	e8 b1 27 00 00       	call   45c9 <exit>
+      }
+      fa[i] = 1;
+    1e18:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e1e:	01 d0                	add    %edx,%eax
+    1e20:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    1e23:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1e27:	eb 01                	jmp    1e2a <concreate+0x1ff>
+      continue;
+    1e29:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    1e2a:	83 ec 04             	sub    $0x4,%esp
+    1e2d:	6a 10                	push   $0x10
+    1e2f:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1e32:	50                   	push   %eax
+    1e33:	ff 75 ec             	push   -0x14(%ebp)
+    1e36:	e8 a6 27 00 00       	call   45e1 <read>
+    1e3b:	83 c4 10             	add    $0x10,%esp
+    1e3e:	85 c0                	test   %eax,%eax
+    1e40:	0f 8f 4b ff ff ff    	jg     1d91 <concreate+0x166>
+    }
+  }
+  close(fd);
+    1e46:	83 ec 0c             	sub    $0xc,%esp
+    1e49:	ff 75 ec             	push   -0x14(%ebp)
+    1e4c:	e8 a0 27 00 00       	call   45f1 <close>
+    1e51:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    1e54:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    1e58:	74 17                	je     1e71 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    1e5a:	83 ec 08             	sub    $0x8,%esp
+    1e5d:	68 cc 55 00 00       	push   $0x55cc
+    1e62:	6a 01                	push   $0x1
+    1e64:	e8 0c 29 00 00       	call   4775 <printf>
+    1e69:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1e6c:	e8 58 27 00 00       	call   45c9 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    1e71:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e78:	e9 43 01 00 00       	jmp    1fc0 <concreate+0x395>
+    file[1] = '0' + i;
+    1e7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e80:	83 c0 30             	add    $0x30,%eax
+    1e83:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1e86:	e8 36 27 00 00       	call   45c1 <fork>
+    1e8b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1e8e:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e92:	79 17                	jns    1eab <concreate+0x280>
+      printf(1, "fork failed\n");
+    1e94:	83 ec 08             	sub    $0x8,%esp
+    1e97:	68 79 4c 00 00       	push   $0x4c79
+    1e9c:	6a 01                	push   $0x1
+    1e9e:	e8 d2 28 00 00       	call   4775 <printf>
+    1ea3:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1ea6:	e8 1e 27 00 00       	call   45c9 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    1eab:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1eae:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1eb3:	89 c8                	mov    %ecx,%eax
+    1eb5:	f7 ea                	imul   %edx
+    1eb7:	89 c8                	mov    %ecx,%eax
+    1eb9:	c1 f8 1f             	sar    $0x1f,%eax
+    1ebc:	29 c2                	sub    %eax,%edx
+    1ebe:	89 d0                	mov    %edx,%eax
+    1ec0:	01 c0                	add    %eax,%eax
+    1ec2:	01 d0                	add    %edx,%eax
+    1ec4:	29 c1                	sub    %eax,%ecx
+    1ec6:	89 ca                	mov    %ecx,%edx
+    1ec8:	85 d2                	test   %edx,%edx
+    1eca:	75 06                	jne    1ed2 <concreate+0x2a7>
+    1ecc:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ed0:	74 28                	je     1efa <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    1ed2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1ed5:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1eda:	89 c8                	mov    %ecx,%eax
+    1edc:	f7 ea                	imul   %edx
+    1ede:	89 c8                	mov    %ecx,%eax
+    1ee0:	c1 f8 1f             	sar    $0x1f,%eax
+    1ee3:	29 c2                	sub    %eax,%edx
+    1ee5:	89 d0                	mov    %edx,%eax
+    1ee7:	01 c0                	add    %eax,%eax
+    1ee9:	01 d0                	add    %edx,%eax
+    1eeb:	29 c1                	sub    %eax,%ecx
+    1eed:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    1eef:	83 fa 01             	cmp    $0x1,%edx
+    1ef2:	75 7c                	jne    1f70 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    1ef4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ef8:	74 76                	je     1f70 <concreate+0x345>
+      close(open(file, 0));
+    1efa:	83 ec 08             	sub    $0x8,%esp
+    1efd:	6a 00                	push   $0x0
+    1eff:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f02:	50                   	push   %eax
+    1f03:	e8 01 27 00 00       	call   4609 <open>
+    1f08:	83 c4 10             	add    $0x10,%esp
+    1f0b:	83 ec 0c             	sub    $0xc,%esp
+    1f0e:	50                   	push   %eax
+    1f0f:	e8 dd 26 00 00       	call   45f1 <close>
+    1f14:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1f17:	83 ec 08             	sub    $0x8,%esp
+    1f1a:	6a 00                	push   $0x0
+    1f1c:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f1f:	50                   	push   %eax
+    1f20:	e8 e4 26 00 00       	call   4609 <open>
+    1f25:	83 c4 10             	add    $0x10,%esp
+    1f28:	83 ec 0c             	sub    $0xc,%esp
+    1f2b:	50                   	push   %eax
+    1f2c:	e8 c0 26 00 00       	call   45f1 <close>
+    1f31:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1f34:	83 ec 08             	sub    $0x8,%esp
+    1f37:	6a 00                	push   $0x0
+    1f39:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f3c:	50                   	push   %eax
+    1f3d:	e8 c7 26 00 00       	call   4609 <open>
+    1f42:	83 c4 10             	add    $0x10,%esp
+    1f45:	83 ec 0c             	sub    $0xc,%esp
+    1f48:	50                   	push   %eax
+    1f49:	e8 a3 26 00 00       	call   45f1 <close>
+    1f4e:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1f51:	83 ec 08             	sub    $0x8,%esp
+    1f54:	6a 00                	push   $0x0
+    1f56:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f59:	50                   	push   %eax
+    1f5a:	e8 aa 26 00 00       	call   4609 <open>
+    1f5f:	83 c4 10             	add    $0x10,%esp
+    1f62:	83 ec 0c             	sub    $0xc,%esp
+    1f65:	50                   	push   %eax
+    1f66:	e8 86 26 00 00       	call   45f1 <close>
+    1f6b:	83 c4 10             	add    $0x10,%esp
+    1f6e:	eb 3c                	jmp    1fac <concreate+0x381>
+    } else {
+      unlink(file);
+    1f70:	83 ec 0c             	sub    $0xc,%esp
+    1f73:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f76:	50                   	push   %eax
+    1f77:	e8 9d 26 00 00       	call   4619 <unlink>
+    1f7c:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f7f:	83 ec 0c             	sub    $0xc,%esp
+    1f82:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f85:	50                   	push   %eax
+    1f86:	e8 8e 26 00 00       	call   4619 <unlink>
+    1f8b:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f8e:	83 ec 0c             	sub    $0xc,%esp
+    1f91:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f94:	50                   	push   %eax
+    1f95:	e8 7f 26 00 00       	call   4619 <unlink>
+    1f9a:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f9d:	83 ec 0c             	sub    $0xc,%esp
+    1fa0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1fa3:	50                   	push   %eax
+    1fa4:	e8 70 26 00 00       	call   4619 <unlink>
+    1fa9:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1fac:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1fb0:	75 05                	jne    1fb7 <concreate+0x38c>
+      exit();
+    1fb2:	e8 12 26 00 00       	call   45c9 <exit>
+    else
+      wait();
+    1fb7:	e8 15 26 00 00       	call   45d1 <wait>
+  for(i = 0; i < 40; i++){
+    1fbc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1fc0:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1fc4:	0f 8e b3 fe ff ff    	jle    1e7d <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    1fca:	83 ec 08             	sub    $0x8,%esp
+    1fcd:	68 fd 55 00 00       	push   $0x55fd
+    1fd2:	6a 01                	push   $0x1
+    1fd4:	e8 9c 27 00 00       	call   4775 <printf>
+    1fd9:	83 c4 10             	add    $0x10,%esp
+}
+    1fdc:	90                   	nop
+    1fdd:	c9                   	leave
+    1fde:	c3                   	ret
+
+00001fdf <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    1fdf:	55                   	push   %ebp
+    1fe0:	89 e5                	mov    %esp,%ebp
+    1fe2:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1fe5:	83 ec 08             	sub    $0x8,%esp
+    1fe8:	68 0b 56 00 00       	push   $0x560b
+    1fed:	6a 01                	push   $0x1
+    1fef:	e8 81 27 00 00       	call   4775 <printf>
+    1ff4:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    1ff7:	83 ec 0c             	sub    $0xc,%esp
+    1ffa:	68 e1 4d 00 00       	push   $0x4de1
+    1fff:	e8 15 26 00 00       	call   4619 <unlink>
+    2004:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2007:	e8 b5 25 00 00       	call   45c1 <fork>
+    200c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    200f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2013:	79 17                	jns    202c <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    2015:	83 ec 08             	sub    $0x8,%esp
+    2018:	68 79 4c 00 00       	push   $0x4c79
+    201d:	6a 01                	push   $0x1
+    201f:	e8 51 27 00 00       	call   4775 <printf>
+    2024:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2027:	e8 9d 25 00 00       	call   45c9 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    202c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2030:	74 07                	je     2039 <linkunlink+0x5a>
+    2032:	b8 01 00 00 00       	mov    $0x1,%eax
+    2037:	eb 05                	jmp    203e <linkunlink+0x5f>
+    2039:	b8 61 00 00 00       	mov    $0x61,%eax
+    203e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    2041:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2048:	e9 98 00 00 00       	jmp    20e5 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    204d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2050:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    2056:	05 39 30 00 00       	add    $0x3039,%eax
+    205b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    205e:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2061:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2066:	89 c8                	mov    %ecx,%eax
+    2068:	f7 e2                	mul    %edx
+    206a:	d1 ea                	shr    %edx
+    206c:	89 d0                	mov    %edx,%eax
+    206e:	01 c0                	add    %eax,%eax
+    2070:	01 d0                	add    %edx,%eax
+    2072:	29 c1                	sub    %eax,%ecx
+    2074:	89 ca                	mov    %ecx,%edx
+    2076:	85 d2                	test   %edx,%edx
+    2078:	75 23                	jne    209d <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    207a:	83 ec 08             	sub    $0x8,%esp
+    207d:	68 02 02 00 00       	push   $0x202
+    2082:	68 e1 4d 00 00       	push   $0x4de1
+    2087:	e8 7d 25 00 00       	call   4609 <open>
+    208c:	83 c4 10             	add    $0x10,%esp
+    208f:	83 ec 0c             	sub    $0xc,%esp
+    2092:	50                   	push   %eax
+    2093:	e8 59 25 00 00       	call   45f1 <close>
+    2098:	83 c4 10             	add    $0x10,%esp
+    209b:	eb 44                	jmp    20e1 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    209d:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    20a0:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    20a5:	89 c8                	mov    %ecx,%eax
+    20a7:	f7 e2                	mul    %edx
+    20a9:	d1 ea                	shr    %edx
+    20ab:	89 d0                	mov    %edx,%eax
+    20ad:	01 c0                	add    %eax,%eax
+    20af:	01 d0                	add    %edx,%eax
+    20b1:	29 c1                	sub    %eax,%ecx
+    20b3:	89 ca                	mov    %ecx,%edx
+    20b5:	83 fa 01             	cmp    $0x1,%edx
+    20b8:	75 17                	jne    20d1 <linkunlink+0xf2>
+      link("cat", "x");
+    20ba:	83 ec 08             	sub    $0x8,%esp
+    20bd:	68 e1 4d 00 00       	push   $0x4de1
+    20c2:	68 bf 4d 00 00       	push   $0x4dbf
+    20c7:	e8 5d 25 00 00       	call   4629 <link>
+    20cc:	83 c4 10             	add    $0x10,%esp
+    20cf:	eb 10                	jmp    20e1 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    20d1:	83 ec 0c             	sub    $0xc,%esp
+    20d4:	68 e1 4d 00 00       	push   $0x4de1
+    20d9:	e8 3b 25 00 00       	call   4619 <unlink>
+    20de:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    20e1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20e5:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    20e9:	0f 8e 5e ff ff ff    	jle    204d <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    20ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    20f3:	74 07                	je     20fc <linkunlink+0x11d>
+    wait();
+    20f5:	e8 d7 24 00 00       	call   45d1 <wait>
+    20fa:	eb 05                	jmp    2101 <linkunlink+0x122>
+  else 
+    exit();
+    20fc:	e8 c8 24 00 00       	call   45c9 <exit>
+
+  printf(1, "linkunlink ok\n");
+    2101:	83 ec 08             	sub    $0x8,%esp
+    2104:	68 1c 56 00 00       	push   $0x561c
+    2109:	6a 01                	push   $0x1
+    210b:	e8 65 26 00 00       	call   4775 <printf>
+    2110:	83 c4 10             	add    $0x10,%esp
+}
+    2113:	90                   	nop
+    2114:	c9                   	leave
+    2115:	c3                   	ret
+
+00002116 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    2116:	55                   	push   %ebp
+    2117:	89 e5                	mov    %esp,%ebp
+    2119:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    211c:	83 ec 08             	sub    $0x8,%esp
+    211f:	68 2b 56 00 00       	push   $0x562b
+    2124:	6a 01                	push   $0x1
+    2126:	e8 4a 26 00 00       	call   4775 <printf>
+    212b:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    212e:	83 ec 0c             	sub    $0xc,%esp
+    2131:	68 38 56 00 00       	push   $0x5638
+    2136:	e8 de 24 00 00       	call   4619 <unlink>
+    213b:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    213e:	83 ec 08             	sub    $0x8,%esp
+    2141:	68 00 02 00 00       	push   $0x200
+    2146:	68 38 56 00 00       	push   $0x5638
+    214b:	e8 b9 24 00 00       	call   4609 <open>
+    2150:	83 c4 10             	add    $0x10,%esp
+    2153:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    2156:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    215a:	79 17                	jns    2173 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    215c:	83 ec 08             	sub    $0x8,%esp
+    215f:	68 3b 56 00 00       	push   $0x563b
+    2164:	6a 01                	push   $0x1
+    2166:	e8 0a 26 00 00       	call   4775 <printf>
+    216b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    216e:	e8 56 24 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    2173:	83 ec 0c             	sub    $0xc,%esp
+    2176:	ff 75 f0             	push   -0x10(%ebp)
+    2179:	e8 73 24 00 00       	call   45f1 <close>
+    217e:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    2181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2188:	eb 69                	jmp    21f3 <bigdir+0xdd>
+    name[0] = 'x';
+    218a:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    218e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2191:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2194:	85 c0                	test   %eax,%eax
+    2196:	0f 48 c2             	cmovs  %edx,%eax
+    2199:	c1 f8 06             	sar    $0x6,%eax
+    219c:	83 c0 30             	add    $0x30,%eax
+    219f:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    21a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    21a5:	89 d0                	mov    %edx,%eax
+    21a7:	c1 f8 1f             	sar    $0x1f,%eax
+    21aa:	c1 e8 1a             	shr    $0x1a,%eax
+    21ad:	01 c2                	add    %eax,%edx
+    21af:	83 e2 3f             	and    $0x3f,%edx
+    21b2:	29 c2                	sub    %eax,%edx
+    21b4:	89 d0                	mov    %edx,%eax
+    21b6:	83 c0 30             	add    $0x30,%eax
+    21b9:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    21bc:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    21c0:	83 ec 08             	sub    $0x8,%esp
+    21c3:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    21c6:	50                   	push   %eax
+    21c7:	68 38 56 00 00       	push   $0x5638
+    21cc:	e8 58 24 00 00       	call   4629 <link>
+    21d1:	83 c4 10             	add    $0x10,%esp
+    21d4:	85 c0                	test   %eax,%eax
+    21d6:	74 17                	je     21ef <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    21d8:	83 ec 08             	sub    $0x8,%esp
+    21db:	68 51 56 00 00       	push   $0x5651
+    21e0:	6a 01                	push   $0x1
+    21e2:	e8 8e 25 00 00       	call   4775 <printf>
+    21e7:	83 c4 10             	add    $0x10,%esp
+      exit();
+    21ea:	e8 da 23 00 00       	call   45c9 <exit>
+  for(i = 0; i < 500; i++){
+    21ef:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    21f3:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    21fa:	7e 8e                	jle    218a <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    21fc:	83 ec 0c             	sub    $0xc,%esp
+    21ff:	68 38 56 00 00       	push   $0x5638
+    2204:	e8 10 24 00 00       	call   4619 <unlink>
+    2209:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    220c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2213:	eb 64                	jmp    2279 <bigdir+0x163>
+    name[0] = 'x';
+    2215:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    2219:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    221c:	8d 50 3f             	lea    0x3f(%eax),%edx
+    221f:	85 c0                	test   %eax,%eax
+    2221:	0f 48 c2             	cmovs  %edx,%eax
+    2224:	c1 f8 06             	sar    $0x6,%eax
+    2227:	83 c0 30             	add    $0x30,%eax
+    222a:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    222d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2230:	89 d0                	mov    %edx,%eax
+    2232:	c1 f8 1f             	sar    $0x1f,%eax
+    2235:	c1 e8 1a             	shr    $0x1a,%eax
+    2238:	01 c2                	add    %eax,%edx
+    223a:	83 e2 3f             	and    $0x3f,%edx
+    223d:	29 c2                	sub    %eax,%edx
+    223f:	89 d0                	mov    %edx,%eax
+    2241:	83 c0 30             	add    $0x30,%eax
+    2244:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    2247:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    224b:	83 ec 0c             	sub    $0xc,%esp
+    224e:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    2251:	50                   	push   %eax
+    2252:	e8 c2 23 00 00       	call   4619 <unlink>
+    2257:	83 c4 10             	add    $0x10,%esp
+    225a:	85 c0                	test   %eax,%eax
+    225c:	74 17                	je     2275 <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    225e:	83 ec 08             	sub    $0x8,%esp
+    2261:	68 65 56 00 00       	push   $0x5665
+    2266:	6a 01                	push   $0x1
+    2268:	e8 08 25 00 00       	call   4775 <printf>
+    226d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2270:	e8 54 23 00 00       	call   45c9 <exit>
+  for(i = 0; i < 500; i++){
+    2275:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2279:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2280:	7e 93                	jle    2215 <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    2282:	83 ec 08             	sub    $0x8,%esp
+    2285:	68 7a 56 00 00       	push   $0x567a
+    228a:	6a 01                	push   $0x1
+    228c:	e8 e4 24 00 00       	call   4775 <printf>
+    2291:	83 c4 10             	add    $0x10,%esp
+}
+    2294:	90                   	nop
+    2295:	c9                   	leave
+    2296:	c3                   	ret
+
+00002297 <subdir>:
+
+void
+subdir(void)
+{
+    2297:	55                   	push   %ebp
+    2298:	89 e5                	mov    %esp,%ebp
+    229a:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    229d:	83 ec 08             	sub    $0x8,%esp
+    22a0:	68 85 56 00 00       	push   $0x5685
+    22a5:	6a 01                	push   $0x1
+    22a7:	e8 c9 24 00 00       	call   4775 <printf>
+    22ac:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    22af:	83 ec 0c             	sub    $0xc,%esp
+    22b2:	68 92 56 00 00       	push   $0x5692
+    22b7:	e8 5d 23 00 00       	call   4619 <unlink>
+    22bc:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    22bf:	83 ec 0c             	sub    $0xc,%esp
+    22c2:	68 95 56 00 00       	push   $0x5695
+    22c7:	e8 65 23 00 00       	call   4631 <mkdir>
+    22cc:	83 c4 10             	add    $0x10,%esp
+    22cf:	85 c0                	test   %eax,%eax
+    22d1:	74 17                	je     22ea <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    22d3:	83 ec 08             	sub    $0x8,%esp
+    22d6:	68 98 56 00 00       	push   $0x5698
+    22db:	6a 01                	push   $0x1
+    22dd:	e8 93 24 00 00       	call   4775 <printf>
+    22e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22e5:	e8 df 22 00 00       	call   45c9 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    22ea:	83 ec 08             	sub    $0x8,%esp
+    22ed:	68 02 02 00 00       	push   $0x202
+    22f2:	68 b0 56 00 00       	push   $0x56b0
+    22f7:	e8 0d 23 00 00       	call   4609 <open>
+    22fc:	83 c4 10             	add    $0x10,%esp
+    22ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2302:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2306:	79 17                	jns    231f <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    2308:	83 ec 08             	sub    $0x8,%esp
+    230b:	68 b6 56 00 00       	push   $0x56b6
+    2310:	6a 01                	push   $0x1
+    2312:	e8 5e 24 00 00       	call   4775 <printf>
+    2317:	83 c4 10             	add    $0x10,%esp
+    exit();
+    231a:	e8 aa 22 00 00       	call   45c9 <exit>
+  }
+  write(fd, "ff", 2);
+    231f:	83 ec 04             	sub    $0x4,%esp
+    2322:	6a 02                	push   $0x2
+    2324:	68 92 56 00 00       	push   $0x5692
+    2329:	ff 75 f4             	push   -0xc(%ebp)
+    232c:	e8 b8 22 00 00       	call   45e9 <write>
+    2331:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2334:	83 ec 0c             	sub    $0xc,%esp
+    2337:	ff 75 f4             	push   -0xc(%ebp)
+    233a:	e8 b2 22 00 00       	call   45f1 <close>
+    233f:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    2342:	83 ec 0c             	sub    $0xc,%esp
+    2345:	68 95 56 00 00       	push   $0x5695
+    234a:	e8 ca 22 00 00       	call   4619 <unlink>
+    234f:	83 c4 10             	add    $0x10,%esp
+    2352:	85 c0                	test   %eax,%eax
+    2354:	78 17                	js     236d <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2356:	83 ec 08             	sub    $0x8,%esp
+    2359:	68 cc 56 00 00       	push   $0x56cc
+    235e:	6a 01                	push   $0x1
+    2360:	e8 10 24 00 00       	call   4775 <printf>
+    2365:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2368:	e8 5c 22 00 00       	call   45c9 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    236d:	83 ec 0c             	sub    $0xc,%esp
+    2370:	68 f2 56 00 00       	push   $0x56f2
+    2375:	e8 b7 22 00 00       	call   4631 <mkdir>
+    237a:	83 c4 10             	add    $0x10,%esp
+    237d:	85 c0                	test   %eax,%eax
+    237f:	74 17                	je     2398 <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2381:	83 ec 08             	sub    $0x8,%esp
+    2384:	68 f9 56 00 00       	push   $0x56f9
+    2389:	6a 01                	push   $0x1
+    238b:	e8 e5 23 00 00       	call   4775 <printf>
+    2390:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2393:	e8 31 22 00 00       	call   45c9 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2398:	83 ec 08             	sub    $0x8,%esp
+    239b:	68 02 02 00 00       	push   $0x202
+    23a0:	68 14 57 00 00       	push   $0x5714
+    23a5:	e8 5f 22 00 00       	call   4609 <open>
+    23aa:	83 c4 10             	add    $0x10,%esp
+    23ad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    23b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    23b4:	79 17                	jns    23cd <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    23b6:	83 ec 08             	sub    $0x8,%esp
+    23b9:	68 1d 57 00 00       	push   $0x571d
+    23be:	6a 01                	push   $0x1
+    23c0:	e8 b0 23 00 00       	call   4775 <printf>
+    23c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23c8:	e8 fc 21 00 00       	call   45c9 <exit>
+  }
+  write(fd, "FF", 2);
+    23cd:	83 ec 04             	sub    $0x4,%esp
+    23d0:	6a 02                	push   $0x2
+    23d2:	68 35 57 00 00       	push   $0x5735
+    23d7:	ff 75 f4             	push   -0xc(%ebp)
+    23da:	e8 0a 22 00 00       	call   45e9 <write>
+    23df:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    23e2:	83 ec 0c             	sub    $0xc,%esp
+    23e5:	ff 75 f4             	push   -0xc(%ebp)
+    23e8:	e8 04 22 00 00       	call   45f1 <close>
+    23ed:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    23f0:	83 ec 08             	sub    $0x8,%esp
+    23f3:	6a 00                	push   $0x0
+    23f5:	68 38 57 00 00       	push   $0x5738
+    23fa:	e8 0a 22 00 00       	call   4609 <open>
+    23ff:	83 c4 10             	add    $0x10,%esp
+    2402:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2405:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2409:	79 17                	jns    2422 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    240b:	83 ec 08             	sub    $0x8,%esp
+    240e:	68 44 57 00 00       	push   $0x5744
+    2413:	6a 01                	push   $0x1
+    2415:	e8 5b 23 00 00       	call   4775 <printf>
+    241a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    241d:	e8 a7 21 00 00       	call   45c9 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    2422:	83 ec 04             	sub    $0x4,%esp
+    2425:	68 00 20 00 00       	push   $0x2000
+    242a:	68 a0 6d 00 00       	push   $0x6da0
+    242f:	ff 75 f4             	push   -0xc(%ebp)
+    2432:	e8 aa 21 00 00       	call   45e1 <read>
+    2437:	83 c4 10             	add    $0x10,%esp
+    243a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    243d:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    2441:	75 0b                	jne    244e <subdir+0x1b7>
+    2443:	0f b6 05 a0 6d 00 00 	movzbl 0x6da0,%eax
+    244a:	3c 66                	cmp    $0x66,%al
+    244c:	74 17                	je     2465 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    244e:	83 ec 08             	sub    $0x8,%esp
+    2451:	68 5d 57 00 00       	push   $0x575d
+    2456:	6a 01                	push   $0x1
+    2458:	e8 18 23 00 00       	call   4775 <printf>
+    245d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2460:	e8 64 21 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    2465:	83 ec 0c             	sub    $0xc,%esp
+    2468:	ff 75 f4             	push   -0xc(%ebp)
+    246b:	e8 81 21 00 00       	call   45f1 <close>
+    2470:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2473:	83 ec 08             	sub    $0x8,%esp
+    2476:	68 78 57 00 00       	push   $0x5778
+    247b:	68 14 57 00 00       	push   $0x5714
+    2480:	e8 a4 21 00 00       	call   4629 <link>
+    2485:	83 c4 10             	add    $0x10,%esp
+    2488:	85 c0                	test   %eax,%eax
+    248a:	74 17                	je     24a3 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    248c:	83 ec 08             	sub    $0x8,%esp
+    248f:	68 84 57 00 00       	push   $0x5784
+    2494:	6a 01                	push   $0x1
+    2496:	e8 da 22 00 00       	call   4775 <printf>
+    249b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    249e:	e8 26 21 00 00       	call   45c9 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    24a3:	83 ec 0c             	sub    $0xc,%esp
+    24a6:	68 14 57 00 00       	push   $0x5714
+    24ab:	e8 69 21 00 00       	call   4619 <unlink>
+    24b0:	83 c4 10             	add    $0x10,%esp
+    24b3:	85 c0                	test   %eax,%eax
+    24b5:	74 17                	je     24ce <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    24b7:	83 ec 08             	sub    $0x8,%esp
+    24ba:	68 a5 57 00 00       	push   $0x57a5
+    24bf:	6a 01                	push   $0x1
+    24c1:	e8 af 22 00 00       	call   4775 <printf>
+    24c6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24c9:	e8 fb 20 00 00       	call   45c9 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    24ce:	83 ec 08             	sub    $0x8,%esp
+    24d1:	6a 00                	push   $0x0
+    24d3:	68 14 57 00 00       	push   $0x5714
+    24d8:	e8 2c 21 00 00       	call   4609 <open>
+    24dd:	83 c4 10             	add    $0x10,%esp
+    24e0:	85 c0                	test   %eax,%eax
+    24e2:	78 17                	js     24fb <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    24e4:	83 ec 08             	sub    $0x8,%esp
+    24e7:	68 c0 57 00 00       	push   $0x57c0
+    24ec:	6a 01                	push   $0x1
+    24ee:	e8 82 22 00 00       	call   4775 <printf>
+    24f3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24f6:	e8 ce 20 00 00       	call   45c9 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    24fb:	83 ec 0c             	sub    $0xc,%esp
+    24fe:	68 95 56 00 00       	push   $0x5695
+    2503:	e8 31 21 00 00       	call   4639 <chdir>
+    2508:	83 c4 10             	add    $0x10,%esp
+    250b:	85 c0                	test   %eax,%eax
+    250d:	74 17                	je     2526 <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    250f:	83 ec 08             	sub    $0x8,%esp
+    2512:	68 e4 57 00 00       	push   $0x57e4
+    2517:	6a 01                	push   $0x1
+    2519:	e8 57 22 00 00       	call   4775 <printf>
+    251e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2521:	e8 a3 20 00 00       	call   45c9 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    2526:	83 ec 0c             	sub    $0xc,%esp
+    2529:	68 f5 57 00 00       	push   $0x57f5
+    252e:	e8 06 21 00 00       	call   4639 <chdir>
+    2533:	83 c4 10             	add    $0x10,%esp
+    2536:	85 c0                	test   %eax,%eax
+    2538:	74 17                	je     2551 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    253a:	83 ec 08             	sub    $0x8,%esp
+    253d:	68 01 58 00 00       	push   $0x5801
+    2542:	6a 01                	push   $0x1
+    2544:	e8 2c 22 00 00       	call   4775 <printf>
+    2549:	83 c4 10             	add    $0x10,%esp
+    exit();
+    254c:	e8 78 20 00 00       	call   45c9 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    2551:	83 ec 0c             	sub    $0xc,%esp
+    2554:	68 1b 58 00 00       	push   $0x581b
+    2559:	e8 db 20 00 00       	call   4639 <chdir>
+    255e:	83 c4 10             	add    $0x10,%esp
+    2561:	85 c0                	test   %eax,%eax
+    2563:	74 17                	je     257c <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    2565:	83 ec 08             	sub    $0x8,%esp
+    2568:	68 01 58 00 00       	push   $0x5801
+    256d:	6a 01                	push   $0x1
+    256f:	e8 01 22 00 00       	call   4775 <printf>
+    2574:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2577:	e8 4d 20 00 00       	call   45c9 <exit>
+  }
+  if(chdir("./..") != 0){
+    257c:	83 ec 0c             	sub    $0xc,%esp
+    257f:	68 2a 58 00 00       	push   $0x582a
+    2584:	e8 b0 20 00 00       	call   4639 <chdir>
+    2589:	83 c4 10             	add    $0x10,%esp
+    258c:	85 c0                	test   %eax,%eax
+    258e:	74 17                	je     25a7 <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    2590:	83 ec 08             	sub    $0x8,%esp
+    2593:	68 2f 58 00 00       	push   $0x582f
+    2598:	6a 01                	push   $0x1
+    259a:	e8 d6 21 00 00       	call   4775 <printf>
+    259f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25a2:	e8 22 20 00 00       	call   45c9 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    25a7:	83 ec 08             	sub    $0x8,%esp
+    25aa:	6a 00                	push   $0x0
+    25ac:	68 78 57 00 00       	push   $0x5778
+    25b1:	e8 53 20 00 00       	call   4609 <open>
+    25b6:	83 c4 10             	add    $0x10,%esp
+    25b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    25bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    25c0:	79 17                	jns    25d9 <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    25c2:	83 ec 08             	sub    $0x8,%esp
+    25c5:	68 42 58 00 00       	push   $0x5842
+    25ca:	6a 01                	push   $0x1
+    25cc:	e8 a4 21 00 00       	call   4775 <printf>
+    25d1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25d4:	e8 f0 1f 00 00       	call   45c9 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    25d9:	83 ec 04             	sub    $0x4,%esp
+    25dc:	68 00 20 00 00       	push   $0x2000
+    25e1:	68 a0 6d 00 00       	push   $0x6da0
+    25e6:	ff 75 f4             	push   -0xc(%ebp)
+    25e9:	e8 f3 1f 00 00       	call   45e1 <read>
+    25ee:	83 c4 10             	add    $0x10,%esp
+    25f1:	83 f8 02             	cmp    $0x2,%eax
+    25f4:	74 17                	je     260d <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    25f6:	83 ec 08             	sub    $0x8,%esp
+    25f9:	68 5a 58 00 00       	push   $0x585a
+    25fe:	6a 01                	push   $0x1
+    2600:	e8 70 21 00 00       	call   4775 <printf>
+    2605:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2608:	e8 bc 1f 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    260d:	83 ec 0c             	sub    $0xc,%esp
+    2610:	ff 75 f4             	push   -0xc(%ebp)
+    2613:	e8 d9 1f 00 00       	call   45f1 <close>
+    2618:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    261b:	83 ec 08             	sub    $0x8,%esp
+    261e:	6a 00                	push   $0x0
+    2620:	68 14 57 00 00       	push   $0x5714
+    2625:	e8 df 1f 00 00       	call   4609 <open>
+    262a:	83 c4 10             	add    $0x10,%esp
+    262d:	85 c0                	test   %eax,%eax
+    262f:	78 17                	js     2648 <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2631:	83 ec 08             	sub    $0x8,%esp
+    2634:	68 78 58 00 00       	push   $0x5878
+    2639:	6a 01                	push   $0x1
+    263b:	e8 35 21 00 00       	call   4775 <printf>
+    2640:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2643:	e8 81 1f 00 00       	call   45c9 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2648:	83 ec 08             	sub    $0x8,%esp
+    264b:	68 02 02 00 00       	push   $0x202
+    2650:	68 9d 58 00 00       	push   $0x589d
+    2655:	e8 af 1f 00 00       	call   4609 <open>
+    265a:	83 c4 10             	add    $0x10,%esp
+    265d:	85 c0                	test   %eax,%eax
+    265f:	78 17                	js     2678 <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2661:	83 ec 08             	sub    $0x8,%esp
+    2664:	68 a6 58 00 00       	push   $0x58a6
+    2669:	6a 01                	push   $0x1
+    266b:	e8 05 21 00 00       	call   4775 <printf>
+    2670:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2673:	e8 51 1f 00 00       	call   45c9 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2678:	83 ec 08             	sub    $0x8,%esp
+    267b:	68 02 02 00 00       	push   $0x202
+    2680:	68 c2 58 00 00       	push   $0x58c2
+    2685:	e8 7f 1f 00 00       	call   4609 <open>
+    268a:	83 c4 10             	add    $0x10,%esp
+    268d:	85 c0                	test   %eax,%eax
+    268f:	78 17                	js     26a8 <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2691:	83 ec 08             	sub    $0x8,%esp
+    2694:	68 cb 58 00 00       	push   $0x58cb
+    2699:	6a 01                	push   $0x1
+    269b:	e8 d5 20 00 00       	call   4775 <printf>
+    26a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26a3:	e8 21 1f 00 00       	call   45c9 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    26a8:	83 ec 08             	sub    $0x8,%esp
+    26ab:	68 00 02 00 00       	push   $0x200
+    26b0:	68 95 56 00 00       	push   $0x5695
+    26b5:	e8 4f 1f 00 00       	call   4609 <open>
+    26ba:	83 c4 10             	add    $0x10,%esp
+    26bd:	85 c0                	test   %eax,%eax
+    26bf:	78 17                	js     26d8 <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    26c1:	83 ec 08             	sub    $0x8,%esp
+    26c4:	68 e7 58 00 00       	push   $0x58e7
+    26c9:	6a 01                	push   $0x1
+    26cb:	e8 a5 20 00 00       	call   4775 <printf>
+    26d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26d3:	e8 f1 1e 00 00       	call   45c9 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    26d8:	83 ec 08             	sub    $0x8,%esp
+    26db:	6a 02                	push   $0x2
+    26dd:	68 95 56 00 00       	push   $0x5695
+    26e2:	e8 22 1f 00 00       	call   4609 <open>
+    26e7:	83 c4 10             	add    $0x10,%esp
+    26ea:	85 c0                	test   %eax,%eax
+    26ec:	78 17                	js     2705 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    26ee:	83 ec 08             	sub    $0x8,%esp
+    26f1:	68 fd 58 00 00       	push   $0x58fd
+    26f6:	6a 01                	push   $0x1
+    26f8:	e8 78 20 00 00       	call   4775 <printf>
+    26fd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2700:	e8 c4 1e 00 00       	call   45c9 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    2705:	83 ec 08             	sub    $0x8,%esp
+    2708:	6a 01                	push   $0x1
+    270a:	68 95 56 00 00       	push   $0x5695
+    270f:	e8 f5 1e 00 00       	call   4609 <open>
+    2714:	83 c4 10             	add    $0x10,%esp
+    2717:	85 c0                	test   %eax,%eax
+    2719:	78 17                	js     2732 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    271b:	83 ec 08             	sub    $0x8,%esp
+    271e:	68 16 59 00 00       	push   $0x5916
+    2723:	6a 01                	push   $0x1
+    2725:	e8 4b 20 00 00       	call   4775 <printf>
+    272a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    272d:	e8 97 1e 00 00       	call   45c9 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2732:	83 ec 08             	sub    $0x8,%esp
+    2735:	68 31 59 00 00       	push   $0x5931
+    273a:	68 9d 58 00 00       	push   $0x589d
+    273f:	e8 e5 1e 00 00       	call   4629 <link>
+    2744:	83 c4 10             	add    $0x10,%esp
+    2747:	85 c0                	test   %eax,%eax
+    2749:	75 17                	jne    2762 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    274b:	83 ec 08             	sub    $0x8,%esp
+    274e:	68 3c 59 00 00       	push   $0x593c
+    2753:	6a 01                	push   $0x1
+    2755:	e8 1b 20 00 00       	call   4775 <printf>
+    275a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    275d:	e8 67 1e 00 00       	call   45c9 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2762:	83 ec 08             	sub    $0x8,%esp
+    2765:	68 31 59 00 00       	push   $0x5931
+    276a:	68 c2 58 00 00       	push   $0x58c2
+    276f:	e8 b5 1e 00 00       	call   4629 <link>
+    2774:	83 c4 10             	add    $0x10,%esp
+    2777:	85 c0                	test   %eax,%eax
+    2779:	75 17                	jne    2792 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    277b:	83 ec 08             	sub    $0x8,%esp
+    277e:	68 60 59 00 00       	push   $0x5960
+    2783:	6a 01                	push   $0x1
+    2785:	e8 eb 1f 00 00       	call   4775 <printf>
+    278a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    278d:	e8 37 1e 00 00       	call   45c9 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2792:	83 ec 08             	sub    $0x8,%esp
+    2795:	68 78 57 00 00       	push   $0x5778
+    279a:	68 b0 56 00 00       	push   $0x56b0
+    279f:	e8 85 1e 00 00       	call   4629 <link>
+    27a4:	83 c4 10             	add    $0x10,%esp
+    27a7:	85 c0                	test   %eax,%eax
+    27a9:	75 17                	jne    27c2 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    27ab:	83 ec 08             	sub    $0x8,%esp
+    27ae:	68 84 59 00 00       	push   $0x5984
+    27b3:	6a 01                	push   $0x1
+    27b5:	e8 bb 1f 00 00       	call   4775 <printf>
+    27ba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27bd:	e8 07 1e 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    27c2:	83 ec 0c             	sub    $0xc,%esp
+    27c5:	68 9d 58 00 00       	push   $0x589d
+    27ca:	e8 62 1e 00 00       	call   4631 <mkdir>
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	85 c0                	test   %eax,%eax
+    27d4:	75 17                	jne    27ed <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    27d6:	83 ec 08             	sub    $0x8,%esp
+    27d9:	68 a6 59 00 00       	push   $0x59a6
+    27de:	6a 01                	push   $0x1
+    27e0:	e8 90 1f 00 00       	call   4775 <printf>
+    27e5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27e8:	e8 dc 1d 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    27ed:	83 ec 0c             	sub    $0xc,%esp
+    27f0:	68 c2 58 00 00       	push   $0x58c2
+    27f5:	e8 37 1e 00 00       	call   4631 <mkdir>
+    27fa:	83 c4 10             	add    $0x10,%esp
+    27fd:	85 c0                	test   %eax,%eax
+    27ff:	75 17                	jne    2818 <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2801:	83 ec 08             	sub    $0x8,%esp
+    2804:	68 c1 59 00 00       	push   $0x59c1
+    2809:	6a 01                	push   $0x1
+    280b:	e8 65 1f 00 00       	call   4775 <printf>
+    2810:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2813:	e8 b1 1d 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    2818:	83 ec 0c             	sub    $0xc,%esp
+    281b:	68 78 57 00 00       	push   $0x5778
+    2820:	e8 0c 1e 00 00       	call   4631 <mkdir>
+    2825:	83 c4 10             	add    $0x10,%esp
+    2828:	85 c0                	test   %eax,%eax
+    282a:	75 17                	jne    2843 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    282c:	83 ec 08             	sub    $0x8,%esp
+    282f:	68 dc 59 00 00       	push   $0x59dc
+    2834:	6a 01                	push   $0x1
+    2836:	e8 3a 1f 00 00       	call   4775 <printf>
+    283b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    283e:	e8 86 1d 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    2843:	83 ec 0c             	sub    $0xc,%esp
+    2846:	68 c2 58 00 00       	push   $0x58c2
+    284b:	e8 c9 1d 00 00       	call   4619 <unlink>
+    2850:	83 c4 10             	add    $0x10,%esp
+    2853:	85 c0                	test   %eax,%eax
+    2855:	75 17                	jne    286e <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2857:	83 ec 08             	sub    $0x8,%esp
+    285a:	68 f9 59 00 00       	push   $0x59f9
+    285f:	6a 01                	push   $0x1
+    2861:	e8 0f 1f 00 00       	call   4775 <printf>
+    2866:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2869:	e8 5b 1d 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    286e:	83 ec 0c             	sub    $0xc,%esp
+    2871:	68 9d 58 00 00       	push   $0x589d
+    2876:	e8 9e 1d 00 00       	call   4619 <unlink>
+    287b:	83 c4 10             	add    $0x10,%esp
+    287e:	85 c0                	test   %eax,%eax
+    2880:	75 17                	jne    2899 <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2882:	83 ec 08             	sub    $0x8,%esp
+    2885:	68 15 5a 00 00       	push   $0x5a15
+    288a:	6a 01                	push   $0x1
+    288c:	e8 e4 1e 00 00       	call   4775 <printf>
+    2891:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2894:	e8 30 1d 00 00       	call   45c9 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    2899:	83 ec 0c             	sub    $0xc,%esp
+    289c:	68 b0 56 00 00       	push   $0x56b0
+    28a1:	e8 93 1d 00 00       	call   4639 <chdir>
+    28a6:	83 c4 10             	add    $0x10,%esp
+    28a9:	85 c0                	test   %eax,%eax
+    28ab:	75 17                	jne    28c4 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    28ad:	83 ec 08             	sub    $0x8,%esp
+    28b0:	68 31 5a 00 00       	push   $0x5a31
+    28b5:	6a 01                	push   $0x1
+    28b7:	e8 b9 1e 00 00       	call   4775 <printf>
+    28bc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28bf:	e8 05 1d 00 00       	call   45c9 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    28c4:	83 ec 0c             	sub    $0xc,%esp
+    28c7:	68 49 5a 00 00       	push   $0x5a49
+    28cc:	e8 68 1d 00 00       	call   4639 <chdir>
+    28d1:	83 c4 10             	add    $0x10,%esp
+    28d4:	85 c0                	test   %eax,%eax
+    28d6:	75 17                	jne    28ef <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    28d8:	83 ec 08             	sub    $0x8,%esp
+    28db:	68 4f 5a 00 00       	push   $0x5a4f
+    28e0:	6a 01                	push   $0x1
+    28e2:	e8 8e 1e 00 00       	call   4775 <printf>
+    28e7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28ea:	e8 da 1c 00 00       	call   45c9 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    28ef:	83 ec 0c             	sub    $0xc,%esp
+    28f2:	68 78 57 00 00       	push   $0x5778
+    28f7:	e8 1d 1d 00 00       	call   4619 <unlink>
+    28fc:	83 c4 10             	add    $0x10,%esp
+    28ff:	85 c0                	test   %eax,%eax
+    2901:	74 17                	je     291a <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2903:	83 ec 08             	sub    $0x8,%esp
+    2906:	68 a5 57 00 00       	push   $0x57a5
+    290b:	6a 01                	push   $0x1
+    290d:	e8 63 1e 00 00       	call   4775 <printf>
+    2912:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2915:	e8 af 1c 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    291a:	83 ec 0c             	sub    $0xc,%esp
+    291d:	68 b0 56 00 00       	push   $0x56b0
+    2922:	e8 f2 1c 00 00       	call   4619 <unlink>
+    2927:	83 c4 10             	add    $0x10,%esp
+    292a:	85 c0                	test   %eax,%eax
+    292c:	74 17                	je     2945 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    292e:	83 ec 08             	sub    $0x8,%esp
+    2931:	68 67 5a 00 00       	push   $0x5a67
+    2936:	6a 01                	push   $0x1
+    2938:	e8 38 1e 00 00       	call   4775 <printf>
+    293d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2940:	e8 84 1c 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd") == 0){
+    2945:	83 ec 0c             	sub    $0xc,%esp
+    2948:	68 95 56 00 00       	push   $0x5695
+    294d:	e8 c7 1c 00 00       	call   4619 <unlink>
+    2952:	83 c4 10             	add    $0x10,%esp
+    2955:	85 c0                	test   %eax,%eax
+    2957:	75 17                	jne    2970 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2959:	83 ec 08             	sub    $0x8,%esp
+    295c:	68 7c 5a 00 00       	push   $0x5a7c
+    2961:	6a 01                	push   $0x1
+    2963:	e8 0d 1e 00 00       	call   4775 <printf>
+    2968:	83 c4 10             	add    $0x10,%esp
+    exit();
+    296b:	e8 59 1c 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    2970:	83 ec 0c             	sub    $0xc,%esp
+    2973:	68 9c 5a 00 00       	push   $0x5a9c
+    2978:	e8 9c 1c 00 00       	call   4619 <unlink>
+    297d:	83 c4 10             	add    $0x10,%esp
+    2980:	85 c0                	test   %eax,%eax
+    2982:	79 17                	jns    299b <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    2984:	83 ec 08             	sub    $0x8,%esp
+    2987:	68 a2 5a 00 00       	push   $0x5aa2
+    298c:	6a 01                	push   $0x1
+    298e:	e8 e2 1d 00 00       	call   4775 <printf>
+    2993:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2996:	e8 2e 1c 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dd") < 0){
+    299b:	83 ec 0c             	sub    $0xc,%esp
+    299e:	68 95 56 00 00       	push   $0x5695
+    29a3:	e8 71 1c 00 00       	call   4619 <unlink>
+    29a8:	83 c4 10             	add    $0x10,%esp
+    29ab:	85 c0                	test   %eax,%eax
+    29ad:	79 17                	jns    29c6 <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    29af:	83 ec 08             	sub    $0x8,%esp
+    29b2:	68 b7 5a 00 00       	push   $0x5ab7
+    29b7:	6a 01                	push   $0x1
+    29b9:	e8 b7 1d 00 00       	call   4775 <printf>
+    29be:	83 c4 10             	add    $0x10,%esp
+    exit();
+    29c1:	e8 03 1c 00 00       	call   45c9 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    29c6:	83 ec 08             	sub    $0x8,%esp
+    29c9:	68 c9 5a 00 00       	push   $0x5ac9
+    29ce:	6a 01                	push   $0x1
+    29d0:	e8 a0 1d 00 00       	call   4775 <printf>
+    29d5:	83 c4 10             	add    $0x10,%esp
+}
+    29d8:	90                   	nop
+    29d9:	c9                   	leave
+    29da:	c3                   	ret
+
+000029db <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    29db:	55                   	push   %ebp
+    29dc:	89 e5                	mov    %esp,%ebp
+    29de:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    29e1:	83 ec 08             	sub    $0x8,%esp
+    29e4:	68 d4 5a 00 00       	push   $0x5ad4
+    29e9:	6a 01                	push   $0x1
+    29eb:	e8 85 1d 00 00       	call   4775 <printf>
+    29f0:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    29f3:	83 ec 0c             	sub    $0xc,%esp
+    29f6:	68 e3 5a 00 00       	push   $0x5ae3
+    29fb:	e8 19 1c 00 00       	call   4619 <unlink>
+    2a00:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2a03:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    2a0a:	e9 a8 00 00 00       	jmp    2ab7 <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2a0f:	83 ec 08             	sub    $0x8,%esp
+    2a12:	68 02 02 00 00       	push   $0x202
+    2a17:	68 e3 5a 00 00       	push   $0x5ae3
+    2a1c:	e8 e8 1b 00 00       	call   4609 <open>
+    2a21:	83 c4 10             	add    $0x10,%esp
+    2a24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    2a27:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2a2b:	79 17                	jns    2a44 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    2a2d:	83 ec 08             	sub    $0x8,%esp
+    2a30:	68 ec 5a 00 00       	push   $0x5aec
+    2a35:	6a 01                	push   $0x1
+    2a37:	e8 39 1d 00 00       	call   4775 <printf>
+    2a3c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2a3f:	e8 85 1b 00 00       	call   45c9 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    2a44:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2a4b:	eb 3f                	jmp    2a8c <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    2a4d:	83 ec 04             	sub    $0x4,%esp
+    2a50:	ff 75 f4             	push   -0xc(%ebp)
+    2a53:	68 a0 6d 00 00       	push   $0x6da0
+    2a58:	ff 75 ec             	push   -0x14(%ebp)
+    2a5b:	e8 89 1b 00 00       	call   45e9 <write>
+    2a60:	83 c4 10             	add    $0x10,%esp
+    2a63:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    2a66:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2a69:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    2a6c:	74 1a                	je     2a88 <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2a6e:	ff 75 e8             	push   -0x18(%ebp)
+    2a71:	ff 75 f4             	push   -0xc(%ebp)
+    2a74:	68 04 5b 00 00       	push   $0x5b04
+    2a79:	6a 01                	push   $0x1
+    2a7b:	e8 f5 1c 00 00       	call   4775 <printf>
+    2a80:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2a83:	e8 41 1b 00 00       	call   45c9 <exit>
+    for(i = 0; i < 2; i++){
+    2a88:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2a8c:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    2a90:	7e bb                	jle    2a4d <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    2a92:	83 ec 0c             	sub    $0xc,%esp
+    2a95:	ff 75 ec             	push   -0x14(%ebp)
+    2a98:	e8 54 1b 00 00       	call   45f1 <close>
+    2a9d:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    2aa0:	83 ec 0c             	sub    $0xc,%esp
+    2aa3:	68 e3 5a 00 00       	push   $0x5ae3
+    2aa8:	e8 6c 1b 00 00       	call   4619 <unlink>
+    2aad:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2ab0:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    2ab7:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    2abe:	0f 8e 4b ff ff ff    	jle    2a0f <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2ac4:	83 ec 08             	sub    $0x8,%esp
+    2ac7:	68 16 5b 00 00       	push   $0x5b16
+    2acc:	6a 01                	push   $0x1
+    2ace:	e8 a2 1c 00 00       	call   4775 <printf>
+    2ad3:	83 c4 10             	add    $0x10,%esp
+}
+    2ad6:	90                   	nop
+    2ad7:	c9                   	leave
+    2ad8:	c3                   	ret
+
+00002ad9 <bigfile>:
+// block boundaries.
+#define NBIG (2*1024*1024 / 600)
+
+void
+bigfile(void)
+{
+    2ad9:	55                   	push   %ebp
+    2ada:	89 e5                	mov    %esp,%ebp
+    2adc:	53                   	push   %ebx
+    2add:	83 ec 24             	sub    $0x24,%esp
+  int fd, i, total, cc, t0, t1, t2;
+
+  printf(1, "bigfile test\n");
+    2ae0:	83 ec 08             	sub    $0x8,%esp
+    2ae3:	68 23 5b 00 00       	push   $0x5b23
+    2ae8:	6a 01                	push   $0x1
+    2aea:	e8 86 1c 00 00       	call   4775 <printf>
+    2aef:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    2af2:	83 ec 0c             	sub    $0xc,%esp
+    2af5:	68 31 5b 00 00       	push   $0x5b31
+    2afa:	e8 1a 1b 00 00       	call   4619 <unlink>
+    2aff:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2b02:	83 ec 08             	sub    $0x8,%esp
+    2b05:	68 02 02 00 00       	push   $0x202
+    2b0a:	68 31 5b 00 00       	push   $0x5b31
+    2b0f:	e8 f5 1a 00 00       	call   4609 <open>
+    2b14:	83 c4 10             	add    $0x10,%esp
+    2b17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2b1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2b1e:	79 17                	jns    2b37 <bigfile+0x5e>
+    printf(1, "cannot create bigfile");
+    2b20:	83 ec 08             	sub    $0x8,%esp
+    2b23:	68 39 5b 00 00       	push   $0x5b39
+    2b28:	6a 01                	push   $0x1
+    2b2a:	e8 46 1c 00 00       	call   4775 <printf>
+    2b2f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b32:	e8 92 1a 00 00       	call   45c9 <exit>
+  }
+  t0 = uptime();
+    2b37:	e8 25 1b 00 00       	call   4661 <uptime>
+    2b3c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; i < NBIG; i++){
+    2b3f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2b46:	eb 52                	jmp    2b9a <bigfile+0xc1>
+    memset(buf, i, 600);
+    2b48:	83 ec 04             	sub    $0x4,%esp
+    2b4b:	68 58 02 00 00       	push   $0x258
+    2b50:	ff 75 f4             	push   -0xc(%ebp)
+    2b53:	68 a0 6d 00 00       	push   $0x6da0
+    2b58:	e8 d1 18 00 00       	call   442e <memset>
+    2b5d:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    2b60:	83 ec 04             	sub    $0x4,%esp
+    2b63:	68 58 02 00 00       	push   $0x258
+    2b68:	68 a0 6d 00 00       	push   $0x6da0
+    2b6d:	ff 75 ec             	push   -0x14(%ebp)
+    2b70:	e8 74 1a 00 00       	call   45e9 <write>
+    2b75:	83 c4 10             	add    $0x10,%esp
+    2b78:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2b7d:	74 17                	je     2b96 <bigfile+0xbd>
+      printf(1, "write bigfile failed\n");
+    2b7f:	83 ec 08             	sub    $0x8,%esp
+    2b82:	68 4f 5b 00 00       	push   $0x5b4f
+    2b87:	6a 01                	push   $0x1
+    2b89:	e8 e7 1b 00 00       	call   4775 <printf>
+    2b8e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2b91:	e8 33 1a 00 00       	call   45c9 <exit>
+  for(i = 0; i < NBIG; i++){
+    2b96:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2b9a:	81 7d f4 a6 0d 00 00 	cmpl   $0xda6,-0xc(%ebp)
+    2ba1:	7e a5                	jle    2b48 <bigfile+0x6f>
+    }
+  }
+  close(fd);
+    2ba3:	83 ec 0c             	sub    $0xc,%esp
+    2ba6:	ff 75 ec             	push   -0x14(%ebp)
+    2ba9:	e8 43 1a 00 00       	call   45f1 <close>
+    2bae:	83 c4 10             	add    $0x10,%esp
+  t1 = uptime();
+    2bb1:	e8 ab 1a 00 00       	call   4661 <uptime>
+    2bb6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  fd = open("bigfile", 0);
+    2bb9:	83 ec 08             	sub    $0x8,%esp
+    2bbc:	6a 00                	push   $0x0
+    2bbe:	68 31 5b 00 00       	push   $0x5b31
+    2bc3:	e8 41 1a 00 00       	call   4609 <open>
+    2bc8:	83 c4 10             	add    $0x10,%esp
+    2bcb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2bce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2bd2:	79 17                	jns    2beb <bigfile+0x112>
+    printf(1, "cannot open bigfile\n");
+    2bd4:	83 ec 08             	sub    $0x8,%esp
+    2bd7:	68 65 5b 00 00       	push   $0x5b65
+    2bdc:	6a 01                	push   $0x1
+    2bde:	e8 92 1b 00 00       	call   4775 <printf>
+    2be3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2be6:	e8 de 19 00 00       	call   45c9 <exit>
+  }
+  total = 0;
+    2beb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    2bf2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    2bf9:	83 ec 04             	sub    $0x4,%esp
+    2bfc:	68 2c 01 00 00       	push   $0x12c
+    2c01:	68 a0 6d 00 00       	push   $0x6da0
+    2c06:	ff 75 ec             	push   -0x14(%ebp)
+    2c09:	e8 d3 19 00 00       	call   45e1 <read>
+    2c0e:	83 c4 10             	add    $0x10,%esp
+    2c11:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(cc < 0){
+    2c14:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    2c18:	79 17                	jns    2c31 <bigfile+0x158>
+      printf(1, "read bigfile failed\n");
+    2c1a:	83 ec 08             	sub    $0x8,%esp
+    2c1d:	68 7a 5b 00 00       	push   $0x5b7a
+    2c22:	6a 01                	push   $0x1
+    2c24:	e8 4c 1b 00 00       	call   4775 <printf>
+    2c29:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2c2c:	e8 98 19 00 00       	call   45c9 <exit>
+    }
+    if(cc == 0)
+    2c31:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    2c35:	74 74                	je     2cab <bigfile+0x1d2>
+      break;
+    if(cc != 300){
+    2c37:	81 7d e0 2c 01 00 00 	cmpl   $0x12c,-0x20(%ebp)
+    2c3e:	74 17                	je     2c57 <bigfile+0x17e>
+      printf(1, "short read bigfile\n");
+    2c40:	83 ec 08             	sub    $0x8,%esp
+    2c43:	68 8f 5b 00 00       	push   $0x5b8f
+    2c48:	6a 01                	push   $0x1
+    2c4a:	e8 26 1b 00 00       	call   4775 <printf>
+    2c4f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2c52:	e8 72 19 00 00       	call   45c9 <exit>
+    }
+    if(buf[0] != (char)(i/2) || buf[299] != (char)(i/2)){
+    2c57:	0f b6 15 a0 6d 00 00 	movzbl 0x6da0,%edx
+    2c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2c61:	89 c1                	mov    %eax,%ecx
+    2c63:	c1 e9 1f             	shr    $0x1f,%ecx
+    2c66:	01 c8                	add    %ecx,%eax
+    2c68:	d1 f8                	sar    %eax
+    2c6a:	38 c2                	cmp    %al,%dl
+    2c6c:	75 17                	jne    2c85 <bigfile+0x1ac>
+    2c6e:	0f b6 15 cb 6e 00 00 	movzbl 0x6ecb,%edx
+    2c75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2c78:	89 c1                	mov    %eax,%ecx
+    2c7a:	c1 e9 1f             	shr    $0x1f,%ecx
+    2c7d:	01 c8                	add    %ecx,%eax
+    2c7f:	d1 f8                	sar    %eax
+    2c81:	38 c2                	cmp    %al,%dl
+    2c83:	74 17                	je     2c9c <bigfile+0x1c3>
+      printf(1, "read bigfile wrong data\n");
+    2c85:	83 ec 08             	sub    $0x8,%esp
+    2c88:	68 a3 5b 00 00       	push   $0x5ba3
+    2c8d:	6a 01                	push   $0x1
+    2c8f:	e8 e1 1a 00 00       	call   4775 <printf>
+    2c94:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2c97:	e8 2d 19 00 00       	call   45c9 <exit>
+    }
+    total += cc;
+    2c9c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    2c9f:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    2ca2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    2ca6:	e9 4e ff ff ff       	jmp    2bf9 <bigfile+0x120>
+      break;
+    2cab:	90                   	nop
+  }
+  close(fd);
+    2cac:	83 ec 0c             	sub    $0xc,%esp
+    2caf:	ff 75 ec             	push   -0x14(%ebp)
+    2cb2:	e8 3a 19 00 00       	call   45f1 <close>
+    2cb7:	83 c4 10             	add    $0x10,%esp
+  t2 = uptime();
+    2cba:	e8 a2 19 00 00       	call   4661 <uptime>
+    2cbf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(total != NBIG*600){
+    2cc2:	81 7d f0 68 ff 1f 00 	cmpl   $0x1fff68,-0x10(%ebp)
+    2cc9:	74 17                	je     2ce2 <bigfile+0x209>
+    printf(1, "read bigfile wrong total\n");
+    2ccb:	83 ec 08             	sub    $0x8,%esp
+    2cce:	68 bc 5b 00 00       	push   $0x5bbc
+    2cd3:	6a 01                	push   $0x1
+    2cd5:	e8 9b 1a 00 00       	call   4775 <printf>
+    2cda:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cdd:	e8 e7 18 00 00       	call   45c9 <exit>
+  }
+  unlink("bigfile");
+    2ce2:	83 ec 0c             	sub    $0xc,%esp
+    2ce5:	68 31 5b 00 00       	push   $0x5b31
+    2cea:	e8 2a 19 00 00       	call   4619 <unlink>
+    2cef:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile %d KB: write %d ticks, read %d ticks\n",
+    2cf2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    2cf5:	2b 45 e4             	sub    -0x1c(%ebp),%eax
+    2cf8:	89 c1                	mov    %eax,%ecx
+    2cfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2cfd:	2b 45 e8             	sub    -0x18(%ebp),%eax
+    2d00:	89 c2                	mov    %eax,%edx
+    2d02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2d05:	8d 98 ff 03 00 00    	lea    0x3ff(%eax),%ebx
+    2d0b:	85 c0                	test   %eax,%eax
+    2d0d:	0f 48 c3             	cmovs  %ebx,%eax
+    2d10:	c1 f8 0a             	sar    $0xa,%eax
+    2d13:	83 ec 0c             	sub    $0xc,%esp
+    2d16:	51                   	push   %ecx
+    2d17:	52                   	push   %edx
+    2d18:	50                   	push   %eax
+    2d19:	68 d8 5b 00 00       	push   $0x5bd8
+    2d1e:	6a 01                	push   $0x1
+    2d20:	e8 50 1a 00 00       	call   4775 <printf>
+    2d25:	83 c4 20             	add    $0x20,%esp
+         total / 1024, t1 - t0, t2 - t1);
+  printf(1, "bigfile test ok\n");
+    2d28:	83 ec 08             	sub    $0x8,%esp
+    2d2b:	68 06 5c 00 00       	push   $0x5c06
+    2d30:	6a 01                	push   $0x1
+    2d32:	e8 3e 1a 00 00       	call   4775 <printf>
+    2d37:	83 c4 10             	add    $0x10,%esp
+}
+    2d3a:	90                   	nop
+    2d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d3e:	c9                   	leave
+    2d3f:	c3                   	ret
+
+00002d40 <fragtest>:
+// wrongly.
+#define NFRAG (NEXTENT + NXPB + 2*NXPB)
+
+void
+fragtest(void)
+{
+    2d40:	55                   	push   %ebp
+    2d41:	89 e5                	mov    %esp,%ebp
+    2d43:	83 ec 28             	sub    $0x28,%esp
+  int fd[2], round, i, j;
+  char name[3];
+
+  printf(1, "fragmented file test\n");
+    2d46:	83 ec 08             	sub    $0x8,%esp
+    2d49:	68 17 5c 00 00       	push   $0x5c17
+    2d4e:	6a 01                	push   $0x1
+    2d50:	e8 20 1a 00 00       	call   4775 <printf>
+    2d55:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'x';
+    2d58:	c6 45 e1 78          	movb   $0x78,-0x1f(%ebp)
+  name[2] = '\0';
+    2d5c:	c6 45 e3 00          	movb   $0x0,-0x1d(%ebp)
+  for(round = 0; round < 2; round++){
+    2d60:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2d67:	e9 29 02 00 00       	jmp    2f95 <fragtest+0x255>
+    for(j = 0; j < 2; j++){
+    2d6c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    2d73:	eb 5d                	jmp    2dd2 <fragtest+0x92>
+      name[1] = '0' + j;
+    2d75:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2d78:	83 c0 30             	add    $0x30,%eax
+    2d7b:	88 45 e2             	mov    %al,-0x1e(%ebp)
+      unlink(name);
+    2d7e:	83 ec 0c             	sub    $0xc,%esp
+    2d81:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2d84:	50                   	push   %eax
+    2d85:	e8 8f 18 00 00       	call   4619 <unlink>
+    2d8a:	83 c4 10             	add    $0x10,%esp
+      if((fd[j] = open(name, O_CREATE | O_RDWR)) < 0){
+    2d8d:	83 ec 08             	sub    $0x8,%esp
+    2d90:	68 02 02 00 00       	push   $0x202
+    2d95:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2d98:	50                   	push   %eax
+    2d99:	e8 6b 18 00 00       	call   4609 <open>
+    2d9e:	83 c4 10             	add    $0x10,%esp
+    2da1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    2da4:	89 44 95 e4          	mov    %eax,-0x1c(%ebp,%edx,4)
+    2da8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2dab:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2daf:	85 c0                	test   %eax,%eax
+    2db1:	79 1b                	jns    2dce <fragtest+0x8e>
+        printf(1, "cannot create %s\n", name);
+    2db3:	83 ec 04             	sub    $0x4,%esp
+    2db6:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2db9:	50                   	push   %eax
+    2dba:	68 2d 5c 00 00       	push   $0x5c2d
+    2dbf:	6a 01                	push   $0x1
+    2dc1:	e8 af 19 00 00       	call   4775 <printf>
+    2dc6:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2dc9:	e8 fb 17 00 00       	call   45c9 <exit>
+    for(j = 0; j < 2; j++){
+    2dce:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    2dd2:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    2dd6:	7e 9d                	jle    2d75 <fragtest+0x35>
+      }
+    }
+    for(i = 0; i < NFRAG; i++){
+    2dd8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2ddf:	eb 69                	jmp    2e4a <fragtest+0x10a>
+      for(j = 0; j < 2; j++){
+    2de1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    2de8:	eb 56                	jmp    2e40 <fragtest+0x100>
+        ((int*)buf)[0] = i;
+    2dea:	ba a0 6d 00 00       	mov    $0x6da0,%edx
+    2def:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2df2:	89 02                	mov    %eax,(%edx)
+        ((int*)buf)[1] = j;
+    2df4:	ba a4 6d 00 00       	mov    $0x6da4,%edx
+    2df9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2dfc:	89 02                	mov    %eax,(%edx)
+        if(write(fd[j], buf, 512) != 512){
+    2dfe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2e01:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2e05:	83 ec 04             	sub    $0x4,%esp
+    2e08:	68 00 02 00 00       	push   $0x200
+    2e0d:	68 a0 6d 00 00       	push   $0x6da0
+    2e12:	50                   	push   %eax
+    2e13:	e8 d1 17 00 00       	call   45e9 <write>
+    2e18:	83 c4 10             	add    $0x10,%esp
+    2e1b:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2e20:	74 1a                	je     2e3c <fragtest+0xfc>
+          printf(1, "write fragmented file failed at block %d\n", i);
+    2e22:	83 ec 04             	sub    $0x4,%esp
+    2e25:	ff 75 f0             	push   -0x10(%ebp)
+    2e28:	68 40 5c 00 00       	push   $0x5c40
+    2e2d:	6a 01                	push   $0x1
+    2e2f:	e8 41 19 00 00       	call   4775 <printf>
+    2e34:	83 c4 10             	add    $0x10,%esp
+          exit();
+    2e37:	e8 8d 17 00 00       	call   45c9 <exit>
+      for(j = 0; j < 2; j++){
+    2e3c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    2e40:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    2e44:	7e a4                	jle    2dea <fragtest+0xaa>
+    for(i = 0; i < NFRAG; i++){
+    2e46:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2e4a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2e4d:	3d c4 00 00 00       	cmp    $0xc4,%eax
+    2e52:	76 8d                	jbe    2de1 <fragtest+0xa1>
+        }
+      }
+    }
+    for(j = 0; j < 2; j++){
+    2e54:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    2e5b:	e9 27 01 00 00       	jmp    2f87 <fragtest+0x247>
+      close(fd[j]);
+    2e60:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2e63:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2e67:	83 ec 0c             	sub    $0xc,%esp
+    2e6a:	50                   	push   %eax
+    2e6b:	e8 81 17 00 00       	call   45f1 <close>
+    2e70:	83 c4 10             	add    $0x10,%esp
+      name[1] = '0' + j;
+    2e73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2e76:	83 c0 30             	add    $0x30,%eax
+    2e79:	88 45 e2             	mov    %al,-0x1e(%ebp)
+      if((fd[j] = open(name, O_RDONLY)) < 0){
+    2e7c:	83 ec 08             	sub    $0x8,%esp
+    2e7f:	6a 00                	push   $0x0
+    2e81:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2e84:	50                   	push   %eax
+    2e85:	e8 7f 17 00 00       	call   4609 <open>
+    2e8a:	83 c4 10             	add    $0x10,%esp
+    2e8d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    2e90:	89 44 95 e4          	mov    %eax,-0x1c(%ebp,%edx,4)
+    2e94:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2e97:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2e9b:	85 c0                	test   %eax,%eax
+    2e9d:	79 1b                	jns    2eba <fragtest+0x17a>
+        printf(1, "cannot open %s\n", name);
+    2e9f:	83 ec 04             	sub    $0x4,%esp
+    2ea2:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2ea5:	50                   	push   %eax
+    2ea6:	68 6a 5c 00 00       	push   $0x5c6a
+    2eab:	6a 01                	push   $0x1
+    2ead:	e8 c3 18 00 00       	call   4775 <printf>
+    2eb2:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2eb5:	e8 0f 17 00 00       	call   45c9 <exit>
+      }
+      for(i = 0; read(fd[j], buf, 512) == 512; i++){
+    2eba:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    2ec1:	eb 37                	jmp    2efa <fragtest+0x1ba>
+        if(((int*)buf)[0] != i || ((int*)buf)[1] != j){
+    2ec3:	b8 a0 6d 00 00       	mov    $0x6da0,%eax
+    2ec8:	8b 00                	mov    (%eax),%eax
+    2eca:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    2ecd:	75 0c                	jne    2edb <fragtest+0x19b>
+    2ecf:	b8 a4 6d 00 00       	mov    $0x6da4,%eax
+    2ed4:	8b 00                	mov    (%eax),%eax
+    2ed6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    2ed9:	74 1b                	je     2ef6 <fragtest+0x1b6>
+          printf(1, "%s block %d has wrong data\n", name, i);
+    2edb:	ff 75 f0             	push   -0x10(%ebp)
+    2ede:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2ee1:	50                   	push   %eax
+    2ee2:	68 7a 5c 00 00       	push   $0x5c7a
+    2ee7:	6a 01                	push   $0x1
+    2ee9:	e8 87 18 00 00       	call   4775 <printf>
+    2eee:	83 c4 10             	add    $0x10,%esp
+          exit();
+    2ef1:	e8 d3 16 00 00       	call   45c9 <exit>
+      for(i = 0; read(fd[j], buf, 512) == 512; i++){
+    2ef6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2efa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2efd:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2f01:	83 ec 04             	sub    $0x4,%esp
+    2f04:	68 00 02 00 00       	push   $0x200
+    2f09:	68 a0 6d 00 00       	push   $0x6da0
+    2f0e:	50                   	push   %eax
+    2f0f:	e8 cd 16 00 00       	call   45e1 <read>
+    2f14:	83 c4 10             	add    $0x10,%esp
+    2f17:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2f1c:	74 a5                	je     2ec3 <fragtest+0x183>
+        }
+      }
+      if(i != NFRAG){
+    2f1e:	81 7d f0 c5 00 00 00 	cmpl   $0xc5,-0x10(%ebp)
+    2f25:	74 1b                	je     2f42 <fragtest+0x202>
+        printf(1, "read %d blocks of %s\n", i, name);
+    2f27:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2f2a:	50                   	push   %eax
+    2f2b:	ff 75 f0             	push   -0x10(%ebp)
+    2f2e:	68 96 5c 00 00       	push   $0x5c96
+    2f33:	6a 01                	push   $0x1
+    2f35:	e8 3b 18 00 00       	call   4775 <printf>
+    2f3a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2f3d:	e8 87 16 00 00       	call   45c9 <exit>
+      }
+      close(fd[j]);
+    2f42:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2f45:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+    2f49:	83 ec 0c             	sub    $0xc,%esp
+    2f4c:	50                   	push   %eax
+    2f4d:	e8 9f 16 00 00       	call   45f1 <close>
+    2f52:	83 c4 10             	add    $0x10,%esp
+      if(unlink(name) < 0){
+    2f55:	83 ec 0c             	sub    $0xc,%esp
+    2f58:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2f5b:	50                   	push   %eax
+    2f5c:	e8 b8 16 00 00       	call   4619 <unlink>
+    2f61:	83 c4 10             	add    $0x10,%esp
+    2f64:	85 c0                	test   %eax,%eax
+    2f66:	79 1b                	jns    2f83 <fragtest+0x243>
+        printf(1, "unlink %s failed\n", name);
+    2f68:	83 ec 04             	sub    $0x4,%esp
+    2f6b:	8d 45 e1             	lea    -0x1f(%ebp),%eax
+    2f6e:	50                   	push   %eax
+    2f6f:	68 ac 5c 00 00       	push   $0x5cac
+    2f74:	6a 01                	push   $0x1
+    2f76:	e8 fa 17 00 00       	call   4775 <printf>
+    2f7b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2f7e:	e8 46 16 00 00       	call   45c9 <exit>
+    for(j = 0; j < 2; j++){
+    2f83:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    2f87:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    2f8b:	0f 8e cf fe ff ff    	jle    2e60 <fragtest+0x120>
+  for(round = 0; round < 2; round++){
+    2f91:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2f95:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    2f99:	0f 8e cd fd ff ff    	jle    2d6c <fragtest+0x2c>
+      }
+    }
+  }
+  printf(1, "fragmented file test ok\n");
+    2f9f:	83 ec 08             	sub    $0x8,%esp
+    2fa2:	68 be 5c 00 00       	push   $0x5cbe
+    2fa7:	6a 01                	push   $0x1
+    2fa9:	e8 c7 17 00 00       	call   4775 <printf>
+    2fae:	83 c4 10             	add    $0x10,%esp
+}
+    2fb1:	90                   	nop
+    2fb2:	c9                   	leave
+    2fb3:	c3                   	ret
+
+00002fb4 <fourteen>:
+
+void
+fourteen(void)
+{
+    2fb4:	55                   	push   %ebp
+    2fb5:	89 e5                	mov    %esp,%ebp
+    2fb7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    2fba:	83 ec 08             	sub    $0x8,%esp
+    2fbd:	68 d7 5c 00 00       	push   $0x5cd7
+    2fc2:	6a 01                	push   $0x1
+    2fc4:	e8 ac 17 00 00       	call   4775 <printf>
+    2fc9:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    2fcc:	83 ec 0c             	sub    $0xc,%esp
+    2fcf:	68 e6 5c 00 00       	push   $0x5ce6
+    2fd4:	e8 58 16 00 00       	call   4631 <mkdir>
+    2fd9:	83 c4 10             	add    $0x10,%esp
+    2fdc:	85 c0                	test   %eax,%eax
+    2fde:	74 17                	je     2ff7 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    2fe0:	83 ec 08             	sub    $0x8,%esp
+    2fe3:	68 f5 5c 00 00       	push   $0x5cf5
+    2fe8:	6a 01                	push   $0x1
+    2fea:	e8 86 17 00 00       	call   4775 <printf>
+    2fef:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ff2:	e8 d2 15 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2ff7:	83 ec 0c             	sub    $0xc,%esp
+    2ffa:	68 14 5d 00 00       	push   $0x5d14
+    2fff:	e8 2d 16 00 00       	call   4631 <mkdir>
+    3004:	83 c4 10             	add    $0x10,%esp
+    3007:	85 c0                	test   %eax,%eax
+    3009:	74 17                	je     3022 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    300b:	83 ec 08             	sub    $0x8,%esp
+    300e:	68 34 5d 00 00       	push   $0x5d34
+    3013:	6a 01                	push   $0x1
+    3015:	e8 5b 17 00 00       	call   4775 <printf>
+    301a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    301d:	e8 a7 15 00 00       	call   45c9 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3022:	83 ec 08             	sub    $0x8,%esp
+    3025:	68 00 02 00 00       	push   $0x200
+    302a:	68 64 5d 00 00       	push   $0x5d64
+    302f:	e8 d5 15 00 00       	call   4609 <open>
+    3034:	83 c4 10             	add    $0x10,%esp
+    3037:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    303a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    303e:	79 17                	jns    3057 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    3040:	83 ec 08             	sub    $0x8,%esp
+    3043:	68 94 5d 00 00       	push   $0x5d94
+    3048:	6a 01                	push   $0x1
+    304a:	e8 26 17 00 00       	call   4775 <printf>
+    304f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3052:	e8 72 15 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    3057:	83 ec 0c             	sub    $0xc,%esp
+    305a:	ff 75 f4             	push   -0xc(%ebp)
+    305d:	e8 8f 15 00 00       	call   45f1 <close>
+    3062:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    3065:	83 ec 08             	sub    $0x8,%esp
+    3068:	6a 00                	push   $0x0
+    306a:	68 d4 5d 00 00       	push   $0x5dd4
+    306f:	e8 95 15 00 00       	call   4609 <open>
+    3074:	83 c4 10             	add    $0x10,%esp
+    3077:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    307a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    307e:	79 17                	jns    3097 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3080:	83 ec 08             	sub    $0x8,%esp
+    3083:	68 04 5e 00 00       	push   $0x5e04
+    3088:	6a 01                	push   $0x1
+    308a:	e8 e6 16 00 00       	call   4775 <printf>
+    308f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3092:	e8 32 15 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    3097:	83 ec 0c             	sub    $0xc,%esp
+    309a:	ff 75 f4             	push   -0xc(%ebp)
+    309d:	e8 4f 15 00 00       	call   45f1 <close>
+    30a2:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    30a5:	83 ec 0c             	sub    $0xc,%esp
+    30a8:	68 3e 5e 00 00       	push   $0x5e3e
+    30ad:	e8 7f 15 00 00       	call   4631 <mkdir>
+    30b2:	83 c4 10             	add    $0x10,%esp
+    30b5:	85 c0                	test   %eax,%eax
+    30b7:	75 17                	jne    30d0 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    30b9:	83 ec 08             	sub    $0x8,%esp
+    30bc:	68 5c 5e 00 00       	push   $0x5e5c
+    30c1:	6a 01                	push   $0x1
+    30c3:	e8 ad 16 00 00       	call   4775 <printf>
+    30c8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30cb:	e8 f9 14 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    30d0:	83 ec 0c             	sub    $0xc,%esp
+    30d3:	68 8c 5e 00 00       	push   $0x5e8c
+    30d8:	e8 54 15 00 00       	call   4631 <mkdir>
+    30dd:	83 c4 10             	add    $0x10,%esp
+    30e0:	85 c0                	test   %eax,%eax
+    30e2:	75 17                	jne    30fb <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    30e4:	83 ec 08             	sub    $0x8,%esp
+    30e7:	68 ac 5e 00 00       	push   $0x5eac
+    30ec:	6a 01                	push   $0x1
+    30ee:	e8 82 16 00 00       	call   4775 <printf>
+    30f3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30f6:	e8 ce 14 00 00       	call   45c9 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    30fb:	83 ec 08             	sub    $0x8,%esp
+    30fe:	68 dd 5e 00 00       	push   $0x5edd
+    3103:	6a 01                	push   $0x1
+    3105:	e8 6b 16 00 00       	call   4775 <printf>
+    310a:	83 c4 10             	add    $0x10,%esp
+}
+    310d:	90                   	nop
+    310e:	c9                   	leave
+    310f:	c3                   	ret
+
+00003110 <rmdot>:
+
+void
+rmdot(void)
+{
+    3110:	55                   	push   %ebp
+    3111:	89 e5                	mov    %esp,%ebp
+    3113:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    3116:	83 ec 08             	sub    $0x8,%esp
+    3119:	68 ea 5e 00 00       	push   $0x5eea
+    311e:	6a 01                	push   $0x1
+    3120:	e8 50 16 00 00       	call   4775 <printf>
+    3125:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    3128:	83 ec 0c             	sub    $0xc,%esp
+    312b:	68 f6 5e 00 00       	push   $0x5ef6
+    3130:	e8 fc 14 00 00       	call   4631 <mkdir>
+    3135:	83 c4 10             	add    $0x10,%esp
+    3138:	85 c0                	test   %eax,%eax
+    313a:	74 17                	je     3153 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    313c:	83 ec 08             	sub    $0x8,%esp
+    313f:	68 fb 5e 00 00       	push   $0x5efb
+    3144:	6a 01                	push   $0x1
+    3146:	e8 2a 16 00 00       	call   4775 <printf>
+    314b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    314e:	e8 76 14 00 00       	call   45c9 <exit>
+  }
+  if(chdir("dots") != 0){
+    3153:	83 ec 0c             	sub    $0xc,%esp
+    3156:	68 f6 5e 00 00       	push   $0x5ef6
+    315b:	e8 d9 14 00 00       	call   4639 <chdir>
+    3160:	83 c4 10             	add    $0x10,%esp
+    3163:	85 c0                	test   %eax,%eax
+    3165:	74 17                	je     317e <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    3167:	83 ec 08             	sub    $0x8,%esp
+    316a:	68 0e 5f 00 00       	push   $0x5f0e
+    316f:	6a 01                	push   $0x1
+    3171:	e8 ff 15 00 00       	call   4775 <printf>
+    3176:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3179:	e8 4b 14 00 00       	call   45c9 <exit>
+  }
+  if(unlink(".") == 0){
+    317e:	83 ec 0c             	sub    $0xc,%esp
+    3181:	68 3b 55 00 00       	push   $0x553b
+    3186:	e8 8e 14 00 00       	call   4619 <unlink>
+    318b:	83 c4 10             	add    $0x10,%esp
+    318e:	85 c0                	test   %eax,%eax
+    3190:	75 17                	jne    31a9 <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    3192:	83 ec 08             	sub    $0x8,%esp
+    3195:	68 21 5f 00 00       	push   $0x5f21
+    319a:	6a 01                	push   $0x1
+    319c:	e8 d4 15 00 00       	call   4775 <printf>
+    31a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31a4:	e8 20 14 00 00       	call   45c9 <exit>
+  }
+  if(unlink("..") == 0){
+    31a9:	83 ec 0c             	sub    $0xc,%esp
+    31ac:	68 ce 50 00 00       	push   $0x50ce
+    31b1:	e8 63 14 00 00       	call   4619 <unlink>
+    31b6:	83 c4 10             	add    $0x10,%esp
+    31b9:	85 c0                	test   %eax,%eax
+    31bb:	75 17                	jne    31d4 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    31bd:	83 ec 08             	sub    $0x8,%esp
+    31c0:	68 2f 5f 00 00       	push   $0x5f2f
+    31c5:	6a 01                	push   $0x1
+    31c7:	e8 a9 15 00 00       	call   4775 <printf>
+    31cc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31cf:	e8 f5 13 00 00       	call   45c9 <exit>
+  }
+  if(chdir("/") != 0){
+    31d4:	83 ec 0c             	sub    $0xc,%esp
+    31d7:	68 4a 4c 00 00       	push   $0x4c4a
+    31dc:	e8 58 14 00 00       	call   4639 <chdir>
+    31e1:	83 c4 10             	add    $0x10,%esp
+    31e4:	85 c0                	test   %eax,%eax
+    31e6:	74 17                	je     31ff <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    31e8:	83 ec 08             	sub    $0x8,%esp
+    31eb:	68 4c 4c 00 00       	push   $0x4c4c
+    31f0:	6a 01                	push   $0x1
+    31f2:	e8 7e 15 00 00       	call   4775 <printf>
+    31f7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31fa:	e8 ca 13 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    31ff:	83 ec 0c             	sub    $0xc,%esp
+    3202:	68 3e 5f 00 00       	push   $0x5f3e
+    3207:	e8 0d 14 00 00       	call   4619 <unlink>
+    320c:	83 c4 10             	add    $0x10,%esp
+    320f:	85 c0                	test   %eax,%eax
+    3211:	75 17                	jne    322a <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    3213:	83 ec 08             	sub    $0x8,%esp
+    3216:	68 45 5f 00 00       	push   $0x5f45
+    321b:	6a 01                	push   $0x1
+    321d:	e8 53 15 00 00       	call   4775 <printf>
+    3222:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3225:	e8 9f 13 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    322a:	83 ec 0c             	sub    $0xc,%esp
+    322d:	68 5c 5f 00 00       	push   $0x5f5c
+    3232:	e8 e2 13 00 00       	call   4619 <unlink>
+    3237:	83 c4 10             	add    $0x10,%esp
+    323a:	85 c0                	test   %eax,%eax
+    323c:	75 17                	jne    3255 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    323e:	83 ec 08             	sub    $0x8,%esp
+    3241:	68 64 5f 00 00       	push   $0x5f64
+    3246:	6a 01                	push   $0x1
+    3248:	e8 28 15 00 00       	call   4775 <printf>
+    324d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3250:	e8 74 13 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dots") != 0){
+    3255:	83 ec 0c             	sub    $0xc,%esp
+    3258:	68 f6 5e 00 00       	push   $0x5ef6
+    325d:	e8 b7 13 00 00       	call   4619 <unlink>
+    3262:	83 c4 10             	add    $0x10,%esp
+    3265:	85 c0                	test   %eax,%eax
+    3267:	74 17                	je     3280 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    3269:	83 ec 08             	sub    $0x8,%esp
+    326c:	68 7c 5f 00 00       	push   $0x5f7c
+    3271:	6a 01                	push   $0x1
+    3273:	e8 fd 14 00 00       	call   4775 <printf>
+    3278:	83 c4 10             	add    $0x10,%esp
+    exit();
+    327b:	e8 49 13 00 00       	call   45c9 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    3280:	83 ec 08             	sub    $0x8,%esp
+    3283:	68 91 5f 00 00       	push   $0x5f91
+    3288:	6a 01                	push   $0x1
+    328a:	e8 e6 14 00 00       	call   4775 <printf>
+    328f:	83 c4 10             	add    $0x10,%esp
+}
+    3292:	90                   	nop
+    3293:	c9                   	leave
+    3294:	c3                   	ret
+
+00003295 <dirfile>:
+
+void
+dirfile(void)
+{
+    3295:	55                   	push   %ebp
+    3296:	89 e5                	mov    %esp,%ebp
+    3298:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    329b:	83 ec 08             	sub    $0x8,%esp
+    329e:	68 9b 5f 00 00       	push   $0x5f9b
+    32a3:	6a 01                	push   $0x1
+    32a5:	e8 cb 14 00 00       	call   4775 <printf>
+    32aa:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    32ad:	83 ec 08             	sub    $0x8,%esp
+    32b0:	68 00 02 00 00       	push   $0x200
+    32b5:	68 a8 5f 00 00       	push   $0x5fa8
+    32ba:	e8 4a 13 00 00       	call   4609 <open>
+    32bf:	83 c4 10             	add    $0x10,%esp
+    32c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    32c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    32c9:	79 17                	jns    32e2 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    32cb:	83 ec 08             	sub    $0x8,%esp
+    32ce:	68 b0 5f 00 00       	push   $0x5fb0
+    32d3:	6a 01                	push   $0x1
+    32d5:	e8 9b 14 00 00       	call   4775 <printf>
+    32da:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32dd:	e8 e7 12 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    32e2:	83 ec 0c             	sub    $0xc,%esp
+    32e5:	ff 75 f4             	push   -0xc(%ebp)
+    32e8:	e8 04 13 00 00       	call   45f1 <close>
+    32ed:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    32f0:	83 ec 0c             	sub    $0xc,%esp
+    32f3:	68 a8 5f 00 00       	push   $0x5fa8
+    32f8:	e8 3c 13 00 00       	call   4639 <chdir>
+    32fd:	83 c4 10             	add    $0x10,%esp
+    3300:	85 c0                	test   %eax,%eax
+    3302:	75 17                	jne    331b <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    3304:	83 ec 08             	sub    $0x8,%esp
+    3307:	68 c7 5f 00 00       	push   $0x5fc7
+    330c:	6a 01                	push   $0x1
+    330e:	e8 62 14 00 00       	call   4775 <printf>
+    3313:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3316:	e8 ae 12 00 00       	call   45c9 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    331b:	83 ec 08             	sub    $0x8,%esp
+    331e:	6a 00                	push   $0x0
+    3320:	68 e1 5f 00 00       	push   $0x5fe1
+    3325:	e8 df 12 00 00       	call   4609 <open>
+    332a:	83 c4 10             	add    $0x10,%esp
+    332d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3334:	78 17                	js     334d <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3336:	83 ec 08             	sub    $0x8,%esp
+    3339:	68 ec 5f 00 00       	push   $0x5fec
+    333e:	6a 01                	push   $0x1
+    3340:	e8 30 14 00 00       	call   4775 <printf>
+    3345:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3348:	e8 7c 12 00 00       	call   45c9 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    334d:	83 ec 08             	sub    $0x8,%esp
+    3350:	68 00 02 00 00       	push   $0x200
+    3355:	68 e1 5f 00 00       	push   $0x5fe1
+    335a:	e8 aa 12 00 00       	call   4609 <open>
+    335f:	83 c4 10             	add    $0x10,%esp
+    3362:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3365:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3369:	78 17                	js     3382 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    336b:	83 ec 08             	sub    $0x8,%esp
+    336e:	68 ec 5f 00 00       	push   $0x5fec
+    3373:	6a 01                	push   $0x1
+    3375:	e8 fb 13 00 00       	call   4775 <printf>
+    337a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    337d:	e8 47 12 00 00       	call   45c9 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    3382:	83 ec 0c             	sub    $0xc,%esp
+    3385:	68 e1 5f 00 00       	push   $0x5fe1
+    338a:	e8 a2 12 00 00       	call   4631 <mkdir>
+    338f:	83 c4 10             	add    $0x10,%esp
+    3392:	85 c0                	test   %eax,%eax
+    3394:	75 17                	jne    33ad <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3396:	83 ec 08             	sub    $0x8,%esp
+    3399:	68 0a 60 00 00       	push   $0x600a
+    339e:	6a 01                	push   $0x1
+    33a0:	e8 d0 13 00 00       	call   4775 <printf>
+    33a5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33a8:	e8 1c 12 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    33ad:	83 ec 0c             	sub    $0xc,%esp
+    33b0:	68 e1 5f 00 00       	push   $0x5fe1
+    33b5:	e8 5f 12 00 00       	call   4619 <unlink>
+    33ba:	83 c4 10             	add    $0x10,%esp
+    33bd:	85 c0                	test   %eax,%eax
+    33bf:	75 17                	jne    33d8 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    33c1:	83 ec 08             	sub    $0x8,%esp
+    33c4:	68 27 60 00 00       	push   $0x6027
+    33c9:	6a 01                	push   $0x1
+    33cb:	e8 a5 13 00 00       	call   4775 <printf>
+    33d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    33d3:	e8 f1 11 00 00       	call   45c9 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    33d8:	83 ec 08             	sub    $0x8,%esp
+    33db:	68 e1 5f 00 00       	push   $0x5fe1
+    33e0:	68 45 60 00 00       	push   $0x6045
+    33e5:	e8 3f 12 00 00       	call   4629 <link>
+    33ea:	83 c4 10             	add    $0x10,%esp
+    33ed:	85 c0                	test   %eax,%eax
+    33ef:	75 17                	jne    3408 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    33f1:	83 ec 08             	sub    $0x8,%esp
+    33f4:	68 4c 60 00 00       	push   $0x604c
+    33f9:	6a 01                	push   $0x1
+    33fb:	e8 75 13 00 00       	call   4775 <printf>
+    3400:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3403:	e8 c1 11 00 00       	call   45c9 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    3408:	83 ec 0c             	sub    $0xc,%esp
+    340b:	68 a8 5f 00 00       	push   $0x5fa8
+    3410:	e8 04 12 00 00       	call   4619 <unlink>
+    3415:	83 c4 10             	add    $0x10,%esp
+    3418:	85 c0                	test   %eax,%eax
+    341a:	74 17                	je     3433 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    341c:	83 ec 08             	sub    $0x8,%esp
+    341f:	68 6b 60 00 00       	push   $0x606b
+    3424:	6a 01                	push   $0x1
+    3426:	e8 4a 13 00 00       	call   4775 <printf>
+    342b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    342e:	e8 96 11 00 00       	call   45c9 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    3433:	83 ec 08             	sub    $0x8,%esp
+    3436:	6a 02                	push   $0x2
+    3438:	68 3b 55 00 00       	push   $0x553b
+    343d:	e8 c7 11 00 00       	call   4609 <open>
+    3442:	83 c4 10             	add    $0x10,%esp
+    3445:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3448:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    344c:	78 17                	js     3465 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    344e:	83 ec 08             	sub    $0x8,%esp
+    3451:	68 84 60 00 00       	push   $0x6084
+    3456:	6a 01                	push   $0x1
+    3458:	e8 18 13 00 00       	call   4775 <printf>
+    345d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3460:	e8 64 11 00 00       	call   45c9 <exit>
+  }
+  fd = open(".", 0);
+    3465:	83 ec 08             	sub    $0x8,%esp
+    3468:	6a 00                	push   $0x0
+    346a:	68 3b 55 00 00       	push   $0x553b
+    346f:	e8 95 11 00 00       	call   4609 <open>
+    3474:	83 c4 10             	add    $0x10,%esp
+    3477:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    347a:	83 ec 04             	sub    $0x4,%esp
+    347d:	6a 01                	push   $0x1
+    347f:	68 e1 4d 00 00       	push   $0x4de1
+    3484:	ff 75 f4             	push   -0xc(%ebp)
+    3487:	e8 5d 11 00 00       	call   45e9 <write>
+    348c:	83 c4 10             	add    $0x10,%esp
+    348f:	85 c0                	test   %eax,%eax
+    3491:	7e 17                	jle    34aa <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    3493:	83 ec 08             	sub    $0x8,%esp
+    3496:	68 a3 60 00 00       	push   $0x60a3
+    349b:	6a 01                	push   $0x1
+    349d:	e8 d3 12 00 00       	call   4775 <printf>
+    34a2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34a5:	e8 1f 11 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    34aa:	83 ec 0c             	sub    $0xc,%esp
+    34ad:	ff 75 f4             	push   -0xc(%ebp)
+    34b0:	e8 3c 11 00 00       	call   45f1 <close>
+    34b5:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    34b8:	83 ec 08             	sub    $0x8,%esp
+    34bb:	68 b7 60 00 00       	push   $0x60b7
+    34c0:	6a 01                	push   $0x1
+    34c2:	e8 ae 12 00 00       	call   4775 <printf>
+    34c7:	83 c4 10             	add    $0x10,%esp
+}
+    34ca:	90                   	nop
+    34cb:	c9                   	leave
+    34cc:	c3                   	ret
+
+000034cd <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    34cd:	55                   	push   %ebp
+    34ce:	89 e5                	mov    %esp,%ebp
+    34d0:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    34d3:	83 ec 08             	sub    $0x8,%esp
+    34d6:	68 c7 60 00 00       	push   $0x60c7
+    34db:	6a 01                	push   $0x1
+    34dd:	e8 93 12 00 00       	call   4775 <printf>
+    34e2:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    34e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    34ec:	e9 e7 00 00 00       	jmp    35d8 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    34f1:	83 ec 0c             	sub    $0xc,%esp
+    34f4:	68 d8 60 00 00       	push   $0x60d8
+    34f9:	e8 33 11 00 00       	call   4631 <mkdir>
+    34fe:	83 c4 10             	add    $0x10,%esp
+    3501:	85 c0                	test   %eax,%eax
+    3503:	74 17                	je     351c <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    3505:	83 ec 08             	sub    $0x8,%esp
+    3508:	68 de 60 00 00       	push   $0x60de
+    350d:	6a 01                	push   $0x1
+    350f:	e8 61 12 00 00       	call   4775 <printf>
+    3514:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3517:	e8 ad 10 00 00       	call   45c9 <exit>
+    }
+    if(chdir("irefd") != 0){
+    351c:	83 ec 0c             	sub    $0xc,%esp
+    351f:	68 d8 60 00 00       	push   $0x60d8
+    3524:	e8 10 11 00 00       	call   4639 <chdir>
+    3529:	83 c4 10             	add    $0x10,%esp
+    352c:	85 c0                	test   %eax,%eax
+    352e:	74 17                	je     3547 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    3530:	83 ec 08             	sub    $0x8,%esp
+    3533:	68 f2 60 00 00       	push   $0x60f2
+    3538:	6a 01                	push   $0x1
+    353a:	e8 36 12 00 00       	call   4775 <printf>
+    353f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3542:	e8 82 10 00 00       	call   45c9 <exit>
+    }
+
+    mkdir("");
+    3547:	83 ec 0c             	sub    $0xc,%esp
+    354a:	68 06 61 00 00       	push   $0x6106
+    354f:	e8 dd 10 00 00       	call   4631 <mkdir>
+    3554:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    3557:	83 ec 08             	sub    $0x8,%esp
+    355a:	68 06 61 00 00       	push   $0x6106
+    355f:	68 45 60 00 00       	push   $0x6045
+    3564:	e8 c0 10 00 00       	call   4629 <link>
+    3569:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    356c:	83 ec 08             	sub    $0x8,%esp
+    356f:	68 00 02 00 00       	push   $0x200
+    3574:	68 06 61 00 00       	push   $0x6106
+    3579:	e8 8b 10 00 00       	call   4609 <open>
+    357e:	83 c4 10             	add    $0x10,%esp
+    3581:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3584:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3588:	78 0e                	js     3598 <iref+0xcb>
+      close(fd);
+    358a:	83 ec 0c             	sub    $0xc,%esp
+    358d:	ff 75 f0             	push   -0x10(%ebp)
+    3590:	e8 5c 10 00 00       	call   45f1 <close>
+    3595:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3598:	83 ec 08             	sub    $0x8,%esp
+    359b:	68 00 02 00 00       	push   $0x200
+    35a0:	68 07 61 00 00       	push   $0x6107
+    35a5:	e8 5f 10 00 00       	call   4609 <open>
+    35aa:	83 c4 10             	add    $0x10,%esp
+    35ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    35b0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    35b4:	78 0e                	js     35c4 <iref+0xf7>
+      close(fd);
+    35b6:	83 ec 0c             	sub    $0xc,%esp
+    35b9:	ff 75 f0             	push   -0x10(%ebp)
+    35bc:	e8 30 10 00 00       	call   45f1 <close>
+    35c1:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    35c4:	83 ec 0c             	sub    $0xc,%esp
+    35c7:	68 07 61 00 00       	push   $0x6107
+    35cc:	e8 48 10 00 00       	call   4619 <unlink>
+    35d1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    35d4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    35d8:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    35dc:	0f 8e 0f ff ff ff    	jle    34f1 <iref+0x24>
+  }
+
+  chdir("/");
+    35e2:	83 ec 0c             	sub    $0xc,%esp
+    35e5:	68 4a 4c 00 00       	push   $0x4c4a
+    35ea:	e8 4a 10 00 00       	call   4639 <chdir>
+    35ef:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    35f2:	83 ec 08             	sub    $0x8,%esp
+    35f5:	68 0a 61 00 00       	push   $0x610a
+    35fa:	6a 01                	push   $0x1
+    35fc:	e8 74 11 00 00       	call   4775 <printf>
+    3601:	83 c4 10             	add    $0x10,%esp
+}
+    3604:	90                   	nop
+    3605:	c9                   	leave
+    3606:	c3                   	ret
+
+00003607 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    3607:	55                   	push   %ebp
+    3608:	89 e5                	mov    %esp,%ebp
+    360a:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    360d:	83 ec 08             	sub    $0x8,%esp
+    3610:	68 1e 61 00 00       	push   $0x611e
+    3615:	6a 01                	push   $0x1
+    3617:	e8 59 11 00 00       	call   4775 <printf>
+    361c:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    361f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3626:	eb 1d                	jmp    3645 <forktest+0x3e>
+    pid = fork();
+    3628:	e8 94 0f 00 00       	call   45c1 <fork>
+    362d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    3630:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3634:	78 1a                	js     3650 <forktest+0x49>
+      break;
+    if(pid == 0)
+    3636:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    363a:	75 05                	jne    3641 <forktest+0x3a>
+      exit();
+    363c:	e8 88 0f 00 00       	call   45c9 <exit>
+  for(n=0; n<1000; n++){
+    3641:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3645:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    364c:	7e da                	jle    3628 <forktest+0x21>
+    364e:	eb 01                	jmp    3651 <forktest+0x4a>
+      break;
+    3650:	90                   	nop
+  }
+  
+  if(n == 1000){
+    3651:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    3658:	75 3b                	jne    3695 <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    365a:	83 ec 08             	sub    $0x8,%esp
+    365d:	68 2c 61 00 00       	push   $0x612c
+    3662:	6a 01                	push   $0x1
+    3664:	e8 0c 11 00 00       	call   4775 <printf>
+    3669:	83 c4 10             	add    $0x10,%esp
+    exit();
+    366c:	e8 58 0f 00 00       	call   45c9 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    3671:	e8 5b 0f 00 00       	call   45d1 <wait>
+    3676:	85 c0                	test   %eax,%eax
+    3678:	79 17                	jns    3691 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    367a:	83 ec 08             	sub    $0x8,%esp
+    367d:	68 4e 61 00 00       	push   $0x614e
+    3682:	6a 01                	push   $0x1
+    3684:	e8 ec 10 00 00       	call   4775 <printf>
+    3689:	83 c4 10             	add    $0x10,%esp
+      exit();
+    368c:	e8 38 0f 00 00       	call   45c9 <exit>
+  for(; n > 0; n--){
+    3691:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    3695:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3699:	7f d6                	jg     3671 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    369b:	e8 31 0f 00 00       	call   45d1 <wait>
+    36a0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    36a3:	74 17                	je     36bc <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    36a5:	83 ec 08             	sub    $0x8,%esp
+    36a8:	68 62 61 00 00       	push   $0x6162
+    36ad:	6a 01                	push   $0x1
+    36af:	e8 c1 10 00 00       	call   4775 <printf>
+    36b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36b7:	e8 0d 0f 00 00       	call   45c9 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    36bc:	83 ec 08             	sub    $0x8,%esp
+    36bf:	68 75 61 00 00       	push   $0x6175
+    36c4:	6a 01                	push   $0x1
+    36c6:	e8 aa 10 00 00       	call   4775 <printf>
+    36cb:	83 c4 10             	add    $0x10,%esp
+}
+    36ce:	90                   	nop
+    36cf:	c9                   	leave
+    36d0:	c3                   	ret
+
+000036d1 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    36d1:	55                   	push   %ebp
+    36d2:	89 e5                	mov    %esp,%ebp
+    36d4:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    36d7:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    36dc:	83 ec 08             	sub    $0x8,%esp
+    36df:	68 83 61 00 00       	push   $0x6183
+    36e4:	50                   	push   %eax
+    36e5:	e8 8b 10 00 00       	call   4775 <printf>
+    36ea:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    36ed:	83 ec 0c             	sub    $0xc,%esp
+    36f0:	6a 00                	push   $0x0
+    36f2:	e8 5a 0f 00 00       	call   4651 <sbrk>
+    36f7:	83 c4 10             	add    $0x10,%esp
+    36fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    36fd:	83 ec 0c             	sub    $0xc,%esp
+    3700:	6a 00                	push   $0x0
+    3702:	e8 4a 0f 00 00       	call   4651 <sbrk>
+    3707:	83 c4 10             	add    $0x10,%esp
+    370a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    370d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3714:	eb 4f                	jmp    3765 <sbrktest+0x94>
+    b = sbrk(1);
+    3716:	83 ec 0c             	sub    $0xc,%esp
+    3719:	6a 01                	push   $0x1
+    371b:	e8 31 0f 00 00       	call   4651 <sbrk>
+    3720:	83 c4 10             	add    $0x10,%esp
+    3723:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    3726:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3729:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    372c:	74 24                	je     3752 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    372e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3733:	83 ec 0c             	sub    $0xc,%esp
+    3736:	ff 75 d0             	push   -0x30(%ebp)
+    3739:	ff 75 f4             	push   -0xc(%ebp)
+    373c:	ff 75 f0             	push   -0x10(%ebp)
+    373f:	68 8e 61 00 00       	push   $0x618e
+    3744:	50                   	push   %eax
+    3745:	e8 2b 10 00 00       	call   4775 <printf>
+    374a:	83 c4 20             	add    $0x20,%esp
+      exit();
+    374d:	e8 77 0e 00 00       	call   45c9 <exit>
+    }
+    *b = 1;
+    3752:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3755:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    3758:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    375b:	83 c0 01             	add    $0x1,%eax
+    375e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    3761:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3765:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    376c:	7e a8                	jle    3716 <sbrktest+0x45>
+  }
+  pid = fork();
+    376e:	e8 4e 0e 00 00       	call   45c1 <fork>
+    3773:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    3776:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    377a:	79 1b                	jns    3797 <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    377c:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3781:	83 ec 08             	sub    $0x8,%esp
+    3784:	68 a9 61 00 00       	push   $0x61a9
+    3789:	50                   	push   %eax
+    378a:	e8 e6 0f 00 00       	call   4775 <printf>
+    378f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3792:	e8 32 0e 00 00       	call   45c9 <exit>
+  }
+  c = sbrk(1);
+    3797:	83 ec 0c             	sub    $0xc,%esp
+    379a:	6a 01                	push   $0x1
+    379c:	e8 b0 0e 00 00       	call   4651 <sbrk>
+    37a1:	83 c4 10             	add    $0x10,%esp
+    37a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    37a7:	83 ec 0c             	sub    $0xc,%esp
+    37aa:	6a 01                	push   $0x1
+    37ac:	e8 a0 0e 00 00       	call   4651 <sbrk>
+    37b1:	83 c4 10             	add    $0x10,%esp
+    37b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    37b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    37ba:	83 c0 01             	add    $0x1,%eax
+    37bd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    37c0:	74 1b                	je     37dd <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    37c2:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    37c7:	83 ec 08             	sub    $0x8,%esp
+    37ca:	68 c0 61 00 00       	push   $0x61c0
+    37cf:	50                   	push   %eax
+    37d0:	e8 a0 0f 00 00       	call   4775 <printf>
+    37d5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37d8:	e8 ec 0d 00 00       	call   45c9 <exit>
+  }
+  if(pid == 0)
+    37dd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    37e1:	75 05                	jne    37e8 <sbrktest+0x117>
+    exit();
+    37e3:	e8 e1 0d 00 00       	call   45c9 <exit>
+  wait();
+    37e8:	e8 e4 0d 00 00       	call   45d1 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    37ed:	83 ec 0c             	sub    $0xc,%esp
+    37f0:	6a 00                	push   $0x0
+    37f2:	e8 5a 0e 00 00       	call   4651 <sbrk>
+    37f7:	83 c4 10             	add    $0x10,%esp
+    37fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    37fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3800:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    3805:	29 c2                	sub    %eax,%edx
+    3807:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    380a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    380d:	83 ec 0c             	sub    $0xc,%esp
+    3810:	50                   	push   %eax
+    3811:	e8 3b 0e 00 00       	call   4651 <sbrk>
+    3816:	83 c4 10             	add    $0x10,%esp
+    3819:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    381c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    381f:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3822:	74 1b                	je     383f <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3824:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3829:	83 ec 08             	sub    $0x8,%esp
+    382c:	68 dc 61 00 00       	push   $0x61dc
+    3831:	50                   	push   %eax
+    3832:	e8 3e 0f 00 00       	call   4775 <printf>
+    3837:	83 c4 10             	add    $0x10,%esp
+    exit();
+    383a:	e8 8a 0d 00 00       	call   45c9 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    383f:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    3846:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3849:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    384c:	83 ec 0c             	sub    $0xc,%esp
+    384f:	6a 00                	push   $0x0
+    3851:	e8 fb 0d 00 00       	call   4651 <sbrk>
+    3856:	83 c4 10             	add    $0x10,%esp
+    3859:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    385c:	83 ec 0c             	sub    $0xc,%esp
+    385f:	68 00 f0 ff ff       	push   $0xfffff000
+    3864:	e8 e8 0d 00 00       	call   4651 <sbrk>
+    3869:	83 c4 10             	add    $0x10,%esp
+    386c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    386f:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3873:	75 1b                	jne    3890 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    3875:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    387a:	83 ec 08             	sub    $0x8,%esp
+    387d:	68 1a 62 00 00       	push   $0x621a
+    3882:	50                   	push   %eax
+    3883:	e8 ed 0e 00 00       	call   4775 <printf>
+    3888:	83 c4 10             	add    $0x10,%esp
+    exit();
+    388b:	e8 39 0d 00 00       	call   45c9 <exit>
+  }
+  c = sbrk(0);
+    3890:	83 ec 0c             	sub    $0xc,%esp
+    3893:	6a 00                	push   $0x0
+    3895:	e8 b7 0d 00 00       	call   4651 <sbrk>
+    389a:	83 c4 10             	add    $0x10,%esp
+    389d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    38a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    38a3:	2d 00 10 00 00       	sub    $0x1000,%eax
+    38a8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    38ab:	74 1e                	je     38cb <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    38ad:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    38b2:	ff 75 e4             	push   -0x1c(%ebp)
+    38b5:	ff 75 f4             	push   -0xc(%ebp)
+    38b8:	68 38 62 00 00       	push   $0x6238
+    38bd:	50                   	push   %eax
+    38be:	e8 b2 0e 00 00       	call   4775 <printf>
+    38c3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38c6:	e8 fe 0c 00 00       	call   45c9 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    38cb:	83 ec 0c             	sub    $0xc,%esp
+    38ce:	6a 00                	push   $0x0
+    38d0:	e8 7c 0d 00 00       	call   4651 <sbrk>
+    38d5:	83 c4 10             	add    $0x10,%esp
+    38d8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    38db:	83 ec 0c             	sub    $0xc,%esp
+    38de:	68 00 10 00 00       	push   $0x1000
+    38e3:	e8 69 0d 00 00       	call   4651 <sbrk>
+    38e8:	83 c4 10             	add    $0x10,%esp
+    38eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    38ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    38f1:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    38f4:	75 1a                	jne    3910 <sbrktest+0x23f>
+    38f6:	83 ec 0c             	sub    $0xc,%esp
+    38f9:	6a 00                	push   $0x0
+    38fb:	e8 51 0d 00 00       	call   4651 <sbrk>
+    3900:	83 c4 10             	add    $0x10,%esp
+    3903:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3906:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    390c:	39 d0                	cmp    %edx,%eax
+    390e:	74 1e                	je     392e <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3910:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3915:	ff 75 e4             	push   -0x1c(%ebp)
+    3918:	ff 75 f4             	push   -0xc(%ebp)
+    391b:	68 70 62 00 00       	push   $0x6270
+    3920:	50                   	push   %eax
+    3921:	e8 4f 0e 00 00       	call   4775 <printf>
+    3926:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3929:	e8 9b 0c 00 00       	call   45c9 <exit>
+  }
+  if(*lastaddr == 99){
+    392e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3931:	0f b6 00             	movzbl (%eax),%eax
+    3934:	3c 63                	cmp    $0x63,%al
+    3936:	75 1b                	jne    3953 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3938:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    393d:	83 ec 08             	sub    $0x8,%esp
+    3940:	68 98 62 00 00       	push   $0x6298
+    3945:	50                   	push   %eax
+    3946:	e8 2a 0e 00 00       	call   4775 <printf>
+    394b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    394e:	e8 76 0c 00 00       	call   45c9 <exit>
+  }
+
+  a = sbrk(0);
+    3953:	83 ec 0c             	sub    $0xc,%esp
+    3956:	6a 00                	push   $0x0
+    3958:	e8 f4 0c 00 00       	call   4651 <sbrk>
+    395d:	83 c4 10             	add    $0x10,%esp
+    3960:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3963:	83 ec 0c             	sub    $0xc,%esp
+    3966:	6a 00                	push   $0x0
+    3968:	e8 e4 0c 00 00       	call   4651 <sbrk>
+    396d:	83 c4 10             	add    $0x10,%esp
+    3970:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3973:	29 c2                	sub    %eax,%edx
+    3975:	83 ec 0c             	sub    $0xc,%esp
+    3978:	52                   	push   %edx
+    3979:	e8 d3 0c 00 00       	call   4651 <sbrk>
+    397e:	83 c4 10             	add    $0x10,%esp
+    3981:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    3984:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3987:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    398a:	74 1e                	je     39aa <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    398c:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3991:	ff 75 e4             	push   -0x1c(%ebp)
+    3994:	ff 75 f4             	push   -0xc(%ebp)
+    3997:	68 c8 62 00 00       	push   $0x62c8
+    399c:	50                   	push   %eax
+    399d:	e8 d3 0d 00 00       	call   4775 <printf>
+    39a2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39a5:	e8 1f 0c 00 00       	call   45c9 <exit>
+  }
+
+  // untouched heap reads as zeros, from user space and through
+  // write(), and stays zero elsewhere once a page of it is written.
+  p = sbrk(2*4096);
+    39aa:	83 ec 0c             	sub    $0xc,%esp
+    39ad:	68 00 20 00 00       	push   $0x2000
+    39b2:	e8 9a 0c 00 00       	call   4651 <sbrk>
+    39b7:	83 c4 10             	add    $0x10,%esp
+    39ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(pipe(fds) != 0){
+    39bd:	83 ec 0c             	sub    $0xc,%esp
+    39c0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    39c3:	50                   	push   %eax
+    39c4:	e8 10 0c 00 00       	call   45d9 <pipe>
+    39c9:	83 c4 10             	add    $0x10,%esp
+    39cc:	85 c0                	test   %eax,%eax
+    39ce:	74 1b                	je     39eb <sbrktest+0x31a>
+    printf(stdout, "pipe() failed\n");
+    39d0:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    39d5:	83 ec 08             	sub    $0x8,%esp
+    39d8:	68 22 51 00 00       	push   $0x5122
+    39dd:	50                   	push   %eax
+    39de:	e8 92 0d 00 00       	call   4775 <printf>
+    39e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39e6:	e8 de 0b 00 00       	call   45c9 <exit>
+  }
+  if(p[0] != 0 || write(fds[1], p + 4096, 100) != 100){
+    39eb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    39ee:	0f b6 00             	movzbl (%eax),%eax
+    39f1:	84 c0                	test   %al,%al
+    39f3:	75 20                	jne    3a15 <sbrktest+0x344>
+    39f5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    39f8:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+    39fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3a01:	83 ec 04             	sub    $0x4,%esp
+    3a04:	6a 64                	push   $0x64
+    3a06:	52                   	push   %edx
+    3a07:	50                   	push   %eax
+    3a08:	e8 dc 0b 00 00       	call   45e9 <write>
+    3a0d:	83 c4 10             	add    $0x10,%esp
+    3a10:	83 f8 64             	cmp    $0x64,%eax
+    3a13:	74 1b                	je     3a30 <sbrktest+0x35f>
+    printf(stdout, "sbrk read of untouched heap failed\n");
+    3a15:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3a1a:	83 ec 08             	sub    $0x8,%esp
+    3a1d:	68 ec 62 00 00       	push   $0x62ec
+    3a22:	50                   	push   %eax
+    3a23:	e8 4d 0d 00 00       	call   4775 <printf>
+    3a28:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a2b:	e8 99 0b 00 00       	call   45c9 <exit>
+  }
+  p[0] = 1;
+    3a30:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3a33:	c6 00 01             	movb   $0x1,(%eax)
+  if(read(fds[0], buf, 100) != 100 || buf[0] != 0 || buf[99] != 0 ||
+    3a36:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    3a39:	83 ec 04             	sub    $0x4,%esp
+    3a3c:	6a 64                	push   $0x64
+    3a3e:	68 a0 6d 00 00       	push   $0x6da0
+    3a43:	50                   	push   %eax
+    3a44:	e8 98 0b 00 00       	call   45e1 <read>
+    3a49:	83 c4 10             	add    $0x10,%esp
+    3a4c:	83 f8 64             	cmp    $0x64,%eax
+    3a4f:	75 32                	jne    3a83 <sbrktest+0x3b2>
+    3a51:	0f b6 05 a0 6d 00 00 	movzbl 0x6da0,%eax
+    3a58:	84 c0                	test   %al,%al
+    3a5a:	75 27                	jne    3a83 <sbrktest+0x3b2>
+    3a5c:	0f b6 05 03 6e 00 00 	movzbl 0x6e03,%eax
+    3a63:	84 c0                	test   %al,%al
+    3a65:	75 1c                	jne    3a83 <sbrktest+0x3b2>
+     p[1] != 0 || p[4096] != 0){
+    3a67:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3a6a:	83 c0 01             	add    $0x1,%eax
+    3a6d:	0f b6 00             	movzbl (%eax),%eax
+  if(read(fds[0], buf, 100) != 100 || buf[0] != 0 || buf[99] != 0 ||
+    3a70:	84 c0                	test   %al,%al
+    3a72:	75 0f                	jne    3a83 <sbrktest+0x3b2>
+     p[1] != 0 || p[4096] != 0){
+    3a74:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3a77:	05 00 10 00 00       	add    $0x1000,%eax
+    3a7c:	0f b6 00             	movzbl (%eax),%eax
+    3a7f:	84 c0                	test   %al,%al
+    3a81:	74 1b                	je     3a9e <sbrktest+0x3cd>
+    printf(stdout, "sbrk zero page was written\n");
+    3a83:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3a88:	83 ec 08             	sub    $0x8,%esp
+    3a8b:	68 10 63 00 00       	push   $0x6310
+    3a90:	50                   	push   %eax
+    3a91:	e8 df 0c 00 00       	call   4775 <printf>
+    3a96:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a99:	e8 2b 0b 00 00       	call   45c9 <exit>
+  }
+  close(fds[0]);
+    3a9e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    3aa1:	83 ec 0c             	sub    $0xc,%esp
+    3aa4:	50                   	push   %eax
+    3aa5:	e8 47 0b 00 00       	call   45f1 <close>
+    3aaa:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+    3aad:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3ab0:	83 ec 0c             	sub    $0xc,%esp
+    3ab3:	50                   	push   %eax
+    3ab4:	e8 38 0b 00 00       	call   45f1 <close>
+    3ab9:	83 c4 10             	add    $0x10,%esp
+  sbrk(-(2*4096));
+    3abc:	83 ec 0c             	sub    $0xc,%esp
+    3abf:	68 00 e0 ff ff       	push   $0xffffe000
+    3ac4:	e8 88 0b 00 00       	call   4651 <sbrk>
+    3ac9:	83 c4 10             	add    $0x10,%esp
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3acc:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    3ad3:	eb 76                	jmp    3b4b <sbrktest+0x47a>
+    ppid = getpid();
+    3ad5:	e8 6f 0b 00 00       	call   4649 <getpid>
+    3ada:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    3add:	e8 df 0a 00 00       	call   45c1 <fork>
+    3ae2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    3ae5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3ae9:	79 1b                	jns    3b06 <sbrktest+0x435>
+      printf(stdout, "fork failed\n");
+    3aeb:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3af0:	83 ec 08             	sub    $0x8,%esp
+    3af3:	68 79 4c 00 00       	push   $0x4c79
+    3af8:	50                   	push   %eax
+    3af9:	e8 77 0c 00 00       	call   4775 <printf>
+    3afe:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b01:	e8 c3 0a 00 00       	call   45c9 <exit>
+    }
+    if(pid == 0){
+    3b06:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b0a:	75 33                	jne    3b3f <sbrktest+0x46e>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3b0f:	0f b6 00             	movzbl (%eax),%eax
+    3b12:	0f be d0             	movsbl %al,%edx
+    3b15:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3b1a:	52                   	push   %edx
+    3b1b:	ff 75 f4             	push   -0xc(%ebp)
+    3b1e:	68 2c 63 00 00       	push   $0x632c
+    3b23:	50                   	push   %eax
+    3b24:	e8 4c 0c 00 00       	call   4775 <printf>
+    3b29:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    3b2c:	83 ec 0c             	sub    $0xc,%esp
+    3b2f:	ff 75 d4             	push   -0x2c(%ebp)
+    3b32:	e8 c2 0a 00 00       	call   45f9 <kill>
+    3b37:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b3a:	e8 8a 0a 00 00       	call   45c9 <exit>
+    }
+    wait();
+    3b3f:	e8 8d 0a 00 00       	call   45d1 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b44:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    3b4b:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    3b52:	76 81                	jbe    3ad5 <sbrktest+0x404>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3b54:	83 ec 0c             	sub    $0xc,%esp
+    3b57:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3b5a:	50                   	push   %eax
+    3b5b:	e8 79 0a 00 00       	call   45d9 <pipe>
+    3b60:	83 c4 10             	add    $0x10,%esp
+    3b63:	85 c0                	test   %eax,%eax
+    3b65:	74 17                	je     3b7e <sbrktest+0x4ad>
+    printf(1, "pipe() failed\n");
+    3b67:	83 ec 08             	sub    $0x8,%esp
+    3b6a:	68 22 51 00 00       	push   $0x5122
+    3b6f:	6a 01                	push   $0x1
+    3b71:	e8 ff 0b 00 00       	call   4775 <printf>
+    3b76:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b79:	e8 4b 0a 00 00       	call   45c9 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3b7e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3b85:	e9 86 00 00 00       	jmp    3c10 <sbrktest+0x53f>
+    if((pids[i] = fork()) == 0){
+    3b8a:	e8 32 0a 00 00       	call   45c1 <fork>
+    3b8f:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    3b92:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    3b96:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3b99:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3b9d:	85 c0                	test   %eax,%eax
+    3b9f:	75 4a                	jne    3beb <sbrktest+0x51a>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    3ba1:	83 ec 0c             	sub    $0xc,%esp
+    3ba4:	6a 00                	push   $0x0
+    3ba6:	e8 a6 0a 00 00       	call   4651 <sbrk>
+    3bab:	83 c4 10             	add    $0x10,%esp
+    3bae:	89 c2                	mov    %eax,%edx
+    3bb0:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3bb5:	29 d0                	sub    %edx,%eax
+    3bb7:	83 ec 0c             	sub    $0xc,%esp
+    3bba:	50                   	push   %eax
+    3bbb:	e8 91 0a 00 00       	call   4651 <sbrk>
+    3bc0:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    3bc3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3bc6:	83 ec 04             	sub    $0x4,%esp
+    3bc9:	6a 01                	push   $0x1
+    3bcb:	68 e1 4d 00 00       	push   $0x4de1
+    3bd0:	50                   	push   %eax
+    3bd1:	e8 13 0a 00 00       	call   45e9 <write>
+    3bd6:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    3bd9:	83 ec 0c             	sub    $0xc,%esp
+    3bdc:	68 e8 03 00 00       	push   $0x3e8
+    3be1:	e8 73 0a 00 00       	call   4659 <sleep>
+    3be6:	83 c4 10             	add    $0x10,%esp
+    3be9:	eb ee                	jmp    3bd9 <sbrktest+0x508>
+    }
+    if(pids[i] != -1)
+    3beb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3bee:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3bf2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bf5:	74 15                	je     3c0c <sbrktest+0x53b>
+      read(fds[0], &scratch, 1);
+    3bf7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    3bfa:	83 ec 04             	sub    $0x4,%esp
+    3bfd:	6a 01                	push   $0x1
+    3bff:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    3c02:	52                   	push   %edx
+    3c03:	50                   	push   %eax
+    3c04:	e8 d8 09 00 00       	call   45e1 <read>
+    3c09:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c0c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3c10:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c13:	83 f8 09             	cmp    $0x9,%eax
+    3c16:	0f 86 6e ff ff ff    	jbe    3b8a <sbrktest+0x4b9>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    3c1c:	83 ec 0c             	sub    $0xc,%esp
+    3c1f:	68 00 10 00 00       	push   $0x1000
+    3c24:	e8 28 0a 00 00       	call   4651 <sbrk>
+    3c29:	83 c4 10             	add    $0x10,%esp
+    3c2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c2f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3c36:	eb 2b                	jmp    3c63 <sbrktest+0x592>
+    if(pids[i] == -1)
+    3c38:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c3b:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3c3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c42:	74 1a                	je     3c5e <sbrktest+0x58d>
+      continue;
+    kill(pids[i]);
+    3c44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c47:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    3c4b:	83 ec 0c             	sub    $0xc,%esp
+    3c4e:	50                   	push   %eax
+    3c4f:	e8 a5 09 00 00       	call   45f9 <kill>
+    3c54:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3c57:	e8 75 09 00 00       	call   45d1 <wait>
+    3c5c:	eb 01                	jmp    3c5f <sbrktest+0x58e>
+      continue;
+    3c5e:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c5f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3c63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3c66:	83 f8 09             	cmp    $0x9,%eax
+    3c69:	76 cd                	jbe    3c38 <sbrktest+0x567>
+  }
+  if(c == (char*)0xffffffff){
+    3c6b:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3c6f:	75 1b                	jne    3c8c <sbrktest+0x5bb>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3c71:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3c76:	83 ec 08             	sub    $0x8,%esp
+    3c79:	68 45 63 00 00       	push   $0x6345
+    3c7e:	50                   	push   %eax
+    3c7f:	e8 f1 0a 00 00       	call   4775 <printf>
+    3c84:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3c87:	e8 3d 09 00 00       	call   45c9 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    3c8c:	83 ec 0c             	sub    $0xc,%esp
+    3c8f:	6a 00                	push   $0x0
+    3c91:	e8 bb 09 00 00       	call   4651 <sbrk>
+    3c96:	83 c4 10             	add    $0x10,%esp
+    3c99:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    3c9c:	73 1e                	jae    3cbc <sbrktest+0x5eb>
+    sbrk(-(sbrk(0) - oldbrk));
+    3c9e:	83 ec 0c             	sub    $0xc,%esp
+    3ca1:	6a 00                	push   $0x0
+    3ca3:	e8 a9 09 00 00       	call   4651 <sbrk>
+    3ca8:	83 c4 10             	add    $0x10,%esp
+    3cab:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3cae:	29 c2                	sub    %eax,%edx
+    3cb0:	83 ec 0c             	sub    $0xc,%esp
+    3cb3:	52                   	push   %edx
+    3cb4:	e8 98 09 00 00       	call   4651 <sbrk>
+    3cb9:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    3cbc:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3cc1:	83 ec 08             	sub    $0x8,%esp
+    3cc4:	68 60 63 00 00       	push   $0x6360
+    3cc9:	50                   	push   %eax
+    3cca:	e8 a6 0a 00 00       	call   4775 <printf>
+    3ccf:	83 c4 10             	add    $0x10,%esp
+}
+    3cd2:	90                   	nop
+    3cd3:	c9                   	leave
+    3cd4:	c3                   	ret
+
+00003cd5 <validateint>:
+
+void
+validateint(int *p)
+{
+    3cd5:	55                   	push   %ebp
+    3cd6:	89 e5                	mov    %esp,%ebp
+    3cd8:	53                   	push   %ebx
+    3cd9:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    3cdc:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3ce1:	8b 55 08             	mov    0x8(%ebp),%edx
+    3ce4:	89 d1                	mov    %edx,%ecx
+    3ce6:	89 e3                	mov    %esp,%ebx
+    3ce8:	89 cc                	mov    %ecx,%esp
+    3cea:	cd 40                	int    $0x40
+    3cec:	89 dc                	mov    %ebx,%esp
+    3cee:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    3cf1:	90                   	nop
+    3cf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3cf5:	c9                   	leave
+    3cf6:	c3                   	ret
+
+00003cf7 <validatetest>:
+
+void
+validatetest(void)
+{
+    3cf7:	55                   	push   %ebp
+    3cf8:	89 e5                	mov    %esp,%ebp
+    3cfa:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    3cfd:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3d02:	83 ec 08             	sub    $0x8,%esp
+    3d05:	68 6e 63 00 00       	push   $0x636e
+    3d0a:	50                   	push   %eax
+    3d0b:	e8 65 0a 00 00       	call   4775 <printf>
+    3d10:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    3d13:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3d1a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3d21:	e9 8a 00 00 00       	jmp    3db0 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    3d26:	e8 96 08 00 00       	call   45c1 <fork>
+    3d2b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    3d2e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3d32:	75 14                	jne    3d48 <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    3d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d37:	83 ec 0c             	sub    $0xc,%esp
+    3d3a:	50                   	push   %eax
+    3d3b:	e8 95 ff ff ff       	call   3cd5 <validateint>
+    3d40:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3d43:	e8 81 08 00 00       	call   45c9 <exit>
+    }
+    sleep(0);
+    3d48:	83 ec 0c             	sub    $0xc,%esp
+    3d4b:	6a 00                	push   $0x0
+    3d4d:	e8 07 09 00 00       	call   4659 <sleep>
+    3d52:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    3d55:	83 ec 0c             	sub    $0xc,%esp
+    3d58:	6a 00                	push   $0x0
+    3d5a:	e8 fa 08 00 00       	call   4659 <sleep>
+    3d5f:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    3d62:	83 ec 0c             	sub    $0xc,%esp
+    3d65:	ff 75 ec             	push   -0x14(%ebp)
+    3d68:	e8 8c 08 00 00       	call   45f9 <kill>
+    3d6d:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3d70:	e8 5c 08 00 00       	call   45d1 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3d75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3d78:	83 ec 08             	sub    $0x8,%esp
+    3d7b:	50                   	push   %eax
+    3d7c:	68 7d 63 00 00       	push   $0x637d
+    3d81:	e8 a3 08 00 00       	call   4629 <link>
+    3d86:	83 c4 10             	add    $0x10,%esp
+    3d89:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d8c:	74 1b                	je     3da9 <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    3d8e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3d93:	83 ec 08             	sub    $0x8,%esp
+    3d96:	68 88 63 00 00       	push   $0x6388
+    3d9b:	50                   	push   %eax
+    3d9c:	e8 d4 09 00 00       	call   4775 <printf>
+    3da1:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3da4:	e8 20 08 00 00       	call   45c9 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3da9:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    3db0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3db3:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3db6:	0f 83 6a ff ff ff    	jae    3d26 <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3dbc:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3dc1:	83 ec 08             	sub    $0x8,%esp
+    3dc4:	68 a1 63 00 00       	push   $0x63a1
+    3dc9:	50                   	push   %eax
+    3dca:	e8 a6 09 00 00       	call   4775 <printf>
+    3dcf:	83 c4 10             	add    $0x10,%esp
+}
+    3dd2:	90                   	nop
+    3dd3:	c9                   	leave
+    3dd4:	c3                   	ret
+
+00003dd5 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3dd5:	55                   	push   %ebp
+    3dd6:	89 e5                	mov    %esp,%ebp
+    3dd8:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3ddb:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3de0:	83 ec 08             	sub    $0x8,%esp
+    3de3:	68 ae 63 00 00       	push   $0x63ae
+    3de8:	50                   	push   %eax
+    3de9:	e8 87 09 00 00       	call   4775 <printf>
+    3dee:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3df1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3df8:	eb 2e                	jmp    3e28 <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    3dfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3dfd:	05 c0 8d 00 00       	add    $0x8dc0,%eax
+    3e02:	0f b6 00             	movzbl (%eax),%eax
+    3e05:	84 c0                	test   %al,%al
+    3e07:	74 1b                	je     3e24 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    3e09:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3e0e:	83 ec 08             	sub    $0x8,%esp
+    3e11:	68 b8 63 00 00       	push   $0x63b8
+    3e16:	50                   	push   %eax
+    3e17:	e8 59 09 00 00       	call   4775 <printf>
+    3e1c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3e1f:	e8 a5 07 00 00       	call   45c9 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    3e24:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3e28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e2b:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3e30:	76 c8                	jbe    3dfa <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3e32:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3e37:	83 ec 08             	sub    $0x8,%esp
+    3e3a:	68 c9 63 00 00       	push   $0x63c9
+    3e3f:	50                   	push   %eax
+    3e40:	e8 30 09 00 00       	call   4775 <printf>
+    3e45:	83 c4 10             	add    $0x10,%esp
+}
+    3e48:	90                   	nop
+    3e49:	c9                   	leave
+    3e4a:	c3                   	ret
+
+00003e4b <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3e4b:	55                   	push   %ebp
+    3e4c:	89 e5                	mov    %esp,%ebp
+    3e4e:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3e51:	83 ec 0c             	sub    $0xc,%esp
+    3e54:	68 d6 63 00 00       	push   $0x63d6
+    3e59:	e8 bb 07 00 00       	call   4619 <unlink>
+    3e5e:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3e61:	e8 5b 07 00 00       	call   45c1 <fork>
+    3e66:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    3e69:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3e6d:	0f 85 97 00 00 00    	jne    3f0a <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    3e73:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3e7a:	eb 12                	jmp    3e8e <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3e7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e7f:	c7 04 85 e0 b4 00 00 	movl   $0x63e0,0xb4e0(,%eax,4)
+    3e86:	e0 63 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3e8a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3e8e:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    3e92:	7e e8                	jle    3e7c <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    3e94:	c7 05 5c b5 00 00 00 	movl   $0x0,0xb55c
+    3e9b:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3e9e:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3ea3:	83 ec 08             	sub    $0x8,%esp
+    3ea6:	68 bd 64 00 00       	push   $0x64bd
+    3eab:	50                   	push   %eax
+    3eac:	e8 c4 08 00 00       	call   4775 <printf>
+    3eb1:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    3eb4:	83 ec 08             	sub    $0x8,%esp
+    3eb7:	68 e0 b4 00 00       	push   $0xb4e0
+    3ebc:	68 d8 4b 00 00       	push   $0x4bd8
+    3ec1:	e8 3b 07 00 00       	call   4601 <exec>
+    3ec6:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    3ec9:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3ece:	83 ec 08             	sub    $0x8,%esp
+    3ed1:	68 ca 64 00 00       	push   $0x64ca
+    3ed6:	50                   	push   %eax
+    3ed7:	e8 99 08 00 00       	call   4775 <printf>
+    3edc:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    3edf:	83 ec 08             	sub    $0x8,%esp
+    3ee2:	68 00 02 00 00       	push   $0x200
+    3ee7:	68 d6 63 00 00       	push   $0x63d6
+    3eec:	e8 18 07 00 00       	call   4609 <open>
+    3ef1:	83 c4 10             	add    $0x10,%esp
+    3ef4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    3ef7:	83 ec 0c             	sub    $0xc,%esp
+    3efa:	ff 75 ec             	push   -0x14(%ebp)
+    3efd:	e8 ef 06 00 00       	call   45f1 <close>
+    3f02:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f05:	e8 bf 06 00 00       	call   45c9 <exit>
+  } else if(pid < 0){
+    3f0a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3f0e:	79 1b                	jns    3f2b <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    3f10:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3f15:	83 ec 08             	sub    $0x8,%esp
+    3f18:	68 da 64 00 00       	push   $0x64da
+    3f1d:	50                   	push   %eax
+    3f1e:	e8 52 08 00 00       	call   4775 <printf>
+    3f23:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f26:	e8 9e 06 00 00       	call   45c9 <exit>
+  }
+  wait();
+    3f2b:	e8 a1 06 00 00       	call   45d1 <wait>
+  fd = open("bigarg-ok", 0);
+    3f30:	83 ec 08             	sub    $0x8,%esp
+    3f33:	6a 00                	push   $0x0
+    3f35:	68 d6 63 00 00       	push   $0x63d6
+    3f3a:	e8 ca 06 00 00       	call   4609 <open>
+    3f3f:	83 c4 10             	add    $0x10,%esp
+    3f42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    3f45:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3f49:	79 1b                	jns    3f66 <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    3f4b:	a1 78 6d 00 00       	mov    0x6d78,%eax
+    3f50:	83 ec 08             	sub    $0x8,%esp
+    3f53:	68 f3 64 00 00       	push   $0x64f3
+    3f58:	50                   	push   %eax
+    3f59:	e8 17 08 00 00       	call   4775 <printf>
+    3f5e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f61:	e8 63 06 00 00       	call   45c9 <exit>
+  }
+  close(fd);
+    3f66:	83 ec 0c             	sub    $0xc,%esp
+    3f69:	ff 75 ec             	push   -0x14(%ebp)
+    3f6c:	e8 80 06 00 00       	call   45f1 <close>
+    3f71:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    3f74:	83 ec 0c             	sub    $0xc,%esp
+    3f77:	68 d6 63 00 00       	push   $0x63d6
+    3f7c:	e8 98 06 00 00       	call   4619 <unlink>
+    3f81:	83 c4 10             	add    $0x10,%esp
+}
+    3f84:	90                   	nop
+    3f85:	c9                   	leave
+    3f86:	c3                   	ret
+
+00003f87 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    3f87:	55                   	push   %ebp
+    3f88:	89 e5                	mov    %esp,%ebp
+    3f8a:	53                   	push   %ebx
+    3f8b:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    3f8e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    3f95:	83 ec 08             	sub    $0x8,%esp
+    3f98:	68 08 65 00 00       	push   $0x6508
+    3f9d:	6a 01                	push   $0x1
+    3f9f:	e8 d1 07 00 00       	call   4775 <printf>
+    3fa4:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    3fa7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    3fae:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3fb2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3fb5:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3fba:	89 c8                	mov    %ecx,%eax
+    3fbc:	f7 ea                	imul   %edx
+    3fbe:	c1 fa 06             	sar    $0x6,%edx
+    3fc1:	89 c8                	mov    %ecx,%eax
+    3fc3:	c1 f8 1f             	sar    $0x1f,%eax
+    3fc6:	29 c2                	sub    %eax,%edx
+    3fc8:	89 d0                	mov    %edx,%eax
+    3fca:	83 c0 30             	add    $0x30,%eax
+    3fcd:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3fd0:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3fd3:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3fd8:	89 d8                	mov    %ebx,%eax
+    3fda:	f7 ea                	imul   %edx
+    3fdc:	c1 fa 06             	sar    $0x6,%edx
+    3fdf:	89 d8                	mov    %ebx,%eax
+    3fe1:	c1 f8 1f             	sar    $0x1f,%eax
+    3fe4:	89 d1                	mov    %edx,%ecx
+    3fe6:	29 c1                	sub    %eax,%ecx
+    3fe8:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    3fee:	29 c3                	sub    %eax,%ebx
+    3ff0:	89 d9                	mov    %ebx,%ecx
+    3ff2:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    3ff7:	89 c8                	mov    %ecx,%eax
+    3ff9:	f7 ea                	imul   %edx
+    3ffb:	c1 fa 05             	sar    $0x5,%edx
+    3ffe:	89 c8                	mov    %ecx,%eax
+    4000:	c1 f8 1f             	sar    $0x1f,%eax
+    4003:	29 c2                	sub    %eax,%edx
+    4005:	89 d0                	mov    %edx,%eax
+    4007:	83 c0 30             	add    $0x30,%eax
+    400a:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    400d:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4010:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4015:	89 d8                	mov    %ebx,%eax
+    4017:	f7 ea                	imul   %edx
+    4019:	c1 fa 05             	sar    $0x5,%edx
+    401c:	89 d8                	mov    %ebx,%eax
+    401e:	c1 f8 1f             	sar    $0x1f,%eax
+    4021:	89 d1                	mov    %edx,%ecx
+    4023:	29 c1                	sub    %eax,%ecx
+    4025:	6b c1 64             	imul   $0x64,%ecx,%eax
+    4028:	29 c3                	sub    %eax,%ebx
+    402a:	89 d9                	mov    %ebx,%ecx
+    402c:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4031:	89 c8                	mov    %ecx,%eax
+    4033:	f7 ea                	imul   %edx
+    4035:	c1 fa 02             	sar    $0x2,%edx
+    4038:	89 c8                	mov    %ecx,%eax
+    403a:	c1 f8 1f             	sar    $0x1f,%eax
+    403d:	29 c2                	sub    %eax,%edx
+    403f:	89 d0                	mov    %edx,%eax
+    4041:	83 c0 30             	add    $0x30,%eax
+    4044:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    4047:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    404a:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    404f:	89 c8                	mov    %ecx,%eax
+    4051:	f7 ea                	imul   %edx
+    4053:	c1 fa 02             	sar    $0x2,%edx
+    4056:	89 c8                	mov    %ecx,%eax
+    4058:	c1 f8 1f             	sar    $0x1f,%eax
+    405b:	29 c2                	sub    %eax,%edx
+    405d:	89 d0                	mov    %edx,%eax
+    405f:	c1 e0 02             	shl    $0x2,%eax
+    4062:	01 d0                	add    %edx,%eax
+    4064:	01 c0                	add    %eax,%eax
+    4066:	29 c1                	sub    %eax,%ecx
+    4068:	89 ca                	mov    %ecx,%edx
+    406a:	89 d0                	mov    %edx,%eax
+    406c:	83 c0 30             	add    $0x30,%eax
+    406f:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    4072:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    4076:	83 ec 04             	sub    $0x4,%esp
+    4079:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    407c:	50                   	push   %eax
+    407d:	68 15 65 00 00       	push   $0x6515
+    4082:	6a 01                	push   $0x1
+    4084:	e8 ec 06 00 00       	call   4775 <printf>
+    4089:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    408c:	83 ec 08             	sub    $0x8,%esp
+    408f:	68 02 02 00 00       	push   $0x202
+    4094:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4097:	50                   	push   %eax
+    4098:	e8 6c 05 00 00       	call   4609 <open>
+    409d:	83 c4 10             	add    $0x10,%esp
+    40a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    40a3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    40a7:	79 18                	jns    40c1 <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    40a9:	83 ec 04             	sub    $0x4,%esp
+    40ac:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    40af:	50                   	push   %eax
+    40b0:	68 21 65 00 00       	push   $0x6521
+    40b5:	6a 01                	push   $0x1
+    40b7:	e8 b9 06 00 00       	call   4775 <printf>
+    40bc:	83 c4 10             	add    $0x10,%esp
+      break;
+    40bf:	eb 6b                	jmp    412c <fsfull+0x1a5>
+    }
+    int total = 0;
+    40c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    40c8:	83 ec 04             	sub    $0x4,%esp
+    40cb:	68 00 02 00 00       	push   $0x200
+    40d0:	68 a0 6d 00 00       	push   $0x6da0
+    40d5:	ff 75 e8             	push   -0x18(%ebp)
+    40d8:	e8 0c 05 00 00       	call   45e9 <write>
+    40dd:	83 c4 10             	add    $0x10,%esp
+    40e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    40e3:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    40ea:	7e 0c                	jle    40f8 <fsfull+0x171>
+        break;
+      total += cc;
+    40ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    40ef:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    40f2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    40f6:	eb d0                	jmp    40c8 <fsfull+0x141>
+        break;
+    40f8:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    40f9:	83 ec 04             	sub    $0x4,%esp
+    40fc:	ff 75 ec             	push   -0x14(%ebp)
+    40ff:	68 31 65 00 00       	push   $0x6531
+    4104:	6a 01                	push   $0x1
+    4106:	e8 6a 06 00 00       	call   4775 <printf>
+    410b:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    410e:	83 ec 0c             	sub    $0xc,%esp
+    4111:	ff 75 e8             	push   -0x18(%ebp)
+    4114:	e8 d8 04 00 00       	call   45f1 <close>
+    4119:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    411c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4120:	74 09                	je     412b <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    4122:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4126:	e9 83 fe ff ff       	jmp    3fae <fsfull+0x27>
+      break;
+    412b:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    412c:	e9 db 00 00 00       	jmp    420c <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    4131:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4135:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4138:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    413d:	89 c8                	mov    %ecx,%eax
+    413f:	f7 ea                	imul   %edx
+    4141:	c1 fa 06             	sar    $0x6,%edx
+    4144:	89 c8                	mov    %ecx,%eax
+    4146:	c1 f8 1f             	sar    $0x1f,%eax
+    4149:	29 c2                	sub    %eax,%edx
+    414b:	89 d0                	mov    %edx,%eax
+    414d:	83 c0 30             	add    $0x30,%eax
+    4150:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4153:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4156:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    415b:	89 d8                	mov    %ebx,%eax
+    415d:	f7 ea                	imul   %edx
+    415f:	c1 fa 06             	sar    $0x6,%edx
+    4162:	89 d8                	mov    %ebx,%eax
+    4164:	c1 f8 1f             	sar    $0x1f,%eax
+    4167:	89 d1                	mov    %edx,%ecx
+    4169:	29 c1                	sub    %eax,%ecx
+    416b:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    4171:	29 c3                	sub    %eax,%ebx
+    4173:	89 d9                	mov    %ebx,%ecx
+    4175:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    417a:	89 c8                	mov    %ecx,%eax
+    417c:	f7 ea                	imul   %edx
+    417e:	c1 fa 05             	sar    $0x5,%edx
+    4181:	89 c8                	mov    %ecx,%eax
+    4183:	c1 f8 1f             	sar    $0x1f,%eax
+    4186:	29 c2                	sub    %eax,%edx
+    4188:	89 d0                	mov    %edx,%eax
+    418a:	83 c0 30             	add    $0x30,%eax
+    418d:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4190:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4193:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4198:	89 d8                	mov    %ebx,%eax
+    419a:	f7 ea                	imul   %edx
+    419c:	c1 fa 05             	sar    $0x5,%edx
+    419f:	89 d8                	mov    %ebx,%eax
+    41a1:	c1 f8 1f             	sar    $0x1f,%eax
+    41a4:	89 d1                	mov    %edx,%ecx
+    41a6:	29 c1                	sub    %eax,%ecx
+    41a8:	6b c1 64             	imul   $0x64,%ecx,%eax
+    41ab:	29 c3                	sub    %eax,%ebx
+    41ad:	89 d9                	mov    %ebx,%ecx
+    41af:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    41b4:	89 c8                	mov    %ecx,%eax
+    41b6:	f7 ea                	imul   %edx
+    41b8:	c1 fa 02             	sar    $0x2,%edx
+    41bb:	89 c8                	mov    %ecx,%eax
+    41bd:	c1 f8 1f             	sar    $0x1f,%eax
+    41c0:	29 c2                	sub    %eax,%edx
+    41c2:	89 d0                	mov    %edx,%eax
+    41c4:	83 c0 30             	add    $0x30,%eax
+    41c7:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    41ca:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    41cd:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    41d2:	89 c8                	mov    %ecx,%eax
+    41d4:	f7 ea                	imul   %edx
+    41d6:	c1 fa 02             	sar    $0x2,%edx
+    41d9:	89 c8                	mov    %ecx,%eax
+    41db:	c1 f8 1f             	sar    $0x1f,%eax
+    41de:	29 c2                	sub    %eax,%edx
+    41e0:	89 d0                	mov    %edx,%eax
+    41e2:	c1 e0 02             	shl    $0x2,%eax
+    41e5:	01 d0                	add    %edx,%eax
+    41e7:	01 c0                	add    %eax,%eax
+    41e9:	29 c1                	sub    %eax,%ecx
+    41eb:	89 ca                	mov    %ecx,%edx
+    41ed:	89 d0                	mov    %edx,%eax
+    41ef:	83 c0 30             	add    $0x30,%eax
+    41f2:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    41f5:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    41f9:	83 ec 0c             	sub    $0xc,%esp
+    41fc:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    41ff:	50                   	push   %eax
+    4200:	e8 14 04 00 00       	call   4619 <unlink>
+    4205:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    4208:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    420c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4210:	0f 89 1b ff ff ff    	jns    4131 <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    4216:	83 ec 08             	sub    $0x8,%esp
+    4219:	68 41 65 00 00       	push   $0x6541
+    421e:	6a 01                	push   $0x1
+    4220:	e8 50 05 00 00       	call   4775 <printf>
+    4225:	83 c4 10             	add    $0x10,%esp
+}
+    4228:	90                   	nop
+    4229:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    422c:	c9                   	leave
+    422d:	c3                   	ret
+
+0000422e <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    422e:	55                   	push   %ebp
+    422f:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    4231:	a1 7c 6d 00 00       	mov    0x6d7c,%eax
+    4236:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    423c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    4241:	a3 7c 6d 00 00       	mov    %eax,0x6d7c
+  return randstate;
+    4246:	a1 7c 6d 00 00       	mov    0x6d7c,%eax
+}
+    424b:	5d                   	pop    %ebp
+    424c:	c3                   	ret
+
+0000424d <main>:
+
+int
+main(int argc, char *argv[])
+{
+    424d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    4251:	83 e4 f0             	and    $0xfffffff0,%esp
+    4254:	ff 71 fc             	push   -0x4(%ecx)
+    4257:	55                   	push   %ebp
+    4258:	89 e5                	mov    %esp,%ebp
+    425a:	51                   	push   %ecx
+    425b:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    425e:	83 ec 08             	sub    $0x8,%esp
+    4261:	68 57 65 00 00       	push   $0x6557
+    4266:	6a 01                	push   $0x1
+    4268:	e8 08 05 00 00       	call   4775 <printf>
+    426d:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    4270:	83 ec 08             	sub    $0x8,%esp
+    4273:	6a 00                	push   $0x0
+    4275:	68 6b 65 00 00       	push   $0x656b
+    427a:	e8 8a 03 00 00       	call   4609 <open>
+    427f:	83 c4 10             	add    $0x10,%esp
+    4282:	85 c0                	test   %eax,%eax
+    4284:	78 17                	js     429d <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    4286:	83 ec 08             	sub    $0x8,%esp
+    4289:	68 7c 65 00 00       	push   $0x657c
+    428e:	6a 01                	push   $0x1
+    4290:	e8 e0 04 00 00       	call   4775 <printf>
+    4295:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4298:	e8 2c 03 00 00       	call   45c9 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    429d:	83 ec 08             	sub    $0x8,%esp
+    42a0:	68 00 02 00 00       	push   $0x200
+    42a5:	68 6b 65 00 00       	push   $0x656b
+    42aa:	e8 5a 03 00 00       	call   4609 <open>
+    42af:	83 c4 10             	add    $0x10,%esp
+    42b2:	83 ec 0c             	sub    $0xc,%esp
+    42b5:	50                   	push   %eax
+    42b6:	e8 36 03 00 00       	call   45f1 <close>
+    42bb:	83 c4 10             	add    $0x10,%esp
+
+  createdelete();
+    42be:	e8 f2 d2 ff ff       	call   15b5 <createdelete>
+  linkunlink();
+    42c3:	e8 17 dd ff ff       	call   1fdf <linkunlink>
+  concreate();
+    42c8:	e8 5e d9 ff ff       	call   1c2b <concreate>
+  fourfiles();
+    42cd:	e8 92 d0 ff ff       	call   1364 <fourfiles>
+  sharedfd();
+    42d2:	e8 aa ce ff ff       	call   1181 <sharedfd>
+
+  bigargtest();
+    42d7:	e8 6f fb ff ff       	call   3e4b <bigargtest>
+  bigwrite();
+    42dc:	e8 fa e6 ff ff       	call   29db <bigwrite>
+  bigargtest();
+    42e1:	e8 65 fb ff ff       	call   3e4b <bigargtest>
+  bsstest();
+    42e6:	e8 ea fa ff ff       	call   3dd5 <bsstest>
+  sbrktest();
+    42eb:	e8 e1 f3 ff ff       	call   36d1 <sbrktest>
+  validatetest();
+    42f0:	e8 02 fa ff ff       	call   3cf7 <validatetest>
+
+  opentest();
+    42f5:	e8 05 c0 ff ff       	call   2ff <opentest>
+  textbusytest();
+    42fa:	e8 af c0 ff ff       	call   3ae <textbusytest>
+  writetest();
+    42ff:	e8 b3 c3 ff ff       	call   6b7 <writetest>
+  writetest1();
+    4304:	e8 be c5 ff ff       	call   8c7 <writetest1>
+  createtest();
+    4309:	e8 b4 c7 ff ff       	call   ac2 <createtest>
+
+  openiputtest();
+    430e:	e8 dd be ff ff       	call   1f0 <openiputtest>
+  exitiputtest();
+    4313:	e8 d9 bd ff ff       	call   f1 <exitiputtest>
+  iputtest();
+    4318:	e8 e3 bc ff ff       	call   0 <iputtest>
+
+  mem();
+    431d:	e8 6e cd ff ff       	call   1090 <mem>
+  pipe1();
+    4322:	e8 a2 c9 ff ff       	call   cc9 <pipe1>
+  preempt();
+    4327:	e8 86 cb ff ff       	call   eb2 <preempt>
+  exitwait();
+    432c:	e8 e7 cc ff ff       	call   1018 <exitwait>
+
+  rmdot();
+    4331:	e8 da ed ff ff       	call   3110 <rmdot>
+  fourteen();
+    4336:	e8 79 ec ff ff       	call   2fb4 <fourteen>
+  bigfile();
+    433b:	e8 99 e7 ff ff       	call   2ad9 <bigfile>
+  fragtest();
+    4340:	e8 fb e9 ff ff       	call   2d40 <fragtest>
+  subdir();
+    4345:	e8 4d df ff ff       	call   2297 <subdir>
+  linktest();
+    434a:	e8 9a d6 ff ff       	call   19e9 <linktest>
+  unlinkread();
+    434f:	e8 d3 d4 ff ff       	call   1827 <unlinkread>
+  dirfile();
+    4354:	e8 3c ef ff ff       	call   3295 <dirfile>
+  iref();
+    4359:	e8 6f f1 ff ff       	call   34cd <iref>
+  forktest();
+    435e:	e8 a4 f2 ff ff       	call   3607 <forktest>
+  bigdir(); // slow
+    4363:	e8 ae dd ff ff       	call   2116 <bigdir>
+  exectest();
+    4368:	e8 09 c9 ff ff       	call   c76 <exectest>
+
+  exit();
+    436d:	e8 57 02 00 00       	call   45c9 <exit>
+
+00004372 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    4372:	55                   	push   %ebp
+    4373:	89 e5                	mov    %esp,%ebp
+    4375:	57                   	push   %edi
+    4376:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    4377:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    437a:	8b 55 10             	mov    0x10(%ebp),%edx
+    437d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4380:	89 cb                	mov    %ecx,%ebx
+    4382:	89 df                	mov    %ebx,%edi
+    4384:	89 d1                	mov    %edx,%ecx
+    4386:	fc                   	cld
+    4387:	f3 aa                	rep stos %al,%es:(%edi)
+    4389:	89 ca                	mov    %ecx,%edx
+    438b:	89 fb                	mov    %edi,%ebx
+    438d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    4390:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    4393:	90                   	nop
+    4394:	5b                   	pop    %ebx
+    4395:	5f                   	pop    %edi
+    4396:	5d                   	pop    %ebp
+    4397:	c3                   	ret
+
+00004398 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    4398:	55                   	push   %ebp
+    4399:	89 e5                	mov    %esp,%ebp
+    439b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    439e:	8b 45 08             	mov    0x8(%ebp),%eax
+    43a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    43a4:	90                   	nop
+    43a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+    43a8:	8d 42 01             	lea    0x1(%edx),%eax
+    43ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+    43ae:	8b 45 08             	mov    0x8(%ebp),%eax
+    43b1:	8d 48 01             	lea    0x1(%eax),%ecx
+    43b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    43b7:	0f b6 12             	movzbl (%edx),%edx
+    43ba:	88 10                	mov    %dl,(%eax)
+    43bc:	0f b6 00             	movzbl (%eax),%eax
+    43bf:	84 c0                	test   %al,%al
+    43c1:	75 e2                	jne    43a5 <strcpy+0xd>
+    ;
+  return os;
+    43c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    43c6:	c9                   	leave
+    43c7:	c3                   	ret
+
+000043c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    43c8:	55                   	push   %ebp
+    43c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    43cb:	eb 08                	jmp    43d5 <strcmp+0xd>
+    p++, q++;
+    43cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    43d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    43d5:	8b 45 08             	mov    0x8(%ebp),%eax
+    43d8:	0f b6 00             	movzbl (%eax),%eax
+    43db:	84 c0                	test   %al,%al
+    43dd:	74 10                	je     43ef <strcmp+0x27>
+    43df:	8b 45 08             	mov    0x8(%ebp),%eax
+    43e2:	0f b6 10             	movzbl (%eax),%edx
+    43e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43e8:	0f b6 00             	movzbl (%eax),%eax
+    43eb:	38 c2                	cmp    %al,%dl
+    43ed:	74 de                	je     43cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    43ef:	8b 45 08             	mov    0x8(%ebp),%eax
+    43f2:	0f b6 00             	movzbl (%eax),%eax
+    43f5:	0f b6 d0             	movzbl %al,%edx
+    43f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43fb:	0f b6 00             	movzbl (%eax),%eax
+    43fe:	0f b6 c0             	movzbl %al,%eax
+    4401:	29 c2                	sub    %eax,%edx
+    4403:	89 d0                	mov    %edx,%eax
+}
+    4405:	5d                   	pop    %ebp
+    4406:	c3                   	ret
+
+00004407 <strlen>:
+
+uint
+strlen(char *s)
+{
+    4407:	55                   	push   %ebp
+    4408:	89 e5                	mov    %esp,%ebp
+    440a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    440d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    4414:	eb 04                	jmp    441a <strlen+0x13>
+    4416:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    441a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    441d:	8b 45 08             	mov    0x8(%ebp),%eax
+    4420:	01 d0                	add    %edx,%eax
+    4422:	0f b6 00             	movzbl (%eax),%eax
+    4425:	84 c0                	test   %al,%al
+    4427:	75 ed                	jne    4416 <strlen+0xf>
+    ;
+  return n;
+    4429:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    442c:	c9                   	leave
+    442d:	c3                   	ret
+
+0000442e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    442e:	55                   	push   %ebp
+    442f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    4431:	8b 45 10             	mov    0x10(%ebp),%eax
+    4434:	50                   	push   %eax
+    4435:	ff 75 0c             	push   0xc(%ebp)
+    4438:	ff 75 08             	push   0x8(%ebp)
+    443b:	e8 32 ff ff ff       	call   4372 <stosb>
+    4440:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    4443:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4446:	c9                   	leave
+    4447:	c3                   	ret
+
+00004448 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4448:	55                   	push   %ebp
+    4449:	89 e5                	mov    %esp,%ebp
+    444b:	83 ec 04             	sub    $0x4,%esp
+    444e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4451:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    4454:	eb 14                	jmp    446a <strchr+0x22>
+    if(*s == c)
+    4456:	8b 45 08             	mov    0x8(%ebp),%eax
+    4459:	0f b6 00             	movzbl (%eax),%eax
+    445c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    445f:	75 05                	jne    4466 <strchr+0x1e>
+      return (char*)s;
+    4461:	8b 45 08             	mov    0x8(%ebp),%eax
+    4464:	eb 13                	jmp    4479 <strchr+0x31>
+  for(; *s; s++)
+    4466:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    446a:	8b 45 08             	mov    0x8(%ebp),%eax
+    446d:	0f b6 00             	movzbl (%eax),%eax
+    4470:	84 c0                	test   %al,%al
+    4472:	75 e2                	jne    4456 <strchr+0xe>
+  return 0;
+    4474:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    4479:	c9                   	leave
+    447a:	c3                   	ret
+
+0000447b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    447b:	55                   	push   %ebp
+    447c:	89 e5                	mov    %esp,%ebp
+    447e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    4481:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4488:	eb 42                	jmp    44cc <gets+0x51>
+    cc = read(0, &c, 1);
+    448a:	83 ec 04             	sub    $0x4,%esp
+    448d:	6a 01                	push   $0x1
+    448f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    4492:	50                   	push   %eax
+    4493:	6a 00                	push   $0x0
+    4495:	e8 47 01 00 00       	call   45e1 <read>
+    449a:	83 c4 10             	add    $0x10,%esp
+    449d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    44a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    44a4:	7e 33                	jle    44d9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    44a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    44a9:	8d 50 01             	lea    0x1(%eax),%edx
+    44ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    44af:	89 c2                	mov    %eax,%edx
+    44b1:	8b 45 08             	mov    0x8(%ebp),%eax
+    44b4:	01 c2                	add    %eax,%edx
+    44b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    44ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    44bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    44c0:	3c 0a                	cmp    $0xa,%al
+    44c2:	74 16                	je     44da <gets+0x5f>
+    44c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    44c8:	3c 0d                	cmp    $0xd,%al
+    44ca:	74 0e                	je     44da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    44cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    44cf:	83 c0 01             	add    $0x1,%eax
+    44d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    44d5:	7f b3                	jg     448a <gets+0xf>
+    44d7:	eb 01                	jmp    44da <gets+0x5f>
+      break;
+    44d9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    44da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    44dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    44e0:	01 d0                	add    %edx,%eax
+    44e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    44e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    44e8:	c9                   	leave
+    44e9:	c3                   	ret
+
+000044ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    44ea:	55                   	push   %ebp
+    44eb:	89 e5                	mov    %esp,%ebp
+    44ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    44f0:	83 ec 08             	sub    $0x8,%esp
+    44f3:	6a 00                	push   $0x0
+    44f5:	ff 75 08             	push   0x8(%ebp)
+    44f8:	e8 0c 01 00 00       	call   4609 <open>
+    44fd:	83 c4 10             	add    $0x10,%esp
+    4500:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    4503:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4507:	79 07                	jns    4510 <stat+0x26>
+    return -1;
+    4509:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    450e:	eb 25                	jmp    4535 <stat+0x4b>
+  r = fstat(fd, st);
+    4510:	83 ec 08             	sub    $0x8,%esp
+    4513:	ff 75 0c             	push   0xc(%ebp)
+    4516:	ff 75 f4             	push   -0xc(%ebp)
+    4519:	e8 03 01 00 00       	call   4621 <fstat>
+    451e:	83 c4 10             	add    $0x10,%esp
+    4521:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    4524:	83 ec 0c             	sub    $0xc,%esp
+    4527:	ff 75 f4             	push   -0xc(%ebp)
+    452a:	e8 c2 00 00 00       	call   45f1 <close>
+    452f:	83 c4 10             	add    $0x10,%esp
+  return r;
+    4532:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    4535:	c9                   	leave
+    4536:	c3                   	ret
+
+00004537 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4537:	55                   	push   %ebp
+    4538:	89 e5                	mov    %esp,%ebp
+    453a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    453d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4544:	eb 25                	jmp    456b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    4546:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4549:	89 d0                	mov    %edx,%eax
+    454b:	c1 e0 02             	shl    $0x2,%eax
+    454e:	01 d0                	add    %edx,%eax
+    4550:	01 c0                	add    %eax,%eax
+    4552:	89 c1                	mov    %eax,%ecx
+    4554:	8b 45 08             	mov    0x8(%ebp),%eax
+    4557:	8d 50 01             	lea    0x1(%eax),%edx
+    455a:	89 55 08             	mov    %edx,0x8(%ebp)
+    455d:	0f b6 00             	movzbl (%eax),%eax
+    4560:	0f be c0             	movsbl %al,%eax
+    4563:	01 c8                	add    %ecx,%eax
+    4565:	83 e8 30             	sub    $0x30,%eax
+    4568:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    456b:	8b 45 08             	mov    0x8(%ebp),%eax
+    456e:	0f b6 00             	movzbl (%eax),%eax
+    4571:	3c 2f                	cmp    $0x2f,%al
+    4573:	7e 0a                	jle    457f <atoi+0x48>
+    4575:	8b 45 08             	mov    0x8(%ebp),%eax
+    4578:	0f b6 00             	movzbl (%eax),%eax
+    457b:	3c 39                	cmp    $0x39,%al
+    457d:	7e c7                	jle    4546 <atoi+0xf>
+  return n;
+    457f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4582:	c9                   	leave
+    4583:	c3                   	ret
+
+00004584 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    4584:	55                   	push   %ebp
+    4585:	89 e5                	mov    %esp,%ebp
+    4587:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    458a:	8b 45 08             	mov    0x8(%ebp),%eax
+    458d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    4590:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4593:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    4596:	eb 17                	jmp    45af <memmove+0x2b>
+    *dst++ = *src++;
+    4598:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    459b:	8d 42 01             	lea    0x1(%edx),%eax
+    459e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    45a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    45a4:	8d 48 01             	lea    0x1(%eax),%ecx
+    45a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    45aa:	0f b6 12             	movzbl (%edx),%edx
+    45ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    45af:	8b 45 10             	mov    0x10(%ebp),%eax
+    45b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+    45b5:	89 55 10             	mov    %edx,0x10(%ebp)
+    45b8:	85 c0                	test   %eax,%eax
+    45ba:	7f dc                	jg     4598 <memmove+0x14>
+  return vdst;
+    45bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    45bf:	c9                   	leave
+    45c0:	c3                   	ret
+
+000045c1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    45c1:	b8 01 00 00 00       	mov    $0x1,%eax
+    45c6:	cd 40                	int    $0x40
+    45c8:	c3                   	ret
+
+000045c9 <exit>:
+SYSCALL(exit)
+    45c9:	b8 02 00 00 00       	mov    $0x2,%eax
+    45ce:	cd 40                	int    $0x40
+    45d0:	c3                   	ret
+
+000045d1 <wait>:
+SYSCALL(wait)
+    45d1:	b8 03 00 00 00       	mov    $0x3,%eax
+    45d6:	cd 40                	int    $0x40
+    45d8:	c3                   	ret
+
+000045d9 <pipe>:
+SYSCALL(pipe)
+    45d9:	b8 04 00 00 00       	mov    $0x4,%eax
+    45de:	cd 40                	int    $0x40
+    45e0:	c3                   	ret
+
+000045e1 <read>:
+SYSCALL(read)
+    45e1:	b8 05 00 00 00       	mov    $0x5,%eax
+    45e6:	cd 40                	int    $0x40
+    45e8:	c3                   	ret
+
+000045e9 <write>:
+SYSCALL(write)
+    45e9:	b8 10 00 00 00       	mov    $0x10,%eax
+    45ee:	cd 40                	int    $0x40
+    45f0:	c3                   	ret
+
+000045f1 <close>:
+SYSCALL(close)
+    45f1:	b8 15 00 00 00       	mov    $0x15,%eax
+    45f6:	cd 40                	int    $0x40
+    45f8:	c3                   	ret
+
+000045f9 <kill>:
+SYSCALL(kill)
+    45f9:	b8 06 00 00 00       	mov    $0x6,%eax
+    45fe:	cd 40                	int    $0x40
+    4600:	c3                   	ret
+
+00004601 <exec>:
+SYSCALL(exec)
+    4601:	b8 07 00 00 00       	mov    $0x7,%eax
+    4606:	cd 40                	int    $0x40
+    4608:	c3                   	ret
+
+00004609 <open>:
+SYSCALL(open)
+    4609:	b8 0f 00 00 00       	mov    $0xf,%eax
+    460e:	cd 40                	int    $0x40
+    4610:	c3                   	ret
+
+00004611 <mknod>:
+SYSCALL(mknod)
+    4611:	b8 11 00 00 00       	mov    $0x11,%eax
+    4616:	cd 40                	int    $0x40
+    4618:	c3                   	ret
+
+00004619 <unlink>:
+SYSCALL(unlink)
+    4619:	b8 12 00 00 00       	mov    $0x12,%eax
+    461e:	cd 40                	int    $0x40
+    4620:	c3                   	ret
+
+00004621 <fstat>:
+SYSCALL(fstat)
+    4621:	b8 08 00 00 00       	mov    $0x8,%eax
+    4626:	cd 40                	int    $0x40
+    4628:	c3                   	ret
+
+00004629 <link>:
+SYSCALL(link)
+    4629:	b8 13 00 00 00       	mov    $0x13,%eax
+    462e:	cd 40                	int    $0x40
+    4630:	c3                   	ret
+
+00004631 <mkdir>:
+SYSCALL(mkdir)
+    4631:	b8 14 00 00 00       	mov    $0x14,%eax
+    4636:	cd 40                	int    $0x40
+    4638:	c3                   	ret
+
+00004639 <chdir>:
+SYSCALL(chdir)
+    4639:	b8 09 00 00 00       	mov    $0x9,%eax
+    463e:	cd 40                	int    $0x40
+    4640:	c3                   	ret
+
+00004641 <dup>:
+SYSCALL(dup)
+    4641:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4646:	cd 40                	int    $0x40
+    4648:	c3                   	ret
+
+00004649 <getpid>:
+SYSCALL(getpid)
+    4649:	b8 0b 00 00 00       	mov    $0xb,%eax
+    464e:	cd 40                	int    $0x40
+    4650:	c3                   	ret
+
+00004651 <sbrk>:
+SYSCALL(sbrk)
+    4651:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4656:	cd 40                	int    $0x40
+    4658:	c3                   	ret
+
+00004659 <sleep>:
+SYSCALL(sleep)
+    4659:	b8 0d 00 00 00       	mov    $0xd,%eax
+    465e:	cd 40                	int    $0x40
+    4660:	c3                   	ret
+
+00004661 <uptime>:
+SYSCALL(uptime)
+    4661:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4666:	cd 40                	int    $0x40
+    4668:	c3                   	ret
+
+00004669 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+    4669:	b8 16 00 00 00       	mov    $0x16,%eax
+    466e:	cd 40                	int    $0x40
+    4670:	c3                   	ret
+
+00004671 <getschedstat>:
+SYSCALL(getschedstat)
+    4671:	b8 17 00 00 00       	mov    $0x17,%eax
+    4676:	cd 40                	int    $0x40
+    4678:	c3                   	ret
+
+00004679 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+    4679:	b8 18 00 00 00       	mov    $0x18,%eax
+    467e:	cd 40                	int    $0x40
+    4680:	c3                   	ret
+
+00004681 <setshare>:
+SYSCALL(setshare)
+    4681:	b8 19 00 00 00       	mov    $0x19,%eax
+    4686:	cd 40                	int    $0x40
+    4688:	c3                   	ret
+
+00004689 <getbcachestat>:
+SYSCALL(getbcachestat)
+    4689:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    468e:	cd 40                	int    $0x40
+    4690:	c3                   	ret
+
+00004691 <getdiskstat>:
+SYSCALL(getdiskstat)
+    4691:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4696:	cd 40                	int    $0x40
+    4698:	c3                   	ret
+
+00004699 <getlogstat>:
+SYSCALL(getlogstat)
+    4699:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    469e:	cd 40                	int    $0x40
+    46a0:	c3                   	ret
+
+000046a1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    46a1:	55                   	push   %ebp
+    46a2:	89 e5                	mov    %esp,%ebp
+    46a4:	83 ec 18             	sub    $0x18,%esp
+    46a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    46aa:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    46ad:	83 ec 04             	sub    $0x4,%esp
+    46b0:	6a 01                	push   $0x1
+    46b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    46b5:	50                   	push   %eax
+    46b6:	ff 75 08             	push   0x8(%ebp)
+    46b9:	e8 2b ff ff ff       	call   45e9 <write>
+    46be:	83 c4 10             	add    $0x10,%esp
+}
+    46c1:	90                   	nop
+    46c2:	c9                   	leave
+    46c3:	c3                   	ret
+
+000046c4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    46c4:	55                   	push   %ebp
+    46c5:	89 e5                	mov    %esp,%ebp
+    46c7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    46ca:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    46d1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    46d5:	74 17                	je     46ee <printint+0x2a>
+    46d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    46db:	79 11                	jns    46ee <printint+0x2a>
+    neg = 1;
+    46dd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    46e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    46e7:	f7 d8                	neg    %eax
+    46e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    46ec:	eb 06                	jmp    46f4 <printint+0x30>
+  } else {
+    x = xx;
+    46ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+    46f1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    46f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    46fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    46fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4701:	ba 00 00 00 00       	mov    $0x0,%edx
+    4706:	f7 f1                	div    %ecx
+    4708:	89 d1                	mov    %edx,%ecx
+    470a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    470d:	8d 50 01             	lea    0x1(%eax),%edx
+    4710:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4713:	0f b6 91 80 6d 00 00 	movzbl 0x6d80(%ecx),%edx
+    471a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    471e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4721:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4724:	ba 00 00 00 00       	mov    $0x0,%edx
+    4729:	f7 f1                	div    %ecx
+    472b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    472e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4732:	75 c7                	jne    46fb <printint+0x37>
+  if(neg)
+    4734:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4738:	74 2d                	je     4767 <printint+0xa3>
+    buf[i++] = '-';
+    473a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    473d:	8d 50 01             	lea    0x1(%eax),%edx
+    4740:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4743:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    4748:	eb 1d                	jmp    4767 <printint+0xa3>
+    putc(fd, buf[i]);
+    474a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    474d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4750:	01 d0                	add    %edx,%eax
+    4752:	0f b6 00             	movzbl (%eax),%eax
+    4755:	0f be c0             	movsbl %al,%eax
+    4758:	83 ec 08             	sub    $0x8,%esp
+    475b:	50                   	push   %eax
+    475c:	ff 75 08             	push   0x8(%ebp)
+    475f:	e8 3d ff ff ff       	call   46a1 <putc>
+    4764:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    4767:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    476b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    476f:	79 d9                	jns    474a <printint+0x86>
+}
+    4771:	90                   	nop
+    4772:	90                   	nop
+    4773:	c9                   	leave
+    4774:	c3                   	ret
+
+00004775 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    4775:	55                   	push   %ebp
+    4776:	89 e5                	mov    %esp,%ebp
+    4778:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    477b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    4782:	8d 45 0c             	lea    0xc(%ebp),%eax
+    4785:	83 c0 04             	add    $0x4,%eax
+    4788:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    478b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4792:	e9 59 01 00 00       	jmp    48f0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    4797:	8b 55 0c             	mov    0xc(%ebp),%edx
+    479a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    479d:	01 d0                	add    %edx,%eax
+    479f:	0f b6 00             	movzbl (%eax),%eax
+    47a2:	0f be c0             	movsbl %al,%eax
+    47a5:	25 ff 00 00 00       	and    $0xff,%eax
+    47aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    47ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    47b1:	75 2c                	jne    47df <printf+0x6a>
+      if(c == '%'){
+    47b3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    47b7:	75 0c                	jne    47c5 <printf+0x50>
+        state = '%';
+    47b9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    47c0:	e9 27 01 00 00       	jmp    48ec <printf+0x177>
+      } else {
+        putc(fd, c);
+    47c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    47c8:	0f be c0             	movsbl %al,%eax
+    47cb:	83 ec 08             	sub    $0x8,%esp
+    47ce:	50                   	push   %eax
+    47cf:	ff 75 08             	push   0x8(%ebp)
+    47d2:	e8 ca fe ff ff       	call   46a1 <putc>
+    47d7:	83 c4 10             	add    $0x10,%esp
+    47da:	e9 0d 01 00 00       	jmp    48ec <printf+0x177>
+      }
+    } else if(state == '%'){
+    47df:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    47e3:	0f 85 03 01 00 00    	jne    48ec <printf+0x177>
+      if(c == 'd'){
+    47e9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    47ed:	75 1e                	jne    480d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    47ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    47f2:	8b 00                	mov    (%eax),%eax
+    47f4:	6a 01                	push   $0x1
+    47f6:	6a 0a                	push   $0xa
+    47f8:	50                   	push   %eax
+    47f9:	ff 75 08             	push   0x8(%ebp)
+    47fc:	e8 c3 fe ff ff       	call   46c4 <printint>
+    4801:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4804:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4808:	e9 d8 00 00 00       	jmp    48e5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    480d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    4811:	74 06                	je     4819 <printf+0xa4>
+    4813:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    4817:	75 1e                	jne    4837 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    4819:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    481c:	8b 00                	mov    (%eax),%eax
+    481e:	6a 00                	push   $0x0
+    4820:	6a 10                	push   $0x10
+    4822:	50                   	push   %eax
+    4823:	ff 75 08             	push   0x8(%ebp)
+    4826:	e8 99 fe ff ff       	call   46c4 <printint>
+    482b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    482e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4832:	e9 ae 00 00 00       	jmp    48e5 <printf+0x170>
+      } else if(c == 's'){
+    4837:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    483b:	75 43                	jne    4880 <printf+0x10b>
+        s = (char*)*ap;
+    483d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4840:	8b 00                	mov    (%eax),%eax
+    4842:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    4845:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    4849:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    484d:	75 25                	jne    4874 <printf+0xff>
+          s = "(null)";
+    484f:	c7 45 f4 a6 65 00 00 	movl   $0x65a6,-0xc(%ebp)
+        while(*s != 0){
+    4856:	eb 1c                	jmp    4874 <printf+0xff>
+          putc(fd, *s);
+    4858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    485b:	0f b6 00             	movzbl (%eax),%eax
+    485e:	0f be c0             	movsbl %al,%eax
+    4861:	83 ec 08             	sub    $0x8,%esp
+    4864:	50                   	push   %eax
+    4865:	ff 75 08             	push   0x8(%ebp)
+    4868:	e8 34 fe ff ff       	call   46a1 <putc>
+    486d:	83 c4 10             	add    $0x10,%esp
+          s++;
+    4870:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    4874:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4877:	0f b6 00             	movzbl (%eax),%eax
+    487a:	84 c0                	test   %al,%al
+    487c:	75 da                	jne    4858 <printf+0xe3>
+    487e:	eb 65                	jmp    48e5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    4880:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    4884:	75 1d                	jne    48a3 <printf+0x12e>
+        putc(fd, *ap);
+    4886:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4889:	8b 00                	mov    (%eax),%eax
+    488b:	0f be c0             	movsbl %al,%eax
+    488e:	83 ec 08             	sub    $0x8,%esp
+    4891:	50                   	push   %eax
+    4892:	ff 75 08             	push   0x8(%ebp)
+    4895:	e8 07 fe ff ff       	call   46a1 <putc>
+    489a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    489d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    48a1:	eb 42                	jmp    48e5 <printf+0x170>
+      } else if(c == '%'){
+    48a3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    48a7:	75 17                	jne    48c0 <printf+0x14b>
+        putc(fd, c);
+    48a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    48ac:	0f be c0             	movsbl %al,%eax
+    48af:	83 ec 08             	sub    $0x8,%esp
+    48b2:	50                   	push   %eax
+    48b3:	ff 75 08             	push   0x8(%ebp)
+    48b6:	e8 e6 fd ff ff       	call   46a1 <putc>
+    48bb:	83 c4 10             	add    $0x10,%esp
+    48be:	eb 25                	jmp    48e5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    48c0:	83 ec 08             	sub    $0x8,%esp
+    48c3:	6a 25                	push   $0x25
+    48c5:	ff 75 08             	push   0x8(%ebp)
+    48c8:	e8 d4 fd ff ff       	call   46a1 <putc>
+    48cd:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    48d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    48d3:	0f be c0             	movsbl %al,%eax
+    48d6:	83 ec 08             	sub    $0x8,%esp
+    48d9:	50                   	push   %eax
+    48da:	ff 75 08             	push   0x8(%ebp)
+    48dd:	e8 bf fd ff ff       	call   46a1 <putc>
+    48e2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    48e5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    48ec:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    48f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    48f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    48f6:	01 d0                	add    %edx,%eax
+    48f8:	0f b6 00             	movzbl (%eax),%eax
+    48fb:	84 c0                	test   %al,%al
+    48fd:	0f 85 94 fe ff ff    	jne    4797 <printf+0x22>
+    }
+  }
+}
+    4903:	90                   	nop
+    4904:	90                   	nop
+    4905:	c9                   	leave
+    4906:	c3                   	ret
+
+00004907 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4907:	55                   	push   %ebp
+    4908:	89 e5                	mov    %esp,%ebp
+    490a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    490d:	8b 45 08             	mov    0x8(%ebp),%eax
+    4910:	83 e8 08             	sub    $0x8,%eax
+    4913:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4916:	a1 68 b5 00 00       	mov    0xb568,%eax
+    491b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    491e:	eb 24                	jmp    4944 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4920:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4923:	8b 00                	mov    (%eax),%eax
+    4925:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4928:	72 12                	jb     493c <free+0x35>
+    492a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    492d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4930:	72 24                	jb     4956 <free+0x4f>
+    4932:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4935:	8b 00                	mov    (%eax),%eax
+    4937:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    493a:	72 1a                	jb     4956 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    493c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    493f:	8b 00                	mov    (%eax),%eax
+    4941:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    4944:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4947:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    494a:	73 d4                	jae    4920 <free+0x19>
+    494c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    494f:	8b 00                	mov    (%eax),%eax
+    4951:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    4954:	73 ca                	jae    4920 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4956:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4959:	8b 40 04             	mov    0x4(%eax),%eax
+    495c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    4963:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4966:	01 c2                	add    %eax,%edx
+    4968:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    496b:	8b 00                	mov    (%eax),%eax
+    496d:	39 c2                	cmp    %eax,%edx
+    496f:	75 24                	jne    4995 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    4971:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4974:	8b 50 04             	mov    0x4(%eax),%edx
+    4977:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    497a:	8b 00                	mov    (%eax),%eax
+    497c:	8b 40 04             	mov    0x4(%eax),%eax
+    497f:	01 c2                	add    %eax,%edx
+    4981:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4984:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4987:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    498a:	8b 00                	mov    (%eax),%eax
+    498c:	8b 10                	mov    (%eax),%edx
+    498e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4991:	89 10                	mov    %edx,(%eax)
+    4993:	eb 0a                	jmp    499f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    4995:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4998:	8b 10                	mov    (%eax),%edx
+    499a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    499d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    499f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49a2:	8b 40 04             	mov    0x4(%eax),%eax
+    49a5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    49ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49af:	01 d0                	add    %edx,%eax
+    49b1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    49b4:	75 20                	jne    49d6 <free+0xcf>
+    p->s.size += bp->s.size;
+    49b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49b9:	8b 50 04             	mov    0x4(%eax),%edx
+    49bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    49bf:	8b 40 04             	mov    0x4(%eax),%eax
+    49c2:	01 c2                	add    %eax,%edx
+    49c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49c7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    49ca:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    49cd:	8b 10                	mov    (%eax),%edx
+    49cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49d2:	89 10                	mov    %edx,(%eax)
+    49d4:	eb 08                	jmp    49de <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    49d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49d9:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    49dc:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    49de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49e1:	a3 68 b5 00 00       	mov    %eax,0xb568
+}
+    49e6:	90                   	nop
+    49e7:	c9                   	leave
+    49e8:	c3                   	ret
+
+000049e9 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    49e9:	55                   	push   %ebp
+    49ea:	89 e5                	mov    %esp,%ebp
+    49ec:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    49ef:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    49f6:	77 07                	ja     49ff <morecore+0x16>
+    nu = 4096;
+    49f8:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    49ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    4a02:	c1 e0 03             	shl    $0x3,%eax
+    4a05:	83 ec 0c             	sub    $0xc,%esp
+    4a08:	50                   	push   %eax
+    4a09:	e8 43 fc ff ff       	call   4651 <sbrk>
+    4a0e:	83 c4 10             	add    $0x10,%esp
+    4a11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    4a14:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    4a18:	75 07                	jne    4a21 <morecore+0x38>
+    return 0;
+    4a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+    4a1f:	eb 26                	jmp    4a47 <morecore+0x5e>
+  hp = (Header*)p;
+    4a21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4a24:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    4a27:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a2a:	8b 55 08             	mov    0x8(%ebp),%edx
+    4a2d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    4a30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a33:	83 c0 08             	add    $0x8,%eax
+    4a36:	83 ec 0c             	sub    $0xc,%esp
+    4a39:	50                   	push   %eax
+    4a3a:	e8 c8 fe ff ff       	call   4907 <free>
+    4a3f:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    4a42:	a1 68 b5 00 00       	mov    0xb568,%eax
+}
+    4a47:	c9                   	leave
+    4a48:	c3                   	ret
+
+00004a49 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    4a49:	55                   	push   %ebp
+    4a4a:	89 e5                	mov    %esp,%ebp
+    4a4c:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4a4f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4a52:	83 c0 07             	add    $0x7,%eax
+    4a55:	c1 e8 03             	shr    $0x3,%eax
+    4a58:	83 c0 01             	add    $0x1,%eax
+    4a5b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    4a5e:	a1 68 b5 00 00       	mov    0xb568,%eax
+    4a63:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4a66:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4a6a:	75 23                	jne    4a8f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    4a6c:	c7 45 f0 60 b5 00 00 	movl   $0xb560,-0x10(%ebp)
+    4a73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a76:	a3 68 b5 00 00       	mov    %eax,0xb568
+    4a7b:	a1 68 b5 00 00       	mov    0xb568,%eax
+    4a80:	a3 60 b5 00 00       	mov    %eax,0xb560
+    base.s.size = 0;
+    4a85:	c7 05 64 b5 00 00 00 	movl   $0x0,0xb564
+    4a8c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4a8f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a92:	8b 00                	mov    (%eax),%eax
+    4a94:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4a97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4a9a:	8b 40 04             	mov    0x4(%eax),%eax
+    4a9d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    4aa0:	72 4d                	jb     4aef <malloc+0xa6>
+      if(p->s.size == nunits)
+    4aa2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4aa5:	8b 40 04             	mov    0x4(%eax),%eax
+    4aa8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    4aab:	75 0c                	jne    4ab9 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    4aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4ab0:	8b 10                	mov    (%eax),%edx
+    4ab2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4ab5:	89 10                	mov    %edx,(%eax)
+    4ab7:	eb 26                	jmp    4adf <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    4ab9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4abc:	8b 40 04             	mov    0x4(%eax),%eax
+    4abf:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    4ac2:	89 c2                	mov    %eax,%edx
+    4ac4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4ac7:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    4aca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4acd:	8b 40 04             	mov    0x4(%eax),%eax
+    4ad0:	c1 e0 03             	shl    $0x3,%eax
+    4ad3:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    4ad6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4ad9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    4adc:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    4adf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4ae2:	a3 68 b5 00 00       	mov    %eax,0xb568
+      return (void*)(p + 1);
+    4ae7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4aea:	83 c0 08             	add    $0x8,%eax
+    4aed:	eb 3b                	jmp    4b2a <malloc+0xe1>
+    }
+    if(p == freep)
+    4aef:	a1 68 b5 00 00       	mov    0xb568,%eax
+    4af4:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    4af7:	75 1e                	jne    4b17 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    4af9:	83 ec 0c             	sub    $0xc,%esp
+    4afc:	ff 75 ec             	push   -0x14(%ebp)
+    4aff:	e8 e5 fe ff ff       	call   49e9 <morecore>
+    4b04:	83 c4 10             	add    $0x10,%esp
+    4b07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4b0a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4b0e:	75 07                	jne    4b17 <malloc+0xce>
+        return 0;
+    4b10:	b8 00 00 00 00       	mov    $0x0,%eax
+    4b15:	eb 13                	jmp    4b2a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    4b1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b20:	8b 00                	mov    (%eax),%eax
+    4b22:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    4b25:	e9 6d ff ff ff       	jmp    4a97 <malloc+0x4e>
+  }
+}
+    4b2a:	c9                   	leave
+    4b2b:	c3                   	ret
+
+00004b2c <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+    4b2c:	55                   	push   %ebp
+    4b2d:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+    4b2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b32:	3b 45 08             	cmp    0x8(%ebp),%eax
+    4b35:	7e 08                	jle    4b3f <ticks+0x13>
+    4b37:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b3a:	2b 45 08             	sub    0x8(%ebp),%eax
+    4b3d:	eb 05                	jmp    4b44 <ticks+0x18>
+    4b3f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    4b44:	5d                   	pop    %ebp
+    4b45:	c3                   	ret
+
+00004b46 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+    4b46:	55                   	push   %ebp
+    4b47:	89 e5                	mov    %esp,%ebp
+    4b49:	53                   	push   %ebx
+    4b4a:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+    4b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+    4b50:	6b d8 64             	imul   $0x64,%eax,%ebx
+    4b53:	ff 75 14             	push   0x14(%ebp)
+    4b56:	ff 75 10             	push   0x10(%ebp)
+    4b59:	e8 ce ff ff ff       	call   4b2c <ticks>
+    4b5e:	83 c4 08             	add    $0x8,%esp
+    4b61:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+    4b63:	89 d8                	mov    %ebx,%eax
+    4b65:	99                   	cltd
+    4b66:	f7 f9                	idiv   %ecx
+    4b68:	89 c2                	mov    %eax,%edx
+    4b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+    4b6d:	2b 45 10             	sub    0x10(%ebp),%eax
+    4b70:	83 ec 04             	sub    $0x4,%esp
+    4b73:	ff 75 0c             	push   0xc(%ebp)
+    4b76:	52                   	push   %edx
+    4b77:	50                   	push   %eax
+    4b78:	ff 75 0c             	push   0xc(%ebp)
+    4b7b:	ff 75 08             	push   0x8(%ebp)
+    4b7e:	68 b0 65 00 00       	push   $0x65b0
+    4b83:	6a 01                	push   $0x1
+    4b85:	e8 eb fb ff ff       	call   4775 <printf>
+    4b8a:	83 c4 20             	add    $0x20,%esp
+}
+    4b8d:	90                   	nop
+    4b8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4b91:	c9                   	leave
+    4b92:	c3                   	ret
+
+00004b93 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+    4b93:	55                   	push   %ebp
+    4b94:	89 e5                	mov    %esp,%ebp
+    4b96:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+    4b99:	ff 75 14             	push   0x14(%ebp)
+    4b9c:	ff 75 10             	push   0x10(%ebp)
+    4b9f:	e8 88 ff ff ff       	call   4b2c <ticks>
+    4ba4:	83 c4 08             	add    $0x8,%esp
+    4ba7:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+    4bad:	99                   	cltd
+    4bae:	f7 7d 08             	idivl  0x8(%ebp)
+    4bb1:	89 c2                	mov    %eax,%edx
+    4bb3:	8b 45 14             	mov    0x14(%ebp),%eax
+    4bb6:	2b 45 10             	sub    0x10(%ebp),%eax
+    4bb9:	83 ec 08             	sub    $0x8,%esp
+    4bbc:	52                   	push   %edx
+    4bbd:	50                   	push   %eax
+    4bbe:	ff 75 0c             	push   0xc(%ebp)
+    4bc1:	ff 75 08             	push   0x8(%ebp)
+    4bc4:	68 d0 65 00 00       	push   $0x65d0
+    4bc9:	6a 01                	push   $0x1
+    4bcb:	e8 a5 fb ff ff       	call   4775 <printf>
+    4bd0:	83 c4 20             	add    $0x20,%esp
+}
+    4bd3:	90                   	nop
+    4bd4:	c9                   	leave
+    4bd5:	c3                   	ret
@@ -135,6 +135,75 @@ opentest(void)
   printf(stdout, "open test ok\n");
 }
 
+// A running program pages its text in from its executable,
+// which must not change under it: the executable can be
+// neither opened for writing nor written through a descriptor
+// opened before the program started, until it exits.
+void
+textbusytest(void)
+{
+  int fd, src, n, in[2], out[2];
+  char c, *args[] = { "textcopy", 0 };
+
+  printf(stdout, "text busy test\n");
+  if(open("usertests", O_RDWR) >= 0){
+    printf(stdout, "opened running usertests for writing!\n");
+    exit();
+  }
+
+  // Run a copy of cat that echoes one pipe to another while
+  // the copy is still open for writing.
+  src = open("cat", O_RDONLY);
+  fd = open("textcopy", O_CREATE|O_RDWR);
+  if(src < 0 || fd < 0){
+    printf(stdout, "cannot copy cat\n");
+    exit();
+  }
+  while((n = read(src, buf, sizeof(buf))) > 0)
+    write(fd, buf, n);
+  close(src);
+  if(pipe(in) < 0 || pipe(out) < 0){
+    printf(stdout, "pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(0);
+    dup(in[0]);
+    close(1);
+    dup(out[1]);
+    close(in[0]);
+    close(in[1]);
+    close(out[0]);
+    close(out[1]);
+    close(fd);
+    exec("textcopy", args);
+    exit();
+  }
+  close(in[0]);
+  close(out[1]);
+
+  // Once it echoes a byte, it is running from textcopy.
+  write(in[1], "x", 1);
+  if(read(out[0], &c, 1) != 1){
+    printf(stdout, "textcopy did not run\n");
+    exit();
+  }
+  if(write(fd, "x", 1) >= 0){
+    printf(stdout, "wrote running textcopy!\n");
+    exit();
+  }
+  close(in[1]);
+  wait();
+  close(out[0]);
+  if(write(fd, "x", 1) != 1){
+    printf(stdout, "cannot write textcopy after it exited\n");
+    exit();
+  }
+  close(fd);
+  unlink("textcopy");
+  printf(stdout, "text busy test ok\n");
+}
+
 void
 writetest(void)
 {
@@ -184,6 +253,10 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// 1 MB, far past the old 140-block limit on file size but
+// well within the free space of kernelmemfs's disk.
+#define NBIGBLOCK 2048
+
 void
 writetest1(void)
 {
@@ -197,7 +270,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < NBIGBLOCK; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,8 +290,8 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
-        printf(stdout, "read only %d blocks from big", n);
+      if(n != NBIGBLOCK){
+        printf(stdout, "read only %d blocks from big\n", n);
         exit();
       }
       break;
@@ -1144,10 +1217,14 @@ bigwrite(void)
   printf(1, "bigwrite ok\n");
 }
 
+// A 2 MB file, written in 600-byte pieces that straddle
+// block boundaries.
+#define NBIG (2*1024*1024 / 600)
+
 void
 bigfile(void)
 {
-  int fd, i, total, cc;
+  int fd, i, total, cc, t0, t1, t2;
 
   printf(1, "bigfile test\n");
 
@@ -1157,7 +1234,8 @@ bigfile(void)
     printf(1, "cannot create bigfile");
     exit();
   }
-  for(i = 0; i < 20; i++){
+  t0 = uptime();
+  for(i = 0; i < NBIG; i++){
     memset(buf, i, 600);
     if(write(fd, buf, 600) != 600){
       printf(1, "write bigfile failed\n");
@@ -1165,6 +1243,7 @@ bigfile(void)
     }
   }
   close(fd);
+  t1 = uptime();
 
   fd = open("bigfile", 0);
   if(fd < 0){
@@ -1184,22 +1263,90 @@ bigfile(void)
       printf(1, "short read bigfile\n");
       exit();
     }
-    if(buf[0] != i/2 || buf[299] != i/2){
+    if(buf[0] != (char)(i/2) || buf[299] != (char)(i/2)){
       printf(1, "read bigfile wrong data\n");
       exit();
     }
     total += cc;
   }
   close(fd);
-  if(total != 20*600){
+  t2 = uptime();
+  if(total != NBIG*600){
     printf(1, "read bigfile wrong total\n");
     exit();
   }
   unlink("bigfile");
 
+  printf(1, "bigfile %d KB: write %d ticks, read %d ticks\n",
+         total / 1024, t1 - t0, t2 - t1);
   printf(1, "bigfile test ok\n");
 }
 
+// Appending a block to each of two files in turn leaves neither
+// file's blocks contiguous, so each block becomes an extent of
+// its own.  NFRAG extents fill the inode's, those in xaddrs[0]
+// and two of the extent blocks that xaddrs[1] lists.  The
+// second round reuses the blocks the first one freed, which
+// would trip balloc's and bfree's checks if itrunc freed them
+// wrongly.
+#define NFRAG (NEXTENT + NXPB + 2*NXPB)
+
+void
+fragtest(void)
+{
+  int fd[2], round, i, j;
+  char name[3];
+
+  printf(1, "fragmented file test\n");
+
+  name[0] = 'x';
+  name[2] = '\0';
+  for(round = 0; round < 2; round++){
+    for(j = 0; j < 2; j++){
+      name[1] = '0' + j;
+      unlink(name);
+      if((fd[j] = open(name, O_CREATE | O_RDWR)) < 0){
+        printf(1, "cannot create %s\n", name);
+        exit();
+      }
+    }
+    for(i = 0; i < NFRAG; i++){
+      for(j = 0; j < 2; j++){
+        ((int*)buf)[0] = i;
+        ((int*)buf)[1] = j;
+        if(write(fd[j], buf, 512) != 512){
+          printf(1, "write fragmented file failed at block %d\n", i);
+          exit();
+        }
+      }
+    }
+    for(j = 0; j < 2; j++){
+      close(fd[j]);
+      name[1] = '0' + j;
+      if((fd[j] = open(name, O_RDONLY)) < 0){
+        printf(1, "cannot open %s\n", name);
+        exit();
+      }
+      for(i = 0; read(fd[j], buf, 512) == 512; i++){
+        if(((int*)buf)[0] != i || ((int*)buf)[1] != j){
+          printf(1, "%s block %d has wrong data\n", name, i);
+          exit();
+        }
+      }
+      if(i != NFRAG){
+        printf(1, "read %d blocks of %s\n", i, name);
+        exit();
+      }
+      close(fd[j]);
+      if(unlink(name) < 0){
+        printf(1, "unlink %s failed\n", name);
+        exit();
+      }
+    }
+  }
+  printf(1, "fragmented file test ok\n");
+}
+
 void
 fourteen(void)
 {
@@ -1492,7 +1639,28 @@ sbrktest(void)
     printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
     exit();
   }
-  
+
+  // untouched heap reads as zeros, from user space and through
+  // write(), and stays zero elsewhere once a page of it is written.
+  p = sbrk(2*4096);
+  if(pipe(fds) != 0){
+    printf(stdout, "pipe() failed\n");
+    exit();
+  }
+  if(p[0] != 0 || write(fds[1], p + 4096, 100) != 100){
+    printf(stdout, "sbrk read of untouched heap failed\n");
+    exit();
+  }
+  p[0] = 1;
+  if(read(fds[0], buf, 100) != 100 || buf[0] != 0 || buf[99] != 0 ||
+     p[1] != 0 || p[4096] != 0){
+    printf(stdout, "sbrk zero page was written\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-(2*4096));
+
   // can we read the kernel's memory?
   for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
     ppid = getpid();
@@ -1728,6 +1896,7 @@ main(int argc, char *argv[])
   validatetest();
 
   opentest();
+  textbusytest();
   writetest();
   writetest1();
   createtest();
@@ -1744,6 +1913,7 @@ main(int argc, char *argv[])
   rmdot();
   fourteen();
   bigfile();
+  fragtest();
   subdir();
   linktest();
   unlinkread();
@@ -0,0 +1,330 @@
+// Disk driver for a virtio-blk PCI device, used instead of
+// ide.c by kernelvirtio.  It speaks the legacy (virtio 0.9)
+// interface through the device's I/O BAR.  Requests go into a
+// ring of descriptors that the device works through by itself,
+// so many can be outstanding at once rather than one as with
+// IDE.  Completion is signalled through ideintr() as before.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "buf.h"
+#include "diskstat.h"
+#include "pci.h"
+
+#define VIRTIO_ID_BLK   0x10011af4  // device 0x1001, vendor 0x1af4
+
+// Legacy virtio PCI registers, from vbase.
+#define VIO_GUESTFEAT   0x04  // Features the driver accepts
+#define VIO_QPFN        0x08  // Page number of the selected queue
+#define VIO_QSIZE       0x0c  // Entries in the selected queue
+#define VIO_QSEL        0x0e  // Queue select
+#define VIO_QNOTIFY     0x10  // Queue notify
+#define VIO_STATUS      0x12  // Device status
+#define VIO_ISR         0x13  // Interrupt status; reading acks
+
+#define VIO_S_ACK       1
+#define VIO_S_DRIVER    2
+#define VIO_S_OK        4
+
+#define VRING_F_NEXT    1  // descriptor continues in next
+#define VRING_F_WRITE   2  // device writes the buffer
+
+#define VBLK_T_IN       0  // read
+#define VBLK_T_OUT      1  // write
+
+#define NVQ 256  // largest queue supported
+
+struct vdesc {
+  uint addr;
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+struct vavail {
+  ushort flags;
+  ushort idx;
+  ushort ring[NVQ];
+};
+
+struct vusedelem {
+  uint id;    // first descriptor of the finished request
+  uint len;
+};
+
+struct vused {
+  ushort flags;
+  ushort idx;
+  struct vusedelem ring[NVQ];
+};
+
+// Request header, followed by the data and a status byte.
+struct vblkreq {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+
+// The queue: descriptors, then the available ring, then on the
+// next page boundary the used ring.  Sized for NVQ entries.
+static char vqmem[3*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static struct spinlock vlock;
+static ushort vbase;
+static int vnum;
+static struct vdesc *desc;
+static struct vavail *avail;
+static volatile struct vused *used;
+static ushort usedidx;       // next used entry to look at
+static int freehead, nfree;  // free descriptors, through next
+
+// Per request, indexed by its first descriptor.
+static struct {
+  struct buf *b;
+  struct vblkreq hdr;
+  uchar status;
+} vreq[NVQ];
+
+// Bufs waiting for descriptors, through qnext.
+static struct buf *vpending;
+
+static uint vncmd, vnreq, vqticks, vintrkcycles;
+
+void
+ideinit(void)
+{
+  uint tag;
+  int i;
+
+  initlock(&vlock, "virtio");
+  if((tag = pcifindid(VIRTIO_ID_BLK)) == 0)
+    panic("virtio: no disk");
+  pcienable(tag);
+  vbase = pciread(tag, PCI_BAR(0)) & 0xfffc;
+
+  // Reset, then tell the device a driver is here.
+  outb(vbase+VIO_STATUS, 0);
+  outb(vbase+VIO_STATUS, VIO_S_ACK);
+  outb(vbase+VIO_STATUS, VIO_S_ACK|VIO_S_DRIVER);
+  outl(vbase+VIO_GUESTFEAT, 0);
+
+  outw(vbase+VIO_QSEL, 0);
+  vnum = inw(vbase+VIO_QSIZE);
+  if(vnum == 0 || vnum > NVQ)
+    panic("virtio: queue size");
+  desc = (struct vdesc*)vqmem;
+  avail = (struct vavail*)(vqmem + vnum*sizeof(struct vdesc));
+  used = (struct vused*)(vqmem + PGROUNDUP(vnum*sizeof(struct vdesc) + 4 + 2*vnum + 2));
+  for(i = 0; i < vnum; i++)
+    desc[i].next = i + 1;
+  freehead = 0;
+  nfree = vnum;
+  outl(vbase+VIO_QPFN, v2p(vqmem) >> 12);
+  outb(vbase+VIO_STATUS, VIO_S_ACK|VIO_S_DRIVER|VIO_S_OK);
+
+  diskirq = pciread(tag, PCI_INTR) & 0xff;
+  picenable(diskirq);
+  ioapicenablelevel(diskirq, ncpu - 1);
+  cprintf("virtio: disk at %x irq %d, %d queue entries\n",
+          vbase, diskirq, vnum);
+}
+
+static int
+vdalloc(void)
+{
+  int i;
+
+  i = freehead;
+  freehead = desc[i].next;
+  nfree--;
+  return i;
+}
+
+// Free the descriptor chain starting at i.
+static void
+vdfree(int i)
+{
+  int next, more;
+
+  do {
+    more = desc[i].flags & VRING_F_NEXT;
+    next = desc[i].next;
+    desc[i].next = freehead;
+    freehead = i;
+    nfree++;
+    i = next;
+  } while(more);
+}
+
+// Put b's request on the ring: header, data, status.
+// Caller must hold vlock and have checked nfree >= 3.
+static void
+vstart(struct buf *b)
+{
+  int d0, d1, d2;
+
+  if(b->blockno >= FSSIZE)
+    panic("incorrect blockno");
+  d0 = vdalloc();
+  d1 = vdalloc();
+  d2 = vdalloc();
+
+  vreq[d0].b = b;
+  vreq[d0].hdr.type = (b->flags & B_DIRTY) ? VBLK_T_OUT : VBLK_T_IN;
+  vreq[d0].hdr.reserved = 0;
+  vreq[d0].hdr.sector = b->blockno * (BSIZE/512);
+  vreq[d0].hdr.sectorhi = 0;
+  vreq[d0].status = 0xff;
+
+  desc[d0].addr = v2p(&vreq[d0].hdr);
+  desc[d0].addrhi = 0;
+  desc[d0].len = sizeof(struct vblkreq);
+  desc[d0].flags = VRING_F_NEXT;
+  desc[d0].next = d1;
+
+  desc[d1].addr = v2p(b->data);
+  desc[d1].addrhi = 0;
+  desc[d1].len = BSIZE;
+  desc[d1].flags = VRING_F_NEXT | ((b->flags & B_DIRTY) ? 0 : VRING_F_WRITE);
+  desc[d1].next = d2;
+
+  desc[d2].addr = v2p(&vreq[d0].status);
+  desc[d2].addrhi = 0;
+  desc[d2].len = 1;
+  desc[d2].flags = VRING_F_WRITE;
+  desc[d2].next = 0;
+
+  avail->ring[avail->idx % vnum] = d0;
+  __sync_synchronize();
+  avail->idx++;
+  __sync_synchronize();
+  outw(vbase+VIO_QNOTIFY, 0);
+  vncmd++;
+}
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+  struct buf *b;
+  void (*done)(struct buf*);
+  unsigned long long t0;
+  int id;
+
+  t0 = rdtsc();
+  acquire(&vlock);
+  inb(vbase+VIO_ISR);
+
+  // Finish every request the device has completed.
+  while(usedidx != used->idx){
+    __sync_synchronize();
+    id = used->ring[usedidx % vnum].id;
+    usedidx++;
+    b = vreq[id].b;
+
+    // After an error the data read is not trusted, and data
+    // written is still dirty.
+    if(vreq[id].status != 0)
+      b->flags |= B_ERROR;
+    else {
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+    }
+    vdfree(id);
+    vnreq++;
+    vqticks += ticks - b->qtime;
+    wakeup(b);
+    if((done = b->done) != 0){
+      b->done = 0;
+      done(b);
+    }
+  }
+
+  // Start requests that were waiting for descriptors.
+  while(vpending && nfree >= 3){
+    b = vpending;
+    vpending = b->qnext;
+    vstart(b);
+  }
+
+  vintrkcycles += (rdtsc() - t0) >> 10;
+  release(&vlock);
+}
+
+//PAGEBREAK!
+// Queue b to be synced with disk and return without waiting.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If the request fails, set B_ERROR instead.
+// When the request finishes, ideintr() calls b->done if it is set.
+void
+idesubmit(struct buf *b)
+{
+  struct buf **pp;
+
+  if(!(b->flags & B_BUSY))
+    panic("iderw: buf not busy");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+
+  acquire(&vlock);
+  b->flags &= ~B_ERROR;
+  b->qtime = ticks;
+  if(vpending == 0 && nfree >= 3)
+    vstart(b);
+  else {
+    b->qnext = 0;
+    for(pp = &vpending; *pp; pp = &(*pp)->qnext)
+      ;
+    *pp = b;
+  }
+  release(&vlock);
+}
+
+// Wait for a request queued by idesubmit() to finish.
+// Returns -1 if it failed, 0 otherwise.
+int
+ideawait(struct buf *b)
+{
+  acquire(&vlock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID && !(b->flags & B_ERROR)){
+    sleep(b, &vlock);
+  }
+  release(&vlock);
+  return (b->flags & B_ERROR) ? -1 : 0;
+}
+
+// Sync buf with disk. 
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Returns -1 if the request failed, 0 otherwise.
+int
+iderw(struct buf *b)
+{
+  idesubmit(b);
+  return ideawait(b);
+}
+
+// Fill in disk statistics for getdiskstat().
+void
+idestat(struct diskstat *st)
+{
+  acquire(&vlock);
+  st->ncmd = vncmd;
+  st->nblock = vncmd;
+  st->nreq = vnreq;
+  st->qticks = vqticks;
+  st->intrkcycles = vintrkcycles;
+  st->dma = 1;
+  release(&vlock);
+}
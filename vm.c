@@ -9,6 +9,7 @@
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+static char *zeropage;  // mapped copy-on-write where untouched memory is read
 struct segdesc gdt[NSEGS];
 
 // Set up CPU's kernel segment descriptors.
@@ -150,6 +151,9 @@ kvmalloc(void)
 {
   kpgdir = setupkvm();
   switchkvm();
+  if((zeropage = kalloc()) == 0)
+    panic("kvmalloc: zeropage");
+  memset(zeropage, 0, PGSIZE);
 }
 
 // Switch h/w page table register to the kernel-only page table,
@@ -191,30 +195,6 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uint) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, p2v(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
 int
@@ -259,7 +239,7 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
     else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
@@ -305,30 +285,33 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  The pages themselves are not copied:
+// parent and child share them read-only, marked PTE_COW,
+// until one of them writes and cowcopy() gives it its own.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+    // Heap pages never touched stay unallocated in the child too.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)p2v(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, v2p(mem), flags) < 0)
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
+    kdup(p2v(pa));
   }
+  // Flush the write permission we took away from the parent.
+  if(pgdir == proc->pgdir)
+    lcr3(v2p(pgdir));
   return d;
 
 bad:
@@ -336,6 +319,218 @@ bad:
   return 0;
 }
 
+// Give pgdir a private, writable copy of the copy-on-write
+// page at va.  If no one else shares the page any more, just
+// make it writable again.  Does not flush the TLB.
+// Returns 0 on success, -1 if va is not a copy-on-write page
+// or memory is exhausted.
+static int
+cowcopy(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  pte = walkpgdir(pgdir, (void*)va, 0);
+  if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcount(p2v(pa)) == 1){
+    *pte = pa | flags;
+    return 0;
+  }
+  if((mem = kalloc()) == 0)
+    return -1;
+  memmove(mem, (char*)p2v(pa), PGSIZE);
+  *pte = v2p(mem) | flags;
+  kfree(p2v(pa));
+  return 0;
+}
+
+// Map the page containing va in the current process, whose
+// page directory is pgdir.  growproc() only extends proc->sz and
+// exec() only records the ELF segments in proc->seg, so pages
+// are allocated on first touch: zero-filled, or read from the
+// executable if a segment covers va.  If the page would be all
+// zeros and write is not set, the shared zero page is mapped
+// copy-on-write instead, until the process writes it.
+static int
+lazyalloc(pde_t *pgdir, uint va, int write)
+{
+  char *mem;
+  struct vmseg *s;
+  uint a, n;
+
+  a = PGROUNDDOWN(va);
+  for(s = proc->seg; s < &proc->seg[NSEG]; s++){
+    if(s->ip && a >= s->va && a < s->end)
+      break;
+  }
+  if(s == &proc->seg[NSEG] || a - s->va >= s->filesz){
+    s = 0;
+    if(!write){
+      if(mappages(pgdir, (char*)a, PGSIZE, v2p(zeropage), PTE_COW|PTE_U) < 0)
+        return -1;
+      kdup(zeropage);
+      return 0;
+    }
+  }
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  if(s){
+    n = s->filesz - (a - s->va);
+    if(n > PGSIZE)
+      n = PGSIZE;
+    ilock(s->ip);
+    if(readi(s->ip, mem, s->off + (a - s->va), n) != n){
+      iunlock(s->ip);
+      kfree(mem);
+      return -1;
+    }
+    iunlock(s->ip);
+  }
+  if(mappages(pgdir, (char*)a, PGSIZE, v2p(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Copy the segment table src into dst, taking a reference
+// to each executable, which keeps it from being written.
+void
+segdup(struct vmseg *dst, struct vmseg *src)
+{
+  int i;
+
+  for(i = 0; i < NSEG; i++){
+    dst[i] = src[i];
+    if(src[i].ip){
+      dst[i].ip = idup(src[i].ip);
+      itext(dst[i].ip, 1);
+    }
+  }
+}
+
+// Drop the segment table's references to its executables.
+// Must be called inside a transaction, since iput() may be
+// the last reference to an unlinked file.
+void
+segput(struct vmseg *seg)
+{
+  int i;
+
+  for(i = 0; i < NSEG; i++){
+    if(seg[i].ip){
+      itext(seg[i].ip, -1);
+      iput(seg[i].ip);
+      seg[i].ip = 0;
+    }
+  }
+}
+
+// The process shrank to sz: addresses above sz must read as
+// zero if it grows again, not as the executable's contents.
+void
+segtrunc(struct vmseg *seg, uint sz)
+{
+  int i;
+
+  for(i = 0; i < NSEG; i++){
+    if(seg[i].ip == 0 || seg[i].end <= sz)
+      continue;
+    seg[i].end = sz > seg[i].va ? sz : seg[i].va;
+    if(seg[i].filesz > seg[i].end - seg[i].va)
+      seg[i].filesz = seg[i].end - seg[i].va;
+  }
+}
+
+// Handle a page fault at user address va in the current
+// process, with error code err.  Returns 0 if the faulting
+// access can be retried, -1 if it is a genuine fault.
+int
+pagefault(uint va, uint err)
+{
+  pte_t *pte;
+
+  if(va >= proc->sz)
+    return -1;
+  if(!(err & FEC_PR))
+    return lazyalloc(proc->pgdir, va, err & FEC_WR);
+  if(err & FEC_WR){
+    pte = walkpgdir(proc->pgdir, (void*)va, 0);
+    if(pte && (*pte & (PTE_P|PTE_U|PTE_W)) == (PTE_P|PTE_U|PTE_W)){
+      // Already writable; the TLB entry was stale.
+      lcr3(v2p(proc->pgdir));
+      return 0;
+    }
+    if(cowcopy(proc->pgdir, va) == 0){
+      lcr3(v2p(proc->pgdir));
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// Make the pages of [va, va+len) in the current process present,
+// and if write is set also privately writable, so that system
+// calls can access them without faulting, possibly while holding
+// locks.  Returns -1 if the range is not within proc->sz or
+// memory is exhausted.
+int
+uvmprefault(uint va, uint len, int write)
+{
+  uint a, last;
+  pte_t *pte;
+  int flush;
+
+  if(len == 0)
+    return 0;
+  if(va >= proc->sz || va + len > proc->sz || va + len < va)
+    return -1;
+  flush = 0;
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  for(;;){
+    pte = walkpgdir(proc->pgdir, (char*)a, 0);
+    if(pte == 0 || !(*pte & PTE_P)){
+      if(lazyalloc(proc->pgdir, a, write) < 0)
+        return -1;
+    } else if(write && (*pte & PTE_COW)){
+      if(cowcopy(proc->pgdir, a) < 0)
+        return -1;
+      flush = 1;
+    }
+    if(a == last)
+      break;
+    a += PGSIZE;
+  }
+  if(flush)
+    lcr3(v2p(proc->pgdir));
+  return 0;
+}
+
+// Return the number of bytes of pgdir's user memory below sz
+// that are backed by physical pages other than the zero page.
+uint
+uvmrss(pde_t *pgdir, uint sz)
+{
+  pte_t *pte;
+  uint a, n;
+
+  n = 0;
+  for(a = 0; a < sz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte == 0)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) && PTE_ADDR(*pte) != v2p(zeropage))
+      n += PGSIZE;
+  }
+  return n;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -359,10 +554,20 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // Writes through the kernel mapping bypass the
+    // page protection, so break copy-on-write here.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowcopy(pgdir, va0) < 0)
+      return -1;
+    // Fault in untouched heap pages of the current process.
+    if((pte == 0 || !(*pte & PTE_P)) && proc && pgdir == proc->pgdir &&
+       va0 < proc->sz && lazyalloc(pgdir, va0, 1) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
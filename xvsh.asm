@@ -0,0 +1,2282 @@
+
+_xvsh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <strtok_custom>:
+int execute_redirection(char **tok, int bg);
+
+// Helper Functions
+
+// Custom strtok implementation for xv6
+char *strtok_custom(char *s, const char *delim) {
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+    static char *last;
+    char *spanp;
+    int c, sc;
+    char *tok;
+
+    if (s == NULL && (s = last) == NULL)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	74 03                	je     f <strtok_custom+0xf>
+        return NULL_PTR;
+
+    // Skip leading delimiters
+cont:
+       c:	90                   	nop
+       d:	eb 18                	jmp    27 <strtok_custom+0x27>
+    if (s == NULL && (s = last) == NULL)
+       f:	a1 3c 16 00 00       	mov    0x163c,%eax
+      14:	89 45 08             	mov    %eax,0x8(%ebp)
+      17:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+      1b:	75 ef                	jne    c <strtok_custom+0xc>
+        return NULL_PTR;
+      1d:	b8 00 00 00 00       	mov    $0x0,%eax
+      22:	e9 bb 00 00 00       	jmp    e2 <strtok_custom+0xe2>
+    c = *s++;
+      27:	8b 45 08             	mov    0x8(%ebp),%eax
+      2a:	8d 50 01             	lea    0x1(%eax),%edx
+      2d:	89 55 08             	mov    %edx,0x8(%ebp)
+      30:	0f b6 00             	movzbl (%eax),%eax
+      33:	0f be c0             	movsbl %al,%eax
+      36:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    for (spanp = (char *)delim; (sc = *spanp++) != 0;) {
+      39:	8b 45 0c             	mov    0xc(%ebp),%eax
+      3c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+      3f:	eb 0a                	jmp    4b <strtok_custom+0x4b>
+        if (c == sc)
+      41:	8b 45 f8             	mov    -0x8(%ebp),%eax
+      44:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+      47:	75 02                	jne    4b <strtok_custom+0x4b>
+            goto cont;
+      49:	eb dc                	jmp    27 <strtok_custom+0x27>
+    for (spanp = (char *)delim; (sc = *spanp++) != 0;) {
+      4b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      4e:	8d 50 01             	lea    0x1(%eax),%edx
+      51:	89 55 fc             	mov    %edx,-0x4(%ebp)
+      54:	0f b6 00             	movzbl (%eax),%eax
+      57:	0f be c0             	movsbl %al,%eax
+      5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      61:	75 de                	jne    41 <strtok_custom+0x41>
+    }
+
+    if (c == 0) {  // No non-delimiter characters
+      63:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+      67:	75 11                	jne    7a <strtok_custom+0x7a>
+        last = NULL_PTR;
+      69:	c7 05 3c 16 00 00 00 	movl   $0x0,0x163c
+      70:	00 00 00 
+        return NULL_PTR;
+      73:	b8 00 00 00 00       	mov    $0x0,%eax
+      78:	eb 68                	jmp    e2 <strtok_custom+0xe2>
+    }
+
+    tok = s - 1;
+      7a:	8b 45 08             	mov    0x8(%ebp),%eax
+      7d:	83 e8 01             	sub    $0x1,%eax
+      80:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+    // Scan token
+    for (;;) {
+        c = *s++;
+      83:	8b 45 08             	mov    0x8(%ebp),%eax
+      86:	8d 50 01             	lea    0x1(%eax),%edx
+      89:	89 55 08             	mov    %edx,0x8(%ebp)
+      8c:	0f b6 00             	movzbl (%eax),%eax
+      8f:	0f be c0             	movsbl %al,%eax
+      92:	89 45 f8             	mov    %eax,-0x8(%ebp)
+        spanp = (char *)delim;
+      95:	8b 45 0c             	mov    0xc(%ebp),%eax
+      98:	89 45 fc             	mov    %eax,-0x4(%ebp)
+        do {
+            if ((sc = *spanp++) == c) {
+      9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      9e:	8d 50 01             	lea    0x1(%eax),%edx
+      a1:	89 55 fc             	mov    %edx,-0x4(%ebp)
+      a4:	0f b6 00             	movzbl (%eax),%eax
+      a7:	0f be c0             	movsbl %al,%eax
+      aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      b0:	3b 45 f8             	cmp    -0x8(%ebp),%eax
+      b3:	75 25                	jne    da <strtok_custom+0xda>
+                if (c == 0)
+      b5:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+      b9:	75 09                	jne    c4 <strtok_custom+0xc4>
+                    s = NULL_PTR;
+      bb:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+      c2:	eb 09                	jmp    cd <strtok_custom+0xcd>
+                else
+                    s[-1] = 0;
+      c4:	8b 45 08             	mov    0x8(%ebp),%eax
+      c7:	83 e8 01             	sub    $0x1,%eax
+      ca:	c6 00 00             	movb   $0x0,(%eax)
+                last = s;
+      cd:	8b 45 08             	mov    0x8(%ebp),%eax
+      d0:	a3 3c 16 00 00       	mov    %eax,0x163c
+                return tok;
+      d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+      d8:	eb 08                	jmp    e2 <strtok_custom+0xe2>
+            }
+        } while (sc != 0);
+      da:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      de:	75 bb                	jne    9b <strtok_custom+0x9b>
+        c = *s++;
+      e0:	eb a1                	jmp    83 <strtok_custom+0x83>
+    }
+    /* NOTREACHED */
+}
+      e2:	c9                   	leave
+      e3:	c3                   	ret
+
+000000e4 <exit_check>:
+
+// Check if the command is 'exit'
+int exit_check(char **tok) {
+      e4:	55                   	push   %ebp
+      e5:	89 e5                	mov    %esp,%ebp
+      e7:	83 ec 08             	sub    $0x8,%esp
+    return (tok[0] != NULL_PTR && strcmp(tok[0], "exit") == 0);
+      ea:	8b 45 08             	mov    0x8(%ebp),%eax
+      ed:	8b 00                	mov    (%eax),%eax
+      ef:	85 c0                	test   %eax,%eax
+      f1:	74 21                	je     114 <exit_check+0x30>
+      f3:	8b 45 08             	mov    0x8(%ebp),%eax
+      f6:	8b 00                	mov    (%eax),%eax
+      f8:	83 ec 08             	sub    $0x8,%esp
+      fb:	68 9c 11 00 00       	push   $0x119c
+     100:	50                   	push   %eax
+     101:	e8 85 08 00 00       	call   98b <strcmp>
+     106:	83 c4 10             	add    $0x10,%esp
+     109:	85 c0                	test   %eax,%eax
+     10b:	75 07                	jne    114 <exit_check+0x30>
+     10d:	b8 01 00 00 00       	mov    $0x1,%eax
+     112:	eb 05                	jmp    119 <exit_check+0x35>
+     114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     119:	c9                   	leave
+     11a:	c3                   	ret
+
+0000011b <wait_for_background_processes>:
+
+// Wait for all background processes to finish
+void wait_for_background_processes() {
+     11b:	55                   	push   %ebp
+     11c:	89 e5                	mov    %esp,%ebp
+     11e:	83 ec 18             	sub    $0x18,%esp
+    while (1) {
+        int pid = wait();
+     121:	e8 6e 0a 00 00       	call   b94 <wait>
+     126:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        if (pid < 0)
+     129:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     12d:	78 02                	js     131 <wait_for_background_processes+0x16>
+    while (1) {
+     12f:	eb f0                	jmp    121 <wait_for_background_processes+0x6>
+            break;  // No more background processes
+     131:	90                   	nop
+    }
+}
+     132:	90                   	nop
+     133:	c9                   	leave
+     134:	c3                   	ret
+
+00000135 <process_normal>:
+
+// Execute normal commands (foreground or background)
+int process_normal(char **tok, int bg) {
+     135:	55                   	push   %ebp
+     136:	89 e5                	mov    %esp,%ebp
+     138:	83 ec 18             	sub    $0x18,%esp
+    int pid = fork();
+     13b:	e8 44 0a 00 00       	call   b84 <fork>
+     140:	89 45 f4             	mov    %eax,-0xc(%ebp)
+
+    if (pid < 0) {
+     143:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     147:	79 19                	jns    162 <process_normal+0x2d>
+        printf(2, "Fork failed\n");
+     149:	83 ec 08             	sub    $0x8,%esp
+     14c:	68 a1 11 00 00       	push   $0x11a1
+     151:	6a 02                	push   $0x2
+     153:	e8 e0 0b 00 00       	call   d38 <printf>
+     158:	83 c4 10             	add    $0x10,%esp
+        return -1;
+     15b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     160:	eb 5e                	jmp    1c0 <process_normal+0x8b>
+    }
+
+    if (pid == 0) {  // Child process
+     162:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     166:	75 31                	jne    199 <process_normal+0x64>
+        exec(tok[0], tok);
+     168:	8b 45 08             	mov    0x8(%ebp),%eax
+     16b:	8b 00                	mov    (%eax),%eax
+     16d:	83 ec 08             	sub    $0x8,%esp
+     170:	ff 75 08             	push   0x8(%ebp)
+     173:	50                   	push   %eax
+     174:	e8 4b 0a 00 00       	call   bc4 <exec>
+     179:	83 c4 10             	add    $0x10,%esp
+        printf(2, "Cannot run this command %s\n", tok[0]);
+     17c:	8b 45 08             	mov    0x8(%ebp),%eax
+     17f:	8b 00                	mov    (%eax),%eax
+     181:	83 ec 04             	sub    $0x4,%esp
+     184:	50                   	push   %eax
+     185:	68 ae 11 00 00       	push   $0x11ae
+     18a:	6a 02                	push   $0x2
+     18c:	e8 a7 0b 00 00       	call   d38 <printf>
+     191:	83 c4 10             	add    $0x10,%esp
+        exit();
+     194:	e8 f3 09 00 00       	call   b8c <exit>
+    }
+
+    if (!bg) {  // Foreground process
+     199:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     19d:	75 07                	jne    1a6 <process_normal+0x71>
+        wait();
+     19f:	e8 f0 09 00 00       	call   b94 <wait>
+     1a4:	eb 15                	jmp    1bb <process_normal+0x86>
+    } else {  // Background process
+        printf(1, "[pid %d] runs as a background process\n", pid);
+     1a6:	83 ec 04             	sub    $0x4,%esp
+     1a9:	ff 75 f4             	push   -0xc(%ebp)
+     1ac:	68 cc 11 00 00       	push   $0x11cc
+     1b1:	6a 01                	push   $0x1
+     1b3:	e8 80 0b 00 00       	call   d38 <printf>
+     1b8:	83 c4 10             	add    $0x10,%esp
+    }
+
+    return 0;
+     1bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     1c0:	c9                   	leave
+     1c1:	c3                   	ret
+
+000001c2 <split_commands>:
+
+// Split buffer into commands separated by '|'
+int split_commands(char *buf, char **commands) {
+     1c2:	55                   	push   %ebp
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	83 ec 10             	sub    $0x10,%esp
+    int count = 0;
+     1c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    char *cmd = strtok_custom(buf, "|");
+     1cf:	68 f3 11 00 00       	push   $0x11f3
+     1d4:	ff 75 08             	push   0x8(%ebp)
+     1d7:	e8 24 fe ff ff       	call   0 <strtok_custom>
+     1dc:	83 c4 08             	add    $0x8,%esp
+     1df:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while (cmd != NULL_PTR && count < MAXTOKENS) {
+     1e2:	eb 3a                	jmp    21e <split_commands+0x5c>
+        // Trim leading spaces
+        while (*cmd == ' ') cmd++;
+     1e4:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+     1e8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     1eb:	0f b6 00             	movzbl (%eax),%eax
+     1ee:	3c 20                	cmp    $0x20,%al
+     1f0:	74 f2                	je     1e4 <split_commands+0x22>
+        commands[count++] = cmd;
+     1f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     1f5:	8d 50 01             	lea    0x1(%eax),%edx
+     1f8:	89 55 fc             	mov    %edx,-0x4(%ebp)
+     1fb:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     202:	8b 45 0c             	mov    0xc(%ebp),%eax
+     205:	01 c2                	add    %eax,%edx
+     207:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     20a:	89 02                	mov    %eax,(%edx)
+        cmd = strtok_custom(NULL_PTR, "|");
+     20c:	68 f3 11 00 00       	push   $0x11f3
+     211:	6a 00                	push   $0x0
+     213:	e8 e8 fd ff ff       	call   0 <strtok_custom>
+     218:	83 c4 08             	add    $0x8,%esp
+     21b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    while (cmd != NULL_PTR && count < MAXTOKENS) {
+     21e:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     222:	74 06                	je     22a <split_commands+0x68>
+     224:	83 7d fc 0f          	cmpl   $0xf,-0x4(%ebp)
+     228:	7e be                	jle    1e8 <split_commands+0x26>
+    }
+    commands[count] = NULL_PTR;
+     22a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     22d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     234:	8b 45 0c             	mov    0xc(%ebp),%eax
+     237:	01 d0                	add    %edx,%eax
+     239:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    return count;
+     23f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     242:	c9                   	leave
+     243:	c3                   	ret
+
+00000244 <execute_piped_commands>:
+
+// Execute piped commands
+int execute_piped_commands(char **commands, int num_commands) {
+     244:	55                   	push   %ebp
+     245:	89 e5                	mov    %esp,%ebp
+     247:	83 ec 68             	sub    $0x68,%esp
+    int i;
+    int fd[2];
+    int in = 0;  // Initial input is stdin
+     24a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+    for (i = 0; i < num_commands; i++) {
+     251:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     258:	e9 7c 01 00 00       	jmp    3d9 <execute_piped_commands+0x195>
+        char *args[MAXTOKENS];
+        int j = 0;
+     25d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+
+        // Tokenize each command
+        char *tok = strtok_custom(commands[i], " ");
+     264:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     267:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     26e:	8b 45 08             	mov    0x8(%ebp),%eax
+     271:	01 d0                	add    %edx,%eax
+     273:	8b 00                	mov    (%eax),%eax
+     275:	68 f5 11 00 00       	push   $0x11f5
+     27a:	50                   	push   %eax
+     27b:	e8 80 fd ff ff       	call   0 <strtok_custom>
+     280:	83 c4 08             	add    $0x8,%esp
+     283:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        while (tok != NULL_PTR && j < MAXTOKENS - 1) {
+     286:	eb 22                	jmp    2aa <execute_piped_commands+0x66>
+            args[j++] = tok;
+     288:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     28b:	8d 50 01             	lea    0x1(%eax),%edx
+     28e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     291:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     294:	89 54 85 9c          	mov    %edx,-0x64(%ebp,%eax,4)
+            tok = strtok_custom(NULL_PTR, " ");
+     298:	68 f5 11 00 00       	push   $0x11f5
+     29d:	6a 00                	push   $0x0
+     29f:	e8 5c fd ff ff       	call   0 <strtok_custom>
+     2a4:	83 c4 08             	add    $0x8,%esp
+     2a7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+        while (tok != NULL_PTR && j < MAXTOKENS - 1) {
+     2aa:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     2ae:	74 06                	je     2b6 <execute_piped_commands+0x72>
+     2b0:	83 7d ec 0e          	cmpl   $0xe,-0x14(%ebp)
+     2b4:	7e d2                	jle    288 <execute_piped_commands+0x44>
+        }
+        args[j] = NULL_PTR;
+     2b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     2b9:	c7 44 85 9c 00 00 00 	movl   $0x0,-0x64(%ebp,%eax,4)
+     2c0:	00 
+
+        if (pipe(fd) < 0) {
+     2c1:	83 ec 0c             	sub    $0xc,%esp
+     2c4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     2c7:	50                   	push   %eax
+     2c8:	e8 cf 08 00 00       	call   b9c <pipe>
+     2cd:	83 c4 10             	add    $0x10,%esp
+     2d0:	85 c0                	test   %eax,%eax
+     2d2:	79 1c                	jns    2f0 <execute_piped_commands+0xac>
+            printf(2, "Pipe failed\n");
+     2d4:	83 ec 08             	sub    $0x8,%esp
+     2d7:	68 f7 11 00 00       	push   $0x11f7
+     2dc:	6a 02                	push   $0x2
+     2de:	e8 55 0a 00 00       	call   d38 <printf>
+     2e3:	83 c4 10             	add    $0x10,%esp
+            return -1;
+     2e6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     2eb:	e9 14 01 00 00       	jmp    404 <execute_piped_commands+0x1c0>
+        }
+
+        int pid = fork();
+     2f0:	e8 8f 08 00 00       	call   b84 <fork>
+     2f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if (pid < 0) {
+     2f8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     2fc:	79 1c                	jns    31a <execute_piped_commands+0xd6>
+            printf(2, "Fork failed\n");
+     2fe:	83 ec 08             	sub    $0x8,%esp
+     301:	68 a1 11 00 00       	push   $0x11a1
+     306:	6a 02                	push   $0x2
+     308:	e8 2b 0a 00 00       	call   d38 <printf>
+     30d:	83 c4 10             	add    $0x10,%esp
+            return -1;
+     310:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     315:	e9 ea 00 00 00       	jmp    404 <execute_piped_commands+0x1c0>
+        }
+
+        if (pid == 0) {  // Child process
+     31a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     31e:	0f 85 88 00 00 00    	jne    3ac <execute_piped_commands+0x168>
+            if (in != 0) {  // Not the first command
+     324:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     328:	74 1c                	je     346 <execute_piped_commands+0x102>
+                dup(in);
+     32a:	83 ec 0c             	sub    $0xc,%esp
+     32d:	ff 75 f0             	push   -0x10(%ebp)
+     330:	e8 cf 08 00 00       	call   c04 <dup>
+     335:	83 c4 10             	add    $0x10,%esp
+                close(in);
+     338:	83 ec 0c             	sub    $0xc,%esp
+     33b:	ff 75 f0             	push   -0x10(%ebp)
+     33e:	e8 71 08 00 00       	call   bb4 <close>
+     343:	83 c4 10             	add    $0x10,%esp
+            }
+            if (i < num_commands - 1) {  // Not the last command
+     346:	8b 45 0c             	mov    0xc(%ebp),%eax
+     349:	83 e8 01             	sub    $0x1,%eax
+     34c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     34f:	7d 2d                	jge    37e <execute_piped_commands+0x13a>
+                dup(fd[1]);
+     351:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     354:	83 ec 0c             	sub    $0xc,%esp
+     357:	50                   	push   %eax
+     358:	e8 a7 08 00 00       	call   c04 <dup>
+     35d:	83 c4 10             	add    $0x10,%esp
+                close(fd[0]);
+     360:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     363:	83 ec 0c             	sub    $0xc,%esp
+     366:	50                   	push   %eax
+     367:	e8 48 08 00 00       	call   bb4 <close>
+     36c:	83 c4 10             	add    $0x10,%esp
+                close(fd[1]);
+     36f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     372:	83 ec 0c             	sub    $0xc,%esp
+     375:	50                   	push   %eax
+     376:	e8 39 08 00 00       	call   bb4 <close>
+     37b:	83 c4 10             	add    $0x10,%esp
+            }
+            exec(args[0], args);
+     37e:	8b 45 9c             	mov    -0x64(%ebp),%eax
+     381:	83 ec 08             	sub    $0x8,%esp
+     384:	8d 55 9c             	lea    -0x64(%ebp),%edx
+     387:	52                   	push   %edx
+     388:	50                   	push   %eax
+     389:	e8 36 08 00 00       	call   bc4 <exec>
+     38e:	83 c4 10             	add    $0x10,%esp
+            printf(2, "Cannot run this command %s\n", args[0]);
+     391:	8b 45 9c             	mov    -0x64(%ebp),%eax
+     394:	83 ec 04             	sub    $0x4,%esp
+     397:	50                   	push   %eax
+     398:	68 ae 11 00 00       	push   $0x11ae
+     39d:	6a 02                	push   $0x2
+     39f:	e8 94 09 00 00       	call   d38 <printf>
+     3a4:	83 c4 10             	add    $0x10,%esp
+            exit();
+     3a7:	e8 e0 07 00 00       	call   b8c <exit>
+        } else {  // Parent process
+            if (in != 0)
+     3ac:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3b0:	74 0e                	je     3c0 <execute_piped_commands+0x17c>
+                close(in);
+     3b2:	83 ec 0c             	sub    $0xc,%esp
+     3b5:	ff 75 f0             	push   -0x10(%ebp)
+     3b8:	e8 f7 07 00 00       	call   bb4 <close>
+     3bd:	83 c4 10             	add    $0x10,%esp
+            close(fd[1]);
+     3c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     3c3:	83 ec 0c             	sub    $0xc,%esp
+     3c6:	50                   	push   %eax
+     3c7:	e8 e8 07 00 00       	call   bb4 <close>
+     3cc:	83 c4 10             	add    $0x10,%esp
+            in = fd[0];
+     3cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     3d2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    for (i = 0; i < num_commands; i++) {
+     3d5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3dc:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     3df:	0f 8c 78 fe ff ff    	jl     25d <execute_piped_commands+0x19>
+        }
+    }
+
+    // Wait for all children
+    for (i = 0; i < num_commands; i++) {
+     3e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3ec:	eb 09                	jmp    3f7 <execute_piped_commands+0x1b3>
+        wait();
+     3ee:	e8 a1 07 00 00       	call   b94 <wait>
+    for (i = 0; i < num_commands; i++) {
+     3f3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     3f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     3fa:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     3fd:	7c ef                	jl     3ee <execute_piped_commands+0x1aa>
+    }
+
+    return 0;
+     3ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     404:	c9                   	leave
+     405:	c3                   	ret
+
+00000406 <execute_redirection>:
+
+// Execute commands with redirection
+int execute_redirection(char **tok, int bg) {
+     406:	55                   	push   %ebp
+     407:	89 e5                	mov    %esp,%ebp
+     409:	83 ec 58             	sub    $0x58,%esp
+    int i = 0;
+     40c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    int fd;
+    char *cmd_args[MAXTOKENS];
+    char *outfile = NULL_PTR;
+     413:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+
+    // Split tokens and identify redirection
+    while (tok[i] != NULL_PTR && i < MAXTOKENS - 1) {
+     41a:	eb 70                	jmp    48c <execute_redirection+0x86>
+        if (strcmp(tok[i], ">") == 0) {
+     41c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     41f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     426:	8b 45 08             	mov    0x8(%ebp),%eax
+     429:	01 d0                	add    %edx,%eax
+     42b:	8b 00                	mov    (%eax),%eax
+     42d:	83 ec 08             	sub    $0x8,%esp
+     430:	68 04 12 00 00       	push   $0x1204
+     435:	50                   	push   %eax
+     436:	e8 50 05 00 00       	call   98b <strcmp>
+     43b:	83 c4 10             	add    $0x10,%esp
+     43e:	85 c0                	test   %eax,%eax
+     440:	75 2e                	jne    470 <execute_redirection+0x6a>
+            outfile = tok[i + 1];
+     442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     445:	83 c0 01             	add    $0x1,%eax
+     448:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     44f:	8b 45 08             	mov    0x8(%ebp),%eax
+     452:	01 d0                	add    %edx,%eax
+     454:	8b 00                	mov    (%eax),%eax
+     456:	89 45 ec             	mov    %eax,-0x14(%ebp)
+            tok[i] = NULL_PTR;  // Terminate the command before '>'
+     459:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     45c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     463:	8b 45 08             	mov    0x8(%ebp),%eax
+     466:	01 d0                	add    %edx,%eax
+     468:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+            break;
+     46e:	eb 3b                	jmp    4ab <execute_redirection+0xa5>
+        }
+        cmd_args[i] = tok[i];
+     470:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     473:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     47a:	8b 45 08             	mov    0x8(%ebp),%eax
+     47d:	01 d0                	add    %edx,%eax
+     47f:	8b 10                	mov    (%eax),%edx
+     481:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     484:	89 54 85 a8          	mov    %edx,-0x58(%ebp,%eax,4)
+        i++;
+     488:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while (tok[i] != NULL_PTR && i < MAXTOKENS - 1) {
+     48c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     48f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     496:	8b 45 08             	mov    0x8(%ebp),%eax
+     499:	01 d0                	add    %edx,%eax
+     49b:	8b 00                	mov    (%eax),%eax
+     49d:	85 c0                	test   %eax,%eax
+     49f:	74 0a                	je     4ab <execute_redirection+0xa5>
+     4a1:	83 7d f4 0e          	cmpl   $0xe,-0xc(%ebp)
+     4a5:	0f 8e 71 ff ff ff    	jle    41c <execute_redirection+0x16>
+    }
+    cmd_args[i] = NULL_PTR;
+     4ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ae:	c7 44 85 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%eax,4)
+     4b5:	00 
+
+    if (outfile != NULL_PTR) {
+     4b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     4ba:	74 3b                	je     4f7 <execute_redirection+0xf1>
+        fd = open(outfile, O_CREATE | O_WRONLY);
+     4bc:	83 ec 08             	sub    $0x8,%esp
+     4bf:	68 01 02 00 00       	push   $0x201
+     4c4:	ff 75 ec             	push   -0x14(%ebp)
+     4c7:	e8 00 07 00 00       	call   bcc <open>
+     4cc:	83 c4 10             	add    $0x10,%esp
+     4cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if (fd < 0) {
+     4d2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4d6:	79 1f                	jns    4f7 <execute_redirection+0xf1>
+            printf(2, "Cannot open file %s\n", outfile);
+     4d8:	83 ec 04             	sub    $0x4,%esp
+     4db:	ff 75 ec             	push   -0x14(%ebp)
+     4de:	68 06 12 00 00       	push   $0x1206
+     4e3:	6a 02                	push   $0x2
+     4e5:	e8 4e 08 00 00       	call   d38 <printf>
+     4ea:	83 c4 10             	add    $0x10,%esp
+            return -1;
+     4ed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4f2:	e9 bb 00 00 00       	jmp    5b2 <execute_redirection+0x1ac>
+        }
+    }
+
+    int pid = fork();
+     4f7:	e8 88 06 00 00       	call   b84 <fork>
+     4fc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+
+    if (pid < 0) {
+     4ff:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     503:	79 1c                	jns    521 <execute_redirection+0x11b>
+        printf(2, "Fork failed\n");
+     505:	83 ec 08             	sub    $0x8,%esp
+     508:	68 a1 11 00 00       	push   $0x11a1
+     50d:	6a 02                	push   $0x2
+     50f:	e8 24 08 00 00       	call   d38 <printf>
+     514:	83 c4 10             	add    $0x10,%esp
+        return -1;
+     517:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     51c:	e9 91 00 00 00       	jmp    5b2 <execute_redirection+0x1ac>
+    }
+
+    if (pid == 0) {  // Child process
+     521:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     525:	75 50                	jne    577 <execute_redirection+0x171>
+        if (outfile != NULL_PTR) {
+     527:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     52b:	74 1c                	je     549 <execute_redirection+0x143>
+            dup(fd);
+     52d:	83 ec 0c             	sub    $0xc,%esp
+     530:	ff 75 f0             	push   -0x10(%ebp)
+     533:	e8 cc 06 00 00       	call   c04 <dup>
+     538:	83 c4 10             	add    $0x10,%esp
+            close(fd);
+     53b:	83 ec 0c             	sub    $0xc,%esp
+     53e:	ff 75 f0             	push   -0x10(%ebp)
+     541:	e8 6e 06 00 00       	call   bb4 <close>
+     546:	83 c4 10             	add    $0x10,%esp
+        }
+        exec(cmd_args[0], cmd_args);
+     549:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     54c:	83 ec 08             	sub    $0x8,%esp
+     54f:	8d 55 a8             	lea    -0x58(%ebp),%edx
+     552:	52                   	push   %edx
+     553:	50                   	push   %eax
+     554:	e8 6b 06 00 00       	call   bc4 <exec>
+     559:	83 c4 10             	add    $0x10,%esp
+        printf(2, "Cannot run this command %s\n", cmd_args[0]);
+     55c:	8b 45 a8             	mov    -0x58(%ebp),%eax
+     55f:	83 ec 04             	sub    $0x4,%esp
+     562:	50                   	push   %eax
+     563:	68 ae 11 00 00       	push   $0x11ae
+     568:	6a 02                	push   $0x2
+     56a:	e8 c9 07 00 00       	call   d38 <printf>
+     56f:	83 c4 10             	add    $0x10,%esp
+        exit();
+     572:	e8 15 06 00 00       	call   b8c <exit>
+    }
+
+    if (outfile != NULL_PTR)
+     577:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     57b:	74 0e                	je     58b <execute_redirection+0x185>
+        close(fd);
+     57d:	83 ec 0c             	sub    $0xc,%esp
+     580:	ff 75 f0             	push   -0x10(%ebp)
+     583:	e8 2c 06 00 00       	call   bb4 <close>
+     588:	83 c4 10             	add    $0x10,%esp
+
+    if (!bg) {  // Foreground process
+     58b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     58f:	75 07                	jne    598 <execute_redirection+0x192>
+        wait();
+     591:	e8 fe 05 00 00       	call   b94 <wait>
+     596:	eb 15                	jmp    5ad <execute_redirection+0x1a7>
+    } else {  // Background process
+        printf(1, "[pid %d] runs as a background process\n", pid);
+     598:	83 ec 04             	sub    $0x4,%esp
+     59b:	ff 75 e8             	push   -0x18(%ebp)
+     59e:	68 cc 11 00 00       	push   $0x11cc
+     5a3:	6a 01                	push   $0x1
+     5a5:	e8 8e 07 00 00       	call   d38 <printf>
+     5aa:	83 c4 10             	add    $0x10,%esp
+    }
+
+    return 0;
+     5ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     5b2:	c9                   	leave
+     5b3:	c3                   	ret
+
+000005b4 <process_one_cmd>:
+
+// Process a single command line
+int process_one_cmd(char* buf) {
+     5b4:	55                   	push   %ebp
+     5b5:	89 e5                	mov    %esp,%ebp
+     5b7:	53                   	push   %ebx
+     5b8:	83 ec 64             	sub    $0x64,%esp
+    int i, num_tok;
+    char **tok;
+    int bg = 0;
+     5bb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+
+    // Count tokens
+    num_tok = 0;
+     5c2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    for (i = 0; buf[i]; i++) {
+     5c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     5d0:	eb 17                	jmp    5e9 <process_one_cmd+0x35>
+        if (buf[i] == ' ') num_tok++;
+     5d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d8:	01 d0                	add    %edx,%eax
+     5da:	0f b6 00             	movzbl (%eax),%eax
+     5dd:	3c 20                	cmp    $0x20,%al
+     5df:	75 04                	jne    5e5 <process_one_cmd+0x31>
+     5e1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    for (i = 0; buf[i]; i++) {
+     5e5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     5e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ef:	01 d0                	add    %edx,%eax
+     5f1:	0f b6 00             	movzbl (%eax),%eax
+     5f4:	84 c0                	test   %al,%al
+     5f6:	75 da                	jne    5d2 <process_one_cmd+0x1e>
+    }
+    num_tok++; // for the last token
+     5f8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+
+    tok = malloc((num_tok + 1) * sizeof(char *));
+     5fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5ff:	83 c0 01             	add    $0x1,%eax
+     602:	c1 e0 02             	shl    $0x2,%eax
+     605:	83 ec 0c             	sub    $0xc,%esp
+     608:	50                   	push   %eax
+     609:	e8 fe 09 00 00       	call   100c <malloc>
+     60e:	83 c4 10             	add    $0x10,%esp
+     611:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if (tok == NULL_PTR) {
+     614:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+     618:	75 17                	jne    631 <process_one_cmd+0x7d>
+        printf(1, "malloc failed\n");
+     61a:	83 ec 08             	sub    $0x8,%esp
+     61d:	68 1b 12 00 00       	push   $0x121b
+     622:	6a 01                	push   $0x1
+     624:	e8 0f 07 00 00       	call   d38 <printf>
+     629:	83 c4 10             	add    $0x10,%esp
+        exit();
+     62c:	e8 5b 05 00 00       	call   b8c <exit>
+    }
+
+    i = 0;
+     631:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    tok[i++] = strtok_custom(buf, " ");
+     638:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     63b:	8d 50 01             	lea    0x1(%eax),%edx
+     63e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     641:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     648:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     64b:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+     64e:	83 ec 08             	sub    $0x8,%esp
+     651:	68 f5 11 00 00       	push   $0x11f5
+     656:	ff 75 08             	push   0x8(%ebp)
+     659:	e8 a2 f9 ff ff       	call   0 <strtok_custom>
+     65e:	83 c4 10             	add    $0x10,%esp
+     661:	89 03                	mov    %eax,(%ebx)
+
+    // Check for special symbols
+    while ((tok[i] = strtok_custom(NULL_PTR, " ")) != NULL_PTR) {
+     663:	eb 48                	jmp    6ad <process_one_cmd+0xf9>
+        if (strcmp(tok[i], "&") == 0) {
+     665:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     668:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     66f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     672:	01 d0                	add    %edx,%eax
+     674:	8b 00                	mov    (%eax),%eax
+     676:	83 ec 08             	sub    $0x8,%esp
+     679:	68 2a 12 00 00       	push   $0x122a
+     67e:	50                   	push   %eax
+     67f:	e8 07 03 00 00       	call   98b <strcmp>
+     684:	83 c4 10             	add    $0x10,%esp
+     687:	85 c0                	test   %eax,%eax
+     689:	75 1e                	jne    6a9 <process_one_cmd+0xf5>
+            bg = 1;  // Background process
+     68b:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+            tok[i] = NULL_PTR;  // Terminate tokens
+     692:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     695:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     69c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     69f:	01 d0                	add    %edx,%eax
+     6a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+            break;
+     6a7:	eb 2e                	jmp    6d7 <process_one_cmd+0x123>
+        }
+        i++;
+     6a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while ((tok[i] = strtok_custom(NULL_PTR, " ")) != NULL_PTR) {
+     6ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     6b7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     6ba:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+     6bd:	83 ec 08             	sub    $0x8,%esp
+     6c0:	68 f5 11 00 00       	push   $0x11f5
+     6c5:	6a 00                	push   $0x0
+     6c7:	e8 34 f9 ff ff       	call   0 <strtok_custom>
+     6cc:	83 c4 10             	add    $0x10,%esp
+     6cf:	89 03                	mov    %eax,(%ebx)
+     6d1:	8b 03                	mov    (%ebx),%eax
+     6d3:	85 c0                	test   %eax,%eax
+     6d5:	75 8e                	jne    665 <process_one_cmd+0xb1>
+    }
+
+    // Check for built-in exit command
+    if (exit_check(tok)) {
+     6d7:	83 ec 0c             	sub    $0xc,%esp
+     6da:	ff 75 d8             	push   -0x28(%ebp)
+     6dd:	e8 02 fa ff ff       	call   e4 <exit_check>
+     6e2:	83 c4 10             	add    $0x10,%esp
+     6e5:	85 c0                	test   %eax,%eax
+     6e7:	74 18                	je     701 <process_one_cmd+0x14d>
+        wait_for_background_processes();  // Wait for background processes
+     6e9:	e8 2d fa ff ff       	call   11b <wait_for_background_processes>
+        free(tok);
+     6ee:	83 ec 0c             	sub    $0xc,%esp
+     6f1:	ff 75 d8             	push   -0x28(%ebp)
+     6f4:	e8 d1 07 00 00       	call   eca <free>
+     6f9:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6fc:	e8 8b 04 00 00       	call   b8c <exit>
+    }
+
+    // Check for pipe
+    int pipe_present = 0;
+     701:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    for (i = 0; tok[i] != NULL_PTR; i++) {
+     708:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     70f:	eb 33                	jmp    744 <process_one_cmd+0x190>
+        if (strcmp(tok[i], "|") == 0) {
+     711:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     714:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     71b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     71e:	01 d0                	add    %edx,%eax
+     720:	8b 00                	mov    (%eax),%eax
+     722:	83 ec 08             	sub    $0x8,%esp
+     725:	68 f3 11 00 00       	push   $0x11f3
+     72a:	50                   	push   %eax
+     72b:	e8 5b 02 00 00       	call   98b <strcmp>
+     730:	83 c4 10             	add    $0x10,%esp
+     733:	85 c0                	test   %eax,%eax
+     735:	75 09                	jne    740 <process_one_cmd+0x18c>
+            pipe_present = 1;
+     737:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+            break;
+     73e:	eb 19                	jmp    759 <process_one_cmd+0x1a5>
+    for (i = 0; tok[i] != NULL_PTR; i++) {
+     740:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     744:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     747:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     74e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     751:	01 d0                	add    %edx,%eax
+     753:	8b 00                	mov    (%eax),%eax
+     755:	85 c0                	test   %eax,%eax
+     757:	75 b8                	jne    711 <process_one_cmd+0x15d>
+        }
+    }
+
+    if (pipe_present) {
+     759:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     75d:	0f 84 80 00 00 00    	je     7e3 <process_one_cmd+0x22f>
+        // Split the command by '|'
+        char *commands[MAXTOKENS];
+        int num_commands = 0;
+     763:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        char *cmd = strtok_custom(buf, "|");
+     76a:	83 ec 08             	sub    $0x8,%esp
+     76d:	68 f3 11 00 00       	push   $0x11f3
+     772:	ff 75 08             	push   0x8(%ebp)
+     775:	e8 86 f8 ff ff       	call   0 <strtok_custom>
+     77a:	83 c4 10             	add    $0x10,%esp
+     77d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        while (cmd != NULL_PTR && num_commands < MAXTOKENS) {
+     780:	eb 33                	jmp    7b5 <process_one_cmd+0x201>
+            // Trim leading spaces
+            while (*cmd == ' ') cmd++;
+     782:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     786:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     789:	0f b6 00             	movzbl (%eax),%eax
+     78c:	3c 20                	cmp    $0x20,%al
+     78e:	74 f2                	je     782 <process_one_cmd+0x1ce>
+            commands[num_commands++] = cmd;
+     790:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     793:	8d 50 01             	lea    0x1(%eax),%edx
+     796:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     799:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     79c:	89 54 85 98          	mov    %edx,-0x68(%ebp,%eax,4)
+            cmd = strtok_custom(NULL_PTR, "|");
+     7a0:	83 ec 08             	sub    $0x8,%esp
+     7a3:	68 f3 11 00 00       	push   $0x11f3
+     7a8:	6a 00                	push   $0x0
+     7aa:	e8 51 f8 ff ff       	call   0 <strtok_custom>
+     7af:	83 c4 10             	add    $0x10,%esp
+     7b2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        while (cmd != NULL_PTR && num_commands < MAXTOKENS) {
+     7b5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     7b9:	74 06                	je     7c1 <process_one_cmd+0x20d>
+     7bb:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+     7bf:	7e c5                	jle    786 <process_one_cmd+0x1d2>
+        }
+        commands[num_commands] = NULL_PTR;
+     7c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     7c4:	c7 44 85 98 00 00 00 	movl   $0x0,-0x68(%ebp,%eax,4)
+     7cb:	00 
+
+        execute_piped_commands(commands, num_commands);
+     7cc:	83 ec 08             	sub    $0x8,%esp
+     7cf:	ff 75 e4             	push   -0x1c(%ebp)
+     7d2:	8d 45 98             	lea    -0x68(%ebp),%eax
+     7d5:	50                   	push   %eax
+     7d6:	e8 69 fa ff ff       	call   244 <execute_piped_commands>
+     7db:	83 c4 10             	add    $0x10,%esp
+     7de:	e9 82 00 00 00       	jmp    865 <process_one_cmd+0x2b1>
+    }
+    else {
+        // Check for redirection
+        int redirection_present = 0;
+     7e3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+        for (i = 0; tok[i] != NULL_PTR; i++) {
+     7ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7f1:	eb 33                	jmp    826 <process_one_cmd+0x272>
+            if (strcmp(tok[i], ">") == 0) {
+     7f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f6:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     7fd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     800:	01 d0                	add    %edx,%eax
+     802:	8b 00                	mov    (%eax),%eax
+     804:	83 ec 08             	sub    $0x8,%esp
+     807:	68 04 12 00 00       	push   $0x1204
+     80c:	50                   	push   %eax
+     80d:	e8 79 01 00 00       	call   98b <strcmp>
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	85 c0                	test   %eax,%eax
+     817:	75 09                	jne    822 <process_one_cmd+0x26e>
+                redirection_present = 1;
+     819:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+                break;
+     820:	eb 19                	jmp    83b <process_one_cmd+0x287>
+        for (i = 0; tok[i] != NULL_PTR; i++) {
+     822:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     829:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     830:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     833:	01 d0                	add    %edx,%eax
+     835:	8b 00                	mov    (%eax),%eax
+     837:	85 c0                	test   %eax,%eax
+     839:	75 b8                	jne    7f3 <process_one_cmd+0x23f>
+            }
+        }
+
+        if (redirection_present) {
+     83b:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+     83f:	74 13                	je     854 <process_one_cmd+0x2a0>
+            execute_redirection(tok, bg);
+     841:	83 ec 08             	sub    $0x8,%esp
+     844:	ff 75 ec             	push   -0x14(%ebp)
+     847:	ff 75 d8             	push   -0x28(%ebp)
+     84a:	e8 b7 fb ff ff       	call   406 <execute_redirection>
+     84f:	83 c4 10             	add    $0x10,%esp
+     852:	eb 11                	jmp    865 <process_one_cmd+0x2b1>
+        }
+        else {
+            // Execute normal command
+            process_normal(tok, bg);
+     854:	83 ec 08             	sub    $0x8,%esp
+     857:	ff 75 ec             	push   -0x14(%ebp)
+     85a:	ff 75 d8             	push   -0x28(%ebp)
+     85d:	e8 d3 f8 ff ff       	call   135 <process_normal>
+     862:	83 c4 10             	add    $0x10,%esp
+        }
+    }
+
+    free(tok);
+     865:	83 ec 0c             	sub    $0xc,%esp
+     868:	ff 75 d8             	push   -0x28(%ebp)
+     86b:	e8 5a 06 00 00       	call   eca <free>
+     870:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     873:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     878:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+0000087d <main>:
+
+int main(int argc, char *argv[]) {
+     87d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     881:	83 e4 f0             	and    $0xfffffff0,%esp
+     884:	ff 71 fc             	push   -0x4(%ecx)
+     887:	55                   	push   %ebp
+     888:	89 e5                	mov    %esp,%ebp
+     88a:	51                   	push   %ecx
+     88b:	81 ec 14 01 00 00    	sub    $0x114,%esp
+    char buf[MAXLINE];
+    int n;
+
+    printf(1, SH_PROMPT);  // Print prompt
+     891:	83 ec 08             	sub    $0x8,%esp
+     894:	68 2c 12 00 00       	push   $0x122c
+     899:	6a 01                	push   $0x1
+     89b:	e8 98 04 00 00       	call   d38 <printf>
+     8a0:	83 c4 10             	add    $0x10,%esp
+
+    while ((n = read(0, buf, sizeof(buf))) > 0) {
+     8a3:	eb 65                	jmp    90a <main+0x8d>
+        if (n == 1) {  // Handle empty input
+     8a5:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+     8a9:	75 14                	jne    8bf <main+0x42>
+            printf(1, SH_PROMPT);
+     8ab:	83 ec 08             	sub    $0x8,%esp
+     8ae:	68 2c 12 00 00       	push   $0x122c
+     8b3:	6a 01                	push   $0x1
+     8b5:	e8 7e 04 00 00       	call   d38 <printf>
+     8ba:	83 c4 10             	add    $0x10,%esp
+            continue;
+     8bd:	eb 4b                	jmp    90a <main+0x8d>
+        }
+
+        buf[n - 1] = 0;  // Replace newline with null terminator
+     8bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     8c2:	83 e8 01             	sub    $0x1,%eax
+     8c5:	c6 84 05 f4 fe ff ff 	movb   $0x0,-0x10c(%ebp,%eax,1)
+     8cc:	00 
+
+        // Process the command
+        process_one_cmd(buf);
+     8cd:	83 ec 0c             	sub    $0xc,%esp
+     8d0:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     8d6:	50                   	push   %eax
+     8d7:	e8 d8 fc ff ff       	call   5b4 <process_one_cmd>
+     8dc:	83 c4 10             	add    $0x10,%esp
+
+        printf(1, SH_PROMPT);
+     8df:	83 ec 08             	sub    $0x8,%esp
+     8e2:	68 2c 12 00 00       	push   $0x122c
+     8e7:	6a 01                	push   $0x1
+     8e9:	e8 4a 04 00 00       	call   d38 <printf>
+     8ee:	83 c4 10             	add    $0x10,%esp
+        memset(buf, 0, sizeof(buf));
+     8f1:	83 ec 04             	sub    $0x4,%esp
+     8f4:	68 00 01 00 00       	push   $0x100
+     8f9:	6a 00                	push   $0x0
+     8fb:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     901:	50                   	push   %eax
+     902:	e8 ea 00 00 00       	call   9f1 <memset>
+     907:	83 c4 10             	add    $0x10,%esp
+    while ((n = read(0, buf, sizeof(buf))) > 0) {
+     90a:	83 ec 04             	sub    $0x4,%esp
+     90d:	68 00 01 00 00       	push   $0x100
+     912:	8d 85 f4 fe ff ff    	lea    -0x10c(%ebp),%eax
+     918:	50                   	push   %eax
+     919:	6a 00                	push   $0x0
+     91b:	e8 84 02 00 00       	call   ba4 <read>
+     920:	83 c4 10             	add    $0x10,%esp
+     923:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     926:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     92a:	0f 8f 75 ff ff ff    	jg     8a5 <main+0x28>
+    }
+
+    exit();
+     930:	e8 57 02 00 00       	call   b8c <exit>
+
+00000935 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     935:	55                   	push   %ebp
+     936:	89 e5                	mov    %esp,%ebp
+     938:	57                   	push   %edi
+     939:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     93a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     93d:	8b 55 10             	mov    0x10(%ebp),%edx
+     940:	8b 45 0c             	mov    0xc(%ebp),%eax
+     943:	89 cb                	mov    %ecx,%ebx
+     945:	89 df                	mov    %ebx,%edi
+     947:	89 d1                	mov    %edx,%ecx
+     949:	fc                   	cld
+     94a:	f3 aa                	rep stos %al,%es:(%edi)
+     94c:	89 ca                	mov    %ecx,%edx
+     94e:	89 fb                	mov    %edi,%ebx
+     950:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     953:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     956:	90                   	nop
+     957:	5b                   	pop    %ebx
+     958:	5f                   	pop    %edi
+     959:	5d                   	pop    %ebp
+     95a:	c3                   	ret
+
+0000095b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     95b:	55                   	push   %ebp
+     95c:	89 e5                	mov    %esp,%ebp
+     95e:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     961:	8b 45 08             	mov    0x8(%ebp),%eax
+     964:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     967:	90                   	nop
+     968:	8b 55 0c             	mov    0xc(%ebp),%edx
+     96b:	8d 42 01             	lea    0x1(%edx),%eax
+     96e:	89 45 0c             	mov    %eax,0xc(%ebp)
+     971:	8b 45 08             	mov    0x8(%ebp),%eax
+     974:	8d 48 01             	lea    0x1(%eax),%ecx
+     977:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     97a:	0f b6 12             	movzbl (%edx),%edx
+     97d:	88 10                	mov    %dl,(%eax)
+     97f:	0f b6 00             	movzbl (%eax),%eax
+     982:	84 c0                	test   %al,%al
+     984:	75 e2                	jne    968 <strcpy+0xd>
+    ;
+  return os;
+     986:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     989:	c9                   	leave
+     98a:	c3                   	ret
+
+0000098b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     98b:	55                   	push   %ebp
+     98c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     98e:	eb 08                	jmp    998 <strcmp+0xd>
+    p++, q++;
+     990:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     994:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     998:	8b 45 08             	mov    0x8(%ebp),%eax
+     99b:	0f b6 00             	movzbl (%eax),%eax
+     99e:	84 c0                	test   %al,%al
+     9a0:	74 10                	je     9b2 <strcmp+0x27>
+     9a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a5:	0f b6 10             	movzbl (%eax),%edx
+     9a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9ab:	0f b6 00             	movzbl (%eax),%eax
+     9ae:	38 c2                	cmp    %al,%dl
+     9b0:	74 de                	je     990 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     9b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9b5:	0f b6 00             	movzbl (%eax),%eax
+     9b8:	0f b6 d0             	movzbl %al,%edx
+     9bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9be:	0f b6 00             	movzbl (%eax),%eax
+     9c1:	0f b6 c0             	movzbl %al,%eax
+     9c4:	29 c2                	sub    %eax,%edx
+     9c6:	89 d0                	mov    %edx,%eax
+}
+     9c8:	5d                   	pop    %ebp
+     9c9:	c3                   	ret
+
+000009ca <strlen>:
+
+uint
+strlen(char *s)
+{
+     9ca:	55                   	push   %ebp
+     9cb:	89 e5                	mov    %esp,%ebp
+     9cd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+     9d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     9d7:	eb 04                	jmp    9dd <strlen+0x13>
+     9d9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     9dd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     9e0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e3:	01 d0                	add    %edx,%eax
+     9e5:	0f b6 00             	movzbl (%eax),%eax
+     9e8:	84 c0                	test   %al,%al
+     9ea:	75 ed                	jne    9d9 <strlen+0xf>
+    ;
+  return n;
+     9ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     9ef:	c9                   	leave
+     9f0:	c3                   	ret
+
+000009f1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     9f1:	55                   	push   %ebp
+     9f2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     9f4:	8b 45 10             	mov    0x10(%ebp),%eax
+     9f7:	50                   	push   %eax
+     9f8:	ff 75 0c             	push   0xc(%ebp)
+     9fb:	ff 75 08             	push   0x8(%ebp)
+     9fe:	e8 32 ff ff ff       	call   935 <stosb>
+     a03:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     a06:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     a09:	c9                   	leave
+     a0a:	c3                   	ret
+
+00000a0b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     a0b:	55                   	push   %ebp
+     a0c:	89 e5                	mov    %esp,%ebp
+     a0e:	83 ec 04             	sub    $0x4,%esp
+     a11:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a14:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     a17:	eb 14                	jmp    a2d <strchr+0x22>
+    if(*s == c)
+     a19:	8b 45 08             	mov    0x8(%ebp),%eax
+     a1c:	0f b6 00             	movzbl (%eax),%eax
+     a1f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     a22:	75 05                	jne    a29 <strchr+0x1e>
+      return (char*)s;
+     a24:	8b 45 08             	mov    0x8(%ebp),%eax
+     a27:	eb 13                	jmp    a3c <strchr+0x31>
+  for(; *s; s++)
+     a29:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+     a30:	0f b6 00             	movzbl (%eax),%eax
+     a33:	84 c0                	test   %al,%al
+     a35:	75 e2                	jne    a19 <strchr+0xe>
+  return 0;
+     a37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     a3c:	c9                   	leave
+     a3d:	c3                   	ret
+
+00000a3e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     a3e:	55                   	push   %ebp
+     a3f:	89 e5                	mov    %esp,%ebp
+     a41:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     a44:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     a4b:	eb 42                	jmp    a8f <gets+0x51>
+    cc = read(0, &c, 1);
+     a4d:	83 ec 04             	sub    $0x4,%esp
+     a50:	6a 01                	push   $0x1
+     a52:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     a55:	50                   	push   %eax
+     a56:	6a 00                	push   $0x0
+     a58:	e8 47 01 00 00       	call   ba4 <read>
+     a5d:	83 c4 10             	add    $0x10,%esp
+     a60:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     a63:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a67:	7e 33                	jle    a9c <gets+0x5e>
+      break;
+    buf[i++] = c;
+     a69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a6c:	8d 50 01             	lea    0x1(%eax),%edx
+     a6f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a72:	89 c2                	mov    %eax,%edx
+     a74:	8b 45 08             	mov    0x8(%ebp),%eax
+     a77:	01 c2                	add    %eax,%edx
+     a79:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     a7d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     a7f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     a83:	3c 0a                	cmp    $0xa,%al
+     a85:	74 16                	je     a9d <gets+0x5f>
+     a87:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     a8b:	3c 0d                	cmp    $0xd,%al
+     a8d:	74 0e                	je     a9d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     a8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a92:	83 c0 01             	add    $0x1,%eax
+     a95:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     a98:	7f b3                	jg     a4d <gets+0xf>
+     a9a:	eb 01                	jmp    a9d <gets+0x5f>
+      break;
+     a9c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     a9d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     aa0:	8b 45 08             	mov    0x8(%ebp),%eax
+     aa3:	01 d0                	add    %edx,%eax
+     aa5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     aab:	c9                   	leave
+     aac:	c3                   	ret
+
+00000aad <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     aad:	55                   	push   %ebp
+     aae:	89 e5                	mov    %esp,%ebp
+     ab0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     ab3:	83 ec 08             	sub    $0x8,%esp
+     ab6:	6a 00                	push   $0x0
+     ab8:	ff 75 08             	push   0x8(%ebp)
+     abb:	e8 0c 01 00 00       	call   bcc <open>
+     ac0:	83 c4 10             	add    $0x10,%esp
+     ac3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     ac6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     aca:	79 07                	jns    ad3 <stat+0x26>
+    return -1;
+     acc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ad1:	eb 25                	jmp    af8 <stat+0x4b>
+  r = fstat(fd, st);
+     ad3:	83 ec 08             	sub    $0x8,%esp
+     ad6:	ff 75 0c             	push   0xc(%ebp)
+     ad9:	ff 75 f4             	push   -0xc(%ebp)
+     adc:	e8 03 01 00 00       	call   be4 <fstat>
+     ae1:	83 c4 10             	add    $0x10,%esp
+     ae4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     ae7:	83 ec 0c             	sub    $0xc,%esp
+     aea:	ff 75 f4             	push   -0xc(%ebp)
+     aed:	e8 c2 00 00 00       	call   bb4 <close>
+     af2:	83 c4 10             	add    $0x10,%esp
+  return r;
+     af5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     af8:	c9                   	leave
+     af9:	c3                   	ret
+
+00000afa <atoi>:
+
+int
+atoi(const char *s)
+{
+     afa:	55                   	push   %ebp
+     afb:	89 e5                	mov    %esp,%ebp
+     afd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     b00:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     b07:	eb 25                	jmp    b2e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     b09:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     b0c:	89 d0                	mov    %edx,%eax
+     b0e:	c1 e0 02             	shl    $0x2,%eax
+     b11:	01 d0                	add    %edx,%eax
+     b13:	01 c0                	add    %eax,%eax
+     b15:	89 c1                	mov    %eax,%ecx
+     b17:	8b 45 08             	mov    0x8(%ebp),%eax
+     b1a:	8d 50 01             	lea    0x1(%eax),%edx
+     b1d:	89 55 08             	mov    %edx,0x8(%ebp)
+     b20:	0f b6 00             	movzbl (%eax),%eax
+     b23:	0f be c0             	movsbl %al,%eax
+     b26:	01 c8                	add    %ecx,%eax
+     b28:	83 e8 30             	sub    $0x30,%eax
+     b2b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+     b31:	0f b6 00             	movzbl (%eax),%eax
+     b34:	3c 2f                	cmp    $0x2f,%al
+     b36:	7e 0a                	jle    b42 <atoi+0x48>
+     b38:	8b 45 08             	mov    0x8(%ebp),%eax
+     b3b:	0f b6 00             	movzbl (%eax),%eax
+     b3e:	3c 39                	cmp    $0x39,%al
+     b40:	7e c7                	jle    b09 <atoi+0xf>
+  return n;
+     b42:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     b45:	c9                   	leave
+     b46:	c3                   	ret
+
+00000b47 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     b47:	55                   	push   %ebp
+     b48:	89 e5                	mov    %esp,%ebp
+     b4a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+     b50:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     b53:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b56:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     b59:	eb 17                	jmp    b72 <memmove+0x2b>
+    *dst++ = *src++;
+     b5b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     b5e:	8d 42 01             	lea    0x1(%edx),%eax
+     b61:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     b64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     b67:	8d 48 01             	lea    0x1(%eax),%ecx
+     b6a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     b6d:	0f b6 12             	movzbl (%edx),%edx
+     b70:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     b72:	8b 45 10             	mov    0x10(%ebp),%eax
+     b75:	8d 50 ff             	lea    -0x1(%eax),%edx
+     b78:	89 55 10             	mov    %edx,0x10(%ebp)
+     b7b:	85 c0                	test   %eax,%eax
+     b7d:	7f dc                	jg     b5b <memmove+0x14>
+  return vdst;
+     b7f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     b82:	c9                   	leave
+     b83:	c3                   	ret
+
+00000b84 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     b84:	b8 01 00 00 00       	mov    $0x1,%eax
+     b89:	cd 40                	int    $0x40
+     b8b:	c3                   	ret
+
+00000b8c <exit>:
+SYSCALL(exit)
+     b8c:	b8 02 00 00 00       	mov    $0x2,%eax
+     b91:	cd 40                	int    $0x40
+     b93:	c3                   	ret
+
+00000b94 <wait>:
+SYSCALL(wait)
+     b94:	b8 03 00 00 00       	mov    $0x3,%eax
+     b99:	cd 40                	int    $0x40
+     b9b:	c3                   	ret
+
+00000b9c <pipe>:
+SYSCALL(pipe)
+     b9c:	b8 04 00 00 00       	mov    $0x4,%eax
+     ba1:	cd 40                	int    $0x40
+     ba3:	c3                   	ret
+
+00000ba4 <read>:
+SYSCALL(read)
+     ba4:	b8 05 00 00 00       	mov    $0x5,%eax
+     ba9:	cd 40                	int    $0x40
+     bab:	c3                   	ret
+
+00000bac <write>:
+SYSCALL(write)
+     bac:	b8 10 00 00 00       	mov    $0x10,%eax
+     bb1:	cd 40                	int    $0x40
+     bb3:	c3                   	ret
+
+00000bb4 <close>:
+SYSCALL(close)
+     bb4:	b8 15 00 00 00       	mov    $0x15,%eax
+     bb9:	cd 40                	int    $0x40
+     bbb:	c3                   	ret
+
+00000bbc <kill>:
+SYSCALL(kill)
+     bbc:	b8 06 00 00 00       	mov    $0x6,%eax
+     bc1:	cd 40                	int    $0x40
+     bc3:	c3                   	ret
+
+00000bc4 <exec>:
+SYSCALL(exec)
+     bc4:	b8 07 00 00 00       	mov    $0x7,%eax
+     bc9:	cd 40                	int    $0x40
+     bcb:	c3                   	ret
+
+00000bcc <open>:
+SYSCALL(open)
+     bcc:	b8 0f 00 00 00       	mov    $0xf,%eax
+     bd1:	cd 40                	int    $0x40
+     bd3:	c3                   	ret
+
+00000bd4 <mknod>:
+SYSCALL(mknod)
+     bd4:	b8 11 00 00 00       	mov    $0x11,%eax
+     bd9:	cd 40                	int    $0x40
+     bdb:	c3                   	ret
+
+00000bdc <unlink>:
+SYSCALL(unlink)
+     bdc:	b8 12 00 00 00       	mov    $0x12,%eax
+     be1:	cd 40                	int    $0x40
+     be3:	c3                   	ret
+
+00000be4 <fstat>:
+SYSCALL(fstat)
+     be4:	b8 08 00 00 00       	mov    $0x8,%eax
+     be9:	cd 40                	int    $0x40
+     beb:	c3                   	ret
+
+00000bec <link>:
+SYSCALL(link)
+     bec:	b8 13 00 00 00       	mov    $0x13,%eax
+     bf1:	cd 40                	int    $0x40
+     bf3:	c3                   	ret
+
+00000bf4 <mkdir>:
+SYSCALL(mkdir)
+     bf4:	b8 14 00 00 00       	mov    $0x14,%eax
+     bf9:	cd 40                	int    $0x40
+     bfb:	c3                   	ret
+
+00000bfc <chdir>:
+SYSCALL(chdir)
+     bfc:	b8 09 00 00 00       	mov    $0x9,%eax
+     c01:	cd 40                	int    $0x40
+     c03:	c3                   	ret
+
+00000c04 <dup>:
+SYSCALL(dup)
+     c04:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c09:	cd 40                	int    $0x40
+     c0b:	c3                   	ret
+
+00000c0c <getpid>:
+SYSCALL(getpid)
+     c0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c11:	cd 40                	int    $0x40
+     c13:	c3                   	ret
+
+00000c14 <sbrk>:
+SYSCALL(sbrk)
+     c14:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c19:	cd 40                	int    $0x40
+     c1b:	c3                   	ret
+
+00000c1c <sleep>:
+SYSCALL(sleep)
+     c1c:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c21:	cd 40                	int    $0x40
+     c23:	c3                   	ret
+
+00000c24 <uptime>:
+SYSCALL(uptime)
+     c24:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c29:	cd 40                	int    $0x40
+     c2b:	c3                   	ret
+
+00000c2c <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+     c2c:	b8 16 00 00 00       	mov    $0x16,%eax
+     c31:	cd 40                	int    $0x40
+     c33:	c3                   	ret
+
+00000c34 <getschedstat>:
+SYSCALL(getschedstat)
+     c34:	b8 17 00 00 00       	mov    $0x17,%eax
+     c39:	cd 40                	int    $0x40
+     c3b:	c3                   	ret
+
+00000c3c <setschedpolicy>:
+SYSCALL(setschedpolicy)
+     c3c:	b8 18 00 00 00       	mov    $0x18,%eax
+     c41:	cd 40                	int    $0x40
+     c43:	c3                   	ret
+
+00000c44 <setshare>:
+SYSCALL(setshare)
+     c44:	b8 19 00 00 00       	mov    $0x19,%eax
+     c49:	cd 40                	int    $0x40
+     c4b:	c3                   	ret
+
+00000c4c <getbcachestat>:
+SYSCALL(getbcachestat)
+     c4c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     c51:	cd 40                	int    $0x40
+     c53:	c3                   	ret
+
+00000c54 <getdiskstat>:
+SYSCALL(getdiskstat)
+     c54:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     c59:	cd 40                	int    $0x40
+     c5b:	c3                   	ret
+
+00000c5c <getlogstat>:
+SYSCALL(getlogstat)
+     c5c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     c61:	cd 40                	int    $0x40
+     c63:	c3                   	ret
+
+00000c64 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     c64:	55                   	push   %ebp
+     c65:	89 e5                	mov    %esp,%ebp
+     c67:	83 ec 18             	sub    $0x18,%esp
+     c6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c6d:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+     c70:	83 ec 04             	sub    $0x4,%esp
+     c73:	6a 01                	push   $0x1
+     c75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     c78:	50                   	push   %eax
+     c79:	ff 75 08             	push   0x8(%ebp)
+     c7c:	e8 2b ff ff ff       	call   bac <write>
+     c81:	83 c4 10             	add    $0x10,%esp
+}
+     c84:	90                   	nop
+     c85:	c9                   	leave
+     c86:	c3                   	ret
+
+00000c87 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c87:	55                   	push   %ebp
+     c88:	89 e5                	mov    %esp,%ebp
+     c8a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     c8d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     c94:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     c98:	74 17                	je     cb1 <printint+0x2a>
+     c9a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c9e:	79 11                	jns    cb1 <printint+0x2a>
+    neg = 1;
+     ca0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     ca7:	8b 45 0c             	mov    0xc(%ebp),%eax
+     caa:	f7 d8                	neg    %eax
+     cac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     caf:	eb 06                	jmp    cb7 <printint+0x30>
+  } else {
+    x = xx;
+     cb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cb4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     cb7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     cbe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     cc1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+     cc9:	f7 f1                	div    %ecx
+     ccb:	89 d1                	mov    %edx,%ecx
+     ccd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cd0:	8d 50 01             	lea    0x1(%eax),%edx
+     cd3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cd6:	0f b6 91 28 16 00 00 	movzbl 0x1628(%ecx),%edx
+     cdd:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     ce1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ce4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+     cec:	f7 f1                	div    %ecx
+     cee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     cf1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     cf5:	75 c7                	jne    cbe <printint+0x37>
+  if(neg)
+     cf7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     cfb:	74 2d                	je     d2a <printint+0xa3>
+    buf[i++] = '-';
+     cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d00:	8d 50 01             	lea    0x1(%eax),%edx
+     d03:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     d06:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     d0b:	eb 1d                	jmp    d2a <printint+0xa3>
+    putc(fd, buf[i]);
+     d0d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     d10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d13:	01 d0                	add    %edx,%eax
+     d15:	0f b6 00             	movzbl (%eax),%eax
+     d18:	0f be c0             	movsbl %al,%eax
+     d1b:	83 ec 08             	sub    $0x8,%esp
+     d1e:	50                   	push   %eax
+     d1f:	ff 75 08             	push   0x8(%ebp)
+     d22:	e8 3d ff ff ff       	call   c64 <putc>
+     d27:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     d2a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     d2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d32:	79 d9                	jns    d0d <printint+0x86>
+}
+     d34:	90                   	nop
+     d35:	90                   	nop
+     d36:	c9                   	leave
+     d37:	c3                   	ret
+
+00000d38 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     d38:	55                   	push   %ebp
+     d39:	89 e5                	mov    %esp,%ebp
+     d3b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     d3e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     d45:	8d 45 0c             	lea    0xc(%ebp),%eax
+     d48:	83 c0 04             	add    $0x4,%eax
+     d4b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d4e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     d55:	e9 59 01 00 00       	jmp    eb3 <printf+0x17b>
+    c = fmt[i] & 0xff;
+     d5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d60:	01 d0                	add    %edx,%eax
+     d62:	0f b6 00             	movzbl (%eax),%eax
+     d65:	0f be c0             	movsbl %al,%eax
+     d68:	25 ff 00 00 00       	and    $0xff,%eax
+     d6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     d70:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d74:	75 2c                	jne    da2 <printf+0x6a>
+      if(c == '%'){
+     d76:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     d7a:	75 0c                	jne    d88 <printf+0x50>
+        state = '%';
+     d7c:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     d83:	e9 27 01 00 00       	jmp    eaf <printf+0x177>
+      } else {
+        putc(fd, c);
+     d88:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d8b:	0f be c0             	movsbl %al,%eax
+     d8e:	83 ec 08             	sub    $0x8,%esp
+     d91:	50                   	push   %eax
+     d92:	ff 75 08             	push   0x8(%ebp)
+     d95:	e8 ca fe ff ff       	call   c64 <putc>
+     d9a:	83 c4 10             	add    $0x10,%esp
+     d9d:	e9 0d 01 00 00       	jmp    eaf <printf+0x177>
+      }
+    } else if(state == '%'){
+     da2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     da6:	0f 85 03 01 00 00    	jne    eaf <printf+0x177>
+      if(c == 'd'){
+     dac:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     db0:	75 1e                	jne    dd0 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+     db2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     db5:	8b 00                	mov    (%eax),%eax
+     db7:	6a 01                	push   $0x1
+     db9:	6a 0a                	push   $0xa
+     dbb:	50                   	push   %eax
+     dbc:	ff 75 08             	push   0x8(%ebp)
+     dbf:	e8 c3 fe ff ff       	call   c87 <printint>
+     dc4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     dc7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     dcb:	e9 d8 00 00 00       	jmp    ea8 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+     dd0:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     dd4:	74 06                	je     ddc <printf+0xa4>
+     dd6:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     dda:	75 1e                	jne    dfa <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+     ddc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ddf:	8b 00                	mov    (%eax),%eax
+     de1:	6a 00                	push   $0x0
+     de3:	6a 10                	push   $0x10
+     de5:	50                   	push   %eax
+     de6:	ff 75 08             	push   0x8(%ebp)
+     de9:	e8 99 fe ff ff       	call   c87 <printint>
+     dee:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     df1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     df5:	e9 ae 00 00 00       	jmp    ea8 <printf+0x170>
+      } else if(c == 's'){
+     dfa:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     dfe:	75 43                	jne    e43 <printf+0x10b>
+        s = (char*)*ap;
+     e00:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e03:	8b 00                	mov    (%eax),%eax
+     e05:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     e08:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     e0c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e10:	75 25                	jne    e37 <printf+0xff>
+          s = "(null)";
+     e12:	c7 45 f4 33 12 00 00 	movl   $0x1233,-0xc(%ebp)
+        while(*s != 0){
+     e19:	eb 1c                	jmp    e37 <printf+0xff>
+          putc(fd, *s);
+     e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e1e:	0f b6 00             	movzbl (%eax),%eax
+     e21:	0f be c0             	movsbl %al,%eax
+     e24:	83 ec 08             	sub    $0x8,%esp
+     e27:	50                   	push   %eax
+     e28:	ff 75 08             	push   0x8(%ebp)
+     e2b:	e8 34 fe ff ff       	call   c64 <putc>
+     e30:	83 c4 10             	add    $0x10,%esp
+          s++;
+     e33:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     e37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e3a:	0f b6 00             	movzbl (%eax),%eax
+     e3d:	84 c0                	test   %al,%al
+     e3f:	75 da                	jne    e1b <printf+0xe3>
+     e41:	eb 65                	jmp    ea8 <printf+0x170>
+        }
+      } else if(c == 'c'){
+     e43:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     e47:	75 1d                	jne    e66 <printf+0x12e>
+        putc(fd, *ap);
+     e49:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e4c:	8b 00                	mov    (%eax),%eax
+     e4e:	0f be c0             	movsbl %al,%eax
+     e51:	83 ec 08             	sub    $0x8,%esp
+     e54:	50                   	push   %eax
+     e55:	ff 75 08             	push   0x8(%ebp)
+     e58:	e8 07 fe ff ff       	call   c64 <putc>
+     e5d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e60:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     e64:	eb 42                	jmp    ea8 <printf+0x170>
+      } else if(c == '%'){
+     e66:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     e6a:	75 17                	jne    e83 <printf+0x14b>
+        putc(fd, c);
+     e6c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e6f:	0f be c0             	movsbl %al,%eax
+     e72:	83 ec 08             	sub    $0x8,%esp
+     e75:	50                   	push   %eax
+     e76:	ff 75 08             	push   0x8(%ebp)
+     e79:	e8 e6 fd ff ff       	call   c64 <putc>
+     e7e:	83 c4 10             	add    $0x10,%esp
+     e81:	eb 25                	jmp    ea8 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     e83:	83 ec 08             	sub    $0x8,%esp
+     e86:	6a 25                	push   $0x25
+     e88:	ff 75 08             	push   0x8(%ebp)
+     e8b:	e8 d4 fd ff ff       	call   c64 <putc>
+     e90:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+     e93:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e96:	0f be c0             	movsbl %al,%eax
+     e99:	83 ec 08             	sub    $0x8,%esp
+     e9c:	50                   	push   %eax
+     e9d:	ff 75 08             	push   0x8(%ebp)
+     ea0:	e8 bf fd ff ff       	call   c64 <putc>
+     ea5:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     ea8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     eaf:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     eb3:	8b 55 0c             	mov    0xc(%ebp),%edx
+     eb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     eb9:	01 d0                	add    %edx,%eax
+     ebb:	0f b6 00             	movzbl (%eax),%eax
+     ebe:	84 c0                	test   %al,%al
+     ec0:	0f 85 94 fe ff ff    	jne    d5a <printf+0x22>
+    }
+  }
+}
+     ec6:	90                   	nop
+     ec7:	90                   	nop
+     ec8:	c9                   	leave
+     ec9:	c3                   	ret
+
+00000eca <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     eca:	55                   	push   %ebp
+     ecb:	89 e5                	mov    %esp,%ebp
+     ecd:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     ed0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed3:	83 e8 08             	sub    $0x8,%eax
+     ed6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ed9:	a1 48 16 00 00       	mov    0x1648,%eax
+     ede:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     ee1:	eb 24                	jmp    f07 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ee3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee6:	8b 00                	mov    (%eax),%eax
+     ee8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     eeb:	72 12                	jb     eff <free+0x35>
+     eed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ef0:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     ef3:	72 24                	jb     f19 <free+0x4f>
+     ef5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef8:	8b 00                	mov    (%eax),%eax
+     efa:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     efd:	72 1a                	jb     f19 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f02:	8b 00                	mov    (%eax),%eax
+     f04:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     f07:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f0a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     f0d:	73 d4                	jae    ee3 <free+0x19>
+     f0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f12:	8b 00                	mov    (%eax),%eax
+     f14:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     f17:	73 ca                	jae    ee3 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f19:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f1c:	8b 40 04             	mov    0x4(%eax),%eax
+     f1f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f26:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f29:	01 c2                	add    %eax,%edx
+     f2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f2e:	8b 00                	mov    (%eax),%eax
+     f30:	39 c2                	cmp    %eax,%edx
+     f32:	75 24                	jne    f58 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+     f34:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f37:	8b 50 04             	mov    0x4(%eax),%edx
+     f3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f3d:	8b 00                	mov    (%eax),%eax
+     f3f:	8b 40 04             	mov    0x4(%eax),%eax
+     f42:	01 c2                	add    %eax,%edx
+     f44:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f47:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f4d:	8b 00                	mov    (%eax),%eax
+     f4f:	8b 10                	mov    (%eax),%edx
+     f51:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f54:	89 10                	mov    %edx,(%eax)
+     f56:	eb 0a                	jmp    f62 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+     f58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f5b:	8b 10                	mov    (%eax),%edx
+     f5d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f60:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     f62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f65:	8b 40 04             	mov    0x4(%eax),%eax
+     f68:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f72:	01 d0                	add    %edx,%eax
+     f74:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     f77:	75 20                	jne    f99 <free+0xcf>
+    p->s.size += bp->s.size;
+     f79:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f7c:	8b 50 04             	mov    0x4(%eax),%edx
+     f7f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f82:	8b 40 04             	mov    0x4(%eax),%eax
+     f85:	01 c2                	add    %eax,%edx
+     f87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f8a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     f8d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f90:	8b 10                	mov    (%eax),%edx
+     f92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f95:	89 10                	mov    %edx,(%eax)
+     f97:	eb 08                	jmp    fa1 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+     f99:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f9c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     f9f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     fa1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     fa4:	a3 48 16 00 00       	mov    %eax,0x1648
+}
+     fa9:	90                   	nop
+     faa:	c9                   	leave
+     fab:	c3                   	ret
+
+00000fac <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     fac:	55                   	push   %ebp
+     fad:	89 e5                	mov    %esp,%ebp
+     faf:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     fb2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     fb9:	77 07                	ja     fc2 <morecore+0x16>
+    nu = 4096;
+     fbb:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     fc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     fc5:	c1 e0 03             	shl    $0x3,%eax
+     fc8:	83 ec 0c             	sub    $0xc,%esp
+     fcb:	50                   	push   %eax
+     fcc:	e8 43 fc ff ff       	call   c14 <sbrk>
+     fd1:	83 c4 10             	add    $0x10,%esp
+     fd4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     fd7:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     fdb:	75 07                	jne    fe4 <morecore+0x38>
+    return 0;
+     fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+     fe2:	eb 26                	jmp    100a <morecore+0x5e>
+  hp = (Header*)p;
+     fe4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fe7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     fea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fed:	8b 55 08             	mov    0x8(%ebp),%edx
+     ff0:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+     ff3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ff6:	83 c0 08             	add    $0x8,%eax
+     ff9:	83 ec 0c             	sub    $0xc,%esp
+     ffc:	50                   	push   %eax
+     ffd:	e8 c8 fe ff ff       	call   eca <free>
+    1002:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1005:	a1 48 16 00 00       	mov    0x1648,%eax
+}
+    100a:	c9                   	leave
+    100b:	c3                   	ret
+
+0000100c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    100c:	55                   	push   %ebp
+    100d:	89 e5                	mov    %esp,%ebp
+    100f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1012:	8b 45 08             	mov    0x8(%ebp),%eax
+    1015:	83 c0 07             	add    $0x7,%eax
+    1018:	c1 e8 03             	shr    $0x3,%eax
+    101b:	83 c0 01             	add    $0x1,%eax
+    101e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    1021:	a1 48 16 00 00       	mov    0x1648,%eax
+    1026:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1029:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    102d:	75 23                	jne    1052 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    102f:	c7 45 f0 40 16 00 00 	movl   $0x1640,-0x10(%ebp)
+    1036:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1039:	a3 48 16 00 00       	mov    %eax,0x1648
+    103e:	a1 48 16 00 00       	mov    0x1648,%eax
+    1043:	a3 40 16 00 00       	mov    %eax,0x1640
+    base.s.size = 0;
+    1048:	c7 05 44 16 00 00 00 	movl   $0x0,0x1644
+    104f:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1052:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1055:	8b 00                	mov    (%eax),%eax
+    1057:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    105a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    105d:	8b 40 04             	mov    0x4(%eax),%eax
+    1060:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1063:	72 4d                	jb     10b2 <malloc+0xa6>
+      if(p->s.size == nunits)
+    1065:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1068:	8b 40 04             	mov    0x4(%eax),%eax
+    106b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    106e:	75 0c                	jne    107c <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    1070:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1073:	8b 10                	mov    (%eax),%edx
+    1075:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1078:	89 10                	mov    %edx,(%eax)
+    107a:	eb 26                	jmp    10a2 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    107c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107f:	8b 40 04             	mov    0x4(%eax),%eax
+    1082:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1085:	89 c2                	mov    %eax,%edx
+    1087:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    108d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1090:	8b 40 04             	mov    0x4(%eax),%eax
+    1093:	c1 e0 03             	shl    $0x3,%eax
+    1096:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1099:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    109f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    10a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10a5:	a3 48 16 00 00       	mov    %eax,0x1648
+      return (void*)(p + 1);
+    10aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ad:	83 c0 08             	add    $0x8,%eax
+    10b0:	eb 3b                	jmp    10ed <malloc+0xe1>
+    }
+    if(p == freep)
+    10b2:	a1 48 16 00 00       	mov    0x1648,%eax
+    10b7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    10ba:	75 1e                	jne    10da <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    10bc:	83 ec 0c             	sub    $0xc,%esp
+    10bf:	ff 75 ec             	push   -0x14(%ebp)
+    10c2:	e8 e5 fe ff ff       	call   fac <morecore>
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10cd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10d1:	75 07                	jne    10da <malloc+0xce>
+        return 0;
+    10d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d8:	eb 13                	jmp    10ed <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10e3:	8b 00                	mov    (%eax),%eax
+    10e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    10e8:	e9 6d ff ff ff       	jmp    105a <malloc+0x4e>
+  }
+}
+    10ed:	c9                   	leave
+    10ee:	c3                   	ret
+
+000010ef <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+    10ef:	55                   	push   %ebp
+    10f0:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+    10f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10f5:	3b 45 08             	cmp    0x8(%ebp),%eax
+    10f8:	7e 08                	jle    1102 <ticks+0x13>
+    10fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10fd:	2b 45 08             	sub    0x8(%ebp),%eax
+    1100:	eb 05                	jmp    1107 <ticks+0x18>
+    1102:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1107:	5d                   	pop    %ebp
+    1108:	c3                   	ret
+
+00001109 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+    1109:	55                   	push   %ebp
+    110a:	89 e5                	mov    %esp,%ebp
+    110c:	53                   	push   %ebx
+    110d:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+    1110:	8b 45 08             	mov    0x8(%ebp),%eax
+    1113:	6b d8 64             	imul   $0x64,%eax,%ebx
+    1116:	ff 75 14             	push   0x14(%ebp)
+    1119:	ff 75 10             	push   0x10(%ebp)
+    111c:	e8 ce ff ff ff       	call   10ef <ticks>
+    1121:	83 c4 08             	add    $0x8,%esp
+    1124:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+    1126:	89 d8                	mov    %ebx,%eax
+    1128:	99                   	cltd
+    1129:	f7 f9                	idiv   %ecx
+    112b:	89 c2                	mov    %eax,%edx
+    112d:	8b 45 14             	mov    0x14(%ebp),%eax
+    1130:	2b 45 10             	sub    0x10(%ebp),%eax
+    1133:	83 ec 04             	sub    $0x4,%esp
+    1136:	ff 75 0c             	push   0xc(%ebp)
+    1139:	52                   	push   %edx
+    113a:	50                   	push   %eax
+    113b:	ff 75 0c             	push   0xc(%ebp)
+    113e:	ff 75 08             	push   0x8(%ebp)
+    1141:	68 3c 12 00 00       	push   $0x123c
+    1146:	6a 01                	push   $0x1
+    1148:	e8 eb fb ff ff       	call   d38 <printf>
+    114d:	83 c4 20             	add    $0x20,%esp
+}
+    1150:	90                   	nop
+    1151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1154:	c9                   	leave
+    1155:	c3                   	ret
+
+00001156 <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+    1156:	55                   	push   %ebp
+    1157:	89 e5                	mov    %esp,%ebp
+    1159:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+    115c:	ff 75 14             	push   0x14(%ebp)
+    115f:	ff 75 10             	push   0x10(%ebp)
+    1162:	e8 88 ff ff ff       	call   10ef <ticks>
+    1167:	83 c4 08             	add    $0x8,%esp
+    116a:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+    1170:	99                   	cltd
+    1171:	f7 7d 08             	idivl  0x8(%ebp)
+    1174:	89 c2                	mov    %eax,%edx
+    1176:	8b 45 14             	mov    0x14(%ebp),%eax
+    1179:	2b 45 10             	sub    0x10(%ebp),%eax
+    117c:	83 ec 08             	sub    $0x8,%esp
+    117f:	52                   	push   %edx
+    1180:	50                   	push   %eax
+    1181:	ff 75 0c             	push   0xc(%ebp)
+    1184:	ff 75 08             	push   0x8(%ebp)
+    1187:	68 5c 12 00 00       	push   $0x125c
+    118c:	6a 01                	push   $0x1
+    118e:	e8 a5 fb ff ff       	call   d38 <printf>
+    1193:	83 c4 20             	add    $0x20,%esp
+}
+    1196:	90                   	nop
+    1197:	c9                   	leave
+    1198:	c3                   	ret
@@ -0,0 +1,1238 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 65 02 00 00       	call   27b <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 ef 02 00 00       	call   313 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 57 02 00 00       	call   283 <exit>
+
+0000002c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+    ;
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+    ;
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 47 01 00 00       	call   29b <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 0c 01 00 00       	call   2c3 <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 03 01 00 00       	call   2db <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 c2 00 00 00       	call   2ab <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 27b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 280:	cd 40                	int    $0x40
+ 282:	c3                   	ret
+
+00000283 <exit>:
+SYSCALL(exit)
+ 283:	b8 02 00 00 00       	mov    $0x2,%eax
+ 288:	cd 40                	int    $0x40
+ 28a:	c3                   	ret
+
+0000028b <wait>:
+SYSCALL(wait)
+ 28b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 290:	cd 40                	int    $0x40
+ 292:	c3                   	ret
+
+00000293 <pipe>:
+SYSCALL(pipe)
+ 293:	b8 04 00 00 00       	mov    $0x4,%eax
+ 298:	cd 40                	int    $0x40
+ 29a:	c3                   	ret
+
+0000029b <read>:
+SYSCALL(read)
+ 29b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2a0:	cd 40                	int    $0x40
+ 2a2:	c3                   	ret
+
+000002a3 <write>:
+SYSCALL(write)
+ 2a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2a8:	cd 40                	int    $0x40
+ 2aa:	c3                   	ret
+
+000002ab <close>:
+SYSCALL(close)
+ 2ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2b0:	cd 40                	int    $0x40
+ 2b2:	c3                   	ret
+
+000002b3 <kill>:
+SYSCALL(kill)
+ 2b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2b8:	cd 40                	int    $0x40
+ 2ba:	c3                   	ret
+
+000002bb <exec>:
+SYSCALL(exec)
+ 2bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2c0:	cd 40                	int    $0x40
+ 2c2:	c3                   	ret
+
+000002c3 <open>:
+SYSCALL(open)
+ 2c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2c8:	cd 40                	int    $0x40
+ 2ca:	c3                   	ret
+
+000002cb <mknod>:
+SYSCALL(mknod)
+ 2cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2d0:	cd 40                	int    $0x40
+ 2d2:	c3                   	ret
+
+000002d3 <unlink>:
+SYSCALL(unlink)
+ 2d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2d8:	cd 40                	int    $0x40
+ 2da:	c3                   	ret
+
+000002db <fstat>:
+SYSCALL(fstat)
+ 2db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2e0:	cd 40                	int    $0x40
+ 2e2:	c3                   	ret
+
+000002e3 <link>:
+SYSCALL(link)
+ 2e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2e8:	cd 40                	int    $0x40
+ 2ea:	c3                   	ret
+
+000002eb <mkdir>:
+SYSCALL(mkdir)
+ 2eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2f0:	cd 40                	int    $0x40
+ 2f2:	c3                   	ret
+
+000002f3 <chdir>:
+SYSCALL(chdir)
+ 2f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2f8:	cd 40                	int    $0x40
+ 2fa:	c3                   	ret
+
+000002fb <dup>:
+SYSCALL(dup)
+ 2fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 300:	cd 40                	int    $0x40
+ 302:	c3                   	ret
+
+00000303 <getpid>:
+SYSCALL(getpid)
+ 303:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 308:	cd 40                	int    $0x40
+ 30a:	c3                   	ret
+
+0000030b <sbrk>:
+SYSCALL(sbrk)
+ 30b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 310:	cd 40                	int    $0x40
+ 312:	c3                   	ret
+
+00000313 <sleep>:
+SYSCALL(sleep)
+ 313:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 318:	cd 40                	int    $0x40
+ 31a:	c3                   	ret
+
+0000031b <uptime>:
+SYSCALL(uptime)
+ 31b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <enable_sched_trace>:
+SYSCALL(enable_sched_trace)
+ 323:	b8 16 00 00 00       	mov    $0x16,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <getschedstat>:
+SYSCALL(getschedstat)
+ 32b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 333:	b8 18 00 00 00       	mov    $0x18,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <setshare>:
+SYSCALL(setshare)
+ 33b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <getbcachestat>:
+SYSCALL(getbcachestat)
+ 343:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <getdiskstat>:
+SYSCALL(getdiskstat)
+ 34b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <getlogstat>:
+SYSCALL(getlogstat)
+ 353:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 35b:	55                   	push   %ebp
+ 35c:	89 e5                	mov    %esp,%ebp
+ 35e:	83 ec 18             	sub    $0x18,%esp
+ 361:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 364:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 367:	83 ec 04             	sub    $0x4,%esp
+ 36a:	6a 01                	push   $0x1
+ 36c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 36f:	50                   	push   %eax
+ 370:	ff 75 08             	push   0x8(%ebp)
+ 373:	e8 2b ff ff ff       	call   2a3 <write>
+ 378:	83 c4 10             	add    $0x10,%esp
+}
+ 37b:	90                   	nop
+ 37c:	c9                   	leave
+ 37d:	c3                   	ret
+
+0000037e <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 37e:	55                   	push   %ebp
+ 37f:	89 e5                	mov    %esp,%ebp
+ 381:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 384:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 38b:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 38f:	74 17                	je     3a8 <printint+0x2a>
+ 391:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 395:	79 11                	jns    3a8 <printint+0x2a>
+    neg = 1;
+ 397:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 39e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a1:	f7 d8                	neg    %eax
+ 3a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3a6:	eb 06                	jmp    3ae <printint+0x30>
+  } else {
+    x = xx;
+ 3a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 3ae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 3b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3b8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3bb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3c0:	f7 f1                	div    %ecx
+ 3c2:	89 d1                	mov    %edx,%ecx
+ 3c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 3ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3cd:	0f b6 91 80 0b 00 00 	movzbl 0xb80(%ecx),%edx
+ 3d4:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 3d8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3db:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 3de:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e3:	f7 f1                	div    %ecx
+ 3e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 3e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 3ec:	75 c7                	jne    3b5 <printint+0x37>
+  if(neg)
+ 3ee:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3f2:	74 2d                	je     421 <printint+0xa3>
+    buf[i++] = '-';
+ 3f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f7:	8d 50 01             	lea    0x1(%eax),%edx
+ 3fa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3fd:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 402:	eb 1d                	jmp    421 <printint+0xa3>
+    putc(fd, buf[i]);
+ 404:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 407:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40a:	01 d0                	add    %edx,%eax
+ 40c:	0f b6 00             	movzbl (%eax),%eax
+ 40f:	0f be c0             	movsbl %al,%eax
+ 412:	83 ec 08             	sub    $0x8,%esp
+ 415:	50                   	push   %eax
+ 416:	ff 75 08             	push   0x8(%ebp)
+ 419:	e8 3d ff ff ff       	call   35b <putc>
+ 41e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 421:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 425:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 429:	79 d9                	jns    404 <printint+0x86>
+}
+ 42b:	90                   	nop
+ 42c:	90                   	nop
+ 42d:	c9                   	leave
+ 42e:	c3                   	ret
+
+0000042f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 42f:	55                   	push   %ebp
+ 430:	89 e5                	mov    %esp,%ebp
+ 432:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 435:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 43c:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 43f:	83 c0 04             	add    $0x4,%eax
+ 442:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 445:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 44c:	e9 59 01 00 00       	jmp    5aa <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 451:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 454:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 457:	01 d0                	add    %edx,%eax
+ 459:	0f b6 00             	movzbl (%eax),%eax
+ 45c:	0f be c0             	movsbl %al,%eax
+ 45f:	25 ff 00 00 00       	and    $0xff,%eax
+ 464:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 467:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 46b:	75 2c                	jne    499 <printf+0x6a>
+      if(c == '%'){
+ 46d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 471:	75 0c                	jne    47f <printf+0x50>
+        state = '%';
+ 473:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 47a:	e9 27 01 00 00       	jmp    5a6 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 47f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 482:	0f be c0             	movsbl %al,%eax
+ 485:	83 ec 08             	sub    $0x8,%esp
+ 488:	50                   	push   %eax
+ 489:	ff 75 08             	push   0x8(%ebp)
+ 48c:	e8 ca fe ff ff       	call   35b <putc>
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	e9 0d 01 00 00       	jmp    5a6 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 499:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 49d:	0f 85 03 01 00 00    	jne    5a6 <printf+0x177>
+      if(c == 'd'){
+ 4a3:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 4a7:	75 1e                	jne    4c7 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 4a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4ac:	8b 00                	mov    (%eax),%eax
+ 4ae:	6a 01                	push   $0x1
+ 4b0:	6a 0a                	push   $0xa
+ 4b2:	50                   	push   %eax
+ 4b3:	ff 75 08             	push   0x8(%ebp)
+ 4b6:	e8 c3 fe ff ff       	call   37e <printint>
+ 4bb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4be:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4c2:	e9 d8 00 00 00       	jmp    59f <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 4c7:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 4cb:	74 06                	je     4d3 <printf+0xa4>
+ 4cd:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 4d1:	75 1e                	jne    4f1 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 4d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4d6:	8b 00                	mov    (%eax),%eax
+ 4d8:	6a 00                	push   $0x0
+ 4da:	6a 10                	push   $0x10
+ 4dc:	50                   	push   %eax
+ 4dd:	ff 75 08             	push   0x8(%ebp)
+ 4e0:	e8 99 fe ff ff       	call   37e <printint>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 4e8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 4ec:	e9 ae 00 00 00       	jmp    59f <printf+0x170>
+      } else if(c == 's'){
+ 4f1:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 4f5:	75 43                	jne    53a <printf+0x10b>
+        s = (char*)*ap;
+ 4f7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4fa:	8b 00                	mov    (%eax),%eax
+ 4fc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 4ff:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 503:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 507:	75 25                	jne    52e <printf+0xff>
+          s = "(null)";
+ 509:	c7 45 f4 90 08 00 00 	movl   $0x890,-0xc(%ebp)
+        while(*s != 0){
+ 510:	eb 1c                	jmp    52e <printf+0xff>
+          putc(fd, *s);
+ 512:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 515:	0f b6 00             	movzbl (%eax),%eax
+ 518:	0f be c0             	movsbl %al,%eax
+ 51b:	83 ec 08             	sub    $0x8,%esp
+ 51e:	50                   	push   %eax
+ 51f:	ff 75 08             	push   0x8(%ebp)
+ 522:	e8 34 fe ff ff       	call   35b <putc>
+ 527:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 52a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 52e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 531:	0f b6 00             	movzbl (%eax),%eax
+ 534:	84 c0                	test   %al,%al
+ 536:	75 da                	jne    512 <printf+0xe3>
+ 538:	eb 65                	jmp    59f <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 53a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 53e:	75 1d                	jne    55d <printf+0x12e>
+        putc(fd, *ap);
+ 540:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 543:	8b 00                	mov    (%eax),%eax
+ 545:	0f be c0             	movsbl %al,%eax
+ 548:	83 ec 08             	sub    $0x8,%esp
+ 54b:	50                   	push   %eax
+ 54c:	ff 75 08             	push   0x8(%ebp)
+ 54f:	e8 07 fe ff ff       	call   35b <putc>
+ 554:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 557:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 55b:	eb 42                	jmp    59f <printf+0x170>
+      } else if(c == '%'){
+ 55d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 561:	75 17                	jne    57a <printf+0x14b>
+        putc(fd, c);
+ 563:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 566:	0f be c0             	movsbl %al,%eax
+ 569:	83 ec 08             	sub    $0x8,%esp
+ 56c:	50                   	push   %eax
+ 56d:	ff 75 08             	push   0x8(%ebp)
+ 570:	e8 e6 fd ff ff       	call   35b <putc>
+ 575:	83 c4 10             	add    $0x10,%esp
+ 578:	eb 25                	jmp    59f <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 57a:	83 ec 08             	sub    $0x8,%esp
+ 57d:	6a 25                	push   $0x25
+ 57f:	ff 75 08             	push   0x8(%ebp)
+ 582:	e8 d4 fd ff ff       	call   35b <putc>
+ 587:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 58a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 58d:	0f be c0             	movsbl %al,%eax
+ 590:	83 ec 08             	sub    $0x8,%esp
+ 593:	50                   	push   %eax
+ 594:	ff 75 08             	push   0x8(%ebp)
+ 597:	e8 bf fd ff ff       	call   35b <putc>
+ 59c:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 59f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5a6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 5aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5b0:	01 d0                	add    %edx,%eax
+ 5b2:	0f b6 00             	movzbl (%eax),%eax
+ 5b5:	84 c0                	test   %al,%al
+ 5b7:	0f 85 94 fe ff ff    	jne    451 <printf+0x22>
+    }
+  }
+}
+ 5bd:	90                   	nop
+ 5be:	90                   	nop
+ 5bf:	c9                   	leave
+ 5c0:	c3                   	ret
+
+000005c1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c1:	55                   	push   %ebp
+ 5c2:	89 e5                	mov    %esp,%ebp
+ 5c4:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ca:	83 e8 08             	sub    $0x8,%eax
+ 5cd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d0:	a1 9c 0b 00 00       	mov    0xb9c,%eax
+ 5d5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 5d8:	eb 24                	jmp    5fe <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5dd:	8b 00                	mov    (%eax),%eax
+ 5df:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5e2:	72 12                	jb     5f6 <free+0x35>
+ 5e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 5e7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5ea:	72 24                	jb     610 <free+0x4f>
+ 5ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5ef:	8b 00                	mov    (%eax),%eax
+ 5f1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 5f4:	72 1a                	jb     610 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5f9:	8b 00                	mov    (%eax),%eax
+ 5fb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 5fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 601:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 604:	73 d4                	jae    5da <free+0x19>
+ 606:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 609:	8b 00                	mov    (%eax),%eax
+ 60b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 60e:	73 ca                	jae    5da <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 610:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 613:	8b 40 04             	mov    0x4(%eax),%eax
+ 616:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 61d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 620:	01 c2                	add    %eax,%edx
+ 622:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 625:	8b 00                	mov    (%eax),%eax
+ 627:	39 c2                	cmp    %eax,%edx
+ 629:	75 24                	jne    64f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 62b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 62e:	8b 50 04             	mov    0x4(%eax),%edx
+ 631:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 634:	8b 00                	mov    (%eax),%eax
+ 636:	8b 40 04             	mov    0x4(%eax),%eax
+ 639:	01 c2                	add    %eax,%edx
+ 63b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 63e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 641:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 644:	8b 00                	mov    (%eax),%eax
+ 646:	8b 10                	mov    (%eax),%edx
+ 648:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 64b:	89 10                	mov    %edx,(%eax)
+ 64d:	eb 0a                	jmp    659 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 64f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 652:	8b 10                	mov    (%eax),%edx
+ 654:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 657:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 659:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 65c:	8b 40 04             	mov    0x4(%eax),%eax
+ 65f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 666:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 669:	01 d0                	add    %edx,%eax
+ 66b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 66e:	75 20                	jne    690 <free+0xcf>
+    p->s.size += bp->s.size;
+ 670:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 673:	8b 50 04             	mov    0x4(%eax),%edx
+ 676:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 679:	8b 40 04             	mov    0x4(%eax),%eax
+ 67c:	01 c2                	add    %eax,%edx
+ 67e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 681:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 684:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 687:	8b 10                	mov    (%eax),%edx
+ 689:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68c:	89 10                	mov    %edx,(%eax)
+ 68e:	eb 08                	jmp    698 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 690:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 693:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 696:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 698:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69b:	a3 9c 0b 00 00       	mov    %eax,0xb9c
+}
+ 6a0:	90                   	nop
+ 6a1:	c9                   	leave
+ 6a2:	c3                   	ret
+
+000006a3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 6a3:	55                   	push   %ebp
+ 6a4:	89 e5                	mov    %esp,%ebp
+ 6a6:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 6a9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 6b0:	77 07                	ja     6b9 <morecore+0x16>
+    nu = 4096;
+ 6b2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bc:	c1 e0 03             	shl    $0x3,%eax
+ 6bf:	83 ec 0c             	sub    $0xc,%esp
+ 6c2:	50                   	push   %eax
+ 6c3:	e8 43 fc ff ff       	call   30b <sbrk>
+ 6c8:	83 c4 10             	add    $0x10,%esp
+ 6cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 6ce:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 6d2:	75 07                	jne    6db <morecore+0x38>
+    return 0;
+ 6d4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6d9:	eb 26                	jmp    701 <morecore+0x5e>
+  hp = (Header*)p;
+ 6db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6de:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 6e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6e7:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 6ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6ed:	83 c0 08             	add    $0x8,%eax
+ 6f0:	83 ec 0c             	sub    $0xc,%esp
+ 6f3:	50                   	push   %eax
+ 6f4:	e8 c8 fe ff ff       	call   5c1 <free>
+ 6f9:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 6fc:	a1 9c 0b 00 00       	mov    0xb9c,%eax
+}
+ 701:	c9                   	leave
+ 702:	c3                   	ret
+
+00000703 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 703:	55                   	push   %ebp
+ 704:	89 e5                	mov    %esp,%ebp
+ 706:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 709:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70c:	83 c0 07             	add    $0x7,%eax
+ 70f:	c1 e8 03             	shr    $0x3,%eax
+ 712:	83 c0 01             	add    $0x1,%eax
+ 715:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 718:	a1 9c 0b 00 00       	mov    0xb9c,%eax
+ 71d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 720:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 724:	75 23                	jne    749 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 726:	c7 45 f0 94 0b 00 00 	movl   $0xb94,-0x10(%ebp)
+ 72d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 730:	a3 9c 0b 00 00       	mov    %eax,0xb9c
+ 735:	a1 9c 0b 00 00       	mov    0xb9c,%eax
+ 73a:	a3 94 0b 00 00       	mov    %eax,0xb94
+    base.s.size = 0;
+ 73f:	c7 05 98 0b 00 00 00 	movl   $0x0,0xb98
+ 746:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 749:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 74c:	8b 00                	mov    (%eax),%eax
+ 74e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 751:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 754:	8b 40 04             	mov    0x4(%eax),%eax
+ 757:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 75a:	72 4d                	jb     7a9 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 75c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 75f:	8b 40 04             	mov    0x4(%eax),%eax
+ 762:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 765:	75 0c                	jne    773 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 767:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76a:	8b 10                	mov    (%eax),%edx
+ 76c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 76f:	89 10                	mov    %edx,(%eax)
+ 771:	eb 26                	jmp    799 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 776:	8b 40 04             	mov    0x4(%eax),%eax
+ 779:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 77c:	89 c2                	mov    %eax,%edx
+ 77e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 781:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 784:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 787:	8b 40 04             	mov    0x4(%eax),%eax
+ 78a:	c1 e0 03             	shl    $0x3,%eax
+ 78d:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 790:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 793:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 796:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 799:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 79c:	a3 9c 0b 00 00       	mov    %eax,0xb9c
+      return (void*)(p + 1);
+ 7a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a4:	83 c0 08             	add    $0x8,%eax
+ 7a7:	eb 3b                	jmp    7e4 <malloc+0xe1>
+    }
+    if(p == freep)
+ 7a9:	a1 9c 0b 00 00       	mov    0xb9c,%eax
+ 7ae:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 7b1:	75 1e                	jne    7d1 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	ff 75 ec             	push   -0x14(%ebp)
+ 7b9:	e8 e5 fe ff ff       	call   6a3 <morecore>
+ 7be:	83 c4 10             	add    $0x10,%esp
+ 7c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 7c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7c8:	75 07                	jne    7d1 <malloc+0xce>
+        return 0;
+ 7ca:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7cf:	eb 13                	jmp    7e4 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7da:	8b 00                	mov    (%eax),%eax
+ 7dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7df:	e9 6d ff ff ff       	jmp    751 <malloc+0x4e>
+  }
+}
+ 7e4:	c9                   	leave
+ 7e5:	c3                   	ret
+
+000007e6 <ticks>:
+#include "stat.h"
+#include "user.h"
+
+static int
+ticks(int t0, int t1)
+{
+ 7e6:	55                   	push   %ebp
+ 7e7:	89 e5                	mov    %esp,%ebp
+  return t1 > t0 ? t1 - t0 : 1;
+ 7e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ec:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 7ef:	7e 08                	jle    7f9 <ticks+0x13>
+ 7f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7f4:	2b 45 08             	sub    0x8(%ebp),%eax
+ 7f7:	eb 05                	jmp    7fe <ticks+0x18>
+ 7f9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 7fe:	5d                   	pop    %ebp
+ 7ff:	c3                   	ret
+
+00000800 <benchrate>:
+
+// Print "n what in t ticks, r what/sec" for n things done
+// between uptime() readings t0 and t1.
+void
+benchrate(int n, char *what, int t0, int t1)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	53                   	push   %ebx
+ 804:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+         n, what, t1 - t0, n * 100 / ticks(t0, t1), what);
+ 807:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80a:	6b d8 64             	imul   $0x64,%eax,%ebx
+ 80d:	ff 75 14             	push   0x14(%ebp)
+ 810:	ff 75 10             	push   0x10(%ebp)
+ 813:	e8 ce ff ff ff       	call   7e6 <ticks>
+ 818:	83 c4 08             	add    $0x8,%esp
+ 81b:	89 c1                	mov    %eax,%ecx
+  printf(1, "%d %s in %d ticks, %d %s/sec\n",
+ 81d:	89 d8                	mov    %ebx,%eax
+ 81f:	99                   	cltd
+ 820:	f7 f9                	idiv   %ecx
+ 822:	89 c2                	mov    %eax,%edx
+ 824:	8b 45 14             	mov    0x14(%ebp),%eax
+ 827:	2b 45 10             	sub    0x10(%ebp),%eax
+ 82a:	83 ec 04             	sub    $0x4,%esp
+ 82d:	ff 75 0c             	push   0xc(%ebp)
+ 830:	52                   	push   %edx
+ 831:	50                   	push   %eax
+ 832:	ff 75 0c             	push   0xc(%ebp)
+ 835:	ff 75 08             	push   0x8(%ebp)
+ 838:	68 98 08 00 00       	push   $0x898
+ 83d:	6a 01                	push   $0x1
+ 83f:	e8 eb fb ff ff       	call   42f <printf>
+ 844:	83 c4 20             	add    $0x20,%esp
+}
+ 847:	90                   	nop
+ 848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 84b:	c9                   	leave
+ 84c:	c3                   	ret
+
+0000084d <benchtime>:
+
+// Print "n what in t ticks, u us each" for n things done
+// between uptime() readings t0 and t1.
+void
+benchtime(int n, char *what, int t0, int t1)
+{
+ 84d:	55                   	push   %ebp
+ 84e:	89 e5                	mov    %esp,%ebp
+ 850:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "%d %s in %d ticks, %d us each\n",
+         n, what, t1 - t0, ticks(t0, t1) * 10000 / n);
+ 853:	ff 75 14             	push   0x14(%ebp)
+ 856:	ff 75 10             	push   0x10(%ebp)
+ 859:	e8 88 ff ff ff       	call   7e6 <ticks>
+ 85e:	83 c4 08             	add    $0x8,%esp
+ 861:	69 c0 10 27 00 00    	imul   $0x2710,%eax,%eax
+  printf(1, "%d %s in %d ticks, %d us each\n",
+ 867:	99                   	cltd
+ 868:	f7 7d 08             	idivl  0x8(%ebp)
+ 86b:	89 c2                	mov    %eax,%edx
+ 86d:	8b 45 14             	mov    0x14(%ebp),%eax
+ 870:	2b 45 10             	sub    0x10(%ebp),%eax
+ 873:	83 ec 08             	sub    $0x8,%esp
+ 876:	52                   	push   %edx
+ 877:	50                   	push   %eax
+ 878:	ff 75 0c             	push   0xc(%ebp)
+ 87b:	ff 75 08             	push   0x8(%ebp)
+ 87e:	68 b8 08 00 00       	push   $0x8b8
+ 883:	6a 01                	push   $0x1
+ 885:	e8 a5 fb ff ff       	call   42f <printf>
+ 88a:	83 c4 20             	add    $0x20,%esp
+}
+ 88d:	90                   	nop
+ 88e:	c9                   	leave
+ 88f:	c3                   	ret